@@ -2232,6 +2232,9 @@ public:
   INSN(mlsv, 1, 0b100101);
   INSN(sshl, 0, 0b010001);
   INSN(ushl, 1, 0b010001);
+  INSN(cmeq, 1, 0b100011);
+  INSN(cmgt, 0, 0b001101);
+  INSN(cmge, 0, 0b001111);
 
 #undef INSN
 
@@ -2247,6 +2250,7 @@ public:
   INSN(negr,  1, 0b100000101110);
   INSN(notr,  1, 0b100000010110);
   INSN(addv,  0, 0b110001101110);
+  INSN(uaddlv, 1, 0b110000001110);
   INSN(cls,   0, 0b100000010010);
   INSN(clz,   1, 0b100000010010);
   INSN(cnt,   0, 0b100000010110);
@@ -2466,6 +2470,24 @@ public:
     pmull(Vd, Ta, Vn, Vm, Tb);
   }
 
+  // Unsigned widening multiply (and accumulate): Vd.Ta (+)= Vn.Tb * Vm.Tb
+#define INSN(NAME, opc)                                                                 \
+  void NAME(FloatRegister Vd, SIMD_Arrangement Ta, FloatRegister Vn, FloatRegister Vm, SIMD_Arrangement Tb) { \
+    starti;                                                                             \
+    assert((Tb >> 1) + 1 == (Ta >> 1), "Incompatible arrangement");                     \
+    f(0, 31), f(Tb & 1, 30), f(0b101110, 29, 24), f((int)Tb >> 1, 23, 22);              \
+    f(1, 21), rf(Vm, 16), f(opc, 15, 10), rf(Vn, 5), rf(Vd, 0);                         \
+  }                                                                                     \
+  void NAME##2(FloatRegister Vd, SIMD_Arrangement Ta, FloatRegister Vn, FloatRegister Vm, SIMD_Arrangement Tb) { \
+    assert(Tb == T16B || Tb == T8H || Tb == T4S, #NAME "2 assumes a 128-bit source"); \
+    NAME(Vd, Ta, Vn, Vm, Tb);                                                           \
+  }
+
+  INSN(umull, 0b110000);
+  INSN(umlal, 0b100000);
+
+#undef INSN
+
   void uqxtn(FloatRegister Vd, SIMD_Arrangement Tb, FloatRegister Vn, SIMD_Arrangement Ta) {
     starti;
     int size_b = (int)Tb >> 1;
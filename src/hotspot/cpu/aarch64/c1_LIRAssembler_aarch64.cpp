@@ -1377,6 +1377,12 @@ void LIR_Assembler::emit_typecheck_helper(LIR_OpTypeCheck *op, Label* success, L
     // not a safepoint as obj null check happens earlier
     __ load_klass(klass_RInfo, obj);
     if (k->is_loaded()) {
+      if (op->likely_klass() != NULL) {
+        // The dominant type recorded in the profile is a subtype of k
+        __ mov_metadata(rscratch1, op->likely_klass()->constant_encoding());
+        __ cmp(klass_RInfo, rscratch1);
+        __ br(Assembler::EQ, *success_target);
+      }
       // See if we get an immediate positive hit
       __ ldr(rscratch1, Address(klass_RInfo, long(k->super_check_offset())));
       __ cmp(k_RInfo, rscratch1);
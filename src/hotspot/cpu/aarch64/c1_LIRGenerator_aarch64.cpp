@@ -1267,7 +1267,7 @@ void LIRGenerator::do_CheckCast(CheckCast* x) {
   __ checkcast(reg, obj.result(), x->klass(),
                new_register(objectType), new_register(objectType), tmp3,
                x->direct_compare(), info_for_exception, patching_info, stub,
-               x->profiled_method(), x->profiled_bci());
+               x->profiled_method(), x->profiled_bci(), x->likely_klass());
 }
 
 void LIRGenerator::do_InstanceOf(InstanceOf* x) {
@@ -1287,7 +1287,8 @@ void LIRGenerator::do_InstanceOf(InstanceOf* x) {
   }
   __ instanceof(reg, obj.result(), x->klass(),
                 new_register(objectType), new_register(objectType), tmp3,
-                x->direct_compare(), patching_info, x->profiled_method(), x->profiled_bci());
+                x->direct_compare(), patching_info, x->profiled_method(), x->profiled_bci(),
+                x->likely_klass());
 }
 
 void LIRGenerator::do_If(If* x) {
@@ -1347,7 +1348,7 @@ void LIRGenerator::do_If(If* x) {
 
   __ cmp(lir_cond(cond), left, right);
   // Generate branch profiling. Profiling code doesn't kill flags.
-  profile_branch(x, cond);
+  profile_branch(x, cond, left, right);
   move_to_phi(x->state());
   if (x->x()->type()->is_float_kind()) {
     __ branch(lir_cond(cond), right->type(), x->tsux(), x->usux());
@@ -239,6 +239,15 @@ void ShenandoahBarrierSetAssembler::load_reference_barrier_not_null(MacroAssembl
   // Check for heap stability
   __ tbz(rscratch2, ShenandoahHeap::HAS_FORWARDED_BITPOS, done);
 
+  // Check for object in cset, and skip the stub call if it is not there.
+  // If dst is the scratch register, the stub does this test instead.
+  if (dst != rscratch1) {
+    __ mov(rscratch2, ShenandoahHeap::in_cset_fast_test_addr());
+    __ lsr(rscratch1, dst, ShenandoahHeapRegion::region_size_bytes_shift_jint());
+    __ ldrb(rscratch2, Address(rscratch2, rscratch1));
+    __ tbz(rscratch2, 0, done);
+  }
+
   // use r1 for load address
   Register result_dst = dst;
   if (dst == r1) {
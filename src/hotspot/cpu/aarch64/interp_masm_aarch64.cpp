@@ -913,6 +913,27 @@ void InterpreterMacroAssembler::increment_mdp_data_at(Register mdp_in,
   increment_mdp_data_at(mdp_in, noreg, constant, decrement);
 }
 
+// With InterpreterProfileSampleRate > 1 a thread only updates the MDO
+// counters every n-th time it executes a profiled bytecode and then
+// advances them by n. This keeps the counts unbiased while cutting the
+// stores into MDOs shared by many threads.
+bool InterpreterMacroAssembler::sample_profile_updates() const {
+  return InterpreterProfileSampleRate > 1;
+}
+
+// Branches to skip unless the countdown of the current thread expires, in
+// which case it is rearmed. Kills rscratch1 and the condition flags.
+void InterpreterMacroAssembler::sample_profile_update(Label& skip) {
+  assert(sample_profile_updates(), "sampling not enabled");
+  Address countdown(rthread, JavaThread::interp_profile_countdown_offset());
+  ldrw(rscratch1, countdown);
+  subsw(rscratch1, rscratch1, 1);
+  strw(rscratch1, countdown);
+  br(Assembler::GT, skip);
+  movw(rscratch1, (int) InterpreterProfileSampleRate);
+  strw(rscratch1, countdown);
+}
+
 void InterpreterMacroAssembler::increment_mdp_data_at(Register mdp_in,
                                                       Register reg,
                                                       int constant,
@@ -931,7 +952,21 @@ void InterpreterMacroAssembler::increment_mdp_data_at(Register mdp_in,
     addr = addr2;
   }
 
-  if (decrement) {
+  if (sample_profile_updates()) {
+    unsigned delta = (unsigned) (InterpreterProfileSampleRate * DataLayout::counter_increment);
+    Label done;
+    sample_profile_update(done);
+    ldr(rscratch1, addr);
+    if (decrement) {
+      subs(rscratch1, rscratch1, delta);
+      br(Assembler::LO, done);    // skip store if counter underflow
+    } else {
+      adds(rscratch1, rscratch1, delta);
+      br(Assembler::CS, done);    // skip store if counter overflow
+    }
+    str(rscratch1, addr);
+    bind(done);
+  } else if (decrement) {
     // Decrement the register.  Set condition codes.
     // Intel does this
     // addptr(data, (int32_t) -DataLayout::counter_increment);
@@ -1046,17 +1081,28 @@ void InterpreterMacroAssembler::profile_taken_branch(Register mdp,
     //increment_mdp_data_at(mdp, in_bytes(JumpData::taken_offset()));
     Address data(mdp, in_bytes(JumpData::taken_offset()));
     ldr(bumped_count, data);
-    assert(DataLayout::counter_increment == 1,
-            "flow-free idiom only works with 1");
-    // Intel does this to catch overflow
-    // addptr(bumped_count, DataLayout::counter_increment);
-    // sbbptr(bumped_count, 0);
-    // so we do this
-    adds(bumped_count, bumped_count, DataLayout::counter_increment);
-    Label L;
-    br(Assembler::CS, L);       // skip store if counter overflow
-    str(bumped_count, data);
-    bind(L);
+    if (sample_profile_updates()) {
+      unsigned delta = (unsigned) (InterpreterProfileSampleRate * DataLayout::counter_increment);
+      Label L;
+      sample_profile_update(L);
+      adds(rscratch1, bumped_count, delta);
+      br(Assembler::CS, L);       // skip store if counter overflow
+      mov(bumped_count, rscratch1);
+      str(bumped_count, data);
+      bind(L);
+    } else {
+      assert(DataLayout::counter_increment == 1,
+              "flow-free idiom only works with 1");
+      // Intel does this to catch overflow
+      // addptr(bumped_count, DataLayout::counter_increment);
+      // sbbptr(bumped_count, 0);
+      // so we do this
+      adds(bumped_count, bumped_count, DataLayout::counter_increment);
+      Label L;
+      br(Assembler::CS, L);       // skip store if counter overflow
+      str(bumped_count, data);
+      bind(L);
+    }
     // The method data pointer needs to be updated to reflect the new target.
     update_mdp_by_offset(mdp, in_bytes(JumpData::displacement_offset()));
     bind(profile_continue);
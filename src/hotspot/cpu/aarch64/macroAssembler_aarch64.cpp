@@ -5073,6 +5073,56 @@ void MacroAssembler::has_negatives(Register ary1, Register len, Register result)
   BIND(DONE);
 }
 
+// Latin1 String.hashCode(): h = 31 * h + (b & 0xff) over the byte array.
+// Four bytes are consumed per vector iteration; lane i accumulates
+// acc * 31^4 + ary1[4k + i], and the lanes are folded with multiplier 31
+// before the scalar tail.
+void MacroAssembler::string_hashcode_latin1(Register ary1, Register cnt, Register result,
+                                            Register tmp, FloatRegister vtmp1,
+                                            FloatRegister vtmp2, FloatRegister vtmp3) {
+  Label VECTOR_LOOP, TAIL, TAIL_LOOP, DONE;
+  Register mul31 = rscratch1;
+  assert_different_registers(ary1, cnt, result, tmp, rscratch1, rscratch2);
+
+  BLOCK_COMMENT("string_hashcode_latin1 {");
+
+  mov(result, zr);
+  movw(mul31, 31);
+  cmpw(cnt, 4);
+  br(LT, TAIL);
+
+  movw(tmp, 923521); // 31^4
+  dup(vtmp2, T4S, tmp);
+  eor(vtmp1, T16B, vtmp1, vtmp1);
+
+  BIND(VECTOR_LOOP);
+    ldrs(vtmp3, Address(post(ary1, 4)));
+    ushll(vtmp3, T8H, vtmp3, T8B, 0);
+    ushll(vtmp3, T4S, vtmp3, T4H, 0);
+    mulv(vtmp1, T4S, vtmp1, vtmp2);
+    addv(vtmp1, T4S, vtmp1, vtmp3);
+    subw(cnt, cnt, 4);
+    cmpw(cnt, 4);
+    br(GE, VECTOR_LOOP);
+
+  // Fold the lanes: result = sum(vtmp1[i] * 31^(3 - i))
+  for (int i = 0; i < 4; i++) {
+    umov(tmp, vtmp1, S, i);
+    maddw(result, result, mul31, tmp);
+  }
+
+  BIND(TAIL);
+    cbzw(cnt, DONE);
+  BIND(TAIL_LOOP);
+    ldrb(tmp, Address(post(ary1, 1)));
+    maddw(result, result, mul31, tmp);
+    subsw(cnt, cnt, 1);
+    br(NE, TAIL_LOOP);
+
+  BIND(DONE);
+  BLOCK_COMMENT("} string_hashcode_latin1");
+}
+
 void MacroAssembler::arrays_equals(Register a1, Register a2, Register tmp3,
                                    Register tmp4, Register tmp5, Register result,
                                    Register cnt1, int elem_size) {
@@ -5600,7 +5650,9 @@ void MacroAssembler::encode_iso_array(Register src, Register dst,
         BIND(NEXT_32);
           ld1(Vtmp1, Vtmp2, Vtmp3, Vtmp4, T8H, src);
       }
-      prfm(Address(src, SoftwarePrefetchHintDistance));
+      // No prefetch here: either prefetching is disabled, or fewer than
+      // SoftwarePrefetchHintDistance bytes remain and the hint would
+      // only touch memory past the end of the source array.
       uzp1(v4, T16B, Vtmp1, Vtmp2);
       uzp1(v5, T16B, Vtmp3, Vtmp4);
       orr(Vtmp1, T16B, Vtmp1, Vtmp2);
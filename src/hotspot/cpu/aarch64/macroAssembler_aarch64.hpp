@@ -413,6 +413,7 @@ class MacroAssembler: public Assembler {
   inline void umnegl(Register Rd, Register Rn, Register Rm) {
     umsubl(Rd, Rn, Rm, zr);
   }
+  using Assembler::umull;
   inline void umull(Register Rd, Register Rn, Register Rm) {
     umaddl(Rd, Rn, Rm, zr);
   }
@@ -1199,6 +1200,10 @@ public:
 
   void has_negatives(Register ary1, Register len, Register result);
 
+  void string_hashcode_latin1(Register ary1, Register cnt, Register result,
+                              Register tmp, FloatRegister vtmp1,
+                              FloatRegister vtmp2, FloatRegister vtmp3);
+
   void arrays_equals(Register a1, Register a2, Register result, Register cnt1,
                      Register tmp1, Register tmp2, Register tmp3, int elem_size);
 
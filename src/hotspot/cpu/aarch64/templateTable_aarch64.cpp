@@ -600,7 +600,8 @@ void TemplateTable::iload_internal(RewriteControl rc) {
 
     // if _iload, wait to rewrite to iload2.  We only want to rewrite the
     // last two iloads in a pair.  Comparing against fast_iload means that
-    // the next bytecode is neither an iload or a caload, and therefore
+    // the next bytecode is neither an iload nor an array load that is
+    // fused with iload (caload, iaload, baload), and therefore
     // an iload pair.
     __ cmpw(r1, Bytecodes::_iload);
     __ br(Assembler::EQ, done);
@@ -615,6 +616,16 @@ void TemplateTable::iload_internal(RewriteControl rc) {
     __ movw(bc, Bytecodes::_fast_icaload);
     __ br(Assembler::EQ, rewrite);
 
+    // if _iaload rewrite to _fast_iiaload
+    __ cmpw(r1, Bytecodes::_iaload);
+    __ movw(bc, Bytecodes::_fast_iiaload);
+    __ br(Assembler::EQ, rewrite);
+
+    // if _baload rewrite to _fast_ibaload
+    __ cmpw(r1, Bytecodes::_baload);
+    __ movw(bc, Bytecodes::_fast_ibaload);
+    __ br(Assembler::EQ, rewrite);
+
     // else rewrite to _fast_iload
     __ movw(bc, Bytecodes::_fast_iload);
 
@@ -856,6 +867,25 @@ void TemplateTable::fast_icaload()
   __ access_load_at(T_CHAR, IN_HEAP | IS_ARRAY, r0, Address(r0, r1, Address::uxtw(1)), noreg, noreg);
 }
 
+// iload followed by iaload or baload
+void TemplateTable::fast_ixaload(int type)
+{
+  transition(vtos, itos);
+  BasicType bt = (BasicType)type;
+  int shift = exact_log2(type2aelembytes(bt));
+  // load index out of locals
+  locals_index(r2);
+  __ ldr(r1, iaddress(r2));
+
+  __ pop_ptr(r0);
+
+  // r0: array
+  // r1: index
+  index_check(r0, r1); // leaves index in r1, kills rscratch1
+  __ add(r1, r1, arrayOopDesc::base_offset_in_bytes(bt) >> shift);
+  __ access_load_at(bt, IN_HEAP | IS_ARRAY, r0, Address(r0, r1, Address::uxtw(shift)), noreg, noreg);
+}
+
 void TemplateTable::saload()
 {
   transition(itos, itos);
@@ -3644,23 +3674,129 @@ void TemplateTable::_new() {
   __ membar(Assembler::StoreStore);
 }
 
+// Arrays up to this length are allocated inline in the TLAB by
+// newarray and anewarray; longer ones go through the runtime.
+static const int max_inline_array_length = 256;
+
+// Inline TLAB allocation of a small array.
+//   r0: length, known to be in [0, max_inline_array_length]
+//   r4: array klass
+// On success r0 holds the new array and control goes to done.
+void TemplateTable::allocate_small_array(Label& slow_case, Label& done) {
+  assert(UseTLAB, "only inline TLAB allocation is supported");
+  const Register obj = r2;  // r0 must still hold the length on the slow path
+
+  // array size in bytes:
+  //   align_up(header_size + (length << log2_element_size), MinObjAlignmentInBytes)
+  __ ldrw(r1, Address(r4, Klass::layout_helper_offset()));
+  __ ubfx(r3, r1, Klass::_lh_header_size_shift,
+          exact_log2(Klass::_lh_header_size_mask + 1));
+  __ movw(r5, r0);
+  __ lslv(r5, r5, r1);  // by the low bits of r1, log2 element size
+  __ add(r5, r5, r3);
+  __ add(r5, r5, MinObjAlignmentInBytesMask);
+  __ andr(r5, r5, ~MinObjAlignmentInBytesMask);
+
+  __ tlab_allocate(obj, r5, 0, noreg, r1, slow_case);
+
+  if (!ZeroTLAB) {
+    // Clear everything after the mark word: the klass word, the length
+    // and the elements. The size is a multiple of 8 and at least 16.
+    __ add(r3, obj, oopDesc::klass_offset_in_bytes());
+    __ sub(r5, r5, oopDesc::klass_offset_in_bytes());
+    Label loop;
+    __ bind(loop);
+    __ str(zr, Address(__ post(r3, BytesPerLong)));
+    __ sub(r5, r5, BytesPerLong);
+    __ cbnz(r5, loop);
+  }
+
+  // initialize the header
+  __ strw(r0, Address(obj, arrayOopDesc::length_offset_in_bytes()));
+  if (UseBiasedLocking) {
+    __ ldr(rscratch1, Address(r4, Klass::prototype_header_offset()));
+  } else {
+    __ mov(rscratch1, (intptr_t)markOopDesc::prototype());
+  }
+  __ str(rscratch1, Address(obj, oopDesc::mark_offset_in_bytes()));
+  __ store_klass(obj, r4);  // store klass last
+  __ mov(r0, obj);
+
+  {
+    SkipIfEqual skip(_masm, &DTraceAllocProbes, false);
+    // Trigger dtrace event for fastpath
+    __ push(atos); // save the return value
+    __ call_VM_leaf(
+         CAST_FROM_FN_PTR(address, SharedRuntime::dtrace_object_alloc), r0);
+    __ pop(atos); // restore the return value
+  }
+  __ b(done);
+}
+
 void TemplateTable::newarray() {
   transition(itos, atos);
+  Label slow_case, done;
+
+  if (UseTLAB) {
+    // unsigned compare also sends negative lengths to the runtime
+    __ cmpw(r0, max_inline_array_length);
+    __ br(Assembler::HI, slow_case);
+
+    __ load_unsigned_byte(r1, at_bcp(1));
+    __ lea(r4, ExternalAddress((address)Universe::typeArrayKlassObjs_addr()));
+    __ ldr(r4, Address(r4, r1, Address::lsl(LogBytesPerWord)));
+    allocate_small_array(slow_case, done);
+  }
+
+  __ bind(slow_case);
   __ load_unsigned_byte(c_rarg1, at_bcp(1));
   __ mov(c_rarg2, r0);
   call_VM(r0, CAST_FROM_FN_PTR(address, InterpreterRuntime::newarray),
           c_rarg1, c_rarg2);
+
+  __ bind(done);
   // Must prevent reordering of stores for object initialization with stores that publish the new object.
   __ membar(Assembler::StoreStore);
 }
 
 void TemplateTable::anewarray() {
   transition(itos, atos);
+  Label slow_case, done;
+
+  if (UseTLAB) {
+    // unsigned compare also sends negative lengths to the runtime
+    __ cmpw(r0, max_inline_array_length);
+    __ br(Assembler::HI, slow_case);
+
+    // the element class must be resolved
+    __ get_unsigned_2_byte_index_at_bcp(r3, 1);
+    __ get_cpool_and_tags(r4, r1);
+    const int tags_offset = Array<u1>::base_offset_in_bytes();
+    __ lea(rscratch1, Address(r1, r3, Address::lsl(0)));
+    __ lea(rscratch1, Address(rscratch1, tags_offset));
+    __ ldarb(rscratch1, rscratch1);
+    __ cmp(rscratch1, JVM_CONSTANT_Class);
+    __ br(Assembler::NE, slow_case);
+    __ load_resolved_klass_at_offset(r4, r3, r4, rscratch1);
+
+    // only instance element classes whose array class already exists
+    __ ldrw(rscratch1, Address(r4, Klass::layout_helper_offset()));
+    __ cmpw(rscratch1, Klass::_lh_neutral_value);
+    __ br(Assembler::LE, slow_case);
+    __ lea(r4, Address(r4, InstanceKlass::array_klasses_offset()));
+    __ ldar(r4, r4);
+    __ cbz(r4, slow_case);
+    allocate_small_array(slow_case, done);
+  }
+
+  __ bind(slow_case);
   __ get_unsigned_2_byte_index_at_bcp(c_rarg2, 1);
   __ get_constant_pool(c_rarg1);
   __ mov(c_rarg3, r0);
   call_VM(r0, CAST_FROM_FN_PTR(address, InterpreterRuntime::anewarray),
           c_rarg1, c_rarg2, c_rarg3);
+
+  __ bind(done);
   // Must prevent reordering of stores for object initialization with stores that publish the new object.
   __ membar(Assembler::StoreStore);
 }
@@ -38,5 +38,6 @@ static void prepare_invoke(int byte_no,
   // Helpers
   static void index_check(Register array, Register index);
   static void index_check_without_pop(Register array, Register index);
+  static void allocate_small_array(Label& slow_case, Label& done);
 
 #endif // CPU_AARCH64_VM_TEMPLATETABLE_AARCH64_64_HPP
@@ -35,6 +35,7 @@
 #include OS_HEADER_INLINE(os)
 
 #include <sys/auxv.h>
+#include <sys/prctl.h>
 #include <asm/hwcap.h>
 
 #ifndef HWCAP_AES
@@ -61,12 +62,26 @@
 #define HWCAP_ATOMICS (1<<8)
 #endif
 
+#ifndef HWCAP_SVE
+#define HWCAP_SVE (1<<22)
+#endif
+
+#ifndef PR_SVE_GET_VL
+// For old toolchains which do not have SVE related macros defined.
+#define PR_SVE_GET_VL 51
+#endif
+
+#ifndef PR_SVE_VL_LEN_MASK
+#define PR_SVE_VL_LEN_MASK 0xffff
+#endif
+
 int VM_Version::_cpu;
 int VM_Version::_model;
 int VM_Version::_model2;
 int VM_Version::_variant;
 int VM_Version::_revision;
 int VM_Version::_stepping;
+int VM_Version::_sve_vector_length;
 VM_Version::PsrInfo VM_Version::_psr_info   = { 0, };
 
 static BufferBlob* stub_blob;
@@ -236,6 +251,30 @@ void VM_Version::get_processor_features() {
     }
   }
 
+#ifdef COMPILER2
+  // Out-of-order cores with a longer L1 load-to-use latency than the
+  // generic pipeline description in aarch64.ad assumes.  Let GCM and
+  // LCM schedule loads further ahead of their uses on these.
+  static const struct {
+    int cpu;
+    int model;
+    int load_use_latency;
+  } load_latencies[] = {
+    { CPU_ARM,       0xd07, 2 },  // Cortex-A57
+    { CPU_ARM,       0xd08, 2 },  // Cortex-A72
+    { CPU_ARM,       0xd0c, 2 },  // Neoverse N1
+    { CPU_HISILICON, 0xd01, 2 },  // Kunpeng 920 (TSV110)
+  };
+  for (size_t i = 0; i < sizeof(load_latencies) / sizeof(load_latencies[0]); i++) {
+    if (_cpu == load_latencies[i].cpu && _model == load_latencies[i].model && _model2 == 0) {
+      if (FLAG_IS_DEFAULT(OptoLoadUseLatency)) {
+        FLAG_SET_DEFAULT(OptoLoadUseLatency, load_latencies[i].load_use_latency);
+      }
+      break;
+    }
+  }
+#endif
+
   if (_cpu == CPU_ARM && (_model == 0xd07 || _model2 == 0xd07)) _features |= CPU_STXR_PREFETCH;
   // If an olde style /proc/cpuinfo (cpu_lines == 1) then if _model is an A57 (0xd07)
   // we assume the worst and assume we could be on a big little system and have
@@ -250,6 +289,12 @@ void VM_Version::get_processor_features() {
   if (auxv & HWCAP_SHA1)  strcat(buf, ", sha1");
   if (auxv & HWCAP_SHA2)  strcat(buf, ", sha256");
   if (auxv & HWCAP_ATOMICS) strcat(buf, ", lse");
+  if (auxv & HWCAP_SVE) {
+    // The vector length of the current thread, in bytes.
+    int vl = prctl(PR_SVE_GET_VL);
+    _sve_vector_length = (vl >= 0) ? (vl & PR_SVE_VL_LEN_MASK) : 0;
+    sprintf(buf+strlen(buf), ", sve(%d bits)", _sve_vector_length * BitsPerByte);
+  }
 
   _features_string = os::strdup(buf);
 
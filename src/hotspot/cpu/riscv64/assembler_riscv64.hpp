@@ -1206,6 +1206,155 @@ enum operand_size { int8, int16, int32, uint32, int64 };
 
 #undef INSN
 
+// Bit-manipulation Extension Zba/Zbb, Register Instruction
+#define INSN(NAME, op, funct3, funct7)                          \
+  void NAME(Register Rd, Register Rs1, Register Rs2) {          \
+    unsigned insn = 0;                                          \
+    patch((address)&insn, 6,  0, op);                           \
+    patch((address)&insn, 14, 12, funct3);                      \
+    patch((address)&insn, 31, 25, funct7);                      \
+    patch_reg((address)&insn, 7, Rd);                           \
+    patch_reg((address)&insn, 15, Rs1);                         \
+    patch_reg((address)&insn, 20, Rs2);                         \
+    emit(insn);                                                 \
+  }
+
+  INSN(sh1add, 0b0110011, 0b010, 0b0010000);
+  INSN(sh2add, 0b0110011, 0b100, 0b0010000);
+  INSN(sh3add, 0b0110011, 0b110, 0b0010000);
+  INSN(rol,    0b0110011, 0b001, 0b0110000);
+  INSN(ror,    0b0110011, 0b101, 0b0110000);
+  INSN(rolw,   0b0111011, 0b001, 0b0110000);
+  INSN(rorw,   0b0111011, 0b101, 0b0110000);
+
+#undef INSN
+
+// Bit-manipulation Extension Zbb, Unary Instruction
+#define INSN(NAME, op, funct3, funct12)                         \
+  void NAME(Register Rd, Register Rs1) {                        \
+    unsigned insn = 0;                                          \
+    patch((address)&insn, 6,  0, op);                           \
+    patch((address)&insn, 14, 12, funct3);                      \
+    patch((address)&insn, 31, 20, funct12);                     \
+    patch_reg((address)&insn, 7, Rd);                           \
+    patch_reg((address)&insn, 15, Rs1);                         \
+    emit(insn);                                                 \
+  }
+
+  INSN(clz,   0b0010011, 0b001, 0b011000000000);
+  INSN(ctz,   0b0010011, 0b001, 0b011000000001);
+  INSN(cpop,  0b0010011, 0b001, 0b011000000010);
+  INSN(clzw,  0b0011011, 0b001, 0b011000000000);
+  INSN(ctzw,  0b0011011, 0b001, 0b011000000001);
+  INSN(cpopw, 0b0011011, 0b001, 0b011000000010);
+
+#undef INSN
+
+  // Bit-manipulation Extension Zbb, Rotate Immediate Instruction
+  void rori(Register Rd, Register Rs1, unsigned shamt) {
+    guarantee(shamt <= 0x3f, "Shamt is invalid");
+    unsigned insn = 0;
+    patch((address)&insn, 6, 0, 0b0010011);
+    patch((address)&insn, 14, 12, 0b101);
+    patch((address)&insn, 25, 20, shamt);
+    patch((address)&insn, 31, 26, 0b011000);
+    patch_reg((address)&insn, 7, Rd);
+    patch_reg((address)&insn, 15, Rs1);
+    emit(insn);
+  }
+
+  void roriw(Register Rd, Register Rs1, unsigned shamt) {
+    guarantee(shamt <= 0x1f, "Shamt is invalid");
+    unsigned insn = 0;
+    patch((address)&insn, 6, 0, 0b0011011);
+    patch((address)&insn, 14, 12, 0b101);
+    patch((address)&insn, 24, 20, shamt);
+    patch((address)&insn, 31, 25, 0b0110000);
+    patch_reg((address)&insn, 7, Rd);
+    patch_reg((address)&insn, 15, Rs1);
+    emit(insn);
+  }
+
+  // Vector Extension (RVV 1.0), only the subset used by the copy and fill stubs
+
+  enum SEW {
+    e8  = 0b000,
+    e16 = 0b001,
+    e32 = 0b010,
+    e64 = 0b011
+  };
+
+  enum LMUL {
+    m1 = 0b000,
+    m2 = 0b001,
+    m4 = 0b010,
+    m8 = 0b011
+  };
+
+  static SEW elembytes_to_sew(int ebytes) {
+    switch (ebytes) {
+      case 1: return e8;
+      case 2: return e16;
+      case 4: return e32;
+      case 8: return e64;
+      default: ShouldNotReachHere(); return e8;
+    }
+  }
+
+  static void patch_reg(address a, unsigned lsb, VectorRegister reg) {
+    patch(a, lsb + 4, lsb, reg->encoding_nocheck());
+  }
+
+  // vsetvli with tail agnostic and mask agnostic policy
+  void vsetvli(Register Rd, Register Rs1, SEW sew, LMUL lmul = m1) {
+    unsigned insn = 0;
+    patch((address)&insn, 6, 0, 0b1010111);
+    patch((address)&insn, 14, 12, 0b111);
+    patch((address)&insn, 30, 20, (1 << 7) | (1 << 6) | (sew << 3) | lmul);
+    patch((address)&insn, 31, 0);
+    patch_reg((address)&insn, 7, Rd);
+    patch_reg((address)&insn, 15, Rs1);
+    emit(insn);
+  }
+
+// Vector Unit-Stride Load and Store Instruction, unmasked
+#define INSN(NAME, op, width)                            \
+  void NAME(VectorRegister Vd, Register Rs1) {           \
+    unsigned insn = 0;                                   \
+    patch((address)&insn, 6, 0, op);                     \
+    patch((address)&insn, 14, 12, width);                \
+    patch((address)&insn, 24, 20, 0b00000);              \
+    patch((address)&insn, 25, 1);                        \
+    patch((address)&insn, 31, 26, 0b000000);             \
+    patch_reg((address)&insn, 7, Vd);                    \
+    patch_reg((address)&insn, 15, Rs1);                  \
+    emit(insn);                                          \
+  }
+
+  INSN(vle8_v,  0b0000111, 0b000);
+  INSN(vle16_v, 0b0000111, 0b101);
+  INSN(vle32_v, 0b0000111, 0b110);
+  INSN(vle64_v, 0b0000111, 0b111);
+  INSN(vse8_v,  0b0100111, 0b000);
+  INSN(vse16_v, 0b0100111, 0b101);
+  INSN(vse32_v, 0b0100111, 0b110);
+  INSN(vse64_v, 0b0100111, 0b111);
+
+#undef INSN
+
+  // vmv.v.x: splat the integer register Rs1 into all active elements of Vd
+  void vmv_v_x(VectorRegister Vd, Register Rs1) {
+    unsigned insn = 0;
+    patch((address)&insn, 6, 0, 0b1010111);
+    patch((address)&insn, 14, 12, 0b100);
+    patch((address)&insn, 24, 20, 0b00000);
+    patch((address)&insn, 25, 1);
+    patch((address)&insn, 31, 26, 0b010111);
+    patch_reg((address)&insn, 7, Vd);
+    patch_reg((address)&insn, 15, Rs1);
+    emit(insn);
+  }
+
   void bgt(Register Rs, Register Rt, const address &dest);
   void ble(Register Rs, Register Rt, const address &dest);
   void bgtu(Register Rs, Register Rt, const address &dest);
@@ -241,6 +241,17 @@ void ShenandoahBarrierSetAssembler::load_reference_barrier_not_null(MacroAssembl
   __ andi(t1, t1, ShenandoahHeap::HAS_FORWARDED);
   __ beqz(t1, done);
 
+  // Check for object in cset, and skip the stub call if it is not there.
+  // If dst is the scratch register, the stub does this test instead.
+  if (dst != t0) {
+    __ mv(t1, ShenandoahHeap::in_cset_fast_test_addr());
+    __ srli(t0, dst, ShenandoahHeapRegion::region_size_bytes_shift_jint());
+    __ add(t1, t1, t0);
+    __ lbu(t1, Address(t1, 0));
+    __ andi(t1, t1, 1);
+    __ beqz(t1, done);
+  }
+
   // use x11 for load address
   Register result_dst = dst;
   if (dst == x11) {
@@ -111,5 +111,14 @@ define_pd_global(intx, InlineSmallCode,          1000);
   product(bool, UseConservativeFence, true,                             \
           "Extend i for r and o for w in the pred/succ flags of fence;" \
           "Extend fence.i to fence.i + fence.")                         \
+  product(bool, UseRVV, false,                                          \
+          "Use RVV 1.0 vector instructions in the arraycopy and fill "  \
+          "stubs; enabled by default if the CPU supports them")         \
+  experimental(bool, UseZba, false,                                     \
+          "Use Zba address-generation instructions (sh1add, sh2add, "   \
+          "sh3add) in C2 generated code")                               \
+  experimental(bool, UseZbb, false,                                     \
+          "Use Zbb bit-manipulation instructions (clz, ctz, cpop, "     \
+          "rol, ror) in C2 generated code")                             \
 
 #endif // CPU_RISCV64_VM_GLOBALS_RISCV64_HPP
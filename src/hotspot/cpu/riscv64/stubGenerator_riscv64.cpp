@@ -822,9 +822,71 @@ class StubGenerator: public StubCodeGenerator {
   // done; 
 
   typedef void (MacroAssembler::*copy_insn)(Register Rd, const Address &adr, Register temp);
+  typedef void (Assembler::*vcopy_insn)(VectorRegister Vd, Register Rs1);
+
+  static void vector_copy_insns(int granularity, vcopy_insn &ld, vcopy_insn &st) {
+    switch (granularity) {
+      case 1: ld = &Assembler::vle8_v;  st = &Assembler::vse8_v;  break;
+      case 2: ld = &Assembler::vle16_v; st = &Assembler::vse16_v; break;
+      case 4: ld = &Assembler::vle32_v; st = &Assembler::vse32_v; break;
+      case 8: ld = &Assembler::vle64_v; st = &Assembler::vse64_v; break;
+      default: ShouldNotReachHere();
+    }
+  }
+
+  // Strip-mined copy with RVV. The element width is the granularity, so
+  // each element is still copied by a single access. A strip is loaded
+  // completely before it is stored, which keeps backwards copies of
+  // overlapping ranges correct.
+  void copy_memory_v(Register s, Register d, Register count, Register tmp, int step) {
+    bool is_backwards = step < 0;
+    int granularity = uabs(step);
+    int shift = exact_log2(granularity);
+
+    const Register src = x30, dst = x31, cnt = x15, vl = x16;
+
+    vcopy_insn vld, vst;
+    vector_copy_insns(granularity, vld, vst);
+
+    Label loop, done;
+
+    __ beqz(count, done);
+    __ mv(cnt, count);
+    if (is_backwards) {
+      __ slli(tmp, count, shift);
+      __ add(src, s, tmp);
+      __ add(dst, d, tmp);
+    } else {
+      __ mv(src, s);
+      __ mv(dst, d);
+    }
+
+    __ bind(loop);
+    __ vsetvli(vl, cnt, Assembler::elembytes_to_sew(granularity), Assembler::m8);
+    __ sub(cnt, cnt, vl);
+    __ slli(vl, vl, shift);
+    if (is_backwards) {
+      __ sub(src, src, vl);
+      __ sub(dst, dst, vl);
+    }
+    (_masm->*vld)(v8, src);
+    (_masm->*vst)(v8, dst);
+    if (!is_backwards) {
+      __ add(src, src, vl);
+      __ add(dst, dst, vl);
+    }
+    __ bnez(cnt, loop);
+
+    __ bind(done);
+  }
 
   void copy_memory(bool is_aligned, Register s, Register d,
                    Register count, Register tmp, int step) {
+    if (UseRVV) {
+      copy_memory_v(s, d, count, tmp, step);
+      return;
+    }
+
     bool is_backwards = step < 0;
     int granularity = uabs(step);
 
@@ -1876,6 +1938,31 @@ class StubGenerator: public StubCodeGenerator {
 
     __ enter();
 
+    if (UseRVV) {
+      // Strip-mined fill, vmv.v.x uses the low SEW bits of value
+      Label L_loop, L_exit;
+      int elem_size = type2aelembytes(t);
+      __ sext_w(count, count);
+      __ blez(count, L_exit);
+      __ bind(L_loop);
+      __ vsetvli(tmp_reg, count, Assembler::elembytes_to_sew(elem_size), Assembler::m8);
+      __ vmv_v_x(v8, value);
+      switch (t) {
+        case T_BYTE:  __ vse8_v(v8, to);  break;
+        case T_SHORT: __ vse16_v(v8, to); break;
+        case T_INT:   __ vse32_v(v8, to); break;
+        default: ShouldNotReachHere();
+      }
+      __ sub(count, count, tmp_reg);
+      __ slli(tmp_reg, tmp_reg, exact_log2(elem_size));
+      __ add(to, to, tmp_reg);
+      __ bnez(count, L_loop);
+      __ bind(L_exit);
+      __ leave();
+      __ ret();
+      return start;
+    }
+
     Label L_fill_elements, L_exit1;
 
     int shift = -1;
@@ -2526,6 +2613,97 @@ class StubGenerator: public StubCodeGenerator {
     return entry;
   }
 
+  /***
+   *  Arguments:
+   *
+   *  Inputs:
+   *   c_rarg0   - int   adler
+   *   c_rarg1   - byte* buff
+   *   c_rarg2   - int   len
+   *
+   * Output:
+   *   c_rarg0   - int adler result
+   */
+  address generate_updateBytesAdler32() {
+    __ align(CodeEntryAlignment);
+    StubCodeMark mark(this, "StubRoutines", "updateBytesAdler32");
+    address start = __ pc();
+
+    Label L_nmax_loop, L_chunk, L_by8_loop, L_by1_loop, L_do_mod, L_combine;
+
+    // Aliases
+    Register adler  = c_rarg0;
+    Register s1     = c_rarg0;
+    Register s2     = c_rarg3;
+    Register buff   = c_rarg1;
+    Register len    = c_rarg2;
+    Register nmax   = c_rarg4;
+    Register base   = c_rarg5;
+    Register count  = c_rarg6;
+    Register temp0  = x28;
+    Register temp1  = x29;
+
+    // Max number of bytes we can process before having to take the mod
+    // 0x15B0 is 5552 in decimal, the largest n such that 255n(n+1)/2 + (n+1)(BASE-1) <= 2^32-1
+    const int BASE = 0xfff1;
+    const int NMAX = 0x15B0;
+
+    __ mv(base, BASE);
+    __ mv(nmax, NMAX);
+
+    // s1 is initialized to the lower 16 bits of adler
+    // s2 is initialized to the upper 16 bits of adler
+    __ srliw(s2, adler, 16);     // s2 = ((adler >> 16) & 0xffff)
+    __ zero_ext(s1, adler, 48);  // s1 = (adler & 0xffff)
+    __ zero_ext(len, len, 32);
+
+    __ beqz(len, L_combine);
+
+    __ bind(L_nmax_loop);
+    // count = min(len, NMAX)
+    __ mv(count, len);
+    __ bleu(count, nmax, L_chunk);
+    __ mv(count, nmax);
+    __ bind(L_chunk);
+    __ sub(len, len, count);
+
+    __ bind(L_by8_loop);
+    __ mv(temp1, 8);
+    __ bltu(count, temp1, L_by1_loop);
+    for (int i = 0; i < 8; i++) {
+      __ lbu(temp0, Address(buff, i));
+      __ add(s1, s1, temp0);
+      __ add(s2, s2, s1);
+    }
+    __ addi(buff, buff, 8);
+    __ addi(count, count, -8);
+    __ j(L_by8_loop);
+
+    __ bind(L_by1_loop);
+    __ beqz(count, L_do_mod);
+    __ lbu(temp0, Address(buff, 0));
+    __ addi(buff, buff, 1);
+    __ add(s1, s1, temp0);
+    __ add(s2, s2, s1);
+    __ addi(count, count, -1);
+    __ j(L_by1_loop);
+
+    __ bind(L_do_mod);
+    __ remu(s1, s1, base);
+    __ remu(s2, s2, base);
+    __ bnez(len, L_nmax_loop);
+
+    // Combine lower bits and higher bits
+    __ bind(L_combine);
+    __ slli(s2, s2, 16);
+    __ orr(s1, s1, s2);
+    __ sext_w(s1, s1);
+
+    __ ret();
+
+    return start;
+  }
+
   void generate_compare_long_strings() {
     StubRoutines::riscv64::_compare_long_string_LL = generate_compare_long_string_same_encoding(true);
     StubRoutines::riscv64::_compare_long_string_UU = generate_compare_long_string_same_encoding(false);
@@ -2704,6 +2882,10 @@ class StubGenerator: public StubCodeGenerator {
 
     generate_compare_long_strings();
 
+    if (UseAdler32Intrinsics) {
+      StubRoutines::_updateBytesAdler32 = generate_updateBytesAdler32();
+    }
+
     // Safefetch stubs.
     generate_safefetch("SafeFetch32", sizeof(int),     &StubRoutines::_safefetch32_entry,
                                                        &StubRoutines::_safefetch32_fault_pc,
@@ -77,6 +77,37 @@ class VM_Version_StubGenerator: public StubCodeGenerator {
 };
 
 void VM_Version::get_processor_features() {
+  unsigned long auxv = getauxval(AT_HWCAP);
+
+  if (auxv & COMPAT_HWCAP_ISA_V) {
+    if (FLAG_IS_DEFAULT(UseRVV)) {
+      FLAG_SET_DEFAULT(UseRVV, true);
+    }
+  } else if (UseRVV) {
+    warning("RVV instructions are not available on this CPU");
+    FLAG_SET_DEFAULT(UseRVV, false);
+  }
+
+  // The kernel does not report the individual Z* bit-manipulation
+  // extensions, only the legacy 'B' bit. Without it, Zba/Zbb have to be
+  // requested explicitly with -XX:+UnlockExperimentalVMOptions.
+  if (auxv & COMPAT_HWCAP_ISA_B) {
+    if (FLAG_IS_DEFAULT(UseZba)) {
+      FLAG_SET_DEFAULT(UseZba, true);
+    }
+    if (FLAG_IS_DEFAULT(UseZbb)) {
+      FLAG_SET_DEFAULT(UseZbb, true);
+    }
+  }
+
+  if (UseZbb) {
+    if (FLAG_IS_DEFAULT(UsePopCountInstruction)) {
+      FLAG_SET_DEFAULT(UsePopCountInstruction, true);
+    }
+  } else {
+    FLAG_SET_DEFAULT(UsePopCountInstruction, false);
+  }
+
   if (FLAG_IS_DEFAULT(UseFMA)) {
     FLAG_SET_DEFAULT(UseFMA, true);
   }
@@ -129,6 +160,10 @@ void VM_Version::get_processor_features() {
     warning("CRC32CIntrinsics instructions are not avaliable on this CPU.");
     FLAG_SET_DEFAULT(UseCRC32CIntrinsics, false);
   }
+
+  if (FLAG_IS_DEFAULT(UseAdler32Intrinsics)) {
+    FLAG_SET_DEFAULT(UseAdler32Intrinsics, true);
+  }
 #ifdef COMPILER2
   get_c2_processor_features();
 #endif // COMPILER2
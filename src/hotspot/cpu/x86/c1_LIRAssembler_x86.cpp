@@ -1723,6 +1723,16 @@ void LIR_Assembler::emit_typecheck_helper(LIR_OpTypeCheck *op, Label* success, L
     // not a safepoint as obj null check happens earlier
     __ load_klass(klass_RInfo, obj);
     if (k->is_loaded()) {
+      if (op->likely_klass() != NULL) {
+        // The dominant type recorded in the profile is a subtype of k
+#ifdef _LP64
+        __ mov_metadata(rscratch1, op->likely_klass()->constant_encoding());
+        __ cmpptr(klass_RInfo, rscratch1);
+#else
+        __ cmpklass(klass_RInfo, op->likely_klass()->constant_encoding());
+#endif // _LP64
+        __ jcc(Assembler::equal, *success_target);
+      }
       // See if we get an immediate positive hit
 #ifdef _LP64
       __ cmpptr(k_RInfo, Address(klass_RInfo, k->super_check_offset()));
@@ -1395,13 +1395,50 @@ void InterpreterMacroAssembler::increment_mdp_data_at(Register mdp_in,
   increment_mdp_data_at(data, decrement);
 }
 
+// With InterpreterProfileSampleRate > 1 a thread only updates the MDO
+// counters every n-th time it executes a profiled bytecode and then
+// advances them by n. This keeps the counts unbiased while cutting the
+// stores into MDOs shared by many threads.
+bool InterpreterMacroAssembler::sample_profile_updates() const {
+  return LP64_ONLY(InterpreterProfileSampleRate > 1) NOT_LP64(false);
+}
+
+// Branches to skip unless the countdown of the current thread expires, in
+// which case it is rearmed. Condition codes are destroyed.
+void InterpreterMacroAssembler::sample_profile_update(Label& skip) {
+  assert(sample_profile_updates(), "sampling not enabled");
+#ifdef _LP64
+  Address countdown(r15_thread, JavaThread::interp_profile_countdown_offset());
+  decrementl(countdown);
+  jcc(Assembler::greater, skip);
+  movl(countdown, (int32_t) InterpreterProfileSampleRate);
+#else
+  ShouldNotReachHere();
+#endif
+}
+
 void InterpreterMacroAssembler::increment_mdp_data_at(Address data,
                                                       bool decrement) {
   assert(ProfileInterpreter, "must be profiling interpreter");
   // %%% this does 64bit counters at best it is wasting space
   // at worst it is a rare bug when counters overflow
 
-  if (decrement) {
+  if (sample_profile_updates()) {
+    int32_t delta = (int32_t) (InterpreterProfileSampleRate * DataLayout::counter_increment);
+    Label done;
+    sample_profile_update(done);
+    if (decrement) {
+      addptr(data, -delta);
+      jcc(Assembler::negative, done);
+      addptr(data, delta);
+    } else {
+      addptr(data, delta);
+      // If the increment causes the counter to overflow, undo it.
+      jcc(Assembler::carryClear, done);
+      subptr(data, delta);
+    }
+    bind(done);
+  } else if (decrement) {
     // Decrement the register.  Set condition codes.
     addptr(data, (int32_t) -DataLayout::counter_increment);
     // If the decrement causes the counter to overflow, stay negative
@@ -1508,11 +1545,23 @@ void InterpreterMacroAssembler::profile_taken_branch(Register mdp,
     //increment_mdp_data_at(mdp, in_bytes(JumpData::taken_offset()));
     Address data(mdp, in_bytes(JumpData::taken_offset()));
     movptr(bumped_count, data);
-    assert(DataLayout::counter_increment == 1,
-            "flow-free idiom only works with 1");
-    addptr(bumped_count, DataLayout::counter_increment);
-    sbbptr(bumped_count, 0);
-    movptr(data, bumped_count); // Store back out
+    if (sample_profile_updates()) {
+      int32_t delta = (int32_t) (InterpreterProfileSampleRate * DataLayout::counter_increment);
+      Label skip, no_overflow;
+      sample_profile_update(skip);
+      addptr(bumped_count, delta);
+      jcc(Assembler::carryClear, no_overflow);
+      subptr(bumped_count, delta);
+      bind(no_overflow);
+      movptr(data, bumped_count); // Store back out
+      bind(skip);
+    } else {
+      assert(DataLayout::counter_increment == 1,
+              "flow-free idiom only works with 1");
+      addptr(bumped_count, DataLayout::counter_increment);
+      sbbptr(bumped_count, 0);
+      movptr(data, bumped_count); // Store back out
+    }
 
     // The method data pointer needs to be updated to reflect the new target.
     update_mdp_by_offset(mdp, in_bytes(JumpData::displacement_offset()));
@@ -228,6 +228,8 @@ class InterpreterMacroAssembler: public MacroAssembler {
   void verify_method_data_pointer();
 
   void set_mdp_data_at(Register mdp_in, int constant, Register value);
+  bool sample_profile_updates() const;
+  void sample_profile_update(Label& skip);
   void increment_mdp_data_at(Address data, bool decrement = false);
   void increment_mdp_data_at(Register mdp_in, int constant,
                              bool decrement = false);
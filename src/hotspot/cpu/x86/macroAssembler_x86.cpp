@@ -4056,6 +4056,25 @@ void MacroAssembler::vpcmpeqw(XMMRegister dst, XMMRegister nds, XMMRegister src,
   Assembler::vpcmpeqw(dst, nds, src, vector_len);
 }
 
+void MacroAssembler::vpcmpCCd(XMMRegister dst, XMMRegister src1, XMMRegister src2, XMMRegister tmp,
+                              ComparisonPredicate cond, int vector_len) {
+  assert(dst != tmp && src1 != tmp && src2 != tmp, "tmp must not alias");
+  bool negate = false;
+  switch (cond) {
+    case eq:  Assembler::vpcmpeqd(dst, src1, src2, vector_len);                 break;
+    case neq: Assembler::vpcmpeqd(dst, src1, src2, vector_len); negate = true;  break;
+    case lt:  Assembler::vpcmpgtd(dst, src2, src1, vector_len);                 break;
+    case nlt: Assembler::vpcmpgtd(dst, src2, src1, vector_len); negate = true;  break;
+    case le:  Assembler::vpcmpgtd(dst, src1, src2, vector_len); negate = true;  break;
+    case nle: Assembler::vpcmpgtd(dst, src1, src2, vector_len);                 break;
+    default:  ShouldNotReachHere();
+  }
+  if (negate) {
+    Assembler::vpcmpeqd(tmp, tmp, tmp, vector_len); // all ones
+    vpxor(dst, dst, tmp, vector_len);
+  }
+}
+
 void MacroAssembler::vpmovzxbw(XMMRegister dst, Address src, int vector_len) {
   assert(((dst->encoding() < 16) || VM_Version::supports_avx512vlbw()),"XMM register should be 0-15");
   Assembler::vpmovzxbw(dst, src, vector_len);
@@ -7210,6 +7229,74 @@ void MacroAssembler::has_negatives(Register ary1, Register len,
     vpxor(vec2, vec2);
   }
 }
+// Compute the hash code of a Latin1 string:
+//   private static int hashCode(byte[] value) {
+//     int h = 0;
+//     for (byte v : value) {
+//       h = 31 * h + (v & 0xff);
+//     }
+//     return h;
+//   }
+// Eight bytes are consumed per vector iteration. Lane i of the accumulator
+// collects (acc * 31^8 + value[8k + i]), so the hash of the vectorized
+// prefix is the Horner sum of the lanes with multiplier 31.
+void MacroAssembler::string_hashcode_latin1(Register ary1, Register cnt,
+  Register result, Register tmp1,
+  XMMRegister vec1, XMMRegister vec2, XMMRegister vec3) {
+  // rsi: byte array
+  // rcx: cnt
+  // rax: result
+  ShortBranchVerifier sbv(this);
+  assert_different_registers(ary1, cnt, result, tmp1);
+  assert(UseAVX >= 2, "AVX2 intrinsic");
+  Label VECTOR_LOOP, TAIL_START, TAIL_LOOP, DONE;
+
+  xorl(result, result);
+  cmpl(cnt, 8);
+  jccb(Assembler::less, TAIL_START);
+
+  movl(tmp1, 0x94446F01); // 31^8
+  movdl(vec2, tmp1);
+  vpbroadcastd(vec2, vec2, Assembler::AVX_256bit);
+  vpxor(vec1, vec1, vec1, Assembler::AVX_256bit);
+
+  bind(VECTOR_LOOP);
+  vpmovzxbd(vec3, Address(ary1, 0), Assembler::AVX_256bit);
+  vpmulld(vec1, vec1, vec2, Assembler::AVX_256bit);
+  vpaddd(vec1, vec1, vec3, Assembler::AVX_256bit);
+  addptr(ary1, 8);
+  subl(cnt, 8);
+  cmpl(cnt, 8);
+  jccb(Assembler::greaterEqual, VECTOR_LOOP);
+
+  // Fold the lanes: result = sum(vec1[i] * 31^(7 - i))
+  vextracti128_high(vec3, vec1);
+  for (int i = 0; i < 4; i++) {
+    pextrd(tmp1, vec1, i);
+    imull(result, result, 31);
+    addl(result, tmp1);
+  }
+  for (int i = 0; i < 4; i++) {
+    pextrd(tmp1, vec3, i);
+    imull(result, result, 31);
+    addl(result, tmp1);
+  }
+
+  bind(TAIL_START);
+  testl(cnt, cnt);
+  jccb(Assembler::zero, DONE);
+
+  bind(TAIL_LOOP);
+  movzbl(tmp1, Address(ary1, 0));
+  imull(result, result, 31);
+  addl(result, tmp1);
+  addptr(ary1, 1);
+  subl(cnt, 1);
+  jccb(Assembler::notZero, TAIL_LOOP);
+
+  bind(DONE);
+}
+
 // Compare char[] or byte[] arrays aligned to 4 bytes or substrings.
 void MacroAssembler::arrays_equals(bool is_array_equ, Register ary1, Register ary2,
                                    Register limit, Register result, Register chr,
@@ -1237,6 +1237,11 @@ public:
 
   void vpcmpeqw(XMMRegister dst, XMMRegister nds, XMMRegister src, int vector_len);
 
+  // Lane-wise signed int compare: all ones in the lanes of dst where
+  // 'src1 cond src2' holds, zero elsewhere. tmp is clobbered.
+  void vpcmpCCd(XMMRegister dst, XMMRegister src1, XMMRegister src2, XMMRegister tmp,
+                ComparisonPredicate cond, int vector_len);
+
   void vpmovzxbw(XMMRegister dst, Address src, int vector_len);
   void vpmovzxbw(XMMRegister dst, XMMRegister src, int vector_len) { Assembler::vpmovzxbw(dst, src, vector_len); }
 
@@ -1682,6 +1687,11 @@ public:
                      Register result, Register tmp1,
                      XMMRegister vec1, XMMRegister vec2);
 
+  // Compute the Latin1 String.hashCode() of a byte array.
+  void string_hashcode_latin1(Register ary1, Register cnt,
+                              Register result, Register tmp1,
+                              XMMRegister vec1, XMMRegister vec2, XMMRegister vec3);
+
   // Compare char[] or byte[] arrays.
   void arrays_equals(bool is_array_equ, Register ary1, Register ary2,
                      Register limit, Register result, Register chr,
@@ -631,7 +631,8 @@ void TemplateTable::iload_internal(RewriteControl rc) {
                           at_bcp(Bytecodes::length_for(Bytecodes::_iload)));
     // if _iload, wait to rewrite to iload2.  We only want to rewrite the
     // last two iloads in a pair.  Comparing against fast_iload means that
-    // the next bytecode is neither an iload or a caload, and therefore
+    // the next bytecode is neither an iload nor an array load that is
+    // fused with iload (caload, iaload, baload), and therefore
     // an iload pair.
     __ cmpl(rbx, Bytecodes::_iload);
     __ jcc(Assembler::equal, done);
@@ -646,6 +647,16 @@ void TemplateTable::iload_internal(RewriteControl rc) {
     __ movl(bc, Bytecodes::_fast_icaload);
     __ jccb(Assembler::equal, rewrite);
 
+    // if _iaload, rewrite to fast_iiaload
+    __ cmpl(rbx, Bytecodes::_iaload);
+    __ movl(bc, Bytecodes::_fast_iiaload);
+    __ jccb(Assembler::equal, rewrite);
+
+    // if _baload, rewrite to fast_ibaload
+    __ cmpl(rbx, Bytecodes::_baload);
+    __ movl(bc, Bytecodes::_fast_ibaload);
+    __ jccb(Assembler::equal, rewrite);
+
     // rewrite so iload doesn't check again.
     __ movl(bc, Bytecodes::_fast_iload);
 
@@ -865,6 +876,22 @@ void TemplateTable::fast_icaload() {
 }
 
 
+// iload followed by iaload or baload
+void TemplateTable::fast_ixaload(int type) {
+  transition(vtos, itos);
+  BasicType bt = (BasicType)type;
+  // load index out of locals
+  locals_index(rbx);
+  __ movl(rax, iaddress(rbx));
+
+  // rax: index
+  // rdx: array
+  index_check(rdx, rax); // kills rbx
+  __ access_load_at(bt, IN_HEAP | IS_ARRAY, rax,
+                    Address(rdx, rax, Address::times(type2aelembytes(bt)), arrayOopDesc::base_offset_in_bytes(bt)),
+                    noreg, noreg);
+}
+
 void TemplateTable::saload() {
   transition(itos, itos);
   // rax: index
@@ -4141,17 +4168,127 @@ void TemplateTable::_new() {
   __ bind(done);
 }
 
+// Arrays up to this length are allocated inline in the TLAB by
+// newarray and anewarray; longer ones go through the runtime.
+static const int max_inline_array_length = 256;
+
+// Inline TLAB allocation of a small array.
+//   rax: length, known to be in [0, max_inline_array_length]
+//   rbx: array klass
+// On success rax holds the new array and control goes to done.
+void TemplateTable::allocate_small_array(Label& slow_case, Label& done) {
+#ifdef _LP64
+  assert(UseTLAB, "only inline TLAB allocation is supported");
+  const Register thread = r15_thread;
+  const Register obj = rdi;  // rax must still hold the length on the slow path
+
+  // array size in bytes:
+  //   align_up(header_size + (length << log2_element_size), MinObjAlignmentInBytes)
+  __ movl(rcx, Address(rbx, Klass::layout_helper_offset()));
+  __ movl(rsi, rax);
+  __ shlptr(rsi /* by rcx, log2 element size */);
+  __ shrptr(rcx, Klass::_lh_header_size_shift);
+  __ andptr(rcx, Klass::_lh_header_size_mask);
+  __ addptr(rsi, rcx);
+  __ addptr(rsi, MinObjAlignmentInBytesMask);
+  __ andptr(rsi, ~MinObjAlignmentInBytesMask);
+
+  __ tlab_allocate(thread, obj, rsi, 0, rcx, rdx, slow_case);
+
+  if (!ZeroTLAB) {
+    // Clear everything after the mark word: the klass word, the length
+    // and the elements. The size is a multiple of 8 and at least 16.
+    __ subptr(rsi, oopDesc::klass_offset_in_bytes());
+    __ shrptr(rsi, LogBytesPerLong);
+    __ xorl(rcx, rcx);
+    Label loop;
+    __ bind(loop);
+    __ movptr(Address(obj, rsi, Address::times_8, oopDesc::klass_offset_in_bytes() - BytesPerLong), rcx);
+    __ decrement(rsi);
+    __ jcc(Assembler::notZero, loop);
+  }
+
+  // initialize the header
+  __ movl(Address(obj, arrayOopDesc::length_offset_in_bytes()), rax);
+  if (UseBiasedLocking) {
+    __ movptr(rcx, Address(rbx, Klass::prototype_header_offset()));
+    __ movptr(Address(obj, oopDesc::mark_offset_in_bytes()), rcx);
+  } else {
+    __ movptr(Address(obj, oopDesc::mark_offset_in_bytes()),
+              (intptr_t)markOopDesc::prototype());
+  }
+  __ store_klass(obj, rbx);  // klass, destroys rbx
+  __ movptr(rax, obj);
+
+  {
+    SkipIfEqual skip_if(_masm, &DTraceAllocProbes, 0);
+    // Trigger dtrace event for fastpath
+    __ push(atos);
+    __ call_VM_leaf(
+         CAST_FROM_FN_PTR(address, SharedRuntime::dtrace_object_alloc), rax);
+    __ pop(atos);
+  }
+
+  __ jmp(done);
+#else
+  ShouldNotReachHere();
+#endif // _LP64
+}
+
 void TemplateTable::newarray() {
   transition(itos, atos);
+  Label slow_case, done;
+
+#ifdef _LP64
+  if (UseTLAB) {
+    // unsigned compare also sends negative lengths to the runtime
+    __ cmpl(rax, max_inline_array_length);
+    __ jcc(Assembler::above, slow_case);
+
+    __ load_unsigned_byte(rcx, at_bcp(1));
+    __ lea(rbx, ExternalAddress((address)Universe::typeArrayKlassObjs_addr()));
+    __ movptr(rbx, Address(rbx, rcx, Address::times_ptr));
+    allocate_small_array(slow_case, done);
+  }
+#endif // _LP64
+
+  __ bind(slow_case);
   Register rarg1 = LP64_ONLY(c_rarg1) NOT_LP64(rdx);
   __ load_unsigned_byte(rarg1, at_bcp(1));
   call_VM(rax, CAST_FROM_FN_PTR(address, InterpreterRuntime::newarray),
           rarg1, rax);
+  __ bind(done);
 }
 
 void TemplateTable::anewarray() {
   transition(itos, atos);
+  Label slow_case, done;
+
+#ifdef _LP64
+  if (UseTLAB) {
+    // unsigned compare also sends negative lengths to the runtime
+    __ cmpl(rax, max_inline_array_length);
+    __ jcc(Assembler::above, slow_case);
+
+    // the element class must be resolved
+    __ get_unsigned_2_byte_index_at_bcp(rdx, 1);
+    __ get_cpool_and_tags(rcx, rbx);
+    const int tags_offset = Array<u1>::base_offset_in_bytes();
+    __ cmpb(Address(rbx, rdx, Address::times_1, tags_offset), JVM_CONSTANT_Class);
+    __ jcc(Assembler::notEqual, slow_case);
+    __ load_resolved_klass_at_index(rcx, rdx, rbx);
+
+    // only instance element classes whose array class already exists
+    __ cmpl(Address(rbx, Klass::layout_helper_offset()), Klass::_lh_neutral_value);
+    __ jcc(Assembler::lessEqual, slow_case);
+    __ movptr(rbx, Address(rbx, InstanceKlass::array_klasses_offset()));
+    __ testptr(rbx, rbx);
+    __ jcc(Assembler::zero, slow_case);
+    allocate_small_array(slow_case, done);
+  }
+#endif // _LP64
 
+  __ bind(slow_case);
   Register rarg1 = LP64_ONLY(c_rarg1) NOT_LP64(rcx);
   Register rarg2 = LP64_ONLY(c_rarg2) NOT_LP64(rdx);
 
@@ -4159,6 +4296,7 @@ void TemplateTable::anewarray() {
   __ get_constant_pool(rarg1);
   call_VM(rax, CAST_FROM_FN_PTR(address, InterpreterRuntime::anewarray),
           rarg1, rarg2, rax);
+  __ bind(done);
 }
 
 void TemplateTable::arraylength() {
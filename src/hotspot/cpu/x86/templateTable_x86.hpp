@@ -38,5 +38,6 @@
   // Helpers
   static void index_check(Register array, Register index);
   static void index_check_without_pop(Register array, Register index);
+  static void allocate_small_array(Label& slow_case, Label& done);
 
 #endif // CPU_X86_VM_TEMPLATETABLE_X86_HPP
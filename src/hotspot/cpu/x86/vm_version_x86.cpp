@@ -1051,6 +1051,13 @@ void VM_Version::get_processor_features() {
           warning("MaxVectorSize must be <= 64");
         FLAG_SET_DEFAULT(MaxVectorSize, 64);
       }
+      // 512-bit vector instructions lower the core frequency of Skylake
+      // server parts, which slows down the surrounding scalar code as well.
+      // Keep auto-vectorized loops at 256 bits there unless explicitly
+      // requested; AVX-512 encodings and masking remain available.
+      if (FLAG_IS_DEFAULT(MaxVectorSize) && MaxVectorSize > 32 && is_intel_skylake()) {
+        FLAG_SET_DEFAULT(MaxVectorSize, 32);
+      }
     }
 #if defined(COMPILER2) && defined(ASSERT)
     if (supports_avx() && PrintMiscellaneous && Verbose && TraceNewVectors) {
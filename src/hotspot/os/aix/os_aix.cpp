@@ -3662,6 +3662,16 @@ bool os::bind_to_processor(uint processor_id) {
   return false;
 }
 
+bool os::bind_to_processors(const BitMap& processors) {
+  // Not yet implemented.
+  return false;
+}
+
+bool os::numa_get_group_processors(int lgrp_id, BitMap& processors) {
+  // Not yet implemented.
+  return false;
+}
+
 void os::SuspendedThreadTask::internal_do_task() {
   if (do_suspend(_thread->osthread())) {
     SuspendedThreadTaskContext context(_thread, _thread->osthread()->ucontext());
@@ -210,8 +210,10 @@ int LinuxAttachListener::init() {
     return -1;
   }
 
-  // put in listen mode, set permissions, and rename into place
-  res = ::listen(listener, 5);
+  // put in listen mode, set permissions, and rename into place.
+  // Operations are executed one at a time, so use a backlog large enough
+  // that bursts of concurrent clients queue up instead of being refused.
+  res = ::listen(listener, SOMAXCONN);
   if (res == 0) {
     RESTARTABLE(::chmod(initial_path, S_IREAD|S_IWRITE), res);
     if (res == 0) {
@@ -68,6 +68,7 @@
 #include "services/memTracker.hpp"
 #include "services/runtimeService.hpp"
 #include "utilities/align.hpp"
+#include "utilities/bitMap.inline.hpp"
 #include "utilities/decoder.hpp"
 #include "utilities/defaultStream.hpp"
 #include "utilities/events.hpp"
@@ -838,6 +839,7 @@ bool os::create_thread(Thread* thread, ThreadType thr_type,
   pthread_attr_setguardsize(&attr, os::Linux::default_guard_size(thr_type));
 
   ThreadState state;
+  const jlong start_nanos = log_is_enabled(Debug, os, thread) ? os::javaTimeNanos() : 0;
 
   {
     pthread_t tid;
@@ -891,6 +893,10 @@ bool os::create_thread(Thread* thread, ThreadType thr_type,
   // The thread is returned suspended (in state INITIALIZED),
   // and is started higher up in the call chain
   assert(state == INITIALIZED, "race condition");
+  if (start_nanos != 0) {
+    log_debug(os, thread)("Thread created in " JLONG_FORMAT " us (tid: " UINTX_FORMAT ", stack size: " SIZE_FORMAT "k).",
+      (os::javaTimeNanos() - start_nanos) / (NANOUNITS / MICROUNITS), (uintx) osthread->thread_id(), stack_size / K);
+  }
   return true;
 }
 
@@ -5513,6 +5519,45 @@ bool os::bind_to_processor(uint processor_id) {
   return false;
 }
 
+bool os::bind_to_processors(const BitMap& processors) {
+#ifdef CPU_ALLOC
+  // The kernel may use a mask bigger than cpu_set_t, size it dynamically.
+  int configured_cpus = os::processor_count();
+  cpu_set_t* cpus_p = CPU_ALLOC(configured_cpus);
+  if (cpus_p == NULL) {
+    return false;
+  }
+  size_t cpus_size = CPU_ALLOC_SIZE(configured_cpus);
+  CPU_ZERO_S(cpus_size, cpus_p);
+  for (BitMap::idx_t i = processors.get_next_one_offset(0);
+       i < processors.size() && i < (BitMap::idx_t)configured_cpus;
+       i = processors.get_next_one_offset(i + 1)) {
+    CPU_SET_S(i, cpus_size, cpus_p);
+  }
+  // pid 0 means the current thread
+  bool result = sched_setaffinity(0, cpus_size, cpus_p) == 0;
+  CPU_FREE(cpus_p);
+  return result;
+#else
+  return false;
+#endif // CPU_ALLOC
+}
+
+bool os::numa_get_group_processors(int lgrp_id, BitMap& processors) {
+  GrowableArray<int>* map = Linux::cpu_to_node();
+  if (map == NULL) {
+    return false;
+  }
+  bool found = false;
+  for (int cpu = 0; cpu < map->length() && (BitMap::idx_t)cpu < processors.size(); cpu++) {
+    if (map->at(cpu) == lgrp_id) {
+      processors.set_bit((BitMap::idx_t)cpu);
+      found = true;
+    }
+  }
+  return found;
+}
+
 ///
 
 void os::SuspendedThreadTask::internal_do_task() {
@@ -5807,6 +5852,26 @@ static jlong fast_cpu_time(Thread *thread) {
     }
 }
 
+// The clockid returned by pthread_getcpuclockid() encodes the kind of
+// CPU clock in its low bits (see CPUCLOCK_* in the kernel sources).
+// Switching it to CPUCLOCK_VIRT yields the user time of the thread,
+// which is much cheaper than parsing /proc/self/task/<tid>/stat.
+static const clockid_t CPUCLOCK_CLOCK_MASK = 3;
+static const clockid_t CPUCLOCK_VIRT = 1;
+
+static jlong user_thread_cpu_time(Thread *thread) {
+  clockid_t clockid;
+  int rc = os::Linux::pthread_getcpuclockid(thread->osthread()->pthread_id(),
+                                            &clockid);
+  if (rc == 0) {
+    clockid = (clockid & ~CPUCLOCK_CLOCK_MASK) | CPUCLOCK_VIRT;
+    return os::Linux::fast_thread_cpu_time(clockid);
+  } else {
+    assert_status(rc == ESRCH, rc, "pthread_getcpuclockid failed");
+    return -1;
+  }
+}
+
 // current_thread_cpu_time(bool) and thread_cpu_time(Thread*, bool)
 // are used by JVM M&M and JVMTI to get user+sys or user CPU time
 // of a thread.
@@ -5835,6 +5900,8 @@ jlong os::thread_cpu_time(Thread* thread) {
 jlong os::current_thread_cpu_time(bool user_sys_cpu_time) {
   if (user_sys_cpu_time && os::Linux::supports_fast_thread_cpu_time()) {
     return os::Linux::fast_thread_cpu_time(CLOCK_THREAD_CPUTIME_ID);
+  } else if (os::Linux::supports_fast_thread_cpu_time()) {
+    return user_thread_cpu_time(Thread::current());
   } else {
     return slow_thread_cpu_time(Thread::current(), user_sys_cpu_time);
   }
@@ -5843,6 +5910,8 @@ jlong os::current_thread_cpu_time(bool user_sys_cpu_time) {
 jlong os::thread_cpu_time(Thread *thread, bool user_sys_cpu_time) {
   if (user_sys_cpu_time && os::Linux::supports_fast_thread_cpu_time()) {
     return fast_cpu_time(thread);
+  } else if (os::Linux::supports_fast_thread_cpu_time()) {
+    return user_thread_cpu_time(thread);
   } else {
     return slow_thread_cpu_time(thread, user_sys_cpu_time);
   }
@@ -37,6 +37,7 @@
 #include "utilities/vmError.hpp"
 
 #include <dlfcn.h>
+#include <fcntl.h>
 #include <grp.h>
 #include <pwd.h>
 #include <pthread.h>
@@ -44,6 +45,7 @@
 #include <sys/mman.h>
 #include <sys/resource.h>
 #include <sys/utsname.h>
+#include <sys/wait.h>
 #include <time.h>
 #include <unistd.h>
 #include <utmpx.h>
@@ -507,6 +509,36 @@ void os::Posix::print_user_info(outputStream* st) {
   st->cr();
 }
 
+int os::Posix::exec_and_wait(const char* path, char* const argv[], const char* out_path) {
+  pid_t pid = fork();
+  if (pid < 0) {
+    return -1;
+  } else if (pid == 0) {
+    // child process
+    int fd = ::open(out_path, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+    if (fd < 0 || ::dup2(fd, STDOUT_FILENO) < 0 || ::dup2(fd, STDERR_FILENO) < 0) {
+      _exit(-1);
+    }
+    ::close(fd);
+    ::execv(path, argv);
+    // execv failed
+    _exit(-1);
+  }
+
+  int status;
+  while (::waitpid(pid, &status, 0) < 0) {
+    if (errno != EINTR) {
+      return -1;
+    }
+  }
+  if (WIFEXITED(status)) {
+    return WEXITSTATUS(status);
+  } else if (WIFSIGNALED(status)) {
+    // Same convention as os::fork_and_exec and the shells.
+    return 0x80 + WTERMSIG(status);
+  }
+  return status;
+}
 
 bool os::get_host_name(char* buf, size_t buflen) {
   struct utsname name;
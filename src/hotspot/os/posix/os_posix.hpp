@@ -124,6 +124,11 @@ public:
   static void print_umask(outputStream* st, mode_t umsk);
 
   static void print_user_info(outputStream* st);
+
+  // Runs the program at path with argv, without a shell, and waits for it.
+  // Its stdout and stderr go to out_path, which is truncated first. Returns
+  // the exit value as os::fork_and_exec does, or -1 if it could not be run.
+  static int exec_and_wait(const char* path, char* const argv[], const char* out_path);
 };
 
 // On POSIX platforms the signal handler is global so we just do the write.
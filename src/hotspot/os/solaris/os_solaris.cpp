@@ -511,6 +511,16 @@ bool os::bind_to_processor(uint processor_id) {
   return (bind_result == 0);
 }
 
+bool os::bind_to_processors(const BitMap& processors) {
+  // Not yet implemented.
+  return false;
+}
+
+bool os::numa_get_group_processors(int lgrp_id, BitMap& processors) {
+  // Not yet implemented.
+  return false;
+}
+
 // Return true if user is running as root.
 
 bool os::have_special_privileges() {
@@ -825,6 +825,16 @@ bool os::bind_to_processor(uint processor_id) {
   return false;
 }
 
+bool os::bind_to_processors(const BitMap& processors) {
+  // Not yet implemented.
+  return false;
+}
+
+bool os::numa_get_group_processors(int lgrp_id, BitMap& processors) {
+  // Not yet implemented.
+  return false;
+}
+
 void os::win32::initialize_performance_counter() {
   LARGE_INTEGER count;
   QueryPerformanceFrequency(&count);
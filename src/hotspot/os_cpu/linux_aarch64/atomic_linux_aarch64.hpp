@@ -34,44 +34,133 @@
 #define READ_MEM_BARRIER  __atomic_thread_fence(__ATOMIC_ACQUIRE);
 #define WRITE_MEM_BARRIER __atomic_thread_fence(__ATOMIC_RELEASE);
 
+// Atomic read-modify-write operations are called through the stub
+// pointers below. They initially point to the LL/SC implementations in
+// atomic_linux_aarch64.s; when the CPU supports the ARMv8.1 LSE
+// extension (UseLSE) the stub generator replaces them at startup with
+// versions using ldaddal, swpal and casal. This makes the choice at
+// run time instead of depending on how the toolchain expands the GCC
+// builtins.
+typedef uint64_t (*aarch64_atomic_stub_t)(volatile void *ptr, uint64_t arg1, uint64_t arg2);
+
+extern aarch64_atomic_stub_t aarch64_atomic_fetch_add_4_impl;
+extern aarch64_atomic_stub_t aarch64_atomic_fetch_add_8_impl;
+extern aarch64_atomic_stub_t aarch64_atomic_xchg_4_impl;
+extern aarch64_atomic_stub_t aarch64_atomic_xchg_8_impl;
+extern aarch64_atomic_stub_t aarch64_atomic_cmpxchg_1_impl;
+extern aarch64_atomic_stub_t aarch64_atomic_cmpxchg_4_impl;
+extern aarch64_atomic_stub_t aarch64_atomic_cmpxchg_8_impl;
+extern aarch64_atomic_stub_t aarch64_atomic_cmpxchg_1_relaxed_impl;
+extern aarch64_atomic_stub_t aarch64_atomic_cmpxchg_4_relaxed_impl;
+extern aarch64_atomic_stub_t aarch64_atomic_cmpxchg_8_relaxed_impl;
+
+// Call one of the stubs. The stubs follow the C calling convention but
+// only use x0-x3, x8 and x9, so the call is made from inline asm that
+// clobbers just those registers rather than everything the ABI allows.
+//
+// This is not a template because GCC ignores local register variables
+// in template functions (GCC bug 33661).
+inline uint64_t bare_atomic_fastcall(aarch64_atomic_stub_t stub, volatile void *ptr,
+                                     uint64_t arg1, uint64_t arg2 = 0) {
+  register uint64_t reg0 __asm__("x0") = (uint64_t)ptr;
+  register uint64_t reg1 __asm__("x1") = arg1;
+  register uint64_t reg2 __asm__("x2") = arg2;
+  register uint64_t reg3 __asm__("x3") = CAST_FROM_FN_PTR(uint64_t, stub);
+  register uint64_t result __asm__("x0");
+  asm volatile("blr %1"
+               : "=r"(result), "+r"(reg3), "+r"(reg2)
+               : "r"(reg1), "0"(reg0) : "x8", "x9", "x30", "cc", "memory");
+  return result;
+}
+
+template <typename D, typename T1>
+inline D atomic_fastcall(aarch64_atomic_stub_t stub, volatile D *dest, T1 arg1) {
+  return (D)bare_atomic_fastcall(stub, dest, (uint64_t)arg1);
+}
+
+template <typename D, typename T1, typename T2>
+inline D atomic_fastcall(aarch64_atomic_stub_t stub, volatile D *dest, T1 arg1, T2 arg2) {
+  return (D)bare_atomic_fastcall(stub, dest, (uint64_t)arg1, (uint64_t)arg2);
+}
+
 template<size_t byte_size>
 struct Atomic::PlatformAdd
-  : Atomic::AddAndFetch<Atomic::PlatformAdd<byte_size> >
+  : Atomic::FetchAndAdd<Atomic::PlatformAdd<byte_size> >
 {
   template<typename I, typename D>
-  D add_and_fetch(I add_value, D volatile* dest, atomic_memory_order order) const {
-    D res = __atomic_add_fetch(dest, add_value, __ATOMIC_RELEASE);
-    FULL_MEM_BARRIER;
-    return res;
-  }
+  D fetch_and_add(I add_value, D volatile* dest, atomic_memory_order order) const;
 };
 
-template<size_t byte_size>
+template<>
+template<typename I, typename D>
+inline D Atomic::PlatformAdd<4>::fetch_and_add(I add_value, D volatile* dest,
+                                               atomic_memory_order order) const {
+  STATIC_ASSERT(4 == sizeof(I));
+  STATIC_ASSERT(4 == sizeof(D));
+  return atomic_fastcall(aarch64_atomic_fetch_add_4_impl, dest, add_value);
+}
+
+template<>
+template<typename I, typename D>
+inline D Atomic::PlatformAdd<8>::fetch_and_add(I add_value, D volatile* dest,
+                                               atomic_memory_order order) const {
+  STATIC_ASSERT(8 == sizeof(I));
+  STATIC_ASSERT(8 == sizeof(D));
+  return atomic_fastcall(aarch64_atomic_fetch_add_8_impl, dest, add_value);
+}
+
+template<>
 template<typename T>
-inline T Atomic::PlatformXchg<byte_size>::operator()(T exchange_value,
-                                                     T volatile* dest,
-                                                     atomic_memory_order order) const {
-  STATIC_ASSERT(byte_size == sizeof(T));
-  T res = __sync_lock_test_and_set(dest, exchange_value);
-  FULL_MEM_BARRIER;
-  return res;
+inline T Atomic::PlatformXchg<4>::operator()(T exchange_value,
+                                             T volatile* dest,
+                                             atomic_memory_order order) const {
+  STATIC_ASSERT(4 == sizeof(T));
+  return atomic_fastcall(aarch64_atomic_xchg_4_impl, dest, exchange_value);
 }
 
-template<size_t byte_size>
+template<>
+template<typename T>
+inline T Atomic::PlatformXchg<8>::operator()(T exchange_value,
+                                             T volatile* dest,
+                                             atomic_memory_order order) const {
+  STATIC_ASSERT(8 == sizeof(T));
+  return atomic_fastcall(aarch64_atomic_xchg_8_impl, dest, exchange_value);
+}
+
+template<>
+template<typename T>
+inline T Atomic::PlatformCmpxchg<1>::operator()(T exchange_value,
+                                                T volatile* dest,
+                                                T compare_value,
+                                                atomic_memory_order order) const {
+  STATIC_ASSERT(1 == sizeof(T));
+  aarch64_atomic_stub_t stub = (order == memory_order_relaxed)
+    ? aarch64_atomic_cmpxchg_1_relaxed_impl : aarch64_atomic_cmpxchg_1_impl;
+  return atomic_fastcall(stub, dest, compare_value, exchange_value);
+}
+
+template<>
+template<typename T>
+inline T Atomic::PlatformCmpxchg<4>::operator()(T exchange_value,
+                                                T volatile* dest,
+                                                T compare_value,
+                                                atomic_memory_order order) const {
+  STATIC_ASSERT(4 == sizeof(T));
+  aarch64_atomic_stub_t stub = (order == memory_order_relaxed)
+    ? aarch64_atomic_cmpxchg_4_relaxed_impl : aarch64_atomic_cmpxchg_4_impl;
+  return atomic_fastcall(stub, dest, compare_value, exchange_value);
+}
+
+template<>
 template<typename T>
-inline T Atomic::PlatformCmpxchg<byte_size>::operator()(T exchange_value,
-                                                        T volatile* dest,
-                                                        T compare_value,
-                                                        atomic_memory_order order) const {
-  STATIC_ASSERT(byte_size == sizeof(T));
-  if (order == memory_order_relaxed) {
-    T value = compare_value;
-    __atomic_compare_exchange(dest, &value, &exchange_value, /*weak*/false,
-                              __ATOMIC_RELAXED, __ATOMIC_RELAXED);
-    return value;
-  } else {
-    return __sync_val_compare_and_swap(dest, compare_value, exchange_value);
-  }
+inline T Atomic::PlatformCmpxchg<8>::operator()(T exchange_value,
+                                                T volatile* dest,
+                                                T compare_value,
+                                                atomic_memory_order order) const {
+  STATIC_ASSERT(8 == sizeof(T));
+  aarch64_atomic_stub_t stub = (order == memory_order_relaxed)
+    ? aarch64_atomic_cmpxchg_8_relaxed_impl : aarch64_atomic_cmpxchg_8_impl;
+  return atomic_fastcall(stub, dest, compare_value, exchange_value);
 }
 
 #endif // OS_CPU_LINUX_AARCH64_VM_ATOMIC_LINUX_AARCH64_HPP
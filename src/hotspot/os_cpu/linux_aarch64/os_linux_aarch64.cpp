@@ -614,3 +614,25 @@ extern "C" {
     memmove(to, from, count * 8);
   }
 };
+
+// Stub pointers used by Atomic::PlatformXX, initialized to the LL/SC
+// implementations in atomic_linux_aarch64.s. The stub generator replaces
+// them with LSE versions when UseLSE is set.
+#define DEFAULT_ATOMIC_OP(OPNAME, SIZE, RELAXED)                                \
+  extern "C" uint64_t aarch64_atomic_##OPNAME##_##SIZE##RELAXED##_default_impl  \
+    (volatile void *ptr, uint64_t arg1, uint64_t arg2);                         \
+  aarch64_atomic_stub_t aarch64_atomic_##OPNAME##_##SIZE##RELAXED##_impl        \
+    = aarch64_atomic_##OPNAME##_##SIZE##RELAXED##_default_impl;
+
+DEFAULT_ATOMIC_OP(fetch_add, 4, )
+DEFAULT_ATOMIC_OP(fetch_add, 8, )
+DEFAULT_ATOMIC_OP(xchg, 4, )
+DEFAULT_ATOMIC_OP(xchg, 8, )
+DEFAULT_ATOMIC_OP(cmpxchg, 1, )
+DEFAULT_ATOMIC_OP(cmpxchg, 4, )
+DEFAULT_ATOMIC_OP(cmpxchg, 8, )
+DEFAULT_ATOMIC_OP(cmpxchg, 1, _relaxed)
+DEFAULT_ATOMIC_OP(cmpxchg, 4, _relaxed)
+DEFAULT_ATOMIC_OP(cmpxchg, 8, _relaxed)
+
+#undef DEFAULT_ATOMIC_OP
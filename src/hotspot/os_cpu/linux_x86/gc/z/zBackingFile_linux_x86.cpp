@@ -65,6 +65,12 @@
 #ifndef O_TMPFILE
 #define O_TMPFILE                        (020000000 | O_DIRECTORY)
 #endif
+#ifndef FALLOC_FL_KEEP_SIZE
+#define FALLOC_FL_KEEP_SIZE              0x01
+#endif
+#ifndef FALLOC_FL_PUNCH_HOLE
+#define FALLOC_FL_PUNCH_HOLE             0x02
+#endif
 
 // Filesystem types, see statfs(2)
 #ifndef TMPFS_MAGIC
@@ -424,3 +430,37 @@ size_t ZBackingFile::try_expand(size_t offset, size_t length, size_t alignment)
     }
   }
 }
+
+bool ZBackingFile::commit(size_t offset, size_t length) const {
+  log_trace(gc, heap)("Committing memory: " SIZE_FORMAT "M-" SIZE_FORMAT "M (" SIZE_FORMAT "M)",
+                      offset / M, (offset + length) / M, length / M);
+
+  // Allocate backing for a range previously released by uncommit().
+  // The range is always within the current file size.
+  while (fallocate(_fd, 0 /* mode */, offset, length) == -1) {
+    ZErrno err;
+    if (err != EINTR) {
+      log_error(gc)("Failed to commit memory (%s)", err.to_string());
+      return false;
+    }
+  }
+
+  return true;
+}
+
+bool ZBackingFile::uncommit(size_t offset, size_t length) const {
+  log_trace(gc, heap)("Uncommitting memory: " SIZE_FORMAT "M-" SIZE_FORMAT "M (" SIZE_FORMAT "M)",
+                      offset / M, (offset + length) / M, length / M);
+
+  // Punch a hole in the backing file. This returns the memory to the
+  // operating system, while the file size is kept intact.
+  while (fallocate(_fd, FALLOC_FL_PUNCH_HOLE|FALLOC_FL_KEEP_SIZE, offset, length) == -1) {
+    ZErrno err;
+    if (err != EINTR) {
+      log_error(gc)("Failed to uncommit memory (%s)", err.to_string());
+      return false;
+    }
+  }
+
+  return true;
+}
@@ -58,6 +58,9 @@ public:
   size_t available() const;
 
   size_t try_expand(size_t offset, size_t length, size_t alignment) const;
+
+  bool commit(size_t offset, size_t length) const;
+  bool uncommit(size_t offset, size_t length) const;
 };
 
 #endif // OS_CPU_LINUX_X86_ZBACKINGFILE_LINUX_X86_HPP
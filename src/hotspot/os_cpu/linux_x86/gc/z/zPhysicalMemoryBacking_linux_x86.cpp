@@ -49,8 +49,10 @@
 
 ZPhysicalMemoryBacking::ZPhysicalMemoryBacking(size_t max_capacity, size_t granule_size) :
     _manager(),
+    _uncommitted(),
     _file(),
-    _granule_size(granule_size) {
+    _granule_size(granule_size),
+    _size(0) {
 
   if (!_file.is_initialized()) {
     return;
@@ -135,15 +137,75 @@ bool ZPhysicalMemoryBacking::is_initialized() const {
 size_t ZPhysicalMemoryBacking::try_expand(size_t old_capacity, size_t new_capacity) {
   assert(old_capacity < new_capacity, "Invalid old/new capacity");
 
-  const size_t capacity = _file.try_expand(old_capacity, new_capacity - old_capacity, _granule_size);
-  if (capacity > old_capacity) {
+  // Commit previously uncommitted memory first
+  size_t capacity = old_capacity + commit(new_capacity - old_capacity);
+  if (capacity == new_capacity) {
+    return capacity;
+  }
+
+  // Expand the backing file
+  const size_t old_size = _size;
+  const size_t new_size = _file.try_expand(old_size, new_capacity - capacity, _granule_size);
+  if (new_size > old_size) {
     // Add expanded capacity to free list
-    _manager.free(old_capacity, capacity - old_capacity);
+    _manager.free(old_size, new_size - old_size);
+    capacity += new_size - old_size;
+    _size = new_size;
   }
 
   return capacity;
 }
 
+size_t ZPhysicalMemoryBacking::commit(size_t size) {
+  size_t committed = 0;
+
+  // Commit granules, lowest offsets first
+  while (committed < size) {
+    const uintptr_t start = _uncommitted.alloc_from_front(_granule_size);
+    if (start == UINTPTR_MAX) {
+      // Nothing left to commit
+      break;
+    }
+
+    if (!_file.commit(start, _granule_size)) {
+      // Failed, give up
+      _uncommitted.free(start, _granule_size);
+      break;
+    }
+
+    _manager.free(start, _granule_size);
+    committed += _granule_size;
+  }
+
+  return committed;
+}
+
+size_t ZPhysicalMemoryBacking::uncommit(size_t size) {
+  assert(is_aligned(size, _granule_size), "Invalid size");
+
+  size_t uncommitted = 0;
+
+  // Uncommit granules, highest offsets first
+  while (uncommitted < size) {
+    const uintptr_t start = _manager.alloc_from_back(_granule_size);
+    if (start == UINTPTR_MAX) {
+      // Nothing left to uncommit
+      break;
+    }
+
+    if (!_file.uncommit(start, _granule_size)) {
+      // Failed, give up
+      _manager.free(start, _granule_size);
+      break;
+    }
+
+    _uncommitted.free(start, _granule_size);
+    uncommitted += _granule_size;
+  }
+
+  return uncommitted;
+}
+
 ZPhysicalMemory ZPhysicalMemoryBacking::alloc(size_t size) {
   assert(is_aligned(size, _granule_size), "Invalid size");
 
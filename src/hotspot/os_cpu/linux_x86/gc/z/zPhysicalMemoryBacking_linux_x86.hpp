@@ -33,8 +33,10 @@ class ZPhysicalMemory;
 class ZPhysicalMemoryBacking {
 private:
   ZMemoryManager _manager;
+  ZMemoryManager _uncommitted;
   ZBackingFile   _file;
   const size_t   _granule_size;
+  size_t         _size;
 
   void check_max_map_count(size_t max_capacity, size_t granule_size) const;
   void check_available_space_on_filesystem(size_t max_capacity) const;
@@ -45,12 +47,15 @@ private:
   void map_view(ZPhysicalMemory pmem, uintptr_t addr, bool pretouch) const;
   void unmap_view(ZPhysicalMemory pmem, uintptr_t addr) const;
 
+  size_t commit(size_t size);
+
 public:
   ZPhysicalMemoryBacking(size_t max_capacity, size_t granule_size);
 
   bool is_initialized() const;
 
   size_t try_expand(size_t old_capacity, size_t new_capacity);
+  size_t uncommit(size_t size);
 
   ZPhysicalMemory alloc(size_t size);
   void free(ZPhysicalMemory pmem);
@@ -559,6 +559,30 @@ bool InstructForm::rematerialize(FormDict &globals, RegisterForm *registers ) {
       _components[1]->isa(Component::USE) )
     rematerialize = true;
 
+  // Cheap address and integer arithmetic with one register input and
+  // only immediate operands otherwise, such as 'reg + offset'.  These
+  // are cheaper to recompute after a call than to spill and reload.
+  if( !rematerialize && _components.count() >= 3 &&
+      _components[0]->is(Component::DEF) ) {
+    const char *op = ideal_Opcode(globals);
+    if( !strcmp(op,"AddP") || !strcmp(op,"AddI") || !strcmp(op,"AddL") ) {
+      int reg_uses = 0;
+      bool cheap = true;
+      for( int i = 1; cheap && i < _components.count(); i++ ) {
+        Component *c = _components[i];
+        const Form *form = globals[c->_type];
+        OperandForm *opform = form ? form->is_operand() : NULL;
+        if( !c->is(Component::USE) || opform == NULL ) {
+          cheap = false;        // KILL, TEMP or something unusual
+        } else if( opform->interface_type(globals) != Form::constant_interface ) {
+          reg_uses++;
+        }
+      }
+      if( cheap && reg_uses == 1 )
+        rematerialize = true;
+    }
+  }
+
   // Check for an ideal 'Load?' and eliminate rematerialize option
   if ( is_ideal_load() != Form::none || // Ideal load?  Do not rematerialize
        is_ideal_copy() != Form::none || // Ideal copy?  Do not rematerialize
@@ -609,6 +633,7 @@ bool InstructForm::needs_anti_dependence_check(FormDict &globals) const {
         strcmp(_matrule->_rChild->_opType,"StrIndexOf" )==0 ||
         strcmp(_matrule->_rChild->_opType,"StrIndexOfChar" )==0 ||
         strcmp(_matrule->_rChild->_opType,"HasNegatives" )==0 ||
+        strcmp(_matrule->_rChild->_opType,"StrHashCode" )==0 ||
         strcmp(_matrule->_rChild->_opType,"AryEq"      )==0 ))
     return true;
 
@@ -894,6 +919,7 @@ uint InstructForm::oper_input_base(FormDict &globals) {
         strcmp(_matrule->_rChild->_opType,"StrIndexOf")==0 ||
         strcmp(_matrule->_rChild->_opType,"StrIndexOfChar")==0 ||
         strcmp(_matrule->_rChild->_opType,"HasNegatives")==0 ||
+        strcmp(_matrule->_rChild->_opType,"StrHashCode")==0 ||
         strcmp(_matrule->_rChild->_opType,"EncodeISOArray")==0)) {
         // String.(compareTo/equals/indexOf) and Arrays.equals
         // and sun.nio.cs.iso8859_1$Encoder.EncodeISOArray
@@ -4178,6 +4204,7 @@ bool MatchRule::is_vector() const {
     "SubVB","SubVS","SubVI","SubVL","SubVF","SubVD",
     "MulVB","MulVS","MulVI","MulVL","MulVF","MulVD",
     "CMoveVD", "CMoveVF",
+    "VectorMaskCmp", "VectorBlend",
     "DivVF","DivVD",
     "AbsVB","AbsVS","AbsVI","AbsVL","AbsVF","AbsVD",
     "NegVF","NegVD",
@@ -37,6 +37,7 @@
 #include "memory/allocation.inline.hpp"
 #include "oops/method.inline.hpp"
 #include "runtime/handles.inline.hpp"
+#include "runtime/mutexLocker.hpp"
 #include "runtime/os.hpp"
 #include "runtime/safepointVerifiers.hpp"
 #include "runtime/sharedRuntime.hpp"
@@ -797,6 +798,11 @@ bool AOTCodeHeap::load_klass_data(InstanceKlass* ik, Thread* thread) {
   // Initialize global symbols of the DSO to the corresponding VM symbol values.
   link_global_lib_symbols();
 
+  if (AOTLazyMethodLinking) {
+    // The methods are published one by one by link_method()
+    return true;
+  }
+
   int methods_offset = klass_data->_compiled_methods_offset;
   if (methods_offset >= 0) {
     address methods_cnt_adr = _methods_offsets + methods_offset;
@@ -811,12 +817,8 @@ bool AOTCodeHeap::load_klass_data(InstanceKlass* ik, Thread* thread) {
         continue; // skip AOT methods slots which have been invalidated
       }
       AOTMethodData* method_data = &methods_data[i];
-      const char* aot_name = _metaspace_names + method_offsets->_name_offset;
-      method_data->_name = aot_name;
-      method_data->_code = _code_space  + method_offsets->_code_offset;
-      method_data->_meta = (aot_metadata*)(_method_metadata + method_offsets->_meta_offset);
-      method_data->_metadata_table = (address)_metadata_got + method_offsets->_metadata_got_offset;
-      method_data->_metadata_size  = method_offsets->_metadata_got_size;
+      fill_method_data(method_offsets, method_data);
+      const char* aot_name = method_data->_name;
       // aot_name format: "<u2_size>Ljava/lang/ThreadGroup;<u2_size>addUnstarted<u2_size>()V"
       int klass_len = build_u2_from((address)aot_name);
       const char* method_name = aot_name + 2 + klass_len;
@@ -831,6 +833,64 @@ bool AOTCodeHeap::load_klass_data(InstanceKlass* ik, Thread* thread) {
   return true;
 }
 
+void AOTCodeHeap::fill_method_data(AOTMethodOffsets* method_offsets, AOTMethodData* method_data) {
+  method_data->_name = _metaspace_names + method_offsets->_name_offset;
+  method_data->_code = _code_space  + method_offsets->_code_offset;
+  method_data->_meta = (aot_metadata*)(_method_metadata + method_offsets->_meta_offset);
+  method_data->_metadata_table = (address)_metadata_got + method_offsets->_metadata_got_offset;
+  method_data->_metadata_size  = method_offsets->_metadata_got_size;
+}
+
+// Publish the AOT code of a single method of a class that load_klass_data()
+// accepted (AOTLazyMethodLinking). Returns true if the method has AOT code
+// in this library.
+bool AOTCodeHeap::link_method(const methodHandle& mh, Thread* thread) {
+  InstanceKlass* ik = mh->method_holder();
+  AOTKlassData* klass_data = find_klass(ik);
+  if (klass_data == NULL) {
+    return false;
+  }
+  AOTClass* aot_class = &_classes[klass_data->_class_id];
+  if (aot_class->_classloader != ik->class_loader_data()) {
+    return false; // the class was not loaded from this library
+  }
+  int methods_offset = klass_data->_compiled_methods_offset;
+  if (methods_offset < 0) {
+    return false;
+  }
+  Symbol* name = mh->name();
+  Symbol* signature = mh->signature();
+  // Unlike load_klass_data(), which runs once per class during its
+  // initialization, any thread invoking the method may get here, so
+  // serialize the check of _state with publish_aot().
+  MutexLocker ml(Compile_lock, thread);
+  address methods_cnt_adr = _methods_offsets + methods_offset;
+  int methods_cnt = *(int*)methods_cnt_adr;
+  AOTMethodOffsets* methods_offsets = (AOTMethodOffsets*)(methods_cnt_adr + 4);
+  for (int i = 0; i < methods_cnt; ++i) {
+    AOTMethodOffsets* method_offsets = &methods_offsets[i];
+    int code_id = method_offsets->_code_id;
+    if (_code_to_aot[code_id]._state != not_set) {
+      continue; // already published or invalidated
+    }
+    // aot_name format: "<u2_size>Ljava/lang/ThreadGroup;<u2_size>addUnstarted<u2_size>()V"
+    const char* aot_name = _metaspace_names + method_offsets->_name_offset;
+    int klass_len = build_u2_from((address)aot_name);
+    const char* method_name = aot_name + 2 + klass_len;
+    int method_name_len = build_u2_from((address)method_name);
+    const char* signature_name = method_name + 2 + method_name_len;
+    int signature_name_len = build_u2_from((address)signature_name);
+    if (name->equals(method_name + 2, method_name_len) &&
+        signature->equals(signature_name + 2, signature_name_len)) {
+      AOTMethodData method_data;
+      fill_method_data(method_offsets, &method_data);
+      publish_aot(mh, &method_data, code_id);
+      return true;
+    }
+  }
+  return false;
+}
+
 AOTCompiledMethod* AOTCodeHeap::next_in_use_at(int start) const {
   for (int index = start; index < _method_count; index++) {
     if (_code_to_aot[index]._state != in_use) {
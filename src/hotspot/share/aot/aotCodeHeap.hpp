@@ -221,6 +221,7 @@ class AOTCodeHeap : public CodeHeap {
 
   void link_global_lib_symbols();
   void link_primitive_array_klasses();
+  void fill_method_data(AOTMethodOffsets* method_offsets, AOTMethodData* method_data);
   void publish_aot(const methodHandle& mh, AOTMethodData* method_data, int code_id);
 
 
@@ -241,6 +242,7 @@ public:
 
   AOTKlassData* find_klass(InstanceKlass* ik);
   bool load_klass_data(InstanceKlass* ik, Thread* thread);
+  bool link_method(const methodHandle& mh, Thread* thread);
   Klass* get_klass_from_got(const char* klass_name, int klass_len, const Method* method);
 
   bool is_dependent_method(Klass* dependee, AOTCompiledMethod* aot);
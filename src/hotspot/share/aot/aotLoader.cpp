@@ -55,6 +55,16 @@ void AOTLoader::load_for_klass(InstanceKlass* ik, Thread* thread) {
   }
 }
 
+void AOTLoader::link_method(const methodHandle& mh, Thread* thread) {
+  if (UseAOT && AOTLazyMethodLinking && mh->code() == NULL) {
+    FOR_ALL_AOT_HEAPS(heap) {
+      if ((*heap)->link_method(mh, thread)) {
+        break;
+      }
+    }
+  }
+}
+
 uint64_t AOTLoader::get_saved_fingerprint(InstanceKlass* ik) {
   assert(UseAOT, "called only when AOT is enabled");
   if (ik->is_anonymous()) {
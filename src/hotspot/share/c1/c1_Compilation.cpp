@@ -665,7 +665,7 @@ void Compilation::print_timers() {
     tty->print_cr("       Emit LIR:            %7.3f s",    timers[_t_emit_lir].seconds());
     tty->print_cr("         LIR Gen:             %7.3f s",   timers[_t_lirGeneration].seconds());
     tty->print_cr("         Linear Scan:         %7.3f s",   timers[_t_linearScan].seconds());
-    NOT_PRODUCT(LinearScan::print_timers(timers[_t_linearScan].seconds()));
+    LinearScan::print_timers(timers[_t_linearScan].seconds());
 
     double other = timers[_t_emit_lir].seconds() -
       (timers[_t_lirGeneration].seconds() +
@@ -2196,6 +2196,43 @@ bool GraphBuilder::direct_compare(ciKlass* k) {
 }
 
 
+// Returns the most frequent receiver type recorded in the MDO for the
+// type check at the current bci if it is a subtype of k.  Only checks
+// against secondary supertypes benefit from an exact compare: a primary
+// supertype is already checked with a single load and compare.
+ciKlass* GraphBuilder::likely_klass_for_type_check(ciKlass* k) {
+  if (!C1ProfileGuidedTypeChecks || UseSlowPath || !k->is_loaded()) {
+    return NULL;
+  }
+  const juint secondary_offset = in_bytes(Klass::secondary_super_cache_offset());
+  if (k->super_check_offset() != secondary_offset) {
+    return NULL;
+  }
+  ciMethodData* md = method()->method_data_or_null();
+  if (md == NULL) {
+    return NULL;
+  }
+  ciProfileData* data = md->bci_to_data(bci());
+  if (data == NULL || !data->is_ReceiverTypeData()) {
+    return NULL;
+  }
+  ciReceiverTypeData* rtd = (ciReceiverTypeData*)data->as_ReceiverTypeData();
+  ciKlass* likely = NULL;
+  uint likely_count = 0;
+  for (uint row = 0; row < rtd->row_limit(); row++) {
+    ciKlass* receiver = rtd->receiver(row);
+    if (receiver != NULL && rtd->receiver_count(row) > likely_count) {
+      likely = receiver;
+      likely_count = rtd->receiver_count(row);
+    }
+  }
+  if (likely != NULL && likely->is_loaded() && likely->is_subtype_of(k)) {
+    return likely;
+  }
+  return NULL;
+}
+
+
 void GraphBuilder::check_cast(int klass_index) {
   bool will_link;
   ciKlass* klass = stream()->get_klass(will_link);
@@ -2203,6 +2240,9 @@ void GraphBuilder::check_cast(int klass_index) {
   CheckCast* c = new CheckCast(klass, apop(), state_before);
   apush(append_split(c));
   c->set_direct_compare(direct_compare(klass));
+  if (!c->direct_compare()) {
+    c->set_likely_klass(likely_klass_for_type_check(klass));
+  }
 
   if (is_profiling()) {
     // Note that we'd collect profile data in this method if we wanted it.
@@ -2224,6 +2264,9 @@ void GraphBuilder::instance_of(int klass_index) {
   InstanceOf* i = new InstanceOf(klass, apop(), state_before);
   ipush(append_split(i));
   i->set_direct_compare(direct_compare(klass));
+  if (!i->direct_compare()) {
+    i->set_likely_klass(likely_klass_for_type_check(klass));
+  }
 
   if (is_profiling()) {
     // Note that we'd collect profile data in this method if we wanted it.
@@ -1410,12 +1410,13 @@ BASE(TypeCheck, StateSplit)
 
   ciMethod* _profiled_method;
   int       _profiled_bci;
+  ciKlass*  _likely_klass;
 
  public:
   // creation
   TypeCheck(ciKlass* klass, Value obj, ValueType* type, ValueStack* state_before)
   : StateSplit(type, state_before), _klass(klass), _obj(obj),
-    _profiled_method(NULL), _profiled_bci(0) {
+    _profiled_method(NULL), _profiled_bci(0), _likely_klass(NULL) {
     ASSERT_VALUES
     set_direct_compare(false);
   }
@@ -1425,9 +1426,11 @@ BASE(TypeCheck, StateSplit)
   Value obj() const                              { return _obj; }
   bool is_loaded() const                         { return klass() != NULL; }
   bool direct_compare() const                    { return check_flag(DirectCompareFlag); }
+  ciKlass* likely_klass() const                  { return _likely_klass; }
 
   // manipulation
   void set_direct_compare(bool flag)             { set_flag(DirectCompareFlag, flag); }
+  void set_likely_klass(ciKlass* k)              { _likely_klass = k; }
 
   // generic
   virtual bool can_trap() const                  { return true; }
@@ -391,6 +391,7 @@ LIR_OpTypeCheck::LIR_OpTypeCheck(LIR_Code code, LIR_Opr result, LIR_Opr object,
   , _profiled_method(NULL)
   , _profiled_bci(-1)
   , _should_profile(false)
+  , _likely_klass(NULL)
 {
   if (code == lir_checkcast) {
     assert(info_for_exception != NULL, "checkcast throws exceptions");
@@ -418,6 +419,7 @@ LIR_OpTypeCheck::LIR_OpTypeCheck(LIR_Code code, LIR_Opr object, LIR_Opr array, L
   , _profiled_method(NULL)
   , _profiled_bci(-1)
   , _should_profile(false)
+  , _likely_klass(NULL)
 {
   if (code == lir_store_check) {
     _stub = new ArrayStoreExceptionStub(object, info_for_exception);
@@ -1491,7 +1493,7 @@ void check_LIR() {
 void LIR_List::checkcast (LIR_Opr result, LIR_Opr object, ciKlass* klass,
                           LIR_Opr tmp1, LIR_Opr tmp2, LIR_Opr tmp3, bool fast_check,
                           CodeEmitInfo* info_for_exception, CodeEmitInfo* info_for_patch, CodeStub* stub,
-                          ciMethod* profiled_method, int profiled_bci) {
+                          ciMethod* profiled_method, int profiled_bci, ciKlass* likely_klass) {
   LIR_OpTypeCheck* c = new LIR_OpTypeCheck(lir_checkcast, result, object, klass,
                                            tmp1, tmp2, tmp3, fast_check, info_for_exception, info_for_patch, stub);
   if (profiled_method != NULL) {
@@ -1499,16 +1501,18 @@ void LIR_List::checkcast (LIR_Opr result, LIR_Opr object, ciKlass* klass,
     c->set_profiled_bci(profiled_bci);
     c->set_should_profile(true);
   }
+  c->set_likely_klass(likely_klass);
   append(c);
 }
 
-void LIR_List::instanceof(LIR_Opr result, LIR_Opr object, ciKlass* klass, LIR_Opr tmp1, LIR_Opr tmp2, LIR_Opr tmp3, bool fast_check, CodeEmitInfo* info_for_patch, ciMethod* profiled_method, int profiled_bci) {
+void LIR_List::instanceof(LIR_Opr result, LIR_Opr object, ciKlass* klass, LIR_Opr tmp1, LIR_Opr tmp2, LIR_Opr tmp3, bool fast_check, CodeEmitInfo* info_for_patch, ciMethod* profiled_method, int profiled_bci, ciKlass* likely_klass) {
   LIR_OpTypeCheck* c = new LIR_OpTypeCheck(lir_instanceof, result, object, klass, tmp1, tmp2, tmp3, fast_check, NULL, info_for_patch, NULL);
   if (profiled_method != NULL) {
     c->set_profiled_method(profiled_method);
     c->set_profiled_bci(profiled_bci);
     c->set_should_profile(true);
   }
+  c->set_likely_klass(likely_klass);
   append(c);
 }
 
@@ -2074,6 +2078,9 @@ void LIR_OpTypeCheck::print_instr(outputStream* out) const {
   if (code() != lir_store_check) {
     klass()->print_name_on(out);         out->print(" ");
     if (fast_check())                 out->print("fast_check ");
+    if (likely_klass() != NULL) {
+      out->print("likely:");             likely_klass()->print_name_on(out); out->print(" ");
+    }
   }
   tmp1()->print(out);                    out->print(" ");
   tmp2()->print(out);                    out->print(" ");
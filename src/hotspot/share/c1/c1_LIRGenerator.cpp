@@ -959,11 +959,36 @@ LIR_Opr LIRGenerator::force_to_spill(LIR_Opr value, BasicType t) {
   return tmp;
 }
 
-#ifndef NO_FLAG_REG
-void LIRGenerator::profile_branch(If* if_instr, If::Condition cond) {
-#else
+// Decrements the thread local sampling countdown and branches to the
+// returned label unless the current execution is sampled.  A sampled
+// execution resets the countdown and falls through into the update.
+LabelObj* LIRGenerator::begin_sampled_profile_update() {
+  assert(C1ProfileBranchSampleRate > 1, "only for sampled profiling");
+  LabelObj* skip = new LabelObj();
+  LIR_Opr thread = getThreadPointer();
+  int countdown_offset = in_bytes(JavaThread::c1_profile_countdown_offset());
+
+  LIR_Opr countdown = new_register(T_INT);
+  __ load(new LIR_Address(thread, countdown_offset, T_INT), countdown);
+  __ sub(countdown, LIR_OprFact::intConst(1), countdown);
+  __ store(countdown, new LIR_Address(thread, countdown_offset, T_INT));
+  __ cmp(lir_cond_greater, countdown, 0);
+  __ branch(lir_cond_greater, NO_FLAGREG_ONLY_ARG(countdown) NO_FLAGREG_ONLY_ARG(LIR_OprFact::intConst(0))
+            T_INT, skip->label());
+
+  LIR_Opr reset = new_register(T_INT);
+  __ move(LIR_OprFact::intConst((jint)C1ProfileBranchSampleRate), reset);
+  __ store(reset, new LIR_Address(thread, countdown_offset, T_INT));
+  return skip;
+}
+
+void LIRGenerator::end_sampled_profile_update(LabelObj* skip) {
+  if (skip != NULL) {
+    __ branch_destination(skip->label());
+  }
+}
+
 void LIRGenerator::profile_branch(If* if_instr, If::Condition cond, LIR_Opr left, LIR_Opr right) {
-#endif
   if (if_instr->should_profile()) {
     ciMethod* method = if_instr->profiled_method();
     assert(method != NULL, "method should be set if branch is profiled");
@@ -980,6 +1005,18 @@ void LIRGenerator::profile_branch(If* if_instr, If::Condition cond, LIR_Opr left
       not_taken_count_offset = t;
     }
 
+    // The countdown check destroys the condition codes, so they are
+    // recomputed from left and right for the cmove and the branch.
+    LabelObj* skip = NULL;
+    int increment = DataLayout::counter_increment;
+    if (C1ProfileBranchSampleRate > 1 && left->is_valid()) {
+      skip = begin_sampled_profile_update();
+      increment *= (int)C1ProfileBranchSampleRate;
+#ifndef NO_FLAG_REG
+      __ cmp(lir_cond(cond), left, right);
+#endif
+    }
+
     LIR_Opr md_reg = new_register(T_METADATA);
     __ metadata2reg(md->constant_encoding(), md_reg);
 
@@ -997,9 +1034,16 @@ void LIRGenerator::profile_branch(If* if_instr, If::Condition cond, LIR_Opr left
 
     __ move(data_addr, data_reg);
     // Use leal instead of add to avoid destroying condition codes on x86
-    LIR_Address* fake_incr_value = new LIR_Address(data_reg, DataLayout::counter_increment, T_INT);
+    LIR_Address* fake_incr_value = new LIR_Address(data_reg, increment, T_INT);
     __ leal(LIR_OprFact::address(fake_incr_value), data_reg);
     __ move(data_reg, data_addr);
+
+    if (skip != NULL) {
+      end_sampled_profile_update(skip);
+#ifndef NO_FLAG_REG
+      __ cmp(lir_cond(cond), left, right);
+#endif
+    }
   }
 }
 
@@ -2528,11 +2572,19 @@ void LIRGenerator::do_Goto(Goto* x) {
       assert(data->is_JumpData(), "need JumpData for branches");
       offset = md->byte_offset_of_slot(data, JumpData::taken_offset());
     }
+    LabelObj* skip = NULL;
+    int increment = DataLayout::counter_increment;
+    if (C1ProfileBranchSampleRate > 1) {
+      skip = begin_sampled_profile_update();
+      increment *= (int)C1ProfileBranchSampleRate;
+    }
+
     LIR_Opr md_reg = new_register(T_METADATA);
     __ metadata2reg(md->constant_encoding(), md_reg);
 
     increment_counter(new LIR_Address(md_reg, offset,
-                                      NOT_LP64(T_INT) LP64_ONLY(T_LONG)), DataLayout::counter_increment);
+                                      NOT_LP64(T_INT) LP64_ONLY(T_LONG)), increment);
+    end_sampled_profile_update(skip);
   }
 
   // emit phi-instruction move after safepoint since this simplifies
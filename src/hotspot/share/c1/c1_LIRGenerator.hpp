@@ -393,12 +393,19 @@ class LIRGenerator: public InstructionVisitor, public BlockClosure {
 
   LIR_Opr safepoint_poll_register();
 
-#ifdef NO_FLAG_REG
+  // left and right are needed to recompute the condition codes after a
+  // sampled update; without them every execution updates the profile
   void profile_branch(If* if_instr, If::Condition cond, LIR_Opr left, LIR_Opr right);
-#else
-  void profile_branch(If* if_instr, If::Condition cond);
+#ifndef NO_FLAG_REG
+  void profile_branch(If* if_instr, If::Condition cond) {
+    profile_branch(if_instr, cond, LIR_OprFact::illegalOpr, LIR_OprFact::illegalOpr);
+  }
 #endif
 
+  // sampled updates of branch counters (C1ProfileBranchSampleRate)
+  LabelObj* begin_sampled_profile_update();
+  void      end_sampled_profile_update(LabelObj* skip);
+
   void increment_event_counter_impl(CodeEmitInfo* info,
                                     ciMethod *method, LIR_Opr step, int frequency,
                                     int bci, bool backedge, bool notify);
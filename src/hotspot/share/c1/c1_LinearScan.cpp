@@ -35,17 +35,19 @@
 #include "runtime/timerTrace.hpp"
 #include "utilities/bitMap.inline.hpp"
 
+// the phase timers are also available in product builds so that the
+// register allocation time of huge methods can be broken down with -XX:+CITime
+static LinearScanTimers _total_timer;
+
+// helper macro for short definition of timer
+#define TIME_LINEAR_SCAN(timer_name)  TraceTime _block_timer("", _total_timer.timer(LinearScanTimers::timer_name), TimeLinearScan || TimeEachLinearScan || CITime, Verbose);
+
 #ifndef PRODUCT
 
   static LinearScanStatistic _stat_before_alloc;
   static LinearScanStatistic _stat_after_asign;
   static LinearScanStatistic _stat_final;
 
-  static LinearScanTimers _total_timer;
-
-  // helper macro for short definition of timer
-  #define TIME_LINEAR_SCAN(timer_name)  TraceTime _block_timer("", _total_timer.timer(LinearScanTimers::timer_name), TimeLinearScan || TimeEachLinearScan, Verbose);
-
   // helper macro for short definition of trace-output inside code
   #define TRACE_LINEAR_SCAN(level, code)       \
     if (TraceLinearScanLevel >= level) {       \
@@ -54,7 +56,6 @@
 
 #else
 
-  #define TIME_LINEAR_SCAN(timer_name)
   #define TRACE_LINEAR_SCAN(level, code)
 
 #endif
@@ -742,6 +743,19 @@ void LinearScan::compute_global_live_sets() {
   int  iteration_count = 0;
   ResourceBitMap live_out(live_set_size()); // scratch set for calculations
 
+  // For huge methods the live sets are large and most blocks are already
+  // stable after the first iteration, so the set operations are only
+  // repeated for blocks where the live_in set of a successor or exception
+  // handler changed after the block was processed the last time.
+  // Both arrays are indexed by linear_scan_number and hold a step count.
+  int* processed_at = NEW_RESOURCE_ARRAY(int, num_blocks);
+  int* changed_at   = NEW_RESOURCE_ARRAY(int, num_blocks);
+  int  step = 0;
+  for (int i = 0; i < num_blocks; i++) {
+    processed_at[i] = -1;
+    changed_at[i]   = 0;
+  }
+
   // Perform a backward dataflow analysis to compute live_out and live_in for each block.
   // The loop is executed until a fixpoint is reached (no changes in an iteration)
   // Exception handlers must be processed because not all live values are
@@ -752,12 +766,29 @@ void LinearScan::compute_global_live_sets() {
     // iterate all blocks in reverse order
     for (int i = num_blocks - 1; i >= 0; i--) {
       BlockBegin* block = block_at(i);
+      assert(block->linear_scan_number() == i, "invalid block order");
 
       change_occurred_in_block = false;
+      step++;
 
-      // live_out(block) is the union of live_in(sux), for successors sux of block
       int n = block->number_of_sux();
       int e = block->number_of_exception_handlers();
+      if (iteration_count > 0) {
+        bool input_changed = false;
+        for (int j = 0; j < n && !input_changed; j++) {
+          input_changed = changed_at[block->sux_at(j)->linear_scan_number()] > processed_at[i];
+        }
+        for (int j = 0; j < e && !input_changed; j++) {
+          input_changed = changed_at[block->exception_handler_at(j)->linear_scan_number()] > processed_at[i];
+        }
+        if (!input_changed) {
+          // live_out would be recomputed from unchanged sets
+          continue;
+        }
+      }
+      processed_at[i] = step;
+
+      // live_out(block) is the union of live_in(sux), for successors sux of block
       if (n + e > 0) {
         // block has successors
         if (n > 0) {
@@ -790,6 +821,7 @@ void LinearScan::compute_global_live_sets() {
         live_in.set_from(block->live_out());
         live_in.set_difference(block->live_kill());
         live_in.set_union(block->live_gen());
+        changed_at[i] = ++step;
       }
 
 #ifndef PRODUCT
@@ -1597,12 +1629,24 @@ void LinearScan::sort_intervals_before_allocation() {
         sorted_from_max = cur_interval->from();
       } else {
         // the asumption that the intervals are already sorted failed,
-        // so this interval must be sorted in manually
-        int j;
-        for (j = sorted_idx - 1; j >= 0 && cur_from < sorted_list->at(j)->from(); j--) {
+        // so this interval must be sorted in manually. Binary search for the
+        // insertion point after all intervals with the same from() to keep the
+        // order stable; this keeps huge methods with many swapped intervals
+        // from degrading to a quadratic number of comparisons
+        int lo = 0;
+        int hi = sorted_idx;
+        while (lo < hi) {
+          int mid = (lo + hi) >> 1;
+          if (cur_from < sorted_list->at(mid)->from()) {
+            hi = mid;
+          } else {
+            lo = mid + 1;
+          }
+        }
+        for (int j = sorted_idx - 1; j >= lo; j--) {
           sorted_list->at_put(j + 1, sorted_list->at(j));
         }
-        sorted_list->at_put(j + 1, cur_interval);
+        sorted_list->at_put(lo, cur_interval);
         sorted_idx++;
       }
     }
@@ -3083,7 +3127,7 @@ void LinearScan::assign_reg_num() {
 
 
 void LinearScan::do_linear_scan() {
-  NOT_PRODUCT(_total_timer.begin_method());
+  _total_timer.begin_method();
 
   number_instructions();
 
@@ -3143,18 +3187,18 @@ void LinearScan::do_linear_scan() {
 
   NOT_PRODUCT(print_lir(1, "Before Code Generation", false));
   NOT_PRODUCT(LinearScanStatistic::compute(this, _stat_final));
-  NOT_PRODUCT(_total_timer.end_method(this));
+  _total_timer.end_method(this);
 }
 
 
 // ********** Printing functions
 
-#ifndef PRODUCT
-
 void LinearScan::print_timers(double total) {
   _total_timer.print(total);
 }
 
+#ifndef PRODUCT
+
 void LinearScan::print_statistics() {
   _stat_before_alloc.print("before allocation");
   _stat_after_asign.print("after assignment of register");
@@ -6735,6 +6779,8 @@ void LinearScanStatistic::compute(LinearScan* allocator, LinearScanStatistic &gl
   }
 }
 
+#endif // #ifndef PRODUCT
+
 
 // Implementation of LinearTimers
 
@@ -6803,7 +6849,7 @@ void LinearScanTimers::end_method(LinearScan* allocator) {
 }
 
 void LinearScanTimers::print(double total_time) {
-  if (TimeLinearScan) {
+  if (TimeLinearScan || CITime) {
     // correction value: sum of dummy-timer that only measures the time that
     // is necesary to start and stop itself
     double c = timer(timer_do_nothing)->seconds();
@@ -6815,4 +6861,3 @@ void LinearScanTimers::print(double total_time) {
   }
 }
 
-#endif // #ifndef PRODUCT
@@ -31,6 +31,7 @@
 #include "c1/c1_Instruction.hpp"
 #include "c1/c1_LIR.hpp"
 #include "c1/c1_LIRGenerator.hpp"
+#include "runtime/timer.hpp"
 #include "utilities/align.hpp"
 #include "utilities/macros.hpp"
 
@@ -395,10 +396,8 @@ class LinearScan : public CompilationResourceObj {
   int         num_calls() const   { assert(_num_calls >= 0, "not set"); return _num_calls; }
 
   // entry functions for printing
-#ifndef PRODUCT
-  static void print_statistics();
+  static void print_statistics() PRODUCT_RETURN;
   static void print_timers(double total);
-#endif
 };
 
 
@@ -844,6 +843,42 @@ class ControlFlowOptimizer : public StackObj {
 };
 
 
+// Helper class for collecting compilation time of LinearScan
+class LinearScanTimers : public StackObj {
+ public:
+  enum Timer {
+    timer_do_nothing,
+    timer_number_instructions,
+    timer_compute_local_live_sets,
+    timer_compute_global_live_sets,
+    timer_build_intervals,
+    timer_sort_intervals_before,
+    timer_allocate_registers,
+    timer_resolve_data_flow,
+    timer_sort_intervals_after,
+    timer_eliminate_spill_moves,
+    timer_assign_reg_num,
+    timer_allocate_fpu_stack,
+    timer_optimize_lir,
+
+    number_of_timers
+  };
+
+ private:
+  elapsedTimer _timers[number_of_timers];
+  const char*  timer_name(int idx);
+
+ public:
+  LinearScanTimers();
+
+  void begin_method();                     // called for each method when register allocation starts
+  void end_method(LinearScan* allocator);  // called for each method when register allocation completed
+  void print(double total_time);           // called before termination of VM to print global summary
+
+  elapsedTimer* timer(int idx) { return &(_timers[idx]); }
+};
+
+
 #ifndef PRODUCT
 
 // Helper class for collecting statistics of LinearScan
@@ -923,42 +958,6 @@ class LinearScanStatistic : public StackObj {
 };
 
 
-// Helper class for collecting compilation time of LinearScan
-class LinearScanTimers : public StackObj {
- public:
-  enum Timer {
-    timer_do_nothing,
-    timer_number_instructions,
-    timer_compute_local_live_sets,
-    timer_compute_global_live_sets,
-    timer_build_intervals,
-    timer_sort_intervals_before,
-    timer_allocate_registers,
-    timer_resolve_data_flow,
-    timer_sort_intervals_after,
-    timer_eliminate_spill_moves,
-    timer_assign_reg_num,
-    timer_allocate_fpu_stack,
-    timer_optimize_lir,
-
-    number_of_timers
-  };
-
- private:
-  elapsedTimer _timers[number_of_timers];
-  const char*  timer_name(int idx);
-
- public:
-  LinearScanTimers();
-
-  void begin_method();                     // called for each method when register allocation starts
-  void end_method(LinearScan* allocator);  // called for each method when register allocation completed
-  void print(double total_time);           // called before termination of VM to print global summary
-
-  elapsedTimer* timer(int idx) { return &(_timers[idx]); }
-};
-
-
 #endif // ifndef PRODUCT
 
 // Pick up platform-dependent implementation details
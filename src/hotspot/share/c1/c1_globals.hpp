@@ -312,12 +312,22 @@
   product(bool, C1ProfileBranches, true,                                    \
           "Profile branches when generating code for updating MDOs")        \
                                                                             \
+  product(intx, C1ProfileBranchSampleRate, 1,                               \
+          "Update the branch counters of MDOs only every n-th time a "      \
+          "profiled branch is executed; the counters are then advanced "    \
+          "by n so that the counts stay unbiased")                          \
+          range(1, 1024)                                                    \
+                                                                            \
   product(bool, C1ProfileCheckcasts, true,                                  \
           "Profile checkcasts when generating code for updating MDOs")      \
                                                                             \
   product(bool, C1OptimizeVirtualCallProfiling, true,                       \
           "Use CHA and exact type results at call sites when updating MDOs")\
                                                                             \
+  product(bool, C1ProfileGuidedTypeChecks, true,                            \
+          "Test for the dominant receiver type recorded in the MDO before " \
+          "the secondary supertype check of checkcast and instanceof")      \
+                                                                            \
   product(bool, C1UpdateMethodData, trueInTiered,                           \
           "Update MethodData*s in Tier1-generated code")                    \
                                                                             \
@@ -38,15 +38,21 @@ private:
   friend class ciMethod;
   friend class ciMethodHandle;
 
-  enum { MorphismLimit = 2 }; // Max call site's morphism we care about
+public:
+  enum { MorphismLimit = 2,     // Max call site's morphism we care about
+         MaxMorphismLimit = 8 };  // Max morphism with polymorphic inlining
+
+private:
+  int  _morphism_limit;       // MorphismLimit or polymorphic inlining limit
   int  _limit;                // number of receivers have been determined
   int  _morphism;             // determined call site's morphism
   int  _count;                // # times has this call been executed
-  int  _receiver_count[MorphismLimit + 1]; // # times receivers have been seen
-  ciMethod* _method[MorphismLimit + 1];    // receivers methods
-  ciKlass*  _receiver[MorphismLimit + 1];  // receivers (exact)
+  int  _receiver_count[MaxMorphismLimit + 1]; // # times receivers have been seen
+  ciMethod* _method[MaxMorphismLimit + 1];    // receivers methods
+  ciKlass*  _receiver[MaxMorphismLimit + 1];  // receivers (exact)
 
   ciCallProfile() {
+    _morphism_limit = MorphismLimit;
     _limit = 0;
     _morphism    = 0;
     _count = -1;
@@ -61,22 +67,23 @@ public:
   // Note:  The following predicates return false for invalid profiles:
   bool      has_receiver(int i) const { return _limit > i; }
   int       morphism() const          { return _morphism; }
+  int       morphism_limit() const    { return _morphism_limit; }
 
   int       count() const             { return _count; }
   int       receiver_count(int i)  {
-    assert(i < _limit, "out of Call Profile MorphismLimit");
+    assert(i < _limit, "out of Call Profile morphism limit");
     return _receiver_count[i];
   }
   float     receiver_prob(int i)  {
-    assert(i < _limit, "out of Call Profile MorphismLimit");
+    assert(i < _limit, "out of Call Profile morphism limit");
     return (float)_receiver_count[i]/(float)_count;
   }
   ciMethod* method(int i)          {
-    assert(i < _limit, "out of Call Profile MorphismLimit");
+    assert(i < _limit, "out of Call Profile morphism limit");
     return _method[i];
   }
   ciKlass*  receiver(int i)        {
-    assert(i < _limit, "out of Call Profile MorphismLimit");
+    assert(i < _limit, "out of Call Profile morphism limit");
     return _receiver[i];
   }
 
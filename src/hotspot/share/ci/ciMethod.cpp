@@ -52,6 +52,7 @@
 #include "ci/bcEscapeAnalyzer.hpp"
 #include "ci/ciTypeFlow.hpp"
 #include "oops/method.hpp"
+#include "opto/c2_globals.hpp"
 #endif
 
 // ciMethod
@@ -477,6 +478,15 @@ ciCallProfile ciMethod::call_profile_at_bci(int bci) {
         result._receiver_count[0] = 0;  // that's a definite zero
       } else { // ReceiverTypeData is a subclass of CounterData
         ciReceiverTypeData* call = (ciReceiverTypeData*)data->as_ReceiverTypeData();
+#ifdef COMPILER2
+        if (UsePolymorphicInlining) {
+          // Keep as many receivers as polymorphic inlining may use, but
+          // no more than were recorded so that a full profile still
+          // means the call site has other receivers.
+          result._morphism_limit = MAX2((int)ciCallProfile::MorphismLimit,
+                                        MIN2((int)PolymorphicInliningLimit, (int)call->row_limit()));
+        }
+#endif
         // In addition, virtual call sites have receiver type information
         int receivers_count_total = 0;
         int morphism = 0;
@@ -514,8 +524,8 @@ ciCallProfile ciMethod::call_profile_at_bci(int bci) {
         // The call site count is > 0 in the case of a polymorphic virtual call.
         if (morphism > 0 && morphism == result._limit) {
            // The morphism <= MorphismLimit.
-           if ((morphism <  ciCallProfile::MorphismLimit) ||
-               (morphism == ciCallProfile::MorphismLimit && count == 0)) {
+           if ((morphism <  result._morphism_limit) ||
+               (morphism == result._morphism_limit && count == 0)) {
 #ifdef ASSERT
              if (count > 0) {
                this->print_short_name(tty);
@@ -555,7 +565,7 @@ void ciCallProfile::add_receiver(ciKlass* receiver, int receiver_count) {
   }
   _receiver[i] = receiver;
   _receiver_count[i] = receiver_count;
-  if (_limit < MorphismLimit) _limit++;
+  if (_limit < _morphism_limit) _limit++;
 }
 
 
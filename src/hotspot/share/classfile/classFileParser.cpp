@@ -3873,8 +3873,8 @@ static unsigned int compute_oop_map_count(const InstanceKlass* super,
   return map_count;
 }
 
-#ifndef PRODUCT
-static void print_field_layout(const Symbol* name,
+static void print_field_layout(outputStream* st,
+                               const Symbol* name,
                                Array<u2>* fields,
                                const constantPoolHandle& cp,
                                int instance_size,
@@ -3884,31 +3884,33 @@ static void print_field_layout(const Symbol* name,
 
   assert(name != NULL, "invariant");
 
-  tty->print("%s: field layout\n", name->as_klass_external_name());
-  tty->print("  @%3d %s\n", instance_fields_start, "--- instance fields start ---");
+  st->print("%s: field layout\n", name->as_klass_external_name());
+  st->print("  @%3d %s\n", instance_fields_start, "--- instance fields start ---");
   for (AllFieldStream fs(fields, cp); !fs.done(); fs.next()) {
     if (!fs.access_flags().is_static()) {
-      tty->print("  @%3d \"%s\" %s\n",
+      // Also show the cache line (relative to the object start) of each
+      // instance field, to see whether fields used together share one.
+      st->print("  @%3d \"%s\" %s [line %d]\n",
         fs.offset(),
         fs.name()->as_klass_external_name(),
-        fs.signature()->as_klass_external_name());
+        fs.signature()->as_klass_external_name(),
+        fs.offset() / DEFAULT_CACHE_LINE_SIZE);
     }
   }
-  tty->print("  @%3d %s\n", instance_fields_end, "--- instance fields end ---");
-  tty->print("  @%3d %s\n", instance_size * wordSize, "--- instance ends ---");
-  tty->print("  @%3d %s\n", InstanceMirrorKlass::offset_of_static_fields(), "--- static fields start ---");
+  st->print("  @%3d %s\n", instance_fields_end, "--- instance fields end ---");
+  st->print("  @%3d %s\n", instance_size * wordSize, "--- instance ends ---");
+  st->print("  @%3d %s\n", InstanceMirrorKlass::offset_of_static_fields(), "--- static fields start ---");
   for (AllFieldStream fs(fields, cp); !fs.done(); fs.next()) {
     if (fs.access_flags().is_static()) {
-      tty->print("  @%3d \"%s\" %s\n",
+      st->print("  @%3d \"%s\" %s\n",
         fs.offset(),
         fs.name()->as_klass_external_name(),
         fs.signature()->as_klass_external_name());
     }
   }
-  tty->print("  @%3d %s\n", static_fields_end, "--- static fields end ---");
-  tty->print("\n");
+  st->print("  @%3d %s\n", static_fields_end, "--- static fields end ---");
+  st->print("\n");
 }
-#endif
 
 // Values needed for oopmap and InstanceKlass creation
 class ClassFileParser::FieldLayoutInfo : public ResourceObj {
@@ -4421,7 +4423,8 @@ void ClassFileParser::layout_fields(ConstantPool* cp,
 
 #ifndef PRODUCT
   if (PrintFieldLayout) {
-    print_field_layout(_class_name,
+    print_field_layout(tty,
+          _class_name,
           _fields,
           cp,
           instance_size,
@@ -4429,8 +4432,21 @@ void ClassFileParser::layout_fields(ConstantPool* cp,
           nonstatic_fields_end,
           static_fields_end);
   }
-
 #endif
+
+  LogTarget(Debug, class, fieldlayout) lt;
+  if (lt.is_enabled()) {
+    ResourceMark rm;
+    LogStream ls(lt);
+    print_field_layout(&ls,
+          _class_name,
+          _fields,
+          cp,
+          instance_size,
+          nonstatic_fields_start,
+          nonstatic_fields_end,
+          static_fields_end);
+  }
   // Pass back information needed for InstanceKlass creation
   info->nonstatic_oop_offsets = nonstatic_oop_offsets;
   info->nonstatic_oop_counts = nonstatic_oop_counts;
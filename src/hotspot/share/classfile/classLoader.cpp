@@ -84,6 +84,7 @@ typedef jboolean (*ReadEntry_t)(jzfile *zip, jzentry *entry, unsigned char *buf,
 typedef jzentry* (*GetNextEntry_t)(jzfile *zip, jint n);
 typedef jboolean (*ZipInflateFully_t)(void *inBuf, jlong inLen, void *outBuf, jlong outLen, char **pmsg);
 typedef jint     (*Crc32_t)(jint crc, const jbyte *buf, jint len);
+typedef jlong    (*ZipGZipFully_t)(void *inBuf, jlong inLen, void *outBuf, jlong outLen, jint level, char **pmsg);
 
 static ZipOpen_t         ZipOpen            = NULL;
 static ZipClose_t        ZipClose           = NULL;
@@ -93,6 +94,7 @@ static GetNextEntry_t    GetNextEntry       = NULL;
 static canonicalize_fn_t CanonicalizeEntry  = NULL;
 static ZipInflateFully_t ZipInflateFully    = NULL;
 static Crc32_t           Crc32              = NULL;
+static ZipGZipFully_t    ZipGZipFully       = NULL;
 
 // Entry points for jimage.dll for loading jimage file entries
 
@@ -1169,6 +1171,8 @@ void ClassLoader::load_zip_library() {
   GetNextEntry = CAST_TO_FN_PTR(GetNextEntry_t, os::dll_lookup(handle, "ZIP_GetNextEntry"));
   ZipInflateFully = CAST_TO_FN_PTR(ZipInflateFully_t, os::dll_lookup(handle, "ZIP_InflateFully"));
   Crc32        = CAST_TO_FN_PTR(Crc32_t, os::dll_lookup(handle, "ZIP_CRC32"));
+  // ZIP_GZip_Fully is only used for compressed heap dumps, so don't abort if it is missing
+  ZipGZipFully = CAST_TO_FN_PTR(ZipGZipFully_t, os::dll_lookup(handle, "ZIP_GZip_Fully"));
 
   // ZIP_Close is not exported on Windows in JDK5.0 so don't abort if ZIP_Close is NULL
   if (ZipOpen == NULL || FindEntry == NULL || ReadEntry == NULL ||
@@ -1221,6 +1225,15 @@ jboolean ClassLoader::decompress(void *in, u8 inSize, void *out, u8 outSize, cha
   return (*ZipInflateFully)(in, inSize, out, outSize, pmsg);
 }
 
+bool ClassLoader::has_gzip() {
+  return ZipGZipFully != NULL;
+}
+
+u8 ClassLoader::gzip(void *in, u8 inSize, void *out, u8 outSize, int level, char **pmsg) {
+  assert(ZipGZipFully != NULL, "ZIP_GZip_Fully is not found");
+  return (u8)(*ZipGZipFully)(in, inSize, out, outSize, level, pmsg);
+}
+
 int ClassLoader::crc32(int crc, const char* buf, int len) {
   assert(Crc32 != NULL, "ZIP_CRC32 is not found");
   return (*Crc32)(crc, (const jbyte*)buf, len);
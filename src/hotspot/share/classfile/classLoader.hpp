@@ -292,6 +292,8 @@ class ClassLoader: AllStatic {
  public:
   static jboolean decompress(void *in, u8 inSize, void *out, u8 outSize, char **pmsg);
   static int crc32(int crc, const char* buf, int len);
+  static bool has_gzip();
+  static u8 gzip(void *in, u8 inSize, void *out, u8 outSize, int level, char **pmsg);
   static bool update_class_path_entry_list(const char *path,
                                            bool check_for_duplicates,
                                            bool is_boot_append,
@@ -169,7 +169,9 @@ ClassLoaderData::ClassLoaderData(Handle h_class_loader, bool is_anonymous) :
     // A ClassLoaderData created solely for an anonymous class should never have a
     // ModuleEntryTable or PackageEntryTable created for it. The defining package
     // and module for an anonymous class will be found in its host class.
-    _packages = new PackageEntryTable(PackageEntryTable::_packagetable_entry_size);
+    _packages = new PackageEntryTable(h_class_loader.is_null() ?
+                                      PackageEntryTable::_packagetable_boot_entry_size :
+                                      PackageEntryTable::_packagetable_entry_size);
     if (h_class_loader.is_null()) {
       // Create unnamed module for boot loader
       _unnamed_module = ModuleEntry::create_boot_unnamed_module(this);
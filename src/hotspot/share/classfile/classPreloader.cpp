@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "jvm.h"
+#include "classfile/classPreloader.hpp"
+#include "classfile/javaClasses.hpp"
+#include "classfile/symbolTable.hpp"
+#include "classfile/systemDictionary.hpp"
+#include "classfile/vmSymbols.hpp"
+#include "logging/log.hpp"
+#include "memory/resourceArea.hpp"
+#include "memory/universe.hpp"
+#include "oops/instanceKlass.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/handles.inline.hpp"
+#include "runtime/java.hpp"
+#include "runtime/javaCalls.hpp"
+#include "runtime/mutexLocker.hpp"
+#include "runtime/os.hpp"
+#include "runtime/thread.inline.hpp"
+#include "runtime/timer.hpp"
+#include "utilities/growableArray.hpp"
+
+// The class names are read before the workers are started and never
+// change afterwards; workers claim them through _next_index. The last
+// worker to finish frees them.
+static GrowableArray<char*>* _class_names = NULL;
+static volatile int _next_index   = 0;
+static volatile int _live_workers = 0;
+static volatile int _loaded_count = 0;
+static volatile int _failed_count = 0;
+static jlong        _start_counter = 0;
+
+class ClassPreloaderThread : public JavaThread {
+ public:
+  ClassPreloaderThread(ThreadFunction entry_point) : JavaThread(entry_point) {}
+
+  // Hide this thread from external view.
+  bool is_hidden_from_external_view() const      { return true; }
+};
+
+static bool preload_class(const char* name, TRAPS) {
+  HandleMark hm(THREAD);
+  TempNewSymbol class_name = SymbolTable::new_symbol(name, THREAD);
+  if (HAS_PENDING_EXCEPTION) {
+    CLEAR_PENDING_EXCEPTION;
+    return false;
+  }
+
+  Klass* k = SystemDictionary::resolve_or_null(class_name, THREAD);
+  if (k == NULL && !HAS_PENDING_EXCEPTION) {
+    Handle loader(THREAD, SystemDictionary::java_platform_loader());
+    k = SystemDictionary::resolve_or_null(class_name, loader, Handle(), THREAD);
+  }
+  if (HAS_PENDING_EXCEPTION || k == NULL) {
+    CLEAR_PENDING_EXCEPTION;
+    return false;
+  }
+
+  if (k->is_instance_klass()) {
+    // Linking verifies the class. Failures are reported again, with the
+    // proper exception, when the application links the class itself.
+    InstanceKlass::cast(k)->link_class(THREAD);
+    if (HAS_PENDING_EXCEPTION) {
+      CLEAR_PENDING_EXCEPTION;
+      return false;
+    }
+  }
+  return true;
+}
+
+// Called once by every worker, started or not, when it has no more
+// work. The last one reports and frees the class names.
+static void worker_done() {
+  if (Atomic::sub(1, &_live_workers) == 0) {
+    log_info(class, preload)("Preloaded %d classes (%d failed) in %.3f ms",
+                             _loaded_count, _failed_count,
+                             TimeHelper::counter_to_millis(os::elapsed_counter() - _start_counter));
+    for (int i = 0; i < _class_names->length(); i++) {
+      os::free(_class_names->at(i));
+    }
+    delete _class_names;
+    _class_names = NULL;
+  }
+}
+
+static void preloader_thread_entry(JavaThread* thread, TRAPS) {
+  const int length = _class_names->length();
+  int index;
+  while ((index = Atomic::add(1, &_next_index) - 1) < length) {
+    ResourceMark rm(THREAD);
+    const char* name = _class_names->at(index);
+    jlong start = os::elapsed_counter();
+    bool loaded = preload_class(name, THREAD);
+    Atomic::inc(loaded ? &_loaded_count : &_failed_count);
+    log_debug(class, preload)("%s %s in %.3f ms", loaded ? "Loaded" : "Failed to load", name,
+                              TimeHelper::counter_to_millis(os::elapsed_counter() - start));
+  }
+  worker_done();
+}
+
+static void read_class_list(const char* file) {
+  FILE* stream = fopen(file, "rt");
+  if (stream == NULL) {
+    warning("Cannot open class preload list %s", file);
+    return;
+  }
+  _class_names = new (ResourceObj::C_HEAP, mtClass) GrowableArray<char*>(1024, true, mtClass);
+  char line[1024];
+  char name[1024];
+  while (fgets(line, sizeof(line), stream) != NULL) {
+    if (line[0] == '#' || line[0] == '@' ||
+        strstr(line, " source:") != NULL ||
+        sscanf(line, "%1023s", name) != 1) {
+      continue;
+    }
+    _class_names->append(os::strdup_check_oom(name, mtClass));
+  }
+  fclose(stream);
+}
+
+static void start_worker(int index, TRAPS) {
+  char name[64];
+  jio_snprintf(name, sizeof(name), "Class Preloader %d", index);
+  Handle string = java_lang_String::create_from_str(name, CHECK);
+
+  // Initialize thread_oop to put it into the system threadGroup
+  Handle thread_group (THREAD, Universe::system_thread_group());
+  Handle thread_oop = JavaCalls::construct_new_instance(
+                          SystemDictionary::Thread_klass(),
+                          vmSymbols::threadgroup_string_void_signature(),
+                          thread_group,
+                          string,
+                          CHECK);
+
+  ClassPreloaderThread* thread = NULL;
+  {
+    MutexLocker mu(Threads_lock);
+    thread = new ClassPreloaderThread(&preloader_thread_entry);
+    if (thread != NULL && thread->osthread() != NULL) {
+      java_lang_Thread::set_thread(thread_oop(), thread);
+      java_lang_Thread::set_priority(thread_oop(), NormPriority);
+      java_lang_Thread::set_daemon(thread_oop());
+      thread->set_threadObj(thread_oop());
+
+      Threads::add(thread);
+      Thread::start(thread);
+      return;
+    }
+  }
+
+  // Unlike the service threads these are optional; the other workers,
+  // or the application itself, will load the classes.
+  log_warning(class, preload)("Failed to start class preloader thread: %s",
+                              os::native_thread_creation_failed_msg());
+  if (thread != NULL) {
+    thread->smr_delete();
+  }
+  worker_done();
+}
+
+void ClassPreloader::start(const char* file, TRAPS) {
+  read_class_list(file);
+  if (_class_names == NULL) {
+    return;
+  }
+  if (_class_names->is_empty()) {
+    delete _class_names;
+    _class_names = NULL;
+    return;
+  }
+
+  const int workers = (int)MIN2(ClassPreloadThreads, (uintx)_class_names->length());
+  log_info(class, preload)("Preloading %d classes from %s with %d threads",
+                           _class_names->length(), file, workers);
+  _start_counter = os::elapsed_counter();
+  // Count all workers as live up front so that an early finisher does
+  // not free the list while others are still being started.
+  _live_workers = workers;
+  for (int i = 0; i < workers; i++) {
+    start_worker(i, THREAD);
+    if (HAS_PENDING_EXCEPTION) {
+      // Could not create the java.lang.Thread; give up on this and the
+      // remaining workers.
+      CLEAR_PENDING_EXCEPTION;
+      for (int j = i; j < workers; j++) {
+        worker_done();
+      }
+      return;
+    }
+  }
+}
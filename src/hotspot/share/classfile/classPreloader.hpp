@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_VM_CLASSFILE_CLASSPRELOADER_HPP
+#define SHARE_VM_CLASSFILE_CLASSPRELOADER_HPP
+
+#include "memory/allocation.hpp"
+#include "utilities/exceptions.hpp"
+
+// Loads and links the classes named in a class list (ClassPreloadList)
+// on ClassPreloadThreads background threads while the application
+// starts up, so that most classes are already loaded and verified when
+// the application first uses them.
+//
+// The file uses the format written by -XX:DumpLoadedClassList: one
+// class name per line in internal form, optionally followed by
+// attributes. Lines starting with '#' and classes from unregistered
+// loaders ("source:" attribute) are ignored. Each class is looked up in
+// the boot loader first and then in the platform loader; classes that
+// are not found are skipped. Per-class load times are logged with
+// -Xlog:class+preload=debug.
+class ClassPreloader : AllStatic {
+ public:
+  // Read the class list and start the worker threads. Must be called
+  // once the platform class loader has been computed.
+  static void start(const char* file, TRAPS);
+};
+
+#endif // SHARE_VM_CLASSFILE_CLASSPRELOADER_HPP
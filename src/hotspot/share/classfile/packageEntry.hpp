@@ -222,7 +222,8 @@ class PackageEntryTable : public Hashtable<Symbol*, mtModule> {
   friend class VMStructs;
 public:
   enum Constants {
-    _packagetable_entry_size = 109  // number of entries in package entry table
+    _packagetable_entry_size      = 109, // number of entries in package entry table
+    _packagetable_boot_entry_size = 1009 // boot loader defines the packages of most JDK modules
   };
 
 private:
@@ -310,8 +310,19 @@ oop StringTable::intern(const char* utf8_string, TRAPS) {
 }
 
 oop StringTable::intern(Handle string_or_null_h, jchar* name, int len, TRAPS) {
-  // shared table always uses java_lang_String::hash_code
-  unsigned int hash = java_lang_String::hash_code(name, len);
+  // shared table always uses java_lang_String::hash_code, which is the
+  // value String.hashCode() caches in the String.hash field. Reuse it if
+  // already computed, and cache it otherwise.
+  unsigned int hash = 0;
+  if (!string_or_null_h.is_null()) {
+    hash = java_lang_String::hash(string_or_null_h());
+  }
+  if (hash == 0) {
+    hash = java_lang_String::hash_code(name, len);
+    if (!string_or_null_h.is_null() && hash != 0) {
+      java_lang_String::set_hash(string_or_null_h(), hash);
+    }
+  }
   oop found_string = StringTable::the_table()->lookup_shared(name, len, hash);
   if (found_string != NULL) {
     return found_string;
@@ -360,6 +371,9 @@ oop StringTable::do_intern(Handle string_or_null_h, jchar* name,
     string_h = string_or_null_h;
   } else {
     string_h = java_lang_String::create_from_unicode(name, len, CHECK_NULL);
+    if (!_alt_hash) {
+      java_lang_String::set_hash(string_h(), (unsigned int)hash);
+    }
   }
 
   // Deduplicate the string before it is interned. Note that we should never
@@ -310,11 +310,13 @@ Symbol* SymbolTable::lookup(const char* name, int len, TRAPS) {
   // Found
   if (s != NULL) return s;
 
+  Symbol* preallocated = preallocate_symbol(name, len, CHECK_NULL);
+
   // Grab SymbolTable_lock first.
   MutexLocker ml(SymbolTable_lock, THREAD);
 
   // Otherwise, add to symbol to table
-  return the_table()->basic_add(index, (u1*)name, len, hashValue, true, THREAD);
+  return the_table()->basic_add(index, (u1*)name, len, hashValue, true, preallocated, THREAD);
 }
 
 Symbol* SymbolTable::lookup(const Symbol* sym, int begin, int end, TRAPS) {
@@ -350,10 +352,22 @@ Symbol* SymbolTable::lookup(const Symbol* sym, int begin, int end, TRAPS) {
   // We can't include the code in NoSafepointVerifier because of the
   // ResourceMark.
 
+  Symbol* preallocated = preallocate_symbol(buffer, len, CHECK_NULL);
+
   // Grab SymbolTable_lock first.
   MutexLocker ml(SymbolTable_lock, THREAD);
 
-  return the_table()->basic_add(index, (u1*)buffer, len, hashValue, true, THREAD);
+  return the_table()->basic_add(index, (u1*)buffer, len, hashValue, true, preallocated, THREAD);
+}
+
+// Allocate a C heap symbol before taking SymbolTable_lock, so that parallel
+// class loading does not serialize on malloc. Arena symbols (used when
+// dumping the archive) are allocated under the lock that guards the arena.
+Symbol* SymbolTable::preallocate_symbol(const char* name, int len, TRAPS) {
+  if (DumpSharedSpaces || len > Symbol::max_length()) {
+    return NULL;
+  }
+  return the_table()->allocate_symbol((const u1*)name, len, true, THREAD);
 }
 
 Symbol* SymbolTable::lookup_only(const char* name, int len,
@@ -432,7 +446,7 @@ void SymbolTable::add(ClassLoaderData* loader_data, const constantPoolHandle& cp
     for (int i=0; i<names_count; i++) {
       int index = table->hash_to_index(hashValues[i]);
       bool c_heap = !loader_data->is_the_null_class_loader_data();
-      Symbol* sym = table->basic_add(index, (u1*)names[i], lengths[i], hashValues[i], c_heap, CHECK);
+      Symbol* sym = table->basic_add(index, (u1*)names[i], lengths[i], hashValues[i], c_heap, NULL, CHECK);
       cp->symbol_at_put(cp_indices[i], sym);
     }
   }
@@ -449,11 +463,12 @@ Symbol* SymbolTable::new_permanent_symbol(const char* name, TRAPS) {
 
   SymbolTable* table = the_table();
   int index = table->hash_to_index(hash);
-  return table->basic_add(index, (u1*)name, (int)strlen(name), hash, false, THREAD);
+  return table->basic_add(index, (u1*)name, (int)strlen(name), hash, false, NULL, THREAD);
 }
 
 Symbol* SymbolTable::basic_add(int index_arg, u1 *name, int len,
-                               unsigned int hashValue_arg, bool c_heap, TRAPS) {
+                               unsigned int hashValue_arg, bool c_heap,
+                               Symbol* preallocated, TRAPS) {
   assert(!Universe::heap()->is_in_reserved(name),
          "proposed name of symbol must be stable");
 
@@ -484,11 +499,15 @@ Symbol* SymbolTable::basic_add(int index_arg, u1 *name, int len,
   if (test != NULL) {
     // A race occurred and another thread introduced the symbol.
     assert(test->refcount() != 0, "lookup should have incremented the count");
+    if (preallocated != NULL) {
+      preallocated->decrement_refcount();
+      delete preallocated;
+    }
     return test;
   }
 
   // Create a new symbol.
-  Symbol* sym = allocate_symbol(name, len, c_heap, CHECK_NULL);
+  Symbol* sym = preallocated != NULL ? preallocated : allocate_symbol(name, len, c_heap, CHECK_NULL);
   assert(sym->equals((char*)name, len), "symbol must be properly initialized");
 
   HashtableEntry<Symbol*, mtSymbol>* entry = new_entry(hashValue, sym);
@@ -121,7 +121,8 @@ private:
 
   // Adding elements
   Symbol* basic_add(int index, u1* name, int len, unsigned int hashValue,
-                    bool c_heap, TRAPS);
+                    bool c_heap, Symbol* preallocated, TRAPS);
+  static Symbol* preallocate_symbol(const char* name, int len, TRAPS);
   bool basic_add(ClassLoaderData* loader_data,
                  const constantPoolHandle& cp, int names_count,
                  const char** names, int* lengths, int* cp_indices,
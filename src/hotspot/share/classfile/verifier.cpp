@@ -25,6 +25,7 @@
 #include "precompiled.hpp"
 #include "jvm.h"
 #include "classfile/classFileStream.hpp"
+#include "classfile/classLoaderData.hpp"
 #include "classfile/javaClasses.hpp"
 #include "classfile/stackMapTable.hpp"
 #include "classfile/stackMapFrame.hpp"
@@ -51,6 +52,7 @@
 #include "runtime/os.hpp"
 #include "runtime/safepointVerifiers.hpp"
 #include "runtime/thread.hpp"
+#include "runtime/timer.hpp"
 #include "services/threadService.hpp"
 #include "utilities/align.hpp"
 #include "utilities/bytes.hpp"
@@ -175,6 +177,7 @@ bool Verifier::verify(InstanceKlass* klass, Verifier::Mode mode, bool should_ver
      klass->major_version() < NOFAILOVER_MAJOR_VERSION;
 
   log_info(class, init)("Start class verification for: %s", klassName);
+  const jlong start_ticks = log_is_enabled(Debug, verification) ? os::elapsed_counter() : 0;
   if (klass->major_version() >= STACKMAP_ATTRIBUTE_MAJOR_VERSION) {
     ClassVerifier split_verifier(klass, THREAD);
     split_verifier.verify_class(THREAD);
@@ -195,6 +198,15 @@ bool Verifier::verify(InstanceKlass* klass, Verifier::Mode mode, bool should_ver
         klass, message_buffer, message_buffer_len, THREAD);
   }
 
+  if (start_ticks != 0) {
+    // Classes that show up here at run time are not covered by a CDS
+    // archive; archived classes were verified at dump time and only have
+    // their verification constraints checked when they are loaded.
+    log_debug(verification)("Verification of %s (%s) took %.3f ms", klassName,
+                            klass->class_loader_data()->loader_name(),
+                            TimeHelper::counter_to_millis(os::elapsed_counter() - start_ticks));
+  }
+
   LogTarget(Info, class, init) lt1;
   if (lt1.is_enabled()) {
     LogStream ls(lt1);
@@ -52,6 +52,7 @@
 #include "runtime/mutexLocker.hpp"
 #include "runtime/safepointVerifiers.hpp"
 #include "runtime/sweeper.hpp"
+#include "runtime/timerTrace.hpp"
 #include "runtime/vmThread.hpp"
 #include "services/memoryService.hpp"
 #include "utilities/align.hpp"
@@ -624,6 +625,11 @@ bool CodeCache::contains(nmethod *nm) {
 // This method is safe to call without holding the CodeCache_lock, as long as a dead CodeBlob is not
 // looked up (i.e., one that has been marked for deletion). It only depends on the _segmap to contain
 // valid indices, which it will always do, as long as the CodeBlob is not in the process of being recycled.
+bool CodeCache::has_free_block_below(const CodeBlob* cb) {
+  assert_locked_or_safepoint(CodeCache_lock);
+  return get_code_heap(cb)->has_free_block_below(cb, cb->size());
+}
+
 CodeBlob* CodeCache::find_blob(void* start) {
   CodeBlob* result = find_blob_unsafe(start);
   // We could potentially look up non_entrant methods
@@ -1103,6 +1109,7 @@ void CodeCache::initialize() {
 }
 
 void codeCache_init() {
+  TraceTime timer("Initialize code cache", TRACETIME_LOG(Info, startuptime));
   CodeCache::initialize();
   // Load AOT libraries and add AOT code heaps.
   AOTLoader::initialize();
@@ -1682,8 +1689,12 @@ void CodeCache::log_state(outputStream* st) {
 
 //---<  BEGIN  >--- CodeHeap State Analytics.
 
+// The CodeCache_lock is acquired separately for each code heap. Compiler
+// threads waiting to install code get a chance to proceed between heaps
+// instead of being stalled for the whole multi-heap analysis.
 void CodeCache::aggregate(outputStream *out, size_t granularity) {
   FOR_ALL_ALLOCABLE_HEAPS(heap) {
+    MutexLockerEx mu(CodeCache_lock, Mutex::_no_safepoint_check_flag);
     CodeHeapState::aggregate(out, (*heap), granularity);
   }
 }
@@ -31,10 +31,12 @@
 #include "gc/shared/collectedHeap.inline.hpp"
 #include "interpreter/interpreter.hpp"
 #include "interpreter/linkResolver.hpp"
+#include "logging/log.hpp"
 #include "memory/resourceArea.hpp"
 #include "memory/universe.hpp"
 #include "oops/method.hpp"
 #include "oops/oop.inline.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/handles.inline.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "runtime/stubRoutines.hpp"
@@ -46,6 +48,7 @@ ICStub*    InlineCacheBuffer::_next_stub = NULL;
 
 CompiledICHolder* InlineCacheBuffer::_pending_released = NULL;
 int InlineCacheBuffer::_pending_count = 0;
+volatile size_t InlineCacheBuffer::_buffer_full_count = 0;
 
 void ICStub::finalize() {
   if (!is_empty()) {
@@ -111,7 +114,7 @@ void InlineCacheBuffer::init_next_stub() {
 
 void InlineCacheBuffer::initialize() {
   if (_buffer != NULL) return; // already initialized
-  _buffer = new StubQueue(new ICStubInterface, 10*K, InlineCacheBuffer_lock, "InlineCacheBuffer");
+  _buffer = new StubQueue(new ICStubInterface, (int)InlineCacheBufferSize, InlineCacheBuffer_lock, "InlineCacheBuffer");
   assert (_buffer != NULL, "cannot allocate InlineCacheBuffer");
   init_next_stub();
 }
@@ -127,6 +130,8 @@ ICStub* InlineCacheBuffer::new_ic_stub() {
     // We do this by forcing a safepoint
     EXCEPTION_MARK;
 
+    size_t count = Atomic::add((size_t)1, &_buffer_full_count);
+    log_debug(safepoint)("Inline cache buffer full, requesting safepoint (" SIZE_FORMAT " so far)", count);
     VM_ICBufferFull ibf;
     VMThread::execute(&ibf);
     // We could potential get an async. exception at this point.
@@ -105,6 +105,8 @@ class InlineCacheBuffer: public AllStatic {
   static CompiledICHolder* _pending_released;
   static int _pending_count;
 
+  static volatile size_t _buffer_full_count;    // safepoints forced by a full buffer
+
   static StubQueue* buffer()                         { return _buffer;         }
   static void       set_next_stub(ICStub* next_stub) { _next_stub = next_stub; }
   static ICStub*    get_next_stub()                  { return _next_stub;      }
@@ -137,6 +139,9 @@ class InlineCacheBuffer: public AllStatic {
   static void queue_for_release(CompiledICHolder* icholder);
   static int pending_icholder_count() { return _pending_count; }
 
+  // Number of safepoints requested because the buffer ran out of stubs
+  static size_t buffer_full_count() { return _buffer_full_count; }
+
   // New interface
   static void    create_transition_stub(CompiledIC *ic, void* cached_value, address entry);
   static address ic_destination_for(CompiledIC *ic);
@@ -1802,10 +1802,9 @@ PcDesc* PcDescContainer::find_pc_desc_internal(address pc, bool approximate, con
     return res;
   }
 
-  // Fallback algorithm: quasi-linear search for the PcDesc
+  // Fallback algorithm: binary search for the PcDesc
   // Find the last pc_offset less than the given offset.
   // The successor must be the required match, if there is a match at all.
-  // (Use a fixed radix to avoid expensive affine pointer arithmetic.)
   PcDesc* lower = search.scopes_pcs_begin();
   PcDesc* upper = search.scopes_pcs_end();
   upper -= 1; // exclude final sentinel
@@ -1826,35 +1825,20 @@ PcDesc* PcDescContainer::find_pc_desc_internal(address pc, bool approximate, con
     upper = mid;
   }
 
-  // Take giant steps at first (4096, then 256, then 16, then 1)
-  const int LOG2_RADIX = 4 /*smaller steps in debug mode:*/ debug_only(-1);
-  const int RADIX = (1 << LOG2_RADIX);
-  for (int step = (1 << (LOG2_RADIX*3)); step > 1; step >>= LOG2_RADIX) {
-    while ((mid = lower + step) < upper) {
-      assert_LU_OK;
-      NOT_PRODUCT(++pc_nmethod_stats.pc_desc_searches);
-      if (mid->pc_offset() < pc_offset) {
-        lower = mid;
-      } else {
-        upper = mid;
-        break;
-      }
-    }
+  // Binary search for the successor of the last pc_offset less than the
+  // given offset. Large nmethods have thousands of PcDescs, and stack walks
+  // from profilers and exception dispatch mostly miss the small cache.
+  while (upper - lower > 1) {
     assert_LU_OK;
-  }
-
-  // Sneak up on the value with a linear search of length ~16.
-  while (true) {
-    assert_LU_OK;
-    mid = lower + 1;
+    mid = lower + (upper - lower) / 2;
     NOT_PRODUCT(++pc_nmethod_stats.pc_desc_searches);
     if (mid->pc_offset() < pc_offset) {
       lower = mid;
     } else {
       upper = mid;
-      break;
     }
   }
+  assert_LU_OK;
 #undef assert_LU_OK
 
   if (match_desc(upper, pc_offset, approximate)) {
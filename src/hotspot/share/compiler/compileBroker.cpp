@@ -32,6 +32,7 @@
 #include "code/dependencyContext.hpp"
 #include "compiler/compileBroker.hpp"
 #include "compiler/compileLog.hpp"
+#include "compiler/compileWarmup.hpp"
 #include "compiler/compilerOracle.hpp"
 #include "compiler/directivesParser.hpp"
 #include "interpreter/linkResolver.hpp"
@@ -56,6 +57,7 @@
 #include "runtime/safepointVerifiers.hpp"
 #include "runtime/sharedRuntime.hpp"
 #include "runtime/sweeper.hpp"
+#include "runtime/timer.hpp"
 #include "runtime/timerTrace.hpp"
 #include "runtime/vframe.inline.hpp"
 #include "utilities/debug.hpp"
@@ -416,6 +418,21 @@ void CompileQueue::free_all() {
   MethodCompileQueue_lock->notify_all();
 }
 
+static void post_compilation_queueing_event(CompileTask* task, bool dropped) {
+  EventCompilationQueueing event;
+  if (event.should_commit()) {
+    if (!task->is_unloaded()) {
+      event.set_method(task->method());
+    }
+    event.set_compileId(task->compile_id());
+    event.set_compileLevel(task->comp_level());
+    event.set_isOsr(task->osr_bci() != CompileBroker::standard_entry_bci);
+    event.set_queueTime((jlong)TimeHelper::counter_to_millis(os::elapsed_counter() - task->time_queued()));
+    event.set_dropped(dropped);
+    event.commit();
+  }
+}
+
 /**
  * Get the next CompileTask from a CompileQueue
  */
@@ -473,6 +490,7 @@ CompileTask* CompileQueue::get() {
     save_method = methodHandle(task->method());
     save_hot_method = methodHandle(task->hot_method());
 
+    post_compilation_queueing_event(task, false);
     remove(task);
   }
   purge_stale_tasks(); // may temporarily release MCQ lock
@@ -524,6 +542,7 @@ void CompileQueue::remove(CompileTask* task) {
 
 void CompileQueue::remove_and_mark_stale(CompileTask* task) {
   assert(MethodCompileQueue_lock->owned_by_self(), "must own lock");
+  post_compilation_queueing_event(task, true);
   remove(task);
 
   // Enqueue the task for reclamation (should be done outside MCQ lock)
@@ -607,6 +626,9 @@ void CompileBroker::compilation_init_phase1(TRAPS) {
   if (!UseCompiler) {
     return;
   }
+  if (CompileWarmupFile != NULL) {
+    CompileWarmup::load(CompileWarmupFile, CHECK);
+  }
   // Set the interface to the current compiler(s).
   _c1_count = CompilationPolicy::policy()->compiler_count(CompLevel_simple);
   _c2_count = CompilationPolicy::policy()->compiler_count(CompLevel_full_optimization);
@@ -928,6 +950,10 @@ void CompileBroker::possibly_add_compiler_threads() {
   EXCEPTION_MARK;
 
   julong available_memory = os::available_memory();
+  // The number of processors may change at runtime, e.g. when the CPU quota
+  // of the container is adjusted. Don't start more threads per compiler
+  // than there are processors to run them.
+  int available_cpus = MAX2(1, os::active_processor_count());
   // If SegmentedCodeCache is off, both values refer to the single heap (with type CodeBlobType::All).
   size_t available_cc_np  = CodeCache::unallocated_capacity(CodeBlobType::MethodNonProfiled),
          available_cc_p   = CodeCache::unallocated_capacity(CodeBlobType::MethodProfiled);
@@ -937,10 +963,11 @@ void CompileBroker::possibly_add_compiler_threads() {
 
   if (_c2_compile_queue != NULL) {
     int old_c2_count = _compilers[1]->num_compiler_threads();
-    int new_c2_count = MIN4(_c2_count,
+    int new_c2_count = MIN2(MIN4(_c2_count,
         _c2_compile_queue->size() / 2,
         (int)(available_memory / (200*M)),
-        (int)(available_cc_np / (128*K)));
+        (int)(available_cc_np / (128*K))),
+        available_cpus);
 
     for (int i = old_c2_count; i < new_c2_count; i++) {
 #if INCLUDE_JVMCI
@@ -990,10 +1017,11 @@ void CompileBroker::possibly_add_compiler_threads() {
 
   if (_c1_compile_queue != NULL) {
     int old_c1_count = _compilers[0]->num_compiler_threads();
-    int new_c1_count = MIN4(_c1_count,
+    int new_c1_count = MIN2(MIN4(_c1_count,
         _c1_compile_queue->size() / 4,
         (int)(available_memory / (100*M)),
-        (int)(available_cc_p / (128*K)));
+        (int)(available_cc_p / (128*K))),
+        available_cpus);
 
     for (int i = old_c1_count; i < new_c1_count; i++) {
       JavaThread *ct = make_thread(compiler1_object(i), _c1_compile_queue, _compilers[0], CHECK);
@@ -2234,6 +2262,7 @@ void CompileBroker::invoke_compiler_on_method(CompileTask* task) {
   DTRACE_METHOD_COMPILE_END_PROBE(method, compiler_name(task_level), task->is_success());
 
   collect_statistics(thread, time, task);
+  thread->chunk_cache()->end_compilation();
 
   nmethod* nm = task->code();
   if (nm != NULL) {
@@ -2691,6 +2720,8 @@ void CompileBroker::print_times(bool per_compiler, bool aggregate) {
   tty->cr();
   tty->print_cr("  nmethod code size         : %8d bytes", nmethods_code_size);
   tty->print_cr("  nmethod total size        : %8d bytes", nmethods_size);
+  tty->print_cr("  Peak compilation arenas   : " SIZE_FORMAT_W(8) " bytes",
+                ChunkCache::max_compilation_bytes());
 }
 
 // Debugging output for failure
@@ -2790,16 +2821,12 @@ void CompileBroker::print_heapinfo(outputStream* out, const char* function, size
     // concurrent aggregate steps. Acquire this lock before acquiring the CodeCache_lock.
     // CodeHeapStateAnalytics_lock could be held by a concurrent thread for a long time,
     // leading to an unnecessarily long hold time of the CodeCache_lock.
-    ts.update(); // record starting point
-    MutexLockerEx mu2(CodeCache_lock, Mutex::_no_safepoint_check_flag);
-    out->cr();
-    out->print_cr("__ CodeCache lock wait took %10.3f seconds _________", ts.seconds());
-    out->cr();
-
+    // CodeCache::aggregate() acquires the CodeCache_lock once per code heap,
+    // so the lock is released between heaps.
     ts.update(); // record starting point
     CodeCache::aggregate(out, granularity);
     out->cr();
-    out->print_cr("__ CodeCache lock hold took %10.3f seconds _________", ts.seconds());
+    out->print_cr("__ CodeCache aggregation took %10.3f seconds _________", ts.seconds());
     out->cr();
   }
 
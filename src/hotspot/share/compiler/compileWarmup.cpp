@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "classfile/classLoaderData.hpp"
+#include "classfile/symbolTable.hpp"
+#include "compiler/compileWarmup.hpp"
+#include "compiler/compilerDefinitions.hpp"
+#include "logging/log.hpp"
+#include "memory/iterator.hpp"
+#include "memory/resourceArea.hpp"
+#include "oops/instanceKlass.hpp"
+#include "oops/method.hpp"
+#include "oops/symbol.hpp"
+#include "runtime/handles.inline.hpp"
+#include "utilities/ostream.hpp"
+#include "utilities/resourceHash.hpp"
+
+class CompileWarmupKey {
+ public:
+  const Symbol* _holder;
+  const Symbol* _name;
+  const Symbol* _signature;
+
+  CompileWarmupKey(const Symbol* holder, const Symbol* name, const Symbol* signature) :
+    _holder(holder), _name(name), _signature(signature) {}
+
+  static unsigned hash(const CompileWarmupKey& k) {
+    return k._holder->identity_hash() ^ (k._name->identity_hash() * 31) ^ (k._signature->identity_hash() * 961);
+  }
+
+  static bool equals(const CompileWarmupKey& k0, const CompileWarmupKey& k1) {
+    return k0._holder == k1._holder && k0._name == k1._name && k0._signature == k1._signature;
+  }
+};
+
+typedef ResourceHashtable<CompileWarmupKey, int,
+                          CompileWarmupKey::hash, CompileWarmupKey::equals,
+                          1031, ResourceObj::C_HEAP, mtCompiler> CompileWarmupTable;
+
+// Maps methods to the highest level they were compiled at in the recorded run
+static CompileWarmupTable* _warmup_table = NULL;
+
+void CompileWarmup::load(const char* file, TRAPS) {
+  FILE* stream = fopen(file, "rt");
+  if (stream == NULL) {
+    warning("Cannot open compile warmup file %s", file);
+    return;
+  }
+  CompileWarmupTable* table = new (ResourceObj::C_HEAP, mtCompiler) CompileWarmupTable();
+  char line[1024];
+  char holder[1024];
+  char name[1024];
+  char signature[1024];
+  int count = 0;
+  while (fgets(line, sizeof(line), stream) != NULL) {
+    int level;
+    if (line[0] == '#' ||
+        sscanf(line, "%d %1023s %1023s %1023s", &level, holder, name, signature) != 4) {
+      continue;
+    }
+    // The symbols are kept alive by the table for the lifetime of the VM
+    Symbol* h = SymbolTable::new_permanent_symbol(holder, CHECK);
+    Symbol* n = SymbolTable::new_permanent_symbol(name, CHECK);
+    Symbol* s = SymbolTable::new_permanent_symbol(signature, CHECK);
+    table->put(CompileWarmupKey(h, n, s), level);
+    count++;
+  }
+  fclose(stream);
+  _warmup_table = table;
+  log_info(jit, compilation)("Read %d methods from compile warmup file %s", count, file);
+}
+
+bool CompileWarmup::is_hot(const Method* method) {
+  if (_warmup_table == NULL) {
+    return false;
+  }
+  CompileWarmupKey key(method->method_holder()->name(), method->name(), method->signature());
+  int* level = _warmup_table->get(key);
+  return level != NULL && *level >= CompLevel_full_profile;
+}
+
+class CompileWarmupDumpClosure : public KlassClosure {
+ private:
+  outputStream* _out;
+  int           _count;
+
+ public:
+  CompileWarmupDumpClosure(outputStream* out) : _out(out), _count(0) {}
+
+  void do_klass(Klass* k) {
+    if (!k->is_instance_klass()) {
+      return;
+    }
+    Array<Method*>* methods = InstanceKlass::cast(k)->methods();
+    for (int i = 0; i < methods->length(); i++) {
+      Method* m = methods->at(i);
+      int level = m->highest_comp_level();
+      if (level >= CompLevel_full_profile && !m->is_native()) {
+        ResourceMark rm;
+        _out->print_cr("%d %s %s %s", level,
+                       k->name()->as_C_string(),
+                       m->name()->as_C_string(),
+                       m->signature()->as_C_string());
+        _count++;
+      }
+    }
+  }
+
+  int count() const { return _count; }
+};
+
+bool CompileWarmup::dump(const char* file, outputStream* st) {
+  fileStream fs(file, "w");
+  if (!fs.is_open()) {
+    if (st != NULL) {
+      st->print_cr("Cannot open %s", file);
+    }
+    return false;
+  }
+  fs.print_cr("# <level> <holder> <name> <signature>");
+  HandleMark hm;
+  CompileWarmupDumpClosure cl(&fs);
+  ClassLoaderDataGraph::loaded_classes_do(&cl);
+  log_info(jit, compilation)("Wrote %d methods to compile warmup file %s", cl.count(), file);
+  if (st != NULL) {
+    st->print_cr("Wrote %d methods to %s", cl.count(), file);
+  }
+  return true;
+}
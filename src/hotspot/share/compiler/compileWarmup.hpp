@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_VM_COMPILER_COMPILEWARMUP_HPP
+#define SHARE_VM_COMPILER_COMPILEWARMUP_HPP
+
+#include "memory/allocation.hpp"
+#include "utilities/exceptions.hpp"
+
+class Method;
+class outputStream;
+
+// Records which methods were compiled at tier 3 or above in a run
+// (DumpCompileWarmupFile, Compiler.warmup_dump) and lets a later run
+// compile them as soon as they are first executed (CompileWarmupFile).
+//
+// The file has one line per method:
+//   <level> <holder> <name> <signature>
+// with the holder and signature in internal form. Lines starting with
+// '#' are ignored.
+class CompileWarmup : AllStatic {
+ public:
+  // Read the list of hot methods. Must be called before compilations
+  // are requested and the list is never changed afterwards.
+  static void load(const char* file, TRAPS);
+
+  // Write the methods that currently have been compiled at tier 3 or
+  // above. Returns false if the file could not be opened.
+  static bool dump(const char* file, outputStream* st);
+
+  // Was the method compiled at tier 3 or above in the recorded run?
+  static bool is_hot(const Method* method);
+};
+
+#endif // SHARE_VM_COMPILER_COMPILEWARMUP_HPP
@@ -447,5 +447,10 @@ void CompilerConfig::ergo_initialize() {
     // blind guess
     LoopStripMiningIterShortLoop = LoopStripMiningIter / 10;
   }
+  if (UsePolymorphicInlining && FLAG_IS_DEFAULT(TypeProfileWidth) &&
+      TypeProfileWidth < PolymorphicInliningLimit) {
+    // Record enough receiver rows in MethodData to find the inlined receivers
+    FLAG_SET_DEFAULT(TypeProfileWidth, PolymorphicInliningLimit);
+  }
 #endif // COMPILER2
 }
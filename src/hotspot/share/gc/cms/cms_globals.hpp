@@ -73,6 +73,12 @@
           "during a scavenge")                                              \
           range(1, max_uintx)                                               \
                                                                             \
+  product(size_t, CMSOldPLABDictionaryChunkSize, 16*K,                      \
+          "Size (in HeapWords) of the dictionary chunk each CMS gen "       \
+          "promotion LAB caches to carve large blocks from without "        \
+          "taking the dictionary lock; 0 disables the cache")               \
+          range(0, max_uintx)                                               \
+                                                                            \
   product_pd(size_t, CMSYoungGenPerWorker,                                  \
           "The maximum size of young gen chosen by default per GC worker "  \
           "thread available")                                               \
@@ -2684,7 +2684,8 @@ size_t CompactibleFreeListSpaceLAB::_global_num_blocks[]  = VECTOR_257(0);
 uint   CompactibleFreeListSpaceLAB::_global_num_workers[] = VECTOR_257(0);
 
 CompactibleFreeListSpaceLAB::CompactibleFreeListSpaceLAB(CompactibleFreeListSpace* cfls) :
-  _cfls(cfls)
+  _cfls(cfls),
+  _dict_chunk(NULL)
 {
   assert(CompactibleFreeListSpace::IndexSetSize == 257, "Modify VECTOR_257() macro above");
   for (size_t i = CompactibleFreeListSpace::IndexSetStart;
@@ -2711,11 +2712,17 @@ HeapWord* CompactibleFreeListSpaceLAB::alloc(size_t word_sz) {
   FreeChunk* res;
   assert(word_sz == _cfls->adjustObjectSize(word_sz), "Error");
   if (word_sz >=  CompactibleFreeListSpace::IndexSetSize) {
-    // This locking manages sync with other large object allocations.
-    MutexLockerEx x(_cfls->parDictionaryAllocLock(),
-                    Mutex::_no_safepoint_check_flag);
-    res = _cfls->getChunkFromDictionaryExact(word_sz);
-    if (res == NULL) return NULL;
+    res = get_from_dict_chunk(word_sz);
+    if (res == NULL) {
+      res = refill_dict_chunk(word_sz);
+    }
+    if (res == NULL) {
+      // This locking manages sync with other large object allocations.
+      MutexLockerEx x(_cfls->parDictionaryAllocLock(),
+                      Mutex::_no_safepoint_check_flag);
+      res = _cfls->getChunkFromDictionaryExact(word_sz);
+      if (res == NULL) return NULL;
+    }
   } else {
     AdaptiveFreeList<FreeChunk>* fl = &_indexedFreeList[word_sz];
     if (fl->count() == 0) {
@@ -2735,6 +2742,88 @@ HeapWord* CompactibleFreeListSpaceLAB::alloc(size_t word_sz) {
   return (HeapWord*)res;
 }
 
+// Carve a block of exactly word_sz words off the front of the cached
+// dictionary chunk, leaving a remainder of at least MinChunkSize.
+// The cached chunk is private to this LAB, so no locking is needed;
+// the remainder is made to look like a free block before the BOT
+// is updated, since other GC threads may be walking the space.
+FreeChunk* CompactibleFreeListSpaceLAB::get_from_dict_chunk(size_t word_sz) {
+  FreeChunk* fc = _dict_chunk;
+  if (fc == NULL) {
+    return NULL;
+  }
+  assert(fc->is_free(), "Cached chunk should be free");
+  const size_t fc_size = fc->size();
+  if (fc_size == word_sz) {
+    _dict_chunk = NULL;
+    return fc;
+  }
+  if (fc_size < word_sz + MinChunkSize) {
+    return NULL;
+  }
+  const size_t rem = fc_size - word_sz;
+  FreeChunk* rem_fc = (FreeChunk*)((HeapWord*)fc + word_sz);
+  rem_fc->set_size(rem);
+  rem_fc->link_prev(NULL); // Mark as a free block for other (parallel) GC threads.
+  rem_fc->link_next(NULL);
+  // Above must occur before BOT is updated below.
+  OrderAccess::storestore();
+  _cfls->_bt.split_block((HeapWord*)fc, fc_size, word_sz);
+  fc->set_size(word_sz);
+  _cfls->_bt.verify_single_block((HeapWord*)fc, word_sz);
+  _dict_chunk = rem_fc;
+  return fc;
+}
+
+// Give the cached dictionary chunk back to the global free lists
+// and fetch a new one from the dictionary, then carve word_sz from
+// it. Requests that are large compared to the cached chunk size
+// are left to the caller to satisfy directly from the dictionary.
+FreeChunk* CompactibleFreeListSpaceLAB::refill_dict_chunk(size_t word_sz) {
+  const size_t chunk_sz = CMSOldPLABDictionaryChunkSize;
+  if (word_sz > chunk_sz / CMSOldPLABNumRefills) {
+    return NULL;
+  }
+  return_dict_chunk();
+  {
+    MutexLockerEx x(_cfls->parDictionaryAllocLock(),
+                    Mutex::_no_safepoint_check_flag);
+    // Trims the chunk to less than chunk_sz + MinChunkSize so that a
+    // single LAB does not hold on to a large part of the free space.
+    FreeChunk* fc = _cfls->getChunkFromDictionary(chunk_sz);
+    if (fc == NULL) {
+      return NULL;
+    }
+    assert(fc->is_free(), "Error: should be a free block");
+    _dict_chunk = fc;
+  }
+  return get_from_dict_chunk(word_sz);
+}
+
+// Return what is left of the cached dictionary chunk to the
+// dictionary or, if small, to the indexed free lists.
+void CompactibleFreeListSpaceLAB::return_dict_chunk() {
+  FreeChunk* fc = _dict_chunk;
+  if (fc == NULL) {
+    return;
+  }
+  _dict_chunk = NULL;
+  const size_t size = fc->size();
+  assert(fc->is_free() && size >= MinChunkSize, "Error");
+  if (size >= CompactibleFreeListSpace::IndexSetSize) {
+    MutexLockerEx x(_cfls->parDictionaryAllocLock(),
+                    Mutex::_no_safepoint_check_flag);
+    _cfls->returnChunkToDictionary(fc);
+    _cfls->split_birth(size);
+  } else {
+    MutexLockerEx x(_cfls->_indexedFreeListParLocks[size],
+                    Mutex::_no_safepoint_check_flag);
+    _cfls->_bt.verify_not_unallocated((HeapWord*)fc, size);
+    _cfls->_indexedFreeList[size].return_chunk_at_head(fc);
+    _cfls->split_birth(size);
+  }
+}
+
 // Get a chunk of blocks of the right size and update related
 // book-keeping stats
 void CompactibleFreeListSpaceLAB::get_from_global_pool(size_t word_sz, AdaptiveFreeList<FreeChunk>* fl) {
@@ -2802,6 +2891,7 @@ void CompactibleFreeListSpaceLAB::retire(int tid) {
   // so no need for locks and such.
   NOT_PRODUCT(Thread* t = Thread::current();)
   assert(Thread::current()->is_VM_thread(), "Error");
+  return_dict_chunk();
   for (size_t i =  CompactibleFreeListSpace::IndexSetStart;
        i < CompactibleFreeListSpace::IndexSetSize;
        i += CompactibleFreeListSpace::IndexSetStride) {
@@ -727,8 +727,16 @@ class CompactibleFreeListSpaceLAB : public CHeapObj<mtGC> {
   static uint   _global_num_workers[CompactibleFreeListSpace::IndexSetSize];
   size_t        _num_blocks        [CompactibleFreeListSpace::IndexSetSize];
 
-  // Internal work method
+  // A free chunk obtained from the dictionary from which blocks of
+  // dictionary size (>= IndexSetSize) are carved without taking
+  // the parDictionaryAllocLock; see CMSOldPLABDictionaryChunkSize.
+  FreeChunk*    _dict_chunk;
+
+  // Internal work methods
   void get_from_global_pool(size_t word_sz, AdaptiveFreeList<FreeChunk>* fl);
+  FreeChunk* get_from_dict_chunk(size_t word_sz);
+  FreeChunk* refill_dict_chunk(size_t word_sz);
+  void return_dict_chunk();
 
 public:
   static const int _default_dynamic_old_plab_size = 16;
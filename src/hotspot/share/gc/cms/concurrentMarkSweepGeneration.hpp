@@ -910,6 +910,10 @@ class CMSCollector: public CHeapObj<mtGC> {
   void* get_data_recorder(int thr_num);
   void sample_eden_chunk();
 
+  // Object boundaries in eden sampled since the last young collection.
+  HeapWord** eden_chunk_array() const { return _eden_chunk_array; }
+  size_t eden_chunk_index() const     { return _eden_chunk_index; }
+
   CMSBitMap* markBitMap()  { return &_markBitMap; }
   void directAllocated(HeapWord* start, size_t size);
 
@@ -834,7 +834,7 @@ void ParNewGeneration::handle_promotion_failed(CMSHeap* gch, ParScanThreadStateS
   assert(_promo_failure_scan_stack.is_empty(), "post condition");
   _promo_failure_scan_stack.clear(true); // Clear cached segments.
 
-  remove_forwarding_pointers();
+  remove_forwarding_pointers_par();
   log_info(gc, promotion)("Promotion failed");
   // All the spaces are in play for mark-sweep.
   swap_spaces();  // Make life simpler for CMS || rescan; see 6483690.
@@ -1454,6 +1454,75 @@ const char* ParNewGeneration::name() const {
   return "par new generation";
 }
 
+// Removes the forwarding pointers of the objects in eden and from-space in
+// parallel. Eden is split at the object boundaries recorded by CMS eden
+// chunk sampling (see CMSCollector::sample_eden_chunk()); from-space is
+// processed as a single chunk.
+class ParRemoveForwardingPointersTask : public AbstractGangTask {
+  ContiguousSpace* _eden;
+  ContiguousSpace* _from;
+  HeapWord** _eden_boundaries;
+  size_t _num_eden_boundaries;
+  volatile size_t _claimed_chunk;
+
+  void remove_forwarding_pointers(HeapWord* start, HeapWord* end) {
+    RemoveForwardedPointerClosure rspc;
+    HeapWord* cur = start;
+    while (cur < end) {
+      oop obj = oop(cur);
+      cur += obj->size();
+      rspc.do_object(obj);
+    }
+    assert(cur == end, "Chunk boundaries must be object boundaries");
+  }
+
+public:
+  ParRemoveForwardingPointersTask(ContiguousSpace* eden, ContiguousSpace* from,
+                                  HeapWord** eden_boundaries, size_t num_eden_boundaries) :
+    AbstractGangTask("ParNewGeneration remove forwarding pointers"),
+    _eden(eden), _from(from),
+    _eden_boundaries(eden_boundaries),
+    _num_eden_boundaries(num_eden_boundaries),
+    _claimed_chunk(0) {
+  }
+
+  void work(uint worker_id) {
+    // Chunk 0 is from-space, chunks 1..n+1 are the eden chunks delimited by
+    // the n boundaries.
+    const size_t num_chunks = _num_eden_boundaries + 2;
+    for (size_t chunk = Atomic::add((size_t)1, &_claimed_chunk) - 1;
+         chunk < num_chunks;
+         chunk = Atomic::add((size_t)1, &_claimed_chunk) - 1) {
+      if (chunk == 0) {
+        remove_forwarding_pointers(_from->bottom(), _from->top());
+        continue;
+      }
+      size_t idx = chunk - 1;
+      HeapWord* start = idx == 0 ? _eden->bottom() : _eden_boundaries[idx - 1];
+      HeapWord* end = idx == _num_eden_boundaries ? _eden->top() : _eden_boundaries[idx];
+      remove_forwarding_pointers(start, end);
+    }
+  }
+};
+
+void ParNewGeneration::remove_forwarding_pointers_par() {
+  CMSCollector* collector = CMSHeap::heap()->old_gen()->collector();
+  HeapWord** boundaries = collector->eden_chunk_array();
+  size_t num_boundaries = boundaries != NULL ? collector->eden_chunk_index() : 0;
+  // The samples are non-decreasing; only use those strictly within eden.
+  while (num_boundaries > 0 && boundaries[num_boundaries - 1] >= eden()->top()) {
+    num_boundaries--;
+  }
+  size_t first = 0;
+  while (first < num_boundaries && boundaries[first] <= eden()->bottom()) {
+    first++;
+  }
+
+  ParRemoveForwardingPointersTask task(eden(), from(), boundaries + first, num_boundaries - first);
+  CMSHeap::heap()->workers()->run_task(&task);
+  restore_preserved_marks();
+}
+
 void ParNewGeneration::restore_preserved_marks() {
   SharedRestorePreservedMarksTaskExecutor task_executor(CMSHeap::heap()->workers());
   _preserved_marks_set.restore(&task_executor);
@@ -355,6 +355,9 @@ class ParNewGeneration: public DefNewGeneration {
 
   void restore_preserved_marks();
 
+  // Parallel version of DefNewGeneration::remove_forwarding_pointers().
+  void remove_forwarding_pointers_par();
+
  public:
   ParNewGeneration(ReservedSpace rs, size_t initial_byte_size);
 
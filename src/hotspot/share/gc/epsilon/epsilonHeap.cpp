@@ -23,12 +23,43 @@
  */
 
 #include "precompiled.hpp"
+#include "aot/aotLoader.hpp"
+#include "classfile/classLoaderData.hpp"
+#include "classfile/stringTable.hpp"
+#include "classfile/systemDictionary.hpp"
+#include "code/codeCache.hpp"
+#include "compiler/oopMap.hpp"
 #include "gc/epsilon/epsilonHeap.hpp"
 #include "gc/epsilon/epsilonMemoryPool.hpp"
 #include "gc/epsilon/epsilonThreadLocalData.hpp"
+#include "gc/epsilon/epsilonVMOperations.hpp"
+#include "gc/shared/gcId.hpp"
+#include "gc/shared/gcLocker.hpp"
+#include "gc/shared/gcTraceTime.inline.hpp"
+#include "gc/shared/preservedMarks.inline.hpp"
+#include "gc/shared/strongRootsScope.hpp"
+#include "gc/shared/weakProcessor.hpp"
 #include "memory/allocation.hpp"
 #include "memory/allocation.inline.hpp"
+#include "memory/iterator.inline.hpp"
 #include "memory/resourceArea.hpp"
+#include "memory/universe.hpp"
+#include "oops/access.inline.hpp"
+#include "oops/compressedOops.inline.hpp"
+#include "oops/oop.inline.hpp"
+#include "prims/jvmtiExport.hpp"
+#include "runtime/biasedLocking.hpp"
+#include "runtime/java.hpp"
+#include "runtime/jniHandles.hpp"
+#include "runtime/synchronizer.hpp"
+#include "runtime/thread.hpp"
+#include "runtime/vmThread.hpp"
+#include "services/management.hpp"
+#include "services/memTracker.hpp"
+#include "services/memoryService.hpp"
+#include "utilities/bitMap.inline.hpp"
+#include "utilities/copy.hpp"
+#include "utilities/stack.inline.hpp"
 
 jint EpsilonHeap::initialize() {
   size_t align = _policy->heap_alignment();
@@ -47,6 +78,21 @@ jint EpsilonHeap::initialize() {
   _space = new ContiguousSpace();
   _space->initialize(committed_region, /* clear_space = */ true, /* mangle_space = */ true);
 
+  if (EpsilonSlidingGC) {
+    // Reserve the marking bitmap, one bit per possible object start. It is
+    // committed only for the duration of the collection: no memory is taken
+    // until compaction is requested, and fresh commits come zeroed.
+    size_t bitmap_bits = max_byte_size / HeapWordSize >> LogMinObjAlignment;
+    size_t bitmap_bytes = align_up(align_up(bitmap_bits, BitsPerWord) / BitsPerByte, os::vm_page_size());
+    ReservedSpace bitmap_rs(bitmap_bytes, os::vm_page_size());
+    if (!bitmap_rs.is_reserved()) {
+      vm_exit_during_initialization("Could not reserve space for Epsilon marking bitmap");
+    }
+    MemTracker::record_virtual_memory_type(bitmap_rs.base(), mtGC);
+    _bitmap_region = MemRegion((HeapWord*)bitmap_rs.base(), bitmap_rs.size() / HeapWordSize);
+    _bitmap = BitMapView((BitMap::bm_word_t*)bitmap_rs.base(), bitmap_bits);
+  }
+
   // Precompute hot fields
   _max_tlab_size = MIN2(CollectedHeap::max_tlab_size(), align_object_size(EpsilonMaxTLABSize / HeapWordSize));
   _step_counter_update = MIN2<size_t>(max_byte_size / 16, EpsilonUpdateCountersStep);
@@ -264,7 +310,34 @@ HeapWord* EpsilonHeap::mem_allocate(size_t size, bool *gc_overhead_limit_was_exc
   return allocate_work(size);
 }
 
+bool EpsilonHeap::is_explicit_gc_request(GCCause::Cause cause) const {
+  switch (cause) {
+    case GCCause::_java_lang_system_gc:
+    case GCCause::_dcmd_gc_run:
+    case GCCause::_jvmti_force_gc:
+    case GCCause::_wb_full_gc:
+      return true;
+    default:
+      return false;
+  }
+}
+
 void EpsilonHeap::collect(GCCause::Cause cause) {
+  if (EpsilonSlidingGC && is_explicit_gc_request(cause)) {
+    // The application has told us it is at the quiescent point, and it is
+    // worth compacting the heap before allocating further.
+    assert(!Heap_lock->owned_by_self(), "this thread should not own the Heap_lock");
+    uint gc_count, full_gc_count;
+    {
+      MutexLocker ml(Heap_lock);
+      gc_count      = total_collections();
+      full_gc_count = total_full_collections();
+    }
+    VM_EpsilonCollect op(gc_count, full_gc_count, cause);
+    VMThread::execute(&op);
+    return;
+  }
+
   switch (cause) {
     case GCCause::_metadata_GC_threshold:
     case GCCause::_metadata_GC_clear_soft_refs:
@@ -287,6 +360,273 @@ void EpsilonHeap::do_full_collection(bool clear_all_soft_refs) {
   collect(gc_cause());
 }
 
+typedef Stack<oop, mtGC> EpsilonMarkStack;
+
+bool EpsilonHeap::mark_live(oop obj) {
+  BitMap::idx_t idx = pointer_delta((HeapWord*)obj, reserved_region().start()) >> LogMinObjAlignment;
+  if (_bitmap.at(idx)) {
+    return false;
+  }
+  _bitmap.set_bit(idx);
+  return true;
+}
+
+// Marks the reachable objects and pushes the newly marked ones to the stack
+// for further traversal. Single-threaded, so non-atomic check-and-set is fine.
+class EpsilonScanOopClosure : public BasicOopIterateClosure {
+private:
+  EpsilonHeap* const _heap;
+  EpsilonMarkStack* const _stack;
+
+  template <class T>
+  void do_oop_work(T* p) {
+    T o = RawAccess<>::oop_load(p);
+    if (!CompressedOops::is_null(o)) {
+      oop obj = CompressedOops::decode_not_null(o);
+      if (_heap->mark_live(obj)) {
+        _stack->push(obj);
+      }
+    }
+  }
+
+public:
+  EpsilonScanOopClosure(EpsilonHeap* heap, EpsilonMarkStack* stack) :
+    _heap(heap), _stack(stack) {}
+  virtual void do_oop(oop* p)       { do_oop_work(p); }
+  virtual void do_oop(narrowOop* p) { do_oop_work(p); }
+};
+
+// Slides the live objects to the bottom of the space and records the new
+// locations in mark words. Objects that stay in place are not forwarded.
+class EpsilonCalcNewLocationObjectClosure : public ObjectClosure {
+private:
+  HeapWord* _compact_point;
+  PreservedMarks* const _preserved_marks;
+
+public:
+  EpsilonCalcNewLocationObjectClosure(HeapWord* start, PreservedMarks* pm) :
+    _compact_point(start), _preserved_marks(pm) {}
+
+  void do_object(oop obj) {
+    if ((HeapWord*)obj != _compact_point) {
+      markOop mark = obj->mark_raw();
+      _preserved_marks->push_if_necessary(obj, mark);
+      obj->forward_to(oop(_compact_point));
+    }
+    _compact_point += obj->size();
+  }
+
+  HeapWord* compact_point() const { return _compact_point; }
+};
+
+class EpsilonAdjustPointersOopClosure : public BasicOopIterateClosure {
+private:
+  template <class T>
+  void do_oop_work(T* p) {
+    T o = RawAccess<>::oop_load(p);
+    if (!CompressedOops::is_null(o)) {
+      oop obj = CompressedOops::decode_not_null(o);
+      if (obj->is_forwarded()) {
+        oop fwd = obj->forwardee();
+        assert(fwd != NULL, "just checking");
+        RawAccess<>::oop_store(p, fwd);
+      }
+    }
+  }
+
+public:
+  virtual void do_oop(oop* p)       { do_oop_work(p); }
+  virtual void do_oop(narrowOop* p) { do_oop_work(p); }
+};
+
+class EpsilonAdjustPointersObjectClosure : public ObjectClosure {
+private:
+  EpsilonAdjustPointersOopClosure _cl;
+public:
+  void do_object(oop obj) {
+    obj->oop_iterate(&_cl);
+  }
+};
+
+// Objects only ever slide down, so copying in address order never
+// overwrites the live objects not yet moved.
+class EpsilonMoveObjectsObjectClosure : public ObjectClosure {
+private:
+  size_t _moved;
+public:
+  EpsilonMoveObjectsObjectClosure() : _moved(0) {}
+
+  void do_object(oop obj) {
+    if (obj->is_forwarded()) {
+      oop fwd = obj->forwardee();
+      assert(fwd != NULL, "just checking");
+      Copy::aligned_conjoint_words((HeapWord*)obj, (HeapWord*)fwd, obj->size());
+      fwd->init_mark_raw();
+      _moved++;
+    }
+  }
+
+  size_t moved() const { return _moved; }
+};
+
+void EpsilonHeap::process_roots(OopClosure* cl) {
+  // Every root slot has to be visited exactly once: revisiting an already
+  // adjusted slot would chase the forwarding of whatever object used to
+  // live at the new location. Therefore, nmethods are visited through the
+  // code cache only, and not through the thread stacks.
+  StrongRootsScope scope(1);
+  CLDToOopClosure clds(cl, false);
+  CodeBlobToOopClosure blobs(cl, CodeBlobToOopClosure::FixRelocations);
+
+  CodeCache::blobs_do(&blobs);
+  ClassLoaderDataGraph::cld_do(&clds);
+  Universe::oops_do(cl);
+  JNIHandles::oops_do(cl);
+  WeakProcessor::oops_do(cl);
+  StringTable::oops_do(cl);
+  ObjectSynchronizer::oops_do(cl);
+  Management::oops_do(cl);
+  JvmtiExport::oops_do(cl);
+  if (UseAOT) {
+    AOTLoader::oops_do(cl);
+  }
+  SystemDictionary::oops_do(cl);
+  Threads::possibly_parallel_oops_do(false, cl, NULL);
+}
+
+void EpsilonHeap::walk_bitmap(ObjectClosure* cl) {
+  HeapWord* bottom = _space->bottom();
+  BitMap::idx_t beg = pointer_delta(bottom, reserved_region().start()) >> LogMinObjAlignment;
+  BitMap::idx_t end = pointer_delta(_space->top(), reserved_region().start()) >> LogMinObjAlignment;
+  for (BitMap::idx_t idx = _bitmap.get_next_one_offset(beg, end);
+       idx < end;
+       idx = _bitmap.get_next_one_offset(idx + 1, end)) {
+    cl->do_object(oop(reserved_region().start() + (idx << LogMinObjAlignment)));
+  }
+}
+
+void EpsilonHeap::entry_collect(GCCause::Cause cause) {
+  assert(SafepointSynchronize::is_at_safepoint(), "must be at safepoint");
+  assert(Thread::current()->is_VM_thread(), "only VM thread");
+
+  if (GCLocker::check_active_before_gc()) {
+    log_info(gc)("GC request for \"%s\" is skipped: JNI critical region is active", GCCause::to_string(cause));
+    return;
+  }
+
+  GCIdMark gc_id_mark;
+  GCTraceTime(Info, gc) time("Sliding Mark-Compact", NULL, cause, true);
+  TraceMemoryManagerStats tms(&_memory_manager, cause);
+  increment_total_collections(true /* full */);
+
+  size_t stat_reachable = 0;
+  size_t stat_moved = 0;
+  size_t stat_preserved_marks = 0;
+
+  {
+    GCTraceTime(Debug, gc, phases) time("Prologue", NULL);
+
+    if (!os::commit_memory((char*)_bitmap_region.start(), _bitmap_region.byte_size(), false)) {
+      log_warning(gc)("Could not commit native memory for marking bitmap, GC failed");
+      return;
+    }
+
+    // Objects are found through the bitmap, but threads have to give up
+    // their TLABs so that allocation restarts at the new top.
+    ensure_parsability(true);
+    BiasedLocking::preserve_marks();
+#if COMPILER2_OR_JVMCI
+    DerivedPointerTable::clear();
+#endif
+  }
+
+  {
+    GCTraceTime(Debug, gc, phases) time("Mark", NULL);
+
+    EpsilonMarkStack stack;
+    EpsilonScanOopClosure cl(this, &stack);
+    process_roots(&cl);
+    while (!stack.is_empty()) {
+      oop obj = stack.pop();
+      obj->oop_iterate(&cl);
+      stat_reachable++;
+    }
+
+#if COMPILER2_OR_JVMCI
+    // No more derived pointers are discovered after marking.
+    DerivedPointerTable::set_active(false);
+#endif
+  }
+
+  PreservedMarks preserved_marks;
+  HeapWord* new_top;
+
+  {
+    GCTraceTime(Debug, gc, phases) time("Calculate New Locations", NULL);
+
+    EpsilonCalcNewLocationObjectClosure cl(_space->bottom(), &preserved_marks);
+    walk_bitmap(&cl);
+
+    // Cannot retract top just yet: the walks below still need the objects
+    // above the new top to be "in heap".
+    new_top = cl.compact_point();
+    stat_preserved_marks = preserved_marks.size();
+  }
+
+  {
+    GCTraceTime(Debug, gc, phases) time("Adjust Pointers", NULL);
+
+    EpsilonAdjustPointersObjectClosure cl;
+    walk_bitmap(&cl);
+
+    EpsilonAdjustPointersOopClosure cli;
+    process_roots(&cli);
+
+    preserved_marks.adjust_during_full_gc();
+  }
+
+  {
+    GCTraceTime(Debug, gc, phases) time("Move Objects", NULL);
+
+    EpsilonMoveObjectsObjectClosure cl;
+    walk_bitmap(&cl);
+    stat_moved = cl.moved();
+
+    _space->set_top(new_top);
+  }
+
+  {
+    GCTraceTime(Debug, gc, phases) time("Epilogue", NULL);
+
+    preserved_marks.restore();
+#if COMPILER2_OR_JVMCI
+    DerivedPointerTable::update_pointers();
+#endif
+    BiasedLocking::restore_marks();
+
+    if (!os::uncommit_memory((char*)_bitmap_region.start(), _bitmap_region.byte_size())) {
+      log_warning(gc)("Could not uncommit native memory for marking bitmap");
+    }
+
+    if (ZapUnusedHeapArea) {
+      _space->mangle_unused_area();
+    }
+  }
+
+  size_t used = _space->used();
+  _last_counter_update = used;
+  _last_heap_print = used;
+  _monitoring_support->update_counters();
+
+  log_info(gc)("GC Stats: " SIZE_FORMAT " reachable, " SIZE_FORMAT " (%.2f%%) moved, "
+               SIZE_FORMAT " (%.2f%%) mark words preserved",
+               stat_reachable,
+               stat_moved,           percent_of(stat_moved, stat_reachable),
+               stat_preserved_marks, percent_of(stat_preserved_marks, stat_reachable));
+  print_heap_info(used);
+  print_metaspace_info();
+}
+
 void EpsilonHeap::safe_object_iterate(ObjectClosure *cl) {
   _space->safe_object_iterate(cl);
 }
@@ -29,6 +29,7 @@
 #include "gc/shared/softRefPolicy.hpp"
 #include "gc/shared/space.hpp"
 #include "services/memoryManager.hpp"
+#include "utilities/bitMap.hpp"
 #include "gc/epsilon/epsilonCollectorPolicy.hpp"
 #include "gc/epsilon/epsilonMonitoringSupport.hpp"
 #include "gc/epsilon/epsilonBarrierSet.hpp"
@@ -50,6 +51,8 @@ private:
   int64_t _decay_time_ns;
   volatile size_t _last_counter_update;
   volatile size_t _last_heap_print;
+  MemRegion _bitmap_region;
+  BitMapView _bitmap;
 
 public:
   static EpsilonHeap* heap();
@@ -90,7 +93,8 @@ public:
   }
 
   virtual bool is_scavengable(oop obj) {
-    // No GC is going to happen, therefore no objects ever move.
+    // Objects move only in explicitly requested full compactions,
+    // which visit the entire code cache anyway.
     return false;
   }
 
@@ -116,14 +120,21 @@ public:
   virtual void collect(GCCause::Cause cause);
   virtual void do_full_collection(bool clear_all_soft_refs);
 
+  // Sliding mark-compact, runs at safepoint
+  void entry_collect(GCCause::Cause cause);
+
+  // Marks the object in the marking bitmap, returns false if it was marked already
+  bool mark_live(oop obj);
+
   // Heap walking support
   virtual void safe_object_iterate(ObjectClosure* cl);
   virtual void object_iterate(ObjectClosure* cl) {
     safe_object_iterate(cl);
   }
 
-  // Object pinning support: every object is implicitly pinned
-  virtual bool supports_object_pinning() const           { return true; }
+  // Object pinning support: every object is implicitly pinned, unless
+  // sliding compaction is enabled and JNI critical regions need GCLocker
+  virtual bool supports_object_pinning() const           { return !EpsilonSlidingGC; }
   virtual oop pin_object(JavaThread* thread, oop obj)    { return obj; }
   virtual void unpin_object(JavaThread* thread, oop obj) { }
 
@@ -152,6 +163,10 @@ private:
   void print_heap_info(size_t used) const;
   void print_metaspace_info() const;
 
+  bool is_explicit_gc_request(GCCause::Cause cause) const;
+  void process_roots(OopClosure* cl);
+  void walk_bitmap(ObjectClosure* cl);
+
 };
 
 #endif // SHARE_VM_GC_EPSILON_COLLECTEDHEAP_HPP
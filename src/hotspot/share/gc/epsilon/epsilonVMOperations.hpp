@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_VM_GC_EPSILON_EPSILONVMOPERATIONS_HPP
+#define SHARE_VM_GC_EPSILON_EPSILONVMOPERATIONS_HPP
+
+#include "gc/shared/vmGCOperations.hpp"
+
+// Explicitly requested sliding compaction, see EpsilonSlidingGC.
+class VM_EpsilonCollect: public VM_GC_Operation {
+ public:
+  VM_EpsilonCollect(uint gc_count, uint full_gc_count, GCCause::Cause gc_cause) :
+    VM_GC_Operation(gc_count, gc_cause, full_gc_count, true /* full */) {}
+
+  virtual VMOp_Type type() const { return VMOp_EpsilonCollect; }
+  virtual void doit();
+};
+
+#endif // SHARE_VM_GC_EPSILON_EPSILONVMOPERATIONS_HPP
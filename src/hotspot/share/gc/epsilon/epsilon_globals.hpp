@@ -91,6 +91,13 @@
   experimental(size_t, EpsilonMinHeapExpand, 128 * M,                       \
           "Min expansion step for heap. Larger value improves performance " \
           "at the potential expense of memory waste.")                      \
-          range(1, max_intx)
+          range(1, max_intx)                                                \
+                                                                            \
+  experimental(bool, EpsilonSlidingGC, false,                               \
+          "Compact the heap with a sliding mark-compact on explicit GC "    \
+          "requests: System.gc(), MemoryMXBean.gc(), jcmd GC.run, JVMTI "   \
+          "ForceGarbageCollection and WhiteBox full GC. Allocation "        \
+          "failures are still fatal; the application is expected to "       \
+          "request compaction at its own quiescent points.")
 
 #endif // SHARE_VM_GC_EPSILON_GLOBALS_HPP
@@ -30,6 +30,7 @@
 #include "gc/g1/g1HeapVerifier.hpp"
 #include "gc/g1/heapRegion.hpp"
 #include "gc/shared/gcArguments.inline.hpp"
+#include "logging/log.hpp"
 #include "runtime/globals.hpp"
 #include "runtime/globals_extension.hpp"
 #include "runtime/vm_version.hpp"
@@ -145,6 +146,16 @@ void G1Arguments::initialize() {
   }
 #endif
 
+  // Clearing the mark bitmaps by remapping their pages relies on the OS
+  // handing out zero-filled small pages without losing any page placement.
+  bool can_clear_bitmap_by_remapping = LINUX_ONLY(!UseLargePages && !UseTransparentHugePages && !UseNUMA) NOT_LINUX(false);
+  if (G1ClearBitmapByRemapping && !can_clear_bitmap_by_remapping) {
+    if (!FLAG_IS_DEFAULT(G1ClearBitmapByRemapping)) {
+      log_warning(gc)("G1ClearBitmapByRemapping is not supported with this configuration, disabling it");
+    }
+    FLAG_SET_DEFAULT(G1ClearBitmapByRemapping, false);
+  }
+
   initialize_verification_types();
 }
 
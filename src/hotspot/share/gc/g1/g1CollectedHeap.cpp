@@ -160,12 +160,15 @@ HeapRegion* G1CollectedHeap::new_heap_region(uint hrs_index,
 
 // Private methods.
 
-HeapRegion* G1CollectedHeap::new_region(size_t word_size, bool is_old, bool do_expand) {
+HeapRegion* G1CollectedHeap::new_region(size_t word_size,
+                                        bool is_old,
+                                        bool do_expand,
+                                        uint node_index) {
   assert(!is_humongous(word_size) || word_size <= HeapRegion::GrainWords,
          "the only time we use this to allocate a humongous region is "
          "when we are allocating a single humongous region");
 
-  HeapRegion* res = _hrm.allocate_free_region(is_old);
+  HeapRegion* res = _hrm.allocate_free_region(is_old, node_index);
 
   if (res == NULL && do_expand && _expand_heap_after_alloc_failure) {
     // Currently, only attempts to allocate GC alloc regions set
@@ -182,7 +185,7 @@ HeapRegion* G1CollectedHeap::new_region(size_t word_size, bool is_old, bool do_e
       // always expand the heap by an amount aligned to the heap
       // region size, the free list should in theory not be empty.
       // In either case allocate_free_region() will check for NULL.
-      res = _hrm.allocate_free_region(is_old);
+      res = _hrm.allocate_free_region(is_old, node_index);
     } else {
       _expand_heap_after_alloc_failure = false;
     }
@@ -1043,7 +1046,7 @@ void G1CollectedHeap::prepare_heap_for_mutators() {
   assert(num_free_regions() == 0, "we should not have added any free regions");
   rebuild_region_sets(false /* free_list_only */);
   abort_refinement();
-  resize_if_necessary_after_full_collection();
+  resize_heap_if_necessary();
 
   // Rebuild the strong code root lists for each region
   rebuild_strong_code_roots();
@@ -1145,7 +1148,7 @@ void G1CollectedHeap::do_full_collection(bool clear_all_soft_refs) {
                                   clear_all_soft_refs);
 }
 
-void G1CollectedHeap::resize_if_necessary_after_full_collection() {
+void G1CollectedHeap::resize_heap_if_necessary() {
   // Capacity, free and used after the GC counted as full regions to
   // include the waste in the following calculations.
   const size_t capacity_after_gc = capacity();
@@ -1202,7 +1205,7 @@ void G1CollectedHeap::resize_if_necessary_after_full_collection() {
     // Don't expand unless it's significant
     size_t expand_bytes = minimum_desired_capacity - capacity_after_gc;
 
-    log_debug(gc, ergo, heap)("Attempt heap expansion (capacity lower than min desired capacity after Full GC). "
+    log_debug(gc, ergo, heap)("Attempt heap expansion (capacity lower than min desired capacity). "
                               "Capacity: " SIZE_FORMAT "B occupancy: " SIZE_FORMAT "B live: " SIZE_FORMAT "B "
                               "min_desired_capacity: " SIZE_FORMAT "B (" UINTX_FORMAT " %%)",
                               capacity_after_gc, used_after_gc, used(), minimum_desired_capacity, MinHeapFreeRatio);
@@ -1214,7 +1217,7 @@ void G1CollectedHeap::resize_if_necessary_after_full_collection() {
     // Capacity too large, compute shrinking size
     size_t shrink_bytes = capacity_after_gc - maximum_desired_capacity;
 
-    log_debug(gc, ergo, heap)("Attempt heap shrinking (capacity higher than max desired capacity after Full GC). "
+    log_debug(gc, ergo, heap)("Attempt heap shrinking (capacity higher than max desired capacity). "
                               "Capacity: " SIZE_FORMAT "B occupancy: " SIZE_FORMAT "B live: " SIZE_FORMAT "B "
                               "maximum_desired_capacity: " SIZE_FORMAT "B (" UINTX_FORMAT " %%)",
                               capacity_after_gc, used_after_gc, used(), maximum_desired_capacity, MaxHeapFreeRatio);
@@ -1390,9 +1393,9 @@ void G1CollectedHeap::shrink_helper(size_t shrink_bytes) {
 void G1CollectedHeap::shrink(size_t shrink_bytes) {
   _verifier->verify_region_sets_optional();
 
-  // We should only reach here at the end of a Full GC which means we
-  // should not not be holding to any GC alloc regions. The method
-  // below will make sure of that and do any remaining clean up.
+  // We should only reach here at the end of a Full GC or a young GC
+  // which means we should not not be holding to any GC alloc regions.
+  // The method below will make sure of that and do any remaining clean up.
   _allocator->abandon_gc_alloc_regions();
 
   // Instead of tearing down / rebuilding the free lists here, we
@@ -1406,6 +1409,27 @@ void G1CollectedHeap::shrink(size_t shrink_bytes) {
   _verifier->verify_region_sets_optional();
 }
 
+uint G1CollectedHeap::uncommit_pending_regions_chunk() {
+  assert(!SafepointSynchronize::is_at_safepoint(), "must be called concurrently");
+
+  // Holding the Heap_lock prevents any pause and any mutator from committing,
+  // allocating or otherwise using regions while we uncommit.
+  MutexLocker ml(Heap_lock);
+
+  uint limit = (uint)MAX2(G1UncommitChunkSize / HeapRegion::GrainBytes, (size_t)1);
+  double start_sec = os::elapsedTime();
+  uint uncommitted = _hrm.uncommit_pending_regions(limit);
+  if (uncommitted > 0) {
+    double time_ms = (os::elapsedTime() - start_sec) * MILLIUNITS;
+    g1_policy()->phase_times()->record_concurrent_uncommit_chunk(time_ms, uncommitted);
+    log_debug(gc, heap)("Concurrent uncommit: " SIZE_FORMAT "%s in %.3fms, %u regions left",
+                        byte_size_in_proper_unit(uncommitted * HeapRegion::GrainBytes),
+                        proper_unit_for_byte_size(uncommitted * HeapRegion::GrainBytes),
+                        time_ms, _hrm.num_uncommit_pending());
+  }
+  return uncommitted;
+}
+
 // Public methods.
 
 G1CollectedHeap::G1CollectedHeap(G1CollectorPolicy* collector_policy) :
@@ -1455,6 +1479,8 @@ G1CollectedHeap::G1CollectedHeap(G1CollectorPolicy* collector_policy) :
   _workers->initialize_workers();
   _verifier = new G1HeapVerifier(this);
 
+  _numa = G1NUMA::create();
+
   _allocator = new G1Allocator(this);
 
   _heap_sizing_policy = G1HeapSizingPolicy::create(this, _g1_policy->analytics());
@@ -1579,6 +1605,7 @@ jint G1CollectedHeap::initialize() {
   // Carve out the G1 part of the heap.
   ReservedSpace g1_rs = heap_rs.first_part(max_byte_size);
   size_t page_size = UseLargePages ? os::large_page_size() : os::vm_page_size();
+  _numa->set_region_info(HeapRegion::GrainBytes, page_size);
   G1RegionToSpaceMapper* heap_storage =
     G1RegionToSpaceMapper::create_mapper(g1_rs,
                                          g1_rs.size(),
@@ -1909,6 +1936,7 @@ bool G1CollectedHeap::should_do_concurrent_full_gc(GCCause::Cause cause) {
   switch (cause) {
     case GCCause::_gc_locker:               return GCLockerInvokesConcurrent;
     case GCCause::_g1_humongous_allocation: return true;
+    case GCCause::_g1_periodic_collection:  return G1PeriodicGCInvokesConcurrent;
     default:                                return is_user_requested_concurrent_full_gc(cause);
   }
 }
@@ -2113,6 +2141,30 @@ void G1CollectedHeap::object_iterate(ObjectClosure* cl) {
   heap_region_iterate(&blk);
 }
 
+void G1CollectedHeap::object_iterate_parallel(ObjectClosure* cl, uint worker_id, HeapRegionClaimer* claimer) {
+  IterateObjectClosureRegionClosure blk(cl);
+  heap_region_par_iterate_from_worker_offset(&blk, claimer, worker_id);
+}
+
+class G1ParallelObjectIterator : public ParallelObjectIterator {
+private:
+  G1CollectedHeap*  _heap;
+  HeapRegionClaimer _claimer;
+
+public:
+  G1ParallelObjectIterator(uint thread_num) :
+      _heap(G1CollectedHeap::heap()),
+      _claimer(thread_num) {}
+
+  virtual void object_iterate(ObjectClosure* cl, uint worker_id) {
+    _heap->object_iterate_parallel(cl, worker_id, &_claimer);
+  }
+};
+
+ParallelObjectIterator* G1CollectedHeap::parallel_object_iterator(uint thread_num) {
+  return new G1ParallelObjectIterator(thread_num);
+}
+
 void G1CollectedHeap::heap_region_iterate(HeapRegionClosure* cl) const {
   _hrm.iterate(cl);
 }
@@ -2540,6 +2592,11 @@ class RegisterHumongousWithInCSetFastTestClosure : public HeapRegionClosure {
     if (!region->rem_set()->is_complete()) {
       return false;
     }
+
+    // Objects in JNI critical sections must stay alive.
+    if (region->has_pinned_objects()) {
+      return false;
+    }
     // Candidate selection must satisfy the following constraints
     // while concurrent marking is in progress:
     //
@@ -2561,10 +2618,14 @@ class RegisterHumongousWithInCSetFastTestClosure : public HeapRegionClosure {
     // structures don't support efficiently performing the needed
     // additional tests or scrubbing of the mark stack.
     //
-    // However, we presently only nominate is_typeArray() objects.
     // A humongous object containing references induces remembered
-    // set entries on other regions.  In order to reclaim such an
-    // object, those remembered sets would need to be cleaned up.
+    // set entries on other regions.  Those entries become stale once
+    // the object is reclaimed, just like the entries of any other freed
+    // old region: cards in free or young regions are filtered during
+    // scanning and refinement, and scanning cards of a region that has
+    // been reused only causes some extra work.  So is_objArray() objects
+    // are nominated too (with G1EagerReclaimHumongousObjArrays), but
+    // only if they satisfy the constraints above.
     //
     // We also treat is_typeArray() objects specially, allowing them
     // to be reclaimed even if allocated before the start of
@@ -2576,8 +2637,22 @@ class RegisterHumongousWithInCSetFastTestClosure : public HeapRegionClosure {
     // important use case for eager reclaim, and this special handling
     // may reduce needed headroom.
 
-    return obj->is_typeArray() &&
-           g1h->is_potential_eager_reclaim_candidate(region);
+    if (obj->is_typeArray()) {
+      return g1h->is_potential_eager_reclaim_candidate(region);
+    }
+
+    if (!G1EagerReclaimHumongousObjArrays || !obj->is_objArray()) {
+      return false;
+    }
+    // While marking is in progress only objects allocated after the start of
+    // marking may be reclaimed. After remark the next TAMS of all regions is
+    // reset to bottom, and all objects live at the start of marking have
+    // been scanned, so the same test also serves the rebuild phase.
+    if (g1h->collector_state()->mark_or_rebuild_in_progress() &&
+        region->next_top_at_mark_start() != region->bottom()) {
+      return false;
+    }
+    return g1h->is_potential_eager_reclaim_candidate(region);
   }
 
  public:
@@ -2934,11 +3009,17 @@ G1CollectedHeap::do_collection_pause_at_safepoint(double target_pause_time_ms) {
         // Initialize the GC alloc regions.
         _allocator->init_gc_alloc_regions(evacuation_info);
 
-        G1ParScanThreadStateSet per_thread_states(this, workers()->active_workers(), collection_set()->young_region_length());
+        G1ParScanThreadStateSet per_thread_states(this,
+                                                  workers()->active_workers(),
+                                                  collection_set()->young_region_length(),
+                                                  collection_set()->optional_region_length());
         pre_evacuate_collection_set();
 
         // Actually do the work...
         evacuate_collection_set(&per_thread_states);
+        evacuate_optional_collection_set(&per_thread_states);
+
+        evacuation_info.set_collectionset_regions(collection_set()->region_length());
 
         post_evacuate_collection_set(evacuation_info, &per_thread_states);
 
@@ -2981,10 +3062,6 @@ G1CollectedHeap::do_collection_pause_at_safepoint(double target_pause_time_ms) {
           // the current thread has completed its logging output.
         }
 
-        allocate_dummy_regions();
-
-        _allocator->init_mutator_alloc_region();
-
         {
           size_t expand_bytes = _heap_sizing_policy->expansion_amount();
           if (expand_bytes > 0) {
@@ -2996,9 +3073,20 @@ G1CollectedHeap::do_collection_pause_at_safepoint(double target_pause_time_ms) {
               // We failed to expand the heap. Cannot do anything about it.
             }
             g1_policy()->phase_times()->record_expand_heap_time(expand_ms);
+          } else {
+            // Shrink before the new mutator alloc region is set up, as
+            // shrinking may remove any empty committed region.
+            size_t shrink_bytes = _heap_sizing_policy->shrink_amount();
+            if (shrink_bytes > 0) {
+              shrink(shrink_bytes);
+            }
           }
         }
 
+        allocate_dummy_regions();
+
+        _allocator->init_mutator_alloc_region();
+
         // We redo the verification but now wrt to the new CSet which
         // has just got initialized after the previous CSet was freed.
         _cm->verify_no_cset_oops();
@@ -3037,8 +3125,10 @@ G1CollectedHeap::do_collection_pause_at_safepoint(double target_pause_time_ms) {
     }
 
     // Print the remainder of the GC log output.
-    if (evacuation_failed()) {
+    if (to_space_exhausted()) {
       log_info(gc)("To-space exhausted");
+    } else if (evacuation_failed()) {
+      log_debug(gc)("Retained pinned regions");
     }
 
     g1_policy()->print_phases();
@@ -3089,8 +3179,13 @@ G1CollectedHeap::do_collection_pause_at_safepoint(double target_pause_time_ms) {
 }
 
 void G1CollectedHeap::remove_self_forwarding_pointers() {
-  G1ParRemoveSelfForwardPtrsTask rsfp_task;
+  G1EvacFailureRegions evac_failure_regions;
+
+  G1ParRemoveSelfForwardPtrsTask rsfp_task(&evac_failure_regions);
   workers()->run_task(&rsfp_task);
+
+  G1ParRebuildEvacFailedRegionsTask rebuild_task(&evac_failure_regions);
+  workers()->run_task(&rebuild_task);
 }
 
 void G1CollectedHeap::restore_after_evac_failure() {
@@ -3103,12 +3198,17 @@ void G1CollectedHeap::restore_after_evac_failure() {
   g1_policy()->phase_times()->record_evac_fail_remove_self_forwards((os::elapsedTime() - remove_self_forwards_start) * 1000.0);
 }
 
-void G1CollectedHeap::preserve_mark_during_evac_failure(uint worker_id, oop obj, markOop m) {
+void G1CollectedHeap::preserve_mark_during_evac_failure(uint worker_id, oop obj, markOop m, bool pinned) {
   if (!_evacuation_failed) {
     _evacuation_failed = true;
   }
 
-  _evacuation_failed_info_array[worker_id].register_copy_failure(obj->size());
+  if (!pinned) {
+    if (!_to_space_exhausted) {
+      _to_space_exhausted = true;
+    }
+    _evacuation_failed_info_array[worker_id].register_copy_failure(obj->size());
+  }
   _preserved_marks_set.get(worker_id)->push_if_necessary(obj, m);
 }
 
@@ -3217,6 +3317,87 @@ public:
   }
 };
 
+class G1EvacuateOptionalRegionTask : public AbstractGangTask {
+  G1CollectedHeap* _g1h;
+  G1ParScanThreadStateSet* _per_thread_states;
+  RefToScanQueueSet* _queues;
+  ParallelTaskTerminator _terminator;
+  uint _n_workers;
+  // The optional regions evacuated by this task are [_start, _end).
+  uint _start;
+  uint _end;
+
+  void scan_roots(G1ParScanThreadState* pss, uint worker_id) {
+    G1GCPhaseTimes* p = _g1h->g1_policy()->phase_times();
+
+    // Process the references into the regions recorded so far.
+    G1ScanObjsDuringScanRSClosure obj_cl(_g1h, pss);
+    OopClosure* root_cl = pss->closures()->raw_strong_oops();
+    G1CollectionSet* cset = _g1h->collection_set();
+
+    Tickspan scan_time;
+    Tickspan trim_time;
+    size_t scanned_refs = 0;
+    {
+      G1EvacPhaseWithTrimTimeTracker timer(pss, scan_time, trim_time);
+      for (uint i = _start; i < _end; i++) {
+        HeapRegion* hr = cset->optional_region_at(i);
+        scanned_refs += pss->oops_into_optional_region(hr)->oops_do(&obj_cl, root_cl);
+      }
+    }
+    p->record_or_add_time_secs(G1GCPhaseTimes::OptScanRS, worker_id, scan_time.seconds());
+    p->record_or_add_time_secs(G1GCPhaseTimes::OptObjCopy, worker_id, trim_time.seconds());
+    p->record_or_add_thread_work_item(G1GCPhaseTimes::OptScanRS, worker_id, scanned_refs, G1GCPhaseTimes::ScanRSScannedOptionalRefs);
+
+    // The remembered sets of the regions scanned during earlier rounds are
+    // already complete, so this only scans the ones of the new regions.
+    _g1h->g1_rem_set()->scan_rem_set(pss, worker_id, G1GCPhaseTimes::OptScanRS, G1GCPhaseTimes::OptObjCopy, G1GCPhaseTimes::OptCodeRoots);
+  }
+
+  void evacuate_live_objects(G1ParScanThreadState* pss, uint worker_id) {
+    double start = os::elapsedTime();
+    G1ParEvacuateFollowersClosure cl(_g1h, pss, _queues, &_terminator);
+    cl.do_void();
+
+    double elapsed_sec = os::elapsedTime() - start;
+    G1GCPhaseTimes* p = _g1h->g1_policy()->phase_times();
+    p->record_or_add_time_secs(G1GCPhaseTimes::OptObjCopy, worker_id, elapsed_sec - cl.term_time());
+    p->record_or_add_time_secs(G1GCPhaseTimes::OptTermination, worker_id, cl.term_time());
+    p->record_or_add_thread_work_item(G1GCPhaseTimes::OptTermination, worker_id, cl.term_attempts());
+  }
+
+public:
+  G1EvacuateOptionalRegionTask(G1CollectedHeap* g1h,
+                               G1ParScanThreadStateSet* per_thread_states,
+                               RefToScanQueueSet* queues,
+                               uint n_workers,
+                               uint start,
+                               uint end) :
+    AbstractGangTask("G1 Evacuation Optional Region Task"),
+    _g1h(g1h),
+    _per_thread_states(per_thread_states),
+    _queues(queues),
+    _terminator(n_workers, _queues),
+    _n_workers(n_workers),
+    _start(start),
+    _end(end) {
+  }
+
+  void work(uint worker_id) {
+    if (worker_id >= _n_workers) return;  // no work needed this round
+
+    ResourceMark rm;
+    HandleMark  hm;
+    G1ParScanThreadState* pss = _per_thread_states->state_for_worker(worker_id);
+    pss->set_ref_discoverer(_g1h->ref_processor_stw());
+
+    scan_roots(pss, worker_id);
+    evacuate_live_objects(pss, worker_id);
+
+    assert(pss->queue_is_empty(), "should be empty");
+  }
+};
+
 void G1CollectedHeap::print_termination_stats_hdr() {
   log_debug(gc, task, stats)("GC Termination Stats");
   log_debug(gc, task, stats)("     elapsed  --strong roots-- -------termination------- ------waste (KiB)------");
@@ -3976,6 +4157,7 @@ void G1CollectedHeap::merge_per_thread_state_info(G1ParScanThreadStateSet* per_t
 void G1CollectedHeap::pre_evacuate_collection_set() {
   _expand_heap_after_alloc_failure = true;
   _evacuation_failed = false;
+  _to_space_exhausted = false;
 
   // Disable the hot card cache.
   _hot_card_cache->reset_hot_cache_claimed_index();
@@ -4033,6 +4215,46 @@ void G1CollectedHeap::evacuate_collection_set(G1ParScanThreadStateSet* per_threa
   phase_times->record_code_root_fixup_time(code_root_fixup_time_ms);
 }
 
+void G1CollectedHeap::evacuate_optional_regions(G1ParScanThreadStateSet* per_thread_states, uint start, uint end) {
+  const uint n_workers = workers()->active_workers();
+  G1EvacuateOptionalRegionTask task(this, per_thread_states, _task_queues, n_workers, start, end);
+  workers()->run_task(&task);
+}
+
+void G1CollectedHeap::evacuate_optional_collection_set(G1ParScanThreadStateSet* per_thread_states) {
+  G1CollectionSet* cset = collection_set();
+  if (cset->optional_region_length() == 0) {
+    return;
+  }
+
+  G1GCPhaseTimes* phase_times = g1_policy()->phase_times();
+  const double pause_start_ms = phase_times->cur_collection_start_sec() * 1000.0;
+  const double max_pause_time_ms = g1_policy()->max_pause_time_ms();
+
+  while (!to_space_exhausted() && cset->optional_regions_remaining() > 0) {
+    double time_used_ms = os::elapsedTime() * 1000.0 - pause_start_ms;
+    double time_left_ms = max_pause_time_ms - time_used_ms;
+    if (time_left_ms <= 0.0) {
+      log_trace(gc, ergo, cset)("Skip evacuating optional regions, no time left. used: %1.2fms, max: %1.2fms",
+                                time_used_ms, max_pause_time_ms);
+      break;
+    }
+
+    uint start;
+    uint end;
+    cset->move_optional_regions_to_collection_set(time_left_ms * g1_policy()->optional_evacuation_fraction(), start, end);
+    for (uint i = start; i < end; i++) {
+      g1_rem_set()->exclude_region_from_scan(cset->optional_region_at(i)->hrm_index());
+    }
+
+    double start_time_sec = os::elapsedTime();
+    evacuate_optional_regions(per_thread_states, start, end);
+    phase_times->record_optional_evacuation((os::elapsedTime() - start_time_sec) * 1000.0);
+  }
+
+  cset->abandon_optional_collection_set();
+}
+
 void G1CollectedHeap::post_evacuate_collection_set(EvacuationInfo& evacuation_info, G1ParScanThreadStateSet* per_thread_states) {
   // Also cleans the card table from temporary duplicate detection information used
   // during UpdateRS/ScanRS.
@@ -4169,13 +4391,9 @@ void G1CollectedHeap::decrement_summary_bytes(size_t bytes) {
 class G1FreeCollectionSetTask : public AbstractGangTask {
 private:
 
-  // Closure applied to all regions in the collection set to do work that needs to
-  // be done serially in a single thread.
-  class G1SerialFreeCollectionSetClosure : public HeapRegionClosure {
-  private:
-    EvacuationInfo* _evacuation_info;
-    const size_t* _surviving_young_words;
-
+  // Statistics gathered by a single worker while freeing its part of the
+  // collection set. They are merged into the totals once per worker.
+  struct FreeCSetStats {
     // Bytes used in successfully evacuated regions before the evacuation.
     size_t _before_used_bytes;
     // Bytes used in unsucessfully evacuated regions before the evacuation
@@ -4186,96 +4404,35 @@ private:
     size_t _failure_used_words;
     size_t _failure_waste_words;
 
-    FreeRegionList _local_free_list;
-  public:
-    G1SerialFreeCollectionSetClosure(EvacuationInfo* evacuation_info, const size_t* surviving_young_words) :
-      HeapRegionClosure(),
-      _evacuation_info(evacuation_info),
-      _surviving_young_words(surviving_young_words),
+    size_t _rs_lengths;
+    size_t _regions_freed;
+
+    FreeCSetStats() :
       _before_used_bytes(0),
       _after_used_bytes(0),
       _bytes_allocated_in_old_since_last_gc(0),
       _failure_used_words(0),
       _failure_waste_words(0),
-      _local_free_list("Local Region List for CSet Freeing") {
-    }
-
-    virtual bool do_heap_region(HeapRegion* r) {
-      G1CollectedHeap* g1h = G1CollectedHeap::heap();
-
-      assert(r->in_collection_set(), "Region %u should be in collection set.", r->hrm_index());
-      g1h->clear_in_cset(r);
-
-      if (r->is_young()) {
-        assert(r->young_index_in_cset() != -1 && (uint)r->young_index_in_cset() < g1h->collection_set()->young_region_length(),
-               "Young index %d is wrong for region %u of type %s with %u young regions",
-               r->young_index_in_cset(),
-               r->hrm_index(),
-               r->get_type_str(),
-               g1h->collection_set()->young_region_length());
-        size_t words_survived = _surviving_young_words[r->young_index_in_cset()];
-        r->record_surv_words_in_group(words_survived);
-      }
-
-      if (!r->evacuation_failed()) {
-        assert(r->not_empty(), "Region %u is an empty region in the collection set.", r->hrm_index());
-        _before_used_bytes += r->used();
-        g1h->free_region(r,
-                         &_local_free_list,
-                         true, /* skip_remset */
-                         true, /* skip_hot_card_cache */
-                         true  /* locked */);
-      } else {
-        r->uninstall_surv_rate_group();
-        r->set_young_index_in_cset(-1);
-        r->set_evacuation_failed(false);
-        // When moving a young gen region to old gen, we "allocate" that whole region
-        // there. This is in addition to any already evacuated objects. Notify the
-        // policy about that.
-        // Old gen regions do not cause an additional allocation: both the objects
-        // still in the region and the ones already moved are accounted for elsewhere.
-        if (r->is_young()) {
-          _bytes_allocated_in_old_since_last_gc += HeapRegion::GrainBytes;
-        }
-        // The region is now considered to be old.
-        r->set_old();
-        // Do some allocation statistics accounting. Regions that failed evacuation
-        // are always made old, so there is no need to update anything in the young
-        // gen statistics, but we need to update old gen statistics.
-        size_t used_words = r->marked_bytes() / HeapWordSize;
-
-        _failure_used_words += used_words;
-        _failure_waste_words += HeapRegion::GrainWords - used_words;
-
-        g1h->old_set_add(r);
-        _after_used_bytes += r->used();
-      }
-      return false;
-    }
-
-    void complete_work() {
-      G1CollectedHeap* g1h = G1CollectedHeap::heap();
-
-      _evacuation_info->set_regions_freed(_local_free_list.length());
-      _evacuation_info->increment_collectionset_used_after(_after_used_bytes);
-
-      g1h->prepend_to_freelist(&_local_free_list);
-      g1h->decrement_summary_bytes(_before_used_bytes);
-
-      G1Policy* policy = g1h->g1_policy();
-      policy->add_bytes_allocated_in_old_since_last_gc(_bytes_allocated_in_old_since_last_gc);
-
-      g1h->alloc_buffer_stats(InCSetState::Old)->add_failure_used_and_waste(_failure_used_words, _failure_waste_words);
+      _rs_lengths(0),
+      _regions_freed(0) { }
+
+    void merge_into(FreeCSetStats* total) const {
+      Atomic::add(_before_used_bytes, &total->_before_used_bytes);
+      Atomic::add(_after_used_bytes, &total->_after_used_bytes);
+      Atomic::add(_bytes_allocated_in_old_since_last_gc, &total->_bytes_allocated_in_old_since_last_gc);
+      Atomic::add(_failure_used_words, &total->_failure_used_words);
+      Atomic::add(_failure_waste_words, &total->_failure_waste_words);
+      Atomic::add(_rs_lengths, &total->_rs_lengths);
+      Atomic::add(_regions_freed, &total->_regions_freed);
     }
   };
 
+  G1CollectedHeap* _g1h;
   G1CollectionSet* _collection_set;
-  G1SerialFreeCollectionSetClosure _cl;
+  EvacuationInfo* _evacuation_info;
   const size_t* _surviving_young_words;
 
-  size_t _rs_lengths;
-
-  volatile jint _serial_work_claim;
+  FreeCSetStats _total_stats;
 
   struct WorkItem {
     uint region_idx;
@@ -4293,26 +4450,74 @@ private:
   size_t _num_work_items;
   WorkItem* _work_items;
 
-  void do_serial_work() {
-    // Need to grab the lock to be allowed to modify the old region list.
-    MutexLockerEx x(OldSets_lock, Mutex::_no_safepoint_check_flag);
-    _collection_set->iterate(&_cl);
+  void handle_evacuated_region(HeapRegion* r, FreeRegionList* free_list, FreeCSetStats* stats) {
+    assert(r->not_empty(), "Region %u is an empty region in the collection set.", r->hrm_index());
+    stats->_before_used_bytes += r->used();
+    stats->_regions_freed++;
+    _g1h->free_region(r,
+                      free_list,
+                      true, /* skip_remset */
+                      true, /* skip_hot_card_cache */
+                      true  /* locked */);
   }
 
-  void do_parallel_work_for_region(uint region_idx, bool is_young, bool evacuation_failed) {
-    G1CollectedHeap* g1h = G1CollectedHeap::heap();
+  void handle_failed_region(HeapRegion* r, FreeCSetStats* stats) {
+    r->uninstall_surv_rate_group();
+    r->set_young_index_in_cset(-1);
+    r->set_evacuation_failed(false);
+    // When moving a young gen region to old gen, we "allocate" that whole region
+    // there. This is in addition to any already evacuated objects. Notify the
+    // policy about that.
+    // Old gen regions do not cause an additional allocation: both the objects
+    // still in the region and the ones already moved are accounted for elsewhere.
+    if (r->is_young()) {
+      stats->_bytes_allocated_in_old_since_last_gc += HeapRegion::GrainBytes;
+    }
+    // The region is now considered to be old.
+    r->set_old();
+    // Do some allocation statistics accounting. Regions that failed evacuation
+    // are always made old, so there is no need to update anything in the young
+    // gen statistics, but we need to update old gen statistics.
+    size_t used_words = r->marked_bytes() / HeapWordSize;
 
-    HeapRegion* r = g1h->region_at(region_idx);
-    assert(!g1h->is_on_master_free_list(r), "sanity");
+    stats->_failure_used_words += used_words;
+    stats->_failure_waste_words += HeapRegion::GrainWords - used_words;
 
-    Atomic::add(r->rem_set()->occupied_locked(), &_rs_lengths);
+    {
+      // Need to grab the lock to be allowed to modify the old region list.
+      MutexLockerEx x(OldSets_lock, Mutex::_no_safepoint_check_flag);
+      _g1h->old_set_add(r);
+    }
+    stats->_after_used_bytes += r->used();
+  }
+
+  void do_work_for_region(const WorkItem& item, FreeRegionList* free_list, FreeCSetStats* stats) {
+    HeapRegion* r = _g1h->region_at(item.region_idx);
+    assert(!_g1h->is_on_master_free_list(r), "sanity");
+    assert(r->in_collection_set(), "Region %u should be in collection set.", r->hrm_index());
 
-    if (!is_young) {
-      g1h->_hot_card_cache->reset_card_counts(r);
+    _g1h->clear_in_cset(r);
+
+    stats->_rs_lengths += r->rem_set()->occupied_locked();
+
+    if (item.is_young) {
+      assert(r->young_index_in_cset() != -1 && (uint)r->young_index_in_cset() < _collection_set->young_region_length(),
+             "Young index %d is wrong for region %u of type %s with %u young regions",
+             r->young_index_in_cset(),
+             r->hrm_index(),
+             r->get_type_str(),
+             _collection_set->young_region_length());
+      size_t words_survived = _surviving_young_words[r->young_index_in_cset()];
+      r->record_surv_words_in_group(words_survived);
+    } else {
+      _g1h->_hot_card_cache->reset_card_counts(r);
     }
 
-    if (!evacuation_failed) {
+    if (!item.evacuation_failed) {
       r->rem_set()->clear_locked();
+      handle_evacuated_region(r, free_list, stats);
+    } else {
+      handle_failed_region(r, stats);
     }
   }
 
@@ -4335,20 +4540,32 @@ private:
   }
 
   void complete_work() {
-    _cl.complete_work();
+    double serial_time = os::elapsedTime();
 
-    G1Policy* policy = G1CollectedHeap::heap()->g1_policy();
-    policy->record_max_rs_lengths(_rs_lengths);
+    _evacuation_info->set_regions_freed((uint)_total_stats._regions_freed);
+    _evacuation_info->increment_collectionset_used_after(_total_stats._after_used_bytes);
+
+    _g1h->decrement_summary_bytes(_total_stats._before_used_bytes);
+
+    G1Policy* policy = _g1h->g1_policy();
+    policy->add_bytes_allocated_in_old_since_last_gc(_total_stats._bytes_allocated_in_old_since_last_gc);
+
+    _g1h->alloc_buffer_stats(InCSetState::Old)->add_failure_used_and_waste(_total_stats._failure_used_words,
+                                                                            _total_stats._failure_waste_words);
+
+    policy->record_max_rs_lengths(_total_stats._rs_lengths);
     policy->cset_regions_freed();
+
+    policy->phase_times()->record_serial_free_cset_time_ms((os::elapsedTime() - serial_time) * 1000.0);
   }
 public:
   G1FreeCollectionSetTask(G1CollectionSet* collection_set, EvacuationInfo* evacuation_info, const size_t* surviving_young_words) :
     AbstractGangTask("G1 Free Collection Set"),
-    _cl(evacuation_info, surviving_young_words),
+    _g1h(G1CollectedHeap::heap()),
     _collection_set(collection_set),
+    _evacuation_info(evacuation_info),
     _surviving_young_words(surviving_young_words),
-    _serial_work_claim(0),
-    _rs_lengths(0),
+    _total_stats(),
     _parallel_work_claim(0),
     _num_work_items(collection_set->region_length()),
     _work_items(NEW_C_HEAP_ARRAY(WorkItem, _num_work_items, mtGC)) {
@@ -4365,19 +4582,11 @@ public:
   static uint chunk_size() { return 32; }
 
   virtual void work(uint worker_id) {
-    G1GCPhaseTimes* timer = G1CollectedHeap::heap()->g1_policy()->phase_times();
-
-    // Claim serial work.
-    if (_serial_work_claim == 0) {
-      jint value = Atomic::add(1, &_serial_work_claim) - 1;
-      if (value == 0) {
-        double serial_time = os::elapsedTime();
-        do_serial_work();
-        timer->record_serial_free_cset_time_ms((os::elapsedTime() - serial_time) * 1000.0);
-      }
-    }
+    G1GCPhaseTimes* timer = _g1h->g1_policy()->phase_times();
+
+    FreeRegionList local_free_list("Local Region List for CSet Freeing");
+    FreeCSetStats stats;
 
-    // Start parallel work.
     double young_time = 0.0;
     bool has_young_time = false;
     double non_young_time = 0.0;
@@ -4398,7 +4607,7 @@ public:
       for (; cur < end; cur++) {
         bool is_young = _work_items[cur].is_young;
 
-        do_parallel_work_for_region(_work_items[cur].region_idx, is_young, _work_items[cur].evacuation_failed);
+        do_work_for_region(_work_items[cur], &local_free_list, &stats);
 
         double end_time = os::elapsedTime();
         double time_taken = end_time - start_time;
@@ -4413,6 +4622,10 @@ public:
       }
     }
 
+    // Publish the results of this worker.
+    _g1h->prepend_to_freelist(&local_free_list);
+    stats.merge_into(&_total_stats);
+
     if (has_young_time) {
       timer->record_time_secs(G1GCPhaseTimes::YoungFreeCSet, worker_id, young_time);
     }
@@ -4491,10 +4704,10 @@ class G1FreeHumongousRegionClosure : public HeapRegionClosure {
     // are completely up-to-date wrt to references to the humongous object.
     //
     // Other implementation considerations:
-    // - never consider object arrays at this time because they would pose
-    // considerable effort for cleaning up the the remembered sets. This is
-    // required because stale remembered sets might reference locations that
-    // are currently allocated into.
+    // - object arrays are only considered if G1EagerReclaimHumongousObjArrays
+    // is set. Their outgoing references leave stale remembered set entries in
+    // other regions that might reference locations that are allocated into
+    // later. These are treated like the stale entries of any other freed region.
     uint region_idx = r->hrm_index();
     if (!g1h->is_humongous_reclaim_candidate(region_idx) ||
         !r->rem_set()->is_empty()) {
@@ -4511,9 +4724,9 @@ class G1FreeHumongousRegionClosure : public HeapRegionClosure {
       return false;
     }
 
-    guarantee(obj->is_typeArray(),
-              "Only eagerly reclaiming type arrays is supported, but the object "
-              PTR_FORMAT " is not.", p2i(r->bottom()));
+    guarantee(obj->is_typeArray() || (G1EagerReclaimHumongousObjArrays && obj->is_objArray()),
+              "Only eagerly reclaiming type arrays and object arrays is supported, but the object "
+              PTR_FORMAT " is neither.", p2i(r->bottom()));
 
     log_debug(gc, humongous)("Dead humongous region %u object size " SIZE_FORMAT " start " PTR_FORMAT " with remset " SIZE_FORMAT " code roots " SIZE_FORMAT " is marked %d reclaim candidate %d type array %d",
                              region_idx,
@@ -4784,13 +4997,15 @@ bool G1CollectedHeap::is_in_closed_subset(const void* p) const {
 // Methods for the mutator alloc region
 
 HeapRegion* G1CollectedHeap::new_mutator_alloc_region(size_t word_size,
-                                                      bool force) {
+                                                      bool force,
+                                                      uint node_index) {
   assert_heap_locked_or_at_safepoint(true /* should_be_vm_thread */);
   bool should_allocate = g1_policy()->should_allocate_mutator_region();
   if (force || should_allocate) {
     HeapRegion* new_alloc_region = new_region(word_size,
                                               false /* is_old */,
-                                              false /* do_expand */);
+                                              false /* do_expand */,
+                                              node_index);
     if (new_alloc_region != NULL) {
       set_region_short_lived_locked(new_alloc_region);
       _hr_printer.alloc(new_alloc_region, !should_allocate);
@@ -4826,7 +5041,7 @@ bool G1CollectedHeap::has_more_regions(InCSetState dest) {
   }
 }
 
-HeapRegion* G1CollectedHeap::new_gc_alloc_region(size_t word_size, InCSetState dest) {
+HeapRegion* G1CollectedHeap::new_gc_alloc_region(size_t word_size, InCSetState dest, uint node_index) {
   assert(FreeList_lock->owned_by_self(), "pre-condition");
 
   if (!has_more_regions(dest)) {
@@ -4837,7 +5052,8 @@ HeapRegion* G1CollectedHeap::new_gc_alloc_region(size_t word_size, InCSetState d
 
   HeapRegion* new_alloc_region = new_region(word_size,
                                             !is_survivor,
-                                            true /* do_expand */);
+                                            true /* do_expand */,
+                                            node_index);
   if (new_alloc_region != NULL) {
     if (is_survivor) {
       new_alloc_region->set_survivor();
@@ -4945,6 +5161,23 @@ bool G1CollectedHeap::is_scavengable(oop obj) {
   return !hr->is_pinned();
 }
 
+bool G1CollectedHeap::supports_object_pinning() const {
+  return G1UseRegionPinning;
+}
+
+oop G1CollectedHeap::pin_object(JavaThread* thread, oop obj) {
+  assert(G1UseRegionPinning, "must be");
+  // The caller is in VM state, so no GC can happen before the region
+  // has been marked as containing a pinned object.
+  heap_region_containing(obj)->increment_pinned_object_count();
+  return obj;
+}
+
+void G1CollectedHeap::unpin_object(JavaThread* thread, oop obj) {
+  assert(G1UseRegionPinning, "must be");
+  heap_region_containing(obj)->decrement_pinned_object_count();
+}
+
 void G1CollectedHeap::register_nmethod(nmethod* nm) {
   guarantee(nm != NULL, "sanity");
   RegisterNMethodOopClosure reg_cl(this, nm);
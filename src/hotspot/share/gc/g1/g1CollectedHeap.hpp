@@ -40,6 +40,7 @@
 #include "gc/g1/g1HRPrinter.hpp"
 #include "gc/g1/g1InCSetState.hpp"
 #include "gc/g1/g1MonitoringSupport.hpp"
+#include "gc/g1/g1NUMA.hpp"
 #include "gc/g1/g1SurvivorRegions.hpp"
 #include "gc/g1/g1YCTypes.hpp"
 #include "gc/g1/heapRegionManager.hpp"
@@ -209,6 +210,9 @@ private:
   // The sequence of all heap regions in the heap.
   HeapRegionManager _hrm;
 
+  // NUMA node information, used for placing regions and allocations.
+  G1NUMA* _numa;
+
   // Manages all allocations with regions except humongous object allocations.
   G1Allocator* _allocator;
 
@@ -278,6 +282,7 @@ private:
   // (c) cause == _java_lang_system_gc and +ExplicitGCInvokesConcurrent.
   // (d) cause == _dcmd_gc_run and +ExplicitGCInvokesConcurrent.
   // (e) cause == _wb_conc_mark
+  // (f) cause == _g1_periodic_collection and +G1PeriodicGCInvokesConcurrent.
   bool should_do_concurrent_full_gc(GCCause::Cause cause);
 
   // indicates whether we are in young or mixed GC mode
@@ -384,7 +389,11 @@ private:
   // attempt to expand the heap if necessary to satisfy the allocation
   // request. If the region is to be used as an old region or for a
   // humongous object, set is_old to true. If not, to false.
-  HeapRegion* new_region(size_t word_size, bool is_old, bool do_expand);
+  // If NUMA is enabled, regions located on node_index are preferred.
+  HeapRegion* new_region(size_t word_size,
+                         bool is_old,
+                         bool do_expand,
+                         uint node_index = G1NUMA::AnyNodeIndex);
 
   // Initialize a contiguous set of free regions of length num_regions
   // and starting at index first so that they appear as a single
@@ -459,13 +468,13 @@ private:
   // These methods are the "callbacks" from the G1AllocRegion class.
 
   // For mutator alloc regions.
-  HeapRegion* new_mutator_alloc_region(size_t word_size, bool force);
+  HeapRegion* new_mutator_alloc_region(size_t word_size, bool force, uint node_index);
   void retire_mutator_alloc_region(HeapRegion* alloc_region,
                                    size_t allocated_bytes);
 
   // For GC alloc regions.
   bool has_more_regions(InCSetState dest);
-  HeapRegion* new_gc_alloc_region(size_t word_size, InCSetState dest);
+  HeapRegion* new_gc_alloc_region(size_t word_size, InCSetState dest, uint node_index);
   void retire_gc_alloc_region(HeapRegion* alloc_region,
                               size_t allocated_bytes, InCSetState dest);
 
@@ -481,9 +490,6 @@ private:
   // Callback from VM_G1CollectFull operation, or collect_as_vm_thread.
   virtual void do_full_collection(bool clear_all_soft_refs);
 
-  // Resize the heap if necessary after a full collection.
-  void resize_if_necessary_after_full_collection();
-
   // Callback from VM_G1CollectForAllocation operation.
   // This function does everything necessary/possible to satisfy a
   // failed allocation request (including collection, expansion, etc.)
@@ -532,6 +538,10 @@ public:
     return _allocator;
   }
 
+  G1NUMA* numa() const {
+    return _numa;
+  }
+
   G1HeapVerifier* verifier() {
     return _verifier;
   }
@@ -582,6 +592,9 @@ public:
   void register_old_region_with_cset(HeapRegion* r) {
     _in_cset_fast_test.set_in_old(r->hrm_index());
   }
+  void register_optional_region_with_cset(HeapRegion* r) {
+    _in_cset_fast_test.set_optional(r->hrm_index());
+  }
   void clear_in_cset(const HeapRegion* hr) {
     _in_cset_fast_test.clear(hr);
   }
@@ -701,6 +714,18 @@ public:
 
   oop materialize_archived_object(oop obj);
 
+  // Resize the heap if necessary after a full collection or remark.
+  void resize_heap_if_necessary();
+
+  // Returns whether there are regions whose memory still needs to be given
+  // back to the operating system after shrinking the heap.
+  bool has_uncommit_pending_regions() const { return _hrm.num_uncommit_pending() > 0; }
+
+  // Uncommit the memory of at most G1UncommitChunkSize bytes worth of regions
+  // pending uncommit. Called concurrently, takes the Heap_lock. Returns the
+  // number of regions uncommitted.
+  uint uncommit_pending_regions_chunk();
+
 private:
 
   // Shrink the garbage-first heap by at most the given size (in bytes!).
@@ -738,6 +763,10 @@ private:
 
   // Actually do the work of evacuating the collection set.
   void evacuate_collection_set(G1ParScanThreadStateSet* per_thread_states);
+  // Evacuate optional collection set regions while there is time left in
+  // the pause, then return the remaining ones to the candidates.
+  void evacuate_optional_collection_set(G1ParScanThreadStateSet* per_thread_states);
+  void evacuate_optional_regions(G1ParScanThreadStateSet* per_thread_states, uint start, uint end);
 
   void pre_evacuate_collection_set();
   void post_evacuate_collection_set(EvacuationInfo& evacuation_info, G1ParScanThreadStateSet* pss);
@@ -786,6 +815,11 @@ private:
   // True iff a evacuation has failed in the current collection.
   bool _evacuation_failed;
 
+  // True iff an evacuation has failed in the current collection because
+  // there was no space to copy objects to. Evacuation failures caused by
+  // pinned regions do not count.
+  bool _to_space_exhausted;
+
   EvacuationFailedInfo* _evacuation_failed_info_array;
 
   // Failed evacuations cause some logical from-space objects to have
@@ -799,8 +833,9 @@ private:
   PreservedMarksSet _preserved_marks_set;
 
   // Preserve the mark of "obj", if necessary, in preparation for its mark
-  // word being overwritten with a self-forwarding-pointer.
-  void preserve_mark_during_evac_failure(uint worker_id, oop obj, markOop m);
+  // word being overwritten with a self-forwarding-pointer. "pinned" indicates
+  // that evacuation failed because "obj" is located in a pinned region.
+  void preserve_mark_during_evac_failure(uint worker_id, oop obj, markOop m, bool pinned);
 
 #ifndef PRODUCT
   // Support for forcing evacuation failures. Analogous to
@@ -1065,6 +1100,10 @@ public:
   // True iff an evacuation has failed in the most-recent collection.
   bool evacuation_failed() { return _evacuation_failed; }
 
+  // True iff an evacuation has failed in the most-recent collection due to
+  // lack of space in the heap.
+  bool to_space_exhausted() { return _to_space_exhausted; }
+
   void remove_from_old_sets(const uint old_regions_removed, const uint humongous_regions_removed);
   void prepend_to_freelist(FreeRegionList* list);
   void decrement_summary_bytes(size_t bytes);
@@ -1123,6 +1162,12 @@ public:
     object_iterate(cl);
   }
 
+  // Iterate over all objects in the regions claimed through the given
+  // claimer, calling "cl.do_object" on each.
+  void object_iterate_parallel(ObjectClosure* cl, uint worker_id, HeapRegionClaimer* claimer);
+
+  virtual ParallelObjectIterator* parallel_object_iterator(uint thread_num);
+
   // Iterate over heap regions, in address order, terminating the
   // iteration early if the "do_heap_region" method returns "true".
   void heap_region_iterate(HeapRegionClosure* blk) const;
@@ -1311,6 +1356,11 @@ public:
   // Is an oop scavengeable
   virtual bool is_scavengable(oop obj);
 
+  // Object pinning support for JNI critical sections, see G1UseRegionPinning.
+  virtual bool supports_object_pinning() const;
+  virtual oop pin_object(JavaThread* thread, oop obj);
+  virtual void unpin_object(JavaThread* thread, oop obj);
+
   // Register the given nmethod with the G1 heap.
   virtual void register_nmethod(nmethod* nm);
 
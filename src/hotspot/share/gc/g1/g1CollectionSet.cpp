@@ -62,6 +62,10 @@ G1CollectionSet::G1CollectionSet(G1CollectedHeap* g1h, G1Policy* policy) :
   _collection_set_regions(NULL),
   _collection_set_cur_length(0),
   _collection_set_max_length(0),
+  _optional_regions(NULL),
+  _optional_region_length(0),
+  _optional_region_max_length(0),
+  _optional_region_cur(0),
   // Incremental CSet attributes
   _inc_build_state(Inactive),
   _inc_bytes_used_before(0),
@@ -75,6 +79,9 @@ G1CollectionSet::~G1CollectionSet() {
   if (_collection_set_regions != NULL) {
     FREE_C_HEAP_ARRAY(uint, _collection_set_regions);
   }
+  if (_optional_regions != NULL) {
+    FREE_C_HEAP_ARRAY(HeapRegion*, _optional_regions);
+  }
   delete _cset_chooser;
 }
 
@@ -95,6 +102,8 @@ void G1CollectionSet::initialize(uint max_region_length) {
   guarantee(_collection_set_regions == NULL, "Must only initialize once.");
   _collection_set_max_length = max_region_length;
   _collection_set_regions = NEW_C_HEAP_ARRAY(uint, max_region_length, mtGC);
+  _optional_region_max_length = max_region_length;
+  _optional_regions = NEW_C_HEAP_ARRAY(HeapRegion*, _optional_region_max_length, mtGC);
 }
 
 void G1CollectionSet::set_recorded_rs_lengths(size_t rs_lengths) {
@@ -120,6 +129,18 @@ void G1CollectionSet::add_old_region(HeapRegion* hr) {
   _old_region_length += 1;
 }
 
+void G1CollectionSet::add_optional_region(HeapRegion* hr) {
+  assert(!optional_is_full(), "Precondition, must have room left for this region");
+  assert(hr->is_old(), "the region should be old");
+  assert(!hr->in_collection_set(), "should not already be in the CSet");
+
+  _g1h->register_optional_region_with_cset(hr);
+
+  _optional_regions[_optional_region_length] = hr;
+  uint index = _optional_region_length++;
+  hr->set_index_in_opt_cset(index);
+}
+
 // Initialize the per-collection-set information
 void G1CollectionSet::start_incremental_building() {
   assert(_collection_set_cur_length == 0, "Collection set must be empty before starting a new collection set.");
@@ -410,6 +431,8 @@ static int compare_region_idx(const uint a, const uint b) {
 void G1CollectionSet::finalize_old_part(double time_remaining_ms) {
   double non_young_start_time_sec = os::elapsedTime();
   double predicted_old_time_ms = 0.0;
+  double predicted_optional_time_ms = 0.0;
+  double optional_threshold_ms = time_remaining_ms * _policy->optional_prediction_fraction();
 
   if (collector_state()->in_mixed_phase()) {
     cset_chooser()->verify();
@@ -421,10 +444,20 @@ void G1CollectionSet::finalize_old_part(double time_remaining_ms) {
 
     HeapRegion* hr = cset_chooser()->peek();
     while (hr != NULL) {
-      if (old_region_length() >= max_old_cset_length) {
+      if (hr->has_pinned_objects()) {
+        // Regions pinned by JNI critical sections can not be evacuated. Drop
+        // them from the candidates; the next marking cycle reconsiders them.
+        log_trace(gc, ergo, cset)("Skip pinned region %u", hr->hrm_index());
+        cset_chooser()->pop();
+        hr = cset_chooser()->peek();
+        continue;
+      }
+
+      if (old_region_length() + optional_region_length() >= max_old_cset_length) {
         // Added maximum number of old regions to the CSet.
-        log_debug(gc, ergo, cset)("Finish adding old regions to CSet (old CSet region num reached max). old %u regions, max %u regions",
-                                  old_region_length(), max_old_cset_length);
+        log_debug(gc, ergo, cset)("Finish adding old regions to CSet (old CSet region num reached max). "
+                                  "old %u regions, optional %u regions, max %u regions",
+                                  old_region_length(), optional_region_length(), max_old_cset_length);
         break;
       }
 
@@ -444,41 +477,44 @@ void G1CollectionSet::finalize_old_part(double time_remaining_ms) {
       }
 
       double predicted_time_ms = predict_region_elapsed_time_ms(hr);
-      if (check_time_remaining) {
-        if (predicted_time_ms > time_remaining_ms) {
-          // Too expensive for the current CSet.
-
-          if (old_region_length() >= min_old_cset_length) {
-            // We have added the minimum number of old regions to the CSet,
-            // we are done with this CSet.
-            log_debug(gc, ergo, cset)("Finish adding old regions to CSet (predicted time is too high). "
-                                      "predicted time: %1.2fms, remaining time: %1.2fms old %u regions, min %u regions",
-                                      predicted_time_ms, time_remaining_ms, old_region_length(), min_old_cset_length);
-            break;
-          }
-
-          // We'll add it anyway given that we haven't reached the
-          // minimum number of old regions.
-          expensive_region_num += 1;
+      time_remaining_ms = MAX2(time_remaining_ms - predicted_time_ms, 0.0);
+      // Add regions to old set until we reach the minimum amount
+      if (old_region_length() < min_old_cset_length) {
+        predicted_old_time_ms += predicted_time_ms;
+        add_as_old(hr);
+        // Record the number of regions added when no time remaining
+        if (time_remaining_ms == 0.0) {
+          expensive_region_num++;
         }
       } else {
-        if (old_region_length() >= min_old_cset_length) {
-          // In the non-auto-tuning case, we'll finish adding regions
-          // to the CSet if we reach the minimum.
-
+        // In the non-auto-tuning case, we'll finish adding regions
+        // to the CSet if we reach the minimum.
+        if (!check_time_remaining) {
           log_debug(gc, ergo, cset)("Finish adding old regions to CSet (old CSet region num reached min). old %u regions, min %u regions",
                                     old_region_length(), min_old_cset_length);
           break;
         }
+        // Keep adding regions to old set until we reach the optional threshold
+        if (time_remaining_ms > optional_threshold_ms) {
+          predicted_old_time_ms += predicted_time_ms;
+          add_as_old(hr);
+        } else if (time_remaining_ms > 0) {
+          // Keep adding optional regions until time is up.
+          if (!optional_is_full()) {
+            predicted_optional_time_ms += predicted_time_ms;
+            add_as_optional(hr);
+          } else {
+            log_debug(gc, ergo, cset)("Finish adding old regions to CSet (optional set full). optional %u regions",
+                                      optional_region_length());
+            break;
+          }
+        } else {
+          log_debug(gc, ergo, cset)("Finish adding old regions to CSet (predicted time is too high). "
+                                    "predicted time: %1.2fms, remaining time: %1.2fms old %u regions, min %u regions",
+                                    predicted_time_ms, time_remaining_ms, old_region_length(), min_old_cset_length);
+          break;
+        }
       }
-
-      // We will add this region to the CSet.
-      time_remaining_ms = MAX2(time_remaining_ms - predicted_time_ms, 0.0);
-      predicted_old_time_ms += predicted_time_ms;
-      cset_chooser()->pop(); // already have region via peek()
-      _g1h->old_set_remove(hr);
-      add_old_region(hr);
-
       hr = cset_chooser()->peek();
     }
     if (hr == NULL) {
@@ -499,8 +535,10 @@ void G1CollectionSet::finalize_old_part(double time_remaining_ms) {
 
   stop_incremental_building();
 
-  log_debug(gc, ergo, cset)("Finish choosing CSet. old: %u regions, predicted old region time: %1.2fms, time remaining: %1.2f",
-                            old_region_length(), predicted_old_time_ms, time_remaining_ms);
+  log_debug(gc, ergo, cset)("Finish choosing CSet. old %u regions, optional %u regions, "
+                            "predicted old region time: %1.2fms, predicted optional region time: %1.2fms, time remaining: %1.2f",
+                            old_region_length(), optional_region_length(),
+                            predicted_old_time_ms, predicted_optional_time_ms, time_remaining_ms);
 
   double non_young_end_time_sec = os::elapsedTime();
   phase_times()->record_non_young_cset_choice_time_ms((non_young_end_time_sec - non_young_start_time_sec) * 1000.0);
@@ -508,6 +546,78 @@ void G1CollectionSet::finalize_old_part(double time_remaining_ms) {
   QuickSort::sort(_collection_set_regions, _collection_set_cur_length, compare_region_idx, true);
 }
 
+void G1CollectionSet::add_as_old(HeapRegion* hr) {
+  cset_chooser()->pop(); // already have region via peek()
+  _g1h->old_set_remove(hr);
+  add_old_region(hr);
+}
+
+void G1CollectionSet::add_as_optional(HeapRegion* hr) {
+  assert(_optional_regions != NULL, "Must not be called before array is allocated");
+  cset_chooser()->pop(); // already have region via peek()
+  add_optional_region(hr);
+}
+
+bool G1CollectionSet::optional_is_full() {
+  assert(_optional_region_length <= _optional_region_max_length, "Invariant");
+  return _optional_region_length == _optional_region_max_length;
+}
+
+void G1CollectionSet::move_optional_regions_to_collection_set(double time_budget_ms, uint& start, uint& end) {
+  assert_at_safepoint_on_vm_thread();
+  assert(optional_regions_remaining() > 0, "Must have optional regions left");
+
+  start = _optional_region_cur;
+  double predicted_time_ms = 0.0;
+  while (_optional_region_cur < _optional_region_length) {
+    HeapRegion* hr = _optional_regions[_optional_region_cur];
+    predicted_time_ms += predict_region_elapsed_time_ms(hr);
+    if (_optional_region_cur > start && predicted_time_ms > time_budget_ms) {
+      break;
+    }
+
+    // The region now is a regular old collection set region. Do not use
+    // add_old_region() as incremental building of the collection set has
+    // already been stopped. Keep the optional region index for processing
+    // the references into this region recorded so far.
+    _g1h->clear_in_cset(hr);
+    _g1h->old_set_remove(hr);
+    _g1h->register_old_region_with_cset(hr);
+    _g1h->hr_printer()->cset(hr);
+
+    _collection_set_regions[_collection_set_cur_length++] = hr->hrm_index();
+    assert(_collection_set_cur_length <= _collection_set_max_length, "Collection set now larger than maximum size.");
+
+    _bytes_used_before += hr->used();
+    _recorded_rs_lengths += hr->rem_set()->occupied();
+    _old_region_length += 1;
+
+    _optional_region_cur++;
+  }
+  end = _optional_region_cur;
+
+  log_debug(gc, ergo, cset)("Add optional regions to CSet. added %u regions, predicted time: %1.2fms, "
+                            "time budget: %1.2fms, remaining optional %u regions",
+                            end - start, predicted_time_ms, time_budget_ms, optional_regions_remaining());
+}
+
+void G1CollectionSet::abandon_optional_collection_set() {
+  assert_at_safepoint_on_vm_thread();
+
+  // Put the regions not evacuated back in reverse order so that the
+  // candidate order is restored.
+  for (uint i = _optional_region_length; i > _optional_region_cur; i--) {
+    HeapRegion* hr = _optional_regions[i - 1];
+    _g1h->clear_in_cset(hr);
+    cset_chooser()->push(hr);
+  }
+  for (uint i = 0; i < _optional_region_length; i++) {
+    _optional_regions[i]->clear_index_in_opt_cset();
+  }
+  _optional_region_length = 0;
+  _optional_region_cur = 0;
+}
+
 #ifdef ASSERT
 class G1VerifyYoungCSetIndicesClosure : public HeapRegionClosure {
 private:
@@ -56,6 +56,15 @@ class G1CollectionSet {
   volatile size_t _collection_set_cur_length;
   size_t _collection_set_max_length;
 
+  // When doing mixed collections we can add old regions to the collection set, which
+  // will be collected only if there is enough time. We call these optional regions.
+  // They are kept in the order they were chosen in and are evacuated in that order.
+  // Entries below _optional_region_cur have already been moved to the collection set.
+  HeapRegion** _optional_regions;
+  uint _optional_region_length;
+  uint _optional_region_max_length;
+  uint _optional_region_cur;
+
   // The number of bytes in the collection set before the pause. Set from
   // the incrementally built collection set at the start of an evacuation
   // pause, and incremented in finalize_old_part() when adding old regions
@@ -108,6 +117,10 @@ class G1CollectionSet {
 
   double predict_region_elapsed_time_ms(HeapRegion* hr);
 
+  void add_as_old(HeapRegion* hr);
+  void add_as_optional(HeapRegion* hr);
+  bool optional_is_full();
+
   void verify_young_cset_indices() const NOT_DEBUG_RETURN;
 public:
   G1CollectionSet(G1CollectedHeap* g1h, G1Policy* policy);
@@ -131,6 +144,13 @@ public:
   uint eden_region_length() const     { return _eden_region_length;     }
   uint survivor_region_length() const { return _survivor_region_length; }
   uint old_region_length() const      { return _old_region_length;      }
+  uint optional_region_length() const { return _optional_region_length; }
+  uint optional_regions_remaining() const { return _optional_region_length - _optional_region_cur; }
+
+  HeapRegion* optional_region_at(uint index) const {
+    assert(index < _optional_region_length, "Index %u out of bounds (%u)", index, _optional_region_length);
+    return _optional_regions[index];
+  }
 
   // Incremental collection set support
 
@@ -175,6 +195,19 @@ public:
   // Add old region "hr" to the collection set.
   void add_old_region(HeapRegion* hr);
 
+  // Add old region "hr" to optional collection set.
+  void add_optional_region(HeapRegion* hr);
+
+  // Move optional regions, in the order they were chosen, into the collection
+  // set as long as their predicted evacuation time fits into the given time
+  // budget, but at least one region. The moved regions are the optional
+  // regions in [start, end) on return.
+  void move_optional_regions_to_collection_set(double time_budget_ms, uint& start, uint& end);
+
+  // Return all optional regions not evacuated during this pause to the
+  // collection set candidates.
+  void abandon_optional_collection_set();
+
   // Update information about hr in the aggregated information for
   // the incrementally built collection set.
   void update_young_region_prediction(HeapRegion* hr, size_t new_rs_length);
@@ -636,7 +636,7 @@ private:
 
       while (cur < end) {
         MemRegion mr(cur, MIN2(cur + chunk_size_in_words, end));
-        _bitmap->clear_range(mr);
+        _bitmap->clear_large_range(mr);
 
         cur += chunk_size_in_words;
 
@@ -1201,6 +1201,10 @@ void G1ConcurrentMark::remark() {
       ClassLoaderDataGraph::purge();
     }
 
+    // Potentially, some empty regions have been reclaimed; give back memory
+    // to the operating system if the heap is now larger than desired.
+    _g1h->resize_heap_if_necessary();
+
     compute_new_sizes();
 
     verify_during_pause(G1HeapVerifier::G1VerifyRemark, VerifyOption_G1UsePrevMarking, "Remark after");
@@ -27,6 +27,8 @@
 #include "gc/g1/g1ConcurrentMarkBitMap.inline.hpp"
 #include "gc/g1/heapRegion.hpp"
 #include "memory/virtualspace.hpp"
+#include "runtime/os.hpp"
+#include "utilities/align.hpp"
 
 void G1CMBitMap::print_on_error(outputStream* st, const char* prefix) const {
   _bm.print_on_error(st, prefix);
@@ -43,7 +45,8 @@ size_t G1CMBitMap::mark_distance() {
 void G1CMBitMap::initialize(MemRegion heap, G1RegionToSpaceMapper* storage) {
   _covered = heap;
 
-  _bm = BitMapView((BitMap::bm_word_t*) storage->reserved().start(), _covered.word_size() >> _shifter);
+  _bm_start = (char*)storage->reserved().start();
+  _bm = BitMapView((BitMap::bm_word_t*) _bm_start, _covered.word_size() >> _shifter);
 
   storage->set_mapping_changed_listener(&_listener);
 }
@@ -67,6 +70,35 @@ void G1CMBitMap::clear_range(MemRegion mr) {
                    addr_to_offset(intersection.end()), false);
 }
 
+void G1CMBitMap::clear_large_range(MemRegion mr) {
+  MemRegion intersection = mr.intersection(_covered);
+  assert(!intersection.is_empty(),
+         "Given range from " PTR_FORMAT " to " PTR_FORMAT " is completely outside the heap",
+         p2i(mr.start()), p2i(mr.end()));
+  BitMap::idx_t beg = addr_to_offset(intersection.start());
+  BitMap::idx_t end = addr_to_offset(intersection.end());
+
+  if (G1ClearBitmapByRemapping) {
+    // Hand the whole bitmap pages in the range back to the OS; only clear the
+    // partial pages at the ends.
+    size_t const page_size = os::vm_page_size();
+    BitMap::idx_t const bits_per_page = page_size * BitsPerByte;
+    assert(is_aligned(_bm_start, page_size), "Bitmap must start at a page boundary");
+
+    BitMap::idx_t page_beg = align_up(beg, bits_per_page);
+    BitMap::idx_t page_end = align_down(end, bits_per_page);
+    if (page_beg < page_end) {
+      _bm.clear_large_range(beg, page_beg);
+      os::free_memory(_bm_start + page_beg / BitsPerByte, (page_end - page_beg) / BitsPerByte, page_size);
+      _bm.clear_large_range(page_end, end);
+      return;
+    }
+  }
+  // Use the large variant, which lets the platform's block zeroing primitive
+  // do the work rather than a word-at-a-time loop.
+  _bm.clear_large_range(beg, end);
+}
+
 void G1CMBitMap::clear_region(HeapRegion* region) {
  if (!region->is_empty()) {
    MemRegion mr(region->bottom(), region->top());
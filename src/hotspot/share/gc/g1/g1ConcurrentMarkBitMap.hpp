@@ -65,6 +65,7 @@ class G1CMBitMap {
   const int _shifter;    // Shift amount from heap index to bit index in the bitmap.
 
   BitMapView _bm;        // The actual bitmap.
+  char* _bm_start;       // Start of the memory backing the bitmap.
 
   G1CMBitMapMappingChangedListener _listener;
 
@@ -88,7 +89,7 @@ public:
     return mark_distance();
   }
 
-  G1CMBitMap() : _covered(), _bm(), _shifter(LogMinObjAlignment), _listener() { _listener.set_bitmap(this); }
+  G1CMBitMap() : _covered(), _shifter(LogMinObjAlignment), _bm(), _bm_start(NULL), _listener() { _listener.set_bitmap(this); }
 
   // Initializes the underlying BitMap to cover the given area.
   void initialize(MemRegion heap, G1RegionToSpaceMapper* storage);
@@ -121,6 +122,10 @@ public:
   inline bool par_mark(oop obj);
 
   void clear_range(MemRegion mr);
+  // Clears a large range of the bitmap. The pages of the bitmap fully covered
+  // by the range may be handed back to the OS instead of being zeroed, so the
+  // range must not be accessed concurrently.
+  void clear_large_range(MemRegion mr);
   void clear_region(HeapRegion* hr);
 };
 
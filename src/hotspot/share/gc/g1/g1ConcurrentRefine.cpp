@@ -111,6 +111,16 @@ void G1ConcurrentRefineThreadControl::maybe_activate_next(uint cur_worker_id) {
   }
 }
 
+double G1ConcurrentRefineThreadControl::total_vtime() const {
+  double result = 0.0;
+  for (uint i = 0; i < _num_max_threads; ++i) {
+    if (_threads[i] != NULL) {
+      result += _threads[i]->vtime_accum();
+    }
+  }
+  return result;
+}
+
 void G1ConcurrentRefineThreadControl::print_on(outputStream* st) const {
   for (uint i = 0; i < _num_max_threads; ++i) {
     if (_threads[i] != NULL) {
@@ -197,9 +207,23 @@ inline size_t deactivation_level(const Thresholds& t) { return t.second; }
 
 static Thresholds calc_thresholds(size_t green_zone,
                                   size_t yellow_zone,
+                                  size_t red_zone,
+                                  uint num_wanted_threads,
                                   uint worker_i) {
+  if (worker_i >= num_wanted_threads) {
+    // Threads beyond the predicted need are only activated if the queue
+    // still grows past the yellow zone, spread across [yellow, red).
+    double red_size = red_zone - yellow_zone;
+    uint num_other_threads = MAX2(G1ConcurrentRefine::max_num_threads() - num_wanted_threads, 1u);
+    double step = red_size / num_other_threads;
+    uint i = worker_i - num_wanted_threads;
+    size_t activate_offset = static_cast<size_t>(ceil(step * (i + 1)));
+    size_t deactivate_offset = static_cast<size_t>(floor(step * i));
+    return Thresholds(yellow_zone + activate_offset,
+                      yellow_zone + deactivate_offset);
+  }
   double yellow_size = yellow_zone - green_zone;
-  double step = yellow_size / G1ConcurrentRefine::max_num_threads();
+  double step = yellow_size / num_wanted_threads;
   if (worker_i == 0) {
     // Potentially activate worker 0 more aggressively, to keep
     // available buffers near green_zone value.  When yellow_size is
@@ -222,7 +246,14 @@ G1ConcurrentRefine::G1ConcurrentRefine(size_t green_zone,
   _green_zone(green_zone),
   _yellow_zone(yellow_zone),
   _red_zone(red_zone),
-  _min_yellow_zone_size(min_yellow_zone_size)
+  _min_yellow_zone_size(min_yellow_zone_size),
+  _num_wanted_threads(max_num_threads()),
+  _incoming_rate_seq(),
+  _refine_rate_seq(),
+  _last_processed_buffers(0),
+  _last_refined_buffers(0),
+  _last_completed_buffers(0),
+  _last_refine_vtime(0.0)
 {
   assert_zone_constraints_gyr(green_zone, yellow_zone, red_zone);
 }
@@ -375,13 +406,57 @@ void G1ConcurrentRefine::update_zones(double update_rs_time,
             _green_zone, _yellow_zone, _red_zone);
 }
 
+void G1ConcurrentRefine::record_buffer_counts() {
+  DirtyCardQueueSet& dcqs = G1BarrierSet::dirty_card_queue_set();
+  _last_processed_buffers = (size_t)dcqs.processed_buffers_mut() + (size_t)dcqs.processed_buffers_rs_thread();
+  _last_refined_buffers = (size_t)dcqs.processed_buffers_rs_thread();
+  _last_completed_buffers = dcqs.completed_buffers_num();
+  _last_refine_vtime = _thread_control.total_vtime();
+}
+
+void G1ConcurrentRefine::update_wanted_threads(double mutator_time_ms,
+                                               size_t update_rs_processed_buffers) {
+  DirtyCardQueueSet& dcqs = G1BarrierSet::dirty_card_queue_set();
+
+  // All buffers completed since the last pause have been processed either
+  // concurrently, or by Update RS in this pause.
+  size_t processed = (size_t)dcqs.processed_buffers_mut() + (size_t)dcqs.processed_buffers_rs_thread();
+  size_t incoming = processed - _last_processed_buffers + update_rs_processed_buffers;
+  incoming -= MIN2(incoming, _last_completed_buffers);
+  _incoming_rate_seq.add(incoming / MAX2(mutator_time_ms, 1.0));
+
+  size_t refined = (size_t)dcqs.processed_buffers_rs_thread() - _last_refined_buffers;
+  double refine_vtime_ms = (_thread_control.total_vtime() - _last_refine_vtime) * MILLIUNITS;
+  if (refined > 0 && refine_vtime_ms > 0.0) {
+    _refine_rate_seq.add(refined / refine_vtime_ms);
+  }
+
+  if (_refine_rate_seq.num() == 0) {
+    // No idea yet how fast the threads are; keep all of them available.
+    _num_wanted_threads = max_num_threads();
+  } else {
+    double incoming_rate = _incoming_rate_seq.davg() + _incoming_rate_seq.dsd();
+    double refine_rate = MAX2(_refine_rate_seq.davg(), 1e-3);
+    double wanted = ceil(incoming_rate / refine_rate);
+    _num_wanted_threads = (uint)MIN2(MAX2(wanted, 1.0), (double)max_num_threads());
+  }
+
+  log_debug( CTRL_TAGS )("Wanted refinement threads: %u "
+                         "(incoming rate: %.3f buffers/ms, refinement rate: %.3f buffers/ms/thread)",
+                         _num_wanted_threads, _incoming_rate_seq.davg(), _refine_rate_seq.davg());
+}
+
 void G1ConcurrentRefine::adjust(double update_rs_time,
                                 size_t update_rs_processed_buffers,
-                                double goal_ms) {
+                                double goal_ms,
+                                double mutator_time_ms) {
   DirtyCardQueueSet& dcqs = G1BarrierSet::dirty_card_queue_set();
 
   if (G1UseAdaptiveConcRefinement) {
     update_zones(update_rs_time, update_rs_processed_buffers, goal_ms);
+    if (G1UseAdaptiveConcRefinementThreads && max_num_threads() > 0) {
+      update_wanted_threads(mutator_time_ms, update_rs_processed_buffers);
+    }
 
     // Change the barrier params
     if (max_num_threads() == 0) {
@@ -403,15 +478,17 @@ void G1ConcurrentRefine::adjust(double update_rs_time,
     dcqs.set_completed_queue_padding(0);
   }
   dcqs.notify_if_necessary();
+
+  record_buffer_counts();
 }
 
 size_t G1ConcurrentRefine::activation_threshold(uint worker_id) const {
-  Thresholds thresholds = calc_thresholds(_green_zone, _yellow_zone, worker_id);
+  Thresholds thresholds = calc_thresholds(_green_zone, _yellow_zone, _red_zone, _num_wanted_threads, worker_id);
   return activation_level(thresholds);
 }
 
 size_t G1ConcurrentRefine::deactivation_threshold(uint worker_id) const {
-  Thresholds thresholds = calc_thresholds(_green_zone, _yellow_zone, worker_id);
+  Thresholds thresholds = calc_thresholds(_green_zone, _yellow_zone, _red_zone, _num_wanted_threads, worker_id);
   return deactivation_level(thresholds);
 }
 
@@ -27,6 +27,7 @@
 
 #include "memory/allocation.hpp"
 #include "utilities/globalDefinitions.hpp"
+#include "utilities/numberSeq.hpp"
 
 // Forward decl
 class CardTableEntryClosure;
@@ -56,6 +57,9 @@ public:
   // activate it.
   void maybe_activate_next(uint cur_worker_id);
 
+  // Total virtual time used by the refinement threads so far, in seconds.
+  double total_vtime() const;
+
   void print_on(outputStream* st) const;
   void worker_threads_do(ThreadClosure* tc);
   void stop();
@@ -92,6 +96,23 @@ class G1ConcurrentRefine : public CHeapObj<mtGC> {
   size_t _red_zone;
   size_t _min_yellow_zone_size;
 
+  // Number of refinement threads predicted to be needed to keep up with the
+  // incoming dirty card buffers. Only these threads are activated across the
+  // yellow zone; the remaining ones are activated between the yellow and the
+  // red zone.
+  uint _num_wanted_threads;
+
+  // Rate of dirty card buffers completed by the mutators, and rate of buffers
+  // processed by a single refinement thread, both in buffers per ms.
+  TruncatedSeq _incoming_rate_seq;
+  TruncatedSeq _refine_rate_seq;
+
+  // Snapshot of the dirty card queue set counters at the end of the last pause.
+  size_t _last_processed_buffers;
+  size_t _last_refined_buffers;
+  size_t _last_completed_buffers;
+  double _last_refine_vtime;
+
   G1ConcurrentRefine(size_t green_zone,
                      size_t yellow_zone,
                      size_t red_zone,
@@ -102,6 +123,12 @@ class G1ConcurrentRefine : public CHeapObj<mtGC> {
                     size_t update_rs_processed_buffers,
                     double goal_ms);
 
+  // Update the number of wanted refinement threads based on the incoming
+  // buffer rate during the last mutator phase.
+  void update_wanted_threads(double mutator_time_ms,
+                             size_t update_rs_processed_buffers);
+  void record_buffer_counts();
+
   static uint worker_id_offset();
   void maybe_activate_more_threads(uint worker_id, size_t num_cur_buffers);
 
@@ -115,8 +142,10 @@ public:
 
   void stop();
 
-  // Adjust refinement thresholds based on work done during the pause and the goal time.
-  void adjust(double update_rs_time, size_t update_rs_processed_buffers, double goal_ms);
+  // Adjust refinement thresholds based on work done during the pause, the goal time
+  // and the time the mutator ran since the previous pause.
+  void adjust(double update_rs_time, size_t update_rs_processed_buffers, double goal_ms,
+              double mutator_time_ms);
 
   size_t activation_threshold(uint worker_id) const;
   size_t deactivation_threshold(uint worker_id) const;
@@ -134,6 +163,7 @@ public:
   size_t green_zone() const      { return _green_zone;  }
   size_t yellow_zone() const     { return _yellow_zone; }
   size_t red_zone() const        { return _red_zone;    }
+  uint num_wanted_threads() const { return _num_wanted_threads; }
 };
 
 #endif // SHARE_VM_GC_G1_G1CONCURRENTREFINE_HPP
@@ -37,6 +37,7 @@
 #include "oops/access.inline.hpp"
 #include "oops/compressedOops.inline.hpp"
 #include "oops/oop.inline.hpp"
+#include "runtime/atomic.hpp"
 
 class UpdateRSetDeferred : public BasicOopIterateClosure {
 private:
@@ -69,88 +70,97 @@ public:
   }
 };
 
+// Removes the self-forwarding pointer of a failed object and recreates the
+// remembered set entries for its references.
 class RemoveSelfForwardPtrObjClosure: public ObjectClosure {
-  G1CollectedHeap* _g1h;
   G1ConcurrentMark* _cm;
-  HeapRegion* _hr;
-  size_t _marked_bytes;
   UpdateRSetDeferred* _update_rset_cl;
   bool _during_initial_mark;
   uint _worker_id;
-  HeapWord* _last_forwarded_object_end;
 
 public:
-  RemoveSelfForwardPtrObjClosure(HeapRegion* hr,
-                                 UpdateRSetDeferred* update_rset_cl,
+  RemoveSelfForwardPtrObjClosure(UpdateRSetDeferred* update_rset_cl,
                                  bool during_initial_mark,
                                  uint worker_id) :
-    _g1h(G1CollectedHeap::heap()),
-    _cm(_g1h->concurrent_mark()),
-    _hr(hr),
-    _marked_bytes(0),
+    _cm(G1CollectedHeap::heap()->concurrent_mark()),
     _update_rset_cl(update_rset_cl),
     _during_initial_mark(during_initial_mark),
-    _worker_id(worker_id),
+    _worker_id(worker_id) { }
+
+  void do_object(oop obj) {
+    assert(obj->is_forwarded() && obj->forwardee() == obj,
+           "Object " PTR_FORMAT " must be self-forwarded", p2i(obj));
+
+    if (_during_initial_mark) {
+      // For the next marking info we'll only mark the
+      // self-forwarded objects explicitly if we are during
+      // initial-mark (since, normally, we only mark objects pointed
+      // to by roots if we succeed in copying them). By marking all
+      // self-forwarded objects we ensure that we mark any that are
+      // still pointed to be roots. During concurrent marking, and
+      // after initial-mark, we don't need to mark any objects
+      // explicitly and all objects in the CSet are considered
+      // (implicitly) live. So, we won't mark them explicitly and
+      // we'll leave them over NTAMS.
+      _cm->mark_in_next_bitmap(_worker_id, obj);
+    }
+
+    PreservedMarks::init_forwarded_mark(obj);
+
+    // While we were processing RSet buffers during the collection,
+    // we actually didn't scan any cards on the collection set,
+    // since we didn't want to update remembered sets with entries
+    // that point into the collection set, given that live objects
+    // from the collection set are about to move and such entries
+    // will be stale very soon.
+    // This change also dealt with a reliability issue which
+    // involved scanning a card in the collection set and coming
+    // across an array that was being chunked and looking malformed.
+    // The problem is that, if evacuation fails, we might have
+    // remembered set entries missing given that we skipped cards on
+    // the collection set. So, we'll recreate such entries now.
+    obj->oop_iterate(_update_rset_cl);
+  }
+};
+
+// Visits the failed objects of a region in address order, marking them live
+// in the prev bitmap, and fills the gaps between them with dummy objects as
+// they are either dead or have been evacuated (which are unreferenced now,
+// i.e. dead too) already. Also rebuilds the BOT of the region.
+class RebuildEvacFailedRegionObjClosure: public ObjectClosure {
+  G1ConcurrentMark* _cm;
+  HeapRegion* _hr;
+  size_t _marked_bytes;
+  HeapWord* _last_forwarded_object_end;
+
+public:
+  RebuildEvacFailedRegionObjClosure(HeapRegion* hr) :
+    _cm(G1CollectedHeap::heap()->concurrent_mark()),
+    _hr(hr),
+    _marked_bytes(0),
     _last_forwarded_object_end(hr->bottom()) { }
 
   size_t marked_bytes() { return _marked_bytes; }
 
-  // Iterate over the live objects in the region to find self-forwarded objects
-  // that need to be kept live. We need to update the remembered sets of these
-  // objects. Further update the BOT and marks.
-  // We can coalesce and overwrite the remaining heap contents with dummy objects
-  // as they have either been dead or evacuated (which are unreferenced now, i.e.
-  // dead too) already.
   void do_object(oop obj) {
     HeapWord* obj_addr = (HeapWord*) obj;
     assert(_hr->is_in(obj_addr), "sanity");
+    assert(obj_addr >= _last_forwarded_object_end, "objects must be visited in address order");
+
+    zap_dead_objects(_last_forwarded_object_end, obj_addr);
+    // We consider all objects that we find self-forwarded to be
+    // live. What we'll do is that we'll update the prev marking
+    // info so that they are all under PTAMS and explicitly marked.
+    if (!_cm->is_marked_in_prev_bitmap(obj)) {
+      _cm->mark_in_prev_bitmap(obj);
+    }
+    size_t obj_size = obj->size();
 
-    if (obj->is_forwarded() && obj->forwardee() == obj) {
-      // The object failed to move.
+    _marked_bytes += (obj_size * HeapWordSize);
 
-      zap_dead_objects(_last_forwarded_object_end, obj_addr);
-      // We consider all objects that we find self-forwarded to be
-      // live. What we'll do is that we'll update the prev marking
-      // info so that they are all under PTAMS and explicitly marked.
-      if (!_cm->is_marked_in_prev_bitmap(obj)) {
-        _cm->mark_in_prev_bitmap(obj);
-      }
-      if (_during_initial_mark) {
-        // For the next marking info we'll only mark the
-        // self-forwarded objects explicitly if we are during
-        // initial-mark (since, normally, we only mark objects pointed
-        // to by roots if we succeed in copying them). By marking all
-        // self-forwarded objects we ensure that we mark any that are
-        // still pointed to be roots. During concurrent marking, and
-        // after initial-mark, we don't need to mark any objects
-        // explicitly and all objects in the CSet are considered
-        // (implicitly) live. So, we won't mark them explicitly and
-        // we'll leave them over NTAMS.
-        _cm->mark_in_next_bitmap(_worker_id, obj);
-      }
-      size_t obj_size = obj->size();
-
-      _marked_bytes += (obj_size * HeapWordSize);
-      PreservedMarks::init_forwarded_mark(obj);
-
-      // While we were processing RSet buffers during the collection,
-      // we actually didn't scan any cards on the collection set,
-      // since we didn't want to update remembered sets with entries
-      // that point into the collection set, given that live objects
-      // from the collection set are about to move and such entries
-      // will be stale very soon.
-      // This change also dealt with a reliability issue which
-      // involved scanning a card in the collection set and coming
-      // across an array that was being chunked and looking malformed.
-      // The problem is that, if evacuation fails, we might have
-      // remembered set entries missing given that we skipped cards on
-      // the collection set. So, we'll recreate such entries now.
-      obj->oop_iterate(_update_rset_cl);
-
-      HeapWord* obj_end = obj_addr + obj_size;
-      _last_forwarded_object_end = obj_end;
-      _hr->cross_threshold(obj_addr, obj_end);
-    }
+    HeapWord* obj_end = obj_addr + obj_size;
+    _last_forwarded_object_end = obj_end;
+    _hr->cross_threshold(obj_addr, obj_end);
   }
 
   // Fill the memory area from start to end with filler objects, and update the BOT
@@ -191,71 +201,106 @@ public:
   }
 };
 
-class RemoveSelfForwardPtrHRClosure: public HeapRegionClosure {
+class G1CollectEvacFailedRegionsClosure: public HeapRegionClosure {
   G1CollectedHeap* _g1h;
-  uint _worker_id;
-  HeapRegionClaimer* _hrclaimer;
-
-  DirtyCardQueue _dcq;
-  UpdateRSetDeferred _update_rset_cl;
+  G1EvacFailureRegions* _regions;
 
 public:
-  RemoveSelfForwardPtrHRClosure(uint worker_id,
-                                HeapRegionClaimer* hrclaimer) :
+  G1CollectEvacFailedRegionsClosure(G1EvacFailureRegions* regions) :
     _g1h(G1CollectedHeap::heap()),
-    _dcq(&_g1h->dirty_card_queue_set()),
-    _update_rset_cl(&_dcq),
-    _worker_id(worker_id),
-    _hrclaimer(hrclaimer) {
-  }
-
-  size_t remove_self_forward_ptr_by_walking_hr(HeapRegion* hr,
-                                               bool during_initial_mark) {
-    RemoveSelfForwardPtrObjClosure rspc(hr,
-                                        &_update_rset_cl,
-                                        during_initial_mark,
-                                        _worker_id);
-    hr->object_iterate(&rspc);
-    // Need to zap the remainder area of the processed region.
-    rspc.zap_remainder();
+    _regions(regions) { }
 
-    return rspc.marked_bytes();
-  }
-
-  bool do_heap_region(HeapRegion *hr) {
+  bool do_heap_region(HeapRegion* hr) {
     assert(!hr->is_pinned(), "Unexpected pinned region at index %u", hr->hrm_index());
     assert(hr->in_collection_set(), "bad CS");
 
-    if (_hrclaimer->claim_region(hr->hrm_index())) {
-      if (hr->evacuation_failed()) {
-        bool during_initial_mark = _g1h->collector_state()->in_initial_mark_gc();
-        bool during_conc_mark = _g1h->collector_state()->mark_or_rebuild_in_progress();
-
-        hr->note_self_forwarding_removal_start(during_initial_mark,
-                                               during_conc_mark);
-        _g1h->verifier()->check_bitmaps("Self-Forwarding Ptr Removal", hr);
-
-        hr->reset_bot();
+    if (hr->evacuation_failed()) {
+      bool during_initial_mark = _g1h->collector_state()->in_initial_mark_gc();
+      bool during_conc_mark = _g1h->collector_state()->mark_or_rebuild_in_progress();
 
-        size_t live_bytes = remove_self_forward_ptr_by_walking_hr(hr, during_initial_mark);
+      hr->note_self_forwarding_removal_start(during_initial_mark,
+                                             during_conc_mark);
+      _g1h->verifier()->check_bitmaps("Self-Forwarding Ptr Removal", hr);
 
-        hr->rem_set()->clean_strong_code_roots(hr);
-        hr->rem_set()->clear_locked(true);
+      hr->reset_bot();
+      hr->evac_failure_objs()->prepare_claim();
 
-        hr->note_self_forwarding_removal_end(live_bytes);
-      }
+      _regions->add(hr);
     }
     return false;
   }
 };
 
-G1ParRemoveSelfForwardPtrsTask::G1ParRemoveSelfForwardPtrsTask() :
+G1EvacFailureRegions::G1EvacFailureRegions() :
+  _regions(NEW_C_HEAP_ARRAY(HeapRegion*, G1CollectedHeap::heap()->max_regions(), mtGC)),
+  _length(0),
+  _claimed(0) {
+  G1CollectEvacFailedRegionsClosure cl(this);
+  G1CollectedHeap::heap()->collection_set_iterate(&cl);
+}
+
+G1EvacFailureRegions::~G1EvacFailureRegions() {
+  FREE_C_HEAP_ARRAY(HeapRegion*, _regions);
+}
+
+void G1EvacFailureRegions::add(HeapRegion* hr) {
+  assert(_length < G1CollectedHeap::heap()->max_regions(), "must be");
+  _regions[_length++] = hr;
+}
+
+HeapRegion* G1EvacFailureRegions::claim_region() {
+  uint index = Atomic::add(1u, &_claimed) - 1;
+  return index < _length ? _regions[index] : NULL;
+}
+
+G1ParRemoveSelfForwardPtrsTask::G1ParRemoveSelfForwardPtrsTask(G1EvacFailureRegions* regions) :
   AbstractGangTask("G1 Remove Self-forwarding Pointers"),
   _g1h(G1CollectedHeap::heap()),
-  _hrclaimer(_g1h->workers()->active_workers()) { }
+  _regions(regions) { }
 
 void G1ParRemoveSelfForwardPtrsTask::work(uint worker_id) {
-  RemoveSelfForwardPtrHRClosure rsfp_cl(worker_id, &_hrclaimer);
+  uint num_regions = _regions->length();
+  if (num_regions == 0) {
+    return;
+  }
 
-  _g1h->collection_set_iterate_from(&rsfp_cl, worker_id);
+  DirtyCardQueue dcq(&_g1h->dirty_card_queue_set());
+  UpdateRSetDeferred update_rset_cl(&dcq);
+  bool during_initial_mark = _g1h->collector_state()->in_initial_mark_gc();
+  RemoveSelfForwardPtrObjClosure rspc(&update_rset_cl, during_initial_mark, worker_id);
+
+  // Start at a different region for every worker and steal chunks of
+  // failed objects from the other regions once our own is exhausted, so
+  // a few regions with many failed objects do not serialize the work.
+  uint start = worker_id % num_regions;
+  for (uint i = 0; i < num_regions; i++) {
+    HeapRegion* hr = _regions->at((start + i) % num_regions);
+    G1EvacFailureObjectsSet* objs = hr->evac_failure_objs();
+    G1EvacFailureObjectsSet::Chunk* chunk;
+    while ((chunk = objs->claim_chunk()) != NULL) {
+      for (uint j = 0; j < chunk->length(); j++) {
+        rspc.do_object(objs->object_at(chunk->at(j)));
+      }
+    }
+  }
+}
+
+G1ParRebuildEvacFailedRegionsTask::G1ParRebuildEvacFailedRegionsTask(G1EvacFailureRegions* regions) :
+  AbstractGangTask("G1 Rebuild Evacuation Failed Regions"),
+  _regions(regions) { }
+
+void G1ParRebuildEvacFailedRegionsTask::work(uint worker_id) {
+  HeapRegion* hr;
+  while ((hr = _regions->claim_region()) != NULL) {
+    RebuildEvacFailedRegionObjClosure cl(hr);
+    hr->evac_failure_objs()->iterate_sorted(&cl);
+    // Need to zap the remainder area of the processed region.
+    cl.zap_remainder();
+    hr->evac_failure_objs()->clear();
+
+    hr->rem_set()->clean_strong_code_roots(hr);
+    hr->rem_set()->clear_locked(true);
+
+    hr->note_self_forwarding_removal_end(cl.marked_bytes());
+  }
 }
@@ -31,16 +31,51 @@
 #include "utilities/globalDefinitions.hpp"
 
 class G1CollectedHeap;
+class HeapRegion;
+
+// The collection set regions that failed evacuation in the current pause.
+// Collecting them also prepares them for the tasks below.
+class G1EvacFailureRegions : public StackObj {
+  HeapRegion** _regions;
+  uint _length;
+  volatile uint _claimed;
+
+public:
+  G1EvacFailureRegions();
+  ~G1EvacFailureRegions();
+
+  void add(HeapRegion* hr);
+
+  uint length() const { return _length; }
+  HeapRegion* at(uint i) const { return _regions[i]; }
+
+  // Returns the next unclaimed region, or NULL if all have been claimed.
+  HeapRegion* claim_region();
+};
 
 // Task to fixup self-forwarding pointers
 // installed as a result of an evacuation failure.
+// The failed objects are distributed among the workers in chunks,
+// independent of the region they are in.
 class G1ParRemoveSelfForwardPtrsTask: public AbstractGangTask {
 protected:
   G1CollectedHeap* _g1h;
-  HeapRegionClaimer _hrclaimer;
+  G1EvacFailureRegions* _regions;
+
+public:
+  G1ParRemoveSelfForwardPtrsTask(G1EvacFailureRegions* regions);
+
+  void work(uint worker_id);
+};
+
+// Task to make the regions that failed evacuation parsable again and
+// to rebuild their marking information and BOT. Must run after
+// G1ParRemoveSelfForwardPtrsTask.
+class G1ParRebuildEvacFailedRegionsTask: public AbstractGangTask {
+  G1EvacFailureRegions* _regions;
 
 public:
-  G1ParRemoveSelfForwardPtrsTask();
+  G1ParRebuildEvacFailedRegionsTask(G1EvacFailureRegions* regions);
 
   void work(uint worker_id);
 };
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/g1/g1EvacFailureObjectsSet.hpp"
+#include "memory/iterator.hpp"
+#include "runtime/atomic.hpp"
+#include "utilities/quickSort.hpp"
+
+G1EvacFailureObjectsSet::G1EvacFailureObjectsSet(HeapWord* bottom) :
+  _bottom(bottom), _head(NULL), _claim(NULL) { }
+
+G1EvacFailureObjectsSet::~G1EvacFailureObjectsSet() {
+  clear();
+}
+
+void G1EvacFailureObjectsSet::record(oop obj) {
+  assert((HeapWord*)obj >= _bottom, "Object " PTR_FORMAT " below region bottom " PTR_FORMAT,
+         p2i(obj), p2i(_bottom));
+  OffsetInRegion offset = (OffsetInRegion)pointer_delta((HeapWord*)obj, _bottom);
+
+  Chunk* cur = _head;
+  for (;;) {
+    if (cur != NULL) {
+      uint index = Atomic::add(1u, &cur->_top) - 1;
+      if (index < Chunk::Capacity) {
+        cur->_offsets[index] = offset;
+        return;
+      }
+    }
+    // The current chunk is full, try to install a new one.
+    Chunk* chunk = new Chunk(cur);
+    chunk->_offsets[0] = offset;
+    chunk->_top = 1;
+    Chunk* prev = Atomic::cmpxchg(chunk, &_head, cur);
+    if (prev == cur) {
+      return;
+    }
+    // Somebody else installed a chunk, retry with that one.
+    delete chunk;
+    cur = prev;
+  }
+}
+
+size_t G1EvacFailureObjectsSet::num_objects() const {
+  size_t result = 0;
+  for (Chunk* chunk = _head; chunk != NULL; chunk = chunk->next()) {
+    result += chunk->length();
+  }
+  return result;
+}
+
+void G1EvacFailureObjectsSet::prepare_claim() {
+  _claim = _head;
+}
+
+G1EvacFailureObjectsSet::Chunk* G1EvacFailureObjectsSet::claim_chunk() {
+  Chunk* cur = _claim;
+  while (cur != NULL) {
+    Chunk* prev = Atomic::cmpxchg(cur->next(), &_claim, cur);
+    if (prev == cur) {
+      return cur;
+    }
+    cur = prev;
+  }
+  return NULL;
+}
+
+static int compare_offset(G1EvacFailureObjectsSet::OffsetInRegion a,
+                          G1EvacFailureObjectsSet::OffsetInRegion b) {
+  return (a > b) ? 1 : ((a < b) ? -1 : 0);
+}
+
+void G1EvacFailureObjectsSet::iterate_sorted(ObjectClosure* cl) {
+  size_t num = num_objects();
+  if (num == 0) {
+    return;
+  }
+
+  OffsetInRegion* offsets = NEW_C_HEAP_ARRAY(OffsetInRegion, num, mtGC);
+  size_t i = 0;
+  for (Chunk* chunk = _head; chunk != NULL; chunk = chunk->next()) {
+    for (uint j = 0; j < chunk->length(); j++) {
+      offsets[i++] = chunk->at(j);
+    }
+  }
+  assert(i == num, "must be");
+
+  QuickSort::sort(offsets, num, compare_offset, false);
+
+  for (i = 0; i < num; i++) {
+    assert(i == 0 || offsets[i - 1] < offsets[i], "Object at offset %u recorded twice", offsets[i]);
+    cl->do_object(object_at(offsets[i]));
+  }
+
+  FREE_C_HEAP_ARRAY(OffsetInRegion, offsets);
+}
+
+void G1EvacFailureObjectsSet::clear() {
+  Chunk* chunk = _head;
+  while (chunk != NULL) {
+    Chunk* next = chunk->next();
+    delete chunk;
+    chunk = next;
+  }
+  _head = NULL;
+  _claim = NULL;
+}
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_VM_GC_G1_G1EVACFAILUREOBJECTSSET_HPP
+#define SHARE_VM_GC_G1_G1EVACFAILUREOBJECTSSET_HPP
+
+#include "memory/allocation.hpp"
+#include "oops/oopsHierarchy.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+class ObjectClosure;
+
+// The set of objects of a region that failed evacuation, i.e. the objects
+// that have been self-forwarded. Recording them allows evacuation failure
+// handling to visit just these objects instead of walking the whole region.
+//
+// Objects are stored as word offsets from the bottom of the region in a
+// list of fixed size chunks. The chunks are also the unit of work when
+// processing the objects in parallel.
+class G1EvacFailureObjectsSet {
+public:
+  typedef uint OffsetInRegion;
+
+  class Chunk : public CHeapObj<mtGC> {
+    friend class G1EvacFailureObjectsSet;
+
+  public:
+    static const uint Capacity = 256;
+
+  private:
+    Chunk* _next;
+    // Number of slots handed out. May exceed Capacity if several threads
+    // raced for the last slots of this chunk.
+    volatile uint _top;
+    OffsetInRegion _offsets[Capacity];
+
+  public:
+    Chunk(Chunk* next) : _next(next), _top(0) { }
+
+    Chunk* next() const { return _next; }
+    uint length() const { return MIN2(_top, Capacity); }
+    OffsetInRegion at(uint i) const { return _offsets[i]; }
+  };
+
+private:
+  HeapWord* _bottom;
+  Chunk* volatile _head;
+  // The next chunk to be claimed by claim_chunk().
+  Chunk* volatile _claim;
+
+  size_t num_objects() const;
+
+public:
+  G1EvacFailureObjectsSet(HeapWord* bottom);
+  ~G1EvacFailureObjectsSet();
+
+  bool is_empty() const { return _head == NULL; }
+
+  // Records the given object. May be called by several threads at once.
+  void record(oop obj);
+
+  oop object_at(OffsetInRegion offset) const {
+    return oop(_bottom + offset);
+  }
+
+  // Resets the chunk claiming for a new round of parallel processing.
+  void prepare_claim();
+  // Returns the next unclaimed chunk, or NULL if all chunks have been claimed.
+  Chunk* claim_chunk();
+
+  // Applies the closure to all recorded objects in address order.
+  void iterate_sorted(ObjectClosure* cl);
+
+  // Forgets all recorded objects.
+  void clear();
+};
+
+#endif // SHARE_VM_GC_G1_G1EVACFAILUREOBJECTSSET_HPP
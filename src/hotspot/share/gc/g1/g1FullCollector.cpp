@@ -270,8 +270,9 @@ void G1FullCollector::restore_marks() {
   _preserved_marks_set.reclaim();
 }
 
-void G1FullCollector::run_task(AbstractGangTask* task) {
+void G1FullCollector::run_task(G1FullGCTask* task) {
   _heap->workers()->run_task(task, _num_workers);
+  task->report_statistics();
 }
 
 void G1FullCollector::verify_after_marking() {
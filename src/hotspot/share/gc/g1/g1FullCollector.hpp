@@ -34,11 +34,11 @@
 #include "gc/shared/taskqueue.hpp"
 #include "memory/allocation.hpp"
 
-class AbstractGangTask;
 class G1CMBitMap;
 class G1FullGCMarker;
 class G1FullGCScope;
 class G1FullGCCompactionPoint;
+class G1FullGCTask;
 class GCMemoryManager;
 class ReferenceProcessor;
 
@@ -99,7 +99,7 @@ private:
   void restore_marks();
   void verify_after_marking();
 
-  void run_task(AbstractGangTask* task);
+  void run_task(G1FullGCTask* task);
 };
 
 
@@ -29,16 +29,59 @@
 #include "gc/g1/g1FullGCCompactionPoint.hpp"
 #include "gc/g1/g1FullGCCompactTask.hpp"
 #include "gc/g1/heapRegion.inline.hpp"
+#include "gc/shared/gcTrace.hpp"
 #include "gc/shared/gcTraceTime.inline.hpp"
+#include "gc/shared/workerDataArray.inline.hpp"
 #include "logging/log.hpp"
 #include "oops/oop.inline.hpp"
 #include "utilities/ticks.hpp"
 
-class G1ResetHumongousClosure : public HeapRegionClosure {
+class G1ResetNotCompactedClosure : public HeapRegionClosure {
   G1CMBitMap* _bitmap;
 
+  // Overwrite the dead space between start and end with filler objects and
+  // update the BOT for them.
+  void fill_dead_range(HeapRegion* hr, HeapWord* start, HeapWord* end) {
+    size_t gap_size = pointer_delta(end, start);
+    if (gap_size < CollectedHeap::min_fill_size()) {
+      return;
+    }
+    CollectedHeap::fill_with_objects(start, gap_size);
+    // fill_with_objects() may have created more than one object.
+    HeapWord* cur = start;
+    while (cur < end) {
+      HeapWord* obj_end = cur + oop(cur)->size();
+      hr->cross_threshold(cur, obj_end);
+      cur = obj_end;
+    }
+  }
+
+  // Regions with pinned objects have not been compacted. Keep the live
+  // objects in place, make the region parsable and rebuild its BOT.
+  void reset_region_with_pinned_objects(HeapRegion* hr) {
+    hr->reset_bot();
+
+    HeapWord* const limit = hr->top();
+    HeapWord* cur = hr->bottom();
+    while (cur < limit) {
+      HeapWord* live = _bitmap->get_next_marked_addr(cur, limit);
+      if (live > cur) {
+        fill_dead_range(hr, cur, live);
+      }
+      if (live >= limit) {
+        break;
+      }
+      HeapWord* obj_end = live + oop(live)->size();
+      hr->cross_threshold(live, obj_end);
+      cur = obj_end;
+    }
+
+    _bitmap->clear_region(hr);
+    hr->reset_during_compaction();
+  }
+
 public:
-  G1ResetHumongousClosure(G1CMBitMap* bitmap) :
+  G1ResetNotCompactedClosure(G1CMBitMap* bitmap) :
       _bitmap(bitmap) { }
 
   bool do_heap_region(HeapRegion* current) {
@@ -54,6 +97,8 @@ public:
         }
       }
       current->reset_during_compaction();
+    } else if (!current->is_pinned() && current->has_pinned_objects()) {
+      reset_region_with_pinned_objects(current);
     }
     return false;
   }
@@ -61,6 +106,7 @@ public:
 
 size_t G1FullGCCompactTask::G1CompactRegionClosure::apply(oop obj) {
   size_t size = obj->size();
+  _live_words += size;
   HeapWord* destination = (HeapWord*)obj->forwardee();
   if (destination == NULL) {
     // Object not moving
@@ -77,7 +123,7 @@ size_t G1FullGCCompactTask::G1CompactRegionClosure::apply(oop obj) {
   return size;
 }
 
-void G1FullGCCompactTask::compact_region(HeapRegion* hr) {
+size_t G1FullGCCompactTask::compact_region(HeapRegion* hr, uint worker_id) {
   assert(!hr->is_humongous(), "Should be no humongous regions in compaction queue");
   G1CompactRegionClosure compact(collector()->mark_bitmap());
   hr->apply_to_marked_objects(collector()->mark_bitmap(), &compact);
@@ -85,18 +131,26 @@ void G1FullGCCompactTask::compact_region(HeapRegion* hr) {
   // needs be cleared.
   collector()->mark_bitmap()->clear_region(hr);
   hr->complete_compaction();
+
+  size_t live_bytes = compact.live_words() * HeapWordSize;
+  collector()->scope()->tracer()->report_region_compaction(hr->hrm_index(), worker_id, live_bytes,
+                                                           (double)live_bytes / HeapRegion::GrainBytes);
+  return live_bytes;
 }
 
 void G1FullGCCompactTask::work(uint worker_id) {
   Ticks start = Ticks::now();
   GrowableArray<HeapRegion*>* compaction_queue = collector()->compaction_point(worker_id)->regions();
+  size_t live_bytes = 0;
   for (GrowableArrayIterator<HeapRegion*> it = compaction_queue->begin();
        it != compaction_queue->end();
        ++it) {
-    compact_region(*it);
+    live_bytes += compact_region(*it, worker_id);
   }
+  _compacted_regions.set(worker_id, (size_t)compaction_queue->length());
+  _compacted_live_bytes.set(worker_id, live_bytes);
 
-  G1ResetHumongousClosure hc(collector()->mark_bitmap());
+  G1ResetNotCompactedClosure hc(collector()->mark_bitmap());
   G1CollectedHeap::heap()->heap_region_par_iterate_from_worker_offset(&hc, &_claimer, worker_id);
   log_task("Compaction task", worker_id, start);
 }
@@ -107,6 +161,19 @@ void G1FullGCCompactTask::serial_compaction() {
   for (GrowableArrayIterator<HeapRegion*> it = compaction_queue->begin();
        it != compaction_queue->end();
        ++it) {
-    compact_region(*it);
+    compact_region(*it, 0 /* worker_id */);
+  }
+}
+
+void G1FullGCCompactTask::print_additional_statistics(outputStream* out) const {
+  out->print("    ");
+  _compacted_regions.print_summary_on(out);
+  out->print("    ");
+  _compacted_live_bytes.print_summary_on(out);
+
+  size_t regions = _compacted_regions.sum();
+  if (regions > 0) {
+    out->print_cr("    Average Live Ratio: %.1f%%",
+                  percent_of(_compacted_live_bytes.sum(), regions * HeapRegion::GrainBytes));
   }
 }
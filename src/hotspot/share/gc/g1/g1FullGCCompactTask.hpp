@@ -40,21 +40,32 @@ protected:
   HeapRegionClaimer _claimer;
 
 private:
-  void compact_region(HeapRegion* hr);
+  // Per-worker number of compacted regions and live bytes in them.
+  WorkerDataArray<size_t> _compacted_regions;
+  WorkerDataArray<size_t> _compacted_live_bytes;
+
+  // Compacts the region and returns the number of live bytes in it.
+  size_t compact_region(HeapRegion* hr, uint worker_id);
+
+  virtual void print_additional_statistics(outputStream* out) const;
 
 public:
   G1FullGCCompactTask(G1FullCollector* collector) :
     G1FullGCTask("G1 Compact Task", collector),
-    _claimer(collector->workers()) { }
+    _claimer(collector->workers()),
+    _compacted_regions(collector->workers(), "Compacted Regions:"),
+    _compacted_live_bytes(collector->workers(), "Compacted Live (B):") { }
   void work(uint worker_id);
   void serial_compaction();
 
   class G1CompactRegionClosure : public StackObj {
     G1CMBitMap* _bitmap;
+    size_t _live_words;
 
   public:
-    G1CompactRegionClosure(G1CMBitMap* bitmap) : _bitmap(bitmap) { }
+    G1CompactRegionClosure(G1CMBitMap* bitmap) : _bitmap(bitmap), _live_words(0) { }
     size_t apply(oop object);
+    size_t live_words() const { return _live_words; }
   };
 };
 
@@ -65,5 +65,6 @@ void G1FullGCMarkTask::work(uint worker_id) {
   // This is the point where the entire marking should have completed.
   assert(marker->oop_stack()->is_empty(), "Marking should have completed");
   assert(marker->objarray_stack()->is_empty(), "Array marking should have completed");
+  record_work_stealing(worker_id, marker->termination_time(), marker->stolen_tasks());
   log_task("Marking task", worker_id, start);
 }
@@ -34,7 +34,9 @@ G1FullGCMarker::G1FullGCMarker(uint worker_id, PreservedMarks* preserved_stack,
     _cld_closure(mark_closure()),
     _stack_closure(this),
     _preserved_stack(preserved_stack),
-    _bitmap(bitmap) {
+    _bitmap(bitmap),
+    _stolen_tasks(0),
+    _termination_time() {
   _oop_stack.initialize();
   _objarray_stack.initialize();
 }
@@ -47,16 +49,29 @@ void G1FullGCMarker::complete_marking(OopQueueSet* oop_stacks,
                                       ObjArrayTaskQueueSet* array_stacks,
                                       ParallelTaskTerminator* terminator) {
   int hash_seed = 17;
-  do {
+  _stolen_tasks = 0;
+  _termination_time = Tickspan();
+  while (true) {
     drain_stack();
     ObjArrayTask steal_array;
     if (array_stacks->steal(_worker_id, &hash_seed, steal_array)) {
+      _stolen_tasks++;
       follow_array_chunk(objArrayOop(steal_array.obj()), steal_array.index());
     } else {
       oop steal_oop;
       if (oop_stacks->steal(_worker_id, &hash_seed, steal_oop)) {
+        _stolen_tasks++;
         follow_object(steal_oop);
       }
     }
-  } while (!is_empty() || !terminator->offer_termination());
+    if (!is_empty()) {
+      continue;
+    }
+    Ticks termination_start = Ticks::now();
+    bool terminated = terminator->offer_termination();
+    _termination_time += Ticks::now() - termination_start;
+    if (terminated) {
+      break;
+    }
+  }
 }
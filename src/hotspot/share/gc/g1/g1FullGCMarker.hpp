@@ -35,6 +35,7 @@
 #include "utilities/chunkedList.hpp"
 #include "utilities/growableArray.hpp"
 #include "utilities/stack.hpp"
+#include "utilities/ticks.hpp"
 
 typedef OverflowTaskQueue<oop, mtGC>                 OopQueue;
 typedef OverflowTaskQueue<ObjArrayTask, mtGC>        ObjArrayTaskQueue;
@@ -61,6 +62,10 @@ private:
   G1FollowStackClosure _stack_closure;
   CLDToOopClosure      _cld_closure;
 
+  // Work stealing statistics of the last complete_marking() call.
+  size_t             _stolen_tasks;
+  Tickspan           _termination_time;
+
   inline bool is_empty();
   inline bool pop_object(oop& obj);
   inline bool pop_objarray(ObjArrayTask& array);
@@ -90,6 +95,9 @@ public:
                         ObjArrayTaskQueueSet* array_stacks,
                         ParallelTaskTerminator* terminator);
 
+  size_t          stolen_tasks() const     { return _stolen_tasks; }
+  const Tickspan& termination_time() const { return _termination_time; }
+
   // Closure getters
   CLDToOopClosure*      cld_closure()   { return &_cld_closure; }
   G1MarkAndPushClosure* mark_closure()  { return &_mark_closure; }
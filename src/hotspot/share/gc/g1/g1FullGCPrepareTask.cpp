@@ -50,7 +50,11 @@ bool G1FullGCPrepareTask::G1CalculatePointersClosure::do_heap_region(HeapRegion*
       free_humongous_region(hr);
     }
   } else if (!hr->is_pinned()) {
-    prepare_for_compaction(hr);
+    if (hr->has_pinned_objects()) {
+      prepare_for_pinned_objects(hr);
+    } else {
+      prepare_for_compaction(hr);
+    }
   }
 
   // Reset data structures not valid after Full GC.
@@ -110,6 +114,14 @@ void G1FullGCPrepareTask::G1CalculatePointersClosure::free_humongous_region(Heap
   dummy_free_list.remove_all();
 }
 
+void G1FullGCPrepareTask::G1CalculatePointersClosure::prepare_for_pinned_objects(HeapRegion* hr) {
+  // Regions with objects pinned by JNI critical sections are not compacted,
+  // so the live objects stay in place. The dead objects are overwritten with
+  // filler objects in the compaction phase.
+  G1PrepareNotMovingLiveClosure prepare_live;
+  hr->apply_to_marked_objects(_bitmap, &prepare_live);
+}
+
 void G1FullGCPrepareTask::G1CalculatePointersClosure::reset_region_metadata(HeapRegion* hr) {
   hr->rem_set()->clear();
   hr->clear_cardtable();
@@ -128,6 +140,13 @@ size_t G1FullGCPrepareTask::G1PrepareCompactLiveClosure::apply(oop object) {
   return size;
 }
 
+size_t G1FullGCPrepareTask::G1PrepareNotMovingLiveClosure::apply(oop object) {
+  // Not forwarded objects must have a valid prototype mark word, any other
+  // marks have been preserved during marking.
+  object->init_mark_raw();
+  return object->size();
+}
+
 size_t G1FullGCPrepareTask::G1RePrepareClosure::apply(oop obj) {
   // We only re-prepare objects forwarded within the current region, so
   // skip objects that are already forwarded to another region.
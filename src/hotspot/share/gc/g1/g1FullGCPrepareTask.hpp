@@ -58,6 +58,7 @@ protected:
 
     virtual void prepare_for_compaction(HeapRegion* hr);
     void prepare_for_compaction_work(G1FullGCCompactionPoint* cp, HeapRegion* hr);
+    void prepare_for_pinned_objects(HeapRegion* hr);
     void free_humongous_region(HeapRegion* hr);
     void reset_region_metadata(HeapRegion* hr);
 
@@ -78,6 +79,11 @@ protected:
     size_t apply(oop object);
   };
 
+  class G1PrepareNotMovingLiveClosure : public StackObj {
+  public:
+    size_t apply(oop object);
+  };
+
   class G1RePrepareClosure : public StackObj {
     G1FullGCCompactionPoint* _cp;
     HeapRegion* _current;
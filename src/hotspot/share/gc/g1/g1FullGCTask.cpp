@@ -23,12 +23,71 @@
  */
 
 #include "precompiled.hpp"
+#include "gc/g1/g1FullCollector.hpp"
+#include "gc/g1/g1FullGCScope.hpp"
 #include "gc/g1/g1FullGCTask.hpp"
+#include "gc/shared/gcTrace.hpp"
+#include "gc/shared/workerDataArray.inline.hpp"
 #include "logging/log.hpp"
+#include "logging/logStream.hpp"
+#include "memory/resourceArea.hpp"
 #include "utilities/ticks.hpp"
 
+G1FullGCTask::G1FullGCTask(const char* name, G1FullCollector* collector) :
+  AbstractGangTask(name),
+  _collector(collector),
+  _work_times(collector->workers(), "Work (ms):"),
+  _termination_times(collector->workers(), "Termination (ms):"),
+  _stolen_tasks(collector->workers(), "Stolen Tasks:") { }
+
 void G1FullGCTask::log_task(const char* name, uint worker_id, const Ticks& start, const Ticks& stop) {
   Tickspan duration = stop - start;
   double duration_ms = TimeHelper::counter_to_millis(duration.value());
+  _work_times.set(worker_id, duration.seconds());
   log_trace(gc, phases)("%s (%u) %.3fms", name, worker_id, duration_ms);
 }
+
+void G1FullGCTask::record_work_stealing(uint worker_id, const Tickspan& termination_time, size_t stolen_tasks) {
+  _termination_times.set(worker_id, termination_time.seconds());
+  _stolen_tasks.set(worker_id, stolen_tasks);
+}
+
+void G1FullGCTask::report_statistics() const {
+  LogTarget(Debug, gc, phases) lt;
+  if (lt.is_enabled()) {
+    ResourceMark rm;
+    LogStream ls(lt);
+    ls.print_cr("  %s", name());
+    ls.print("    ");
+    _work_times.print_summary_on(&ls);
+    if (_stolen_tasks.get(0) != WorkerDataArray<size_t>::uninitialized()) {
+      ls.print("    ");
+      _termination_times.print_summary_on(&ls);
+      ls.print("    ");
+      _stolen_tasks.print_summary_on(&ls);
+    }
+    print_additional_statistics(&ls);
+
+    LogTarget(Trace, gc, phases, task) lt_task;
+    if (lt_task.is_enabled()) {
+      LogStream ls_task(lt_task);
+      ls_task.print("    ");
+      _work_times.print_details_on(&ls_task);
+    }
+  }
+
+  G1FullGCTracer* tracer = _collector->scope()->tracer();
+  for (uint i = 0; i < _collector->workers(); i++) {
+    double work_time = _work_times.get(i);
+    if (work_time == WorkerDataArray<double>::uninitialized()) {
+      // The worker did not take part in this task.
+      continue;
+    }
+    double termination_time = _termination_times.get(i);
+    size_t stolen_tasks = _stolen_tasks.get(i);
+    tracer->report_worker_statistics(name(), i,
+                                     work_time,
+                                     termination_time == WorkerDataArray<double>::uninitialized() ? 0.0 : termination_time,
+                                     stolen_tasks == WorkerDataArray<size_t>::uninitialized() ? 0 : stolen_tasks);
+  }
+}
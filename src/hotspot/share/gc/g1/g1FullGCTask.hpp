@@ -25,6 +25,7 @@
 #ifndef SHARE_GC_G1_G1FULLGCTASK_HPP
 #define SHARE_GC_G1_G1FULLGCTASK_HPP
 
+#include "gc/shared/workerDataArray.hpp"
 #include "gc/shared/workgroup.hpp"
 #include "utilities/ticks.hpp"
 
@@ -33,13 +34,27 @@ class G1FullCollector;
 class G1FullGCTask : public AbstractGangTask {
   G1FullCollector* _collector;
 
+  // Per-worker statistics, times are in seconds. Termination time and stolen
+  // tasks are only recorded by tasks that use work stealing.
+  WorkerDataArray<double> _work_times;
+  WorkerDataArray<double> _termination_times;
+  WorkerDataArray<size_t> _stolen_tasks;
+
 protected:
-  G1FullGCTask(const char* name, G1FullCollector* collector) :
-    AbstractGangTask(name),
-    _collector(collector) { }
+  G1FullGCTask(const char* name, G1FullCollector* collector);
 
   G1FullCollector* collector() { return _collector; }
   void log_task(const char* name, uint worker_id, const Ticks& start, const Ticks& stop = Ticks::now());
+
+  void record_work_stealing(uint worker_id, const Tickspan& termination_time, size_t stolen_tasks);
+
+  // Print task specific statistics, called by report_statistics().
+  virtual void print_additional_statistics(outputStream* out) const { }
+
+public:
+  // Print the per-worker statistics to gc+phases(+task) and send them as JFR
+  // events. Must be called after all workers completed the task.
+  void report_statistics() const;
 };
 
 #endif // SHARE_GC_G1_G1FULLGCTASK_HPP
@@ -70,6 +70,10 @@ class G1GCPhaseTimes : public CHeapObj<mtGC> {
     Other,
     GCWorkerTotal,
     GCWorkerEnd,
+    OptScanRS,
+    OptObjCopy,
+    OptCodeRoots,
+    OptTermination,
     StringDedupQueueFixup,
     StringDedupTableFixup,
     RedirtyCards,
@@ -81,7 +85,8 @@ class G1GCPhaseTimes : public CHeapObj<mtGC> {
   enum GCScanRSWorkItems {
     ScanRSScannedCards,
     ScanRSClaimedCards,
-    ScanRSSkippedCards
+    ScanRSSkippedCards,
+    ScanRSScannedOptionalRefs // Only used by OptScanRS.
   };
 
   enum GCUpdateRSWorkItems {
@@ -93,6 +98,8 @@ class G1GCPhaseTimes : public CHeapObj<mtGC> {
  private:
   // Markers for grouping the phases in the GCPhases enum above
   static const int GCMainParPhasesLast = GCWorkerEnd;
+  static const int GCOptParPhasesFirst = OptScanRS;
+  static const int GCOptParPhasesLast = OptTermination;
   static const int StringDedupPhasesFirst = StringDedupQueueFixup;
   static const int StringDedupPhasesLast = StringDedupTableFixup;
 
@@ -106,11 +113,19 @@ class G1GCPhaseTimes : public CHeapObj<mtGC> {
   WorkerDataArray<size_t>* _scan_rs_claimed_cards;
   WorkerDataArray<size_t>* _scan_rs_skipped_cards;
 
+  WorkerDataArray<size_t>* _opt_scan_rs_scanned_cards;
+  WorkerDataArray<size_t>* _opt_scan_rs_claimed_cards;
+  WorkerDataArray<size_t>* _opt_scan_rs_skipped_cards;
+  WorkerDataArray<size_t>* _opt_scan_rs_scanned_opt_refs;
+
   WorkerDataArray<size_t>* _termination_attempts;
 
+  WorkerDataArray<size_t>* _opt_termination_attempts;
+
   WorkerDataArray<size_t>* _redirtied_cards;
 
   double _cur_collection_par_time_ms;
+  double _cur_optional_evac_ms;
   double _cur_collection_code_root_fixup_time_ms;
   double _cur_strong_code_root_purge_time_ms;
 
@@ -162,6 +177,12 @@ class G1GCPhaseTimes : public CHeapObj<mtGC> {
   double _cur_verify_before_time_ms;
   double _cur_verify_after_time_ms;
 
+  // Concurrent uncommit work done since the last printed pause. Not reset
+  // at the start of a pause.
+  double _concurrent_uncommit_time_ms;
+  size_t _concurrent_uncommit_regions;
+  size_t _concurrent_uncommit_chunks;
+
   ReferenceProcessorPhaseTimes _ref_phase_times;
 
   double worker_time(GCParPhases phase, uint worker);
@@ -184,8 +205,10 @@ class G1GCPhaseTimes : public CHeapObj<mtGC> {
 
   double print_pre_evacuate_collection_set() const;
   double print_evacuate_collection_set() const;
+  double print_evacuate_optional_collection_set() const;
   double print_post_evacuate_collection_set() const;
   void print_other(double accounted_ms) const;
+  void print_concurrent_uncommit();
 
  public:
   G1GCPhaseTimes(STWGCTimer* gc_timer, uint max_gc_threads);
@@ -200,8 +223,14 @@ class G1GCPhaseTimes : public CHeapObj<mtGC> {
 
   void record_or_add_objcopy_time_secs(uint worker_i, double secs);
 
+  // record the time a phase took in seconds, or add to it if the phase has
+  // already been recorded for this worker during the current pause
+  void record_or_add_time_secs(GCParPhases phase, uint worker_i, double secs);
+
   void record_thread_work_item(GCParPhases phase, uint worker_i, size_t count, uint index = 0);
 
+  void record_or_add_thread_work_item(GCParPhases phase, uint worker_i, size_t count, uint index = 0);
+
   // return the average time for a phase in milliseconds
   double average_time_ms(GCParPhases phase);
 
@@ -233,6 +262,10 @@ class G1GCPhaseTimes : public CHeapObj<mtGC> {
     _cur_collection_par_time_ms = ms;
   }
 
+  void record_optional_evacuation(double ms) {
+    _cur_optional_evac_ms += ms;
+  }
+
   void record_code_root_fixup_time(double ms) {
     _cur_collection_code_root_fixup_time_ms = ms;
   }
@@ -320,6 +353,12 @@ class G1GCPhaseTimes : public CHeapObj<mtGC> {
     _cur_verify_after_time_ms = time_ms;
   }
 
+  void record_concurrent_uncommit_chunk(double time_ms, size_t regions) {
+    _concurrent_uncommit_time_ms += time_ms;
+    _concurrent_uncommit_regions += regions;
+    _concurrent_uncommit_chunks++;
+  }
+
   void inc_external_accounted_time_ms(double time_ms) {
     _external_accounted_time_ms += time_ms;
   }
@@ -336,6 +375,10 @@ class G1GCPhaseTimes : public CHeapObj<mtGC> {
     return _cur_collection_par_time_ms;
   }
 
+  double cur_optional_evac_ms() {
+    return _cur_optional_evac_ms;
+  }
+
   double cur_clear_ct_time_ms() {
     return _cur_clear_ct_time_ms;
   }
@@ -26,10 +26,20 @@
 #include "gc/g1/g1CollectedHeap.hpp"
 #include "gc/g1/g1HeapSizingPolicy.hpp"
 #include "gc/g1/g1Analytics.hpp"
+#include "gc/g1/g1CollectorState.hpp"
+#include "gc/g1/g1ConcurrentMark.hpp"
+#include "gc/g1/g1ConcurrentMarkThread.hpp"
+#include "gc/g1/g1Policy.hpp"
+#include "gc/shared/collectorPolicy.hpp"
 #include "logging/log.hpp"
 #include "runtime/globals.hpp"
+#include "runtime/os.hpp"
+#include "utilities/align.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/globalDefinitions.hpp"
+#ifdef LINUX
+#include "osContainer_linux.hpp"
+#endif
 
 G1HeapSizingPolicy::G1HeapSizingPolicy(const G1CollectedHeap* g1h, const G1Analytics* analytics) :
   _g1h(g1h),
@@ -44,6 +54,18 @@ void G1HeapSizingPolicy::clear_ratio_check_data() {
   _ratio_over_threshold_count = 0;
   _ratio_over_threshold_sum = 0.0;
   _pauses_since_start = 0;
+  _ratio_under_threshold_count = 0;
+}
+
+// Returns the amount of memory still available to the VM if it runs in a
+// container with a memory limit, otherwise SIZE_MAX.
+static size_t container_available_bytes() {
+#ifdef LINUX
+  if (OSContainer::is_containerized() && OSContainer::memory_limit_in_bytes() > 0) {
+    return (size_t)os::available_memory();
+  }
+#endif
+  return SIZE_MAX;
 }
 
 size_t G1HeapSizingPolicy::expansion_amount() {
@@ -140,6 +162,15 @@ size_t G1HeapSizingPolicy::expansion_amount() {
     expand_bytes = MAX2(expand_bytes, min_expand_bytes);
     expand_bytes = MIN2(expand_bytes, uncommitted_bytes);
 
+    // Do not grow beyond what the container still has available; committing
+    // that memory would only get the VM killed by the OOM killer.
+    size_t available_bytes = container_available_bytes();
+    if (expand_bytes > available_bytes) {
+      expand_bytes = align_down(available_bytes, HeapRegion::GrainBytes);
+      log_debug(gc, ergo, heap)("Limit heap expansion to container available memory: " SIZE_FORMAT "B",
+                                expand_bytes);
+    }
+
     clear_ratio_check_data();
   } else {
     // An expansion was not triggered. If we've started counting, increment
@@ -156,3 +187,60 @@ size_t G1HeapSizingPolicy::expansion_amount() {
 
   return expand_bytes;
 }
+
+size_t G1HeapSizingPolicy::shrink_amount() {
+  if (!G1AdaptiveHeapShrink) {
+    return 0;
+  }
+  // Concurrent marking and remembered set rebuilding work on regions and
+  // bitmaps sized at the start of the cycle; do not uncommit under them.
+  if (_g1h->collector_state()->mark_or_rebuild_in_progress() ||
+      _g1h->concurrent_mark()->cm_thread()->during_cycle()) {
+    return 0;
+  }
+
+  double recent_gc_overhead = _analytics->recent_avg_pause_time_ratio() * 100.0;
+  const double gc_overhead_percent = 100.0 * (1.0 / (1.0 + GCTimeRatio));
+  double threshold = gc_overhead_percent * G1ShrinkHeapGCOverheadPercent / 100.0;
+
+  // Require the overhead to stay below the threshold for a full window of
+  // pauses so that a single cheap pause does not undo a recent expansion.
+  if (recent_gc_overhead >= threshold) {
+    _ratio_under_threshold_count = 0;
+    return 0;
+  }
+  _ratio_under_threshold_count++;
+  if (_ratio_under_threshold_count < _num_prev_pauses_for_heuristics) {
+    return 0;
+  }
+  _ratio_under_threshold_count = 0;
+
+  // Keep at least MinHeapFreeRatio free after the shrink, room for the next
+  // young generation, and never go below the minimum heap size.
+  size_t committed_bytes = _g1h->capacity();
+  size_t used_bytes = _g1h->used();
+  double max_used_ratio = 1.0 - (double)MinHeapFreeRatio / 100.0;
+  size_t min_desired_bytes = _g1h->max_capacity();
+  if (max_used_ratio > 0.0) {
+    min_desired_bytes = MIN2((size_t)(used_bytes / max_used_ratio), min_desired_bytes);
+  }
+  size_t young_bytes = (size_t)_g1h->g1_policy()->young_list_target_length() * HeapRegion::GrainBytes;
+  min_desired_bytes = MAX2(min_desired_bytes, used_bytes + young_bytes);
+  min_desired_bytes = MAX2(min_desired_bytes, _g1h->collector_policy()->min_heap_byte_size());
+
+  if (committed_bytes <= min_desired_bytes) {
+    return 0;
+  }
+
+  size_t shrink_bytes = (committed_bytes - min_desired_bytes) * G1ExpandByPercentOfAvailable / 100;
+  shrink_bytes = align_down(shrink_bytes, HeapRegion::GrainBytes);
+  if (shrink_bytes < HeapRegion::GrainBytes) {
+    return 0;
+  }
+
+  log_debug(gc, ergo, heap)("Attempt heap shrinking (recent GC overhead lower than threshold after GC) "
+                            "recent GC overhead: %1.2f %% threshold: %1.2f %% committed: " SIZE_FORMAT "B "
+                            "minimum desired: " SIZE_FORMAT "B shrink amount: " SIZE_FORMAT "B",
+                            recent_gc_overhead, threshold, committed_bytes, min_desired_bytes, shrink_bytes);
+  return shrink_bytes;
+}
@@ -44,7 +44,9 @@ class G1HeapSizingPolicy: public CHeapObj<mtGC> {
   uint _ratio_over_threshold_count;
   double _ratio_over_threshold_sum;
   uint _pauses_since_start;
-
+  // Number of consecutive pauses whose recent GC overhead stayed below the
+  // shrink threshold.
+  uint _ratio_under_threshold_count;
 
 protected:
   G1HeapSizingPolicy(const G1CollectedHeap* g1h, const G1Analytics* analytics);
@@ -54,7 +56,12 @@ public:
   // exceeded the desired limit, return an amount to expand by.
   virtual size_t expansion_amount();
 
-  // Clear ratio tracking data used by expansion_amount().
+  // If a shrink would be appropriate, because recent GC overhead has stayed
+  // well below the desired limit for a full window of pauses, return an
+  // amount to shrink by.
+  size_t shrink_amount();
+
+  // Clear ratio tracking data used by expansion_amount() and shrink_amount().
   void clear_ratio_check_data();
 
   static G1HeapSizingPolicy* create(const G1CollectedHeap* g1h, const G1Analytics* analytics);
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_VM_GC_G1_G1OOPSTARCHUNKEDLIST_HPP
+#define SHARE_VM_GC_G1_G1OOPSTARCHUNKEDLIST_HPP
+
+#include "memory/allocation.hpp"
+#include "oops/oopsHierarchy.hpp"
+#include "utilities/stack.hpp"
+
+class OopClosure;
+
+// List of locations (oop* or narrowOop*) collected during evacuation that
+// point into a region that is not (yet) part of the collection set. Root
+// locations and heap locations are kept separately so that they can be
+// processed with different closures later.
+class G1OopStarChunkedList : public CHeapObj<mtGC> {
+  size_t _used_memory;
+
+  Stack<oop*, mtGC> _roots;
+  Stack<narrowOop*, mtGC> _croots;
+  Stack<oop*, mtGC> _oops;
+  Stack<narrowOop*, mtGC> _coops;
+
+  template <typename T> void delete_list(Stack<T*, mtGC>* stack);
+
+  template <typename T> size_t chunks_do(Stack<T*, mtGC>* stack, OopClosure* cl);
+
+  template <typename T> inline void push(Stack<T*, mtGC>* stack, T* p);
+
+public:
+  G1OopStarChunkedList() : _used_memory(0) { }
+  ~G1OopStarChunkedList();
+
+  size_t used_memory() const { return _used_memory; }
+
+  // Applies root_cl to all root locations and obj_cl to all heap locations.
+  // Returns the number of locations processed.
+  size_t oops_do(OopClosure* obj_cl, OopClosure* root_cl);
+
+  inline void push_oop(oop* p);
+  inline void push_oop(narrowOop* p);
+
+  inline void push_root(oop* p);
+  inline void push_root(narrowOop* p);
+};
+
+#endif // SHARE_VM_GC_G1_G1OOPSTARCHUNKEDLIST_HPP
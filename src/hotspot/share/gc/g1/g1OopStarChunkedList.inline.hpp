@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_VM_GC_G1_G1OOPSTARCHUNKEDLIST_INLINE_HPP
+#define SHARE_VM_GC_G1_G1OOPSTARCHUNKEDLIST_INLINE_HPP
+
+#include "gc/g1/g1OopStarChunkedList.hpp"
+#include "memory/iterator.hpp"
+#include "utilities/stack.inline.hpp"
+
+template <typename T>
+inline void G1OopStarChunkedList::push(Stack<T*, mtGC>* stack, T* p) {
+  stack->push(p);
+  _used_memory += sizeof(T*);
+}
+
+inline void G1OopStarChunkedList::push_root(narrowOop* p) {
+  push(&_croots, p);
+}
+
+inline void G1OopStarChunkedList::push_root(oop* p) {
+  push(&_roots, p);
+}
+
+inline void G1OopStarChunkedList::push_oop(narrowOop* p) {
+  push(&_coops, p);
+}
+
+inline void G1OopStarChunkedList::push_oop(oop* p) {
+  push(&_oops, p);
+}
+
+template <typename T>
+void G1OopStarChunkedList::delete_list(Stack<T*, mtGC>* stack) {
+  stack->clear(true);
+}
+
+template <typename T>
+size_t G1OopStarChunkedList::chunks_do(Stack<T*, mtGC>* stack, OopClosure* cl) {
+  size_t result = 0;
+  while (!stack->is_empty()) {
+    T* p = stack->pop();
+    cl->do_oop(p);
+    result++;
+  }
+  return result;
+}
+
+#endif // SHARE_VM_GC_G1_G1OOPSTARCHUNKEDLIST_INLINE_HPP
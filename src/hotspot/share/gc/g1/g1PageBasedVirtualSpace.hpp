@@ -92,8 +92,6 @@ class G1PageBasedVirtualSpace {
 
   // Returns the index of the page which contains the given address.
   size_t  addr_to_page_index(char* addr) const;
-  // Returns the address of the given page index.
-  char*  page_start(size_t index) const;
 
   // Is the given page index the last page?
   bool is_last_page(size_t index) const { return index == (_committed.size() - 1); }
@@ -121,6 +119,11 @@ class G1PageBasedVirtualSpace {
 
   void pretouch(size_t start_page, size_t size_in_pages, WorkGang* pretouch_gang = NULL);
 
+  // Returns the address of the given page index.
+  char*  page_start(size_t index) const;
+
+  size_t page_size() const { return _page_size; }
+
   // Initialize the given reserved space with the given base address and the size
   // actually used.
   // Prefer to commit in page_size chunks.
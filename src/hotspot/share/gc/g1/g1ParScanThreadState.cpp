@@ -26,18 +26,23 @@
 #include "gc/g1/g1Allocator.inline.hpp"
 #include "gc/g1/g1CollectedHeap.inline.hpp"
 #include "gc/g1/g1CollectionSet.hpp"
+#include "gc/g1/g1NUMA.hpp"
 #include "gc/g1/g1OopClosures.inline.hpp"
 #include "gc/g1/g1ParScanThreadState.inline.hpp"
 #include "gc/g1/g1RootClosures.hpp"
 #include "gc/g1/g1StringDedup.hpp"
 #include "gc/shared/gcTrace.hpp"
 #include "gc/shared/taskqueue.inline.hpp"
+#include "logging/log.hpp"
 #include "memory/allocation.inline.hpp"
 #include "oops/access.inline.hpp"
 #include "oops/oop.inline.hpp"
 #include "runtime/prefetch.inline.hpp"
 
-G1ParScanThreadState::G1ParScanThreadState(G1CollectedHeap* g1h, uint worker_id, size_t young_cset_length)
+G1ParScanThreadState::G1ParScanThreadState(G1CollectedHeap* g1h,
+                                           uint worker_id,
+                                           size_t young_cset_length,
+                                           size_t optional_cset_length)
   : _g1h(g1h),
     _refs(g1h->task_queue(worker_id)),
     _dcq(&g1h->dirty_card_queue_set()),
@@ -52,7 +57,13 @@ G1ParScanThreadState::G1ParScanThreadState(G1CollectedHeap* g1h, uint worker_id,
     _stack_trim_upper_threshold(GCDrainStackTargetSize * 2 + 1),
     _stack_trim_lower_threshold(GCDrainStackTargetSize),
     _trim_ticks(),
-    _old_gen_is_full(false)
+    _num_copies(0),
+    _num_slow_copies(0),
+    _copy_ticks(),
+    _old_gen_is_full(false),
+    _num_optional_regions(optional_cset_length),
+    _oops_into_optional_regions(NULL),
+    _node_index(G1NUMA::numa()->index_of_current_thread())
 {
   // we allocate G1YoungSurvRateNumRegions plus one entries, since
   // we "sacrifice" entry 0 to keep track of surviving bytes for
@@ -79,6 +90,10 @@ G1ParScanThreadState::G1ParScanThreadState(G1CollectedHeap* g1h, uint worker_id,
   _dest[InCSetState::Old]          = InCSetState::Old;
 
   _closures = G1EvacuationRootClosures::create_root_closures(this, _g1h);
+
+  if (_num_optional_regions > 0) {
+    _oops_into_optional_regions = new G1OopStarChunkedList[_num_optional_regions];
+  }
 }
 
 // Pass locally gathered statistics to global state.
@@ -88,16 +103,41 @@ void G1ParScanThreadState::flush(size_t* surviving_young_words) {
   _plab_allocator->flush_and_retire_stats();
   _g1h->g1_policy()->record_age_table(&_age_table);
 
+  if (G1EvacPrefetchStatistics) {
+    print_copy_statistics();
+  }
+
   uint length = _g1h->collection_set()->young_region_length();
   for (uint region_index = 0; region_index < length; region_index++) {
     surviving_young_words[region_index] += _surviving_young_words[region_index];
   }
 }
 
+// Copies taking longer than this are most likely stalled on cache misses on
+// the source object header or klass, rather than bound by the copying.
+static const uint64_t SlowCopyNanos = 500;
+
+void G1ParScanThreadState::record_copy(Tickspan duration) {
+  _num_copies++;
+  if (duration.nanoseconds() > SlowCopyNanos) {
+    _num_slow_copies++;
+  }
+  _copy_ticks += duration;
+}
+
+void G1ParScanThreadState::print_copy_statistics() const {
+  log_debug(gc, task, stats)("GC Worker %u: copies: " SIZE_FORMAT ", slow copies: " SIZE_FORMAT " (%.1f%%), "
+                             "copy time: %.3fms, prefetch distance: " UINTX_FORMAT,
+                             _worker_id, _num_copies, _num_slow_copies,
+                             percent_of(_num_slow_copies, _num_copies),
+                             _copy_ticks.seconds() * MILLIUNITS, G1EvacPrefetchDistance);
+}
+
 G1ParScanThreadState::~G1ParScanThreadState() {
   delete _plab_allocator;
   delete _closures;
   FREE_C_HEAP_ARRAY(size_t, _surviving_young_words_base);
+  delete [] _oops_into_optional_regions;
 }
 
 void G1ParScanThreadState::waste(size_t& wasted, size_t& undo_wasted) {
@@ -160,7 +200,8 @@ HeapWord* G1ParScanThreadState::allocate_in_next_plab(InCSetState const state,
     bool plab_refill_in_old_failed = false;
     HeapWord* const obj_ptr = _plab_allocator->allocate(InCSetState::Old,
                                                         word_sz,
-                                                        &plab_refill_in_old_failed);
+                                                        &plab_refill_in_old_failed,
+                                                        _node_index);
     // Make sure that we won't attempt to copy any other objects out
     // of a survivor region (given that apparently we cannot allocate
     // any new ones) to avoid coming into this slow path again and again.
@@ -200,7 +241,7 @@ InCSetState G1ParScanThreadState::next_state(InCSetState const state, markOop co
 void G1ParScanThreadState::report_promotion_event(InCSetState const dest_state,
                                                   oop const old, size_t word_sz, uint age,
                                                   HeapWord * const obj_ptr) const {
-  PLAB* alloc_buf = _plab_allocator->alloc_buffer(dest_state);
+  PLAB* alloc_buf = _plab_allocator->alloc_buffer(dest_state, _node_index);
   if (alloc_buf->contains(obj_ptr)) {
     _g1h->_gc_tracer_stw->report_promotion_in_new_plab_event(old->klass(), word_sz, age,
                                                              dest_state.value() == InCSetState::Old,
@@ -221,6 +262,13 @@ oop G1ParScanThreadState::copy_to_survivor_space(InCSetState const state,
   assert( (from_region->is_young() && young_index >  0) ||
          (!from_region->is_young() && young_index == 0), "invariant" );
 
+  // Objects in regions pinned by JNI critical sections must not move.
+  // Handle them like objects that failed evacuation so that the region
+  // is retained.
+  if (from_region->has_pinned_objects()) {
+    return handle_evacuation_failure_par(old, old_mark, true /* pinned */);
+  }
+
   uint age = 0;
   InCSetState dest_state = next_state(state, old_mark, age);
   // The second clause is to prevent premature evacuation failure in case there
@@ -228,13 +276,13 @@ oop G1ParScanThreadState::copy_to_survivor_space(InCSetState const state,
   if (_old_gen_is_full && dest_state.is_old()) {
     return handle_evacuation_failure_par(old, old_mark);
   }
-  HeapWord* obj_ptr = _plab_allocator->plab_allocate(dest_state, word_sz);
+  HeapWord* obj_ptr = _plab_allocator->plab_allocate(dest_state, word_sz, _node_index);
 
   // PLAB allocations should succeed most of the time, so we'll
   // normally check against NULL once and that's it.
   if (obj_ptr == NULL) {
     bool plab_refill_failed = false;
-    obj_ptr = _plab_allocator->allocate_direct_or_new_plab(dest_state, word_sz, &plab_refill_failed);
+    obj_ptr = _plab_allocator->allocate_direct_or_new_plab(dest_state, word_sz, &plab_refill_failed, _node_index);
     if (obj_ptr == NULL) {
       obj_ptr = allocate_in_next_plab(state, &dest_state, word_sz, plab_refill_failed);
       if (obj_ptr == NULL) {
@@ -257,7 +305,7 @@ oop G1ParScanThreadState::copy_to_survivor_space(InCSetState const state,
   if (_g1h->evacuation_should_fail()) {
     // Doing this after all the allocation attempts also tests the
     // undo_allocation() method too.
-    _plab_allocator->undo_allocation(dest_state, obj_ptr, word_sz);
+    _plab_allocator->undo_allocation(dest_state, obj_ptr, word_sz, _node_index);
     return handle_evacuation_failure_par(old, old_mark);
   }
 #endif // !PRODUCT
@@ -318,7 +366,7 @@ oop G1ParScanThreadState::copy_to_survivor_space(InCSetState const state,
     }
     return obj;
   } else {
-    _plab_allocator->undo_allocation(dest_state, obj_ptr, word_sz);
+    _plab_allocator->undo_allocation(dest_state, obj_ptr, word_sz, _node_index);
     return forward_ptr;
   }
 }
@@ -326,7 +374,7 @@ oop G1ParScanThreadState::copy_to_survivor_space(InCSetState const state,
 G1ParScanThreadState* G1ParScanThreadStateSet::state_for_worker(uint worker_id) {
   assert(worker_id < _n_workers, "out of bounds access");
   if (_states[worker_id] == NULL) {
-    _states[worker_id] = new G1ParScanThreadState(_g1h, worker_id, _young_cset_length);
+    _states[worker_id] = new G1ParScanThreadState(_g1h, worker_id, _young_cset_length, _optional_cset_length);
   }
   return _states[worker_id];
 }
@@ -353,7 +401,7 @@ void G1ParScanThreadStateSet::flush() {
   _flushed = true;
 }
 
-oop G1ParScanThreadState::handle_evacuation_failure_par(oop old, markOop m) {
+oop G1ParScanThreadState::handle_evacuation_failure_par(oop old, markOop m, bool pinned) {
   assert(_g1h->is_in_cset(old), "Object " PTR_FORMAT " should be in the CSet", p2i(old));
 
   oop forward_ptr = old->forward_to_atomic(old, memory_order_relaxed);
@@ -365,8 +413,9 @@ oop G1ParScanThreadState::handle_evacuation_failure_par(oop old, markOop m) {
       r->set_evacuation_failed(true);
      _g1h->hr_printer()->evac_failure(r);
     }
+    r->record_evac_failure_obj(old);
 
-    _g1h->preserve_mark_during_evac_failure(_worker_id, old, m);
+    _g1h->preserve_mark_during_evac_failure(_worker_id, old, m, pinned);
 
     _scanner.set_region(r);
     old->oop_iterate_backwards(&_scanner);
@@ -383,11 +432,15 @@ oop G1ParScanThreadState::handle_evacuation_failure_par(oop old, markOop m) {
     return forward_ptr;
   }
 }
-G1ParScanThreadStateSet::G1ParScanThreadStateSet(G1CollectedHeap* g1h, uint n_workers, size_t young_cset_length) :
+G1ParScanThreadStateSet::G1ParScanThreadStateSet(G1CollectedHeap* g1h,
+                                                 uint n_workers,
+                                                 size_t young_cset_length,
+                                                 size_t optional_cset_length) :
     _g1h(g1h),
     _states(NEW_C_HEAP_ARRAY(G1ParScanThreadState*, n_workers, mtGC)),
     _surviving_young_words_total(NEW_C_HEAP_ARRAY(size_t, young_cset_length, mtGC)),
     _young_cset_length(young_cset_length),
+    _optional_cset_length(optional_cset_length),
     _n_workers(n_workers),
     _flushed(false) {
   for (uint i = 0; i < n_workers; ++i) {
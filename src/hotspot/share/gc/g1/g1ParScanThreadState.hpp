@@ -37,6 +37,7 @@
 #include "oops/oop.hpp"
 #include "utilities/ticks.hpp"
 
+class G1OopStarChunkedList;
 class G1PLABAllocator;
 class G1EvacuationRootClosures;
 class HeapRegion;
@@ -65,6 +66,11 @@ class G1ParScanThreadState : public CHeapObj<mtGC> {
   uint const _stack_trim_lower_threshold;
 
   Tickspan _trim_ticks;
+
+  // Copy statistics, only gathered with G1EvacPrefetchStatistics.
+  size_t _num_copies;
+  size_t _num_slow_copies;
+  Tickspan _copy_ticks;
   // Map from young-age-index (0 == not young, 1 is youngest) to
   // surviving words. base is what we get back from the malloc call
   size_t* _surviving_young_words_base;
@@ -75,6 +81,15 @@ class G1ParScanThreadState : public CHeapObj<mtGC> {
   // available for allocation.
   bool _old_gen_is_full;
 
+  // References into optional collection set regions found during
+  // evacuation, one list per optional region.
+  size_t _num_optional_regions;
+  G1OopStarChunkedList* _oops_into_optional_regions;
+
+  // The NUMA node index of the worker thread using this state, used to
+  // place survivor objects close to the thread copying them.
+  uint _node_index;
+
 #define PADDING_ELEM_NUM (DEFAULT_CACHE_LINE_SIZE / sizeof(size_t))
 
   DirtyCardQueue& dirty_card_queue()             { return _dcq;  }
@@ -89,7 +104,10 @@ class G1ParScanThreadState : public CHeapObj<mtGC> {
   }
 
 public:
-  G1ParScanThreadState(G1CollectedHeap* g1h, uint worker_id, size_t young_cset_length);
+  G1ParScanThreadState(G1CollectedHeap* g1h,
+                       uint worker_id,
+                       size_t young_cset_length,
+                       size_t optional_cset_length);
   virtual ~G1ParScanThreadState();
 
   void set_ref_discoverer(ReferenceDiscoverer* rd) { _scanner.set_ref_discoverer(rd); }
@@ -134,6 +152,15 @@ public:
 
   void flush(size_t* surviving_young_words);
 
+  // Remember a location pointing into the given optional collection set
+  // region, to be processed if that region is evacuated later in the pause.
+  template <typename T>
+  inline void remember_root_into_optional_region(T* p);
+  template <typename T>
+  inline void remember_reference_into_optional_region(T* p);
+
+  inline G1OopStarChunkedList* oops_into_optional_region(const HeapRegion* hr);
+
 private:
   #define G1_PARTIAL_ARRAY_MASK 0x2
 
@@ -171,8 +198,16 @@ private:
   inline void deal_with_reference(oop* ref_to_scan);
   inline void deal_with_reference(narrowOop* ref_to_scan);
 
+  // Maximum value of G1EvacPrefetchDistance.
+  static const uint MaxPrefetchDistance = 16;
+
+  template <class T> inline void prefetch_referent(T* p);
+  inline void prefetch_reference(StarTask ref);
   inline void dispatch_reference(StarTask ref);
 
+  void record_copy(Tickspan duration);
+  void print_copy_statistics() const;
+
   // Tries to allocate word_sz in the PLAB of the next "generation" after trying to
   // allocate into dest. State is the original (source) cset state for the object
   // that is allocated for. Previous_plab_refill_failed indicates whether previously
@@ -207,7 +242,7 @@ public:
   inline void steal_and_trim_queue(RefToScanQueueSet *task_queues);
 
   // An attempt to evacuate "obj" has failed; take necessary steps.
-  oop handle_evacuation_failure_par(oop obj, markOop m);
+  oop handle_evacuation_failure_par(oop obj, markOop m, bool pinned = false);
 };
 
 class G1ParScanThreadStateSet : public StackObj {
@@ -215,11 +250,15 @@ class G1ParScanThreadStateSet : public StackObj {
   G1ParScanThreadState** _states;
   size_t* _surviving_young_words_total;
   size_t _young_cset_length;
+  size_t _optional_cset_length;
   uint _n_workers;
   bool _flushed;
 
  public:
-  G1ParScanThreadStateSet(G1CollectedHeap* g1h, uint n_workers, size_t young_cset_length);
+  G1ParScanThreadStateSet(G1CollectedHeap* g1h,
+                          uint n_workers,
+                          size_t young_cset_length,
+                          size_t optional_cset_length);
   ~G1ParScanThreadStateSet();
 
   void flush();
@@ -229,7 +268,6 @@ class G1ParScanThreadStateSet : public StackObj {
   const size_t* surviving_young_words() const;
 
  private:
-  G1ParScanThreadState* new_par_scan_state(uint worker_id, size_t young_cset_length);
 };
 
 #endif // SHARE_VM_GC_G1_G1PARSCANTHREADSTATE_HPP
@@ -25,10 +25,12 @@
 #ifndef SHARE_VM_GC_G1_G1PARSCANTHREADSTATE_INLINE_HPP
 #define SHARE_VM_GC_G1_G1PARSCANTHREADSTATE_INLINE_HPP
 
+#include "gc/g1/g1OopStarChunkedList.inline.hpp"
 #include "gc/g1/g1ParScanThreadState.hpp"
 #include "gc/g1/g1RemSet.hpp"
 #include "oops/access.inline.hpp"
 #include "oops/oop.inline.hpp"
+#include "runtime/prefetch.inline.hpp"
 
 template <class T> void G1ParScanThreadState::do_oop_evac(T* p) {
   // Reference should not be NULL here as such are never pushed to the task queue.
@@ -44,12 +46,18 @@ template <class T> void G1ParScanThreadState::do_oop_evac(T* p) {
     markOop m = obj->mark_raw();
     if (m->is_marked()) {
       obj = (oop) m->decode_pointer();
+    } else if (G1EvacPrefetchStatistics) {
+      Ticks start = Ticks::now();
+      obj = copy_to_survivor_space(in_cset_state, obj, m);
+      record_copy(Ticks::now() - start);
     } else {
       obj = copy_to_survivor_space(in_cset_state, obj, m);
     }
     RawAccess<IS_NOT_NULL>::oop_store(p, obj);
   } else if (in_cset_state.is_humongous()) {
     _g1h->set_humongous_is_live(obj);
+  } else if (in_cset_state.is_optional()) {
+    remember_reference_into_optional_region(p);
   } else {
     assert(in_cset_state.is_default(),
            "In_cset_state must be NotInCSet here, but is " CSETSTATE_FORMAT, in_cset_state.value());
@@ -129,6 +137,22 @@ inline void G1ParScanThreadState::deal_with_reference(narrowOop* ref_to_scan) {
   do_oop_evac(ref_to_scan);
 }
 
+template <class T> inline void G1ParScanThreadState::prefetch_referent(T* p) {
+  // Reference should not be NULL here as such are never pushed to the task queue.
+  oop obj = RawAccess<IS_NOT_NULL>::oop_load(p);
+  // Prefetch for write, as we are likely to install a forwarding pointer.
+  // Header and klass normally share the cache line.
+  Prefetch::write(obj->mark_addr_raw(), 0);
+}
+
+inline void G1ParScanThreadState::prefetch_reference(StarTask ref) {
+  if (ref.is_narrow()) {
+    prefetch_referent((narrowOop*)ref);
+  } else if (!has_partial_array_mask((oop*)ref)) {
+    prefetch_referent((oop*)ref);
+  }
+}
+
 inline void G1ParScanThreadState::dispatch_reference(StarTask ref) {
   assert(verify_task(ref), "sanity");
   if (ref.is_narrow()) {
@@ -168,8 +192,39 @@ inline void G1ParScanThreadState::trim_queue_to_threshold(uint threshold) {
     }
   }
 
+  const uint distance = (uint)G1EvacPrefetchDistance;
+  if (distance == 0) {
+    while (_refs->pop_local(ref, threshold)) {
+      dispatch_reference(ref);
+    }
+    return;
+  }
+
+  // Software pipeline the popped entries: prefetch the referent of every
+  // entry when popping it, but only process it after the next distance
+  // entries have been popped, so the header is likely in the cache by the
+  // time the object is copied. The queue is LIFO, so prefetching when
+  // pushing alone mostly does not have enough time to complete.
+  StarTask pipeline[MaxPrefetchDistance];
+  uint head = 0;
+  uint num = 0;
   while (_refs->pop_local(ref, threshold)) {
-    dispatch_reference(ref);
+    prefetch_reference(ref);
+    if (num < distance) {
+      pipeline[(head + num) % distance] = ref;
+      num++;
+    } else {
+      StarTask oldest = pipeline[head];
+      pipeline[head] = ref;
+      head = (head + 1) % distance;
+      dispatch_reference(oldest);
+    }
+  }
+  // Processing the remaining entries may push new ones; our callers
+  // loop until the queue is trimmed enough.
+  for (; num > 0; num--) {
+    dispatch_reference(pipeline[head]);
+    head = (head + 1) % distance;
   }
 }
 
@@ -193,4 +248,30 @@ inline void G1ParScanThreadState::reset_trim_ticks() {
   _trim_ticks = Tickspan();
 }
 
+template <typename T>
+inline void G1ParScanThreadState::remember_root_into_optional_region(T* p) {
+  oop o = RawAccess<IS_NOT_NULL>::oop_load(p);
+  uint index = _g1h->heap_region_containing(o)->index_in_opt_cset();
+  assert(index < _num_optional_regions,
+         "Trying to access optional region idx %u beyond " SIZE_FORMAT, index, _num_optional_regions);
+  _oops_into_optional_regions[index].push_root(p);
+}
+
+template <typename T>
+inline void G1ParScanThreadState::remember_reference_into_optional_region(T* p) {
+  oop o = RawAccess<IS_NOT_NULL>::oop_load(p);
+  uint index = _g1h->heap_region_containing(o)->index_in_opt_cset();
+  assert(index < _num_optional_regions,
+         "Trying to access optional region idx %u beyond " SIZE_FORMAT, index, _num_optional_regions);
+  _oops_into_optional_regions[index].push_oop(p);
+  DEBUG_ONLY(verify_ref(p);)
+}
+
+inline G1OopStarChunkedList* G1ParScanThreadState::oops_into_optional_region(const HeapRegion* hr) {
+  assert(hr->index_in_opt_cset() < _num_optional_regions,
+         "Trying to access optional region idx %u beyond " SIZE_FORMAT " " HR_FORMAT,
+         hr->index_in_opt_cset(), _num_optional_regions, HR_FORMAT_PARAMS(hr));
+  return &_oops_into_optional_regions[hr->index_in_opt_cset()];
+}
+
 #endif // SHARE_VM_GC_G1_G1PARSCANTHREADSTATE_INLINE_HPP
@@ -67,7 +67,8 @@ G1Policy::G1Policy(STWGCTimer* gc_timer) :
   _tenuring_threshold(MaxTenuringThreshold),
   _max_survivor_regions(0),
   _survivors_age_table(true),
-  _collection_pause_end_millis(os::javaTimeNanos() / NANOSECS_PER_MILLISEC) {
+  _collection_pause_end_millis(os::javaTimeNanos() / NANOSECS_PER_MILLISEC),
+  _last_pause_end_sec(os::elapsedTime()) {
 }
 
 G1Policy::~G1Policy() {
@@ -513,7 +514,7 @@ double G1Policy::non_young_other_time_ms() const {
 }
 
 double G1Policy::other_time_ms(double pause_time_ms) const {
-  return pause_time_ms - phase_times()->cur_collection_par_time_ms();
+  return pause_time_ms - phase_times()->cur_collection_par_time_ms() - phase_times()->cur_optional_evac_ms();
 }
 
 double G1Policy::constant_other_time_ms(double pause_time_ms) const {
@@ -670,7 +671,7 @@ void G1Policy::record_collection_pause_end(double pause_time_ms, size_t cards_sc
     double cost_per_byte_ms = 0.0;
 
     if (copied_bytes > 0) {
-      cost_per_byte_ms = average_time_ms(G1GCPhaseTimes::ObjCopy) / (double) copied_bytes;
+      cost_per_byte_ms = (average_time_ms(G1GCPhaseTimes::ObjCopy) + average_time_ms(G1GCPhaseTimes::OptObjCopy)) / (double) copied_bytes;
       _analytics->report_cost_per_byte_ms(cost_per_byte_ms, collector_state()->mark_or_rebuild_in_progress());
     }
 
@@ -732,7 +733,8 @@ void G1Policy::record_collection_pause_end(double pause_time_ms, size_t cards_sc
   }
   _g1h->concurrent_refine()->adjust(average_time_ms(G1GCPhaseTimes::UpdateRS),
                                     phase_times()->sum_thread_work_items(G1GCPhaseTimes::UpdateRS),
-                                    update_rs_time_goal_ms);
+                                    update_rs_time_goal_ms,
+                                    app_time_ms);
 
   cset_chooser()->verify();
 }
@@ -1051,6 +1053,7 @@ G1Policy::PauseKind G1Policy::young_gc_pause_kind() const {
 }
 
 void G1Policy::record_pause(PauseKind kind, double start, double end) {
+  _last_pause_end_sec = end;
   // Manage the MMU tracker. For some reason it ignores Full GCs.
   if (kind != FullGC) {
     _mmu_tracker->add_pause(start, end);
@@ -1077,6 +1080,10 @@ void G1Policy::record_pause(PauseKind kind, double start, double end) {
   }
 }
 
+double G1Policy::time_since_last_pause_sec() const {
+  return os::elapsedTime() - _last_pause_end_sec;
+}
+
 void G1Policy::abort_time_to_mixed_tracking() {
   _initial_mark_to_mixed.reset();
 }
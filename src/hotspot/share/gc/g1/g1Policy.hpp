@@ -74,6 +74,10 @@ class G1Policy: public CHeapObj<mtGC> {
 
   jlong _collection_pause_end_millis;
 
+  // End time (os::elapsedTime()) of the most recent pause of any kind,
+  // including Remark and Cleanup.
+  double _last_pause_end_sec;
+
   uint _young_list_target_length;
   uint _young_list_fixed_length;
 
@@ -160,6 +164,15 @@ public:
     return _mmu_tracker->max_gc_time() * 1000.0;
   }
 
+  // Once the remaining pause time falls below this fraction of the time
+  // available for old regions, further old regions are only added to the
+  // collection set as optional regions.
+  double optional_prediction_fraction() const { return 0.2; }
+
+  // Fraction of the remaining pause time that is used for evacuating
+  // optional collection set regions.
+  double optional_evacuation_fraction() const { return 0.75; }
+
   double predict_yg_surv_rate(int age, SurvRateGroup* surv_rate_group) const;
 
   double predict_yg_surv_rate(int age) const;
@@ -258,6 +271,9 @@ public:
 
   jlong collection_pause_end_millis() { return _collection_pause_end_millis; }
 
+  // Time in seconds since the end of the most recent pause of any kind.
+  double time_since_last_pause_sec() const;
+
 private:
   void clear_collection_set_candidates();
   // Sets up marking if proper conditions are met.
@@ -53,6 +53,8 @@ class G1RegionToSpaceMapper : public CHeapObj<mtGC> {
   // Mapping management
   CHeapBitMap _commit_map;
 
+  MemoryType _memory_type;
+
   G1RegionToSpaceMapper(ReservedSpace rs, size_t used_size, size_t page_size, size_t region_granularity, size_t commit_factor, MemoryType type);
 
   void fire_on_commit(uint start_idx, size_t num_regions, bool zero_filled);
@@ -73,6 +75,13 @@ class G1RegionToSpaceMapper : public CHeapObj<mtGC> {
   virtual void commit_regions(uint start_idx, size_t num_regions = 1, WorkGang* pretouch_workers = NULL) = 0;
   virtual void uncommit_regions(uint start_idx, size_t num_regions = 1) = 0;
 
+  // Notify the listener that the given regions, whose memory has stayed
+  // committed while they were not in use, are going to be used again. The
+  // memory contents must be considered stale.
+  void signal_reuse(uint start_idx, size_t num_regions) {
+    fire_on_commit(start_idx, num_regions, false /* zero_filled */);
+  }
+
   // Creates an appropriate G1RegionToSpaceMapper for the given parameters.
   // The actual space to be used within the given reservation is given by actual_size.
   // This is because some OSes need to round up the reservation size to guarantee
@@ -44,7 +44,9 @@
 #include "memory/resourceArea.hpp"
 #include "oops/access.inline.hpp"
 #include "oops/oop.inline.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/os.hpp"
+#include "runtime/timer.hpp"
 #include "utilities/align.hpp"
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/intHisto.hpp"
@@ -255,6 +257,10 @@ public:
     return _scan_top[region_idx];
   }
 
+  void clear_scan_top(uint region_idx) {
+    _scan_top[region_idx] = NULL;
+  }
+
   // Clear the card table of "dirty" regions.
   void clear_card_table(WorkGang* workers) {
     if (_cur_dirty_region == 0) {
@@ -354,6 +360,14 @@ void G1ScanRSForRegionClosure::scan_rem_set_roots(HeapRegion* r) {
   HeapRegionRemSetIterator iter(r->rem_set());
   size_t card_index;
 
+  // The remembered set iterator returns the cards of a particular source region
+  // in a row, so cache the region index and scan top of the last card's region
+  // instead of looking them up for every card. Card index 0 corresponds to the
+  // bottom of the heap, so the region index is a shift of the card index.
+  uint const log_cards_per_region = (uint)HeapRegion::LogOfHRGrainBytes - G1CardTable::card_shift;
+  uint region_idx_for_card = UINT_MAX;
+  HeapWord* top = NULL;
+
   size_t claimed_card_block = _scan_state->iter_claimed_next(region_idx, block_size);
   for (size_t current_card = 0; iter.has_next(card_index); current_card++) {
     if (current_card >= claimed_card_block + block_size) {
@@ -365,21 +379,27 @@ void G1ScanRSForRegionClosure::scan_rem_set_roots(HeapRegion* r) {
     }
     _cards_claimed++;
 
-    // If the card is dirty, then G1 will scan it during Update RS.
-    if (_ct->is_card_claimed(card_index) || _ct->is_card_dirty(card_index)) {
-      continue;
+    uint const card_region_idx = (uint)(card_index >> log_cards_per_region);
+    if (card_region_idx != region_idx_for_card) {
+      region_idx_for_card = card_region_idx;
+      top = _scan_state->scan_top(region_idx_for_card);
     }
 
     HeapWord* const card_start = _g1h->bot()->address_for_index(card_index);
-    uint const region_idx_for_card = _g1h->addr_to_region(card_start);
-
+    assert(_g1h->addr_to_region(card_start) == region_idx_for_card,
+           "Card " SIZE_FORMAT " maps to region %u but should be in region %u",
+           card_index, region_idx_for_card, _g1h->addr_to_region(card_start));
     assert(_g1h->region_at(region_idx_for_card)->is_in_reserved(card_start),
            "Card start " PTR_FORMAT " to scan outside of region %u", p2i(card_start), _g1h->region_at(region_idx_for_card)->hrm_index());
-    HeapWord* const top = _scan_state->scan_top(region_idx_for_card);
     if (card_start >= top) {
       continue;
     }
 
+    // If the card is dirty, then G1 will scan it during Update RS.
+    if (_ct->is_card_claimed(card_index) || _ct->is_card_dirty(card_index)) {
+      continue;
+    }
+
     // We claim lazily (so races are possible but they're benign), which reduces the
     // number of duplicate scans (the rsets of the regions in the cset can intersect).
     // Claim the card after checking bounds above: the remembered set may contain
@@ -422,22 +442,30 @@ bool G1ScanRSForRegionClosure::do_heap_region(HeapRegion* r) {
   return false;
 }
 
-void G1RemSet::scan_rem_set(G1ParScanThreadState* pss, uint worker_i) {
+void G1RemSet::scan_rem_set(G1ParScanThreadState* pss,
+                            uint worker_i,
+                            G1GCPhaseTimes::GCParPhases scan_phase,
+                            G1GCPhaseTimes::GCParPhases objcopy_phase,
+                            G1GCPhaseTimes::GCParPhases coderoots_phase) {
   G1ScanObjsDuringScanRSClosure scan_cl(_g1h, pss);
   G1ScanRSForRegionClosure cl(_scan_state, &scan_cl, pss, worker_i);
   _g1h->collection_set_iterate_from(&cl, worker_i);
 
   G1GCPhaseTimes* p = _g1p->phase_times();
 
-  p->record_time_secs(G1GCPhaseTimes::ScanRS, worker_i, cl.rem_set_root_scan_time().seconds());
-  p->add_time_secs(G1GCPhaseTimes::ObjCopy, worker_i, cl.rem_set_trim_partially_time().seconds());
+  p->record_or_add_time_secs(scan_phase, worker_i, cl.rem_set_root_scan_time().seconds());
+  p->record_or_add_time_secs(objcopy_phase, worker_i, cl.rem_set_trim_partially_time().seconds());
+
+  p->record_or_add_thread_work_item(scan_phase, worker_i, cl.cards_scanned(), G1GCPhaseTimes::ScanRSScannedCards);
+  p->record_or_add_thread_work_item(scan_phase, worker_i, cl.cards_claimed(), G1GCPhaseTimes::ScanRSClaimedCards);
+  p->record_or_add_thread_work_item(scan_phase, worker_i, cl.cards_skipped(), G1GCPhaseTimes::ScanRSSkippedCards);
 
-  p->record_thread_work_item(G1GCPhaseTimes::ScanRS, worker_i, cl.cards_scanned(), G1GCPhaseTimes::ScanRSScannedCards);
-  p->record_thread_work_item(G1GCPhaseTimes::ScanRS, worker_i, cl.cards_claimed(), G1GCPhaseTimes::ScanRSClaimedCards);
-  p->record_thread_work_item(G1GCPhaseTimes::ScanRS, worker_i, cl.cards_skipped(), G1GCPhaseTimes::ScanRSSkippedCards);
+  p->record_or_add_time_secs(coderoots_phase, worker_i, cl.strong_code_root_scan_time().seconds());
+  p->add_time_secs(objcopy_phase, worker_i, cl.strong_code_root_trim_partially_time().seconds());
+}
 
-  p->record_time_secs(G1GCPhaseTimes::CodeRoots, worker_i, cl.strong_code_root_scan_time().seconds());
-  p->add_time_secs(G1GCPhaseTimes::ObjCopy, worker_i, cl.strong_code_root_trim_partially_time().seconds());
+void G1RemSet::exclude_region_from_scan(uint region_idx) {
+  _scan_state->clear_scan_top(region_idx);
 }
 
 // Closure used for updating rem sets. Only called during an evacuation pause.
@@ -505,7 +533,7 @@ void G1RemSet::cleanupHRRS() {
 
 void G1RemSet::oops_into_collection_set_do(G1ParScanThreadState* pss, uint worker_i) {
   update_rem_set(pss, worker_i);
-  scan_rem_set(pss, worker_i);;
+  scan_rem_set(pss, worker_i, G1GCPhaseTimes::ScanRS, G1GCPhaseTimes::ObjCopy, G1GCPhaseTimes::CodeRoots);
 }
 
 void G1RemSet::prepare_for_oops_into_collection_set_do() {
@@ -746,6 +774,38 @@ class G1RebuildRemSetTask: public AbstractGangTask {
     G1ConcurrentMark* _cm;
     G1RebuildRemSetClosure _update_cl;
 
+    // Pacing and progress information for this worker.
+    Ticks _start_time;
+    Tickspan _busy_time;
+    Tickspan _paced_time;
+    size_t _rebuilt_bytes;
+    uint _rebuilt_regions;
+
+    // Sleep outside of the suspendible thread set until the time spent
+    // rebuilding is within G1RebuildRemSetCPUPercent of the elapsed time of
+    // this worker. Sleeps are bounded so that abort requests and yields do
+    // not get delayed too much.
+    void pace() {
+      if (G1RebuildRemSetCPUPercent >= 100) {
+        return;
+      }
+      double const elapsed_ms = (Ticks::now() - _start_time).seconds() * 1000.0;
+      double const target_ms = _busy_time.seconds() * 1000.0 * 100.0 / G1RebuildRemSetCPUPercent;
+      double const slack_ms = target_ms - elapsed_ms;
+      if (slack_ms < 1.0) {
+        return;
+      }
+      jlong const sleep_ms = MIN2((jlong)slack_ms, (jlong)MaxPacingSleepMillis);
+      Ticks const sleep_start = Ticks::now();
+      {
+        SuspendibleThreadSetLeaver sts_leave;
+        os::naked_short_sleep(sleep_ms);
+      }
+      _paced_time += Ticks::now() - sleep_start;
+    }
+
+    static const jlong MaxPacingSleepMillis = 10;
+
     // Applies _update_cl to the references of the given object, limiting objArrays
     // to the given MemRegion. Returns the amount of words actually scanned.
     size_t scan_for_references(oop const obj, MemRegion mr) {
@@ -886,7 +946,12 @@ public:
                                    uint worker_id) :
     HeapRegionClosure(),
     _cm(cm),
-    _update_cl(g1h, worker_id) { }
+    _update_cl(g1h, worker_id),
+    _start_time(Ticks::now()),
+    _busy_time(),
+    _paced_time(),
+    _rebuilt_bytes(0),
+    _rebuilt_regions(0) { }
 
     bool do_heap_region(HeapRegion* hr) {
       if (_cm->has_aborted()) {
@@ -918,6 +983,9 @@ public:
         if (next_chunk.is_empty()) {
           break;
         }
+        if (cur == hr->bottom()) {
+          _rebuilt_regions++;
+        }
 
         const Ticks start = Ticks::now();
         size_t marked_bytes = rebuild_rem_set_in_region(_cm->prev_mark_bitmap(),
@@ -926,6 +994,8 @@ public:
                                                         hr,
                                                         next_chunk);
         Tickspan time = Ticks::now() - start;
+        _busy_time += time;
+        _rebuilt_bytes += next_chunk.byte_size();
 
         log_trace(gc, remset, tracking)("Rebuilt region %u "
                                         "live " SIZE_FORMAT " "
@@ -947,6 +1017,7 @@ public:
         }
         cur += chunk_size_in_words;
 
+        pace();
         _cm->do_yield_check();
         if (_cm->has_aborted()) {
           return true;
@@ -965,12 +1036,23 @@ public:
        // Abort state may have changed after the yield check.
       return _cm->has_aborted();
     }
+
+    Tickspan busy_time() const { return _busy_time; }
+    Tickspan paced_time() const { return _paced_time; }
+    size_t rebuilt_bytes() const { return _rebuilt_bytes; }
+    uint rebuilt_regions() const { return _rebuilt_regions; }
   };
 
   HeapRegionClaimer _hr_claimer;
   G1ConcurrentMark* _cm;
 
   uint _worker_id_offset;
+
+  // Progress information summed up over all workers.
+  volatile size_t _rebuilt_bytes;
+  volatile uint _rebuilt_regions;
+  volatile jlong _busy_ticks;
+  volatile jlong _paced_ticks;
 public:
   G1RebuildRemSetTask(G1ConcurrentMark* cm,
                       uint n_workers,
@@ -978,7 +1060,11 @@ public:
       AbstractGangTask("G1 Rebuild Remembered Set"),
       _cm(cm),
       _hr_claimer(n_workers),
-      _worker_id_offset(worker_id_offset) {
+      _worker_id_offset(worker_id_offset),
+      _rebuilt_bytes(0),
+      _rebuilt_regions(0),
+      _busy_ticks(0),
+      _paced_ticks(0) {
   }
 
   void work(uint worker_id) {
@@ -988,7 +1074,20 @@ public:
 
     G1RebuildRemSetHeapRegionClosure cl(g1h, _cm, _worker_id_offset + worker_id);
     g1h->heap_region_par_iterate_from_worker_offset(&cl, &_hr_claimer, worker_id);
+
+    log_debug(gc, remset, tracking)("Rebuild worker %u regions %u scanned " SIZE_FORMAT "K busy %.3fms paced %.3fms",
+                                    worker_id, cl.rebuilt_regions(), cl.rebuilt_bytes() / K,
+                                    cl.busy_time().seconds() * 1000.0, cl.paced_time().seconds() * 1000.0);
+    Atomic::add(cl.rebuilt_bytes(), &_rebuilt_bytes);
+    Atomic::add(cl.rebuilt_regions(), &_rebuilt_regions);
+    Atomic::add(cl.busy_time().value(), &_busy_ticks);
+    Atomic::add(cl.paced_time().value(), &_paced_ticks);
   }
+
+  size_t rebuilt_bytes() const { return _rebuilt_bytes; }
+  uint rebuilt_regions() const { return _rebuilt_regions; }
+  double busy_time_ms() const { return TimeHelper::counter_to_millis(_busy_ticks); }
+  double paced_time_ms() const { return TimeHelper::counter_to_millis(_paced_ticks); }
 };
 
 void G1RemSet::rebuild_rem_set(G1ConcurrentMark* cm,
@@ -1000,4 +1099,9 @@ void G1RemSet::rebuild_rem_set(G1ConcurrentMark* cm,
                          num_workers,
                          worker_id_offset);
   workers->run_task(&cl, num_workers);
+
+  log_debug(gc, remset, tracking)("Rebuild remembered set regions %u scanned " SIZE_FORMAT "K using %u workers "
+                                  "busy %.3fms paced %.3fms (CPU percent " UINTX_FORMAT ")",
+                                  cl.rebuilt_regions(), cl.rebuilt_bytes() / K, num_workers,
+                                  cl.busy_time_ms(), cl.paced_time_ms(), G1RebuildRemSetCPUPercent);
 }
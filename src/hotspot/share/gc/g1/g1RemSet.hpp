@@ -27,6 +27,7 @@
 
 #include "gc/g1/dirtyCardQueue.hpp"
 #include "gc/g1/g1CardTable.hpp"
+#include "gc/g1/g1GCPhaseTimes.hpp"
 #include "gc/g1/g1OopClosures.hpp"
 #include "gc/g1/g1RemSetSummary.hpp"
 #include "gc/g1/heapRegion.hpp"
@@ -60,10 +61,6 @@ private:
 
   G1RemSetSummary _prev_period_summary;
 
-  // Scan all remembered sets of the collection set for references into the collection
-  // set.
-  void scan_rem_set(G1ParScanThreadState* pss, uint worker_i);
-
   // Flush remaining refinement buffers for cross-region references to either evacuate references
   // into the collection set or update the remembered set.
   void update_rem_set(G1ParScanThreadState* pss, uint worker_i);
@@ -103,6 +100,19 @@ public:
   // roots list for each region in the collection set.
   void oops_into_collection_set_do(G1ParScanThreadState* pss, uint worker_i);
 
+  // Scan all remembered sets of the collection set for references into the collection
+  // set, recording the time taken into the given phases. Regions whose remembered
+  // set has already been scanned during this pause are skipped.
+  void scan_rem_set(G1ParScanThreadState* pss,
+                    uint worker_i,
+                    G1GCPhaseTimes::GCParPhases scan_phase,
+                    G1GCPhaseTimes::GCParPhases objcopy_phase,
+                    G1GCPhaseTimes::GCParPhases coderoots_phase);
+
+  // Exclude the region from remembered set scanning for the remainder of the
+  // pause, e.g. because it has been added to the collection set late.
+  void exclude_region_from_scan(uint region_idx);
+
   // Prepare for and cleanup after an oops_into_collection_set_do
   // call.  Must call each of these once before and after (in sequential
   // code) any thread calls oops_into_collection_set_do.
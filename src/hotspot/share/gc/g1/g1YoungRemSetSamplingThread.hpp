@@ -39,12 +39,26 @@
 // reevaluates the prediction for the remembered set scanning costs, and potentially
 // G1Policy resizes the young gen. This may do a premature GC or even
 // increase the young gen size to keep pause time length goal.
+//
+// The thread also periodically checks whether the heap has been idle for
+// longer than G1PeriodicGCInterval and, if so, requests a collection so that
+// G1 gets a chance to give unused memory back to the operating system.
 class G1YoungRemSetSamplingThread: public ConcurrentGCThread {
 private:
   Monitor _monitor;
 
+  double _last_periodic_gc_attempt_s;
+
   void sample_young_list_rs_lengths();
 
+  // Returns whether a periodic GC should be started at this time.
+  bool should_start_periodic_gc();
+  void check_for_periodic_gc();
+
+  // Give the memory of regions removed from the heap back to the operating
+  // system in chunks.
+  void uncommit_pending_regions();
+
   void run_service();
   void stop_service();
 
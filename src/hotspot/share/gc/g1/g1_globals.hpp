@@ -108,6 +108,31 @@
           "When expanding, % of uncommitted space to claim.")               \
           range(0, 100)                                                     \
                                                                             \
+  experimental(bool, G1ClearBitmapByRemapping, false,                       \
+          "Clear whole pages of the mark bitmaps by handing them back to "  \
+          "the OS, which provides zero-filled pages on the next touch, "    \
+          "instead of zeroing them. Only supported on Linux without "       \
+          "large pages or NUMA.")                                           \
+                                                                            \
+  diagnostic(uintx, G1EvacPrefetchDistance, 4,                              \
+          "Number of task queue entries whose referents are prefetched "    \
+          "ahead of processing them during evacuation. 0 disables "         \
+          "prefetching.")                                                   \
+          range(0, 16)                                                      \
+                                                                            \
+  diagnostic(bool, G1EvacPrefetchStatistics, false,                         \
+          "Time every object copy during evacuation and report the "        \
+          "number of slow, likely memory stalled, copies per worker.")      \
+                                                                            \
+  experimental(bool, G1AdaptiveHeapShrink, false,                           \
+          "Shrink the heap after young collections if the recent GC "       \
+          "overhead stays well below the GCTimeRatio target.")              \
+                                                                            \
+  experimental(uintx, G1ShrinkHeapGCOverheadPercent, 25,                    \
+          "Shrink the heap only if the recent GC overhead is below this "   \
+          "percentage of the overhead allowed by GCTimeRatio.")             \
+          range(0, 100)                                                     \
+                                                                            \
   product(size_t, G1UpdateBufferSize, 256,                                  \
           "Size of an update buffer")                                       \
           range(1, NOT_LP64(32*M) LP64_ONLY(1*G))                           \
@@ -151,6 +176,11 @@
           "Select green, yellow and red zones adaptively to meet the "      \
           "the pause requirements.")                                        \
                                                                             \
+  experimental(bool, G1UseAdaptiveConcRefinementThreads, true,              \
+          "Size the number of refinement threads activated in the yellow "  \
+          "zone by the predicted rate of incoming dirty card buffers. "     \
+          "Only has an effect if G1UseAdaptiveConcRefinement is enabled.")  \
+                                                                            \
   product(size_t, G1ConcRSLogCacheSize, 10,                                 \
           "Log base 2 of the length of conc RS hot-card cache.")            \
           range(0, 27)                                                      \
@@ -257,10 +287,20 @@
           "Try to reclaim dead large objects that have a few stale "        \
           "references at every young GC.")                                  \
                                                                             \
+  experimental(bool, G1EagerReclaimHumongousObjArrays, true,                \
+          "Also try to reclaim dead large object arrays at young GC. "      \
+          "Requires G1EagerReclaimHumongousObjects.")                       \
+                                                                            \
   experimental(size_t, G1RebuildRemSetChunkSize, 256 * K,                   \
           "Chunk size used for rebuilding the remembered set.")             \
           range(4 * K, 32 * M)                                              \
                                                                             \
+  experimental(uintx, G1RebuildRemSetCPUPercent, 100,                       \
+          "Maximum percentage of elapsed time each concurrent worker "      \
+          "spends rebuilding remembered sets. Workers sleep between "       \
+          "chunks outside the suspendible thread set to stay within it.")   \
+          range(1, 100)                                                     \
+                                                                            \
   experimental(uintx, G1OldCSetRegionThresholdPercent, 10,                  \
           "An upper bound for the number of old CSet regions expressed "    \
           "as a percentage of the heap size.")                              \
@@ -294,6 +334,37 @@
           "Force use of evacuation failure handling during mixed "          \
           "evacuation pauses")                                              \
                                                                             \
+  experimental(bool, G1UncommitConcurrently, true,                          \
+          "Give the memory of regions removed from the heap during a "      \
+          "pause back to the operating system concurrently.")               \
+                                                                            \
+  experimental(size_t, G1UncommitChunkSize, 128 * M,                        \
+          "Maximum amount of memory uncommitted concurrently in one step "  \
+          "while holding the Heap_lock.")                                   \
+          range(1 * M, max_uintx)                                           \
+                                                                            \
+  manageable(uintx, G1PeriodicGCInterval, 0,                                \
+          "Number of milliseconds after a previous GC to wait before "      \
+          "triggering a periodic gc. A value of zero disables periodically "\
+          "enforced gc cycles.")                                            \
+                                                                            \
+  product(bool, G1PeriodicGCInvokesConcurrent, true,                        \
+          "Determines the kind of periodic GC. Set to true to have G1 "     \
+          "perform a concurrent GC as periodic GC, otherwise use a STW "    \
+          "Full GC.")                                                       \
+                                                                            \
+  manageable(double, G1PeriodicGCSystemLoadThreshold, 0.0,                  \
+          "Maximum recent system wide load as returned by the 1m value "    \
+          "of getloadavg() at which G1 triggers a periodic GC. A load "     \
+          "above this value cancels a given periodic GC. A value of zero "  \
+          "disables this check.")                                           \
+          range(0.0, (double)max_uintx)                                     \
+                                                                            \
+  experimental(bool, G1UseRegionPinning, false,                             \
+          "Pin the heap regions containing objects accessed in JNI "        \
+          "critical sections instead of blocking garbage collection "       \
+          "with the GCLocker until all critical sections have exited.")     \
+                                                                            \
   diagnostic(bool, G1VerifyRSetsDuringFullGC, false,                        \
           "If true, perform verification of each heap region's "            \
           "remembered set when verifying the heap during a full GC.")       \
@@ -27,6 +27,7 @@
 #include "gc/g1/g1BlockOffsetTable.inline.hpp"
 #include "gc/g1/g1CollectedHeap.inline.hpp"
 #include "gc/g1/g1HeapRegionTraceType.hpp"
+#include "gc/g1/g1NUMA.hpp"
 #include "gc/g1/g1OopClosures.inline.hpp"
 #include "gc/g1/heapRegion.inline.hpp"
 #include "gc/g1/heapRegionBounds.inline.hpp"
@@ -114,6 +115,8 @@ void HeapRegion::hr_clear(bool keep_remset, bool clear_space, bool locked) {
          "we should have already filtered out humongous regions");
   assert(!in_collection_set(),
          "Should not clear heap region %u in the collection set", hrm_index());
+  assert(!has_pinned_objects(),
+         "Should not clear heap region %u with pinned objects", hrm_index());
 
   set_young_index_in_cset(-1);
   uninstall_surv_rate_group();
@@ -233,13 +236,17 @@ HeapRegion::HeapRegion(uint hrm_index,
     _hrm_index(hrm_index),
     _humongous_start_region(NULL),
     _evacuation_failed(false),
+    _evac_failure_objs(mr.start()),
+    _pinned_object_count(0),
     _prev_marked_bytes(0), _next_marked_bytes(0), _gc_efficiency(0.0),
     _next(NULL), _prev(NULL),
 #ifdef ASSERT
     _containing_set(NULL),
 #endif // ASSERT
-     _young_index_in_cset(-1), _surv_rate_group(NULL), _age_index(-1),
-    _rem_set(NULL), _recorded_rs_length(0), _predicted_elapsed_time_ms(0)
+    _index_in_opt_cset(InvalidCSetIndex), _young_index_in_cset(-1),
+    _surv_rate_group(NULL), _age_index(-1),
+    _rem_set(NULL), _recorded_rs_length(0), _predicted_elapsed_time_ms(0),
+    _node_index(G1NUMA::UnknownNodeIndex)
 {
   _rem_set = new HeapRegionRemSet(bot, this);
 
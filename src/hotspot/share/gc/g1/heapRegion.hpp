@@ -26,6 +26,7 @@
 #define SHARE_VM_GC_G1_HEAPREGION_HPP
 
 #include "gc/g1/g1BlockOffsetTable.hpp"
+#include "gc/g1/g1EvacFailureObjectsSet.hpp"
 #include "gc/g1/g1HeapRegionTraceType.hpp"
 #include "gc/g1/heapRegionTracer.hpp"
 #include "gc/g1/heapRegionType.hpp"
@@ -235,6 +236,13 @@ class HeapRegion: public G1ContiguousSpace {
   // True iff an attempt to evacuate an object in the region failed.
   bool _evacuation_failed;
 
+  // The objects that failed evacuation, if _evacuation_failed.
+  G1EvacFailureObjectsSet _evac_failure_objs;
+
+  // Number of objects in this region currently pinned by JNI critical
+  // sections. Such regions must not be evacuated or compacted.
+  volatile size_t _pinned_object_count;
+
   // Fields used by the HeapRegionSetBase class and subclasses.
   HeapRegion* _next;
   HeapRegion* _prev;
@@ -250,6 +258,9 @@ class HeapRegion: public G1ContiguousSpace {
   // The calculated GC efficiency of the region.
   double _gc_efficiency;
 
+  // The index in the optional regions array, if this region
+  // is considered optional during a mixed collection.
+  uint _index_in_opt_cset;
   int  _young_index_in_cset;
   SurvRateGroup* _surv_rate_group;
   int  _age_index;
@@ -284,6 +295,10 @@ class HeapRegion: public G1ContiguousSpace {
   // for the collection set.
   double _predicted_elapsed_time_ms;
 
+  // The index of the NUMA node the memory of this region has been
+  // requested on, see G1NUMA.
+  uint _node_index;
+
   // Iterate over the references in a humongous objects and apply the given closure
   // to them.
   // Humongous objects are allocated directly in the old-gen. So we need special
@@ -542,8 +557,8 @@ class HeapRegion: public G1ContiguousSpace {
   void note_self_forwarding_removal_end(size_t marked_bytes);
 
   void reset_during_compaction() {
-    assert(is_humongous(),
-           "should only be called for humongous regions");
+    assert(is_humongous() || has_pinned_objects(),
+           "should only be called for humongous regions or regions with pinned objects");
 
     zero_marked_bytes();
     init_top_at_mark_start();
@@ -552,6 +567,15 @@ class HeapRegion: public G1ContiguousSpace {
   void calc_gc_efficiency(void);
   double gc_efficiency() { return _gc_efficiency;}
 
+  static const uint InvalidCSetIndex = UINT_MAX;
+
+  uint index_in_opt_cset() const { return _index_in_opt_cset; }
+  void set_index_in_opt_cset(uint index) { _index_in_opt_cset = index; }
+  void clear_index_in_opt_cset() { _index_in_opt_cset = InvalidCSetIndex; }
+
+  uint node_index() const { return _node_index; }
+  void set_node_index(uint node_index) { _node_index = node_index; }
+
   int  young_index_in_cset() const { return _young_index_in_cset; }
   void set_young_index_in_cset(int index) {
     assert( (index == -1) || is_young(), "pre-condition" );
@@ -637,6 +661,20 @@ class HeapRegion: public G1ContiguousSpace {
     }
   }
 
+  // Records an object of this region that failed evacuation.
+  void record_evac_failure_obj(oop obj) {
+    _evac_failure_objs.record(obj);
+  }
+
+  G1EvacFailureObjectsSet* evac_failure_objs() { return &_evac_failure_objs; }
+
+  // Pinned object support. Only the region containing the start of the
+  // object keeps track of the pin count.
+  bool has_pinned_objects() const { return _pinned_object_count > 0; }
+  size_t pinned_object_count() const { return _pinned_object_count; }
+  inline void increment_pinned_object_count();
+  inline void decrement_pinned_object_count();
+
   // Iterate over the objects overlapping part of a card, applying cl
   // to all references in the region.  This is a helper for
   // G1RemSet::refine_card*, and is tightly coupled with them.
@@ -405,4 +405,13 @@ bool HeapRegion::oops_on_card_seq_iterate_careful(MemRegion mr,
   return true;
 }
 
+inline void HeapRegion::increment_pinned_object_count() {
+  Atomic::inc(&_pinned_object_count);
+}
+
+inline void HeapRegion::decrement_pinned_object_count() {
+  assert(has_pinned_objects(), "Region %u has no pinned objects", hrm_index());
+  Atomic::dec(&_pinned_object_count);
+}
+
 #endif // SHARE_VM_GC_G1_HEAPREGION_INLINE_HPP
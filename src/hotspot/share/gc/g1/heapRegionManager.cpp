@@ -25,10 +25,12 @@
 #include "precompiled.hpp"
 #include "gc/g1/g1CollectedHeap.inline.hpp"
 #include "gc/g1/g1ConcurrentRefine.hpp"
+#include "gc/g1/g1NUMA.hpp"
 #include "gc/g1/heapRegion.hpp"
 #include "gc/g1/heapRegionManager.inline.hpp"
 #include "gc/g1/heapRegionSet.inline.hpp"
 #include "memory/allocation.hpp"
+#include "runtime/mutexLocker.hpp"
 #include "utilities/bitMap.inline.hpp"
 
 void HeapRegionManager::initialize(G1RegionToSpaceMapper* heap_storage,
@@ -53,6 +55,7 @@ void HeapRegionManager::initialize(G1RegionToSpaceMapper* heap_storage,
   _regions.initialize(reserved.start(), reserved.end(), HeapRegion::GrainBytes);
 
   _available_map.initialize(_regions.length());
+  _uncommit_pending_map.initialize(_regions.length());
 }
 
 bool HeapRegionManager::is_available(uint region) const {
@@ -79,9 +82,25 @@ void HeapRegionManager::commit_regions(uint index, size_t num_regions, WorkGang*
 
   _num_committed += (uint)num_regions;
 
-  _heap_mapper->commit_regions(index, num_regions, pretouch_gang);
+  // Split the range into runs of regions pending uncommit, whose heap memory
+  // is still committed, and regions that need to be committed completely.
+  uint end = index + (uint)num_regions;
+  uint cur = index;
+  while (cur < end) {
+    uint run_end;
+    if (_uncommit_pending_map.at(cur)) {
+      run_end = (uint)_uncommit_pending_map.get_next_zero_offset(cur, end);
+      reactivate_regions(cur, run_end - cur, pretouch_gang);
+    } else {
+      run_end = (uint)_uncommit_pending_map.get_next_one_offset(cur, end);
+      _heap_mapper->commit_regions(cur, run_end - cur, pretouch_gang);
+      commit_auxiliary_memory(cur, run_end - cur, pretouch_gang);
+    }
+    cur = run_end;
+  }
+}
 
-  // Also commit auxiliary data
+void HeapRegionManager::commit_auxiliary_memory(uint index, size_t num_regions, WorkGang* pretouch_gang) {
   _prev_bitmap_mapper->commit_regions(index, num_regions, pretouch_gang);
   _next_bitmap_mapper->commit_regions(index, num_regions, pretouch_gang);
 
@@ -91,6 +110,16 @@ void HeapRegionManager::commit_regions(uint index, size_t num_regions, WorkGang*
   _card_counts_mapper->commit_regions(index, num_regions, pretouch_gang);
 }
 
+void HeapRegionManager::uncommit_auxiliary_memory(uint start, size_t num_regions) {
+  _prev_bitmap_mapper->uncommit_regions(start, num_regions);
+  _next_bitmap_mapper->uncommit_regions(start, num_regions);
+
+  _bot_mapper->uncommit_regions(start, num_regions);
+  _cardtable_mapper->uncommit_regions(start, num_regions);
+
+  _card_counts_mapper->uncommit_regions(start, num_regions);
+}
+
 void HeapRegionManager::uncommit_regions(uint start, size_t num_regions) {
   guarantee(num_regions >= 1, "Need to specify at least one region to uncommit, tried to uncommit zero regions at %u", start);
   guarantee(_num_committed >= num_regions, "pre-condition");
@@ -109,13 +138,67 @@ void HeapRegionManager::uncommit_regions(uint start, size_t num_regions) {
   _heap_mapper->uncommit_regions(start, num_regions);
 
   // Also uncommit auxiliary data
-  _prev_bitmap_mapper->uncommit_regions(start, num_regions);
-  _next_bitmap_mapper->uncommit_regions(start, num_regions);
+  uncommit_auxiliary_memory(start, num_regions);
+}
 
-  _bot_mapper->uncommit_regions(start, num_regions);
-  _cardtable_mapper->uncommit_regions(start, num_regions);
+void HeapRegionManager::deactivate_regions(uint start, size_t num_regions) {
+  guarantee(num_regions >= 1, "Need to specify at least one region to deactivate, tried to deactivate zero regions at %u", start);
+  guarantee(_num_committed >= num_regions, "pre-condition");
 
-  _card_counts_mapper->uncommit_regions(start, num_regions);
+  // Print before deactivating, the regions are considered uncommitted from now on.
+  if (G1CollectedHeap::heap()->hr_printer()->is_active()) {
+    for (uint i = start; i < start + num_regions; i++) {
+      HeapRegion* hr = at(i);
+      G1CollectedHeap::heap()->hr_printer()->uncommit(hr);
+    }
+  }
+
+  _num_committed -= (uint)num_regions;
+  _num_uncommit_pending += (uint)num_regions;
+
+  _available_map.par_clear_range(start, start + num_regions, BitMap::unknown_range);
+  _uncommit_pending_map.set_range(start, start + num_regions);
+
+  // Auxiliary data may still be accessed concurrently, e.g. by refinement
+  // threads processing stale cards, so it is uncommitted right away. It is
+  // also small compared to the heap memory.
+  uncommit_auxiliary_memory(start, num_regions);
+}
+
+void HeapRegionManager::reactivate_regions(uint start, size_t num_regions, WorkGang* pretouch_gang) {
+  assert(_num_uncommit_pending >= num_regions, "pre-condition");
+  _num_uncommit_pending -= (uint)num_regions;
+  _uncommit_pending_map.clear_range(start, start + num_regions);
+
+  // The heap memory has never been uncommitted, but anything derived from it
+  // is stale.
+  _heap_mapper->signal_reuse(start, num_regions);
+  commit_auxiliary_memory(start, num_regions, pretouch_gang);
+}
+
+uint HeapRegionManager::uncommit_pending_regions(uint limit) {
+  assert_locked_or_safepoint(Heap_lock);
+
+  uint uncommitted = 0;
+  while (uncommitted < limit && _num_uncommit_pending > 0) {
+    // Find the highest run of regions pending uncommit.
+    uint end = (uint)_uncommit_pending_map.size();
+    while (!_uncommit_pending_map.at(end - 1)) {
+      end--;
+    }
+    uint start = end - 1;
+    while (start > 0 && _uncommit_pending_map.at(start - 1)) {
+      start--;
+    }
+    uint num = MIN2(end - start, limit - uncommitted);
+    start = end - num;
+
+    _uncommit_pending_map.clear_range(start, end);
+    _num_uncommit_pending -= num;
+    _heap_mapper->uncommit_regions(start, num);
+    uncommitted += num;
+  }
+  return uncommitted;
 }
 
 void HeapRegionManager::make_regions_available(uint start, uint num_regions, WorkGang* pretouch_gang) {
@@ -142,6 +225,7 @@ void HeapRegionManager::make_regions_available(uint start, uint num_regions, Wor
     MemRegion mr(bottom, bottom + HeapRegion::GrainWords);
 
     hr->initialize(mr);
+    hr->set_node_index(G1NUMA::numa()->preferred_node_index_for_index(i));
     insert_into_free_list(at(i));
   }
 }
@@ -286,7 +370,7 @@ uint HeapRegionManager::find_highest_free(bool* expanded) {
   uint curr = max_length() - 1;
   while (true) {
     HeapRegion *hr = _regions.get_by_index(curr);
-    if (hr == NULL) {
+    if (hr == NULL || !is_available(curr)) {
       uint res = expand_at(curr, 1, NULL);
       if (res == 1) {
         *expanded = true;
@@ -380,7 +464,17 @@ uint HeapRegionManager::shrink_by(uint num_regions_to_remove) {
       (num_last_found = find_empty_from_idx_reverse(cur, &idx_last_found)) > 0) {
     uint to_remove = MIN2(num_regions_to_remove - removed, num_last_found);
 
-    shrink_at(idx_last_found + num_last_found - to_remove, to_remove);
+    uint start = idx_last_found + num_last_found - to_remove;
+    if (G1UncommitConcurrently) {
+#ifdef ASSERT
+      for (uint i = start; i < (start + to_remove); i++) {
+        assert(at(i)->is_free(), "Expected free region at index %u", i);
+      }
+#endif
+      deactivate_regions(start, to_remove);
+    } else {
+      shrink_at(start, to_remove);
+    }
 
     cur = idx_last_found;
     removed += to_remove;
@@ -441,12 +535,17 @@ void HeapRegionManager::verify() {
 
   bool prev_committed = true;
   uint num_committed = 0;
+  uint num_uncommit_pending = 0;
   HeapWord* prev_end = heap_bottom();
   for (uint i = 0; i < _allocated_heapregions_length; i++) {
     if (!is_available(i)) {
+      if (_uncommit_pending_map.at(i)) {
+        num_uncommit_pending++;
+      }
       prev_committed = false;
       continue;
     }
+    guarantee(!_uncommit_pending_map.at(i), "invariant: available region %u pending uncommit", i);
     num_committed++;
     HeapRegion* hr = _regions.get_by_index(i);
     guarantee(hr != NULL, "invariant: i: %u", i);
@@ -469,6 +568,8 @@ void HeapRegionManager::verify() {
   }
 
   guarantee(num_committed == _num_committed, "Found %u committed regions, but should be %u", num_committed, _num_committed);
+  guarantee(num_uncommit_pending == _num_uncommit_pending, "Found %u regions pending uncommit, but should be %u",
+            num_uncommit_pending, _num_uncommit_pending);
   _free_list.verify();
 }
 
@@ -26,6 +26,7 @@
 #define SHARE_VM_GC_G1_HEAPREGIONMANAGER_HPP
 
 #include "gc/g1/g1BiasedArray.hpp"
+#include "gc/g1/g1NUMA.hpp"
 #include "gc/g1/g1RegionToSpaceMapper.hpp"
 #include "gc/g1/heapRegionSet.hpp"
 #include "services/memoryUsage.hpp"
@@ -86,6 +87,15 @@ class HeapRegionManager: public CHeapObj<mtGC> {
   // for allocation.
   CHeapBitMap _available_map;
 
+  // Each bit in this bitmap indicates that the corresponding region has been
+  // removed from the heap, but its memory has not been given back to the
+  // operating system yet. These regions are not available for allocation and
+  // are not counted as committed.
+  CHeapBitMap _uncommit_pending_map;
+
+  // The number of regions with a set bit in _uncommit_pending_map.
+  uint _num_uncommit_pending;
+
    // The number of regions committed in the heap.
   uint _num_committed;
 
@@ -97,10 +107,20 @@ class HeapRegionManager: public CHeapObj<mtGC> {
 
   void make_regions_available(uint index, uint num_regions = 1, WorkGang* pretouch_gang = NULL);
 
-  // Pass down commit calls to the VirtualSpace.
+  // Pass down commit calls to the VirtualSpace. Regions pending uncommit are
+  // reused without committing their memory again.
   void commit_regions(uint index, size_t num_regions = 1, WorkGang* pretouch_gang = NULL);
   void uncommit_regions(uint index, size_t num_regions = 1);
 
+  // Remove the given regions from the heap, deferring the uncommit of their
+  // heap memory to uncommit_pending_regions().
+  void deactivate_regions(uint index, size_t num_regions);
+  // Make regions pending uncommit usable again.
+  void reactivate_regions(uint index, size_t num_regions, WorkGang* pretouch_gang);
+
+  void commit_auxiliary_memory(uint index, size_t num_regions, WorkGang* pretouch_gang);
+  void uncommit_auxiliary_memory(uint index, size_t num_regions);
+
   // Notify other data structures about change in the heap layout.
   void update_committed_space(HeapWord* old_end, HeapWord* new_end);
 
@@ -131,6 +151,7 @@ public:
   HeapRegionManager() : _regions(), _heap_mapper(NULL), _num_committed(0),
                     _next_bitmap_mapper(NULL), _prev_bitmap_mapper(NULL), _bot_mapper(NULL),
                     _allocated_heapregions_length(0), _available_map(mtGC),
+                    _uncommit_pending_map(mtGC), _num_uncommit_pending(0),
                     _free_list("Free list", new MasterFreeRegionListMtSafeChecker())
   { }
 
@@ -167,8 +188,16 @@ public:
     _free_list.add_ordered(list);
   }
 
-  HeapRegion* allocate_free_region(bool is_old) {
-    HeapRegion* hr = _free_list.remove_region(is_old);
+  // Allocate a free region, preferring one whose memory is located on the
+  // given NUMA node. Falls back to any free region if there is none.
+  HeapRegion* allocate_free_region(bool is_old, uint requested_node_index = G1NUMA::AnyNodeIndex) {
+    HeapRegion* hr = NULL;
+    if (requested_node_index != G1NUMA::AnyNodeIndex && G1NUMA::numa()->is_enabled()) {
+      hr = _free_list.remove_region_with_node_index(is_old, requested_node_index);
+    }
+    if (hr == NULL) {
+      hr = _free_list.remove_region(is_old);
+    }
 
     if (hr != NULL) {
       assert(hr->next() == NULL, "Single region should not have next");
@@ -243,9 +272,19 @@ public:
   void par_iterate(HeapRegionClosure* blk, HeapRegionClaimer* hrclaimer, const uint start_index) const;
 
   // Uncommit up to num_regions_to_remove regions that are completely free.
-  // Return the actual number of uncommitted regions.
+  // Return the actual number of uncommitted regions. With G1UncommitConcurrently
+  // the regions are only removed from the heap; their memory is given back to
+  // the operating system later by uncommit_pending_regions().
   uint shrink_by(uint num_regions_to_remove);
 
+  // Return the number of regions whose memory is still to be uncommitted.
+  uint num_uncommit_pending() const { return _num_uncommit_pending; }
+
+  // Uncommit the memory of at most limit regions pending uncommit, starting
+  // from the top of the heap. Must be called with the Heap_lock held.
+  // Returns the number of regions actually uncommitted.
+  uint uncommit_pending_regions(uint limit);
+
   // Uncommit a number of regions starting at the specified index, which must be available,
   // empty, and free.
   void shrink_at(uint index, size_t num_regions);
@@ -42,13 +42,24 @@
 const char* HeapRegionRemSet::_state_strings[] =  {"Untracked", "Updating", "Complete"};
 const char* HeapRegionRemSet::_short_state_strings[] =  {"UNTRA", "UPDAT", "CMPLT"};
 
+// The set of cards of a single region that contain references into the
+// owning region. Cards are recorded in bitmap chunks of CardsPerChunk cards
+// each, which are only allocated once a card in that part of the region is
+// added. References from a region are often clustered, so this needs far
+// less memory than a bitmap covering the whole region.
 class PerRegionTable: public CHeapObj<mtGC> {
   friend class OtherRegionsTable;
   friend class HeapRegionRemSetIterator;
 
+  static const size_t CardsPerChunk = 512;
+  static const size_t WordsPerChunk = CardsPerChunk / BitsPerWord;
+
+  typedef BitMap::bm_word_t* ChunkPtr;
+
   HeapRegion*     _hr;
-  CHeapBitMap     _bm;
+  ChunkPtr volatile* _chunks;
   jint            _occupied;
+  jint            _num_allocated_chunks;
 
   // next pointer for free/allocated 'all' list
   PerRegionTable* _next;
@@ -62,25 +73,71 @@ class PerRegionTable: public CHeapObj<mtGC> {
   // Global free list of PRTs
   static PerRegionTable* volatile _free_list;
 
-protected:
-  // We need access in order to union things into the base table.
-  BitMap* bm() { return &_bm; }
+  static size_t num_chunks() {
+    return HeapRegion::CardsPerRegion / CardsPerChunk;
+  }
+
+  static size_t chunk_byte_size() {
+    return WordsPerChunk * sizeof(BitMap::bm_word_t);
+  }
+
+  ChunkPtr chunk_at(size_t chunk_idx) const {
+    return OrderAccess::load_acquire(&_chunks[chunk_idx]);
+  }
+
+  // Returns the chunk with the given index, allocating it if necessary.
+  ChunkPtr get_or_allocate_chunk(size_t chunk_idx) {
+    ChunkPtr chunk = chunk_at(chunk_idx);
+    if (chunk != NULL) {
+      return chunk;
+    }
+    chunk = NEW_C_HEAP_ARRAY(BitMap::bm_word_t, WordsPerChunk, mtGC);
+    memset(chunk, 0, chunk_byte_size());
+    ChunkPtr res = Atomic::cmpxchg(chunk, &_chunks[chunk_idx], (ChunkPtr)NULL);
+    if (res != NULL) {
+      // Somebody else installed the chunk in the meantime.
+      FREE_C_HEAP_ARRAY(BitMap::bm_word_t, chunk);
+      return res;
+    }
+    Atomic::inc(&_num_allocated_chunks);
+    return chunk;
+  }
+
+  // Frees all chunks. Only safe if there are no concurrent users of this table.
+  void release_chunks() {
+    for (size_t i = 0; i < num_chunks(); i++) {
+      if (_chunks[i] != NULL) {
+        FREE_C_HEAP_ARRAY(BitMap::bm_word_t, _chunks[i]);
+        _chunks[i] = NULL;
+      }
+    }
+    _num_allocated_chunks = 0;
+  }
 
+protected:
   PerRegionTable(HeapRegion* hr) :
     _hr(hr),
+    _chunks(NULL),
     _occupied(0),
-    _bm(HeapRegion::CardsPerRegion, mtGC),
+    _num_allocated_chunks(0),
     _collision_list_next(NULL), _next(NULL), _prev(NULL)
-  {}
+  {
+    _chunks = NEW_C_HEAP_ARRAY(ChunkPtr, num_chunks(), mtGC);
+    for (size_t i = 0; i < num_chunks(); i++) {
+      _chunks[i] = NULL;
+    }
+  }
 
   void add_card_work(CardIdx_t from_card, bool par) {
-    if (!_bm.at(from_card)) {
+    BitMapView chunk(get_or_allocate_chunk(from_card / CardsPerChunk), CardsPerChunk);
+    BitMap::idx_t const bit = from_card % CardsPerChunk;
+    if (!chunk.at(bit)) {
       if (par) {
-        if (_bm.par_at_put(from_card, 1)) {
+        if (chunk.par_at_put(bit, 1)) {
           Atomic::inc(&_occupied);
         }
       } else {
-        _bm.at_put(from_card, 1);
+        chunk.at_put(bit, 1);
         _occupied++;
       }
     }
@@ -105,8 +162,6 @@ public:
   HeapRegion* hr() const { return OrderAccess::load_acquire(&_hr); }
 
   jint occupied() const {
-    // Overkill, but if we ever need it...
-    // guarantee(_occupied == _bm.count_one_bits(), "Check");
     return _occupied;
   }
 
@@ -117,7 +172,15 @@ public:
     }
     _collision_list_next = NULL;
     _occupied = 0;
-    _bm.clear();
+    // This table may be reused while other threads still add cards to it, so
+    // existing chunks can not be freed here, only cleared. They are freed
+    // when the table is returned to the free list at a safepoint.
+    for (size_t i = 0; i < num_chunks(); i++) {
+      ChunkPtr chunk = _chunks[i];
+      if (chunk != NULL) {
+        memset(chunk, 0, chunk_byte_size());
+      }
+    }
     // Make sure that the bitmap clearing above has been finished before publishing
     // this PRT to concurrent threads.
     OrderAccess::release_store(&_hr, hr);
@@ -139,15 +202,34 @@ public:
     add_card_work(from_card_index, /*parallel*/ false);
   }
 
-  // (Destructively) union the bitmap of the current table into the given
-  // bitmap (which is assumed to be of the same size.)
-  void union_bitmap_into(BitMap* bm) {
-    bm->set_union(_bm);
+  bool contains_card(size_t card_index) const {
+    ChunkPtr chunk = chunk_at(card_index / CardsPerChunk);
+    return chunk != NULL && BitMapView(chunk, CardsPerChunk).at(card_index % CardsPerChunk);
+  }
+
+  // Returns the index of the first card at or after the given index that is
+  // contained in this table, or HeapRegion::CardsPerRegion if there is none.
+  size_t next_card(size_t from_card_index) const {
+    for (size_t chunk_idx = from_card_index / CardsPerChunk; chunk_idx < num_chunks(); chunk_idx++) {
+      ChunkPtr chunk = chunk_at(chunk_idx);
+      if (chunk == NULL) {
+        continue;
+      }
+      size_t const chunk_start = chunk_idx * CardsPerChunk;
+      size_t const start = from_card_index > chunk_start ? from_card_index - chunk_start : 0;
+      size_t const res = BitMapView(chunk, CardsPerChunk).get_next_one_offset(start);
+      if (res < CardsPerChunk) {
+        return chunk_start + res;
+      }
+    }
+    return HeapRegion::CardsPerRegion;
   }
 
   // Mem size in bytes.
   size_t mem_size() const {
-    return sizeof(PerRegionTable) + _bm.size_in_words() * HeapWordSize;
+    return sizeof(PerRegionTable) +
+           num_chunks() * sizeof(ChunkPtr) +
+           (size_t)_num_allocated_chunks * chunk_byte_size();
   }
 
   // Requires "from" to be in "hr()".
@@ -155,12 +237,17 @@ public:
     assert(hr()->is_in_reserved(from), "Precondition.");
     size_t card_ind = pointer_delta(from, hr()->bottom(),
                                     G1CardTable::card_size);
-    return _bm.at(card_ind);
+    return contains_card(card_ind);
   }
 
   // Bulk-free the PRTs from prt to last, assumes that they are
   // linked together using their _next field.
   static void bulk_free(PerRegionTable* prt, PerRegionTable* last) {
+    // Tables on the free list do not keep any chunks.
+    for (PerRegionTable* cur = prt; cur != last; cur = cur->next()) {
+      cur->release_chunks();
+    }
+    last->release_chunks();
     while (true) {
       PerRegionTable* fl = _free_list;
       last->set_next(fl);
@@ -544,11 +631,9 @@ size_t OtherRegionsTable::occ_sparse() const {
 
 size_t OtherRegionsTable::mem_size() const {
   size_t sum = 0;
-  // all PRTs are of the same size so it is sufficient to query only one of them.
-  if (_first_all_fine_prts != NULL) {
-    assert(_last_all_fine_prts != NULL &&
-      _first_all_fine_prts->mem_size() == _last_all_fine_prts->mem_size(), "check that mem_size() is constant");
-    sum += _first_all_fine_prts->mem_size() * _n_fine_entries;
+  // PRTs differ in size depending on the number of chunks they use.
+  for (PerRegionTable* cur = _first_all_fine_prts; cur != NULL; cur = cur->next()) {
+    sum += cur->mem_size();
   }
   sum += (sizeof(PerRegionTable*) * _max_fine_entries);
   sum += (_coarse_map.size_in_words() * HeapWordSize);
@@ -758,7 +843,7 @@ bool HeapRegionRemSetIterator::coarse_has_next(size_t& card_index) {
 bool HeapRegionRemSetIterator::fine_has_next(size_t& card_index) {
   if (fine_has_next()) {
     _cur_card_in_prt =
-      _fine_cur_prt->_bm.get_next_one_offset(_cur_card_in_prt + 1);
+      _fine_cur_prt->next_card(_cur_card_in_prt + 1);
   }
   if (_cur_card_in_prt == HeapRegion::CardsPerRegion) {
     // _fine_cur_prt may still be NULL in case if there are not PRTs at all for
@@ -768,7 +853,7 @@ bool HeapRegionRemSetIterator::fine_has_next(size_t& card_index) {
     }
     PerRegionTable* next_prt = _fine_cur_prt->next();
     switch_to_prt(next_prt);
-    _cur_card_in_prt = _fine_cur_prt->_bm.get_next_one_offset(_cur_card_in_prt + 1);
+    _cur_card_in_prt = _fine_cur_prt->next_card(_cur_card_in_prt + 1);
   }
 
   card_index = _cur_region_card_offset + _cur_card_in_prt;
@@ -55,7 +55,12 @@ class HRRSCleanupTask : public SparsePRTCleanupTask {
 // (PRTs), indicating regions for which we're keeping the RS as a set of
 // cards.  The strategy is to cap the size of the fine-grain table,
 // deleting an entry and setting the corresponding coarse-grained bit when
-// we would overflow this cap.
+// we would overflow this cap.  A PRT stores its cards in small bitmap
+// chunks that are allocated on demand, so its size grows with the number
+// of distinct parts of the source region that contain references.
+//
+// A region's remembered set entry is thus promoted from a sparse table
+// entry, to a chunked PRT, to a coarse bit as the number of cards grows.
 
 // We use a mixture of locking and lock-free techniques here.  We allow
 // threads to locate PRTs without locking, but threads attempting to alter
@@ -196,6 +196,13 @@ public:
   // Removes from head or tail based on the given argument.
   HeapRegion* remove_region(bool from_head);
 
+  // Removes the first region whose node index matches requested_node_index,
+  // searching from head or tail based on the given argument. Only the first
+  // G1NUMA::max_search_depth() regions are inspected. Returns NULL if no
+  // such region has been found.
+  HeapRegion* remove_region_with_node_index(bool from_head,
+                                            uint requested_node_index);
+
   // Merge two ordered lists. The result is also ordered. The order is
   // determined by hrm_index.
   void add_ordered(FreeRegionList* from_list);
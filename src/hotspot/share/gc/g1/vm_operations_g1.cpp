@@ -119,9 +119,13 @@ void VM_G1CollectForAllocation::doit() {
     // will cause the requesting thread to spin inside collect() until the
     // just started marking cycle is complete - which may be a while. So
     // we do NOT retry the GC.
+    //
+    // The same holds for periodic collections: the marking cycle already
+    // in progress will give memory back to the OS at Remark anyway.
     if (!res) {
       assert(_word_size == 0, "Concurrent Full GC/Humongous Object IM shouldn't be allocating");
-      if (_gc_cause != GCCause::_g1_humongous_allocation) {
+      if (_gc_cause != GCCause::_g1_humongous_allocation &&
+          _gc_cause != GCCause::_g1_periodic_collection) {
         _should_retry_gc = true;
       }
       return;
@@ -464,17 +464,25 @@ void ASPSYoungGen::resize_spaces(size_t requested_eden_size,
     from_space()->check_mangled_unused_area(limit);
       to_space()->check_mangled_unused_area(limit);
   }
+  WorkGang& pretouch_workers = ParallelScavengeHeap::heap()->workers();
+
   // When an existing space is being initialized, it is not
   // mangled because the space has been previously mangled.
   eden_space()->initialize(edenMR,
                            SpaceDecorator::Clear,
-                           SpaceDecorator::DontMangle);
+                           SpaceDecorator::DontMangle,
+                           MutableSpace::SetupPages,
+                           &pretouch_workers);
     to_space()->initialize(toMR,
                            SpaceDecorator::Clear,
-                           SpaceDecorator::DontMangle);
+                           SpaceDecorator::DontMangle,
+                           MutableSpace::SetupPages,
+                           &pretouch_workers);
   from_space()->initialize(fromMR,
                            SpaceDecorator::DontClear,
-                           SpaceDecorator::DontMangle);
+                           SpaceDecorator::DontMangle,
+                           MutableSpace::SetupPages,
+                           &pretouch_workers);
 
   PSScavenge::set_young_generation_boundary(eden_space()->bottom());
 
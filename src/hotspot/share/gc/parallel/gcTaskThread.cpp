@@ -26,6 +26,7 @@
 #include "gc/parallel/gcTaskManager.hpp"
 #include "gc/parallel/gcTaskThread.hpp"
 #include "gc/shared/gcId.hpp"
+#include "gc/shared/gcWorkerAffinity.hpp"
 #include "logging/log.hpp"
 #include "memory/allocation.hpp"
 #include "memory/allocation.inline.hpp"
@@ -115,6 +116,7 @@ void GCTaskThread::print_task_time_stamps() {
 
 void GCTaskThread::run() {
   this->initialize_named_thread();
+  GCWorkerAffinity::bind_current_thread(which());
   // Bind yourself to your processor.
   if (processor_id() != GCTaskManager::sentinel_worker()) {
     log_trace(gc, task, thread)("GCTaskThread::run: binding to processor %u", processor_id());
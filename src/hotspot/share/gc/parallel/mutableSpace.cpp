@@ -24,6 +24,7 @@
 
 #include "precompiled.hpp"
 #include "gc/parallel/mutableSpace.hpp"
+#include "gc/shared/pretouchTask.hpp"
 #include "gc/shared/spaceDecorator.hpp"
 #include "memory/iterator.inline.hpp"
 #include "oops/oop.inline.hpp"
@@ -59,14 +60,16 @@ void MutableSpace::numa_setup_pages(MemRegion mr, bool clear_space) {
   }
 }
 
-void MutableSpace::pretouch_pages(MemRegion mr) {
-  os::pretouch_memory(mr.start(), mr.end());
+void MutableSpace::pretouch_pages(MemRegion mr, WorkGang* pretouch_gang) {
+  PretouchTask::pretouch("ParallelGC PreTouch", (char*)mr.start(), (char*)mr.end(),
+                         os::vm_page_size(), pretouch_gang);
 }
 
 void MutableSpace::initialize(MemRegion mr,
                               bool clear_space,
                               bool mangle_space,
-                              bool setup_pages) {
+                              bool setup_pages,
+                              WorkGang* pretouch_gang) {
 
   assert(Universe::on_page_boundary(mr.start()) && Universe::on_page_boundary(mr.end()),
          "invalid space boundaries");
@@ -113,8 +116,8 @@ void MutableSpace::initialize(MemRegion mr,
     }
 
     if (AlwaysPreTouch) {
-      pretouch_pages(head);
-      pretouch_pages(tail);
+      pretouch_pages(head, pretouch_gang);
+      pretouch_pages(tail, pretouch_gang);
     }
 
     // Remember where we stopped so that we can continue later.
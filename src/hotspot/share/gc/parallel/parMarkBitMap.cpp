@@ -26,6 +26,7 @@
 #include "gc/parallel/parMarkBitMap.inline.hpp"
 #include "gc/parallel/psCompactionManager.inline.hpp"
 #include "gc/parallel/psParallelCompact.inline.hpp"
+#include "gc/shared/pretouchTask.hpp"
 #include "oops/oop.inline.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/os.hpp"
@@ -76,6 +77,14 @@ ParMarkBitMap::initialize(MemRegion covered_region)
   return false;
 }
 
+void ParMarkBitMap::pretouch(WorkGang* pretouch_gang) {
+  PretouchTask::pretouch("ParallelGC PreTouch Mark Bitmap",
+                         _virtual_space->committed_low_addr(),
+                         _virtual_space->committed_high_addr(),
+                         os::vm_page_size(),
+                         pretouch_gang);
+}
+
 #ifdef ASSERT
 extern size_t mark_bitmap_count;
 extern size_t mark_bitmap_size;
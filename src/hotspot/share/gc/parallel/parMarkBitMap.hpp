@@ -32,6 +32,7 @@
 class ParMarkBitMapClosure;
 class PSVirtualSpace;
 class ParCompactionManager;
+class WorkGang;
 
 class ParMarkBitMap: public CHeapObj<mtGC>
 {
@@ -43,6 +44,8 @@ public:
 
   inline ParMarkBitMap();
   bool initialize(MemRegion covered_region);
+  // Pre-touch the committed storage of the bitmap, for AlwaysPreTouch.
+  void pretouch(WorkGang* pretouch_gang);
 
   // Atomically mark an object as live.
   bool mark_obj(HeapWord* addr, size_t size);
@@ -37,6 +37,7 @@
 #include "gc/shared/gcWhen.hpp"
 #include "gc/shared/softRefPolicy.hpp"
 #include "gc/shared/strongRootsScope.hpp"
+#include "gc/shared/workgroup.hpp"
 #include "memory/metaspace.hpp"
 #include "utilities/growableArray.hpp"
 #include "utilities/ostream.hpp"
@@ -44,6 +45,7 @@
 class AdjoiningGenerations;
 class GCHeapSummary;
 class GCTaskManager;
+class HeapBlockClaimer;
 class MemoryManager;
 class MemoryPool;
 class PSAdaptiveSizePolicy;
@@ -72,6 +74,10 @@ class ParallelScavengeHeap : public CollectedHeap {
   // The task manager
   static GCTaskManager* _gc_task_manager;
 
+  // Work gang used by phases that have been moved from the task manager
+  // to AbstractGangTasks.
+  WorkGang _workers;
+
   GCMemoryManager* _young_manager;
   GCMemoryManager* _old_manager;
 
@@ -93,7 +99,13 @@ class ParallelScavengeHeap : public CollectedHeap {
 
  public:
   ParallelScavengeHeap(GenerationSizer* policy) :
-    CollectedHeap(), _collector_policy(policy), _death_march_count(0) { }
+    CollectedHeap(),
+    _collector_policy(policy),
+    _death_march_count(0),
+    _workers("GC Thread",
+             ParallelGCThreads,
+             true /* are_GC_task_threads */,
+             false /* are_ConcurrentGC_threads */) { }
 
   // For use by VM operations
   enum CollectionType {
@@ -127,6 +139,14 @@ class ParallelScavengeHeap : public CollectedHeap {
 
   static GCTaskManager* const gc_task_manager() { return _gc_task_manager; }
 
+  WorkGang& workers() { return _workers; }
+
+  virtual WorkGang* get_safepoint_workers() { return &_workers; }
+
+  // Use the same number of active workers in the work gang as the task
+  // manager decided on for the current collection.
+  void update_active_workers(uint active_workers) { _workers.update_active_workers(active_workers); }
+
   CardTableBarrierSet* barrier_set();
   PSCardTable* card_table();
 
@@ -217,6 +237,8 @@ class ParallelScavengeHeap : public CollectedHeap {
 
   void object_iterate(ObjectClosure* cl);
   void safe_object_iterate(ObjectClosure* cl) { object_iterate(cl); }
+  void object_iterate_parallel(ObjectClosure* cl, HeapBlockClaimer* claimer);
+  virtual ParallelObjectIterator* parallel_object_iterator(uint thread_num);
 
   HeapWord* block_start(const void* addr) const;
   size_t block_size(const HeapWord* addr) const;
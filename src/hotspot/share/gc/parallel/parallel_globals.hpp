@@ -78,6 +78,15 @@
           "Delay in scheduling GC workers (in milliseconds)")               \
                                                                             \
   product(bool, PSChunkLargeArrays, true,                                   \
-          "Process large arrays in chunks")
+          "Process large arrays in chunks")                                 \
+                                                                            \
+  experimental(bool, PSNUMAPromotionChunks, true,                           \
+          "With UseNUMA, allocate old generation promotion LABs from "      \
+          "chunks bound to the NUMA node of the promoting GC thread")       \
+                                                                            \
+  experimental(size_t, PSNUMAPromotionChunkSize, 1 * M,                     \
+          "Size of the node-local old generation chunks promotion LABs "    \
+          "are allocated from with PSNUMAPromotionChunks")                  \
+          range(64 * K, 64 * M)
 
 #endif // SHARE_GC_PARALLEL_PARALLEL_GLOBALS_HPP
@@ -126,45 +126,72 @@ void MarkFromRootsTask::do_it(GCTaskManager* manager, uint which) {
 }
 
 
+// Steal marking work from the other workers until all workers agree to
+// terminate.
+static void steal_marking_work(ParallelTaskTerminator& terminator, uint worker_id) {
+  assert(ParallelScavengeHeap::heap()->is_gc_active(), "called outside gc");
+
+  ParCompactionManager* cm =
+    ParCompactionManager::gc_thread_compaction_manager(worker_id);
+
+  oop obj = NULL;
+  ObjArrayChunkedTask task;
+  int random_seed = 17;
+  do {
+    while (ParCompactionManager::steal_objarray(worker_id, &random_seed, task)) {
+      cm->follow_array_chunk((objArrayOop)task.obj(), task.chunk(), task.pow());
+      cm->follow_marking_stacks();
+    }
+    while (ParCompactionManager::steal(worker_id, &random_seed, obj)) {
+      cm->follow_contents(obj);
+      cm->follow_marking_stacks();
+    }
+  } while (!terminator.offer_termination());
+}
+
 //
-// RefProcTaskProxy
+// RefProcTask
 //
 
-void RefProcTaskProxy::do_it(GCTaskManager* manager, uint which)
-{
+RefProcTask::RefProcTask(ProcessTask& task, ParallelTaskTerminator& terminator,
+                         uint active_workers) :
+  AbstractGangTask("RefProcTask"),
+  _task(task),
+  _active_workers(active_workers),
+  _terminator(terminator) {
+}
+
+void RefProcTask::work(uint worker_id) {
   assert(ParallelScavengeHeap::heap()->is_gc_active(), "called outside gc");
 
   ParCompactionManager* cm =
-    ParCompactionManager::gc_thread_compaction_manager(which);
+    ParCompactionManager::gc_thread_compaction_manager(worker_id);
   ParCompactionManager::MarkAndPushClosure mark_and_push_closure(cm);
   ParCompactionManager::FollowStackClosure follow_stack_closure(cm);
-  _rp_task.work(_work_id, *PSParallelCompact::is_alive_closure(),
-                mark_and_push_closure, follow_stack_closure);
+  _task.work(worker_id, *PSParallelCompact::is_alive_closure(),
+             mark_and_push_closure, follow_stack_closure);
+
+  if (_task.marks_oops_alive() && _active_workers > 1) {
+    steal_marking_work(_terminator, worker_id);
+  }
 }
 
 //
 // RefProcTaskExecutor
 //
 
-void RefProcTaskExecutor::execute(ProcessTask& task, uint ergo_workers)
+void RefProcTaskExecutor::execute(ProcessTask& process_task, uint ergo_workers)
 {
-  ParallelScavengeHeap* heap = ParallelScavengeHeap::heap();
-  uint active_gc_threads = heap->gc_task_manager()->active_workers();
-  assert(active_gc_threads == ergo_workers,
-         "Ergonomically chosen workers (%u) must be equal to active workers (%u)",
+  WorkGang& workers = ParallelScavengeHeap::heap()->workers();
+  uint active_gc_threads = workers.active_workers();
+  // The reference processor may use fewer workers than are active
+  // when only a few references have been discovered.
+  assert(ergo_workers <= active_gc_threads,
+         "Ergonomically chosen workers (%u) must be at most active workers (%u)",
          ergo_workers, active_gc_threads);
-  OopTaskQueueSet* qset = ParCompactionManager::stack_array();
-  ParallelTaskTerminator terminator(active_gc_threads, qset);
-  GCTaskQueue* q = GCTaskQueue::create();
-  for(uint i=0; i<active_gc_threads; i++) {
-    q->enqueue(new RefProcTaskProxy(task, i));
-  }
-  if (task.marks_oops_alive() && (active_gc_threads>1)) {
-    for (uint j=0; j<active_gc_threads; j++) {
-      q->enqueue(new StealMarkingTask(&terminator));
-    }
-  }
-  PSParallelCompact::gc_task_manager()->execute_and_wait(q);
+  ParallelTaskTerminator terminator(ergo_workers, ParCompactionManager::stack_array());
+  RefProcTask task(process_task, terminator, ergo_workers);
+  workers.run_task(&task, ergo_workers);
 }
 
 //
@@ -175,25 +202,7 @@ StealMarkingTask::StealMarkingTask(ParallelTaskTerminator* t) :
   _terminator(t) {}
 
 void StealMarkingTask::do_it(GCTaskManager* manager, uint which) {
-  assert(ParallelScavengeHeap::heap()->is_gc_active(), "called outside gc");
-
-  ParCompactionManager* cm =
-    ParCompactionManager::gc_thread_compaction_manager(which);
-  ParCompactionManager::MarkAndPushClosure mark_and_push_closure(cm);
-
-  oop obj = NULL;
-  ObjArrayTask task;
-  int random_seed = 17;
-  do {
-    while (ParCompactionManager::steal_objarray(which, &random_seed, task)) {
-      cm->follow_contents((objArrayOop)task.obj(), task.index());
-      cm->follow_marking_stacks();
-    }
-    while (ParCompactionManager::steal(which, &random_seed, obj)) {
-      cm->follow_contents(obj);
-      cm->follow_marking_stacks();
-    }
-  } while (!terminator()->offer_termination());
+  steal_marking_work(*terminator(), which);
 }
 
 //
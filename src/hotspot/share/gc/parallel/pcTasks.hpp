@@ -28,6 +28,8 @@
 #include "gc/parallel/gcTaskManager.hpp"
 #include "gc/parallel/psParallelCompact.hpp"
 #include "gc/parallel/psTasks.hpp"
+#include "gc/shared/taskqueue.hpp"
+#include "gc/shared/workgroup.hpp"
 
 
 // Tasks for parallel compaction of the old generation
@@ -110,25 +112,22 @@ class MarkFromRootsTask : public GCTask {
 };
 
 //
-// RefProcTaskProxy
+// RefProcTask
 //
-// This task is used as a proxy to parallel reference processing tasks .
+// This gang task runs parallel reference processing tasks on the workers
+// of the ParallelScavengeHeap work gang, followed by stealing marking work
+// if the reference processing task may mark objects alive.
 //
 
-class RefProcTaskProxy : public GCTask {
+class RefProcTask : public AbstractGangTask {
   typedef AbstractRefProcTaskExecutor::ProcessTask ProcessTask;
-  ProcessTask & _rp_task;
-  uint          _work_id;
+  ProcessTask&            _task;
+  uint                    _active_workers;
+  ParallelTaskTerminator& _terminator;
 public:
-  RefProcTaskProxy(ProcessTask & rp_task, uint work_id)
-    : _rp_task(rp_task),
-      _work_id(work_id)
-  { }
+  RefProcTask(ProcessTask& task, ParallelTaskTerminator& terminator, uint active_workers);
 
-private:
-  virtual char* name() { return (char *)"Process referents by policy in parallel"; }
-
-  virtual void do_it(GCTaskManager* manager, uint which);
+  virtual void work(uint worker_id);
 };
 
 
@@ -136,7 +135,7 @@ private:
 // RefProcTaskExecutor
 //
 // Task executor is an interface for the reference processor to run
-// tasks using GCTaskManager.
+// tasks using the ParallelScavengeHeap work gang.
 //
 
 class RefProcTaskExecutor: public AbstractRefProcTaskExecutor {
@@ -119,6 +119,40 @@ class CheckForPreciseMarks : public BasicOopIterateClosure {
   virtual void do_oop(narrowOop* p) { CheckForPreciseMarks::do_oop_work(p); }
 };
 
+// Caches the last object found by object start lookups of a stripe. Dirty
+// card runs within the same (large) object repeatedly look up its start,
+// which otherwise walks back the object start array across the object.
+class StripeObjectStartCache : public StackObj {
+  ObjectStartArray* const _start_array;
+  HeapWord*               _obj_start;
+  HeapWord*               _obj_end;
+
+ public:
+  StripeObjectStartCache(ObjectStartArray* start_array) :
+    _start_array(start_array), _obj_start(NULL), _obj_end(NULL) { }
+
+  HeapWord* object_start(HeapWord* addr) {
+    if (_obj_start <= addr && addr < _obj_end) {
+      return _obj_start;
+    }
+    _obj_start = _start_array->object_start(addr);
+    _obj_end = _obj_start + oop(_obj_start)->size();
+    return _obj_start;
+  }
+
+  // The end of the object containing addr.
+  HeapWord* object_end(HeapWord* addr) {
+    object_start(addr);
+    return _obj_end;
+  }
+};
+
+// Object arrays spanning at least a stripe are only scanned within the dirty
+// cards covering them, instead of completely from their first dirty card on.
+static bool is_large_obj_array(oop obj, size_t obj_size, size_t stripe_words) {
+  return obj_size >= stripe_words && obj->is_objArray();
+}
+
 // We get passed the space_top value to prevent us from traversing into
 // the old_gen promotion labs, which cannot be safely parsed.
 
@@ -136,6 +170,7 @@ void PSCardTable::scavenge_contents_parallel(ObjectStartArray* start_array,
                                              uint stripe_total) {
   int ssize = 128; // Naked constant!  Work unit = 64k.
   int dirty_card_count = 0;
+  const size_t stripe_words = ssize * card_size_in_words;
 
   // It is a waste to get here if empty.
   assert(sp->bottom() < sp->top(), "Should not be called if empty");
@@ -179,11 +214,13 @@ void PSCardTable::scavenge_contents_parallel(ObjectStartArray* start_array,
     if (!start_array->object_starts_in_range(slice_start, slice_end)) {
       continue;
     }
+    StripeObjectStartCache start_cache(start_array);
+
     // Update our beginning addr
-    HeapWord* first_object = start_array->object_start(slice_start);
+    HeapWord* first_object = start_cache.object_start(slice_start);
     debug_only(oop* first_object_within_slice = (oop*) first_object;)
     if (first_object < slice_start) {
-      last_scanned = (oop*)(first_object + oop(first_object)->size());
+      last_scanned = (oop*)start_cache.object_end(first_object);
       debug_only(first_object_within_slice = last_scanned;)
       worker_start_card = byte_for(last_scanned);
     }
@@ -191,8 +228,7 @@ void PSCardTable::scavenge_contents_parallel(ObjectStartArray* start_array,
     // Update the ending addr
     if (slice_end < (HeapWord*)sp_top) {
       // The subtraction is important! An object may start precisely at slice_end.
-      HeapWord* last_object = start_array->object_start(slice_end - 1);
-      slice_end = last_object + oop(last_object)->size();
+      slice_end = start_cache.object_end(slice_end - 1);
       // worker_end_card is exclusive, so bump it one past the end of last_object's
       // covered span.
       worker_end_card = byte_for(slice_end) + 1;
@@ -229,9 +265,14 @@ void PSCardTable::scavenge_contents_parallel(ObjectStartArray* start_array,
           // we will attempt to scan it twice. The test against "last_scanned"
           // prevents the redundant object scan, but it does not prevent newly
           // marked cards from being cleaned.
-          HeapWord* last_object_in_dirty_region = start_array->object_start(addr_for(current_card)-1);
-          size_t size_of_last_object = oop(last_object_in_dirty_region)->size();
-          HeapWord* end_of_last_object = last_object_in_dirty_region + size_of_last_object;
+          //
+          // Large object arrays are exempt: only their dirty cards are scanned.
+          HeapWord* last_object_in_dirty_region = start_cache.object_start(addr_for(current_card)-1);
+          HeapWord* end_of_last_object = start_cache.object_end(last_object_in_dirty_region);
+          size_t size_of_last_object = pointer_delta(end_of_last_object, last_object_in_dirty_region);
+          if (is_large_obj_array(oop(last_object_in_dirty_region), size_of_last_object, stripe_words)) {
+            break;
+          }
           jbyte* ending_card_of_last_object = byte_for(end_of_last_object);
           assert(ending_card_of_last_object <= worker_end_card, "ending_card_of_last_object is greater than worker_end_card");
           if (ending_card_of_last_object > current_card) {
@@ -244,7 +285,8 @@ void PSCardTable::scavenge_contents_parallel(ObjectStartArray* start_array,
       jbyte* following_clean_card = current_card;
 
       if (first_unclean_card < worker_end_card) {
-        oop* p = (oop*) start_array->object_start(addr_for(first_unclean_card));
+        HeapWord* const dirty_start = addr_for(first_unclean_card);
+        oop* p = (oop*) start_cache.object_start(dirty_start);
         assert((HeapWord*)p <= addr_for(first_unclean_card), "checking");
         // "p" should always be >= "last_scanned" because newly GC dirtied
         // cards are no longer scanned again (see comment at end
@@ -283,25 +325,31 @@ void PSCardTable::scavenge_contents_parallel(ObjectStartArray* start_array,
 
         const int interval = PrefetchScanIntervalInBytes;
         // scan all objects in the range
-        if (interval != 0) {
-          while (p < to) {
+        oop* partially_scanned = NULL;
+        while (p < to) {
+          if (interval != 0) {
             Prefetch::write(p, interval);
-            oop m = oop(p);
-            assert(oopDesc::is_oop_or_null(m), "Expected an oop or NULL for header field at " PTR_FORMAT, p2i(m));
-            pm->push_contents(m);
-            p += m->size();
           }
-          pm->drain_stacks_cond_depth();
-        } else {
-          while (p < to) {
-            oop m = oop(p);
-            assert(oopDesc::is_oop_or_null(m), "Expected an oop or NULL for header field at " PTR_FORMAT, p2i(m));
+          oop m = oop(p);
+          assert(oopDesc::is_oop_or_null(m), "Expected an oop or NULL for header field at " PTR_FORMAT, p2i(m));
+          size_t size = m->size();
+          if (is_large_obj_array(m, size, stripe_words)) {
+            // Only scan the part of the array covered by this dirty run. If it
+            // continues after the run, later runs will scan more of it.
+            HeapWord* left = MAX2((HeapWord*)p, dirty_start);
+            HeapWord* right = MIN2((HeapWord*)p + size, (HeapWord*)to);
+            pm->push_contents_bounded(m, left, right);
+            if ((HeapWord*)p + size > (HeapWord*)to) {
+              partially_scanned = p;
+              break;
+            }
+          } else {
             pm->push_contents(m);
-            p += m->size();
           }
-          pm->drain_stacks_cond_depth();
+          p += size;
         }
-        last_scanned = p;
+        pm->drain_stacks_cond_depth();
+        last_scanned = partially_scanned != NULL ? partially_scanned : p;
       }
       // "current_card" is still the "following_clean_card" or
       // the current_card is >= the worker_end_card so the
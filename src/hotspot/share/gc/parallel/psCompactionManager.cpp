@@ -225,12 +225,7 @@ void InstanceRefKlass::oop_pc_follow_contents(oop obj, ParCompactionManager* cm)
 
 void ObjArrayKlass::oop_pc_follow_contents(oop obj, ParCompactionManager* cm) {
   cm->follow_klass(this);
-
-  if (UseCompressedOops) {
-    oop_pc_follow_contents_specialized<narrowOop>(objArrayOop(obj), 0, cm);
-  } else {
-    oop_pc_follow_contents_specialized<oop>(objArrayOop(obj), 0, cm);
-  }
+  cm->follow_array(objArrayOop(obj));
 }
 
 void TypeArrayKlass::oop_pc_follow_contents(oop obj, ParCompactionManager* cm) {
@@ -251,9 +246,9 @@ void ParCompactionManager::follow_marking_stacks() {
     }
 
     // Process ObjArrays one at a time to avoid marking stack bloat.
-    ObjArrayTask task;
+    ObjArrayChunkedTask task;
     if (_objarray_stack.pop_overflow(task) || _objarray_stack.pop_local(task)) {
-      follow_contents((objArrayOop)task.obj(), task.index());
+      follow_array_chunk((objArrayOop)task.obj(), task.chunk(), task.pow());
     }
   } while (!marking_stacks_empty());
 
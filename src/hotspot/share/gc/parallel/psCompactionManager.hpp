@@ -61,8 +61,8 @@ class ParCompactionManager : public CHeapObj<mtGC> {
  private:
   // 32-bit:  4K * 8 = 32KiB; 64-bit:  8K * 16 = 128KiB
   #define QUEUE_SIZE (1 << NOT_LP64(12) LP64_ONLY(13))
-  typedef OverflowTaskQueue<ObjArrayTask, mtGC, QUEUE_SIZE> ObjArrayTaskQueue;
-  typedef GenericTaskQueueSet<ObjArrayTaskQueue, mtGC>      ObjArrayTaskQueueSet;
+  typedef OverflowTaskQueue<ObjArrayChunkedTask, mtGC, QUEUE_SIZE> ObjArrayTaskQueue;
+  typedef GenericTaskQueueSet<ObjArrayTaskQueue, mtGC>             ObjArrayTaskQueueSet;
   #undef QUEUE_SIZE
 
   static ParCompactionManager** _manager_array;
@@ -146,7 +146,6 @@ private:
 
   // Save for later processing.  Must not fail.
   inline void push(oop obj);
-  inline void push_objarray(oop objarray, size_t index);
   inline void push_region(size_t index);
 
   // Check mark and maybe push on marking stack.
@@ -160,7 +159,7 @@ private:
   static ParCompactionManager* gc_thread_compaction_manager(uint index);
 
   static bool steal(int queue_num, int* seed, oop& t);
-  static bool steal_objarray(int queue_num, int* seed, ObjArrayTask& t);
+  static bool steal_objarray(int queue_num, int* seed, ObjArrayChunkedTask& t);
   static bool steal(int queue_num, int* seed, size_t& region);
 
   // Process tasks remaining on any marking stack
@@ -171,7 +170,11 @@ private:
   void drain_region_stacks();
 
   void follow_contents(oop obj);
-  void follow_contents(objArrayOop array, int index);
+
+  // Object arrays are split into chunks that other workers can steal
+  void follow_array(objArrayOop array);
+  void follow_array_chunk(objArrayOop array, int chunk, int pow);
+  void follow_array_range(objArrayOop array, int from, int to);
 
   void update_contents(oop obj);
 
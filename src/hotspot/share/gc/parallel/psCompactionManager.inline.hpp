@@ -41,7 +41,7 @@ inline bool ParCompactionManager::steal(int queue_num, int* seed, oop& t) {
   return stack_array()->steal(queue_num, seed, t);
 }
 
-inline bool ParCompactionManager::steal_objarray(int queue_num, int* seed, ObjArrayTask& t) {
+inline bool ParCompactionManager::steal_objarray(int queue_num, int* seed, ObjArrayChunkedTask& t) {
   return _objarray_queues->steal(queue_num, seed, t);
 }
 
@@ -53,13 +53,6 @@ inline void ParCompactionManager::push(oop obj) {
   _marking_stack.push(obj);
 }
 
-void ParCompactionManager::push_objarray(oop obj, size_t index)
-{
-  ObjArrayTask task(obj, index);
-  assert(task.is_valid(), "bad ObjArrayTask");
-  _objarray_stack.push(task);
-}
-
 void ParCompactionManager::push_region(size_t index)
 {
 #ifdef ASSERT
@@ -113,35 +106,39 @@ inline void ParCompactionManager::follow_contents(oop obj) {
 }
 
 template <class T>
-inline void oop_pc_follow_contents_specialized(objArrayOop obj, int index, ParCompactionManager* cm) {
-  const size_t len = size_t(obj->length());
-  const size_t beg_index = size_t(index);
-  assert(beg_index < len || len == 0, "index too large");
+inline void oop_pc_follow_contents_specialized(objArrayOop obj, int from, int to, ParCompactionManager* cm) {
+  assert(0 <= from && from <= to && to <= obj->length(), "range is sane: [%d, %d)/%d", from, to, obj->length());
 
-  const size_t stride = MIN2(len - beg_index, (size_t)ObjArrayMarkingStride);
-  const size_t end_index = beg_index + stride;
   T* const base = (T*)obj->base_raw();
-  T* const beg = base + beg_index;
-  T* const end = base + end_index;
-
-  if (end_index < len) {
-    cm->push_objarray(obj, end_index); // Push the continuation.
-  }
+  T* const beg = base + from;
+  T* const end = base + to;
 
-  // Push the non-NULL elements of the next stride on the marking stack.
+  // Push the non-NULL elements of the range on the marking stack.
   for (T* e = beg; e < end; e++) {
     cm->mark_and_push<T>(e);
   }
 }
 
-inline void ParCompactionManager::follow_contents(objArrayOop obj, int index) {
+inline void ParCompactionManager::follow_array_range(objArrayOop obj, int from, int to) {
   if (UseCompressedOops) {
-    oop_pc_follow_contents_specialized<narrowOop>(obj, index, this);
+    oop_pc_follow_contents_specialized<narrowOop>(obj, from, to, this);
   } else {
-    oop_pc_follow_contents_specialized<oop>(obj, index, this);
+    oop_pc_follow_contents_specialized<oop>(obj, from, to, this);
   }
 }
 
+inline void ParCompactionManager::follow_array(objArrayOop obj) {
+  // Push the full chunks, and process the irregular tail, if present
+  const int from = ObjArrayChunker::push_initial_chunks(&_objarray_stack, obj);
+  follow_array_range(obj, from, obj->length());
+}
+
+inline void ParCompactionManager::follow_array_chunk(objArrayOop obj, int chunk, int pow) {
+  int from, to;
+  ObjArrayChunker::split_chunk(&_objarray_stack, obj, chunk, pow, &from, &to);
+  follow_array_range(obj, from, to);
+}
+
 inline void ParCompactionManager::update_contents(oop obj) {
   obj->pc_update_contents(this);
 }
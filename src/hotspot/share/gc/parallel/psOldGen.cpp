@@ -30,11 +30,14 @@
 #include "gc/parallel/psMarkSweepDecorator.hpp"
 #include "gc/parallel/psOldGen.hpp"
 #include "gc/shared/cardTableBarrierSet.hpp"
+#include "gc/shared/collectedHeap.hpp"
 #include "gc/shared/gcLocker.hpp"
 #include "gc/shared/spaceDecorator.hpp"
 #include "logging/log.hpp"
 #include "oops/oop.inline.hpp"
 #include "runtime/java.hpp"
+#include "runtime/mutexLocker.hpp"
+#include "runtime/os.hpp"
 #include "utilities/align.hpp"
 
 inline const char* PSOldGen::select_name() {
@@ -44,6 +47,7 @@ inline const char* PSOldGen::select_name() {
 PSOldGen::PSOldGen(ReservedSpace rs, size_t alignment,
                    size_t initial_size, size_t min_size, size_t max_size,
                    const char* perf_data_name, int level):
+  _numa_chunks(NULL), _numa_chunks_num(0),
   _name(select_name()), _init_gen_size(initial_size), _min_gen_size(min_size),
   _max_gen_size(max_size)
 {
@@ -53,6 +57,7 @@ PSOldGen::PSOldGen(ReservedSpace rs, size_t alignment,
 PSOldGen::PSOldGen(size_t initial_size,
                    size_t min_size, size_t max_size,
                    const char* perf_data_name, int level):
+  _numa_chunks(NULL), _numa_chunks_num(0),
   _name(select_name()), _init_gen_size(initial_size), _min_gen_size(min_size),
   _max_gen_size(max_size)
 {}
@@ -137,7 +142,9 @@ void PSOldGen::initialize_work(const char* perf_data_name, int level) {
 
   object_space()->initialize(cmr,
                              SpaceDecorator::Clear,
-                             SpaceDecorator::Mangle);
+                             SpaceDecorator::Mangle,
+                             MutableSpace::SetupPages,
+                             &ParallelScavengeHeap::heap()->workers());
 
 #if INCLUDE_SERIALGC
   _object_mark_sweep = new PSMarkSweepDecorator(_object_space, start_array(), MarkSweepDeadRatio);
@@ -149,6 +156,128 @@ void PSOldGen::initialize_work(const char* perf_data_name, int level) {
 
   // Update the start_array
   start_array()->set_covered_region(cmr);
+
+  if (UseNUMA && PSNUMAPromotionChunks) {
+    initialize_numa_chunks();
+  }
+}
+
+void PSOldGen::initialize_numa_chunks() {
+  int num_groups = (int)os::numa_get_groups_num();
+  if (num_groups <= 1) {
+    return;
+  }
+  int* lgrp_ids = NEW_C_HEAP_ARRAY(int, num_groups, mtGC);
+  int num_leaf_groups = (int)os::numa_get_leaf_groups(lgrp_ids, num_groups);
+  if (num_leaf_groups > 1) {
+    _numa_chunks = NEW_C_HEAP_ARRAY(NUMAPromotionChunk, num_leaf_groups, mtGC);
+    _numa_chunks_num = num_leaf_groups;
+    for (int i = 0; i < num_leaf_groups; i++) {
+      _numa_chunks[i]._lgrp_id = lgrp_ids[i];
+      _numa_chunks[i]._lock = new Mutex(Mutex::leaf, "PSOldGen NUMA chunk lock", true,
+                                        Monitor::_safepoint_check_never);
+      _numa_chunks[i]._top = NULL;
+      _numa_chunks[i]._end = NULL;
+    }
+  }
+  FREE_C_HEAP_ARRAY(int, lgrp_ids);
+}
+
+PSOldGen::NUMAPromotionChunk* PSOldGen::numa_chunk_for_current_thread() const {
+  int lgrp_id = os::numa_get_group_id();
+  for (int i = 0; i < _numa_chunks_num; i++) {
+    if (_numa_chunks[i]._lgrp_id == lgrp_id) {
+      return &_numa_chunks[i];
+    }
+  }
+  return &_numa_chunks[0];
+}
+
+HeapWord* PSOldGen::allocate_in_numa_chunk(NUMAPromotionChunk* chunk, size_t word_size) {
+  assert_lock_strong(chunk->_lock);
+  if (chunk->_top == NULL) {
+    return NULL;
+  }
+  size_t available = pointer_delta(chunk->_end, chunk->_top);
+  // Never leave a gap that is too small to be filled.
+  if (available < word_size ||
+      (available != word_size && available - word_size < CollectedHeap::min_fill_size())) {
+    return NULL;
+  }
+  HeapWord* res = chunk->_top;
+  chunk->_top += word_size;
+  DEBUG_ONLY(assert_block_in_covered_region(MemRegion(res, word_size)));
+  _start_array.allocate_block(res);
+  return res;
+}
+
+void PSOldGen::retire_numa_chunk(NUMAPromotionChunk* chunk) {
+  assert_lock_strong(chunk->_lock);
+  if (chunk->_top != NULL && chunk->_top < chunk->_end) {
+    CollectedHeap::fill_with_object(chunk->_top, chunk->_end);
+    _start_array.allocate_block(chunk->_top);
+  }
+  chunk->_top = NULL;
+  chunk->_end = NULL;
+}
+
+void PSOldGen::bind_to_node(HeapWord* start, size_t word_size, int lgrp_id) {
+  // Only pages completely within the new chunk are free to be rebound.
+  size_t page_size = UseLargePages ? object_space()->alignment() : os::vm_page_size();
+  char* bind_start = align_up((char*)start, page_size);
+  char* bind_end = align_down((char*)(start + word_size), page_size);
+  if (bind_end > bind_start) {
+    size_t bytes = pointer_delta(bind_end, bind_start, sizeof(char));
+    // Prefer page reallocation to migration.
+    os::free_memory(bind_start, bytes, page_size);
+    os::numa_make_local(bind_start, bytes, lgrp_id);
+  }
+}
+
+HeapWord* PSOldGen::cas_allocate_lab(size_t word_size) {
+  if (_numa_chunks == NULL) {
+    return cas_allocate(word_size);
+  }
+
+  NUMAPromotionChunk* chunk = numa_chunk_for_current_thread();
+  {
+    MutexLockerEx ml(chunk->_lock, Mutex::_no_safepoint_check_flag);
+    HeapWord* res = allocate_in_numa_chunk(chunk, word_size);
+    if (res != NULL) {
+      return res;
+    }
+  }
+
+  // Get a new chunk without holding the chunk lock, as this may expand the
+  // generation.
+  size_t chunk_words = PSNUMAPromotionChunkSize / HeapWordSize;
+  if (chunk_words < word_size + CollectedHeap::min_fill_size()) {
+    chunk_words = word_size;
+  }
+  HeapWord* chunk_base = cas_allocate(chunk_words);
+  if (chunk_base == NULL) {
+    // Fall back to a plain allocation of the requested size.
+    return cas_allocate(word_size);
+  }
+  bind_to_node(chunk_base, chunk_words, chunk->_lgrp_id);
+
+  MutexLockerEx ml(chunk->_lock, Mutex::_no_safepoint_check_flag);
+  // Another thread may have installed a new chunk meanwhile; retire it, the
+  // new chunk is at least as large as its remainder.
+  retire_numa_chunk(chunk);
+  chunk->_top = chunk_base;
+  chunk->_end = chunk_base + chunk_words;
+  HeapWord* res = allocate_in_numa_chunk(chunk, word_size);
+  assert(res != NULL, "must be able to allocate from a new chunk");
+  return res;
+}
+
+void PSOldGen::retire_numa_chunks() {
+  assert(SafepointSynchronize::is_at_safepoint(), "Must only be called at safepoint");
+  for (int i = 0; i < _numa_chunks_num; i++) {
+    MutexLockerEx ml(_numa_chunks[i]._lock, Mutex::_no_safepoint_check_flag);
+    retire_numa_chunk(&_numa_chunks[i]);
+  }
 }
 
 void PSOldGen::initialize_performance_counters(const char* perf_data_name, int level) {
@@ -421,6 +550,39 @@ size_t PSOldGen::available_for_contraction() {
   return 0;
 }
 
+size_t PSOldGen::num_iterable_blocks() const {
+  return (object_space()->used_in_bytes() + IterateBlockSize - 1) / IterateBlockSize;
+}
+
+void PSOldGen::object_iterate_block(ObjectClosure* cl, size_t block_index) {
+  const size_t block_word_size = IterateBlockSize / HeapWordSize;
+  assert((block_word_size % ObjectStartArray::block_size_in_words) == 0,
+         "Block size not a multiple of start_array block");
+
+  MutableSpace* const space = object_space();
+  HeapWord* const begin = space->bottom() + block_index * block_word_size;
+  HeapWord* const end = MIN2(space->top(), begin + block_word_size);
+
+  if (!start_array()->object_starts_in_range(begin, end)) {
+    // No object starts in this block, it is covered by an object that
+    // started in a previous block and is visited by that block's iteration.
+    return;
+  }
+
+  // Skip the object that started in a previous block, if any
+  HeapWord* start = start_array()->object_start(begin);
+  if (start < begin) {
+    start += oop(start)->size();
+  }
+  assert(start >= begin, "Object address" PTR_FORMAT " must be larger or equal to block address at " PTR_FORMAT,
+         p2i(start), p2i(begin));
+
+  // Iterate all objects that start in this block
+  for (HeapWord* p = start; p < end; p += oop(p)->size()) {
+    cl->do_object(oop(p));
+  }
+}
+
 void PSOldGen::print() const { print_on(tty);}
 void PSOldGen::print_on(outputStream* st) const {
   st->print(" %-15s", name());
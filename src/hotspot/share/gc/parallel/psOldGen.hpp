@@ -30,6 +30,7 @@
 #include "gc/parallel/psGenerationCounters.hpp"
 #include "gc/parallel/psVirtualspace.hpp"
 #include "gc/parallel/spaceCounters.hpp"
+#include "runtime/mutex.hpp"
 #include "runtime/safepoint.hpp"
 
 class PSMarkSweepDecorator;
@@ -54,6 +55,17 @@ class PSOldGen : public CHeapObj<mtGC> {
   PSGenerationCounters*    _gen_counters;
   SpaceCounters*           _space_counters;
 
+  // With UseNUMA and PSNUMAPromotionChunks, promotion LABs are carved out of
+  // per-node chunks of the object space whose pages are bound to that node.
+  struct NUMAPromotionChunk {
+    int       _lgrp_id;
+    Mutex*    _lock;
+    HeapWord* _top;
+    HeapWord* _end;
+  };
+  NUMAPromotionChunk*      _numa_chunks;
+  int                      _numa_chunks_num;
+
   // Sizing information, in bytes, set in constructor
   const size_t _init_gen_size;
   const size_t _min_gen_size;
@@ -109,6 +121,17 @@ class PSOldGen : public CHeapObj<mtGC> {
     return (res == NULL) ? expand_and_cas_allocate(word_size) : res;
   }
 
+  // Support for MT garbage collection. Allocates a promotion LAB from the
+  // chunk local to the NUMA node of the current thread if there are such
+  // chunks, otherwise behaves like cas_allocate().
+  HeapWord* cas_allocate_lab(size_t word_size);
+
+  void initialize_numa_chunks();
+  NUMAPromotionChunk* numa_chunk_for_current_thread() const;
+  HeapWord* allocate_in_numa_chunk(NUMAPromotionChunk* chunk, size_t word_size);
+  void retire_numa_chunk(NUMAPromotionChunk* chunk);
+  void bind_to_node(HeapWord* start, size_t word_size, int lgrp_id);
+
   HeapWord* expand_and_allocate(size_t word_size);
   HeapWord* expand_and_cas_allocate(size_t word_size);
   void expand(size_t bytes);
@@ -187,6 +210,10 @@ class PSOldGen : public CHeapObj<mtGC> {
   // Calculating new sizes
   void resize(size_t desired_free_space);
 
+  // Fill the unused parts of the NUMA promotion chunks so that the object
+  // space is parsable again. Must be called at the end of a scavenge.
+  void retire_numa_chunks();
+
   // Allocation. We report all successful allocations to the size policy
   // Note that the perm gen does not use this method, and should not!
   HeapWord* allocate(size_t word_size);
@@ -195,6 +222,12 @@ class PSOldGen : public CHeapObj<mtGC> {
   void oop_iterate(OopIterateClosure* cl) { object_space()->oop_iterate(cl); }
   void object_iterate(ObjectClosure* cl) { object_space()->object_iterate(cl); }
 
+  // Parallel iteration. The used part of the object space is split into
+  // blocks of IterateBlockSize bytes, which are iterated independently.
+  static const size_t IterateBlockSize = 1024 * 1024;
+  size_t num_iterable_blocks() const;
+  void object_iterate_block(ObjectClosure* cl, size_t block_index);
+
   // Debugging - do not use for time critical operations
   virtual void print() const;
   virtual void print_on(outputStream* st) const;
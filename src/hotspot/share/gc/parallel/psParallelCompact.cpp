@@ -48,11 +48,13 @@
 #include "gc/shared/gcTrace.hpp"
 #include "gc/shared/gcTraceTime.inline.hpp"
 #include "gc/shared/isGCActiveMark.hpp"
+#include "gc/shared/pretouchTask.hpp"
 #include "gc/shared/referencePolicy.hpp"
 #include "gc/shared/referenceProcessor.hpp"
 #include "gc/shared/referenceProcessorPhaseTimes.hpp"
 #include "gc/shared/spaceDecorator.hpp"
 #include "gc/shared/weakProcessor.hpp"
+#include "gc/shared/workgroup.hpp"
 #include "logging/log.hpp"
 #include "memory/iterator.inline.hpp"
 #include "memory/resourceArea.hpp"
@@ -434,6 +436,19 @@ bool ParallelCompactData::initialize(MemRegion covered_region)
   return result;
 }
 
+void ParallelCompactData::pretouch(WorkGang* pretouch_gang) {
+  PretouchTask::pretouch("ParallelGC PreTouch Region Data",
+                         _region_vspace->committed_low_addr(),
+                         _region_vspace->committed_high_addr(),
+                         os::vm_page_size(),
+                         pretouch_gang);
+  PretouchTask::pretouch("ParallelGC PreTouch Block Data",
+                         _block_vspace->committed_low_addr(),
+                         _block_vspace->committed_high_addr(),
+                         os::vm_page_size(),
+                         pretouch_gang);
+}
+
 PSVirtualSpace*
 ParallelCompactData::create_vspace(size_t count, size_t element_size)
 {
@@ -553,6 +568,126 @@ void ParallelCompactData::add_obj(HeapWord* addr, size_t len)
   _region_data[end_region].set_partial_obj_addr(addr);
 }
 
+// Number of regions processed by a worker at a time when summarizing in
+// parallel.  Ranges of less than two chunks are summarized serially.
+static const size_t SummaryChunkRegions = 4096;
+
+// Splits the summary work over a range of regions into chunks of
+// SummaryChunkRegions regions that are claimed by the workers.
+//
+// Summarizing is a prefix sum over the data sizes of the regions.  It is
+// done in two parallel passes: the first one computes the amount of live
+// data in every chunk, after which the destination of the first region of
+// every chunk is known; the second one summarizes the regions of each
+// chunk starting at that destination.
+class PCSummaryTask : public AbstractGangTask {
+public:
+  enum Mode {
+    ComputeChunkSizes,
+    SummarizeChunks,
+    SummarizeDensePrefix
+  };
+
+private:
+  ParallelCompactData& _sd;
+  SplitInfo* _split_info;
+  const size_t _beg_region;
+  const size_t _end_region;
+  size_t* const _chunk_words;
+  HeapWord** const _chunk_dest;
+  Mode _mode;
+  volatile size_t _claimed_chunk;
+
+  size_t num_chunks() const {
+    return (_end_region - _beg_region + SummaryChunkRegions - 1) / SummaryChunkRegions;
+  }
+
+  void compute_chunk_size(size_t chunk, size_t beg, size_t end) {
+    size_t words = 0;
+    for (size_t cur = beg; cur < end; ++cur) {
+      words += _sd.region(cur)->data_size();
+    }
+    _chunk_words[chunk] = words;
+  }
+
+  void summarize_chunk(size_t chunk, size_t beg, size_t end) {
+    HeapWord* dest_addr = _chunk_dest[chunk];
+    for (size_t cur = beg; cur < end; ++cur) {
+      // The destination must be set even if the region has no data.
+      _sd.region(cur)->set_destination(dest_addr);
+      size_t words = _sd.region(cur)->data_size();
+      if (words > 0) {
+        _sd.summarize_region(*_split_info, cur, dest_addr, words);
+        dest_addr += words;
+      }
+    }
+    assert(dest_addr == _chunk_dest[chunk] + _chunk_words[chunk], "must be");
+  }
+
+public:
+  PCSummaryTask(ParallelCompactData& sd, SplitInfo* split_info,
+                size_t beg_region, size_t end_region,
+                size_t* chunk_words, HeapWord** chunk_dest) :
+    AbstractGangTask("PCSummaryTask"),
+    _sd(sd),
+    _split_info(split_info),
+    _beg_region(beg_region),
+    _end_region(end_region),
+    _chunk_words(chunk_words),
+    _chunk_dest(chunk_dest),
+    _mode(ComputeChunkSizes),
+    _claimed_chunk(0) {
+  }
+
+  void set_mode(Mode mode) {
+    _mode = mode;
+    _claimed_chunk = 0;
+  }
+
+  virtual void work(uint worker_id) {
+    const size_t n = num_chunks();
+    for (size_t chunk = Atomic::add((size_t)1, &_claimed_chunk) - 1;
+         chunk < n;
+         chunk = Atomic::add((size_t)1, &_claimed_chunk) - 1) {
+      const size_t beg = _beg_region + chunk * SummaryChunkRegions;
+      const size_t end = MIN2(beg + SummaryChunkRegions, _end_region);
+      switch (_mode) {
+        case ComputeChunkSizes:
+          compute_chunk_size(chunk, beg, end);
+          break;
+        case SummarizeChunks:
+          summarize_chunk(chunk, beg, end);
+          break;
+        case SummarizeDensePrefix:
+          for (size_t cur = beg; cur < end; ++cur) {
+            _sd.summarize_dense_prefix_region(cur);
+          }
+          break;
+        default:
+          ShouldNotReachHere();
+      }
+    }
+  }
+};
+
+static bool should_summarize_par(size_t beg_region, size_t end_region) {
+  return ParallelScavengeHeap::heap()->workers().active_workers() > 1 &&
+         end_region - beg_region >= 2 * SummaryChunkRegions;
+}
+
+void ParallelCompactData::summarize_dense_prefix_region(size_t region)
+{
+  HeapWord* addr = region_to_addr(region);
+  _region_data[region].set_destination(addr);
+  _region_data[region].set_destination_count(0);
+  _region_data[region].set_source_region(region);
+  _region_data[region].set_data_location(addr);
+
+  // Update live_obj_size so the region appears completely full.
+  size_t live_size = RegionSize - _region_data[region].partial_obj_size();
+  _region_data[region].set_live_obj_size(live_size);
+}
+
 void
 ParallelCompactData::summarize_dense_prefix(HeapWord* beg, HeapWord* end)
 {
@@ -561,19 +696,17 @@ ParallelCompactData::summarize_dense_prefix(HeapWord* beg, HeapWord* end)
 
   size_t cur_region = addr_to_region_idx(beg);
   const size_t end_region = addr_to_region_idx(end);
-  HeapWord* addr = beg;
-  while (cur_region < end_region) {
-    _region_data[cur_region].set_destination(addr);
-    _region_data[cur_region].set_destination_count(0);
-    _region_data[cur_region].set_source_region(cur_region);
-    _region_data[cur_region].set_data_location(addr);
 
-    // Update live_obj_size so the region appears completely full.
-    size_t live_size = RegionSize - _region_data[cur_region].partial_obj_size();
-    _region_data[cur_region].set_live_obj_size(live_size);
+  if (should_summarize_par(cur_region, end_region)) {
+    PCSummaryTask task(*this, NULL, cur_region, end_region, NULL, NULL);
+    task.set_mode(PCSummaryTask::SummarizeDensePrefix);
+    ParallelScavengeHeap::heap()->workers().run_task(&task);
+    return;
+  }
 
+  while (cur_region < end_region) {
+    summarize_dense_prefix_region(cur_region);
     ++cur_region;
-    addr += RegionSize;
   }
 }
 
@@ -700,6 +833,8 @@ bool ParallelCompactData::summarize(SplitInfo& split_info,
   const size_t end_region = addr_to_region_idx(region_align_up(source_end));
 
   HeapWord *dest_addr = target_beg;
+  cur_region = summarize_par(split_info, cur_region, end_region, target_end, &dest_addr);
+
   while (cur_region < end_region) {
     // The destination must be set even if the region has no data.
     _region_data[cur_region].set_destination(dest_addr);
@@ -716,51 +851,7 @@ bool ParallelCompactData::summarize(SplitInfo& split_info,
         return false;
       }
 
-      // Compute the destination_count for cur_region, and if necessary, update
-      // source_region for a destination region.  The source_region field is
-      // updated if cur_region is the first (left-most) region to be copied to a
-      // destination region.
-      //
-      // The destination_count calculation is a bit subtle.  A region that has
-      // data that compacts into itself does not count itself as a destination.
-      // This maintains the invariant that a zero count means the region is
-      // available and can be claimed and then filled.
-      uint destination_count = 0;
-      if (split_info.is_split(cur_region)) {
-        // The current region has been split:  the partial object will be copied
-        // to one destination space and the remaining data will be copied to
-        // another destination space.  Adjust the initial destination_count and,
-        // if necessary, set the source_region field if the partial object will
-        // cross a destination region boundary.
-        destination_count = split_info.destination_count();
-        if (destination_count == 2) {
-          size_t dest_idx = addr_to_region_idx(split_info.dest_region_addr());
-          _region_data[dest_idx].set_source_region(cur_region);
-        }
-      }
-
-      HeapWord* const last_addr = dest_addr + words - 1;
-      const size_t dest_region_1 = addr_to_region_idx(dest_addr);
-      const size_t dest_region_2 = addr_to_region_idx(last_addr);
-
-      // Initially assume that the destination regions will be the same and
-      // adjust the value below if necessary.  Under this assumption, if
-      // cur_region == dest_region_2, then cur_region will be compacted
-      // completely into itself.
-      destination_count += cur_region == dest_region_2 ? 0 : 1;
-      if (dest_region_1 != dest_region_2) {
-        // Destination regions differ; adjust destination_count.
-        destination_count += 1;
-        // Data from cur_region will be copied to the start of dest_region_2.
-        _region_data[dest_region_2].set_source_region(cur_region);
-      } else if (region_offset(dest_addr) == 0) {
-        // Data from cur_region will be copied to the start of the destination
-        // region.
-        _region_data[dest_region_1].set_source_region(cur_region);
-      }
-
-      _region_data[cur_region].set_destination_count(destination_count);
-      _region_data[cur_region].set_data_location(region_to_addr(cur_region));
+      summarize_region(split_info, cur_region, dest_addr, words);
       dest_addr += words;
     }
 
@@ -771,6 +862,105 @@ bool ParallelCompactData::summarize(SplitInfo& split_info,
   return true;
 }
 
+void ParallelCompactData::summarize_region(SplitInfo& split_info, size_t cur_region,
+                                           HeapWord* dest_addr, size_t words)
+{
+  // Compute the destination_count for cur_region, and if necessary, update
+  // source_region for a destination region.  The source_region field is
+  // updated if cur_region is the first (left-most) region to be copied to a
+  // destination region.
+  //
+  // The destination_count calculation is a bit subtle.  A region that has
+  // data that compacts into itself does not count itself as a destination.
+  // This maintains the invariant that a zero count means the region is
+  // available and can be claimed and then filled.
+  //
+  // Only the first word of a destination region determines its source_region,
+  // so when summarizing in parallel every source_region field is written by
+  // exactly one worker.
+  uint destination_count = 0;
+  if (split_info.is_split(cur_region)) {
+    // The current region has been split:  the partial object will be copied
+    // to one destination space and the remaining data will be copied to
+    // another destination space.  Adjust the initial destination_count and,
+    // if necessary, set the source_region field if the partial object will
+    // cross a destination region boundary.
+    destination_count = split_info.destination_count();
+    if (destination_count == 2) {
+      size_t dest_idx = addr_to_region_idx(split_info.dest_region_addr());
+      _region_data[dest_idx].set_source_region(cur_region);
+    }
+  }
+
+  HeapWord* const last_addr = dest_addr + words - 1;
+  const size_t dest_region_1 = addr_to_region_idx(dest_addr);
+  const size_t dest_region_2 = addr_to_region_idx(last_addr);
+
+  // Initially assume that the destination regions will be the same and
+  // adjust the value below if necessary.  Under this assumption, if
+  // cur_region == dest_region_2, then cur_region will be compacted
+  // completely into itself.
+  destination_count += cur_region == dest_region_2 ? 0 : 1;
+  if (dest_region_1 != dest_region_2) {
+    // Destination regions differ; adjust destination_count.
+    destination_count += 1;
+    // Data from cur_region will be copied to the start of dest_region_2.
+    _region_data[dest_region_2].set_source_region(cur_region);
+  } else if (region_offset(dest_addr) == 0) {
+    // Data from cur_region will be copied to the start of the destination
+    // region.
+    _region_data[dest_region_1].set_source_region(cur_region);
+  }
+
+  _region_data[cur_region].set_destination_count(destination_count);
+  _region_data[cur_region].set_data_location(region_to_addr(cur_region));
+}
+
+size_t ParallelCompactData::summarize_par(SplitInfo& split_info,
+                                          size_t beg_region, size_t end_region,
+                                          HeapWord* target_end, HeapWord** dest_addr)
+{
+  if (!should_summarize_par(beg_region, end_region)) {
+    return beg_region;
+  }
+
+  const size_t num_chunks = (end_region - beg_region + SummaryChunkRegions - 1) / SummaryChunkRegions;
+  size_t* chunk_words = NEW_C_HEAP_ARRAY(size_t, num_chunks, mtGC);
+  HeapWord** chunk_dest = NEW_C_HEAP_ARRAY(HeapWord*, num_chunks, mtGC);
+
+  WorkGang& workers = ParallelScavengeHeap::heap()->workers();
+  PCSummaryTask task(*this, &split_info, beg_region, end_region, chunk_words, chunk_dest);
+  workers.run_task(&task);
+
+  // Find the destination of every chunk and the chunks that fit completely
+  // into the target space.  The remaining regions are summarized serially by
+  // the caller, including splitting the source space.
+  HeapWord* cur_dest = *dest_addr;
+  size_t fitting_chunks = 0;
+  while (fitting_chunks < num_chunks &&
+         chunk_words[fitting_chunks] <= pointer_delta(target_end, cur_dest)) {
+    chunk_dest[fitting_chunks] = cur_dest;
+    cur_dest += chunk_words[fitting_chunks];
+    fitting_chunks++;
+  }
+
+  size_t result = beg_region;
+  if (fitting_chunks > 0) {
+    result = MIN2(beg_region + fitting_chunks * SummaryChunkRegions, end_region);
+    PCSummaryTask summarize_task(*this, &split_info, beg_region, result, chunk_words, chunk_dest);
+    summarize_task.set_mode(PCSummaryTask::SummarizeChunks);
+    workers.run_task(&summarize_task);
+    *dest_addr = cur_dest;
+  }
+
+  log_develop_trace(gc, compaction)("summarized regions [" SIZE_FORMAT ", " SIZE_FORMAT ") of [" SIZE_FORMAT ", " SIZE_FORMAT ") in parallel",
+                                    beg_region, result, beg_region, end_region);
+
+  FREE_C_HEAP_ARRAY(size_t, chunk_words);
+  FREE_C_HEAP_ARRAY(HeapWord*, chunk_dest);
+  return result;
+}
+
 HeapWord* ParallelCompactData::calc_new_pointer(HeapWord* addr, ParCompactionManager* cm) {
   assert(addr != NULL, "Should detect NULL oop earlier");
   assert(ParallelScavengeHeap::heap()->is_in(addr), "not in heap");
@@ -856,7 +1046,7 @@ void PSParallelCompact::post_initialize() {
                            ParallelGCThreads,   // mt discovery degree
                            true,                // atomic_discovery
                            &_is_alive_closure,  // non-header is alive closure
-                           false);              // disable adjusting number of processing threads
+                           true);               // allow changes to number of processing threads
   _counters = new CollectorCounters("PSParallelCompact", 1);
 
   // Initialize static fields in ParCompactionManager.
@@ -891,6 +1081,11 @@ bool PSParallelCompact::initialize() {
     return false;
   }
 
+  if (AlwaysPreTouch) {
+    _mark_bitmap.pretouch(&heap->workers());
+    _summary_data.pretouch(&heap->workers());
+  }
+
   return true;
 }
 
@@ -1766,6 +1961,7 @@ bool PSParallelCompact::invoke_no_policy(bool maximum_heap_compaction) {
     // Set the number of GC threads to be used in this collection
     gc_task_manager()->set_active_gang();
     gc_task_manager()->task_idle_workers();
+    heap->update_active_workers(gc_task_manager()->active_workers());
 
     GCTraceCPUTime tcpu;
     GCTraceTime(Info, gc) tm("Pause Full", NULL, gc_cause, true);
@@ -383,6 +383,9 @@ public:
 public:
   ParallelCompactData();
   bool initialize(MemRegion covered_region);
+  // Pre-touch the committed storage of the region and block data, for
+  // AlwaysPreTouch.
+  void pretouch(WorkGang* pretouch_gang);
 
   size_t region_count() const { return _region_count; }
   size_t reserved_byte_size() const { return _reserved_byte_size; }
@@ -402,6 +405,7 @@ public:
   // destination of region n is simply the start of region n.  The argument beg
   // must be region-aligned; end need not be.
   void summarize_dense_prefix(HeapWord* beg, HeapWord* end);
+  void summarize_dense_prefix_region(size_t region);
 
   HeapWord* summarize_split_space(size_t src_region, SplitInfo& split_info,
                                   HeapWord* destination, HeapWord* target_end,
@@ -412,6 +416,21 @@ public:
                  HeapWord* target_beg, HeapWord* target_end,
                  HeapWord** target_next);
 
+  // Set up the destination count and source region for the region cur_region
+  // holding words of live data that will be copied to dest_addr. The data
+  // must fit into the target space.
+  void summarize_region(SplitInfo& split_info, size_t cur_region,
+                        HeapWord* dest_addr, size_t words);
+
+  // Summarize the regions in [beg_region, end_region) in parallel using
+  // the heap's work gang, as long as they fit into the target space;
+  // dest_addr is updated accordingly.  Returns the first region that has
+  // not been summarized, which is beg_region if the range is too small to
+  // be worth the parallelization.
+  size_t summarize_par(SplitInfo& split_info,
+                       size_t beg_region, size_t end_region,
+                       HeapWord* target_end, HeapWord** dest_addr);
+
   void clear();
   void clear_range(size_t beg_region, size_t end_region);
   void clear_range(HeapWord* beg, HeapWord* end) {
@@ -951,7 +970,7 @@ class PSParallelCompact : AllStatic {
   };
 
   friend class AdjustPointerClosure;
-  friend class RefProcTaskProxy;
+  friend class RefProcTask;
   friend class PSParallelCompactTest;
 
  private:
@@ -133,6 +133,7 @@ bool PSPromotionManager::post_scavenge(YoungGCTracer& gc_tracer) {
     }
     manager->flush_labs();
   }
+  old_gen()->retire_numa_chunks();
   if (!promotion_failure_occurred) {
     // If there was no promotion failure, the preserved mark stacks
     // should be empty.
@@ -487,6 +488,11 @@ void ObjArrayKlass::oop_ps_push_contents(oop obj, PSPromotionManager* pm) {
   }
 }
 
+void PSPromotionManager::push_contents_bounded(oop obj, HeapWord* left, HeapWord* right) {
+  PushContentsClosure cl(this);
+  obj->oop_iterate(&cl, MemRegion(left, right));
+}
+
 void TypeArrayKlass::oop_ps_push_contents(oop obj, PSPromotionManager* pm) {
   assert(obj->is_typeArray(),"must be a type array");
   ShouldNotReachHere();
@@ -210,6 +210,8 @@ class PSPromotionManager {
   TASKQUEUE_STATS_ONLY(inline void record_steal(StarTask& p);)
 
   void push_contents(oop obj);
+  // Push the contents of obj that are located in [left, right).
+  void push_contents_bounded(oop obj, HeapWord* left, HeapWord* right);
 };
 
 #endif // SHARE_VM_GC_PARALLEL_PSPROMOTIONMANAGER_HPP
@@ -46,6 +46,7 @@
 #include "gc/shared/referenceProcessorPhaseTimes.hpp"
 #include "gc/shared/spaceDecorator.hpp"
 #include "gc/shared/weakProcessor.hpp"
+#include "gc/shared/workgroup.hpp"
 #include "memory/resourceArea.hpp"
 #include "logging/log.hpp"
 #include "oops/access.inline.hpp"
@@ -123,57 +124,80 @@ class PSEvacuateFollowersClosure: public VoidClosure {
   }
 };
 
-class PSRefProcTaskProxy: public GCTask {
+// Steal and process work from the other workers' depth-first queues until
+// all workers agree to terminate.
+static void steal_work(ParallelTaskTerminator& terminator, uint worker_id) {
+  assert(ParallelScavengeHeap::heap()->is_gc_active(), "called outside gc");
+
+  PSPromotionManager* pm =
+    PSPromotionManager::gc_thread_promotion_manager(worker_id);
+  pm->drain_stacks(true);
+  guarantee(pm->stacks_empty(),
+            "stacks should be empty at this point");
+
+  int random_seed = 17;
+  while (true) {
+    StarTask p;
+    if (PSPromotionManager::steal_depth(worker_id, &random_seed, p)) {
+      TASKQUEUE_STATS_ONLY(pm->record_steal(p));
+      pm->process_popped_location_depth(p);
+      pm->drain_stacks_depth(true);
+    } else {
+      if (terminator.offer_termination()) {
+        break;
+      }
+    }
+  }
+  guarantee(pm->stacks_empty(), "stacks should be empty at this point");
+}
+
+class PSRefProcTask : public AbstractGangTask {
   typedef AbstractRefProcTaskExecutor::ProcessTask ProcessTask;
-  ProcessTask & _rp_task;
-  uint          _work_id;
+  ParallelTaskTerminator& _terminator;
+  ProcessTask& _task;
+  uint _active_workers;
+
 public:
-  PSRefProcTaskProxy(ProcessTask & rp_task, uint work_id)
-    : _rp_task(rp_task),
-      _work_id(work_id)
-  { }
+  PSRefProcTask(ProcessTask& task, ParallelTaskTerminator& terminator, uint active_workers)
+    : AbstractGangTask("PSRefProcTask"),
+      _terminator(terminator),
+      _task(task),
+      _active_workers(active_workers) {
+  }
 
-private:
-  virtual char* name() { return (char *)"Process referents by policy in parallel"; }
-  virtual void do_it(GCTaskManager* manager, uint which);
+  virtual void work(uint worker_id) {
+    PSPromotionManager* promotion_manager =
+      PSPromotionManager::gc_thread_promotion_manager(worker_id);
+    assert(promotion_manager != NULL, "sanity check");
+    PSKeepAliveClosure keep_alive(promotion_manager);
+    PSEvacuateFollowersClosure evac_followers(promotion_manager);
+    PSIsAliveClosure is_alive;
+    _task.work(worker_id, is_alive, keep_alive, evac_followers);
+
+    if (_task.marks_oops_alive() && _active_workers > 1) {
+      steal_work(_terminator, worker_id);
+    }
+  }
 };
 
-void PSRefProcTaskProxy::do_it(GCTaskManager* manager, uint which)
-{
-  PSPromotionManager* promotion_manager =
-    PSPromotionManager::gc_thread_promotion_manager(which);
-  assert(promotion_manager != NULL, "sanity check");
-  PSKeepAliveClosure keep_alive(promotion_manager);
-  PSEvacuateFollowersClosure evac_followers(promotion_manager);
-  PSIsAliveClosure is_alive;
-  _rp_task.work(_work_id, is_alive, keep_alive, evac_followers);
-}
-
 class PSRefProcTaskExecutor: public AbstractRefProcTaskExecutor {
-  virtual void execute(ProcessTask& task, uint ergo_workers);
+  virtual void execute(ProcessTask& process_task, uint ergo_workers);
 };
 
-void PSRefProcTaskExecutor::execute(ProcessTask& task, uint ergo_workers)
-{
-  GCTaskQueue* q = GCTaskQueue::create();
-  GCTaskManager* manager = ParallelScavengeHeap::gc_task_manager();
-  uint active_workers = manager->active_workers();
+void PSRefProcTaskExecutor::execute(ProcessTask& process_task, uint ergo_workers) {
+  WorkGang& workers = ParallelScavengeHeap::heap()->workers();
+  uint active_workers = workers.active_workers();
 
-  assert(active_workers == ergo_workers,
-         "Ergonomically chosen workers (%u) must be equal to active workers (%u)",
+  // The reference processor may use fewer workers than are active
+  // when only a few references have been discovered.
+  assert(ergo_workers <= active_workers,
+         "Ergonomically chosen workers (%u) must be at most active workers (%u)",
          ergo_workers, active_workers);
 
-  for(uint i=0; i < active_workers; i++) {
-    q->enqueue(new PSRefProcTaskProxy(task, i));
-  }
-  ParallelTaskTerminator terminator(active_workers,
+  ParallelTaskTerminator terminator(ergo_workers,
                                     (TaskQueueSetSuper*) PSPromotionManager::stack_array_depth());
-  if (task.marks_oops_alive() && active_workers > 1) {
-    for (uint j = 0; j < active_workers; j++) {
-      q->enqueue(new StealTask(&terminator));
-    }
-  }
-  manager->execute_and_wait(q);
+  PSRefProcTask task(process_task, terminator, ergo_workers);
+  workers.run_task(&task, ergo_workers);
 }
 
 // This method contains all heap specific policy for invoking scavenge.
@@ -347,6 +371,7 @@ bool PSScavenge::invoke_no_policy() {
     // Get the active number of workers here and use that value
     // throughout the methods.
     uint active_workers = gc_task_manager()->active_workers();
+    heap->update_active_workers(active_workers);
 
     PSPromotionManager::pre_scavenge();
 
@@ -755,7 +780,7 @@ void PSScavenge::initialize() {
                            ParallelGCThreads,          // mt discovery degree
                            true,                       // atomic_discovery
                            NULL,                       // header provides liveness info
-                           false);
+                           true);                      // allow changes to number of processing threads
 
   // Cache the cardtable
   _card_table = heap->card_table();
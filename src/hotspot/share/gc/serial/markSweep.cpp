@@ -39,6 +39,10 @@
 #include "oops/objArrayKlass.inline.hpp"
 #include "oops/oop.inline.hpp"
 #include "oops/typeArrayOop.inline.hpp"
+#include "runtime/java.hpp"
+#include "runtime/os.hpp"
+#include "services/memTracker.hpp"
+#include "utilities/align.hpp"
 #include "utilities/macros.hpp"
 #include "utilities/stack.inline.hpp"
 
@@ -53,6 +57,10 @@ size_t                  MarkSweep::_preserved_count = 0;
 size_t                  MarkSweep::_preserved_count_max = 0;
 PreservedMark*          MarkSweep::_preserved_marks = NULL;
 ReferenceProcessor*     MarkSweep::_ref_processor   = NULL;
+bool                    MarkSweep::_use_mark_bitmap = false;
+HeapWord*               MarkSweep::_mark_bitmap_base = NULL;
+MemRegion               MarkSweep::_mark_bitmap_region;
+BitMapView              MarkSweep::_mark_bitmap;
 STWGCTimer*             MarkSweep::_gc_timer        = NULL;
 SerialOldTracer*        MarkSweep::_gc_tracer       = NULL;
 
@@ -81,7 +89,7 @@ inline void MarkSweep::follow_array(objArrayOop array) {
 }
 
 inline void MarkSweep::follow_object(oop obj) {
-  assert(obj->is_gc_marked(), "should be marked");
+  assert(is_object_marked(obj), "should be marked");
   if (obj->is_objArray()) {
     // Handle object arrays explicitly to allow them to
     // be split into chunks if needed.
@@ -110,7 +118,7 @@ void MarkSweep::follow_stack() {
   do {
     while (!_marking_stack.is_empty()) {
       oop obj = _marking_stack.pop();
-      assert (obj->is_gc_marked(), "p must be marked");
+      assert (is_object_marked(obj), "p must be marked");
       follow_object(obj);
     }
     // Process ObjArrays one at a time to avoid marking stack bloat.
@@ -131,7 +139,7 @@ template <class T> inline void MarkSweep::follow_root(T* p) {
   T heap_oop = RawAccess<>::oop_load(p);
   if (!CompressedOops::is_null(heap_oop)) {
     oop obj = CompressedOops::decode_not_null(heap_oop);
-    if (!obj->mark_raw()->is_marked()) {
+    if (!is_object_marked(obj)) {
       mark_object(obj);
       follow_object(obj);
     }
@@ -210,7 +218,7 @@ void MarkSweep::restore_marks() {
 
 MarkSweep::IsAliveClosure   MarkSweep::is_alive;
 
-bool MarkSweep::IsAliveClosure::do_object_b(oop p) { return p->is_gc_marked(); }
+bool MarkSweep::IsAliveClosure::do_object_b(oop p) { return is_object_marked(p); }
 
 MarkSweep::KeepAliveClosure MarkSweep::keep_alive;
 
@@ -220,4 +228,44 @@ void MarkSweep::KeepAliveClosure::do_oop(narrowOop* p) { MarkSweep::KeepAliveClo
 void MarkSweep::initialize() {
   MarkSweep::_gc_timer = new (ResourceObj::C_HEAP, mtGC) STWGCTimer();
   MarkSweep::_gc_tracer = new (ResourceObj::C_HEAP, mtGC) SerialOldTracer();
+
+  if (UseSerialGC && MarkSweepUseMarkBitMap) {
+    // One bit per possible object start in the heap. Only the reservation
+    // is made here, the bitmap is committed while collecting.
+    MemRegion heap = Universe::heap()->reserved_region();
+    size_t bitmap_bits = heap.word_size() >> LogMinObjAlignment;
+    size_t bitmap_bytes = align_up(align_up(bitmap_bits, BitsPerWord) / BitsPerByte, os::vm_page_size());
+    ReservedSpace bitmap_rs(bitmap_bytes, os::vm_page_size());
+    if (!bitmap_rs.is_reserved()) {
+      vm_exit_during_initialization("Could not reserve space for mark-sweep marking bitmap");
+    }
+    MemTracker::record_virtual_memory_type(bitmap_rs.base(), mtGC);
+    _mark_bitmap_base = heap.start();
+    _mark_bitmap_region = MemRegion((HeapWord*)bitmap_rs.base(), bitmap_rs.size() / HeapWordSize);
+    _mark_bitmap = BitMapView((BitMap::bm_word_t*)bitmap_rs.base(), bitmap_bits);
+  }
+}
+
+bool MarkSweep::commit_mark_bitmap() {
+  assert(!_use_mark_bitmap, "bitmap already in use");
+  if (_mark_bitmap_region.is_empty()) {
+    return false;
+  }
+  // Freshly committed memory is zeroed, no need to clear the bitmap.
+  if (!os::commit_memory((char*)_mark_bitmap_region.start(), _mark_bitmap_region.byte_size(), false)) {
+    log_warning(gc)("Could not commit native memory for marking bitmap, marking through object headers");
+    return false;
+  }
+  _use_mark_bitmap = true;
+  return true;
+}
+
+void MarkSweep::uncommit_mark_bitmap() {
+  if (!_use_mark_bitmap) {
+    return;
+  }
+  _use_mark_bitmap = false;
+  if (!os::uncommit_memory((char*)_mark_bitmap_region.start(), _mark_bitmap_region.byte_size())) {
+    log_warning(gc)("Could not uncommit native memory for marking bitmap");
+  }
 }
@@ -32,6 +32,7 @@
 #include "oops/markOop.hpp"
 #include "oops/oop.hpp"
 #include "runtime/timer.hpp"
+#include "utilities/bitMap.hpp"
 #include "utilities/growableArray.hpp"
 #include "utilities/stack.hpp"
 
@@ -109,6 +110,12 @@ class MarkSweep : AllStatic {
   // Reference processing (used in ...follow_contents)
   static ReferenceProcessor*             _ref_processor;
 
+  // Optional side marking bitmap, see MarkSweepUseMarkBitMap
+  static bool                            _use_mark_bitmap;
+  static HeapWord*                       _mark_bitmap_base;
+  static MemRegion                       _mark_bitmap_region;
+  static BitMapView                      _mark_bitmap;
+
   static STWGCTimer*                     _gc_timer;
   static SerialOldTracer*                _gc_tracer;
 
@@ -137,6 +144,17 @@ class MarkSweep : AllStatic {
   static STWGCTimer* gc_timer() { return _gc_timer; }
   static SerialOldTracer* gc_tracer() { return _gc_tracer; }
 
+  // Side marking bitmap, committed only for the duration of a collection.
+  // While it is in use, marking leaves the object headers intact.
+  static bool commit_mark_bitmap();
+  static void uncommit_mark_bitmap();
+  static bool use_mark_bitmap() { return _use_mark_bitmap; }
+
+  // Liveness as established by phase1
+  static inline bool is_object_marked(oop obj);
+  // Make a filler object inserted into dead space look live
+  static inline void mark_filler_object(oop obj);
+
   static void preserve_mark(oop p, markOop mark);
                                 // Save the mark word so it can be restored later
   static void adjust_marks();   // Adjust the pointers in the preserved marks table
@@ -158,6 +176,7 @@ class MarkSweep : AllStatic {
  private:
   // Call backs for marking
   static void mark_object(oop obj);
+  static inline BitMap::idx_t mark_bitmap_index(oop obj);
   // Mark pointer and follow contents.  Empty marking stack afterwards.
   template <class T> static inline void follow_root(T* p);
 
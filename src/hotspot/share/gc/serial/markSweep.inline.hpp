@@ -35,7 +35,32 @@
 #include "oops/oop.inline.hpp"
 #include "utilities/stack.inline.hpp"
 
+inline BitMap::idx_t MarkSweep::mark_bitmap_index(oop obj) {
+  return pointer_delta((HeapWord*)obj, _mark_bitmap_base) >> LogMinObjAlignment;
+}
+
+inline bool MarkSweep::is_object_marked(oop obj) {
+  if (_use_mark_bitmap) {
+    return _mark_bitmap.at(mark_bitmap_index(obj));
+  }
+  return obj->is_gc_marked();
+}
+
+inline void MarkSweep::mark_filler_object(oop obj) {
+  if (_use_mark_bitmap) {
+    _mark_bitmap.set_bit(mark_bitmap_index(obj));
+  } else {
+    obj->set_mark_raw(obj->mark_raw()->set_marked());
+  }
+}
+
 inline void MarkSweep::mark_object(oop obj) {
+  if (_use_mark_bitmap) {
+    // The mark is preserved later, and only if the object moves.
+    _mark_bitmap.set_bit(mark_bitmap_index(obj));
+    return;
+  }
+
   // some marks may contain information we need to preserve so we store them away
   // and overwrite the mark.  We'll restore it at the end of markSweep.
   markOop mark = obj->mark_raw();
@@ -50,7 +75,7 @@ template <class T> inline void MarkSweep::mark_and_push(T* p) {
   T heap_oop = RawAccess<>::oop_load(p);
   if (!CompressedOops::is_null(heap_oop)) {
     oop obj = CompressedOops::decode_not_null(heap_oop);
-    if (!obj->mark_raw()->is_marked()) {
+    if (!is_object_marked(obj)) {
       mark_object(obj);
       _marking_stack.push(obj);
     }
@@ -79,6 +104,15 @@ template <class T> inline void MarkSweep::adjust_pointer(T* p) {
     oop obj = CompressedOops::decode_not_null(heap_oop);
     assert(Universe::heap()->is_in(obj), "should be in heap");
 
+    if (_use_mark_bitmap) {
+      // Objects that do not move keep their original mark word, which
+      // must not be mistaken for a forwarding pointer.
+      if (obj->is_forwarded()) {
+        RawAccess<IS_NOT_NULL>::oop_store(p, obj->forwardee());
+      }
+      return;
+    }
+
     oop new_obj = oop(obj->mark_raw()->decode_pointer());
 
     assert(new_obj != NULL ||                         // is forwarding ptr?
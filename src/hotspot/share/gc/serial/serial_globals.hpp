@@ -38,6 +38,11 @@
                         lp64_product,                                       \
                         range,                                              \
                         constraint,                                         \
-                        writeable)
+                        writeable)                                          \
+                                                                            \
+  experimental(bool, MarkSweepUseMarkBitMap, false,                         \
+          "Mark live objects in a side bitmap during serial full GC "       \
+          "instead of in the object headers. Mark words are then only "     \
+          "preserved and overwritten for the objects that move.")
 
 #endif // SHARE_GC_SERIAL_SERIAL_GLOBALS_HPP
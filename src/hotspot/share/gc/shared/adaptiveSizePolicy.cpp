@@ -27,6 +27,7 @@
 #include "gc/shared/collectorPolicy.hpp"
 #include "gc/shared/gcCause.hpp"
 #include "gc/shared/gcUtil.inline.hpp"
+#include "gc/shared/gcWorkerAffinity.hpp"
 #include "gc/shared/softRefPolicy.hpp"
 #include "gc/shared/workgroup.hpp"
 #include "logging/log.hpp"
@@ -133,6 +134,11 @@ uint AdaptiveSizePolicy::calc_default_active_workers(uintx total_workers,
   uintx max_active_workers =
     MAX2(active_workers_by_JT, active_workers_by_heap_size);
 
+  // Do not use more workers than there are processors available to them,
+  // which may have shrunk since startup if the cpuset changed.
+  max_active_workers = MAX2(MIN2(max_active_workers, (uintx) GCWorkerAffinity::available_processors()),
+                            min_workers);
+
   new_active_workers = MIN2(max_active_workers, (uintx) total_workers);
 
   // Increase GC workers instantly but decrease them more
@@ -51,6 +51,7 @@ class GCTracer;
 class GCMemoryManager;
 class MemoryPool;
 class MetaspaceSummary;
+class ObjectClosure;
 class SoftRefPolicy;
 class Thread;
 class ThreadClosure;
@@ -66,6 +67,15 @@ class GCMessage : public FormatBuffer<1024> {
   GCMessage() {}
 };
 
+// An iterator over all objects in the heap, which can be shared by
+// several worker threads. Each worker calls object_iterate() with its
+// own worker id, and the objects are distributed between the workers.
+class ParallelObjectIterator : public CHeapObj<mtGC> {
+public:
+  virtual void object_iterate(ObjectClosure* cl, uint worker_id) = 0;
+  virtual ~ParallelObjectIterator() {}
+};
+
 class CollectedHeap;
 
 class GCHeapLog : public EventLogBase<GCMessage> {
@@ -438,6 +448,14 @@ class CollectedHeap : public CHeapObj<mtInternal> {
   // over live objects.
   virtual void safe_object_iterate(ObjectClosure* cl) = 0;
 
+  // Returns an iterator over live objects, to be used by up to thread_num
+  // workers from get_safepoint_workers() at a safepoint. Returns NULL if
+  // the heap does not support parallel iteration. The caller owns the
+  // returned iterator.
+  virtual ParallelObjectIterator* parallel_object_iterator(uint thread_num) {
+    return NULL;
+  }
+
   // NOTE! There is no requirement that a collector implement these
   // functions.
   //
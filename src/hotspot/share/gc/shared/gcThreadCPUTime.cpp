@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/shared/collectedHeap.hpp"
+#include "gc/shared/gcThreadCPUTime.hpp"
+#include "memory/iterator.hpp"
+#include "memory/universe.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/os.hpp"
+#include "runtime/thread.hpp"
+#include "utilities/ostream.hpp"
+
+GCThreadCPUTime::PhaseStats GCThreadCPUTime::_phases[GCThreadCPUTime::MaxPhases];
+
+class SumConcurrentGCThreadCPUTimeClosure : public ThreadClosure {
+  jlong _cpu_time;
+public:
+  SumConcurrentGCThreadCPUTimeClosure() : _cpu_time(0) {}
+
+  virtual void do_thread(Thread* thread) {
+    if (thread->is_ConcurrentGC_thread()) {
+      jlong cpu_time = os::thread_cpu_time(thread);
+      if (cpu_time > 0) {
+        _cpu_time += cpu_time;
+      }
+    }
+  }
+
+  jlong cpu_time() const { return _cpu_time; }
+};
+
+class PrintGCThreadCPUTimeClosure : public ThreadClosure {
+  outputStream* _st;
+public:
+  PrintGCThreadCPUTimeClosure(outputStream* st) : _st(st) {}
+
+  virtual void do_thread(Thread* thread) {
+    jlong cpu_time = os::thread_cpu_time(thread);
+    _st->print_cr("  %-32s %s %12.3fms", thread->name(),
+                  thread->is_ConcurrentGC_thread() ? "concurrent" : "parallel  ",
+                  cpu_time / (double)NANOSECS_PER_MILLISEC);
+  }
+};
+
+bool GCThreadCPUTime::is_supported() {
+  return os::is_thread_cpu_time_supported() && Universe::heap() != NULL;
+}
+
+void GCThreadCPUTime::gc_threads_do(ThreadClosure* tc) {
+  if (is_supported()) {
+    Universe::heap()->gc_threads_do(tc);
+  }
+}
+
+jlong GCThreadCPUTime::concurrent_threads_cpu_time() {
+  if (!is_supported()) {
+    return -1;
+  }
+  SumConcurrentGCThreadCPUTimeClosure cl;
+  gc_threads_do(&cl);
+  return cl.cpu_time();
+}
+
+GCThreadCPUTime::PhaseStats* GCThreadCPUTime::find_or_add(const char* name) {
+  for (uint i = 0; i < MaxPhases; i++) {
+    PhaseStats* stats = &_phases[i];
+    const char* stats_name = stats->_name;
+    if (stats_name == NULL) {
+      // Phase names are string literals, claim the slot for this one.
+      stats_name = Atomic::cmpxchg(name, &stats->_name, (const char*)NULL);
+      if (stats_name == NULL) {
+        return stats;
+      }
+    }
+    if (strcmp(stats_name, name) == 0) {
+      return stats;
+    }
+  }
+  return NULL;
+}
+
+void GCThreadCPUTime::record_concurrent_phase(const char* name, const Tickspan& wall_time, jlong cpu_time) {
+  PhaseStats* stats = find_or_add(name);
+  if (stats == NULL) {
+    // Out of slots, the phase is not accounted.
+    return;
+  }
+  Atomic::inc(&stats->_count);
+  Atomic::add((jlong)wall_time.nanoseconds(), &stats->_wall_time);
+  Atomic::add(cpu_time, &stats->_cpu_time);
+}
+
+void GCThreadCPUTime::print_on(outputStream* st) {
+  if (!is_supported()) {
+    st->print_cr("Thread CPU time is not supported on this platform.");
+    return;
+  }
+
+  st->print_cr("GC thread CPU time:");
+  PrintGCThreadCPUTimeClosure cl(st);
+  gc_threads_do(&cl);
+
+  st->print_cr("Concurrent phase CPU time:");
+  st->print_cr("  %-40s %8s %14s %14s", "Phase", "Count", "Wall", "CPU");
+  for (uint i = 0; i < MaxPhases; i++) {
+    PhaseStats* stats = &_phases[i];
+    if (stats->_name == NULL) {
+      break;
+    }
+    st->print_cr("  %-40s " SIZE_FORMAT_W(8) " %12.3fms %12.3fms",
+                 stats->_name, stats->_count,
+                 stats->_wall_time / (double)NANOSECS_PER_MILLISEC,
+                 stats->_cpu_time / (double)NANOSECS_PER_MILLISEC);
+  }
+}
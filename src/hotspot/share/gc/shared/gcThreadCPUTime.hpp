@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_GC_SHARED_GCTHREADCPUTIME_HPP
+#define SHARE_GC_SHARED_GCTHREADCPUTIME_HPP
+
+#include "memory/allocation.hpp"
+#include "utilities/ticks.hpp"
+
+class outputStream;
+class ThreadClosure;
+
+// CPU time accounting for GC threads. Concurrent GC phases registered with
+// a ConcurrentGCTimer are charged with the CPU time the concurrent GC threads
+// used while the phase was active. Concurrent threads that run independently
+// of the phase, e.g. G1 concurrent refinement, are included in that time.
+class GCThreadCPUTime : AllStatic {
+  struct PhaseStats {
+    const char* volatile _name;
+    volatile size_t      _count;
+    volatile jlong       _wall_time;
+    volatile jlong       _cpu_time;
+  };
+
+  static const uint MaxPhases = 64;
+  static PhaseStats _phases[MaxPhases];
+
+  static PhaseStats* find_or_add(const char* name);
+
+public:
+  static bool is_supported();
+
+  // Returns the sum of the CPU time in nanoseconds of all concurrent GC
+  // threads, or -1 if thread CPU time is not supported.
+  static jlong concurrent_threads_cpu_time();
+
+  static void record_concurrent_phase(const char* name, const Tickspan& wall_time, jlong cpu_time);
+
+  // Applies the closure to all GC threads of the heap.
+  static void gc_threads_do(ThreadClosure* tc);
+
+  // Prints the CPU time of every GC thread and the accumulated CPU time of
+  // every concurrent phase.
+  static void print_on(outputStream* st);
+};
+
+#endif // SHARE_GC_SHARED_GCTHREADCPUTIME_HPP
@@ -23,6 +23,7 @@
  */
 
 #include "precompiled.hpp"
+#include "gc/shared/gcThreadCPUTime.hpp"
 #include "gc/shared/gcTimer.hpp"
 #include "utilities/growableArray.hpp"
 
@@ -81,12 +82,21 @@ void ConcurrentGCTimer::register_gc_concurrent_start(const char* name, const Tic
   assert(!_is_concurrent_phase_active, "A concurrent phase is already active.");
   _time_partitions.report_gc_phase_start(name, time, GCPhase::ConcurrentPhaseType);
   _is_concurrent_phase_active = true;
+  _concurrent_phase_start_cpu_time = GCThreadCPUTime::concurrent_threads_cpu_time();
 }
 
 void ConcurrentGCTimer::register_gc_concurrent_end(const Ticks& time) {
   assert(_is_concurrent_phase_active, "A concurrent phase is not active.");
   _time_partitions.report_gc_phase_end(time, GCPhase::ConcurrentPhaseType);
   _is_concurrent_phase_active = false;
+
+  if (_concurrent_phase_start_cpu_time >= 0) {
+    // Concurrent phases do not nest, so the phase just ended is the last one.
+    GCPhase* phase = _time_partitions.phase_at(_time_partitions.num_phases() - 1);
+    jlong cpu_time = MAX2(GCThreadCPUTime::concurrent_threads_cpu_time() - _concurrent_phase_start_cpu_time, (jlong)0);
+    phase->set_cpu_time(cpu_time);
+    GCThreadCPUTime::record_concurrent_phase(phase->name(), phase->end() - phase->start(), cpu_time);
+  }
 }
 
 void PhasesStack::clear() {
@@ -138,6 +148,7 @@ void TimePartitions::report_gc_phase_start(const char* name, const Ticks& time,
   phase.set_level(level);
   phase.set_name(name);
   phase.set_start(time);
+  phase.set_cpu_time(-1);
 
   int index = _phases->append(phase);
 
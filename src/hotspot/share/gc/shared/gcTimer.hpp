@@ -53,6 +53,7 @@ class GCPhase {
   Ticks _start;
   Ticks _end;
   PhaseType _type;
+  jlong _cpu_time;
 
  public:
   void set_name(const char* name) { _name = name; }
@@ -70,6 +71,11 @@ class GCPhase {
   PhaseType type() const { return _type; }
   void set_type(PhaseType type) { _type = type; }
 
+  // CPU time of the concurrent GC threads during a concurrent phase, in
+  // nanoseconds, or -1 if not measured.
+  jlong cpu_time() const { return _cpu_time; }
+  void set_cpu_time(jlong cpu_time) { _cpu_time = cpu_time; }
+
   void accept(PhaseVisitor* visitor) {
     visitor->visit(this);
   }
@@ -162,9 +168,11 @@ class ConcurrentGCTimer : public GCTimer {
   // ConcurrentGCTimer can't be used if there is an overlap between a pause phase and a concurrent phase.
   // _is_concurrent_phase_active is used to find above case.
   bool _is_concurrent_phase_active;
+  // CPU time of the concurrent GC threads when the active concurrent phase started.
+  jlong _concurrent_phase_start_cpu_time;
 
  public:
-  ConcurrentGCTimer(): GCTimer(), _is_concurrent_phase_active(false) {};
+  ConcurrentGCTimer(): GCTimer(), _is_concurrent_phase_active(false), _concurrent_phase_start_cpu_time(-1) {};
 
   void register_gc_pause_start(const char* name, const Ticks& time = Ticks::now());
   void register_gc_pause_end(const Ticks& time = Ticks::now());
@@ -295,4 +295,19 @@ void G1OldTracer::set_gc_cause(GCCause::Cause cause) {
   _shared_gc_info.set_cause(cause);
 }
 
+void G1FullGCTracer::report_worker_statistics(const char* task_name,
+                                              uint worker_id,
+                                              double work_time_sec,
+                                              double termination_time_sec,
+                                              size_t stolen_tasks) const {
+  send_worker_statistics(task_name, worker_id, work_time_sec, termination_time_sec, stolen_tasks);
+}
+
+void G1FullGCTracer::report_region_compaction(uint region_index,
+                                              uint worker_id,
+                                              size_t live_bytes,
+                                              double live_ratio) const {
+  send_region_compaction(region_index, worker_id, live_bytes, live_ratio);
+}
+
 #endif // INCLUDE_G1GC
@@ -293,6 +293,27 @@ class G1NewTracer : public YoungGCTracer {
 class G1FullGCTracer : public OldGCTracer {
  public:
   G1FullGCTracer() : OldGCTracer(G1Full) {}
+
+  void report_worker_statistics(const char* task_name,
+                                uint worker_id,
+                                double work_time_sec,
+                                double termination_time_sec,
+                                size_t stolen_tasks) const;
+  void report_region_compaction(uint region_index,
+                                uint worker_id,
+                                size_t live_bytes,
+                                double live_ratio) const;
+
+ private:
+  void send_worker_statistics(const char* task_name,
+                              uint worker_id,
+                              double work_time_sec,
+                              double termination_time_sec,
+                              size_t stolen_tasks) const;
+  void send_region_compaction(uint region_index,
+                              uint worker_id,
+                              size_t live_bytes,
+                              double live_ratio) const;
 };
 
 #endif // INCLUDE_G1GC
@@ -309,6 +309,38 @@ void G1NewTracer::send_adaptive_ihop_statistics(size_t threshold,
   }
 }
 
+void G1FullGCTracer::send_worker_statistics(const char* task_name,
+                                            uint worker_id,
+                                            double work_time_sec,
+                                            double termination_time_sec,
+                                            size_t stolen_tasks) const {
+  EventG1FullGCWorkerStatistics evt;
+  if (evt.should_commit()) {
+    evt.set_gcId(GCId::current());
+    evt.set_name(task_name);
+    evt.set_workerId(worker_id);
+    evt.set_workTime((s8)(work_time_sec * NANOSECS_PER_SEC));
+    evt.set_terminationTime((s8)(termination_time_sec * NANOSECS_PER_SEC));
+    evt.set_stolenTasks(stolen_tasks);
+    evt.commit();
+  }
+}
+
+void G1FullGCTracer::send_region_compaction(uint region_index,
+                                            uint worker_id,
+                                            size_t live_bytes,
+                                            double live_ratio) const {
+  EventG1FullGCRegionCompaction evt;
+  if (evt.should_commit()) {
+    evt.set_gcId(GCId::current());
+    evt.set_index(region_index);
+    evt.set_workerId(worker_id);
+    evt.set_liveBytes(live_bytes);
+    evt.set_liveRatio(live_ratio);
+    evt.commit();
+  }
+}
+
 #endif // INCLUDE_G1GC
 
 static JfrStructVirtualSpace to_struct(const VirtualSpaceSummary& summary) {
@@ -435,12 +467,24 @@ class PhaseSender : public PhaseVisitor {
     assert(phase->level() < 1, "There is only one level for ConcurrentPhase");
 
     switch (phase->level()) {
-      case 0: send_phase<EventGCPhaseConcurrent>(phase); break;
+      case 0: send_concurrent_phase(phase); break;
       default: /* Ignore sending this phase */ break;
     }
   }
 
  public:
+  void send_concurrent_phase(GCPhase* phase) {
+    EventGCPhaseConcurrent event(UNTIMED);
+    if (event.should_commit()) {
+      event.set_gcId(GCId::current());
+      event.set_name(phase->name());
+      event.set_cpuTime(phase->cpu_time());
+      event.set_starttime(phase->start());
+      event.set_endtime(phase->end());
+      event.commit();
+    }
+  }
+
   template<typename T>
   void send_phase(GCPhase* phase) {
     T event(UNTIMED);
@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/shared/gcWorkerAffinity.hpp"
+#include "logging/log.hpp"
+#include "memory/allocation.inline.hpp"
+#include "runtime/globals.hpp"
+#include "runtime/java.hpp"
+#include "runtime/os.hpp"
+#include "runtime/thread.hpp"
+#include "utilities/bitMap.inline.hpp"
+#include "utilities/formatBuffer.hpp"
+
+CHeapBitMap*   GCWorkerAffinity::_processors = NULL;
+uint           GCWorkerAffinity::_listed_processors = 0;
+volatile uint  GCWorkerAffinity::_available_processors = 0;
+volatile jlong GCWorkerAffinity::_last_refresh_nanos = 0;
+
+// Accepts a comma separated list of processor ids and inclusive ranges of
+// processor ids, e.g. "0-3,8,10-11", in the format used by cpusets.
+bool GCWorkerAffinity::parse_processor_list(const char* list, CHeapBitMap* processors) {
+  const char* p = list;
+  if (*p == '\0') {
+    return false;
+  }
+  while (*p != '\0') {
+    char* end;
+    unsigned long first = strtoul(p, &end, 10);
+    if (end == p) {
+      return false;
+    }
+    unsigned long last = first;
+    p = end;
+    if (*p == '-') {
+      p++;
+      last = strtoul(p, &end, 10);
+      if (end == p || last < first) {
+        return false;
+      }
+      p = end;
+    }
+    if (last >= processors->size()) {
+      return false;
+    }
+    processors->set_range((BitMap::idx_t)first, (BitMap::idx_t)last + 1);
+    if (*p == ',') {
+      p++;
+      if (*p == '\0') {
+        return false;
+      }
+    } else if (*p != '\0') {
+      return false;
+    }
+  }
+  return true;
+}
+
+void GCWorkerAffinity::initialize() {
+  if (GCWorkerCPUList == NULL || *GCWorkerCPUList == '\0') {
+    return;
+  }
+
+  if (BindGCWorkersToNUMANodes) {
+    log_warning(gc, init)("BindGCWorkersToNUMANodes is ignored because GCWorkerCPUList is set");
+  }
+
+  CHeapBitMap* processors = new CHeapBitMap((BitMap::idx_t)os::processor_count(), mtGC);
+  if (!parse_processor_list(GCWorkerCPUList, processors)) {
+    vm_exit_during_initialization(
+      err_msg("Invalid GCWorkerCPUList \"%s\": expected a comma separated list of "
+              "processor ids or ranges below %d", GCWorkerCPUList, os::processor_count()));
+  }
+
+  _processors = processors;
+  _listed_processors = (uint)processors->count_one_bits();
+  log_info(gc, init)("GC Worker CPU List: %s (%u processors)", GCWorkerCPUList, _listed_processors);
+}
+
+// The NUMA topology is only known after os::init_2(), so it is looked up
+// by each worker when it starts instead of in initialize().
+void GCWorkerAffinity::bind_current_thread_to_numa_node(uint worker_id) {
+  size_t num_nodes = os::numa_get_groups_num();
+  if (num_nodes <= 1) {
+    return;
+  }
+  int* ids = NEW_C_HEAP_ARRAY(int, num_nodes, mtGC);
+  num_nodes = os::numa_get_leaf_groups(ids, num_nodes);
+  if (num_nodes > 1) {
+    int node = ids[worker_id % num_nodes];
+    CHeapBitMap processors((BitMap::idx_t)os::processor_count(), mtGC);
+    if (os::numa_get_group_processors(node, processors) && os::bind_to_processors(processors)) {
+      log_debug(gc, task, thread)("Bound %s to the processors of NUMA node %d", Thread::current()->name(), node);
+    } else {
+      log_warning(gc, task, thread)("Couldn't bind %s to the processors of NUMA node %d", Thread::current()->name(), node);
+    }
+  }
+  FREE_C_HEAP_ARRAY(int, ids);
+}
+
+void GCWorkerAffinity::bind_current_thread(uint worker_id) {
+  if (!is_enabled()) {
+    if (BindGCWorkersToNUMANodes && UseNUMA) {
+      bind_current_thread_to_numa_node(worker_id);
+    }
+    return;
+  }
+  if (os::bind_to_processors(*_processors)) {
+    log_debug(gc, task, thread)("Bound %s to GC worker processors", Thread::current()->name());
+  } else {
+    log_warning(gc, task, thread)("Couldn't bind %s to GC worker processors %s",
+                                  Thread::current()->name(), GCWorkerCPUList);
+  }
+}
+
+uint GCWorkerAffinity::available_processors() {
+  jlong now = os::javaTimeNanos();
+  uint available = _available_processors;
+  if (available == 0 || now - _last_refresh_nanos > RefreshIntervalNanos) {
+    available = (uint)MAX2(1, os::active_processor_count());
+    if (is_enabled()) {
+      available = MIN2(available, _listed_processors);
+    }
+    _available_processors = available;
+    _last_refresh_nanos = now;
+  }
+  return available;
+}
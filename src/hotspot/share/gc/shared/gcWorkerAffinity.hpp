@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_GC_SHARED_GCWORKERAFFINITY_HPP
+#define SHARE_GC_SHARED_GCWORKERAFFINITY_HPP
+
+#include "memory/allocation.hpp"
+
+class CHeapBitMap;
+
+// Binds GC worker threads to the processors given by GCWorkerCPUList, or
+// round-robin to the NUMA nodes with BindGCWorkersToNUMANodes, and limits
+// the number of active GC workers to the processors that are currently
+// available to them.
+class GCWorkerAffinity : AllStatic {
+  // Processors listed in GCWorkerCPUList, or NULL if workers are not bound.
+  static CHeapBitMap* _processors;
+  static uint _listed_processors;
+
+  // Cached result of available_processors(), refreshed at most once per
+  // RefreshIntervalNanos to avoid querying the OS and container on every GC.
+  static volatile uint _available_processors;
+  static volatile jlong _last_refresh_nanos;
+  static const jlong RefreshIntervalNanos = NANOSECS_PER_SEC;
+
+  static bool parse_processor_list(const char* list, CHeapBitMap* processors);
+  static void bind_current_thread_to_numa_node(uint worker_id);
+
+public:
+  // Parses GCWorkerCPUList; exits the VM if it is malformed.
+  static void initialize();
+
+  static bool is_enabled() { return _processors != NULL; }
+
+  // Binds the calling GC worker thread to the listed processors, or to
+  // the processors of NUMA node worker_id modulo the number of nodes.
+  static void bind_current_thread(uint worker_id);
+
+  // Returns the number of processors GC workers can currently run on: the
+  // active processor count, which accounts for cpusets and container
+  // limits, capped by the size of GCWorkerCPUList.
+  static uint available_processors();
+};
+
+#endif // SHARE_GC_SHARED_GCWORKERAFFINITY_HPP
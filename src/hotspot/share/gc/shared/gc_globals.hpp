@@ -693,6 +693,18 @@
   product(bool, UseGCTaskAffinity, false,                                   \
           "Use worker affinity when asking for GCTasks")                    \
                                                                             \
+  product(ccstr, GCWorkerCPUList, NULL,                                     \
+          "Comma separated list of processors and processor ranges, "       \
+          "e.g. 0-3,8, that GC worker threads are bound to. Also limits "   \
+          "the number of active GC workers with "                           \
+          "UseDynamicNumberOfGCThreads")                                    \
+                                                                            \
+  product(bool, BindGCWorkersToNUMANodes, false,                            \
+          "With UseNUMA, bind GC worker threads round-robin to the "        \
+          "processors of the NUMA nodes, so that each worker allocates "    \
+          "from and works on node-local memory. Ignored if "                \
+          "GCWorkerCPUList is set")                                         \
+                                                                            \
   product(bool, PrintGC, false,                                             \
           "Print message at garbage collection. "                           \
           "Deprecated, use -Xlog:gc instead.")                              \
@@ -35,6 +35,7 @@
 #include "runtime/sharedRuntime.hpp"
 #include "runtime/handles.inline.hpp"
 #include "runtime/thread.inline.hpp"
+#include "services/allocationProfiler.hpp"
 #include "services/lowMemoryDetector.hpp"
 #include "utilities/align.hpp"
 #include "utilities/copy.hpp"
@@ -212,7 +213,7 @@ void MemAllocator::Allocation::notify_allocation_jvmti_sampler() {
          _thread->heap_sampler().sampling_collector_present(),
          "Sampling collector not present.");
 
-  if (JvmtiExport::should_post_sampled_object_alloc()) {
+  if (JvmtiExport::should_post_sampled_object_alloc() || AllocationProfiler::is_enabled()) {
     // If we want to be sampling, protect the allocated object with a Handle
     // before doing the callback. The callback is done in the destructor of
     // the JvmtiSampledObjectAllocEventCollector.
@@ -382,6 +383,20 @@ oop MemAllocator::allocate() const {
   return obj;
 }
 
+HeapWord* MemAllocator::allocate_span_in_tlab(Thread* thread, size_t word_size) {
+  if (!UseTLAB || DTraceAllocProbes || JvmtiExport::should_post_vm_object_alloc()) {
+    return NULL;
+  }
+
+  CHECK_UNHANDLED_OOPS_ONLY(thread->clear_unhandled_oops();)
+  assert(!thread->has_pending_exception(), "Should not allocate with exception pending");
+  assert(!Universe::heap()->is_gc_active(), "Allocation during gc not allowed");
+
+  // A sample point of the heap sampler bounds the TLAB end, so spans reaching
+  // past it fail here and the objects take the regular, sampled path.
+  return thread->tlab().allocate(word_size);
+}
+
 void MemAllocator::mem_clear(HeapWord* mem) const {
   assert(mem != NULL, "cannot initialize NULL object");
   const size_t hs = oopDesc::header_size();
@@ -76,6 +76,14 @@ protected:
 public:
   oop allocate() const;
   virtual oop initialize(HeapWord* mem) const = 0;
+
+  // Allocates word_size words for several objects at once from the current
+  // TLAB of the thread, without refilling it. The caller must initialize
+  // every object in the span, using initialize() of an allocator for each
+  // object, before it can reach a safepoint. Returns NULL if the span does
+  // not fit, or if every allocation must be reported individually, e.g. to
+  // JVMTI or DTrace; the objects should then be allocated one by one.
+  static HeapWord* allocate_span_in_tlab(Thread* thread, size_t word_size);
 };
 
 class ObjAllocator: public MemAllocator {
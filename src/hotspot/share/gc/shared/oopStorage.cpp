@@ -313,6 +313,18 @@ oop* OopStorage::Block::allocate() {
   }
 }
 
+// Take all the available entries, returning the bitmask of the newly
+// allocated entries.  Must be called with the _allocation_mutex held.
+uintx OopStorage::Block::allocate_all() {
+  uintx new_allocated = ~allocated_bitmask();
+  assert(new_allocated != 0, "attempt to allocate from full block");
+  // Atomic update because release may change bitmask outside of lock.
+  // Releases only clear bits that are set in the old value, so adding the
+  // complement sets exactly the remaining zero bits, without any carries.
+  Atomic::add(new_allocated, &_allocated_bitmask);
+  return new_allocated;
+}
+
 OopStorage::Block* OopStorage::Block::new_block(const OopStorage* owner) {
   // _data must be first member: aligning block => aligning _data.
   STATIC_ASSERT(_data_pos == 0);
@@ -386,6 +398,11 @@ OopStorage::Block::block_for_ptr(const OopStorage* owner, const oop* ptr) {
 // removed from the _allocation_list so it won't be considered by future
 // allocations until some entries in it are released.
 //
+// The bulk allocate(ptrs, size) takes all the available entries of that
+// block at once, and always removes the block from the _allocation_list.
+// Entries beyond the requested number are released after dropping the
+// lock, using the ordinary release protocol described below.
+//
 // release() is performed lock-free. release() first looks up the block for
 // the entry, using address alignment to find the enclosing block (thereby
 // avoiding iteration over the _active_array).  Once the block has been
@@ -407,8 +424,10 @@ OopStorage::Block::block_for_ptr(const OopStorage* owner, const oop* ptr) {
 // full.  The block is moved to the end of the _allocation_list if the bitmask
 // is empty, for ease of empty block deletion processing.
 
-oop* OopStorage::allocate() {
-  MutexLockerEx ml(_allocation_mutex, Mutex::_no_safepoint_check_flag);
+// Return a block with available entries, adding a new block to the storage
+// if needed.  Returns NULL if memory allocation failed.
+OopStorage::Block* OopStorage::block_for_allocation() {
+  assert_lock_strong(_allocation_mutex);
   // Do some deferred update processing every time we allocate.
   // Continue processing deferred updates if _allocation_list is empty,
   // in the hope that we'll get a block from that, rather than
@@ -455,9 +474,18 @@ oop* OopStorage::allocate() {
     }
     block = _allocation_list.head();
   }
-  // Allocate from first block.
   assert(block != NULL, "invariant");
   assert(!block->is_full(), "invariant");
+  return block;
+}
+
+oop* OopStorage::allocate() {
+  MutexLockerEx ml(_allocation_mutex, Mutex::_no_safepoint_check_flag);
+  Block* block = block_for_allocation();
+  if (block == NULL) {
+    return NULL;                // Block allocation failed.
+  }
+  // Allocate from first block.
   if (block->is_empty()) {
     // Transitioning from empty to not empty.
     log_debug(oopstorage, blocks)("%s: block not empty " PTR_FORMAT, name(), p2i(block));
@@ -476,6 +504,57 @@ oop* OopStorage::allocate() {
   return result;
 }
 
+static size_t entry_count(uintx bitmask) {
+  size_t count = 0;
+  for ( ; bitmask != 0; bitmask &= bitmask - 1) {
+    ++count;
+  }
+  return count;
+}
+
+size_t OopStorage::allocate(oop** ptrs, size_t size) {
+  assert(size > 0, "precondition");
+  Block* block;
+  uintx taken;
+  {
+    MutexLockerEx ml(_allocation_mutex, Mutex::_no_safepoint_check_flag);
+    block = block_for_allocation();
+    if (block == NULL) {
+      return 0;                 // Block allocation failed.
+    }
+    if (block->is_empty()) {
+      log_debug(oopstorage, blocks)("%s: block not empty " PTR_FORMAT, name(), p2i(block));
+    }
+    // Take all the available entries, leaving the block full.  Remove it
+    // from consideration by future allocates, any entries we don't use
+    // are released below, outside the lock.
+    taken = block->allocate_all();
+    log_debug(oopstorage, blocks)("%s: block full " PTR_FORMAT, name(), p2i(block));
+    _allocation_list.unlink(*block);
+  }
+  // Drop the lock, now that we've taken all available entries from block.
+  size_t num_taken = entry_count(taken);
+  Atomic::add(num_taken, &_allocation_count);
+  // Fill ptrs from those taken entries.
+  size_t limit = MIN2(num_taken, size);
+  for (size_t i = 0; i < limit; ++i) {
+    assert(taken != 0, "invariant");
+    unsigned index = count_trailing_zeros(taken);
+    taken ^= block->bitmask_for_index(index);
+    ptrs[i] = block->get_pointer(index);
+  }
+  // If more entries taken than requested, release the remainder.
+  if (taken != 0) {
+    assert(size == limit, "invariant");
+    assert(num_taken == (limit + entry_count(taken)), "invariant");
+    block->release_entries(taken, &_deferred_updates);
+    Atomic::sub(num_taken - limit, &_allocation_count);
+  }
+  log_info(oopstorage, ref)("%s: bulk allocate " SIZE_FORMAT ", returned " SIZE_FORMAT,
+                            name(), limit, num_taken - limit);
+  return limit;                 // Return number allocated.
+}
+
 // Create a new, larger, active array with the same content as the
 // current array, and then replace, relinquishing the old array.
 // Return true if the array was successfully expanded, false to
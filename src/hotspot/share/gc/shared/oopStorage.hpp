@@ -104,6 +104,17 @@ public:
   // postcondition: *result == NULL.
   oop* allocate();
 
+  // Allocates multiple entries, returning them in the ptrs buffer.  Possibly
+  // faster than making repeated calls to allocate(), as the lock is only
+  // taken once.  Always make maximal requests for best efficiency.  Returns
+  // the number of entries allocated, which may be less than requested, or
+  // zero if memory allocation failed.  Locks _allocation_mutex.
+  // precondition: size > 0.
+  // postcondition: result <= size.
+  // postcondition: ptrs[i] is an allocated entry for i in [0, result).
+  // postcondition: *ptrs[i] == NULL for i in [0, result).
+  size_t allocate(oop** ptrs, size_t size);
+
   // Deallocates ptr.  No locking.
   // precondition: ptr is a valid allocated entry.
   // precondition: *ptr == NULL.
@@ -222,6 +233,7 @@ private:
   // mutable because this gets set even for const iteration.
   mutable bool _concurrent_iteration_active;
 
+  Block* block_for_allocation();
   Block* find_block_or_null(const oop* ptr) const;
   void delete_empty_block(const Block& block);
   bool reduce_deferred_updates();
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/shared/pretouchTask.hpp"
+#include "logging/log.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/globals.hpp"
+#include "runtime/os.hpp"
+#include "utilities/align.hpp"
+
+PretouchTask::PretouchTask(const char* task_name,
+                           char* start_address,
+                           char* end_address,
+                           size_t page_size,
+                           size_t chunk_size) :
+    AbstractGangTask(task_name),
+    _cur_addr(start_address),
+    _start_addr(start_address),
+    _end_addr(end_address),
+    _page_size(page_size),
+    _chunk_size(chunk_size) {
+
+  assert(chunk_size >= page_size,
+         "Chunk size " SIZE_FORMAT " is smaller than page size " SIZE_FORMAT,
+         chunk_size, page_size);
+}
+
+size_t PretouchTask::chunk_size() {
+  return PreTouchParallelChunkSize;
+}
+
+void PretouchTask::work(uint worker_id) {
+  while (true) {
+    char* touch_addr = Atomic::add(_chunk_size, &_cur_addr) - _chunk_size;
+    if (touch_addr < _start_addr || touch_addr >= _end_addr) {
+      break;
+    }
+
+    char* end_addr = touch_addr + MIN2(_chunk_size, pointer_delta(_end_addr, touch_addr, sizeof(char)));
+
+    os::pretouch_memory(touch_addr, end_addr, _page_size);
+  }
+}
+
+size_t PretouchTask::touch_page_size(size_t page_size) {
+#ifdef LINUX
+  if (UseTransparentHugePages) {
+    return MAX2(page_size, os::large_page_size());
+  }
+#endif
+  return page_size;
+}
+
+void PretouchTask::pretouch(const char* task_name, char* start_address, char* end_address,
+                            size_t page_size, WorkGang* pretouch_gang) {
+  if (start_address >= end_address) {
+    return;
+  }
+
+  page_size = touch_page_size(page_size);
+  // Chunks are multiples of the page size so that workers never touch the
+  // same page.
+  size_t chunk_size = align_up(MAX2(PretouchTask::chunk_size(), page_size), page_size);
+
+  PretouchTask task(task_name, start_address, end_address, page_size, chunk_size);
+  size_t total_bytes = pointer_delta(end_address, start_address, sizeof(char));
+
+  if (pretouch_gang != NULL) {
+    size_t num_chunks = (total_bytes + chunk_size - 1) / chunk_size;
+
+    uint num_workers = (uint)MIN2(num_chunks, (size_t)pretouch_gang->total_workers());
+    log_debug(gc, heap)("Running %s with %u workers for " SIZE_FORMAT " work units pre-touching " SIZE_FORMAT "B.",
+                        task.name(), num_workers, num_chunks, total_bytes);
+
+    pretouch_gang->run_task(&task, num_workers);
+  } else {
+    log_debug(gc, heap)("Running %s pre-touching " SIZE_FORMAT "B.",
+                        task.name(), total_bytes);
+    task.work(0);
+  }
+}
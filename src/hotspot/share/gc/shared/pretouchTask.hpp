@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_GC_SHARED_PRETOUCHTASK_HPP
+#define SHARE_GC_SHARED_PRETOUCHTASK_HPP
+
+#include "gc/shared/workgroup.hpp"
+
+// Touches a range of memory in chunks of PreTouchParallelChunkSize, claimed
+// by the workers in parallel, so that the OS backs it with physical pages.
+class PretouchTask : public AbstractGangTask {
+  char* volatile _cur_addr;
+  char* const _start_addr;
+  char* const _end_addr;
+  size_t _page_size;
+  size_t _chunk_size;
+
+public:
+  PretouchTask(const char* task_name, char* start_address, char* end_address, size_t page_size, size_t chunk_size);
+
+  virtual void work(uint worker_id);
+
+  static size_t chunk_size();
+
+  // Returns the stride to touch memory committed with the given page size.
+  // With transparent huge pages the first touch of a huge page in an advised
+  // mapping faults in the whole huge page, so touching every small page of
+  // it is wasted work.
+  static size_t touch_page_size(size_t page_size);
+
+  // Touches [start_address, end_address) using the pretouch_gang when it is
+  // not NULL, or the current thread otherwise.
+  static void pretouch(const char* task_name, char* start_address, char* end_address,
+                       size_t page_size, WorkGang* pretouch_gang);
+};
+
+#endif // SHARE_GC_SHARED_PRETOUCHTASK_HPP
@@ -387,9 +387,18 @@ HeapWord* CompactibleSpace::forward(oop q, size_t size,
 
   // store the forwarding pointer into the mark word
   if ((HeapWord*)q != compact_top) {
+#if INCLUDE_SERIALGC
+    if (MarkSweep::use_mark_bitmap()) {
+      // Marking left the mark word intact, save it before it is overwritten.
+      markOop mark = q->mark_raw();
+      if (mark->must_be_preserved(q)) {
+        MarkSweep::preserve_mark(q, mark);
+      }
+    }
+#endif // INCLUDE_SERIALGC
     q->forward_to(oop(compact_top));
     assert(q->is_gc_marked(), "encoding the pointer should preserve the mark");
-  } else {
+  } else if (!SERIALGC_ONLY(MarkSweep::use_mark_bitmap()) NOT_SERIALGC(false)) {
     // if the object isn't moving we can just set the mark to the default
     // mark and handle it specially later on.
     q->init_mark_raw();
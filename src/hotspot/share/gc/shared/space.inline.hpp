@@ -118,7 +118,7 @@ public:
       _allowed_deadspace_words -= dead_length;
       CollectedHeap::fill_with_object(dead_start, dead_length);
       oop obj = oop(dead_start);
-      obj->set_mark_raw(obj->mark_raw()->set_marked());
+      MarkSweep::mark_filler_object(obj);
 
       assert(dead_length == (size_t)obj->size(), "bad filler object size");
       log_develop_trace(gc, compaction)("Inserting object to dead space: " PTR_FORMAT ", " PTR_FORMAT ", " SIZE_FORMAT "b",
@@ -164,11 +164,11 @@ inline void CompactibleSpace::scan_and_forward(SpaceType* space, CompactPoint* c
   HeapWord* scan_limit = space->scan_limit();
 
   while (cur_obj < scan_limit) {
-    assert(!space->scanned_block_is_obj(cur_obj) ||
+    assert(!space->scanned_block_is_obj(cur_obj) || MarkSweep::use_mark_bitmap() ||
            oop(cur_obj)->mark_raw()->is_marked() || oop(cur_obj)->mark_raw()->is_unlocked() ||
            oop(cur_obj)->mark_raw()->has_bias_pattern(),
            "these are the only valid states during a mark sweep");
-    if (space->scanned_block_is_obj(cur_obj) && oop(cur_obj)->is_gc_marked()) {
+    if (space->scanned_block_is_obj(cur_obj) && MarkSweep::is_object_marked(oop(cur_obj))) {
       // prefetch beyond cur_obj
       Prefetch::write(cur_obj, interval);
       size_t size = space->scanned_block_size(cur_obj);
@@ -182,7 +182,7 @@ inline void CompactibleSpace::scan_and_forward(SpaceType* space, CompactPoint* c
         // prefetch beyond end
         Prefetch::write(end, interval);
         end += space->scanned_block_size(end);
-      } while (end < scan_limit && (!space->scanned_block_is_obj(end) || !oop(end)->is_gc_marked()));
+      } while (end < scan_limit && (!space->scanned_block_is_obj(end) || !MarkSweep::is_object_marked(oop(end))));
 
       // see if we might want to pretend this object is alive so that
       // we don't have to compact quite as often.
@@ -235,7 +235,7 @@ inline void CompactibleSpace::scan_and_adjust_pointers(SpaceType* space) {
   debug_only(HeapWord* prev_obj = NULL);
   while (cur_obj < end_of_live) {
     Prefetch::write(cur_obj, interval);
-    if (cur_obj < first_dead || oop(cur_obj)->is_gc_marked()) {
+    if (cur_obj < first_dead || MarkSweep::is_object_marked(oop(cur_obj))) {
       // cur_obj is alive
       // point all the oops to the new location
       size_t size = MarkSweep::adjust_pointers(oop(cur_obj));
@@ -131,6 +131,9 @@ public:
   virtual void add(const StringDedupStat* const stat);
   virtual void print_statistics(bool total) const;
 
+  // Reports the statistics of the last cycle to JFR.
+  void send_event() const;
+
   static void print_start(const StringDedupStat* last_stat);
   static void print_end(const StringDedupStat* last_stat, const StringDedupStat* total_stat);
 };
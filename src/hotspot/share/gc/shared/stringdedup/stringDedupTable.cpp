@@ -34,6 +34,7 @@
 #include "oops/arrayOop.inline.hpp"
 #include "oops/oop.inline.hpp"
 #include "oops/typeArrayOop.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "runtime/safepointVerifiers.hpp"
 
@@ -269,6 +270,23 @@ void StringDedupTable::transfer(StringDedupEntry** pentry, StringDedupTable* des
   *list = entry;
 }
 
+void StringDedupTable::transfer_par(StringDedupEntry** pentry, StringDedupTable* dest) {
+  StringDedupEntry* entry = *pentry;
+  *pentry = entry->next();
+  unsigned int hash = entry->hash();
+  size_t index = dest->hash_to_index(hash);
+  StringDedupEntry* volatile* list = dest->bucket(index);
+  StringDedupEntry* head = *list;
+  for (;;) {
+    entry->set_next(head);
+    StringDedupEntry* prev = Atomic::cmpxchg(entry, list, head);
+    if (prev == head) {
+      return;
+    }
+    head = prev;
+  }
+}
+
 bool StringDedupTable::equals(typeArrayOop value1, typeArrayOop value2) {
   return (oopDesc::equals(value1, value2) ||
           (value1->length() == value2->length() &&
@@ -512,19 +530,20 @@ uintx StringDedupTable::unlink_or_oops_do(StringDedupUnlinkOrOopsDoClosure* cl,
           _table->transfer(entry, _resized_table);
         } else {
           if (is_rehashing()) {
-            // We are rehashing the table, rehash the entry but keep it
-            // in the table. We can't transfer entries into the new table
-            // at this point since we don't have exclusive access to all
-            // destination partitions. finish_rehash() will do a single
-            // threaded transfer of all entries.
+            // We are rehashing the table, rehash the entry and transfer it
+            // to the new table. We don't have exclusive access to the
+            // destination partitions, so the transfer is done atomically.
+            // This keeps finish_rehash() from having to do a single threaded
+            // transfer of all entries at the end of the pause.
             typeArrayOop value = (typeArrayOop)*p;
             bool latin1 = (*entry)->latin1();
             unsigned int hash = hash_code(value, latin1);
             (*entry)->set_hash(hash);
+            _table->transfer_par(entry, _rehashed_table);
+          } else {
+            // Move to next entry
+            entry = (*entry)->next_addr();
           }
-
-          // Move to next entry
-          entry = (*entry)->next_addr();
         }
       } else {
         // Not alive, remove entry from table
@@ -583,7 +602,7 @@ StringDedupTable* StringDedupTable::prepare_rehash() {
 void StringDedupTable::finish_rehash(StringDedupTable* rehashed_table) {
   assert(rehashed_table != NULL, "Invalid table");
 
-  // Move all newly rehashed entries into the correct buckets in the new table
+  // Move any entries not already transferred by the workers into the new table
   for (size_t bucket = 0; bucket < _table->_size; bucket++) {
     StringDedupEntry** entry = _table->bucket(bucket);
     while (*entry != NULL) {
@@ -109,7 +109,10 @@ public:
 // safepoints in which case GC workers are allowed to access a table partitions they
 // have claimed without first acquiring the lock. Note however, that this applies only
 // the table partition (i.e. a range of elements in _buckets), not other parts of the
-// table such as the _entries field, statistics counters, etc.
+// table such as the _entries field, statistics counters, etc. When rehashing, the
+// workers move the entries of their claimed partitions into the new table using
+// atomic updates of the destination buckets, so no serial pass over the whole
+// table is needed at the end of the pause.
 //
 class StringDedupTable : public CHeapObj<mtGC> {
 private:
@@ -175,6 +178,11 @@ private:
   // Transfers a table entry from the current table to the destination table.
   void transfer(StringDedupEntry** pentry, StringDedupTable* dest);
 
+  // Transfers a table entry from the current table to the destination table,
+  // using an atomic update of the destination bucket. Used when the caller
+  // does not have exclusive access to the destination bucket.
+  void transfer_par(StringDedupEntry** pentry, StringDedupTable* dest);
+
   // Returns an existing character array in the given hash bucket, or NULL
   // if no matching character array exists.
   typeArrayOop lookup(typeArrayOop value, bool latin1, unsigned int hash,
@@ -227,7 +235,7 @@ private:
   // hashtable and updates the hash seed.
   static StringDedupTable* prepare_rehash();
 
-  // Transfers rehashed entries from the currently active table into
+  // Transfers any remaining entries from the currently active table into
   // the new table. Installs the new table as the currently active table
   // and deletes the previously active table.
   static void finish_rehash(StringDedupTable* rehashed_table);
@@ -72,6 +72,7 @@ void StringDedupThreadImpl<S>::do_deduplication() {
       }
 
       stat.mark_done();
+      stat.send_event();
 
       total_stat.add(&stat);
       print_end(&stat, &total_stat);
@@ -27,9 +27,11 @@
 #include "oops/oop.inline.hpp"
 #include "logging/log.hpp"
 #include "runtime/atomic.hpp"
+#include "runtime/java.hpp"
 #include "runtime/os.hpp"
 #include "runtime/thread.inline.hpp"
 #include "utilities/debug.hpp"
+#include "utilities/formatBuffer.hpp"
 #include "utilities/stack.inline.hpp"
 
 #ifdef TRACESPINNING
@@ -259,8 +261,26 @@ bool ObjArrayTask::is_valid() const {
   return _obj != NULL && _obj->is_objArray() && _index >= 0 &&
       _index < objArrayOop(_obj)->length();
 }
+
+bool ObjArrayChunkedTask::is_valid() const {
+  return obj() != NULL && (is_not_chunked() || obj()->is_objArray());
+}
 #endif // ASSERT
 
+#if OPTIMIZED_OBJARRAY_CHUNKED_TASK
+void ObjArrayChunkedTask::check_addressable(const char* gc_name, void* heap_start, void* heap_end) {
+  // The optimized ObjArrayChunkedTask takes some bits away from the full object bits.
+  // Fail if we ever attempt to address more than we can.
+  if ((uintptr_t)heap_end >= max_addressable()) {
+    FormatBuffer<512> buf("%s reserved [" PTR_FORMAT ", " PTR_FORMAT") for the heap, \n"
+                          "but max object address is " PTR_FORMAT ". Try to reduce heap size, or try other \n"
+                          "VM options that allocate heap at lower addresses (HeapBaseMinAddress, AllocateHeapAt, etc).",
+                gc_name, p2i(heap_start), p2i(heap_end), max_addressable());
+    vm_exit_during_initialization("Fatal Error", buf);
+  }
+}
+#endif // OPTIMIZED_OBJARRAY_CHUNKED_TASK
+
 void ParallelTaskTerminator::reset_for_reuse(uint n_threads) {
   reset_for_reuse();
   _n_threads = n_threads;
@@ -579,10 +579,234 @@ private:
   int _index;
 };
 
+
+// ObjArrayChunkedTask
+//
+// Encodes both regular oops, and the array oops plus chunking data for parallel array processing.
+// The design goal is to make the regular oop ops very fast, because that would be the prevailing
+// case. On the other hand, it should not block parallel array processing from efficiently dividing
+// the array work.
+//
+// The idea is to steal the bits from the 64-bit oop to encode array data, if needed. For the
+// proper divide-and-conquer strategies, we want to encode the "blocking" data. It turns out, the
+// most efficient way to do this is to encode the array block as (chunk * 2^pow), where it is assumed
+// that the block has the size of 2^pow. This requires for pow to have only 5 bits (2^32) to encode
+// all possible arrays.
+//
+//    |---------oop---------|-pow-|--chunk---|
+//    0                    49     54        64
+//
+// By definition, chunk == 0 means "no chunk", i.e. chunking starts from 1.
+//
+// This encoding gives a few interesting benefits:
+//
+// a) Encoding/decoding regular oops is very simple, because the upper bits are zero in that task:
+//
+//    |---------oop---------|00000|0000000000| // no chunk data
+//
+//    This helps the most ubiquitous path. The initialization amounts to putting the oop into the word
+//    with zero padding. Testing for "chunkedness" is testing for zero with chunk mask.
+//
+// b) Splitting tasks for divide-and-conquer is possible. Suppose we have chunk <C, P> that covers
+// interval [ (C-1)*2^P; C*2^P ). We can then split it into two chunks:
+//      <2*C - 1, P-1>, that covers interval [ (2*C - 2)*2^(P-1); (2*C - 1)*2^(P-1) )
+//      <2*C, P-1>,     that covers interval [ (2*C - 1)*2^(P-1);       2*C*2^(P-1) )
+//
+//    Observe that the union of these two intervals is:
+//      [ (2*C - 2)*2^(P-1); 2*C*2^(P-1) )
+//
+//    ...which is the original interval:
+//      [ (C-1)*2^P; C*2^P )
+//
+// c) The divide-and-conquer strategy could even start with chunk <1, round-log2-len(arr)>, and split
+//    down in the parallel threads, which alleviates the upfront (serial) splitting costs.
+//
+// Encoding limitations caused by current bitscales mean:
+//    10 bits for chunk: max 1024 blocks per array
+//     5 bits for power: max 2^32 array
+//    49 bits for   oop: max 512 TB of addressable space
+//
+// Stealing bits from oop trims down the addressable space. Stealing too few bits for chunk ID limits
+// potential parallelism. Stealing too few bits for pow limits the maximum array size that can be handled.
+// In future, these might be rebalanced to favor one degree of freedom against another. For example,
+// if/when Arrays 2.0 bring 2^64-sized arrays, we might need to steal another bit for power. We could regain
+// some bits back if chunks are counted in ObjArrayMarkingStride units.
+//
+// Collectors using the optimized version must make sure the heap is reserved below
+// max_addressable(), see ObjArrayChunkedTask::check_addressable().
+//
+// There is also a fallback version that uses plain fields, when we don't have enough space to steal the
+// bits from the native pointer. It is useful to debug the optimized version.
+//
+
+#ifdef _LP64
+#define OPTIMIZED_OBJARRAY_CHUNKED_TASK 1
+#else
+#define OPTIMIZED_OBJARRAY_CHUNKED_TASK 0
+#endif
+
+#if OPTIMIZED_OBJARRAY_CHUNKED_TASK
+class ObjArrayChunkedTask
+{
+public:
+  enum {
+    chunk_bits   = 10,
+    pow_bits     = 5,
+    oop_bits     = sizeof(uintptr_t)*8 - chunk_bits - pow_bits
+  };
+  enum {
+    oop_shift    = 0,
+    pow_shift    = oop_shift + oop_bits,
+    chunk_shift  = pow_shift + pow_bits
+  };
+
+public:
+  ObjArrayChunkedTask(oop o = NULL) {
+    assert(decode_oop(encode_oop(o)) == o, "oop can be encoded: " PTR_FORMAT, p2i(o));
+    _obj = encode_oop(o);
+  }
+  ObjArrayChunkedTask(oop o, int chunk, int pow) {
+    assert(decode_oop(encode_oop(o)) == o, "oop can be encoded: " PTR_FORMAT, p2i(o));
+    assert(decode_chunk(encode_chunk(chunk)) == chunk, "chunk can be encoded: %d", chunk);
+    assert(decode_pow(encode_pow(pow)) == pow, "pow can be encoded: %d", pow);
+    _obj = encode_oop(o) | encode_chunk(chunk) | encode_pow(pow);
+  }
+  ObjArrayChunkedTask(const ObjArrayChunkedTask& t): _obj(t._obj) { }
+
+  ObjArrayChunkedTask& operator =(const ObjArrayChunkedTask& t) {
+    _obj = t._obj;
+    return *this;
+  }
+  volatile ObjArrayChunkedTask&
+  operator =(const volatile ObjArrayChunkedTask& t) volatile {
+    (void)const_cast<uintptr_t&>(_obj = t._obj);
+    return *this;
+  }
+
+  inline oop decode_oop(uintptr_t val) const {
+    return (oop) reinterpret_cast<void*>((val >> oop_shift) & right_n_bits(oop_bits));
+  }
+
+  inline int decode_chunk(uintptr_t val) const {
+    return (int) ((val >> chunk_shift) & right_n_bits(chunk_bits));
+  }
+
+  inline int decode_pow(uintptr_t val) const {
+    return (int) ((val >> pow_shift) & right_n_bits(pow_bits));
+  }
+
+  inline uintptr_t encode_oop(oop obj) const {
+    return ((uintptr_t)(void*) obj) << oop_shift;
+  }
+
+  inline uintptr_t encode_chunk(int chunk) const {
+    return ((uintptr_t) chunk) << chunk_shift;
+  }
+
+  inline uintptr_t encode_pow(int pow) const {
+    return ((uintptr_t) pow) << pow_shift;
+  }
+
+  inline oop obj()   const { return decode_oop(_obj);   }
+  inline int chunk() const { return decode_chunk(_obj); }
+  inline int pow()   const { return decode_pow(_obj);   }
+  inline bool is_not_chunked() const { return (_obj & ~right_n_bits(oop_bits + pow_bits)) == 0; }
+
+  DEBUG_ONLY(bool is_valid() const); // Tasks to be pushed/popped must be valid.
+
+  static uintptr_t max_addressable() {
+    return nth_bit(oop_bits);
+  }
+
+  // Exits the VM during initialization if the reserved heap ends above
+  // max_addressable().
+  static void check_addressable(const char* gc_name, void* heap_start, void* heap_end);
+
+  static int chunk_size() {
+    return nth_bit(chunk_bits);
+  }
+
+private:
+  uintptr_t _obj;
+};
+#else
+class ObjArrayChunkedTask
+{
+public:
+  enum {
+    chunk_bits  = 10,
+    pow_bits    = 5
+  };
+public:
+  ObjArrayChunkedTask(oop o = NULL, int chunk = 0, int pow = 0): _obj(o) {
+    assert(0 <= chunk && chunk < nth_bit(chunk_bits), "chunk is sane: %d", chunk);
+    assert(0 <= pow && pow < nth_bit(pow_bits), "pow is sane: %d", pow);
+    _chunk = chunk;
+    _pow = pow;
+  }
+  ObjArrayChunkedTask(const ObjArrayChunkedTask& t): _obj(t._obj), _chunk(t._chunk), _pow(t._pow) { }
+
+  ObjArrayChunkedTask& operator =(const ObjArrayChunkedTask& t) {
+    _obj = t._obj;
+    _chunk = t._chunk;
+    _pow = t._pow;
+    return *this;
+  }
+  volatile ObjArrayChunkedTask&
+  operator =(const volatile ObjArrayChunkedTask& t) volatile {
+    (void)const_cast<oop&>(_obj = t._obj);
+    _chunk = t._chunk;
+    _pow = t._pow;
+    return *this;
+  }
+
+  inline oop obj()   const { return _obj; }
+  inline int chunk() const { return _chunk; }
+  inline int pow()  const { return _pow; }
+
+  inline bool is_not_chunked() const { return _chunk == 0; }
+
+  DEBUG_ONLY(bool is_valid() const); // Tasks to be pushed/popped must be valid.
+
+  static size_t max_addressable() {
+    return sizeof(oop);
+  }
+
+  static void check_addressable(const char* gc_name, void* heap_start, void* heap_end) {}
+
+  static int chunk_size() {
+    return nth_bit(chunk_bits);
+  }
+
+private:
+  oop _obj;
+  int _chunk;
+  int _pow;
+};
+#endif // OPTIMIZED_OBJARRAY_CHUNKED_TASK
+
 #ifdef _MSC_VER
 #pragma warning(pop)
 #endif
 
+// Divide-and-conquer splitting of object arrays into ObjArrayChunkedTasks,
+// shared by the parallel markers. Only full chunks are pushed, so the task
+// processing never needs to check boundaries against the array length.
+// The queue must not fail pushes, e.g. an OverflowTaskQueue.
+class ObjArrayChunker : public AllStatic {
+public:
+  // Pushes the chunks covering the head of a newly discovered array, and
+  // returns the start of the irregular tail that the caller must process,
+  // which is the whole array if it is no longer than a few strides.
+  template <class Q>
+  static inline int push_initial_chunks(Q* q, objArrayOop array);
+
+  // Pushes the left halves of the given chunk until it is down to the
+  // marking stride, and returns the range of the remainder to process.
+  template <class Q>
+  static inline void split_chunk(Q* q, objArrayOop array, int chunk, int pow, int* from, int* to);
+};
+
 typedef OverflowTaskQueue<StarTask, mtGC>           OopStarTaskQueue;
 typedef GenericTaskQueueSet<OopStarTaskQueue, mtGC> OopStarTaskQueueSet;
 
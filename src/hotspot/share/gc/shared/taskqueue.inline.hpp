@@ -27,6 +27,7 @@
 
 #include "gc/shared/taskqueue.hpp"
 #include "memory/allocation.inline.hpp"
+#include "oops/objArrayOop.hpp"
 #include "oops/oop.inline.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/orderAccess.hpp"
@@ -283,4 +284,82 @@ inline void GenericTaskQueue<E, F, N>::iterate(Fn fn) {
 }
 
 
+template <class Q>
+inline int ObjArrayChunker::push_initial_chunks(Q* q, objArrayOop array) {
+  int len = array->length();
+
+  if (len <= (int) ObjArrayMarkingStride*2) {
+    // A few slices only, process directly
+    return 0;
+  }
+
+  int bits = log2_long(len);
+  // Compensate for non-power-of-two arrays, cover the array in excess:
+  if (len != (1 << bits)) bits++;
+
+  // To only have full chunks on the queue, we cut the prefix in full-sized
+  // chunks, and submit them on the queue. If the array is not divided in
+  // chunk sizes, then there would be an irregular tail, returned to the caller.
+
+  int last_idx = 0;
+
+  int chunk = 1;
+  int pow = bits;
+
+  // Handle overflow
+  if (pow >= 31) {
+    assert (pow == 31, "sanity");
+    pow--;
+    chunk = 2;
+    last_idx = (1 << pow);
+    bool pushed = q->push(ObjArrayChunkedTask(array, 1, pow));
+    assert(pushed, "overflow queue should always succeed pushing");
+  }
+
+  // Split out tasks, as suggested in ObjArrayChunkedTask docs. Record the last
+  // successful right boundary to figure out the irregular tail.
+  while ((1 << pow) > (int)ObjArrayMarkingStride &&
+         (chunk*2 < ObjArrayChunkedTask::chunk_size())) {
+    pow--;
+    int left_chunk = chunk*2 - 1;
+    int right_chunk = chunk*2;
+    int left_chunk_end = left_chunk * (1 << pow);
+    if (left_chunk_end < len) {
+      bool pushed = q->push(ObjArrayChunkedTask(array, left_chunk, pow));
+      assert(pushed, "overflow queue should always succeed pushing");
+      chunk = right_chunk;
+      last_idx = left_chunk_end;
+    } else {
+      chunk = left_chunk;
+    }
+  }
+
+  return last_idx;
+}
+
+template <class Q>
+inline void ObjArrayChunker::split_chunk(Q* q, objArrayOop array, int chunk, int pow, int* from, int* to) {
+  assert (ObjArrayMarkingStride > 0, "sanity");
+
+  // Split out tasks, as suggested in ObjArrayChunkedTask docs. Avoid pushing tasks that
+  // are known to start beyond the array.
+  while ((1 << pow) > (int)ObjArrayMarkingStride && (chunk*2 < ObjArrayChunkedTask::chunk_size())) {
+    pow--;
+    chunk *= 2;
+    bool pushed = q->push(ObjArrayChunkedTask(array, chunk - 1, pow));
+    assert(pushed, "overflow queue should always succeed pushing");
+  }
+
+  int chunk_size = 1 << pow;
+
+  *from = (chunk - 1) * chunk_size;
+  *to = chunk * chunk_size;
+
+#ifdef ASSERT
+  int len = array->length();
+  assert (0 <= *from && *from < len, "from is sane: %d/%d", *from, len);
+  assert (0 < *to && *to <= len, "to is sane: %d/%d", *to, len);
+#endif
+}
+
 #endif // SHARE_VM_GC_SHARED_TASKQUEUE_INLINE_HPP
@@ -24,6 +24,8 @@
 
 #include "precompiled.hpp"
 #include "gc/shared/threadLocalAllocBuffer.inline.hpp"
+#include "jfr/jfrEvents.hpp"
+#include "jfr/support/jfrThreadId.hpp"
 #include "logging/log.hpp"
 #include "memory/resourceArea.hpp"
 #include "memory/universe.hpp"
@@ -80,22 +82,39 @@ void ThreadLocalAllocBuffer::accumulate_statistics() {
 
   print_stats("gc");
 
+  // Update allocation history if a reasonable amount of eden was allocated.
+  // Threads that did not refill their tlab since the last GC are sampled
+  // too, so that the per-thread average decays and the next resize shrinks
+  // the tlab of threads that have become idle instead of keeping the size
+  // from their last busy period.
+  bool update_allocation_history = used > 0.5 * capacity;
+
+  if (update_allocation_history) {
+    // Average the fraction of eden allocated in a tlab by this
+    // thread for use in the next resize operation.
+    // _gc_waste is not subtracted because it's included in
+    // "used".
+    // The result can be larger than 1.0 due to direct to old allocations.
+    // These allocations should ideally not be counted but since it is not possible
+    // to filter them out here we just cap the fraction to be at most 1.0.
+    // Keep alloc_frac as float and not double to avoid the double to float conversion
+    float alloc_frac = MIN2(1.0f, allocated_since_last_gc / (float) used);
+    _allocation_fraction.sample(alloc_frac);
+  }
+
   if (_number_of_refills > 0) {
-    // Update allocation history if a reasonable amount of eden was allocated.
-    bool update_allocation_history = used > 0.5 * capacity;
-
-    if (update_allocation_history) {
-      // Average the fraction of eden allocated in a tlab by this
-      // thread for use in the next resize operation.
-      // _gc_waste is not subtracted because it's included in
-      // "used".
-      // The result can be larger than 1.0 due to direct to old allocations.
-      // These allocations should ideally not be counted but since it is not possible
-      // to filter them out here we just cap the fraction to be at most 1.0.
-      // Keep alloc_frac as float and not double to avoid the double to float conversion
-      float alloc_frac = MIN2(1.0f, allocated_since_last_gc / (float) used);
-      _allocation_fraction.sample(alloc_frac);
+    EventThreadTLABStatistics event;
+    if (event.should_commit()) {
+      event.set_thread(JFR_THREAD_ID(thread));
+      event.set_refills(_number_of_refills);
+      event.set_allocated((u8)_allocated_size * HeapWordSize);
+      event.set_gcWaste((u8)_gc_waste * HeapWordSize);
+      event.set_slowRefillWaste((u8)_slow_refill_waste * HeapWordSize);
+      event.set_fastRefillWaste((u8)_fast_refill_waste * HeapWordSize);
+      event.set_desiredSize((u8)desired_size() * HeapWordSize);
+      event.commit();
     }
+
     global_stats()->update_allocating_threads();
     global_stats()->update_number_of_refills(_number_of_refills);
     global_stats()->update_allocation(_allocated_size);
@@ -24,6 +24,7 @@
 
 #include "precompiled.hpp"
 #include "gc/shared/gcId.hpp"
+#include "gc/shared/gcWorkerAffinity.hpp"
 #include "gc/shared/workgroup.hpp"
 #include "gc/shared/workerManager.hpp"
 #include "memory/allocation.hpp"
@@ -299,6 +300,7 @@ void AbstractGangWorker::initialize() {
   this->initialize_named_thread();
   assert(_gang != NULL, "No gang to run in");
   os::set_priority(this, NearMaxPriority);
+  GCWorkerAffinity::bind_current_thread(id());
   log_develop_trace(gc, workgang)("Running gang worker for gang %s id %u", gang()->name(), id());
   // The VM thread should not execute here because MutexLocker's are used
   // as (opposed to MutexLockerEx's).
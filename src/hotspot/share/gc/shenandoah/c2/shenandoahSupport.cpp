@@ -567,6 +567,8 @@ void ShenandoahBarrierC2Support::verify(RootNode* root) {
         { { 2, ShenandoahLoad },                  { 3, ShenandoahStore } },
         Op_HasNegatives,
         { { 2, ShenandoahLoad },                  { -1, ShenandoahNone} },
+        Op_StrHashCode,
+        { { 2, ShenandoahLoad },                  { -1, ShenandoahNone} },
         Op_CastP2X,
         { { 1, ShenandoahLoad },                  { -1, ShenandoahNone} },
         Op_StrIndexOfChar,
@@ -3282,6 +3284,7 @@ bool ShenandoahLoadReferenceBarrierNode::is_redundant() {
       case Op_StrIndexOf:
       case Op_StrIndexOfChar:
       case Op_HasNegatives:
+      case Op_StrHashCode:
         // Known to require barriers
         return false;
       case Op_CmpP: {
@@ -32,6 +32,52 @@
 #include "logging/logTag.hpp"
 #include "utilities/quickSort.hpp"
 
+ShenandoahAllocationRate::ShenandoahAllocationRate() :
+  _last_sample_time(os::elapsedTime()),
+  _last_sample_value(0),
+  _interval_sec(1.0 / ShenandoahAdaptiveSampleFrequencyHz),
+  _rate((int)(ShenandoahAdaptiveSampleSizeSeconds * ShenandoahAdaptiveSampleFrequencyHz)) {
+}
+
+void ShenandoahAllocationRate::allocation_counter_reset() {
+  _last_sample_time = os::elapsedTime();
+  _last_sample_value = 0;
+}
+
+double ShenandoahAllocationRate::sample(size_t allocated) {
+  double now = os::elapsedTime();
+  double rate = 0.0;
+  if (now - _last_sample_time > _interval_sec) {
+    if (allocated >= _last_sample_value) {
+      rate = instantaneous_rate(now, allocated);
+      _rate.add(rate);
+    }
+    _last_sample_time = now;
+    _last_sample_value = allocated;
+  }
+  return rate;
+}
+
+bool ShenandoahAllocationRate::is_spiking(double rate, double threshold) const {
+  if (rate <= 0.0 || _rate.num() < 2) {
+    return false;
+  }
+  double sd = _rate.sd();
+  if (sd > 0) {
+    double z_score = (rate - _rate.avg()) / sd;
+    if (z_score > threshold) {
+      return true;
+    }
+  }
+  return false;
+}
+
+double ShenandoahAllocationRate::instantaneous_rate(double time, size_t allocated) const {
+  size_t allocation_delta = (allocated > _last_sample_value) ? (allocated - _last_sample_value) : 0;
+  double time_delta_sec = time - _last_sample_time;
+  return (time_delta_sec > 0) ? (allocation_delta / time_delta_sec) : 0;
+}
+
 ShenandoahAdaptiveHeuristics::ShenandoahAdaptiveHeuristics() :
   ShenandoahHeuristics() {}
 
@@ -97,6 +143,7 @@ void ShenandoahAdaptiveHeuristics::choose_collection_set_from_regiondata(Shenand
 
 void ShenandoahAdaptiveHeuristics::record_cycle_start() {
   ShenandoahHeuristics::record_cycle_start();
+  _allocation_rate.allocation_counter_reset();
 }
 
 bool ShenandoahAdaptiveHeuristics::should_start_gc() const {
@@ -104,6 +151,10 @@ bool ShenandoahAdaptiveHeuristics::should_start_gc() const {
   size_t capacity = heap->max_capacity();
   size_t available = heap->free_set()->available();
 
+  // Keep sampling even when one of the triggers below fires, so that the
+  // rate history is not biased towards quiet periods.
+  double instant_rate = _allocation_rate.sample(heap->bytes_allocated_since_gc_start());
+
   // Check if we are falling below the worst limit, time to trigger the GC, regardless of
   // anything else.
   size_t min_threshold = capacity / 100 * ShenandoahMinFreeThreshold;
@@ -111,6 +162,7 @@ bool ShenandoahAdaptiveHeuristics::should_start_gc() const {
     log_info(gc)("Trigger: Free (" SIZE_FORMAT "%s) is below minimum threshold (" SIZE_FORMAT "%s)",
                  byte_size_in_proper_unit(available),     proper_unit_for_byte_size(available),
                  byte_size_in_proper_unit(min_threshold), proper_unit_for_byte_size(min_threshold));
+    report_trigger("Minimum Free Threshold", available, 0);
     return true;
   }
 
@@ -123,6 +175,7 @@ bool ShenandoahAdaptiveHeuristics::should_start_gc() const {
                    _gc_times_learned + 1, max_learn,
                    byte_size_in_proper_unit(available),      proper_unit_for_byte_size(available),
                    byte_size_in_proper_unit(init_threshold), proper_unit_for_byte_size(init_threshold));
+      report_trigger("Learning", available, 0);
       return true;
     }
   }
@@ -139,8 +192,6 @@ bool ShenandoahAdaptiveHeuristics::should_start_gc() const {
   allocation_headroom -= MIN2(allocation_headroom, spike_headroom);
   allocation_headroom -= MIN2(allocation_headroom, penalties);
 
-  // TODO: Allocation rate is way too averaged to be useful during state changes
-
   double average_gc = _gc_time_history->avg();
   double time_since_last = time_since_last_gc();
   double allocation_rate = heap->bytes_allocated_since_gc_start() / time_since_last;
@@ -155,6 +206,20 @@ bool ShenandoahAdaptiveHeuristics::should_start_gc() const {
                  byte_size_in_proper_unit(spike_headroom),      proper_unit_for_byte_size(spike_headroom),
                  byte_size_in_proper_unit(penalties),           proper_unit_for_byte_size(penalties),
                  byte_size_in_proper_unit(allocation_headroom), proper_unit_for_byte_size(allocation_headroom));
+    report_trigger("Average Allocation Rate", allocation_headroom, allocation_rate);
+    return true;
+  }
+
+  // The average above smooths over the whole time since the last cycle, and reacts
+  // too late to bursts. Check the most recent sample as well, if it stands out.
+  if (_allocation_rate.is_spiking(instant_rate, ShenandoahAdaptiveSpikeThreshold) &&
+      average_gc > allocation_headroom / instant_rate) {
+    log_info(gc)("Trigger: Average GC time (%.2f ms) is above the time for instantaneous allocation rate (%.0f %sB/s) to deplete free headroom (" SIZE_FORMAT "%s) (spike threshold = %.2f)",
+                 average_gc * 1000,
+                 byte_size_in_proper_unit(instant_rate),        proper_unit_for_byte_size(instant_rate),
+                 byte_size_in_proper_unit(allocation_headroom), proper_unit_for_byte_size(allocation_headroom),
+                 ShenandoahAdaptiveSpikeThreshold);
+    report_trigger("Allocation Spike", allocation_headroom, instant_rate);
     return true;
   }
 
@@ -28,7 +28,36 @@
 #include "gc/shenandoah/shenandoahPhaseTimings.hpp"
 #include "utilities/numberSeq.hpp"
 
+// Samples the allocation rate at ShenandoahAdaptiveSampleFrequencyHz and
+// keeps a moving window of the samples, so that a sudden increase against
+// the recent history can be told apart from the steady state rate.
+class ShenandoahAllocationRate : public CHeapObj<mtGC> {
+public:
+  ShenandoahAllocationRate();
+
+  void allocation_counter_reset();
+
+  // Returns the rate for the interval that ended now, or 0 if the
+  // sampling interval has not elapsed yet.
+  double sample(size_t allocated);
+
+  bool is_spiking(double rate, double threshold) const;
+
+private:
+  double instantaneous_rate(double time, size_t allocated) const;
+
+  double _last_sample_time;
+  size_t _last_sample_value;
+  double _interval_sec;
+  TruncatedSeq _rate;
+};
+
 class ShenandoahAdaptiveHeuristics : public ShenandoahHeuristics {
+private:
+  // Sampled from should_start_gc(), which the control thread calls
+  // every control interval.
+  mutable ShenandoahAllocationRate _allocation_rate;
+
 public:
   ShenandoahAdaptiveHeuristics();
 
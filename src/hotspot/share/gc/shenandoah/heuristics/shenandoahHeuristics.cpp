@@ -26,10 +26,12 @@
 #include "gc/shared/gcCause.hpp"
 #include "gc/shenandoah/shenandoahCollectionSet.inline.hpp"
 #include "gc/shenandoah/shenandoahCollectorPolicy.hpp"
+#include "gc/shenandoah/shenandoahFreeSet.hpp"
 #include "gc/shenandoah/shenandoahHeap.inline.hpp"
 #include "gc/shenandoah/shenandoahHeapRegion.inline.hpp"
 #include "gc/shenandoah/shenandoahMarkingContext.inline.hpp"
 #include "gc/shenandoah/heuristics/shenandoahHeuristics.hpp"
+#include "jfr/jfrEvents.hpp"
 #include "logging/log.hpp"
 #include "logging/logTag.hpp"
 
@@ -91,6 +93,10 @@ void ShenandoahHeuristics::choose_collection_set(ShenandoahCollectionSet* collec
   size_t free = 0;
   size_t free_regions = 0;
 
+  size_t young_garbage = 0;
+  size_t young_live = 0;
+  size_t young_regions = 0;
+
   ShenandoahMarkingContext* const ctx = heap->complete_marking_context();
 
   for (size_t i = 0; i < num_regions; i++) {
@@ -114,6 +120,12 @@ void ShenandoahHeuristics::choose_collection_set(ShenandoahCollectionSet* collec
         candidates[cand_idx]._garbage = garbage;
         cand_idx++;
       }
+      if (region->age() == 0) {
+        young_regions++;
+        young_garbage += garbage;
+        young_live += region->get_live_data_bytes();
+      }
+      region->increment_age();
     } else if (region->is_humongous_start()) {
       // Reclaim humongous regions here, and count them as the immediate garbage
 #ifdef ASSERT
@@ -129,6 +141,8 @@ void ShenandoahHeuristics::choose_collection_set(ShenandoahCollectionSet* collec
         // Count only the start. Continuations would be counted on "trash" path
         immediate_regions++;
         immediate_garbage += garbage;
+      } else {
+        region->increment_age();
       }
     } else if (region->is_trash()) {
       // Count in just trashed collection set, during coalesced CM-with-UR
@@ -171,6 +185,16 @@ void ShenandoahHeuristics::choose_collection_set(ShenandoahCollectionSet* collec
                      byte_size_in_proper_unit(collection_set->garbage()),
                      proper_unit_for_byte_size(collection_set->garbage()),
                      cset_percent);
+
+  size_t young_garbage_percent = (total_garbage == 0) ? 0 : (young_garbage * 100 / total_garbage);
+
+  log_debug(gc, ergo)("Young Regions: " SIZE_FORMAT ", Garbage: " SIZE_FORMAT "%s (" SIZE_FORMAT "%%), Live: " SIZE_FORMAT "%s",
+                      young_regions,
+                      byte_size_in_proper_unit(young_garbage),
+                      proper_unit_for_byte_size(young_garbage),
+                      young_garbage_percent,
+                      byte_size_in_proper_unit(young_live),
+                      proper_unit_for_byte_size(young_live));
 }
 
 void ShenandoahHeuristics::record_cycle_start() {
@@ -186,6 +210,7 @@ bool ShenandoahHeuristics::should_start_gc() const {
   if (has_metaspace_oom()) {
     // Some of vmTestbase/metaspace tests depend on following line to count GC cycles
     log_info(gc)("Trigger: %s", GCCause::to_string(GCCause::_metadata_GC_threshold));
+    report_trigger("Metadata GC Threshold", 0, 0);
     return true;
   }
 
@@ -194,6 +219,7 @@ bool ShenandoahHeuristics::should_start_gc() const {
     if (last_time_ms > ShenandoahGuaranteedGCInterval) {
       log_info(gc)("Trigger: Time since last GC (%.0f ms) is larger than guaranteed interval (" UINTX_FORMAT " ms)",
                    last_time_ms, ShenandoahGuaranteedGCInterval);
+      report_trigger("Guaranteed Interval", 0, 0);
       return true;
     }
   }
@@ -201,6 +227,18 @@ bool ShenandoahHeuristics::should_start_gc() const {
   return false;
 }
 
+void ShenandoahHeuristics::report_trigger(const char* trigger, size_t headroom, double allocation_rate) const {
+  EventShenandoahHeuristicsTrigger e;
+  if (e.should_commit()) {
+    e.set_trigger(trigger);
+    e.set_available(ShenandoahHeap::heap()->free_set()->available());
+    e.set_headroom(headroom);
+    e.set_allocationRate(allocation_rate);
+    e.set_averageCycleTime((s8)(_gc_time_history->avg() * 1000));
+    e.commit();
+  }
+}
+
 bool ShenandoahHeuristics::should_degenerate_cycle() {
   return _degenerated_cycles_in_a_row <= ShenandoahFullGCThreshold;
 }
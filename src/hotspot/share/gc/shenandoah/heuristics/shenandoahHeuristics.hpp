@@ -91,6 +91,9 @@ protected:
 
   void adjust_penalty(intx step);
 
+  // Report the decision to start a cycle to JFR.
+  void report_trigger(const char* trigger, size_t headroom, double allocation_rate) const;
+
 public:
   ShenandoahHeuristics();
   virtual ~ShenandoahHeuristics();
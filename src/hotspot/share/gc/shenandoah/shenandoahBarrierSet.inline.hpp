@@ -139,6 +139,16 @@ template <typename T>
 inline oop ShenandoahBarrierSet::AccessBarrier<decorators, BarrierSetT>::oop_load_not_in_heap(T* addr) {
   oop value = Raw::oop_load_not_in_heap(addr);
   if (value != NULL) {
+    // Weak roots that are being cleared concurrently may still refer to dead
+    // objects. Those must not be resurrected: report them as already cleared.
+    if (HasDecorator<decorators, ON_WEAK_OOP_REF>::value ||
+        HasDecorator<decorators, ON_PHANTOM_OOP_REF>::value) {
+      ShenandoahHeap* const heap = ShenandoahHeap::heap();
+      if (heap->is_concurrent_weak_root_in_progress() &&
+          !heap->complete_marking_context()->is_marked(value)) {
+        return NULL;
+      }
+    }
     ShenandoahBarrierSet *const bs = ShenandoahBarrierSet::barrier_set();
     value = bs->load_reference_barrier_not_null(value);
     if (value != NULL) {
@@ -49,6 +49,7 @@
 #include "memory/metaspace.hpp"
 #include "memory/resourceArea.hpp"
 #include "oops/oop.inline.hpp"
+#include "runtime/handshake.hpp"
 
 template<UpdateRefsMode UPDATE_REFS>
 class ShenandoahInitMarkRootsClosure : public OopClosure {
@@ -146,10 +147,11 @@ class ShenandoahConcurrentMarkingTask : public AbstractGangTask {
 private:
   ShenandoahConcurrentMark* _cm;
   ShenandoahTaskTerminator* _terminator;
+  bool                      _scan_code_roots;
 
 public:
-  ShenandoahConcurrentMarkingTask(ShenandoahConcurrentMark* cm, ShenandoahTaskTerminator* terminator) :
-    AbstractGangTask("Root Region Scan"), _cm(cm), _terminator(terminator) {
+  ShenandoahConcurrentMarkingTask(ShenandoahConcurrentMark* cm, ShenandoahTaskTerminator* terminator, bool scan_code_roots = true) :
+    AbstractGangTask("Root Region Scan"), _cm(cm), _terminator(terminator), _scan_code_roots(scan_code_roots) {
   }
 
   void work(uint worker_id) {
@@ -165,13 +167,69 @@ public:
       rp = NULL;
     }
 
-    _cm->concurrent_scan_code_roots(worker_id, rp);
+    if (_scan_code_roots) {
+      _cm->concurrent_scan_code_roots(worker_id, rp);
+    }
     _cm->mark_loop(worker_id, _terminator, rp,
                    true, // cancellable
                    ShenandoahStringDedup::is_enabled()); // perform string dedup
   }
 };
 
+// Pushes thread stack referents that still need marking into the SATB queue
+// of the thread being walked. The walk may be run by the VM thread on behalf of
+// a blocked thread, so the queue is picked from the target, not the current thread.
+class ShenandoahEnqueueThreadRootsClosure : public OopClosure {
+private:
+  ShenandoahHeap* const    _heap;
+  ShenandoahSATBMarkQueue& _queue;
+
+  template <class T>
+  inline void do_oop_work(T* p) {
+    T o = RawAccess<>::oop_load(p);
+    if (!CompressedOops::is_null(o)) {
+      oop obj = CompressedOops::decode_not_null(o);
+      obj = ShenandoahBarrierSet::resolve_forwarded_not_null(obj);
+      if (_heap->requires_marking(obj)) {
+        _queue.enqueue_known_active(obj);
+      }
+    }
+  }
+
+public:
+  ShenandoahEnqueueThreadRootsClosure(JavaThread* jt) :
+    _heap(ShenandoahHeap::heap()), _queue(ShenandoahThreadLocalData::satb_mark_queue(jt)) {}
+
+  void do_oop(narrowOop* p) { do_oop_work(p); }
+  void do_oop(oop* p)       { do_oop_work(p); }
+};
+
+class ShenandoahEnqueueThreadRootsHandshakeClosure : public ThreadClosure {
+private:
+  const bool _do_stacks;
+  const bool _do_nmethods;
+
+public:
+  ShenandoahEnqueueThreadRootsHandshakeClosure(bool do_stacks, bool do_nmethods) :
+    _do_stacks(do_stacks), _do_nmethods(do_nmethods) {}
+
+  void do_thread(Thread* thread) {
+    JavaThread* jt = (JavaThread*)thread;
+    ShenandoahEnqueueThreadRootsClosure cl(jt);
+    if (_do_stacks) {
+      ResourceMark rm;
+      jt->oops_do(&cl, NULL);
+    } else if (_do_nmethods) {
+      // Unlike MarkingCodeBlobClosure, this does not claim the nmethods: the final
+      // mark pause still has to visit them.
+      CodeBlobToOopClosure blobs_cl(&cl, !CodeBlobToOopClosure::FixRelocations);
+      jt->nmethods_do(&blobs_cl);
+    }
+    // Hand over the buffer, so that concurrent marking can drain it.
+    ShenandoahThreadLocalData::satb_mark_queue(jt).flush();
+  }
+};
+
 class ShenandoahSATBAndRemarkCodeRootsThreadsClosure : public ThreadClosure {
 private:
   ShenandoahConcMarkSATBBufferClosure* _satb_cl;
@@ -452,6 +510,42 @@ void ShenandoahConcurrentMark::mark_from_roots() {
   assert(task_queues()->is_empty() || _heap->cancelled_gc(), "Should be empty when not cancelled");
 }
 
+void ShenandoahConcurrentMark::mark_thread_roots() {
+  assert(_heap->is_concurrent_mark_in_progress(), "Only during concurrent marking");
+
+  // Final mark remarks the thread stacks in IU mode, and walks the nmethods on
+  // thread stacks when unloading classes. Stacks can only be walked when the
+  // threads are stopped, so this cannot replace the work in the pause. But marking
+  // through the current referents here leaves much less to do in the pause.
+  bool do_stacks = ShenandoahStoreValEnqueueBarrier;
+  bool do_nmethods = _heap->unload_classes();
+  if (!do_stacks && !do_nmethods) {
+    return;
+  }
+
+  {
+    ShenandoahEnqueueThreadRootsHandshakeClosure tc(do_stacks, do_nmethods);
+    Handshake::execute(&tc);
+  }
+
+  WorkGang* workers = _heap->workers();
+  uint nworkers = workers->active_workers();
+
+  shenandoah_assert_rp_isalive_not_installed();
+  ShenandoahIsAliveSelector is_alive;
+  ReferenceProcessorIsAliveMutator fix_isalive(_heap->ref_processor(), is_alive.is_alive_closure());
+
+  task_queues()->reserve(nworkers);
+
+  {
+    ShenandoahTaskTerminator terminator(nworkers, task_queues());
+    ShenandoahConcurrentMarkingTask task(this, &terminator, false /* scan_code_roots */);
+    workers->run_task(&task);
+  }
+
+  assert(task_queues()->is_empty() || _heap->cancelled_gc(), "Should be empty when not cancelled");
+}
+
 void ShenandoahConcurrentMark::finish_mark_from_roots(bool full_gc) {
   assert(ShenandoahSafepoint::is_at_shenandoah_safepoint(), "Must be at a safepoint");
 
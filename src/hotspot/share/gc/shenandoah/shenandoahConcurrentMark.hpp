@@ -74,6 +74,7 @@ public:
   static inline void mark_through_ref(T* p, ShenandoahHeap* heap, ShenandoahObjToScanQueue* q, ShenandoahMarkingContext* const mark_context);
 
   void mark_from_roots();
+  void mark_thread_roots();
   void finish_mark_from_roots(bool full_gc);
 
   void mark_roots(ShenandoahPhaseTimings::Phase root_phase);
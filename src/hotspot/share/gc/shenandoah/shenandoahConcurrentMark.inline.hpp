@@ -101,59 +101,10 @@ inline void ShenandoahConcurrentMark::do_chunked_array_start(ShenandoahObjToScan
   objArrayOop array = objArrayOop(obj);
   int len = array->length();
 
-  if (len <= (int) ObjArrayMarkingStride*2) {
-    // A few slices only, process directly
-    array->oop_iterate_range(cl, 0, len);
-  } else {
-    int bits = log2_long(len);
-    // Compensate for non-power-of-two arrays, cover the array in excess:
-    if (len != (1 << bits)) bits++;
-
-    // Only allow full chunks on the queue. This frees do_chunked_array() from checking from/to
-    // boundaries against array->length(), touching the array header on every chunk.
-    //
-    // To do this, we cut the prefix in full-sized chunks, and submit them on the queue.
-    // If the array is not divided in chunk sizes, then there would be an irregular tail,
-    // which we will process separately.
-
-    int last_idx = 0;
-
-    int chunk = 1;
-    int pow = bits;
-
-    // Handle overflow
-    if (pow >= 31) {
-      assert (pow == 31, "sanity");
-      pow--;
-      chunk = 2;
-      last_idx = (1 << pow);
-      bool pushed = q->push(ShenandoahMarkTask(array, 1, pow));
-      assert(pushed, "overflow queue should always succeed pushing");
-    }
-
-    // Split out tasks, as suggested in ObjArrayChunkedTask docs. Record the last
-    // successful right boundary to figure out the irregular tail.
-    while ((1 << pow) > (int)ObjArrayMarkingStride &&
-           (chunk*2 < ShenandoahMarkTask::chunk_size())) {
-      pow--;
-      int left_chunk = chunk*2 - 1;
-      int right_chunk = chunk*2;
-      int left_chunk_end = left_chunk * (1 << pow);
-      if (left_chunk_end < len) {
-        bool pushed = q->push(ShenandoahMarkTask(array, left_chunk, pow));
-        assert(pushed, "overflow queue should always succeed pushing");
-        chunk = right_chunk;
-        last_idx = left_chunk_end;
-      } else {
-        chunk = left_chunk;
-      }
-    }
-
-    // Process the irregular tail, if present
-    int from = last_idx;
-    if (from < len) {
-      array->oop_iterate_range(cl, from, len);
-    }
+  // Push the full chunks, and process the irregular tail, if present
+  int from = ObjArrayChunker::push_initial_chunks(q, array);
+  if (from < len) {
+    array->oop_iterate_range(cl, from, len);
   }
 }
 
@@ -162,28 +113,8 @@ inline void ShenandoahConcurrentMark::do_chunked_array(ShenandoahObjToScanQueue*
   assert(obj->is_objArray(), "expect object array");
   objArrayOop array = objArrayOop(obj);
 
-  assert (ObjArrayMarkingStride > 0, "sanity");
-
-  // Split out tasks, as suggested in ObjArrayChunkedTask docs. Avoid pushing tasks that
-  // are known to start beyond the array.
-  while ((1 << pow) > (int)ObjArrayMarkingStride && (chunk*2 < ShenandoahMarkTask::chunk_size())) {
-    pow--;
-    chunk *= 2;
-    bool pushed = q->push(ShenandoahMarkTask(array, chunk - 1, pow));
-    assert(pushed, "overflow queue should always succeed pushing");
-  }
-
-  int chunk_size = 1 << pow;
-
-  int from = (chunk - 1) * chunk_size;
-  int to = chunk * chunk_size;
-
-#ifdef ASSERT
-  int len = array->length();
-  assert (0 <= from && from < len, "from is sane: %d/%d", from, len);
-  assert (0 < to && to <= len, "to is sane: %d/%d", to, len);
-#endif
-
+  int from, to;
+  ObjArrayChunker::split_chunk(q, array, chunk, pow, &from, &to);
   array->oop_iterate_range(cl, from, to);
 }
 
@@ -290,9 +290,10 @@ void ShenandoahControlThread::run_service() {
     if (ShenandoahUncommit && (explicit_gc_requested || (current - last_shrink_time > shrink_period))) {
       // Try to uncommit enough stale regions. Explicit GC tries to uncommit everything.
       // Regular paths uncommit only occasionally.
+      heap->adapt_uncommit_delay();
       double shrink_before = explicit_gc_requested ?
                              current :
-                             current - (ShenandoahUncommitDelay / 1000.0);
+                             current - (heap->uncommit_delay() / 1000.0);
       service_uncommit(shrink_before);
       heap->phase_timings()->flush_cycle_to_global();
       last_shrink_time = current;
@@ -371,12 +372,22 @@ void ShenandoahControlThread::service_concurrent_normal_cycle(GCCause::Cause cau
   heap->entry_mark();
   if (check_cancellation_or_degen(ShenandoahHeap::_degenerated_mark)) return;
 
+  // Mark through the current thread stack roots, offloading the final mark pause
+  heap->entry_thread_roots();
+  if (check_cancellation_or_degen(ShenandoahHeap::_degenerated_mark)) return;
+
   // If not cancelled, can try to concurrently pre-clean
   heap->entry_preclean();
 
   // Complete marking under STW, and start evacuation
   heap->vmop_entry_final_mark();
 
+  // Clean the weak roots left over by final mark. This has to complete before
+  // cleanup recycles the regions that dead weak referents live in.
+  if (heap->is_concurrent_weak_root_in_progress()) {
+    heap->entry_weak_roots();
+  }
+
   // Final mark might have reclaimed some immediate garbage, kick cleanup to reclaim
   // the space. This would be the last action if there is nothing to evacuate.
   heap->entry_cleanup_early();
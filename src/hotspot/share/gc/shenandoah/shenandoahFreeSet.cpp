@@ -28,6 +28,7 @@
 #include "gc/shenandoah/shenandoahHeapRegionSet.hpp"
 #include "gc/shenandoah/shenandoahMarkingContext.inline.hpp"
 #include "logging/logStream.hpp"
+#include "utilities/bitMap.inline.hpp"
 
 ShenandoahFreeSet::ShenandoahFreeSet(ShenandoahHeap* heap, size_t max_regions) :
   _heap(heap),
@@ -58,6 +59,30 @@ bool ShenandoahFreeSet::is_collector_free(size_t idx) const {
   return _collector_free_bitmap.at(idx);
 }
 
+HeapWord* ShenandoahFreeSet::allocate_single_on_node(const BitMap& view, size_t leftmost, size_t rightmost, int node,
+                                                     ShenandoahAllocRequest& req, bool& in_new_region) {
+  // Node stripes are contiguous, so only the stripe part of the view bitmap
+  // needs to be searched, and the search skips over taken regions a word at
+  // a time. The reserve sits at the end of every stripe, so the collector view
+  // is walked forward here as well.
+  size_t beg, end;
+  if (!_heap->numa_region_stripe(node, &beg, &end)) {
+    return NULL;
+  }
+  beg = MAX2(beg, leftmost);
+  end = MIN2(end, rightmost + 1);
+  if (beg >= end) {
+    return NULL;
+  }
+  for (size_t idx = view.get_next_one_offset(beg, end); idx < end; idx = view.get_next_one_offset(idx + 1, end)) {
+    HeapWord* result = try_allocate_in(_heap->get_region(idx), req, in_new_region);
+    if (result != NULL) {
+      return result;
+    }
+  }
+  return NULL;
+}
+
 HeapWord* ShenandoahFreeSet::allocate_single(ShenandoahAllocRequest& req, bool& in_new_region) {
   // Scan the bitmap looking for a first fit.
   //
@@ -70,11 +95,26 @@ HeapWord* ShenandoahFreeSet::allocate_single(ShenandoahAllocRequest& req, bool&
   //
   // Free set maintains mutator and collector views, and normally they allocate in their views only,
   // unless we special cases for stealing and mixed allocations.
+  //
+  // With NUMA region affinity, each view is first scanned for regions on the node the requesting
+  // thread runs on. GC workers allocate GCLABs this way too, so evacuated objects land on the node
+  // of the worker that copies them.
+
+  int node = _heap->has_numa_region_affinity() ? os::numa_get_group_id() : -1;
 
   switch (req.type()) {
     case ShenandoahAllocRequest::_alloc_tlab:
     case ShenandoahAllocRequest::_alloc_shared: {
 
+      // Try to allocate in the node-local part of the mutator view
+      if (node >= 0) {
+        HeapWord* result = allocate_single_on_node(_mutator_free_bitmap, _mutator_leftmost, _mutator_rightmost,
+                                                   node, req, in_new_region);
+        if (result != NULL) {
+          return result;
+        }
+      }
+
       // Try to allocate in the mutator view
       for (size_t idx = _mutator_leftmost; idx <= _mutator_rightmost; idx++) {
         if (is_mutator_free(idx)) {
@@ -92,6 +132,15 @@ HeapWord* ShenandoahFreeSet::allocate_single(ShenandoahAllocRequest& req, bool&
     case ShenandoahAllocRequest::_alloc_shared_gc: {
       // size_t is unsigned, need to dodge underflow when _leftmost = 0
 
+      // Try the node-local part of the collector view first
+      if (node >= 0) {
+        HeapWord* result = allocate_single_on_node(_collector_free_bitmap, _collector_leftmost, _collector_rightmost,
+                                                   node, req, in_new_region);
+        if (result != NULL) {
+          return result;
+        }
+      }
+
       // Fast-path: try to allocate in the collector view first
       for (size_t c = _collector_rightmost + 1; c > _collector_leftmost; c--) {
         size_t idx = c - 1;
@@ -418,16 +467,30 @@ void ShenandoahFreeSet::rebuild() {
   size_t to_reserve = _heap->max_capacity() / 100 * ShenandoahEvacReserve;
   size_t reserved = 0;
 
+  // With NUMA region affinity, split the reserve between nodes and take the trailing
+  // space of each node stripe, so that GC workers find local evacuation space on every node.
+  size_t nodes = _heap->has_numa_region_affinity() ? _heap->numa_region_nodes() : 1;
+  size_t to_reserve_node = to_reserve / nodes;
+  size_t reserved_node = 0;
+  int node = -1;
+
   for (size_t idx = _heap->num_regions() - 1; idx > 0; idx--) {
     if (reserved >= to_reserve) break;
 
     ShenandoahHeapRegion* region = _heap->get_region(idx);
+    if (region->numa_node() != node) {
+      node = region->numa_node();
+      reserved_node = 0;
+    }
+    if (reserved_node >= to_reserve_node) continue;
+
     if (_mutator_free_bitmap.at(idx) && is_empty_or_trash(region)) {
       _mutator_free_bitmap.clear_bit(idx);
       _collector_free_bitmap.set_bit(idx);
       size_t ac = alloc_capacity(region);
       _capacity -= ac;
       reserved += ac;
+      reserved_node += ac;
     }
   }
 
@@ -28,6 +28,8 @@
 #include "gc/shared/gcTraceTime.inline.hpp"
 #include "gc/shared/memAllocator.hpp"
 #include "gc/shared/plab.hpp"
+#include "gc/shared/pretouchTask.hpp"
+#include "gc/shared/taskqueue.inline.hpp"
 
 #include "gc/shenandoah/parallelCleaning.hpp"
 #include "gc/shenandoah/shenandoahBarrierSet.hpp"
@@ -40,6 +42,7 @@
 #include "gc/shenandoah/shenandoahPhaseTimings.hpp"
 #include "gc/shenandoah/shenandoahHeap.inline.hpp"
 #include "gc/shenandoah/shenandoahHeapRegion.inline.hpp"
+#include "gc/shenandoah/shenandoahHeapRegionCounters.hpp"
 #include "gc/shenandoah/shenandoahHeapRegionSet.hpp"
 #include "gc/shenandoah/shenandoahMarkCompact.hpp"
 #include "gc/shenandoah/shenandoahMarkingContext.inline.hpp"
@@ -67,6 +70,7 @@
 #endif
 
 #include "memory/metaspace.hpp"
+#include "runtime/safepointMechanism.hpp"
 #include "runtime/vmThread.hpp"
 #include "services/mallocTracker.hpp"
 
@@ -169,17 +173,7 @@ jint ShenandoahHeap::initialize() {
   assert((((size_t) base()) & ShenandoahHeapRegion::region_size_bytes_mask()) == 0,
          "Misaligned heap: " PTR_FORMAT, p2i(base()));
 
-#if SHENANDOAH_OPTIMIZED_OBJTASK
-  // The optimized ObjArrayChunkedTask takes some bits away from the full object bits.
-  // Fail if we ever attempt to address more than we can.
-  if ((uintptr_t)heap_rs.end() >= ObjArrayChunkedTask::max_addressable()) {
-    FormatBuffer<512> buf("Shenandoah reserved [" PTR_FORMAT ", " PTR_FORMAT") for the heap, \n"
-                          "but max object address is " PTR_FORMAT ". Try to reduce heap size, or try other \n"
-                          "VM options that allocate heap at lower addresses (HeapBaseMinAddress, AllocateHeapAt, etc).",
-                p2i(heap_rs.base()), p2i(heap_rs.end()), ObjArrayChunkedTask::max_addressable());
-    vm_exit_during_initialization("Fatal Error", buf);
-  }
-#endif
+  ObjArrayChunkedTask::check_addressable("Shenandoah", heap_rs.base(), heap_rs.end());
 
   ReservedSpace sh_rs = heap_rs.first_part(max_byte_size);
   if (!_heap_region_special) {
@@ -311,6 +305,8 @@ jint ShenandoahHeap::initialize() {
       assert(!collection_set()->is_in(i), "New region should not be in collection set");
     }
 
+    initialize_numa_region_affinity();
+
     // Initialize to complete
     _marking_context->mark_complete();
 
@@ -323,18 +319,8 @@ jint ShenandoahHeap::initialize() {
     // we touch the region and the corresponding bitmaps from the same thread.
     ShenandoahPushWorkerScope scope(workers(), _max_workers, false);
 
-    _pretouch_heap_page_size = heap_page_size;
-    _pretouch_bitmap_page_size = bitmap_page_size;
-
-#ifdef LINUX
-    // UseTransparentHugePages would madvise that backing memory can be coalesced into huge
-    // pages. But, the kernel needs to know that every small page is used, in order to coalesce
-    // them into huge one. Therefore, we need to pretouch with smaller pages.
-    if (UseTransparentHugePages) {
-      _pretouch_heap_page_size = (size_t)os::vm_page_size();
-      _pretouch_bitmap_page_size = (size_t)os::vm_page_size();
-    }
-#endif
+    _pretouch_heap_page_size = PretouchTask::touch_page_size(heap_page_size);
+    _pretouch_bitmap_page_size = PretouchTask::touch_page_size(bitmap_page_size);
 
     // OS memory managers may want to coalesce back-to-back pages. Make their jobs
     // simpler by pre-touching continuous spaces (heap and bitmap) separately.
@@ -436,6 +422,45 @@ void ShenandoahHeap::initialize_heuristics() {
                      _heuristics->name());
 }
 
+void ShenandoahHeap::initialize_numa_region_affinity() {
+  // NUMA support is only known after os initialization, so this cannot be
+  // decided with the rest of the ergonomics.
+  if (!ShenandoahNUMARegionAffinity || !UseNUMA || os::numa_get_groups_num() < 2) {
+    return;
+  }
+
+  size_t max_nodes = os::numa_get_groups_num();
+  int* node_ids = NEW_C_HEAP_ARRAY(int, max_nodes, mtGC);
+  size_t nodes = os::numa_get_leaf_groups(node_ids, max_nodes);
+
+  if (nodes >= 2) {
+    // Contiguous stripes keep the allocation cursors in the free set from
+    // hopping between nodes on every region.
+    for (size_t i = 0; i < _num_regions; i++) {
+      _regions[i]->set_numa_node(node_ids[i * nodes / _num_regions]);
+    }
+    _numa_region_nodes = nodes;
+    _numa_region_node_ids = node_ids;
+    log_info(gc, init)("NUMA region affinity: " SIZE_FORMAT " nodes", nodes);
+  } else {
+    FREE_C_HEAP_ARRAY(int, node_ids);
+  }
+}
+
+bool ShenandoahHeap::numa_region_stripe(int node, size_t* beg, size_t* end) const {
+  // Inverse of the region to node mapping in initialize_numa_region_affinity:
+  // stripe k holds the regions i with k <= i * nodes / num_regions < k + 1.
+  size_t nodes = _numa_region_nodes;
+  for (size_t k = 0; k < nodes; k++) {
+    if (_numa_region_node_ids[k] == node) {
+      *beg = (k * _num_regions + nodes - 1) / nodes;
+      *end = ((k + 1) * _num_regions + nodes - 1) / nodes;
+      return true;
+    }
+  }
+  return false;
+}
+
 #ifdef _MSC_VER
 #pragma warning( push )
 #pragma warning( disable:4355 ) // 'this' : used in base member initializer list
@@ -447,10 +472,14 @@ ShenandoahHeap::ShenandoahHeap(ShenandoahCollectorPolicy* policy) :
   _used(0),
   _committed(0),
   _bytes_allocated_since_gc_start(0),
+  _uncommit_delay(ShenandoahUncommitDelay),
+  _uncommit_delay_adjust_time(0),
   _max_workers(MAX2(ConcGCThreads, ParallelGCThreads)),
   _workers(NULL),
   _safepoint_workers(NULL),
   _heap_region_special(false),
+  _numa_region_nodes(0),
+  _numa_region_node_ids(NULL),
   _num_regions(0),
   _regions(NULL),
   _update_refs_iterator(this),
@@ -554,6 +583,7 @@ void ShenandoahHeap::print_on(outputStream* st) const {
   if (is_degenerated_gc_in_progress())       st->print("degenerated gc, ");
   if (is_full_gc_in_progress())              st->print("full gc, ");
   if (is_full_gc_move_in_progress())         st->print("full gc move, ");
+  if (is_concurrent_weak_root_in_progress()) st->print("concurrent weak roots, ");
 
   if (cancelled_gc()) {
     st->print("cancelled");
@@ -717,6 +747,53 @@ void ShenandoahHeap::op_uncommit(double shrink_before) {
   }
 }
 
+void ShenandoahHeap::record_region_commit(jlong ticks, double uncommitted_secs) {
+  if (_monitoring_support != NULL) {
+    _monitoring_support->heap_region_counters()->record_commit(ticks);
+  }
+
+  // Region was committed back before the delay it had to wait out to get uncommitted:
+  // uncommitting it was most likely a waste.
+  if (ShenandoahUncommitAdaptiveDelay && uncommitted_secs >= 0 &&
+      uncommitted_secs * 1000 < _uncommit_delay) {
+    _premature_recommit.set();
+  }
+}
+
+void ShenandoahHeap::record_region_uncommit(jlong ticks) {
+  if (_monitoring_support != NULL) {
+    _monitoring_support->heap_region_counters()->record_uncommit(ticks);
+  }
+}
+
+void ShenandoahHeap::adapt_uncommit_delay() {
+  if (!ShenandoahUncommitAdaptiveDelay) {
+    return;
+  }
+
+  double now = os::elapsedTime();
+  size_t delay = _uncommit_delay;
+  size_t max_delay = ShenandoahUncommitDelay * 16;
+
+  if (_premature_recommit.try_unset()) {
+    // Back off: some regions were committed back soon after we uncommitted them.
+    size_t new_delay = MIN2(delay * 2, max_delay);
+    if (new_delay != delay) {
+      log_info(gc, ergo)("Regions recommitted soon after uncommit, increasing uncommit delay to " SIZE_FORMAT " ms",
+                         new_delay);
+      _uncommit_delay = new_delay;
+    }
+    _uncommit_delay_adjust_time = now;
+  } else if (delay > ShenandoahUncommitDelay && (now - _uncommit_delay_adjust_time) * 1000 > delay) {
+    // No premature recommits for the whole delay, decay back to the configured delay.
+    size_t new_delay = MAX2(delay / 2, (size_t)ShenandoahUncommitDelay);
+    log_info(gc, ergo)("No premature recommits, decreasing uncommit delay to " SIZE_FORMAT " ms",
+                       new_delay);
+    _uncommit_delay = new_delay;
+    _uncommit_delay_adjust_time = now;
+  }
+}
+
 HeapWord* ShenandoahHeap::allocate_from_gclab_slow(Thread* thread, size_t size) {
   // New object should fit the GCLAB size
   size_t min_size = MAX2(size, PLAB::min_size());
@@ -993,7 +1070,7 @@ void ShenandoahHeap::print_heap_regions_on(outputStream* st) const {
   st->print_cr("Heap Regions:");
   st->print_cr("EU=empty-uncommitted, EC=empty-committed, R=regular, H=humongous start, HC=humongous continuation, CS=collection set, T=trash, P=pinned");
   st->print_cr("BTE=bottom/top/end, U=used, T=TLAB allocs, G=GCLAB allocs, S=shared allocs, L=live data");
-  st->print_cr("R=root, CP=critical pins, TAMS=top-at-mark-start, UWM=update watermark");
+  st->print_cr("R=root, CP=critical pins, TAMS=top-at-mark-start, UWM=update watermark, A=age");
   st->print_cr("SN=alloc sequence number");
 
   for (size_t i = 0; i < num_regions(); i++) {
@@ -1266,15 +1343,29 @@ void ShenandoahHeap::ensure_parsability(bool retire_tlabs) {
  * objects as we mark+traverse through the heap, starting from GC roots. JVMTI IterateThroughHeap
  * is allowed to report dead objects, but is not required to do so.
  */
-void ShenandoahHeap::object_iterate(ObjectClosure* cl) {
+bool ShenandoahHeap::prepare_aux_bitmap_for_iteration() {
   assert(SafepointSynchronize::is_at_safepoint(), "safe iteration is only available during safepoints");
   if (!_aux_bitmap_region_special && !os::commit_memory((char*)_aux_bitmap_region.start(), _aux_bitmap_region.byte_size(), false)) {
     log_warning(gc)("Could not commit native memory for auxiliary marking bitmap for heap iteration");
-    return;
+    return false;
   }
 
   // Reset bitmap
   _aux_bit_map.clear();
+  return true;
+}
+
+void ShenandoahHeap::reclaim_aux_bitmap_for_iteration() {
+  if (!_aux_bitmap_region_special && !os::uncommit_memory((char*)_aux_bitmap_region.start(), _aux_bitmap_region.byte_size())) {
+    log_warning(gc)("Could not uncommit native memory for auxiliary marking bitmap for heap iteration");
+  }
+}
+
+void ShenandoahHeap::object_iterate(ObjectClosure* cl) {
+  assert(SafepointSynchronize::is_at_safepoint(), "safe iteration is only available during safepoints");
+  if (!prepare_aux_bitmap_for_iteration()) {
+    return;
+  }
 
   Stack<oop,mtGC> oop_stack;
 
@@ -1299,9 +1390,167 @@ void ShenandoahHeap::object_iterate(ObjectClosure* cl) {
 
   assert(oop_stack.is_empty(), "should be empty");
 
-  if (!_aux_bitmap_region_special && !os::uncommit_memory((char*)_aux_bitmap_region.start(), _aux_bitmap_region.byte_size())) {
-    log_warning(gc)("Could not uncommit native memory for auxiliary marking bitmap for heap iteration");
+  reclaim_aux_bitmap_for_iteration();
+}
+
+/*
+ * Parallel version of object_iterate(). This is the same marking traversal, with the
+ * roots spread over per-worker queues and the workers stealing from each other. Objects
+ * are claimed by atomically marking them in the auxiliary bitmap.
+ */
+class ShenandoahParallelObjectIterator : public ParallelObjectIterator {
+private:
+  typedef OverflowTaskQueue<oop, mtGC>                    ShenandoahVisitQueue;
+  typedef GenericTaskQueueSet<ShenandoahVisitQueue, mtGC> ShenandoahVisitQueues;
+
+  class PushOopClosure : public BasicOopIterateClosure {
+  private:
+    ShenandoahParallelObjectIterator* const _iter;
+    uint _worker_id;
+
+    template <class T>
+    void do_oop_work(T* p) {
+      T o = RawAccess<>::oop_load(p);
+      if (!CompressedOops::is_null(o)) {
+        oop obj = CompressedOops::decode_not_null(o);
+        _iter->push(ShenandoahBarrierSet::resolve_forwarded_not_null(obj), _worker_id);
+      }
+    }
+
+  public:
+    PushOopClosure(ShenandoahParallelObjectIterator* iter, uint worker_id) :
+      _iter(iter), _worker_id(worker_id) {}
+    void set_worker_id(uint worker_id) { _worker_id = worker_id; }
+    void do_oop(oop* p)       { do_oop_work(p); }
+    void do_oop(narrowOop* p) { do_oop_work(p); }
+  };
+
+  // Pushes roots round-robin over the worker queues
+  class RootOopClosure : public PushOopClosure {
+  private:
+    const uint _nworkers;
+    uint       _next;
+
+  public:
+    RootOopClosure(ShenandoahParallelObjectIterator* iter) :
+      PushOopClosure(iter, 0), _nworkers(iter->_nworkers), _next(0) {}
+
+    void do_oop(oop* p) {
+      set_worker_id(_next++ % _nworkers);
+      PushOopClosure::do_oop(p);
+    }
+
+    void do_oop(narrowOop* p) {
+      set_worker_id(_next++ % _nworkers);
+      PushOopClosure::do_oop(p);
+    }
+  };
+
+  ShenandoahHeap* const  _heap;
+  const uint             _nworkers;
+  ShenandoahVisitQueues  _visit_queues;
+  ParallelTaskTerminator _terminator;
+  bool                   _bitmap_ready;
+
+  void push(oop obj, uint worker_id) {
+    assert(oopDesc::is_oop(obj), "must be a valid oop");
+    if (_heap->_aux_bit_map.parMark((HeapWord*) obj)) {
+      _visit_queues.queue(worker_id)->push(obj);
+    }
+  }
+
+  void visit(ObjectClosure* cl, oop obj, PushOopClosure* push_cl) {
+    cl->do_object(obj);
+    obj->oop_iterate(push_cl);
+  }
+
+  void drain(ObjectClosure* cl, uint worker_id, PushOopClosure* push_cl) {
+    ShenandoahVisitQueue* const queue = _visit_queues.queue(worker_id);
+    oop obj;
+
+    do {
+      while (queue->pop_overflow(obj)) {
+        visit(cl, obj, push_cl);
+      }
+
+      while (queue->pop_local(obj)) {
+        visit(cl, obj, push_cl);
+      }
+    } while (!queue->is_empty());
+  }
+
+  bool steal(ObjectClosure* cl, uint worker_id, PushOopClosure* push_cl) {
+    int seed = 17;
+    oop obj;
+
+    if (!_visit_queues.steal(worker_id, &seed, obj)) {
+      // Nothing to steal
+      return false;
+    }
+
+    visit(cl, obj, push_cl);
+    return true;
+  }
+
+public:
+  ShenandoahParallelObjectIterator(uint nworkers) :
+      _heap(ShenandoahHeap::heap()),
+      _nworkers(nworkers),
+      _visit_queues(nworkers),
+      _terminator(nworkers, &_visit_queues),
+      _bitmap_ready(false) {
+    // Create one visit queue per worker
+    for (uint i = 0; i < _nworkers; i++) {
+      ShenandoahVisitQueue* const queue = new ShenandoahVisitQueue();
+      queue->initialize();
+      _visit_queues.register_queue(i, queue);
+    }
+
+    _bitmap_ready = _heap->prepare_aux_bitmap_for_iteration();
+    if (!_bitmap_ready) {
+      return;
+    }
+
+    // The root scanner is single threaded and holds locks that must be
+    // released before the workers start visiting objects, so scan the roots
+    // here and deal them out to the worker queues.
+    RootOopClosure root_cl(this);
+    ShenandoahHeapIterationRootScanner rp;
+    rp.roots_do(&root_cl);
+  }
+
+  virtual ~ShenandoahParallelObjectIterator() {
+    if (_bitmap_ready) {
+      _heap->reclaim_aux_bitmap_for_iteration();
+    }
+
+    for (uint i = 0; i < _nworkers; i++) {
+      delete _visit_queues.queue(i);
+    }
+  }
+
+  virtual void object_iterate(ObjectClosure* cl, uint worker_id) {
+    assert(worker_id < _nworkers, "Invalid worker id");
+    if (!_bitmap_ready) {
+      return;
+    }
+
+    PushOopClosure push_cl(this, worker_id);
+
+    // Visit objects, stealing from other workers when out
+    // of work, until all workers agree there is no work left.
+    do {
+      drain(cl, worker_id, &push_cl);
+      while (steal(cl, worker_id, &push_cl)) {
+        drain(cl, worker_id, &push_cl);
+      }
+    } while (!_terminator.offer_termination());
   }
+
+};
+
+ParallelObjectIterator* ShenandoahHeap::parallel_object_iterator(uint thread_num) {
+  return new ShenandoahParallelObjectIterator(thread_num);
 }
 
 void ShenandoahHeap::safe_object_iterate(ObjectClosure* cl) {
@@ -1434,6 +1683,10 @@ void ShenandoahHeap::op_mark() {
   concurrent_mark()->mark_from_roots();
 }
 
+void ShenandoahHeap::op_thread_roots() {
+  concurrent_mark()->mark_thread_roots();
+}
+
 class ShenandoahFinalMarkUpdateRegionStateClosure : public ShenandoahHeapRegionClosure {
 private:
   ShenandoahMarkingContext* const _ctx;
@@ -1496,6 +1749,10 @@ void ShenandoahHeap::op_final_mark() {
     set_concurrent_mark_in_progress(false);
     mark_complete_marking_context();
 
+    // Leave the string table to the concurrent weak roots phase that follows
+    // this pause. Degenerated cycles have no such phase.
+    set_concurrent_weak_root_in_progress(ShenandoahConcurrentWeakRoots && !is_degenerated_gc_in_progress());
+
     parallel_cleaning(false /* full gc*/);
 
     if (ShenandoahVerify) {
@@ -1598,6 +1855,15 @@ void ShenandoahHeap::op_updaterefs() {
   update_heap_references(true);
 }
 
+void ShenandoahHeap::op_weak_roots() {
+  assert(is_concurrent_weak_root_in_progress(), "Only during concurrent weak roots phase");
+  // This phase is not abandoned on cancellation: dead string table entries must
+  // be gone before the cleanup phase recycles the regions they point to.
+  ShenandoahConcurrentWeakRootsCleaningTask task(workers()->active_workers());
+  workers()->run_task(&task);
+  set_concurrent_weak_root_in_progress(false);
+}
+
 void ShenandoahHeap::op_cleanup_early() {
   free_set()->recycle_trash();
 }
@@ -1959,22 +2225,23 @@ void ShenandoahHeap::stw_process_weak_roots(bool full_gc) {
                                                ShenandoahPhaseTimings::purge_weak_par;
   ShenandoahGCSubPhase phase(timing_phase);
 
-  // Cleanup weak roots
+  // Cleanup weak roots. The string table is left to the concurrent phase, if one follows.
+  bool string_table = !is_concurrent_weak_root_in_progress();
   if (has_forwarded_objects()) {
     ShenandoahForwardedIsAliveClosure is_alive;
     ShenandoahUpdateRefsClosure keep_alive;
     ShenandoahParallelWeakRootsCleaningTask<ShenandoahForwardedIsAliveClosure, ShenandoahUpdateRefsClosure>
-      cleaning_task(timing_phase, &is_alive, &keep_alive, num_workers);
+      cleaning_task(timing_phase, &is_alive, &keep_alive, num_workers, string_table);
     _workers->run_task(&cleaning_task);
   } else {
     ShenandoahIsAliveClosure is_alive;
 #ifdef ASSERT
   ShenandoahAssertNotForwardedClosure verify_cl;
   ShenandoahParallelWeakRootsCleaningTask<ShenandoahIsAliveClosure, ShenandoahAssertNotForwardedClosure>
-    cleaning_task(timing_phase, &is_alive, &verify_cl, num_workers);
+    cleaning_task(timing_phase, &is_alive, &verify_cl, num_workers, string_table);
 #else
   ShenandoahParallelWeakRootsCleaningTask<ShenandoahIsAliveClosure, DoNothingClosure>
-    cleaning_task(timing_phase, &is_alive, &do_nothing_cl, num_workers);
+    cleaning_task(timing_phase, &is_alive, &do_nothing_cl, num_workers, string_table);
 #endif
     _workers->run_task(&cleaning_task);
   }
@@ -2032,6 +2299,10 @@ void ShenandoahHeap::set_degenerated_gc_in_progress(bool in_progress) {
   _degenerated_gc_in_progress.set_cond(in_progress);
 }
 
+void ShenandoahHeap::set_concurrent_weak_root_in_progress(bool in_progress) {
+  _concurrent_weak_root_in_progress.set_cond(in_progress);
+}
+
 void ShenandoahHeap::set_full_gc_in_progress(bool in_progress) {
   _full_gc_in_progress.set_cond(in_progress);
 }
@@ -2542,6 +2813,23 @@ void ShenandoahHeap::entry_mark() {
   op_mark();
 }
 
+void ShenandoahHeap::entry_thread_roots() {
+  if (ShenandoahConcurrentThreadRoots && SafepointMechanism::uses_thread_local_poll()) {
+    static const char* msg = "Concurrent thread roots";
+    ShenandoahConcurrentPhase gc_phase(msg);
+    EventMark em("%s", msg);
+
+    ShenandoahGCPhase phase(ShenandoahPhaseTimings::conc_thread_roots);
+
+    ShenandoahWorkerScope scope(workers(),
+                                ShenandoahWorkerPolicy::calc_workers_for_conc_thread_roots(),
+                                "concurrent thread roots");
+
+    try_inject_alloc_failure();
+    op_thread_roots();
+  }
+}
+
 void ShenandoahHeap::entry_evac() {
   TraceCollectorStats tcs(monitoring_support()->concurrent_collection_counters());
 
@@ -2574,6 +2862,20 @@ void ShenandoahHeap::entry_updaterefs() {
   op_updaterefs();
 }
 
+void ShenandoahHeap::entry_weak_roots() {
+  static const char* msg = "Concurrent weak roots";
+  ShenandoahConcurrentPhase gc_phase(msg);
+  EventMark em("%s", msg);
+
+  ShenandoahGCPhase phase(ShenandoahPhaseTimings::conc_weak_roots);
+
+  ShenandoahWorkerScope scope(workers(),
+                              ShenandoahWorkerPolicy::calc_workers_for_conc_weak_roots(),
+                              "concurrent weak roots");
+
+  op_weak_roots();
+}
+
 void ShenandoahHeap::entry_cleanup_early() {
   static const char* msg = "Concurrent cleanup";
   ShenandoahConcurrentPhase gc_phase(msg,  true /* log_heap_usage */);
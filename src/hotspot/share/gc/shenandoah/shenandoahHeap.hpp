@@ -115,6 +115,7 @@ class ShenandoahHeap : public CollectedHeap {
   friend class VMStructs;
   friend class ShenandoahGCSession;
   friend class ShenandoahGCStateResetter;
+  friend class ShenandoahParallelObjectIterator;
 
 // ---------- Locks that guard important data structures in Heap
 //
@@ -141,6 +142,7 @@ public:
   jint initialize();
   void post_initialize();
   void initialize_heuristics();
+  void initialize_numa_region_affinity();
 
   void initialize_serviceability();
 
@@ -185,6 +187,21 @@ public:
   size_t used()             const;
   size_t committed()        const;
 
+// ---------- Region commit and uncommit tracking
+//
+private:
+  volatile size_t      _uncommit_delay;
+  double               _uncommit_delay_adjust_time;
+  ShenandoahSharedFlag _premature_recommit;
+
+public:
+  void record_region_commit(jlong ticks, double uncommitted_secs);
+  void record_region_uncommit(jlong ticks);
+
+  // Current uncommit delay, in milliseconds
+  size_t uncommit_delay() const { return _uncommit_delay; }
+  void adapt_uncommit_delay();
+
 // ---------- Workers handling
 //
 private:
@@ -206,6 +223,8 @@ public:
 private:
   MemRegion _heap_region;
   bool      _heap_region_special;
+  size_t    _numa_region_nodes;
+  int*      _numa_region_node_ids;
   size_t    _num_regions;
   ShenandoahHeapRegion** _regions;
   ShenandoahRegionIterator _update_refs_iterator;
@@ -213,6 +232,10 @@ private:
 public:
   inline size_t num_regions() const { return _num_regions; }
   inline bool is_heap_region_special() { return _heap_region_special; }
+  inline bool has_numa_region_affinity() const { return _numa_region_nodes > 1; }
+  inline size_t numa_region_nodes() const { return _numa_region_nodes; }
+  // Region index range [beg; end) bound to the NUMA node, false if there is none.
+  bool numa_region_stripe(int node, size_t* beg, size_t* end) const;
 
   inline ShenandoahHeapRegion* const heap_region_containing(const void* addr) const;
   inline size_t heap_region_index_containing(const void* addr) const;
@@ -259,6 +282,7 @@ private:
   ShenandoahSharedFlag   _degenerated_gc_in_progress;
   ShenandoahSharedFlag   _full_gc_in_progress;
   ShenandoahSharedFlag   _full_gc_move_in_progress;
+  ShenandoahSharedFlag   _concurrent_weak_root_in_progress;
   ShenandoahSharedFlag   _progress_last_gc;
 
   void set_gc_state_all_threads(char state);
@@ -274,6 +298,7 @@ public:
   void set_degenerated_gc_in_progress(bool in_progress);
   void set_full_gc_in_progress(bool in_progress);
   void set_full_gc_move_in_progress(bool in_progress);
+  void set_concurrent_weak_root_in_progress(bool in_progress);
   void set_has_forwarded_objects(bool cond);
 
   inline bool is_stable() const;
@@ -284,6 +309,7 @@ public:
   inline bool is_degenerated_gc_in_progress() const;
   inline bool is_full_gc_in_progress() const;
   inline bool is_full_gc_move_in_progress() const;
+  inline bool is_concurrent_weak_root_in_progress() const;
   inline bool has_forwarded_objects() const;
   inline bool is_gc_in_progress_mask(uint mask) const;
 
@@ -373,7 +399,9 @@ public:
   // for concurrent operation.
   void entry_reset();
   void entry_mark();
+  void entry_thread_roots();
   void entry_preclean();
+  void entry_weak_roots();
   void entry_cleanup_early();
   void entry_evac();
   void entry_updaterefs();
@@ -393,7 +421,9 @@ private:
 
   void op_reset();
   void op_mark();
+  void op_thread_roots();
   void op_preclean();
+  void op_weak_roots();
   void op_cleanup_early();
   void op_conc_evac();
   void op_stw_evac();
@@ -515,6 +545,13 @@ public:
   // Used for native heap walkers: heap dumpers, mostly
   void object_iterate(ObjectClosure* cl);
   void safe_object_iterate(ObjectClosure* cl);
+  virtual ParallelObjectIterator* parallel_object_iterator(uint thread_num);
+
+private:
+  bool prepare_aux_bitmap_for_iteration();
+  void reclaim_aux_bitmap_for_iteration();
+
+public:
 
   // Used by RMI
   jlong millis_since_last_gc();
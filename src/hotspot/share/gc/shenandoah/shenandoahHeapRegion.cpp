@@ -56,13 +56,16 @@ ShenandoahHeapRegion::ShenandoahHeapRegion(HeapWord* start, size_t index, bool c
   _end(start + RegionSizeWords),
   _new_top(NULL),
   _empty_time(os::elapsedTime()),
+  _uncommit_time(-1),
   _state(committed ? _empty_committed : _empty_uncommitted),
   _top(start),
   _tlab_allocs(0),
   _gclab_allocs(0),
   _live_data(0),
   _critical_pins(0),
-  _update_watermark(start) {
+  _update_watermark(start),
+  _age(0),
+  _numa_node(-1) {
 
   assert(Universe::on_page_boundary(_bottom) && Universe::on_page_boundary(_end),
          "invalid space boundaries");
@@ -369,6 +372,7 @@ void ShenandoahHeapRegion::print_on(outputStream* st) const {
   st->print("|S " SIZE_FORMAT_W(5) "%1s", byte_size_in_proper_unit(get_shared_allocs()),   proper_unit_for_byte_size(get_shared_allocs()));
   st->print("|L " SIZE_FORMAT_W(5) "%1s", byte_size_in_proper_unit(get_live_data_bytes()), proper_unit_for_byte_size(get_live_data_bytes()));
   st->print("|CP " SIZE_FORMAT_W(3), pin_count());
+  st->print("|A %3u", age());
   st->cr();
 }
 
@@ -424,6 +428,7 @@ void ShenandoahHeapRegion::recycle() {
 
   ShenandoahHeap::heap()->marking_context()->reset_top_at_mark_start(this);
   set_update_watermark(bottom());
+  reset_age();
 
   make_empty();
 
@@ -617,6 +622,9 @@ void ShenandoahHeapRegion::setup_sizes(size_t max_heap_size) {
 }
 
 void ShenandoahHeapRegion::do_commit() {
+  EventShenandoahHeapRegionCommit evt;
+  jlong start = os::elapsed_counter();
+
   ShenandoahHeap* heap = ShenandoahHeap::heap();
   if (!heap->is_heap_region_special() && !os::commit_memory((char *) bottom(), RegionSizeBytes, false)) {
     report_java_out_of_memory("Unable to commit region");
@@ -624,13 +632,36 @@ void ShenandoahHeapRegion::do_commit() {
   if (!heap->commit_bitmap_slice(this)) {
     report_java_out_of_memory("Unable to commit bitmaps for region");
   }
+  if (_numa_node >= 0 && !heap->is_heap_region_special()) {
+    os::numa_make_local((char *) bottom(), RegionSizeBytes, _numa_node);
+  }
   if (AlwaysPreTouch) {
     os::pretouch_memory(bottom(), end(), heap->pretouch_heap_page_size());
   }
   heap->increase_committed(ShenandoahHeapRegion::region_size_bytes());
+
+  double uncommitted_secs = (_uncommit_time < 0) ? -1 : os::elapsedTime() - _uncommit_time;
+  heap->record_region_commit(os::elapsed_counter() - start, uncommitted_secs);
+
+  if (evt.should_commit()) {
+    evt.set_index((unsigned) _index);
+    evt.set_committed(true);
+    evt.set_uncommittedTime((s8)(uncommitted_secs * 1000));
+    evt.commit();
+  }
+}
+
+void ShenandoahHeapRegion::set_numa_node(int node) {
+  _numa_node = node;
+  if (is_committed() && !ShenandoahHeap::heap()->is_heap_region_special()) {
+    os::numa_make_local((char *) bottom(), RegionSizeBytes, node);
+  }
 }
 
 void ShenandoahHeapRegion::do_uncommit() {
+  EventShenandoahHeapRegionCommit evt;
+  jlong start = os::elapsed_counter();
+
   ShenandoahHeap* heap = ShenandoahHeap::heap();
   if (!heap->is_heap_region_special() && !os::uncommit_memory((char *) bottom(), RegionSizeBytes)) {
     report_java_out_of_memory("Unable to uncommit region");
@@ -639,6 +670,16 @@ void ShenandoahHeapRegion::do_uncommit() {
     report_java_out_of_memory("Unable to uncommit bitmaps for region");
   }
   heap->decrease_committed(ShenandoahHeapRegion::region_size_bytes());
+
+  _uncommit_time = os::elapsedTime();
+  heap->record_region_uncommit(os::elapsed_counter() - start);
+
+  if (evt.should_commit()) {
+    evt.set_index((unsigned) _index);
+    evt.set_committed(false);
+    evt.set_uncommittedTime(-1);
+    evt.commit();
+  }
 }
 
 void ShenandoahHeapRegion::set_state(RegionState to) {
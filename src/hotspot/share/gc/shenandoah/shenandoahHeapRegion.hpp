@@ -230,6 +230,7 @@ private:
   // Rarely updated fields
   HeapWord* _new_top;
   double _empty_time;
+  double _uncommit_time;
 
   // Seldom updated fields
   RegionState _state;
@@ -243,6 +244,14 @@ private:
   volatile size_t _live_data;
   volatile size_t _critical_pins;
 
+  // Number of completed marks this region has survived since it was
+  // last recycled. Regions of age 0 hold only data allocated since the
+  // previous mark; this is the nursery a generational mode would collect.
+  uint _age;
+
+  // NUMA node the region memory is bound to, or -1 if there is no affinity.
+  int _numa_node;
+
   HeapWord* volatile _update_watermark;
 
 public:
@@ -350,6 +359,13 @@ public:
 
   inline size_t garbage() const;
 
+  uint age() const              { return _age; }
+  void increment_age()          { if (_age < max_juint) _age++; }
+  void reset_age()              { _age = 0; }
+
+  int numa_node() const         { return _numa_node; }
+  void set_numa_node(int node);
+
   void print_on(outputStream* st) const;
 
   void recycle();
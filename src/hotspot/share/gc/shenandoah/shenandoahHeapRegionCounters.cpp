@@ -30,8 +30,21 @@
 #include "runtime/perfData.inline.hpp"
 
 ShenandoahHeapRegionCounters::ShenandoahHeapRegionCounters() :
-  _last_sample_millis(0)
+  _name_space(NULL),
+  _last_sample_millis(0),
+  _commits(NULL),
+  _commit_time(NULL),
+  _uncommits(NULL),
+  _uncommit_time(NULL)
 {
+  if (UsePerfData) {
+    EXCEPTION_MARK;
+    ResourceMark rm;
+    const char* cns = PerfDataManager::name_space("shenandoah", "regions");
+    create_commit_counters(cns, "commit", &_commits, &_commit_time, _commit_latency, CHECK);
+    create_commit_counters(cns, "uncommit", &_uncommits, &_uncommit_time, _uncommit_latency, CHECK);
+  }
+
   if (UsePerfData && ShenandoahRegionSampling) {
     EXCEPTION_MARK;
     ResourceMark rm;
@@ -67,6 +80,55 @@ ShenandoahHeapRegionCounters::ShenandoahHeapRegionCounters() :
   }
 }
 
+void ShenandoahHeapRegionCounters::create_commit_counters(const char* ns, const char* name,
+                                                          PerfLongCounter** count, PerfLongCounter** time,
+                                                          PerfLongCounter** latency, TRAPS) {
+  stringStream ss;
+  ss.print("%ss", name);
+  const char* cname = PerfDataManager::counter_name(ns, ss.as_string());
+  *count = PerfDataManager::create_long_counter(SUN_GC, cname, PerfData::U_Events, CHECK);
+
+  ss.reset();
+  ss.print("%s_time", name);
+  cname = PerfDataManager::counter_name(ns, ss.as_string());
+  *time = PerfDataManager::create_long_counter(SUN_GC, cname, PerfData::U_Ticks, CHECK);
+
+  ss.reset();
+  ss.print("%s_latency", name);
+  const char* lns = PerfDataManager::name_space(ns, ss.as_string());
+  for (uint i = 0; i < LATENCY_BUCKETS; i++) {
+    cname = PerfDataManager::counter_name(lns, err_msg("%u", i));
+    latency[i] = PerfDataManager::create_long_counter(SUN_GC, cname, PerfData::U_Events, CHECK);
+  }
+}
+
+uint ShenandoahHeapRegionCounters::latency_bucket(jlong ticks) {
+  double us = (double) ticks * 1000000 / os::elapsed_frequency();
+  uint bucket = 0;
+  double limit = 10;
+  while (bucket < LATENCY_BUCKETS - 1 && us >= limit) {
+    bucket++;
+    limit *= 10;
+  }
+  return bucket;
+}
+
+void ShenandoahHeapRegionCounters::record_commit(jlong ticks) {
+  if (_commits != NULL) {
+    _commits->inc();
+    _commit_time->inc(ticks);
+    _commit_latency[latency_bucket(ticks)]->inc();
+  }
+}
+
+void ShenandoahHeapRegionCounters::record_uncommit(jlong ticks) {
+  if (_uncommits != NULL) {
+    _uncommits->inc();
+    _uncommit_time->inc(ticks);
+    _uncommit_latency[latency_bucket(ticks)]->inc();
+  }
+}
+
 ShenandoahHeapRegionCounters::~ShenandoahHeapRegionCounters() {
   if (_name_space != NULL) FREE_C_HEAP_ARRAY(char, _name_space);
 }
@@ -55,6 +55,15 @@
  * - bits 51-57  <reserved>
  * - bits 58-63  status
  *      - bits describe the state as recorded in ShenandoahHeapRegion
+ *
+ * region commit and uncommit statistics, recorded regardless of sampling:
+ * - sun.gc.shenandoah.regions.commits          number of region commits
+ * - sun.gc.shenandoah.regions.commit_time      total time spent in region commits, in ticks
+ * - sun.gc.shenandoah.regions.commit_latency.$i
+ *     number of region commits that took [10^i; 10^(i+1)) us, with the first bucket
+ *     starting at 0, and the last bucket unbounded
+ * - sun.gc.shenandoah.regions.uncommits, .uncommit_time, .uncommit_latency.$i
+ *     same for region uncommits
  */
 class ShenandoahHeapRegionCounters : public CHeapObj<mtGC>  {
 private:
@@ -69,16 +78,34 @@ private:
 
   static const jlong STATUS_SHIFT = 58;
 
+  static const uint LATENCY_BUCKETS = 6;
+
   char* _name_space;
   PerfLongVariable** _regions_data;
   PerfLongVariable* _timestamp;
   PerfLongVariable* _status;
   volatile jlong _last_sample_millis;
 
+  PerfLongCounter* _commits;
+  PerfLongCounter* _commit_time;
+  PerfLongCounter* _commit_latency[LATENCY_BUCKETS];
+  PerfLongCounter* _uncommits;
+  PerfLongCounter* _uncommit_time;
+  PerfLongCounter* _uncommit_latency[LATENCY_BUCKETS];
+
+  static uint latency_bucket(jlong ticks);
+  static void create_commit_counters(const char* ns, const char* name,
+                                     PerfLongCounter** count, PerfLongCounter** time,
+                                     PerfLongCounter** latency, TRAPS);
+
 public:
   ShenandoahHeapRegionCounters();
   ~ShenandoahHeapRegionCounters();
   void update();
+
+  // Called with the heap lock held
+  void record_commit(jlong ticks);
+  void record_uncommit(jlong ticks);
 };
 
 #endif // SHARE_VM_GC_SHENANDOAH_SHENANDOAHHEAPREGIONCOUNTERS_HPP
@@ -51,6 +51,8 @@ public:
  CollectorCounters* concurrent_collection_counters();
  CollectorCounters* partial_collection_counters();
  void update_counters();
+
+ ShenandoahHeapRegionCounters* heap_region_counters() { return _heap_region_counters; }
 };
 
 #endif // SHARE_VM_GC_SHENANDOAH_SHENANDOAHMONITORINGSUPPORT_HPP
@@ -24,8 +24,54 @@
 
 #include "precompiled.hpp"
 
+#include "classfile/stringTable.hpp"
+#include "gc/shared/oopStorageParState.inline.hpp"
 #include "gc/shenandoah/shenandoahClosures.inline.hpp"
 #include "gc/shenandoah/shenandoahCodeRoots.hpp"
 #include "gc/shenandoah/shenandoahEvacOOMHandler.hpp"
+#include "gc/shenandoah/shenandoahHeap.inline.hpp"
+#include "gc/shenandoah/shenandoahMarkingContext.inline.hpp"
 #include "gc/shenandoah/shenandoahParallelCleaning.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/safepoint.hpp"
+
+class ShenandoahConcurrentWeakRootsClosure : public OopClosure {
+private:
+  ShenandoahMarkingContext* const _mark_context;
+  size_t _dead;
+
+public:
+  ShenandoahConcurrentWeakRootsClosure() :
+    _mark_context(ShenandoahHeap::heap()->complete_marking_context()), _dead(0) {}
+
+  void do_oop(oop* p) {
+    oop obj = RawAccess<>::oop_load(p);
+    if (!CompressedOops::is_null(obj) && !_mark_context->is_marked(obj)) {
+      // Entries are only ever cleared concurrently, so losing the race is fine.
+      if (Atomic::cmpxchg((oop)NULL, p, obj) == obj) {
+        _dead++;
+      }
+    }
+  }
+
+  void do_oop(narrowOop* p) { ShouldNotReachHere(); }
+
+  size_t dead() const { return _dead; }
+};
+
+ShenandoahConcurrentWeakRootsCleaningTask::ShenandoahConcurrentWeakRootsCleaningTask(uint num_workers) :
+  AbstractGangTask("Concurrent Weak Root Cleaning Task"),
+  _par_state_string(StringTable::weak_storage()) {
+  assert(!SafepointSynchronize::is_at_safepoint(), "Should not be at a safepoint");
+  StringTable::reset_dead_counter();
+}
+
+ShenandoahConcurrentWeakRootsCleaningTask::~ShenandoahConcurrentWeakRootsCleaningTask() {
+  StringTable::finish_dead_counter();
+}
+
+void ShenandoahConcurrentWeakRootsCleaningTask::work(uint worker_id) {
+  ShenandoahConcurrentWeakRootsClosure cl;
+  _par_state_string.oops_do(&cl);
+  StringTable::inc_dead_counter(cl.dead());
+}
@@ -41,10 +41,24 @@ public:
   ShenandoahParallelWeakRootsCleaningTask(ShenandoahPhaseTimings::Phase phase,
                                           IsAlive* is_alive,
                                           KeepAlive* keep_alive,
-                                          uint num_workers);
+                                          uint num_workers,
+                                          bool string_table = true);
   ~ShenandoahParallelWeakRootsCleaningTask();
 
   void work(uint worker_id);
 };
 
+// Clear the string table entries of dead objects concurrently with the
+// application, after final mark. Mutators that load a dead entry in the
+// meantime get NULL from the barrier, see ShenandoahBarrierSet.
+class ShenandoahConcurrentWeakRootsCleaningTask : public AbstractGangTask {
+private:
+  OopStorage::ParState<true /* concurrent */, false /* is_const */> _par_state_string;
+public:
+  ShenandoahConcurrentWeakRootsCleaningTask(uint num_workers);
+  ~ShenandoahConcurrentWeakRootsCleaningTask();
+
+  void work(uint worker_id);
+};
+
 #endif // SHARE_GC_SHENANDOAH_SHENANDOAHPARALLELCLEANING_HPP
@@ -34,9 +34,10 @@ template<typename IsAlive, typename KeepAlive>
 ShenandoahParallelWeakRootsCleaningTask<IsAlive, KeepAlive>::ShenandoahParallelWeakRootsCleaningTask(ShenandoahPhaseTimings::Phase phase,
                                                                                                      IsAlive* is_alive,
                                                                                                      KeepAlive* keep_alive,
-                                                                                                     uint num_workers) :
+                                                                                                     uint num_workers,
+                                                                                                     bool string_table) :
   AbstractGangTask("Parallel Weak Root Cleaning Task"),
-  _phase(phase), _weak_roots(phase, num_workers),
+  _phase(phase), _weak_roots(phase, num_workers, string_table),
   _is_alive(is_alive), _keep_alive(keep_alive) {
   assert(SafepointSynchronize::is_at_safepoint(), "Must be at a safepoint");
 
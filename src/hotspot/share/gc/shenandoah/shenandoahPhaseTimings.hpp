@@ -69,6 +69,7 @@ class outputStream;
   f(resize_tlabs,                                   "  Resize TLABs")                  \
                                                                                        \
   f(conc_mark,                                      "Concurrent Marking")              \
+  f(conc_thread_roots,                              "Concurrent Thread Roots")         \
   f(conc_preclean,                                  "Concurrent Precleaning")          \
                                                                                        \
   f(final_mark_gross,                               "Pause Final Mark (G)")            \
@@ -92,6 +93,7 @@ class outputStream;
   f(init_evac,                                      "  Initial Evacuation")            \
   SHENANDOAH_PAR_PHASE_DO(evac_,                    "    E: ", f)                      \
                                                                                        \
+  f(conc_weak_roots,                                "Concurrent Weak Roots")           \
   f(conc_cleanup_early,                             "Concurrent Cleanup")              \
   f(conc_evac,                                      "Concurrent Evacuation")           \
                                                                                        \
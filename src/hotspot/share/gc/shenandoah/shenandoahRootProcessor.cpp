@@ -94,9 +94,10 @@ ShenandoahThreadRoots::~ShenandoahThreadRoots() {
   Threads::assert_all_threads_claimed();
 }
 
-ShenandoahWeakRoots::ShenandoahWeakRoots(ShenandoahPhaseTimings::Phase phase, uint n_workers) :
+ShenandoahWeakRoots::ShenandoahWeakRoots(ShenandoahPhaseTimings::Phase phase, uint n_workers, bool string_table) :
   _phase(phase),
   _par_state_string(StringTable::weak_storage()),
+  _string_table(string_table),
   _claimed(false) {
 }
 
@@ -134,7 +135,9 @@ ShenandoahRootEvacuator::ShenandoahRootEvacuator(uint n_workers, ShenandoahPhase
   _jni_roots(phase),
   _cld_roots(phase, n_workers),
   _thread_roots(phase, n_workers > 1),
-  _weak_roots(phase, n_workers),
+  // The string table may still hold dead objects, which must not be evacuated.
+  // Live entries are fixed up by the barrier on access, and by update-refs.
+  _weak_roots(phase, n_workers, !ShenandoahHeap::heap()->is_concurrent_weak_root_in_progress()),
   _dedup_roots(phase),
   _code_roots(phase) {
 }
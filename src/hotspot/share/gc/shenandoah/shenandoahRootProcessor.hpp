@@ -87,10 +87,11 @@ public:
 class ShenandoahWeakRoots {
   ShenandoahPhaseTimings::Phase      _phase;
   OopStorage::ParState<false, false> _par_state_string;
+  const bool                         _string_table;
   volatile bool                      _claimed;
 
 public:
-  ShenandoahWeakRoots(ShenandoahPhaseTimings::Phase phase, uint n_workers);
+  ShenandoahWeakRoots(ShenandoahPhaseTimings::Phase phase, uint n_workers, bool string_table = true);
   ~ShenandoahWeakRoots();
 
   template <typename IsAlive, typename KeepAlive>
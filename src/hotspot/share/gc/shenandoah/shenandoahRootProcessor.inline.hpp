@@ -39,7 +39,9 @@ void ShenandoahWeakRoots::oops_do(IsAlive* is_alive, KeepAlive* keep_alive, uint
     WeakProcessor::weak_oops_do(is_alive, keep_alive);
   }
 
-  _par_state_string.weak_oops_do<IsAlive, KeepAlive>(is_alive, keep_alive);
+  if (_string_table) {
+    _par_state_string.weak_oops_do<IsAlive, KeepAlive>(is_alive, keep_alive);
+  }
 }
 
 template <bool SINGLE_THREADED>
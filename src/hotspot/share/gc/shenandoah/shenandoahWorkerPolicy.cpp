@@ -35,6 +35,7 @@ uint ShenandoahWorkerPolicy::_prev_degengc         = 0;
 uint ShenandoahWorkerPolicy::_prev_conc_update_ref = 0;
 uint ShenandoahWorkerPolicy::_prev_par_update_ref  = 0;
 uint ShenandoahWorkerPolicy::_prev_conc_cleanup    = 0;
+uint ShenandoahWorkerPolicy::_prev_conc_weak_roots = 0;
 uint ShenandoahWorkerPolicy::_prev_conc_reset      = 0;
 
 uint ShenandoahWorkerPolicy::calc_workers_for_init_marking() {
@@ -61,6 +62,11 @@ uint ShenandoahWorkerPolicy::calc_workers_for_final_marking() {
   return _prev_par_marking;
 }
 
+// Reuse the calculation result from concurrent marking
+uint ShenandoahWorkerPolicy::calc_workers_for_conc_thread_roots() {
+  return _prev_conc_marking;
+}
+
 // Calculate workers for concurrent evacuation (concurrent GC)
 uint ShenandoahWorkerPolicy::calc_workers_for_conc_evac() {
   uint active_workers = (_prev_conc_evac == 0) ? ConcGCThreads : _prev_conc_evac;
@@ -116,6 +122,15 @@ uint ShenandoahWorkerPolicy::calc_workers_for_conc_preclean() {
   return 1;
 }
 
+uint ShenandoahWorkerPolicy::calc_workers_for_conc_weak_roots() {
+  uint active_workers = (_prev_conc_weak_roots == 0) ? ConcGCThreads : _prev_conc_weak_roots;
+  _prev_conc_weak_roots =
+          AdaptiveSizePolicy::calc_active_conc_workers(ConcGCThreads,
+                                                       active_workers,
+                                                       Threads::number_of_non_daemon_threads());
+  return _prev_conc_weak_roots;
+}
+
 uint ShenandoahWorkerPolicy::calc_workers_for_conc_cleanup() {
   uint active_workers = (_prev_conc_cleanup == 0) ? ConcGCThreads : _prev_conc_cleanup;
   _prev_conc_cleanup =
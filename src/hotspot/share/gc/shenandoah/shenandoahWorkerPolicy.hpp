@@ -36,6 +36,7 @@ private:
   static uint _prev_conc_update_ref;
   static uint _prev_par_update_ref;
   static uint _prev_conc_cleanup;
+  static uint _prev_conc_weak_roots;
   static uint _prev_conc_reset;
 
 public:
@@ -48,6 +49,9 @@ public:
   // Calculate the number of workers for final marking
   static uint calc_workers_for_final_marking();
 
+  // Calculate the number of workers for concurrent thread roots marking
+  static uint calc_workers_for_conc_thread_roots();
+
   // Calculate workers for concurrent evacuation (concurrent GC)
   static uint calc_workers_for_conc_evac();
 
@@ -66,6 +70,9 @@ public:
   // Calculate workers for concurrent precleaning
   static uint calc_workers_for_conc_preclean();
 
+  // Calculate workers for concurrent weak root processing
+  static uint calc_workers_for_conc_weak_roots();
+
   // Calculate workers for concurrent cleanup
   static uint calc_workers_for_conc_cleanup();
 
@@ -127,6 +127,24 @@
           "cases. In percents of total heap size.")                         \
           range(0,100)                                                      \
                                                                             \
+  experimental(uintx, ShenandoahAdaptiveSampleFrequencyHz, 10,              \
+          "The number of times per second to update the allocation rate "   \
+          "moving average used by adaptive heuristics to detect "           \
+          "allocation spikes.")                                             \
+          range(1, 1000)                                                    \
+                                                                            \
+  experimental(uintx, ShenandoahAdaptiveSampleSizeSeconds, 10,              \
+          "The size of the moving window over which the allocation rate "   \
+          "samples are averaged, in seconds.")                              \
+          range(1, 1000)                                                    \
+                                                                            \
+  experimental(double, ShenandoahAdaptiveSpikeThreshold, 1.8,               \
+          "If the most recently sampled allocation rate is more than "      \
+          "this many standard deviations above the moving average, "        \
+          "adaptive heuristics treat it as a spike and check the free "     \
+          "headroom against that rate instead of the average one.")         \
+          range(0.0, 100.0)                                                 \
+                                                                            \
   experimental(uintx, ShenandoahLearningSteps, 5,                           \
           "The number of cycles some heuristics take to collect in order "  \
           "to learn application and GC performance.")                       \
@@ -165,6 +183,11 @@
           "milliseconds. Setting this delay to 0 effectively uncommits "    \
           "regions almost immediately after they become unused.")           \
                                                                             \
+  experimental(bool, ShenandoahUncommitAdaptiveDelay, true,                 \
+          "Double the uncommit delay, up to 16x ShenandoahUncommitDelay, "  \
+          "when regions get committed back sooner than the delay after "    \
+          "being uncommitted. The delay decays back once recommits stop.")  \
+                                                                            \
   experimental(bool, ShenandoahRegionSampling, false,                       \
           "Provide heap region sampling data via jvmstat.")                 \
                                                                             \
@@ -227,6 +250,11 @@
           "reserve/waste is incorrect, at the risk that application "       \
           "runs out of memory too early.")                                  \
                                                                             \
+  experimental(bool, ShenandoahNUMARegionAffinity, false,                   \
+          "Bind heap regions to NUMA nodes in contiguous stripes, and "     \
+          "make allocations prefer regions local to the node the "          \
+          "allocating thread runs on. Requires UseNUMA.")                   \
+                                                                            \
   experimental(bool, ShenandoahPacing, true,                                \
           "Pace application allocations to give GC chance to start "        \
           "and complete before allocation failure is reached.")             \
@@ -323,6 +351,15 @@
           "definitely alive references to avoid dealing with them during "  \
           "pause.")                                                         \
                                                                             \
+  experimental(bool, ShenandoahConcurrentWeakRoots, true,                   \
+          "Clean the string table weak roots in a concurrent phase after "  \
+          "the final mark pause, instead of in the pause itself.")          \
+                                                                            \
+  experimental(bool, ShenandoahConcurrentThreadRoots, true,                 \
+          "Mark through thread stack roots with a handshake after "         \
+          "concurrent marking, so that the final mark pause finds most "    \
+          "of their referents already marked.")                             \
+                                                                            \
   experimental(bool, ShenandoahSuspendibleWorkers, false,                   \
           "Suspend concurrent GC worker threads at safepoints")             \
                                                                             \
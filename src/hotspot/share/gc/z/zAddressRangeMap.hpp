@@ -45,7 +45,9 @@ public:
   ~ZAddressRangeMap();
 
   T get(uintptr_t addr) const;
+  T get_acquire(uintptr_t addr) const;
   void put(uintptr_t addr, T value);
+  void release_put(uintptr_t addr, T value);
 };
 
 template <typename T, size_t AddressRangeShift>
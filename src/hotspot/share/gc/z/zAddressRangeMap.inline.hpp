@@ -28,6 +28,7 @@
 #include "gc/z/zAddressRangeMap.hpp"
 #include "gc/z/zGlobals.hpp"
 #include "memory/allocation.inline.hpp"
+#include "runtime/orderAccess.hpp"
 
 template <typename T, size_t AddressRangeShift>
 ZAddressRangeMap<T, AddressRangeShift>::ZAddressRangeMap() :
@@ -59,12 +60,24 @@ T ZAddressRangeMap<T, AddressRangeShift>::get(uintptr_t addr) const {
   return _map[index];
 }
 
+template <typename T, size_t AddressRangeShift>
+T ZAddressRangeMap<T, AddressRangeShift>::get_acquire(uintptr_t addr) const {
+  const uintptr_t index = index_for_addr(addr);
+  return OrderAccess::load_acquire(_map + index);
+}
+
 template <typename T, size_t AddressRangeShift>
 void ZAddressRangeMap<T, AddressRangeShift>::put(uintptr_t addr, T value) {
   const uintptr_t index = index_for_addr(addr);
   _map[index] = value;
 }
 
+template <typename T, size_t AddressRangeShift>
+void ZAddressRangeMap<T, AddressRangeShift>::release_put(uintptr_t addr, T value) {
+  const uintptr_t index = index_for_addr(addr);
+  OrderAccess::release_store(_map + index, value);
+}
+
 template <typename T, size_t AddressRangeShift>
 inline ZAddressRangeMapIterator<T, AddressRangeShift>::ZAddressRangeMapIterator(const ZAddressRangeMap<T, AddressRangeShift>* map) :
     _map(map),
@@ -33,7 +33,7 @@
 //
 //   7    3 2 1 0
 //  +----+-+-+-+-+
-//  |0000|1|1|1|1|
+//  |1111|1|1|1|1|
 //  +----+-+-+-+-+
 //  |    | | | |
 //  |    | | | * 0-0 Worker Thread Flag (1-bit)
@@ -44,7 +44,7 @@
 //  |    |
 //  |    * 3-3 No Reserve Flag (1-bit)
 //  |
-//  * 7-4 Unused (4-bits)
+//  * 7-4 NUMA Id Plus One (4-bits), zero means no NUMA id
 //
 
 class ZAllocationFlags {
@@ -53,6 +53,9 @@ private:
   typedef ZBitField<uint8_t, bool, 1, 1> field_non_blocking;
   typedef ZBitField<uint8_t, bool, 2, 1> field_relocation;
   typedef ZBitField<uint8_t, bool, 3, 1> field_no_reserve;
+  typedef ZBitField<uint8_t, uint8_t, 4, 4> field_numa_id;
+
+  static const uint32_t numa_id_limit = 15;
 
   uint8_t _flags;
 
@@ -76,6 +79,14 @@ public:
     _flags |= field_no_reserve::encode(true);
   }
 
+  void set_numa_id(uint32_t numa_id) {
+    assert(!has_numa_id(), "Already set");
+    if (numa_id < numa_id_limit) {
+      // NUMA ids too large to be encoded are ignored
+      _flags |= field_numa_id::encode((uint8_t)(numa_id + 1));
+    }
+  }
+
   bool worker_thread() const {
     return field_worker_thread::decode(_flags);
   }
@@ -91,6 +102,15 @@ public:
   bool no_reserve() const {
     return field_no_reserve::decode(_flags);
   }
+
+  bool has_numa_id() const {
+    return field_numa_id::decode(_flags) != 0;
+  }
+
+  uint32_t numa_id() const {
+    assert(has_numa_id(), "Not set");
+    return field_numa_id::decode(_flags) - 1;
+  }
 };
 
 #endif // SHARE_GC_Z_ZALLOCATIONFLAGS_HPP
@@ -47,6 +47,7 @@ ZCollectedHeap::ZCollectedHeap(ZCollectorPolicy* policy) :
     _heap(),
     _director(new ZDirector()),
     _driver(new ZDriver()),
+    _uncommitter(new ZUncommitter()),
     _stat(new ZStat()),
     _runtime_workers() {}
 
@@ -76,6 +77,7 @@ void ZCollectedHeap::initialize_serviceability() {
 void ZCollectedHeap::stop() {
   _director->stop();
   _driver->stop();
+  _uncommitter->stop();
   _stat->stop();
 }
 
@@ -240,6 +242,10 @@ void ZCollectedHeap::safe_object_iterate(ObjectClosure* cl) {
   _heap.object_iterate(cl, true /* visit_referents */);
 }
 
+ParallelObjectIterator* ZCollectedHeap::parallel_object_iterator(uint nworkers) {
+  return _heap.parallel_object_iterator(nworkers, true /* visit_referents */);
+}
+
 HeapWord* ZCollectedHeap::block_start(const void* addr) const {
   return (HeapWord*)_heap.block_start((uintptr_t)addr);
 }
@@ -278,6 +284,7 @@ jlong ZCollectedHeap::millis_since_last_gc() {
 void ZCollectedHeap::gc_threads_do(ThreadClosure* tc) const {
   tc->do_thread(_director);
   tc->do_thread(_driver);
+  tc->do_thread(_uncommitter);
   tc->do_thread(_stat);
   _heap.worker_threads_do(tc);
   _runtime_workers.threads_do(tc);
@@ -329,6 +336,8 @@ void ZCollectedHeap::print_gc_threads_on(outputStream* st) const {
   st->cr();
   _driver->print_on(st);
   st->cr();
+  _uncommitter->print_on(st);
+  st->cr();
   _stat->print_on(st);
   st->cr();
   _heap.print_worker_threads_on(st);
@@ -28,9 +28,32 @@
 #include "gc/z/zStat.hpp"
 #include "gc/z/zUtils.hpp"
 #include "logging/log.hpp"
+#include "runtime/timer.hpp"
+
+static const ZStatCounter ZCounterRuleTimer("Director", "Rule Timer", ZStatUnitOpsPerSecond);
+static const ZStatCounter ZCounterRuleWarmup("Director", "Rule Warmup", ZStatUnitOpsPerSecond);
+static const ZStatCounter ZCounterRuleAllocationRate("Director", "Rule Allocation Rate", ZStatUnitOpsPerSecond);
+static const ZStatCounter ZCounterRuleProactive("Director", "Rule Proactive", ZStatUnitOpsPerSecond);
+static const ZStatSampler ZSamplerTimerTimeUntilGC("Director", "Rule Timer Time Until GC", ZStatUnitTime);
+static const ZStatSampler ZSamplerWarmupUsedUntilGC("Director", "Rule Warmup Used Until GC", ZStatUnitBytes);
+static const ZStatSampler ZSamplerAllocationRateTimeUntilGC("Director", "Rule Allocation Rate Time Until GC", ZStatUnitTime);
+static const ZStatSampler ZSamplerProactiveTimeUntilGC("Director", "Rule Proactive Time Until GC", ZStatUnitTime);
+static const ZStatSampler ZSamplerTimeUntilOOM("Director", "Time Until OOM", ZStatUnitTime);
+static const ZStatSampler ZSamplerMaxAllocationRate("Director", "Max Allocation Rate", ZStatUnitBytesPerSecond);
 
 const double ZDirector::one_in_1000 = 3.290527;
 
+// Director samples are always traced, so that rule evaluations
+// can be followed in JFR and not only in the statistics log.
+static void sample_bytes(const ZStatSampler& sampler, double bytes) {
+  ZStatSample(sampler, (uint64_t)MAX2(bytes, 0.0), true /* trace */);
+}
+
+static void sample_time(const ZStatSampler& sampler, double seconds) {
+  const jlong ms = (jlong)(MAX2(seconds, 0.0) * MILLIUNITS);
+  ZStatSample(sampler, (uint64_t)TimeHelper::millis_to_counter(ms), true /* trace */);
+}
+
 ZDirector::ZDirector() :
     _metronome(ZStatAllocRate::sample_hz) {
   set_name("ZDirector");
@@ -42,10 +65,11 @@ void ZDirector::sample_allocation_rate() const {
   // below to estimate the time we have until we run out of memory.
   const double bytes_per_second = ZStatAllocRate::sample_and_reset();
 
-  log_debug(gc, alloc)("Allocation Rate: %.3fMB/s, Avg: %.3f(+/-%.3f)MB/s",
+  log_debug(gc, alloc)("Allocation Rate: %.3fMB/s, Predicted: %.3fMB/s, Avg: %.3f(+/-%.3f)MB/s",
                        bytes_per_second / M,
+                       ZStatAllocRate::predict() / M,
                        ZStatAllocRate::avg() / M,
-                       ZStatAllocRate::avg_sd() / M);
+                       ZStatAllocRate::sd() / M);
 }
 
 bool ZDirector::is_first() const {
@@ -69,6 +93,8 @@ bool ZDirector::rule_timer() const {
   log_debug(gc, director)("Rule: Timer, Interval: %us, TimeUntilGC: %.3lfs",
                           ZCollectionInterval, time_until_gc);
 
+  sample_time(ZSamplerTimerTimeUntilGC, time_until_gc);
+
   return time_until_gc <= 0;
 }
 
@@ -81,14 +107,16 @@ bool ZDirector::rule_warmup() const {
   // Perform GC if heap usage passes 10/20/30% and no other GC has been
   // performed yet. This allows us to get some early samples of the GC
   // duration, which is needed by the other rules.
-  const size_t max_capacity = ZHeap::heap()->current_max_capacity();
+  const size_t soft_max_capacity = ZHeap::heap()->soft_max_capacity();
   const size_t used = ZHeap::heap()->used();
   const double used_threshold_percent = (ZStatCycle::ncycles() + 1) * 0.1;
-  const size_t used_threshold = max_capacity * used_threshold_percent;
+  const size_t used_threshold = soft_max_capacity * used_threshold_percent;
 
   log_debug(gc, director)("Rule: Warmup %.0f%%, Used: " SIZE_FORMAT "MB, UsedThreshold: " SIZE_FORMAT "MB",
                           used_threshold_percent * 100, used / M, used_threshold / M);
 
+  sample_bytes(ZSamplerWarmupUsedUntilGC, (double)used_threshold - (double)used);
+
   return used >= used_threshold;
 }
 
@@ -100,26 +128,30 @@ bool ZDirector::rule_allocation_rate() const {
 
   // Perform GC if the estimated max allocation rate indicates that we
   // will run out of memory. The estimated max allocation rate is based
-  // on the moving average of the sampled allocation rate plus a safety
-  // margin based on variations in the allocation rate and unforeseen
-  // allocation spikes.
+  // on the larger of the predicted and the moving average allocation
+  // rate, plus a safety margin based on variations in the allocation
+  // rate and unforeseen allocation spikes.
 
   // Calculate amount of free memory available to Java threads. Note that
   // the heap reserve is not available to Java threads and is therefore not
-  // considered part of the free memory.
-  const size_t max_capacity = ZHeap::heap()->current_max_capacity();
+  // considered part of the free memory. The free memory is calculated
+  // against the soft max capacity, which the heap size is kept below.
+  const size_t soft_max_capacity = ZHeap::heap()->soft_max_capacity();
   const size_t max_reserve = ZHeap::heap()->max_reserve();
   const size_t used = ZHeap::heap()->used();
-  const size_t free_with_reserve = max_capacity - used;
+  const size_t free_with_reserve = soft_max_capacity - MIN2(soft_max_capacity, used);
   const size_t free = free_with_reserve - MIN2(free_with_reserve, max_reserve);
 
   // Calculate time until OOM given the max allocation rate and the amount
-  // of free memory. The allocation rate is a moving average and we multiply
-  // that with an allocation spike tolerance factor to guard against unforeseen
-  // phase changes in the allocate rate. We then add ~3.3 sigma to account for
-  // the allocation rate variance, which means the probability is 1 in 1000
-  // that a sample is outside of the confidence interval.
-  const double max_alloc_rate = (ZStatAllocRate::avg() * ZAllocationSpikeTolerance) + (ZStatAllocRate::avg_sd() * one_in_1000);
+  // of free memory. The allocation rate is the larger of the linear prediction
+  // of the next sample and the moving average, so that a rising rate is caught
+  // before the average catches up. We multiply that with an allocation spike
+  // tolerance factor to guard against unforeseen phase changes in the allocate
+  // rate. We then add ~3.3 sigma of the sampled allocation rate to account for
+  // its variance, which means the probability is 1 in 1000 that a sample is
+  // outside of the confidence interval.
+  const double alloc_rate = MAX2(ZStatAllocRate::predict(), ZStatAllocRate::avg());
+  const double max_alloc_rate = (alloc_rate * ZAllocationSpikeTolerance) + (ZStatAllocRate::sd() * one_in_1000);
   const double time_until_oom = free / (max_alloc_rate + 1.0); // Plus 1.0B/s to avoid division by zero
 
   // Calculate max duration of a GC cycle. The duration of GC is a moving
@@ -136,6 +168,10 @@ bool ZDirector::rule_allocation_rate() const {
   log_debug(gc, director)("Rule: Allocation Rate, MaxAllocRate: %.3lfMB/s, Free: " SIZE_FORMAT "MB, MaxDurationOfGC: %.3lfs, TimeUntilGC: %.3lfs",
                           max_alloc_rate / M, free / M, max_duration_of_gc, time_until_gc);
 
+  sample_bytes(ZSamplerMaxAllocationRate, max_alloc_rate);
+  sample_time(ZSamplerTimeUntilOOM, time_until_oom);
+  sample_time(ZSamplerAllocationRateTimeUntilGC, time_until_gc);
+
   return time_until_gc <= 0;
 }
 
@@ -155,7 +191,7 @@ bool ZDirector::rule_proactive() const {
   // passed since the previous GC. This helps avoid superfluous GCs when running
   // applications with very low allocation rate.
   const size_t used_after_last_gc = ZStatHeap::used_at_relocate_end();
-  const size_t used_increase_threshold = ZHeap::heap()->current_max_capacity() * 0.10; // 10%
+  const size_t used_increase_threshold = ZHeap::heap()->soft_max_capacity() * 0.10; // 10%
   const size_t used_threshold = used_after_last_gc + used_increase_threshold;
   const size_t used = ZHeap::heap()->used();
   const double time_since_last_gc = ZStatCycle::time_since_last();
@@ -178,27 +214,33 @@ bool ZDirector::rule_proactive() const {
   log_debug(gc, director)("Rule: Proactive, AcceptableGCInterval: %.3lfs, TimeSinceLastGC: %.3lfs, TimeUntilGC: %.3lfs",
                           acceptable_gc_interval, time_since_last_gc, time_until_gc);
 
+  sample_time(ZSamplerProactiveTimeUntilGC, time_until_gc);
+
   return time_until_gc <= 0;
 }
 
 GCCause::Cause ZDirector::make_gc_decision() const {
   // Rule 0: Timer
   if (rule_timer()) {
+    ZStatInc(ZCounterRuleTimer, 1, true /* trace */);
     return GCCause::_z_timer;
   }
 
   // Rule 1: Warmup
   if (rule_warmup()) {
+    ZStatInc(ZCounterRuleWarmup, 1, true /* trace */);
     return GCCause::_z_warmup;
   }
 
   // Rule 2: Allocation rate
   if (rule_allocation_rate()) {
+    ZStatInc(ZCounterRuleAllocationRate, 1, true /* trace */);
     return GCCause::_z_allocation_rate;
   }
 
   // Rule 3: Proactive
   if (rule_proactive()) {
+    ZStatInc(ZCounterRuleProactive, 1, true /* trace */);
     return GCCause::_z_proactive;
   }
 
@@ -40,6 +40,7 @@
 #include "gc/z/zTask.hpp"
 #include "gc/z/zThread.hpp"
 #include "gc/z/zTracer.inline.hpp"
+#include "gc/z/zUnload.hpp"
 #include "gc/z/zVirtualMemory.inline.hpp"
 #include "gc/z/zWorkers.inline.hpp"
 #include "logging/log.hpp"
@@ -111,6 +112,16 @@ size_t ZHeap::current_max_capacity() const {
   return _page_allocator.current_max_capacity();
 }
 
+size_t ZHeap::soft_max_capacity() const {
+  const size_t current_max = current_max_capacity();
+  if (ZSoftMaxHeapSize == 0) {
+    // Not set
+    return current_max;
+  }
+
+  return MIN2(ZSoftMaxHeapSize, current_max);
+}
+
 size_t ZHeap::capacity() const {
   return _page_allocator.capacity();
 }
@@ -251,6 +262,10 @@ void ZHeap::release_page(ZPage* page, bool reclaimed) {
   }
 }
 
+uint64_t ZHeap::uncommit(uint64_t delay) {
+  return _page_allocator.uncommit(delay);
+}
+
 void ZHeap::flip_views() {
   // For debugging only
   if (ZUnmapBadViews) {
@@ -342,9 +357,6 @@ bool ZHeap::mark_end() {
   // Enter mark completed phase
   ZGlobalPhase = ZPhaseMarkCompleted;
 
-  // Resize metaspace
-  MetaspaceGC::compute_new_size();
-
   // Update statistics
   ZStatSample(ZSamplerHeapUsedAfterMark, used());
   ZStatHeap::set_at_mark_end(capacity(), allocated(), used());
@@ -355,6 +367,13 @@ bool ZHeap::mark_end() {
   // Process weak roots
   _weak_roots_processor.process_weak_roots();
 
+  // Unload classes
+  ZUnload::unlink();
+  ZUnload::purge();
+
+  // Resize metaspace
+  MetaspaceGC::compute_new_size();
+
   // Verification
   if (VerifyBeforeGC || VerifyDuringGC || VerifyAfterGC) {
     Universe::verify();
@@ -510,8 +529,13 @@ void ZHeap::relocate() {
 void ZHeap::object_iterate(ObjectClosure* cl, bool visit_referents) {
   assert(SafepointSynchronize::is_at_safepoint(), "Should be at safepoint");
 
-  ZHeapIterator iter(visit_referents);
-  iter.objects_do(cl);
+  ZHeapIterator iter(1 /* nworkers */, visit_referents);
+  iter.object_iterate(cl, 0 /* worker_id */);
+}
+
+ParallelObjectIterator* ZHeap::parallel_object_iterator(uint nworkers, bool visit_referents) {
+  assert(SafepointSynchronize::is_at_safepoint(), "Should be at safepoint");
+  return new ZHeapIterator(nworkers, visit_referents);
 }
 
 void ZHeap::serviceability_initialize() {
@@ -44,6 +44,8 @@
 #include "gc/z/zWorkers.hpp"
 #include "memory/allocation.hpp"
 
+class ParallelObjectIterator;
+
 class ZHeap {
   friend class VMStructs;
 
@@ -80,6 +82,7 @@ public:
   size_t min_capacity() const;
   size_t max_capacity() const;
   size_t current_max_capacity() const;
+  size_t soft_max_capacity() const;
   size_t capacity() const;
   size_t max_reserve() const;
   size_t used_high() const;
@@ -120,10 +123,13 @@ public:
   bool retain_page(ZPage* page);
   void release_page(ZPage* page, bool reclaimed);
 
+  // Uncommit memory
+  uint64_t uncommit(uint64_t delay);
+
   // Object allocation
   uintptr_t alloc_tlab(size_t size);
   uintptr_t alloc_object(size_t size);
-  uintptr_t alloc_object_for_relocation(size_t size);
+  uintptr_t alloc_object_for_relocation(size_t size, uint32_t numa_id);
   void undo_alloc_object_for_relocation(uintptr_t addr, size_t size);
   bool is_alloc_stalled() const;
   void check_out_of_memory();
@@ -154,6 +160,7 @@ public:
 
   // Iteration
   void object_iterate(ObjectClosure* cl, bool visit_referents);
+  ParallelObjectIterator* parallel_object_iterator(uint nworkers, bool visit_referents);
 
   // Serviceability
   void serviceability_initialize();
@@ -22,10 +22,12 @@
  */
 
 #include "precompiled.hpp"
+#include "gc/shared/taskqueue.inline.hpp"
 #include "gc/z/zAddressRangeMap.inline.hpp"
 #include "gc/z/zBarrier.inline.hpp"
 #include "gc/z/zGlobals.hpp"
 #include "gc/z/zHeapIterator.hpp"
+#include "gc/z/zLock.inline.hpp"
 #include "gc/z/zOop.inline.hpp"
 #include "gc/z/zRootsIterator.hpp"
 #include "memory/iterator.inline.hpp"
@@ -42,31 +44,25 @@ public:
       _map(size_in_bits) {}
 
   bool try_set_bit(size_t index) {
-    if (_map.at(index)) {
-      return false;
-    }
-
-    _map.set_bit(index);
-    return true;
+    return _map.par_set_bit(index);
   }
 };
 
 class ZHeapIteratorRootOopClosure : public OopClosure {
 private:
   ZHeapIterator* const _iter;
-  ObjectClosure* const _cl;
+  const uint           _worker_id;
 
 public:
-  ZHeapIteratorRootOopClosure(ZHeapIterator* iter, ObjectClosure* cl) :
+  ZHeapIteratorRootOopClosure(ZHeapIterator* iter, uint worker_id) :
       _iter(iter),
-      _cl(cl) {}
+      _worker_id(worker_id) {}
 
   virtual void do_oop(oop* p) {
     // Load barrier needed here for the same reason we
     // need fixup_partial_loads() in ZHeap::mark_end()
     const oop obj = ZBarrier::load_barrier_on_oop_field(p);
-    _iter->push(obj);
-    _iter->drain(_cl);
+    _iter->push(obj, _worker_id);
   }
 
   virtual void do_oop(narrowOop* p) {
@@ -78,12 +74,14 @@ class ZHeapIteratorPushOopClosure : public BasicOopIterateClosure {
 private:
   ZHeapIterator* const _iter;
   const oop            _base;
+  const uint           _worker_id;
   const bool           _visit_referents;
 
 public:
-  ZHeapIteratorPushOopClosure(ZHeapIterator* iter, oop base) :
+  ZHeapIteratorPushOopClosure(ZHeapIterator* iter, oop base, uint worker_id) :
       _iter(iter),
       _base(base),
+      _worker_id(worker_id),
       _visit_referents(iter->visit_referents()) {}
 
   oop load_oop(oop* p) {
@@ -100,7 +98,7 @@ public:
 
   virtual void do_oop(oop* p) {
     const oop obj = load_oop(p);
-    _iter->push(obj);
+    _iter->push(obj, _worker_id);
   }
 
   virtual void do_oop(narrowOop* p) {
@@ -114,16 +112,31 @@ public:
 #endif
 };
 
-ZHeapIterator::ZHeapIterator(bool visit_referents) :
-    _visit_stack(),
+ZHeapIterator::ZHeapIterator(uint nworkers, bool visit_referents) :
+    _nworkers(nworkers),
+    _visit_queues(nworkers),
     _visit_map(),
-    _visit_referents(visit_referents) {}
+    _visit_map_lock(),
+    _roots(),
+    _terminator(nworkers, &_visit_queues),
+    _visit_referents(visit_referents) {
+  // Create one visit queue per worker
+  for (uint i = 0; i < _nworkers; i++) {
+    ZVisitQueue* const queue = new ZVisitQueue();
+    queue->initialize();
+    _visit_queues.register_queue(i, queue);
+  }
+}
 
 ZHeapIterator::~ZHeapIterator() {
   ZVisitMapIterator iter(&_visit_map);
   for (ZHeapIteratorBitMap* map; iter.next(&map);) {
     delete map;
   }
+
+  for (uint i = 0; i < _nworkers; i++) {
+    delete _visit_queues.queue(i);
+  }
 }
 
 size_t ZHeapIterator::object_index_max() const {
@@ -139,16 +152,21 @@ size_t ZHeapIterator::object_index(oop obj) const {
 
 ZHeapIteratorBitMap* ZHeapIterator::object_map(oop obj) {
   const uintptr_t addr = ZOop::to_address(obj);
-  ZHeapIteratorBitMap* map = _visit_map.get(addr);
+  ZHeapIteratorBitMap* map = _visit_map.get_acquire(addr);
   if (map == NULL) {
-    map = new ZHeapIteratorBitMap(object_index_max());
-    _visit_map.put(addr, map);
+    // Install a new map, unless another worker beat us to it
+    ZLocker locker(&_visit_map_lock);
+    map = _visit_map.get(addr);
+    if (map == NULL) {
+      map = new ZHeapIteratorBitMap(object_index_max());
+      _visit_map.release_put(addr, map);
+    }
   }
 
   return map;
 }
 
-void ZHeapIterator::push(oop obj) {
+void ZHeapIterator::push(oop obj, uint worker_id) {
   if (obj == NULL) {
     // Ignore
     return;
@@ -162,34 +180,68 @@ void ZHeapIterator::push(oop obj) {
   }
 
   // Push
-  _visit_stack.push(obj);
+  _visit_queues.queue(worker_id)->push(obj);
+}
+
+void ZHeapIterator::visit(ObjectClosure* cl, oop obj, uint worker_id) {
+  // Visit
+  cl->do_object(obj);
+
+  // Push members to visit
+  ZHeapIteratorPushOopClosure push_cl(this, obj, worker_id);
+  obj->oop_iterate(&push_cl);
 }
 
-void ZHeapIterator::drain(ObjectClosure* cl) {
-  while (!_visit_stack.is_empty()) {
-    const oop obj = _visit_stack.pop();
+void ZHeapIterator::drain(ObjectClosure* cl, uint worker_id) {
+  ZVisitQueue* const queue = _visit_queues.queue(worker_id);
+  oop obj;
+
+  do {
+    while (queue->pop_overflow(obj)) {
+      visit(cl, obj, worker_id);
+    }
 
-    // Visit
-    cl->do_object(obj);
+    while (queue->pop_local(obj)) {
+      visit(cl, obj, worker_id);
+    }
+  } while (!queue->is_empty());
+}
 
-    // Push members to visit
-    ZHeapIteratorPushOopClosure push_cl(this, obj);
-    obj->oop_iterate(&push_cl);
+bool ZHeapIterator::steal(ObjectClosure* cl, uint worker_id) {
+  int seed = 17;
+  oop obj;
+
+  if (!_visit_queues.steal(worker_id, &seed, obj)) {
+    // Nothing to steal
+    return false;
   }
+
+  visit(cl, obj, worker_id);
+  return true;
 }
 
 bool ZHeapIterator::visit_referents() const {
   return _visit_referents;
 }
 
-void ZHeapIterator::objects_do(ObjectClosure* cl) {
-  ZHeapIteratorRootOopClosure root_cl(this, cl);
-  ZRootsIterator roots;
+void ZHeapIterator::object_iterate(ObjectClosure* cl, uint worker_id) {
+  assert(worker_id < _nworkers, "Invalid worker id");
 
-  // Follow roots. Note that we also visit the JVMTI weak tag map
+  // Push roots. Note that we also visit the JVMTI weak tag map
   // as if they were strong roots to make sure we visit all tagged
   // objects, even those that might now have become unreachable.
   // If we didn't do this the user would have expected to see
   // ObjectFree events for unreachable objects in the tag map.
-  roots.oops_do(&root_cl, true /* visit_jvmti_weak_export */);
+  // The roots are claimed, so each root is pushed by one worker.
+  ZHeapIteratorRootOopClosure root_cl(this, worker_id);
+  _roots.oops_do(&root_cl, true /* visit_jvmti_weak_export */);
+
+  // Visit objects, stealing from other workers when out
+  // of work, until all workers agree there is no work left.
+  do {
+    drain(cl, worker_id);
+    while (steal(cl, worker_id)) {
+      drain(cl, worker_id);
+    }
+  } while (!_terminator.offer_termination());
 }
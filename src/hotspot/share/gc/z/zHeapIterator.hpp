@@ -24,40 +24,50 @@
 #ifndef SHARE_GC_Z_ZHEAPITERATOR_HPP
 #define SHARE_GC_Z_ZHEAPITERATOR_HPP
 
+#include "gc/shared/collectedHeap.hpp"
+#include "gc/shared/taskqueue.hpp"
 #include "gc/z/zAddressRangeMap.hpp"
 #include "gc/z/zGlobals.hpp"
+#include "gc/z/zLock.hpp"
+#include "gc/z/zRootsIterator.hpp"
 #include "memory/allocation.hpp"
-#include "utilities/stack.hpp"
 
 class ZHeapIteratorBitMap;
 
-class ZHeapIterator : public StackObj {
+class ZHeapIterator : public ParallelObjectIterator {
   friend class ZHeapIteratorRootOopClosure;
   friend class ZHeapIteratorPushOopClosure;
 
 private:
   typedef ZAddressRangeMap<ZHeapIteratorBitMap*, ZPageSizeMinShift>         ZVisitMap;
   typedef ZAddressRangeMapIterator<ZHeapIteratorBitMap*, ZPageSizeMinShift> ZVisitMapIterator;
-  typedef Stack<oop, mtGC>                                                  ZVisitStack;
+  typedef OverflowTaskQueue<oop, mtGC>                                      ZVisitQueue;
+  typedef GenericTaskQueueSet<ZVisitQueue, mtGC>                            ZVisitQueues;
 
-  ZVisitStack _visit_stack;
-  ZVisitMap   _visit_map;
-  const bool  _visit_referents;
+  const uint             _nworkers;
+  ZVisitQueues           _visit_queues;
+  ZVisitMap              _visit_map;
+  ZLock                  _visit_map_lock;
+  ZRootsIterator         _roots;
+  ParallelTaskTerminator _terminator;
+  const bool             _visit_referents;
 
   size_t object_index_max() const;
   size_t object_index(oop obj) const;
   ZHeapIteratorBitMap* object_map(oop obj);
 
-  void push(oop obj);
-  void drain(ObjectClosure* cl);
+  void push(oop obj, uint worker_id);
+  void visit(ObjectClosure* cl, oop obj, uint worker_id);
+  void drain(ObjectClosure* cl, uint worker_id);
+  bool steal(ObjectClosure* cl, uint worker_id);
 
   bool visit_referents() const;
 
 public:
-  ZHeapIterator(bool visit_referents);
-  ~ZHeapIterator();
+  ZHeapIterator(uint nworkers, bool visit_referents);
+  virtual ~ZHeapIterator();
 
-  void objects_do(ObjectClosure* cl);
+  virtual void object_iterate(ObjectClosure* cl, uint worker_id);
 };
 
 #endif // SHARE_GC_Z_ZHEAPITERATOR_HPP
@@ -54,6 +54,7 @@ static const ZStatSubPhase ZSubPhaseConcurrentMarkTryFlush("Concurrent Mark Try
 static const ZStatSubPhase ZSubPhaseConcurrentMarkIdle("Concurrent Mark Idle");
 static const ZStatSubPhase ZSubPhaseConcurrentMarkTryTerminate("Concurrent Mark Try Terminate");
 static const ZStatSubPhase ZSubPhaseMarkTryComplete("Pause Mark Try Complete");
+static const ZStatCounter  ZCounterMarkStripeImbalance("Contention", "Mark Stripe Imbalance", ZStatUnitOpsPerSecond);
 
 ZMark::ZMark(ZWorkers* workers, ZPageTable* pagetable) :
     _workers(workers),
@@ -122,7 +123,7 @@ public:
   ZMarkRootsTask(ZMark* mark) :
       ZTask("ZMarkRootsTask"),
       _mark(mark),
-      _roots() {}
+      _roots(true /* marking */) {}
 
   virtual void work() {
     ZMarkRootOopClosure cl;
@@ -250,6 +251,17 @@ void ZMark::follow_partial_array(ZMarkStackEntry entry, bool finalizable) {
 }
 
 void ZMark::follow_array_object(objArrayOop obj, bool finalizable) {
+  if (ClassUnloading) {
+    // Follow klass
+    if (finalizable) {
+      ZMarkBarrierOopClosure<true /* finalizable */> cl;
+      cl.do_klass(obj->klass());
+    } else {
+      ZMarkBarrierOopClosure<false /* finalizable */> cl;
+      cl.do_klass(obj->klass());
+    }
+  }
+
   const uintptr_t addr = (uintptr_t)obj->base();
   const size_t size = (size_t)obj->length() * oopSize;
 
@@ -349,7 +361,9 @@ bool ZMark::try_steal(ZMarkStripe* stripe, ZMarkThreadLocalStacks* stacks) {
        victim_stripe = _stripes.stripe_next(victim_stripe)) {
     ZMarkStack* const stack = victim_stripe->steal_stack();
     if (stack != NULL) {
-      // Success, install the stolen stack
+      // Success, install the stolen stack. Stealing means our own
+      // stripe ran out of work while another stripe still had some.
+      ZStatInc(ZCounterMarkStripeImbalance);
       stacks->install(&_stripes, stripe, stack);
       return true;
     }
@@ -28,6 +28,7 @@
 #include "gc/z/zMark.hpp"
 #include "gc/z/zMarkStack.inline.hpp"
 #include "gc/z/zThreadLocalData.hpp"
+#include "runtime/prefetch.inline.hpp"
 #include "runtime/thread.hpp"
 #include "utilities/debug.hpp"
 
@@ -38,6 +39,12 @@ inline void ZMark::mark_object(uintptr_t addr) {
   ZMarkStripe* const stripe = _stripes.stripe_for_addr(addr);
   ZMarkStackEntry entry(addr, finalizable);
 
+  if (ZMarkPrefetch) {
+    // Prefetch the object header, which will be read when
+    // the entry is popped and the object is followed.
+    Prefetch::read((void*)addr, 0);
+  }
+
   stacks->push(&_allocator, &_stripes, stripe, entry, publish);
 }
 
@@ -56,22 +56,29 @@ bool ZMarkStackSpace::is_initialized() const {
   return _top != 0;
 }
 
-bool ZMarkStackSpace::expand() {
+size_t ZMarkStackSpace::expand() {
   const size_t max = ZMarkStackSpaceStart + ZMarkStacksMax;
   if (_end + ZMarkStackSpaceExpandSize > max) {
     // Expansion limit reached
-    return false;
+    return 0;
   }
 
-  void* const res = mmap((void*)_end, ZMarkStackSpaceExpandSize,
+  // Grow the space geometrically, by the currently committed size,
+  // to keep the number of expansions low when marking deep object
+  // graphs. The expansion is always a multiple of the expand size.
+  const size_t committed = _end - ZMarkStackSpaceStart;
+  const size_t limit = align_down(max - _end, ZMarkStackSpaceExpandSize);
+  const size_t size = MIN2(MAX2(committed, ZMarkStackSpaceExpandSize), limit);
+
+  void* const res = mmap((void*)_end, size,
                          PROT_READ|PROT_WRITE, MAP_ANONYMOUS|MAP_PRIVATE|MAP_FIXED, -1, 0);
   if (res == MAP_FAILED) {
     ZErrno err;
     log_error(gc, marking)("Failed to map memory for marking stacks (%s)", err.to_string());
-    return false;
+    return 0;
   }
 
-  return true;
+  return size;
 }
 
 uintptr_t ZMarkStackSpace::alloc_space(size_t size) {
@@ -105,7 +112,8 @@ uintptr_t ZMarkStackSpace::expand_and_alloc_space(size_t size) {
   }
 
   // Expand stack space
-  if (!expand()) {
+  const size_t expanded = expand();
+  if (expanded == 0) {
     // We currently can't handle the situation where we
     // are running out of mark stack space.
     fatal("Mark stack overflow (allocated " SIZE_FORMAT "M, size " SIZE_FORMAT "M, max " SIZE_FORMAT "M),"
@@ -116,12 +124,12 @@ uintptr_t ZMarkStackSpace::expand_and_alloc_space(size_t size) {
 
   log_debug(gc, marking)("Expanding mark stack space: " SIZE_FORMAT "M->" SIZE_FORMAT "M",
                          (_end - ZMarkStackSpaceStart) / M,
-                         (_end - ZMarkStackSpaceStart + ZMarkStackSpaceExpandSize) / M);
+                         (_end - ZMarkStackSpaceStart + expanded) / M);
 
   // Increment top before end to make sure another
   // thread can't steal out newly expanded space.
   addr = Atomic::add(size, &_top) - size;
-  _end += ZMarkStackSpaceExpandSize;
+  _end += expanded;
 
   return addr;
 }
@@ -26,6 +26,7 @@
 #include "gc/z/zCollectedHeap.hpp"
 #include "gc/z/zGlobals.hpp"
 #include "gc/z/zHeap.inline.hpp"
+#include "gc/z/zNUMA.hpp"
 #include "gc/z/zObjectAllocator.hpp"
 #include "gc/z/zPage.inline.hpp"
 #include "gc/z/zStat.hpp"
@@ -49,6 +50,7 @@ ZObjectAllocator::ZObjectAllocator(uint nworkers) :
     _used(0),
     _shared_medium_page(NULL),
     _shared_small_page(NULL),
+    _shared_remote_small_page(NULL),
     _worker_small_page(NULL) {}
 
 ZPage* ZObjectAllocator::alloc_page(uint8_t type, size_t size, ZAllocationFlags flags) {
@@ -127,7 +129,10 @@ uintptr_t ZObjectAllocator::alloc_large_object(size_t size, ZAllocationFlags fla
 }
 
 uintptr_t ZObjectAllocator::alloc_medium_object(size_t size, ZAllocationFlags flags) {
-  return alloc_object_in_shared_page(_shared_medium_page.addr(), ZPageTypeMedium, ZPageSizeMedium, size, flags);
+  // Medium pages are shared per NUMA node. Use the page of the requested
+  // node, or the page of the node the current thread is running on.
+  const uint32_t numa_id = flags.has_numa_id() ? flags.numa_id() : ZNUMA::id();
+  return alloc_object_in_shared_page(_shared_medium_page.addr(numa_id), ZPageTypeMedium, ZPageSizeMedium, size, flags);
 }
 
 uintptr_t ZObjectAllocator::alloc_small_object_from_nonworker(size_t size, ZAllocationFlags flags) {
@@ -161,7 +166,25 @@ uintptr_t ZObjectAllocator::alloc_small_object_from_worker(size_t size, ZAllocat
   return addr;
 }
 
+uintptr_t ZObjectAllocator::alloc_small_object_for_remote_node(size_t size, ZAllocationFlags flags) {
+  assert(flags.relocation(), "Should be relocation");
+  assert(flags.has_numa_id(), "Should have NUMA id");
+
+  if (!flags.worker_thread()) {
+    // Non-worker small page allocation can never use the reserve
+    flags.set_no_reserve();
+  }
+
+  return alloc_object_in_shared_page(_shared_remote_small_page.addr(flags.numa_id()), ZPageTypeSmall, ZPageSizeSmall, size, flags);
+}
+
 uintptr_t ZObjectAllocator::alloc_small_object(size_t size, ZAllocationFlags flags) {
+  if (flags.has_numa_id() && flags.numa_id() != ZNUMA::id()) {
+    // Keep relocated objects on the NUMA node they were
+    // allocated on, using a page shared by all threads.
+    return alloc_small_object_for_remote_node(size, flags);
+  }
+
   if (flags.worker_thread()) {
     return alloc_small_object_from_worker(size, flags);
   } else {
@@ -195,12 +218,13 @@ uintptr_t ZObjectAllocator::alloc_object(size_t size) {
   return alloc_object(size, flags);
 }
 
-uintptr_t ZObjectAllocator::alloc_object_for_relocation(size_t size) {
+uintptr_t ZObjectAllocator::alloc_object_for_relocation(size_t size, uint32_t numa_id) {
   assert(ZThread::is_java() || ZThread::is_worker() || ZThread::is_vm(), "Unknown thread");
 
   ZAllocationFlags flags;
   flags.set_relocation();
   flags.set_non_blocking();
+  flags.set_numa_id(numa_id);
 
   if (ZThread::is_worker()) {
     flags.set_worker_thread();
@@ -242,7 +266,9 @@ bool ZObjectAllocator::undo_alloc_small_object_from_worker(ZPage* page, uintptr_
 }
 
 bool ZObjectAllocator::undo_alloc_small_object(ZPage* page, uintptr_t addr, size_t size) {
-  if (ZThread::is_worker()) {
+  // Workers also allocate in shared pages when relocating objects
+  // that live on a remote NUMA node.
+  if (ZThread::is_worker() && page == _worker_small_page.get()) {
     return undo_alloc_small_object_from_worker(page, addr, size);
   } else {
     return undo_alloc_small_object_from_nonworker(page, addr, size);
@@ -309,8 +335,9 @@ void ZObjectAllocator::retire_tlabs() {
   _used.set_all(0);
 
   // Reset allocation pages
-  _shared_medium_page.set(NULL);
+  _shared_medium_page.set_all(NULL);
   _shared_small_page.set_all(NULL);
+  _shared_remote_small_page.set_all(NULL);
   _worker_small_page.set_all(NULL);
 }
 
@@ -33,8 +33,9 @@ class ZObjectAllocator {
 private:
   const uint         _nworkers;
   ZPerCPU<size_t>    _used;
-  ZContended<ZPage*> _shared_medium_page;
+  ZPerNUMA<ZPage*>   _shared_medium_page;
   ZPerCPU<ZPage*>    _shared_small_page;
+  ZPerNUMA<ZPage*>   _shared_remote_small_page;
   ZPerWorker<ZPage*> _worker_small_page;
 
   ZPage* alloc_page(uint8_t type, size_t size, ZAllocationFlags flags);
@@ -51,6 +52,7 @@ private:
   uintptr_t alloc_medium_object(size_t size, ZAllocationFlags flags);
   uintptr_t alloc_small_object_from_nonworker(size_t size, ZAllocationFlags flags);
   uintptr_t alloc_small_object_from_worker(size_t size, ZAllocationFlags flags);
+  uintptr_t alloc_small_object_for_remote_node(size_t size, ZAllocationFlags flags);
   uintptr_t alloc_small_object(size_t size, ZAllocationFlags flags);
   uintptr_t alloc_object(size_t size, ZAllocationFlags flags);
 
@@ -66,7 +68,7 @@ public:
 
   uintptr_t alloc_object(size_t size);
 
-  uintptr_t alloc_object_for_relocation(size_t size);
+  uintptr_t alloc_object_for_relocation(size_t size, uint32_t numa_id);
   void undo_alloc_object_for_relocation(ZPage* page, uintptr_t addr, size_t size);
 
   size_t used() const;
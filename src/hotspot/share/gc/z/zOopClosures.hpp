@@ -58,6 +58,10 @@ public:
   virtual void do_oop(oop* p);
   virtual void do_oop(narrowOop* p);
 
+  virtual bool do_metadata();
+  virtual void do_klass(Klass* k);
+  virtual void do_cld(ClassLoaderData* cld);
+
 #ifdef ASSERT
   virtual bool should_verify_oops() {
     return false;
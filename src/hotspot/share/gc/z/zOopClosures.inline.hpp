@@ -24,11 +24,14 @@
 #ifndef SHARE_GC_Z_ZOOPCLOSURES_INLINE_HPP
 #define SHARE_GC_Z_ZOOPCLOSURES_INLINE_HPP
 
+#include "classfile/classLoaderData.hpp"
 #include "gc/z/zBarrier.inline.hpp"
 #include "gc/z/zHeap.inline.hpp"
 #include "gc/z/zOop.inline.hpp"
 #include "gc/z/zOopClosures.hpp"
+#include "oops/klass.hpp"
 #include "oops/oop.inline.hpp"
+#include "runtime/globals.hpp"
 #include "runtime/atomic.hpp"
 #include "utilities/debug.hpp"
 
@@ -70,6 +73,31 @@ inline void ZMarkBarrierOopClosure<finalizable>::do_oop(narrowOop* p) {
   ShouldNotReachHere();
 }
 
+template <bool finalizable>
+inline bool ZMarkBarrierOopClosure<finalizable>::do_metadata() {
+  // Class loader data is only followed when classes can be unloaded,
+  // otherwise all of it is already visited as roots.
+  return ClassUnloading;
+}
+
+template <bool finalizable>
+inline void ZMarkBarrierOopClosure<finalizable>::do_klass(Klass* k) {
+  do_cld(k->class_loader_data());
+}
+
+template <bool finalizable>
+inline void ZMarkBarrierOopClosure<finalizable>::do_cld(ClassLoaderData* cld) {
+  if (finalizable) {
+    // Finalizable marking does not claim, so that the class loader
+    // data is still strongly marked if later reached by strong marking.
+    if (!cld->claimed()) {
+      cld->oops_do(this, false /* must_claim */);
+    }
+  } else {
+    cld->oops_do(this, true /* must_claim */);
+  }
+}
+
 inline bool ZPhantomIsAliveObjectClosure::do_object_b(oop o) {
   return ZBarrier::is_alive_barrier_on_phantom_oop(o);
 }
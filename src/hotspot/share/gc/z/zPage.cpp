@@ -51,7 +51,8 @@ ZPage::ZPage(uint8_t type, ZVirtualMemory vmem, ZPhysicalMemory pmem) :
     _livemap(object_max_count()),
     _refcount(0),
     _forwarding(),
-    _physical(pmem) {
+    _physical(pmem),
+    _last_used(0) {
   assert(!_physical.is_null(), "Should not be null");
   assert(!_virtual.is_null(), "Should not be null");
   assert((type == ZPageTypeSmall && size() == ZPageSizeSmall) ||
@@ -99,10 +100,10 @@ uintptr_t ZPage::relocate_object_inner(uintptr_t from_index, uintptr_t from_offs
     return _forwarding.insert(from_index, from_offset, &cursor);
   }
 
-  // Allocate object
+  // Allocate object, on the same NUMA node as this page
   const uintptr_t from_good = ZAddress::good(from_offset);
   const size_t size = ZUtils::object_size(from_good);
-  const uintptr_t to_good = ZHeap::heap()->alloc_object_for_relocation(size);
+  const uintptr_t to_good = ZHeap::heap()->alloc_object_for_relocation(size, numa_id());
   if (to_good == 0) {
     // Failed, in-place forward
     return _forwarding.insert(from_index, from_offset, &cursor);
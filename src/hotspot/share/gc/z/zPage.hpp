@@ -50,6 +50,7 @@ private:
   ZForwardingTable     _forwarding;       // Forwarding table
   ZPhysicalMemory      _physical;         // Physical memory for page
   ZListNode<ZPage>     _node;             // Page list node
+  uint64_t             _last_used;        // Last used time (seconds)
 
   const char* type_to_string() const;
   uint32_t object_max_count() const;
@@ -99,6 +100,9 @@ public:
   bool is_pinned() const;
   void set_pinned();
 
+  uint64_t last_used() const;
+  void set_last_used();
+
   bool is_forwarding() const;
   void set_forwarding();
   void reset_forwarding();
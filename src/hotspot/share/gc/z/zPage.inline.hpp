@@ -36,6 +36,7 @@
 #include "gc/z/zVirtualMemory.inline.hpp"
 #include "oops/oop.inline.hpp"
 #include "runtime/atomic.hpp"
+#include "runtime/os.hpp"
 #include "utilities/align.hpp"
 #include "utilities/debug.hpp"
 
@@ -207,6 +208,14 @@ inline void ZPage::set_pinned() {
   _pinned = 1;
 }
 
+inline uint64_t ZPage::last_used() const {
+  return _last_used;
+}
+
+inline void ZPage::set_last_used() {
+  _last_used = ceil(os::elapsedTime());
+}
+
 inline bool ZPage::is_forwarding() const {
   return !_forwarding.is_null();
 }
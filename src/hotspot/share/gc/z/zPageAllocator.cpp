@@ -27,15 +27,18 @@
 #include "gc/z/zFuture.inline.hpp"
 #include "gc/z/zGlobals.hpp"
 #include "gc/z/zLock.inline.hpp"
+#include "gc/z/zNUMA.hpp"
 #include "gc/z/zPage.inline.hpp"
 #include "gc/z/zPageAllocator.hpp"
 #include "gc/z/zPageCache.inline.hpp"
 #include "gc/z/zPreMappedMemory.inline.hpp"
 #include "gc/z/zStat.hpp"
 #include "gc/z/zTracer.inline.hpp"
+#include "logging/log.hpp"
 #include "runtime/init.hpp"
 
 static const ZStatCounter       ZCounterAllocationRate("Memory", "Allocation Rate", ZStatUnitBytesPerSecond);
+static const ZStatCounter       ZCounterUncommit("Memory", "Uncommit", ZStatUnitBytesPerSecond);
 static const ZStatCriticalPhase ZCriticalPhaseAllocationStall("Allocation Stall");
 
 class ZPageAllocRequest : public StackObj {
@@ -88,6 +91,7 @@ ZPageAllocator::ZPageAllocator(size_t min_capacity, size_t max_capacity, size_t
     _virtual(),
     _physical(max_capacity, ZPageSizeMin),
     _cache(),
+    _min_capacity(min_capacity),
     _max_reserve(max_reserve),
     _pre_mapped(_virtual, _physical, try_ensure_unused_for_pre_mapped(min_capacity)),
     _used_high(0),
@@ -242,9 +246,15 @@ void ZPageAllocator::flush_pre_mapped() {
   _pre_mapped.clear();
 }
 
-void ZPageAllocator::map_page(ZPage* page) {
+void ZPageAllocator::map_page(ZPage* page, ZAllocationFlags flags) {
   // Map physical memory
   _physical.map(page->physical_memory(), page->start());
+
+  // Bind small and medium pages to the requested NUMA node before
+  // the memory is touched. Large pages are kept interleaved.
+  if (page->type() != ZPageTypeLarge && flags.has_numa_id()) {
+    ZNUMA::memory_bind(ZAddress::good(page->start()), page->size(), flags.numa_id());
+  }
 }
 
 void ZPageAllocator::detach_page(ZPage* page) {
@@ -282,6 +292,64 @@ void ZPageAllocator::flush_cache(size_t size) {
   }
 }
 
+uint64_t ZPageAllocator::uncommit(uint64_t delay) {
+  // Set the default timeout, when no pages are found in the
+  // cache or when uncommit is disabled, equal to the delay.
+  uint64_t timeout = delay;
+
+  if (!ZUncommit) {
+    // Disabled
+    return timeout;
+  }
+
+  size_t capacity_before;
+  size_t capacity_after;
+  size_t uncommitted;
+
+  {
+    ZLocker locker(&_lock);
+
+    // Don't uncommit below the min capacity, and keep
+    // enough capacity around for used memory and the reserve.
+    const size_t retain = MAX2(_used + _max_reserve, _min_capacity);
+    const size_t release = _physical.capacity() - MIN2(_physical.capacity(), retain);
+    if (release == 0) {
+      // Nothing to uncommit
+      return timeout;
+    }
+
+    // Flush cached pages that have been unused for long enough
+    ZList<ZPage> list;
+    const size_t flushed = _cache.flush_for_uncommit(&list, release, delay, &timeout);
+    if (flushed == 0) {
+      // Nothing flushed
+      return timeout;
+    }
+
+    for (ZPage* page = list.remove_first(); page != NULL; page = list.remove_first()) {
+      detach_page(page);
+    }
+
+    // Uncommit physical memory
+    capacity_before = _physical.capacity();
+    uncommitted = _physical.uncommit(flushed);
+    capacity_after = _physical.capacity();
+  }
+
+  if (uncommitted > 0) {
+    log_info(gc, heap)("Capacity: " SIZE_FORMAT "M(%.0lf%%)->" SIZE_FORMAT "M(%.0lf%%), "
+                       "Uncommitted: " SIZE_FORMAT "M",
+                       capacity_before / M, percent_of(capacity_before, max_capacity()),
+                       capacity_after / M, percent_of(capacity_after, max_capacity()),
+                       uncommitted / M);
+
+    // Update statistics
+    ZStatInc(ZCounterUncommit, uncommitted);
+  }
+
+  return timeout;
+}
+
 void ZPageAllocator::check_out_of_memory_during_initialization() {
   if (!is_init_completed()) {
     vm_exit_during_initialization("java.lang.OutOfMemoryError", "Java heap too small");
@@ -295,8 +363,10 @@ ZPage* ZPageAllocator::alloc_page_common_inner(uint8_t type, size_t size, ZAlloc
     return NULL;
   }
 
-  // Try allocating from the page cache
-  ZPage* const cached_page = _cache.alloc_page(type, size);
+  // Try allocating from the page cache, preferring pages on the requested
+  // NUMA node, or the node of the current thread if none was requested.
+  const uint32_t numa_id = flags.has_numa_id() ? flags.numa_id() : ZNUMA::id();
+  ZPage* const cached_page = _cache.alloc_page(type, size, numa_id);
   if (cached_page != NULL) {
     return cached_page;
   }
@@ -389,6 +459,11 @@ ZPage* ZPageAllocator::alloc_page_nonblocking(uint8_t type, size_t size, ZAlloca
 }
 
 ZPage* ZPageAllocator::alloc_page(uint8_t type, size_t size, ZAllocationFlags flags) {
+  if (!flags.has_numa_id()) {
+    // Allocate on the NUMA node of the current thread
+    flags.set_numa_id(ZNUMA::id());
+  }
+
   ZPage* const page = flags.non_blocking()
                       ? alloc_page_nonblocking(type, size, flags)
                       : alloc_page_blocking(type, size, flags);
@@ -399,7 +474,7 @@ ZPage* ZPageAllocator::alloc_page(uint8_t type, size_t size, ZAllocationFlags fl
 
   // Map page if needed
   if (!page->is_mapped()) {
-    map_page(page);
+    map_page(page, flags);
   }
 
   // Reset page. This updates the page's sequence number and must
@@ -43,6 +43,7 @@ private:
   ZVirtualMemoryManager    _virtual;
   ZPhysicalMemoryManager   _physical;
   ZPageCache               _cache;
+  const size_t             _min_capacity;
   const size_t             _max_reserve;
   ZPreMappedMemory         _pre_mapped;
   size_t                   _used_high;
@@ -63,7 +64,7 @@ private:
   size_t try_ensure_unused_for_pre_mapped(size_t size);
 
   ZPage* create_page(uint8_t type, size_t size);
-  void map_page(ZPage* page);
+  void map_page(ZPage* page, ZAllocationFlags flags);
   void detach_page(ZPage* page);
   void flush_pre_mapped();
   void flush_cache(size_t size);
@@ -103,6 +104,8 @@ public:
 
   void flush_detached_pages(ZList<ZPage>* list);
 
+  uint64_t uncommit(uint64_t delay);
+
   void flip_pre_mapped();
 
   bool is_alloc_stalled() const;
@@ -28,6 +28,7 @@
 #include "gc/z/zPageCache.hpp"
 #include "gc/z/zStat.hpp"
 #include "logging/log.hpp"
+#include "runtime/os.hpp"
 
 static const ZStatCounter ZCounterPageCacheHitL1("Memory", "Page Cache Hit L1", ZStatUnitOpsPerSecond);
 static const ZStatCounter ZCounterPageCacheHitL2("Memory", "Page Cache Hit L2", ZStatUnitOpsPerSecond);
@@ -40,12 +41,11 @@ ZPageCache::ZPageCache() :
     _medium(),
     _large() {}
 
-ZPage* ZPageCache::alloc_small_page() {
-  const uint32_t numa_id = ZNUMA::id();
+ZPage* ZPageCache::alloc_per_numa_page(ZPerNUMA<ZList<ZPage> >* from, uint32_t numa_id) {
   const uint32_t numa_count = ZNUMA::count();
 
   // Try NUMA local page cache
-  ZPage* const l1_page = _small.get(numa_id).remove_first();
+  ZPage* const l1_page = from->get(numa_id).remove_first();
   if (l1_page != NULL) {
     ZStatInc(ZCounterPageCacheHitL1);
     return l1_page;
@@ -59,7 +59,7 @@ ZPage* ZPageCache::alloc_small_page() {
       remote_numa_id = 0;
     }
 
-    ZPage* const l2_page = _small.get(remote_numa_id).remove_first();
+    ZPage* const l2_page = from->get(remote_numa_id).remove_first();
     if (l2_page != NULL) {
       ZStatInc(ZCounterPageCacheHitL2);
       return l2_page;
@@ -72,15 +72,12 @@ ZPage* ZPageCache::alloc_small_page() {
   return NULL;
 }
 
-ZPage* ZPageCache::alloc_medium_page() {
-  ZPage* const l1_page = _medium.remove_first();
-  if (l1_page != NULL) {
-    ZStatInc(ZCounterPageCacheHitL1);
-    return l1_page;
-  }
+ZPage* ZPageCache::alloc_small_page(uint32_t numa_id) {
+  return alloc_per_numa_page(&_small, numa_id);
+}
 
-  ZStatInc(ZCounterPageCacheMiss);
-  return NULL;
+ZPage* ZPageCache::alloc_medium_page(uint32_t numa_id) {
+  return alloc_per_numa_page(&_medium, numa_id);
 }
 
 ZPage* ZPageCache::alloc_large_page(size_t size) {
@@ -99,13 +96,13 @@ ZPage* ZPageCache::alloc_large_page(size_t size) {
   return NULL;
 }
 
-ZPage* ZPageCache::alloc_page(uint8_t type, size_t size) {
+ZPage* ZPageCache::alloc_page(uint8_t type, size_t size, uint32_t numa_id) {
   ZPage* page;
 
   if (type == ZPageTypeSmall) {
-    page = alloc_small_page();
+    page = alloc_small_page(numa_id);
   } else if (type == ZPageTypeMedium) {
-    page = alloc_medium_page();
+    page = alloc_medium_page(numa_id);
   } else {
     page = alloc_large_page(size);
   }
@@ -122,11 +119,15 @@ void ZPageCache::free_page(ZPage* page) {
   assert(!page->is_pinned(), "Invalid page state");
   assert(!page->is_detached(), "Invalid page state");
 
+  // Record when the page was last used, used to
+  // select pages eligible for uncommit.
+  page->set_last_used();
+
   const uint8_t type = page->type();
   if (type == ZPageTypeSmall) {
     _small.get(page->numa_id()).insert_first(page);
   } else if (type == ZPageTypeMedium) {
-    _medium.insert_first(page);
+    _medium.get(page->numa_id()).insert_first(page);
   } else {
     _large.insert_first(page);
   }
@@ -183,7 +184,7 @@ void ZPageCache::flush(ZList<ZPage>* to, size_t requested) {
 
   // Prefer flushing large, then medium and last small pages
   flush_list(&_large, requested, to, &flushed);
-  flush_list(&_medium, requested, to, &flushed);
+  flush_per_numa_lists(&_medium, requested, to, &flushed);
   flush_per_numa_lists(&_small, requested, to, &flushed);
 
   ZStatInc(ZCounterPageCacheFlush, flushed);
@@ -195,3 +196,51 @@ void ZPageCache::flush(ZList<ZPage>* to, size_t requested) {
 
   _available -= flushed;
 }
+
+void ZPageCache::flush_list_for_uncommit(ZList<ZPage>* from, size_t requested, ZList<ZPage>* to, size_t* flushed,
+                                         uint64_t delay, uint64_t now, uint64_t* timeout) {
+  // Flush least recently used first
+  ZPage* page = from->last();
+  while (page != NULL && *flushed < requested) {
+    const uint64_t expires = page->last_used() + delay;
+    if (expires > now) {
+      // Page not yet expired. Since pages are kept in least
+      // recently used order, no other page on this list is.
+      *timeout = MIN2(*timeout, expires - now);
+      break;
+    }
+
+    ZPage* const prev = from->prev(page);
+    if (page->size() <= requested - *flushed) {
+      // Never flush more than requested, since everything flushed
+      // is uncommitted and capacity must not drop below the target.
+      from->remove(page);
+      *flushed += page->size();
+      to->insert_last(page);
+    }
+    page = prev;
+  }
+}
+
+size_t ZPageCache::flush_for_uncommit(ZList<ZPage>* to, size_t requested, uint64_t delay, uint64_t* timeout) {
+  const uint64_t now = ceil(os::elapsedTime());
+  size_t flushed = 0;
+
+  // Only flush pages that have been unused for at least the given delay
+  *timeout = delay;
+
+  // Prefer flushing large, then medium and last small pages
+  flush_list_for_uncommit(&_large, requested, to, &flushed, delay, now, timeout);
+  for (uint32_t numa_id = 0; numa_id < ZNUMA::count(); numa_id++) {
+    flush_list_for_uncommit(&_medium.get(numa_id), requested, to, &flushed, delay, now, timeout);
+  }
+  for (uint32_t numa_id = 0; numa_id < ZNUMA::count(); numa_id++) {
+    flush_list_for_uncommit(&_small.get(numa_id), requested, to, &flushed, delay, now, timeout);
+  }
+
+  ZStatInc(ZCounterPageCacheFlush, flushed);
+
+  _available -= flushed;
+
+  return flushed;
+}
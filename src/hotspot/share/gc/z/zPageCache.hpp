@@ -34,25 +34,29 @@ private:
   size_t                  _available;
 
   ZPerNUMA<ZList<ZPage> > _small;
-  ZList<ZPage>            _medium;
+  ZPerNUMA<ZList<ZPage> > _medium;
   ZList<ZPage>            _large;
 
-  ZPage* alloc_small_page();
-  ZPage* alloc_medium_page();
+  ZPage* alloc_per_numa_page(ZPerNUMA<ZList<ZPage> >* from, uint32_t numa_id);
+  ZPage* alloc_small_page(uint32_t numa_id);
+  ZPage* alloc_medium_page(uint32_t numa_id);
   ZPage* alloc_large_page(size_t size);
 
   void flush_list(ZList<ZPage>* from, size_t requested, ZList<ZPage>* to, size_t* flushed);
   void flush_per_numa_lists(ZPerNUMA<ZList<ZPage> >* from, size_t requested, ZList<ZPage>* to, size_t* flushed);
+  void flush_list_for_uncommit(ZList<ZPage>* from, size_t requested, ZList<ZPage>* to, size_t* flushed,
+                               uint64_t delay, uint64_t now, uint64_t* timeout);
 
 public:
   ZPageCache();
 
   size_t available() const;
 
-  ZPage* alloc_page(uint8_t type, size_t size);
+  ZPage* alloc_page(uint8_t type, size_t size, uint32_t numa_id);
   void free_page(ZPage* page);
 
   void flush(ZList<ZPage>* to, size_t requested);
+  size_t flush_for_uncommit(ZList<ZPage>* to, size_t requested, uint64_t delay, uint64_t* timeout);
 };
 
 #endif // SHARE_GC_Z_ZPAGECACHE_HPP
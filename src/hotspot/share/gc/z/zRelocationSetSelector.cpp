@@ -27,34 +27,76 @@
 #include "gc/z/zRelocationSet.hpp"
 #include "gc/z/zRelocationSetSelector.hpp"
 #include "logging/log.hpp"
+#include "logging/logStream.hpp"
 #include "runtime/globals.hpp"
 #include "utilities/debug.hpp"
 
 ZRelocationSetSelectorGroup::ZRelocationSetSelectorGroup(const char* name,
                                                          size_t page_size,
-                                                         size_t object_size_limit) :
+                                                         size_t object_size_limit,
+                                                         double fragmentation_limit) :
     _name(name),
     _page_size(page_size),
     _object_size_limit(object_size_limit),
-    _fragmentation_limit(page_size * (ZFragmentationLimit / 100)),
+    _fragmentation_limit(fragmentation_limit),
+    _garbage_limit(page_size * (fragmentation_limit / 100)),
     _registered_pages(),
     _sorted_pages(NULL),
     _nselected(0),
+    _npages(0),
+    _live(0),
     _relocating(0),
-    _fragmentation(0) {}
+    _reclaimable(0),
+    _fragmentation(0) {
+  memset(_histogram, 0, sizeof(_histogram));
+}
 
 ZRelocationSetSelectorGroup::~ZRelocationSetSelectorGroup() {
   FREE_C_HEAP_ARRAY(const ZPage*, _sorted_pages);
 }
 
 void ZRelocationSetSelectorGroup::register_live_page(const ZPage* page, size_t garbage) {
-  if (garbage > _fragmentation_limit) {
+  const size_t live = page->live_bytes();
+  const size_t index = MIN2(live * histogram_size / _page_size, histogram_size - 1);
+
+  _histogram[index]++;
+  _npages++;
+  _live += live;
+
+  if (garbage > _garbage_limit) {
     _registered_pages.add(page);
   } else {
     _fragmentation += garbage;
   }
 }
 
+double ZRelocationSetSelectorGroup::adaptive_fragmentation_limit() const {
+  // Scale the fragmentation limit by the density of the live pages in
+  // this group. On a sparse heap relocation is cheap compared to the
+  // memory it reclaims, so we lower the limit and select more pages.
+  // On a dense heap we raise the limit and relocate less.
+  if (_npages == 0) {
+    return _fragmentation_limit;
+  }
+
+  const double density = (double)_live / (double)(_npages * _page_size);
+  return _fragmentation_limit * (0.5 + density);
+}
+
+void ZRelocationSetSelectorGroup::print_histogram() const {
+  LogTarget(Debug, gc, reloc) lt;
+  if (!lt.is_enabled()) {
+    return;
+  }
+
+  LogStream ls(lt);
+  ls.print("Live Histogram (%s Pages):", _name);
+  for (size_t i = 0; i < histogram_size; i++) {
+    ls.print(" " SIZE_FORMAT, _histogram[i]);
+  }
+  ls.cr();
+}
+
 void ZRelocationSetSelectorGroup::semi_sort() {
   // Semi-sort registered pages by live bytes in ascending order
   const size_t npartitions_shift = 11;
@@ -101,10 +143,13 @@ void ZRelocationSetSelectorGroup::select() {
   // a candidate relocation set and calculate the maximum space requirement for
   // their live objects.
   const size_t npages = _registered_pages.size();
+  const double fragmentation_limit = adaptive_fragmentation_limit();
   size_t selected_from = 0;
   size_t selected_to = 0;
+  size_t selected_from_size = 0;
   size_t from_size = 0;
 
+  print_histogram();
   semi_sort();
 
   for (size_t from = 1; from <= npages; from++) {
@@ -124,28 +169,41 @@ void ZRelocationSetSelectorGroup::select() {
     const size_t diff_from = from - selected_from;
     const size_t diff_to = to - selected_to;
     const double diff_reclaimable = 100 - percent_of(diff_to, diff_from);
-    if (diff_reclaimable > ZFragmentationLimit) {
+
+    // Calculate the marginal payoff, i.e. the number of bytes reclaimed for
+    // each live byte relocated, compared to our currently selected final
+    // relocation set.
+    const double diff_reclaimed = ((double)diff_from - (double)diff_to) * _page_size;
+    const double diff_relocated = from_size - selected_from_size;
+    const double diff_payoff = diff_relocated > 0 ? diff_reclaimed / diff_relocated : 0;
+
+    if (diff_reclaimable > fragmentation_limit) {
       selected_from = from;
       selected_to = to;
+      selected_from_size = from_size;
     }
 
     log_trace(gc, reloc)("Candidate Relocation Set (%s Pages): "
-                         SIZE_FORMAT "->" SIZE_FORMAT ", %.1f%% relative defragmentation, %s",
-                         _name, from, to, diff_reclaimable, (selected_from == from) ? "Selected" : "Rejected");
+                         SIZE_FORMAT "->" SIZE_FORMAT ", %.1f%% relative defragmentation, %.2f marginal payoff, %s",
+                         _name, from, to, diff_reclaimable, diff_payoff, (selected_from == from) ? "Selected" : "Rejected");
   }
 
   // Finalize selection
   _nselected = selected_from;
 
   // Update statistics
-  _relocating = from_size;
+  _relocating = selected_from_size;
+  _reclaimable = (selected_from - selected_to) * _page_size;
   for (size_t i = _nselected; i < npages; i++) {
     const ZPage* const page = _sorted_pages[i];
     _fragmentation += page->size() - page->live_bytes();
   }
 
-  log_debug(gc, reloc)("Relocation Set (%s Pages): " SIZE_FORMAT "->" SIZE_FORMAT ", " SIZE_FORMAT " skipped",
-                       _name, selected_from, selected_to, npages - _nselected);
+  const double payoff = _relocating > 0 ? (double)_reclaimable / (double)_relocating : 0;
+  log_debug(gc, reloc)("Relocation Set (%s Pages): " SIZE_FORMAT "->" SIZE_FORMAT ", " SIZE_FORMAT " skipped, "
+                       SIZE_FORMAT "M relocating, " SIZE_FORMAT "M reclaimable, %.2f payoff, %.1f%% fragmentation limit",
+                       _name, selected_from, selected_to, npages - _nselected,
+                       _relocating / M, _reclaimable / M, payoff, fragmentation_limit);
 }
 
 const ZPage* const* ZRelocationSetSelectorGroup::selected() const {
@@ -160,13 +218,17 @@ size_t ZRelocationSetSelectorGroup::relocating() const {
   return _relocating;
 }
 
+size_t ZRelocationSetSelectorGroup::reclaimable() const {
+  return _reclaimable;
+}
+
 size_t ZRelocationSetSelectorGroup::fragmentation() const {
   return _fragmentation;
 }
 
 ZRelocationSetSelector::ZRelocationSetSelector() :
-    _small("Small", ZPageSizeSmall, ZObjectSizeLimitSmall),
-    _medium("Medium", ZPageSizeMedium, ZObjectSizeLimitMedium),
+    _small("Small", ZPageSizeSmall, ZObjectSizeLimitSmall, ZFragmentationLimit),
+    _medium("Medium", ZPageSizeMedium, ZObjectSizeLimitMedium, ZFragmentationLimitMedium),
     _live(0),
     _garbage(0),
     _fragmentation(0) {}
@@ -220,6 +282,10 @@ size_t ZRelocationSetSelector::relocating() const {
   return _small.relocating() + _medium.relocating();
 }
 
+size_t ZRelocationSetSelector::reclaimable() const {
+  return _small.reclaimable() + _medium.reclaimable();
+}
+
 size_t ZRelocationSetSelector::fragmentation() const {
   return _fragmentation + _small.fragmentation() + _medium.fragmentation();
 }
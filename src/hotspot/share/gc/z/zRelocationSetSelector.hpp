@@ -32,23 +32,33 @@ class ZRelocationSet;
 
 class ZRelocationSetSelectorGroup {
 private:
+  static const size_t  histogram_size = 10;
+
   const char* const    _name;
   const size_t         _page_size;
   const size_t         _object_size_limit;
-  const size_t         _fragmentation_limit;
+  const double         _fragmentation_limit;
+  const size_t         _garbage_limit;
 
   ZArray<const ZPage*> _registered_pages;
   const ZPage**        _sorted_pages;
   size_t               _nselected;
+  size_t               _npages;
+  size_t               _live;
   size_t               _relocating;
+  size_t               _reclaimable;
   size_t               _fragmentation;
+  size_t               _histogram[histogram_size];
 
   void semi_sort();
+  double adaptive_fragmentation_limit() const;
+  void print_histogram() const;
 
 public:
   ZRelocationSetSelectorGroup(const char* name,
                               size_t page_size,
-                              size_t object_size_limit);
+                              size_t object_size_limit,
+                              double fragmentation_limit);
   ~ZRelocationSetSelectorGroup();
 
   void register_live_page(const ZPage* page, size_t garbage);
@@ -57,6 +67,7 @@ public:
   const ZPage* const* selected() const;
   size_t nselected() const;
   size_t relocating() const;
+  size_t reclaimable() const;
   size_t fragmentation() const;
 };
 
@@ -78,6 +89,7 @@ public:
   size_t live() const;
   size_t garbage() const;
   size_t relocating() const;
+  size_t reclaimable() const;
   size_t fragmentation() const;
 };
 
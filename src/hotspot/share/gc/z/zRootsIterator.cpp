@@ -136,7 +136,8 @@ void ZParallelWeakOopsDo<T, F>::weak_oops_do(BoolObjectClosure* is_alive, OopClo
   }
 }
 
-ZRootsIterator::ZRootsIterator() :
+ZRootsIterator::ZRootsIterator(bool marking) :
+    _marking(marking),
     _vm_weak_handles_iter(SystemDictionary::vm_weak_oop_storage()),
     _jni_handles_iter(JNIHandles::global_handles()),
     _jni_weak_handles_iter(JNIHandles::weak_global_handles()),
@@ -148,17 +149,19 @@ ZRootsIterator::ZRootsIterator() :
     _jvmti_weak_export(this),
     _jfr_weak(this),
     _system_dictionary(this),
+    _class_loader_data_graph(this),
     _vm_weak_handles(this),
     _jni_handles(this),
     _jni_weak_handles(this),
-    _class_loader_data_graph(this),
     _threads(this),
     _code_cache(this),
     _string_table(this) {
   assert(SafepointSynchronize::is_at_safepoint(), "Should be at safepoint");
   ZStatTimer timer(ZSubPhasePauseRootsSetup);
   Threads::change_thread_claim_parity();
-  ClassLoaderDataGraph::clear_claimed_marks();
+  if (_marking) {
+    ClassLoaderDataGraph::clear_claimed_marks();
+  }
   COMPILER2_PRESENT(DerivedPointerTable::clear());
   CodeCache::gc_prologue();
   ZNMethodTable::gc_prologue();
@@ -230,8 +233,17 @@ void ZRootsIterator::do_system_dictionary(OopClosure* cl) {
 
 void ZRootsIterator::do_class_loader_data_graph(OopClosure* cl) {
   ZStatTimer timer(ZSubPhasePauseRootsClassLoaderDataGraph);
-  CLDToOopClosure cld_cl(cl);
-  ClassLoaderDataGraph::cld_do(&cld_cl);
+  if (_marking) {
+    // Only class loader data that is always alive is a root when marking.
+    // The rest is claimed when reached through marking and otherwise
+    // unloaded. The claim marks must not be touched by other iterations,
+    // which can happen while concurrent mark is in progress.
+    CLDToOopClosure cld_cl(cl, true /* must_claim */);
+    ClassLoaderDataGraph::always_strong_cld_do(&cld_cl);
+  } else {
+    CLDToOopClosure cld_cl(cl, false /* must_claim */);
+    ClassLoaderDataGraph::cld_do(&cld_cl);
+  }
 }
 
 class ZRootsIteratorThreadClosure : public ThreadClosure {
@@ -262,6 +274,8 @@ void ZRootsIterator::do_threads(OopClosure* cl) {
 
 void ZRootsIterator::do_code_cache(OopClosure* cl) {
   ZStatTimer timer(ZSubPhasePauseRootsCodeCache);
+  // Compiled code is always a strong root, also when unloading classes,
+  // since oops embedded in nmethods are used without load barriers.
   ZNMethodTable::oops_do(cl);
 }
 
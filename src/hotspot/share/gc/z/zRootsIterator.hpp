@@ -78,6 +78,7 @@ public:
 
 class ZRootsIterator {
 private:
+  const bool          _marking;
   ZOopStorageIterator _vm_weak_handles_iter;
   ZOopStorageIterator _jni_handles_iter;
   ZOopStorageIterator _jni_weak_handles_iter;
@@ -98,23 +99,23 @@ private:
   void do_code_cache(OopClosure* cl);
   void do_string_table(OopClosure* cl);
 
-  ZSerialOopsDo<ZRootsIterator, &ZRootsIterator::do_universe>                  _universe;
-  ZSerialOopsDo<ZRootsIterator, &ZRootsIterator::do_object_synchronizer>       _object_synchronizer;
-  ZSerialOopsDo<ZRootsIterator, &ZRootsIterator::do_management>                _management;
-  ZSerialOopsDo<ZRootsIterator, &ZRootsIterator::do_jvmti_export>              _jvmti_export;
-  ZSerialOopsDo<ZRootsIterator, &ZRootsIterator::do_jvmti_weak_export>         _jvmti_weak_export;
-  ZSerialOopsDo<ZRootsIterator, &ZRootsIterator::do_jfr_weak>                  _jfr_weak;
-  ZSerialOopsDo<ZRootsIterator, &ZRootsIterator::do_system_dictionary>         _system_dictionary;
-  ZParallelOopsDo<ZRootsIterator, &ZRootsIterator::do_vm_weak_handles>         _vm_weak_handles;
-  ZParallelOopsDo<ZRootsIterator, &ZRootsIterator::do_jni_handles>             _jni_handles;
-  ZParallelOopsDo<ZRootsIterator, &ZRootsIterator::do_jni_weak_handles>        _jni_weak_handles;
-  ZParallelOopsDo<ZRootsIterator, &ZRootsIterator::do_class_loader_data_graph> _class_loader_data_graph;
-  ZParallelOopsDo<ZRootsIterator, &ZRootsIterator::do_threads>                 _threads;
-  ZParallelOopsDo<ZRootsIterator, &ZRootsIterator::do_code_cache>              _code_cache;
-  ZParallelOopsDo<ZRootsIterator, &ZRootsIterator::do_string_table>            _string_table;
+  ZSerialOopsDo<ZRootsIterator, &ZRootsIterator::do_universe>                _universe;
+  ZSerialOopsDo<ZRootsIterator, &ZRootsIterator::do_object_synchronizer>     _object_synchronizer;
+  ZSerialOopsDo<ZRootsIterator, &ZRootsIterator::do_management>              _management;
+  ZSerialOopsDo<ZRootsIterator, &ZRootsIterator::do_jvmti_export>            _jvmti_export;
+  ZSerialOopsDo<ZRootsIterator, &ZRootsIterator::do_jvmti_weak_export>       _jvmti_weak_export;
+  ZSerialOopsDo<ZRootsIterator, &ZRootsIterator::do_jfr_weak>                _jfr_weak;
+  ZSerialOopsDo<ZRootsIterator, &ZRootsIterator::do_system_dictionary>       _system_dictionary;
+  ZSerialOopsDo<ZRootsIterator, &ZRootsIterator::do_class_loader_data_graph> _class_loader_data_graph;
+  ZParallelOopsDo<ZRootsIterator, &ZRootsIterator::do_vm_weak_handles>       _vm_weak_handles;
+  ZParallelOopsDo<ZRootsIterator, &ZRootsIterator::do_jni_handles>           _jni_handles;
+  ZParallelOopsDo<ZRootsIterator, &ZRootsIterator::do_jni_weak_handles>      _jni_weak_handles;
+  ZParallelOopsDo<ZRootsIterator, &ZRootsIterator::do_threads>               _threads;
+  ZParallelOopsDo<ZRootsIterator, &ZRootsIterator::do_code_cache>            _code_cache;
+  ZParallelOopsDo<ZRootsIterator, &ZRootsIterator::do_string_table>          _string_table;
 
 public:
-  ZRootsIterator();
+  ZRootsIterator(bool marking = false);
   ~ZRootsIterator();
 
   void oops_do(OopClosure* cl, bool visit_jvmti_weak_export = false);
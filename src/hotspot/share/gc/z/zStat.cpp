@@ -814,6 +814,10 @@ uint64_t ZStatAllocRate::sample_and_reset() {
   return bytes_per_second;
 }
 
+double ZStatAllocRate::predict() {
+  return _rate.predict_next();
+}
+
 double ZStatAllocRate::avg() {
   return _rate.avg();
 }
@@ -822,6 +826,10 @@ double ZStatAllocRate::avg_sd() {
   return _rate_avg.sd();
 }
 
+double ZStatAllocRate::sd() {
+  return _rate.sd();
+}
+
 //
 // Stat thread
 //
@@ -310,8 +310,10 @@ public:
   static const ZStatUnsampledCounter& counter();
   static uint64_t sample_and_reset();
 
+  static double predict();
   static double avg();
   static double avg_sd();
+  static double sd();
 };
 
 //
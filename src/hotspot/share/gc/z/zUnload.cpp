@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "classfile/classLoaderData.hpp"
+#include "classfile/systemDictionary.hpp"
+#include "code/codeCache.hpp"
+#include "gc/z/zOopClosures.inline.hpp"
+#include "gc/z/zStat.hpp"
+#include "gc/z/zUnload.hpp"
+#include "oops/klass.hpp"
+#include "runtime/globals.hpp"
+#include "runtime/safepoint.hpp"
+
+static const ZStatSubPhase ZSubPhasePauseUnlinkClassLoaders("Pause Unlink Class Loaders");
+static const ZStatSubPhase ZSubPhasePauseUnlinkCodeCache("Pause Unlink CodeCache");
+static const ZStatSubPhase ZSubPhasePauseUnlinkKlassLinks("Pause Unlink Klass Links");
+static const ZStatSubPhase ZSubPhasePausePurgeClassLoaders("Pause Purge Class Loaders");
+
+void ZUnload::unlink() {
+  assert(SafepointSynchronize::is_at_safepoint(), "Should be at safepoint");
+
+  if (!ClassUnloading) {
+    return;
+  }
+
+  // Unlink class loaders that were not reached by marking. Resurrection
+  // is blocked at this point, so dead class loader holders read as null.
+  bool unloading_occurred;
+  {
+    ZStatTimer timer(ZSubPhasePauseUnlinkClassLoaders);
+    unloading_occurred = SystemDictionary::do_unloading(ZStatPhase::timer());
+  }
+
+  // Clean inline caches and other metadata references to unloaded
+  // classes. Compiled code is a strong root, so no nmethods are
+  // unloaded because of dead oops.
+  {
+    ZStatTimer timer(ZSubPhasePauseUnlinkCodeCache);
+    ZPhantomIsAliveObjectClosure is_alive;
+    CodeCache::do_unloading(&is_alive, unloading_occurred);
+  }
+
+  // Prune unloaded classes from subklass, sibling and implementor lists
+  {
+    ZStatTimer timer(ZSubPhasePauseUnlinkKlassLinks);
+    Klass::clean_weak_klass_links(unloading_occurred);
+  }
+}
+
+void ZUnload::purge() {
+  assert(SafepointSynchronize::is_at_safepoint(), "Should be at safepoint");
+
+  if (!ClassUnloading) {
+    return;
+  }
+
+  // Free the metadata of unlinked class loaders
+  ZStatTimer timer(ZSubPhasePausePurgeClassLoaders);
+  ClassLoaderDataGraph::purge();
+}
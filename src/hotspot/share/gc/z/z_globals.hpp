@@ -47,7 +47,10 @@
           "Allocation spike tolerance factor")                              \
                                                                             \
   product(double, ZFragmentationLimit, 25.0,                                \
-          "Maximum allowed heap fragmentation")                             \
+          "Maximum allowed heap fragmentation for small pages")             \
+                                                                            \
+  product(double, ZFragmentationLimitMedium, 25.0,                          \
+          "Maximum allowed heap fragmentation for medium pages")            \
                                                                             \
   product(bool, ZStallOnOutOfMemory, true,                                  \
           "Allow Java threads to stall and wait for GC to complete "        \
@@ -60,6 +63,17 @@
   product(uint, ZCollectionInterval, 0,                                     \
           "Force GC at a fixed time interval (in seconds)")                 \
                                                                             \
+  product(bool, ZUncommit, true,                                            \
+          "Uncommit unused memory")                                         \
+                                                                            \
+  product(uintx, ZUncommitDelay, 5 * 60,                                    \
+          "Uncommit memory if it has been unused for the specified "        \
+          "amount of time (in seconds)")                                    \
+                                                                            \
+  manageable(size_t, ZSoftMaxHeapSize, 0,                                   \
+          "Soft max heap size that ZGC tries to keep the heap below "       \
+          "(0 means the max heap size)")                                    \
+                                                                            \
   product(uint, ZStatisticsInterval, 10,                                    \
           "Time between statistics print outs (in seconds)")                \
           range(1, (uint)-1)                                                \
@@ -73,6 +87,9 @@
   diagnostic(bool, ZUnmapBadViews, false,                                   \
           "Unmap bad (inactive) heap views")                                \
                                                                             \
+  diagnostic(bool, ZMarkPrefetch, true,                                     \
+          "Prefetch objects when pushed on the mark stacks")                \
+                                                                            \
   diagnostic(bool, ZVerifyMarking, false,                                   \
           "Verify marking stacks")                                          \
                                                                             \
@@ -273,6 +273,8 @@ class Bytecodes: AllStatic {
     _fast_iload           ,
     _fast_iload2          ,
     _fast_icaload         ,
+    _fast_iiaload         ,
+    _fast_ibaload         ,
 
     _fast_invokevfinal    ,
     _fast_linearswitch    ,
@@ -60,6 +60,7 @@
 #include "runtime/java.hpp"
 #include "runtime/javaCalls.hpp"
 #include "runtime/jfieldIDWorkaround.hpp"
+#include "runtime/orderAccess.hpp"
 #include "runtime/osThread.hpp"
 #include "runtime/sharedRuntime.hpp"
 #include "runtime/stubRoutines.hpp"
@@ -1339,6 +1340,55 @@ void SignatureHandlerLibrary::initialize() {
 
   _fingerprints = new(ResourceObj::C_HEAP, mtCode)GrowableArray<uint64_t>(32, true);
   _handlers     = new(ResourceObj::C_HEAP, mtCode)GrowableArray<address>(32, true);
+
+  TableEntry* table = NEW_C_HEAP_ARRAY(TableEntry, table_size, mtCode);
+  memset(table, 0, table_size * sizeof(TableEntry));
+  OrderAccess::release_store(&_table, table);
+}
+
+uint SignatureHandlerLibrary::table_index(uint64_t fingerprint) {
+  uint64_t hash = fingerprint * CONST64(0x9E3779B97F4A7C15);
+  return (uint)(hash >> 32) & (table_size - 1);
+}
+
+// Returns the handler for fingerprint or NULL if it has not been generated
+// yet. Safe to call without holding SignatureHandlerLibrary_lock.
+address SignatureHandlerLibrary::lookup(uint64_t fingerprint) {
+  TableEntry* table = OrderAccess::load_acquire(&_table);
+  if (table == NULL) {
+    return NULL;
+  }
+  uint index = table_index(fingerprint);
+  for (int probes = 0; probes < table_size; probes++) {
+    TableEntry* e = &table[index];
+    address handler = OrderAccess::load_acquire(&e->_handler);
+    if (handler == NULL) {
+      return NULL;
+    }
+    if (e->_fingerprint == fingerprint) {
+      return handler;
+    }
+    index = (index + 1) & (table_size - 1);
+  }
+  return NULL;
+}
+
+void SignatureHandlerLibrary::insert(uint64_t fingerprint, address handler) {
+  assert_lock_strong(SignatureHandlerLibrary_lock);
+  // Keep the table at most 3/4 full; further handlers are only found in
+  // the fingerprint collection under the lock.
+  if (_table_used >= table_size / 4 * 3) {
+    return;
+  }
+  uint index = table_index(fingerprint);
+  while (_table[index]._handler != NULL) {
+    assert(_table[index]._fingerprint != fingerprint, "already present");
+    index = (index + 1) & (table_size - 1);
+  }
+  _table[index]._fingerprint = fingerprint;
+  // Publish the fingerprint before the entry becomes visible.
+  OrderAccess::release_store(&_table[index]._handler, handler);
+  _table_used++;
 }
 
 address SignatureHandlerLibrary::set_handler(CodeBuffer* buffer) {
@@ -1363,14 +1413,20 @@ void SignatureHandlerLibrary::add(const methodHandle& method) {
     int handler_index = -1;
     // check if we can use customized (fast) signature handler
     if (UseFastSignatureHandlers && method->size_of_parameters() <= Fingerprinter::max_size_of_parameters) {
-      // use customized signature handler
-      MutexLocker mu(SignatureHandlerLibrary_lock);
-      // make sure data structure is initialized
-      initialize();
       // lookup method signature's fingerprint
       uint64_t fingerprint = Fingerprinter(method).fingerprint();
       // allow CPU dependant code to optimize the fingerprints for the fast handler
       fingerprint = InterpreterRuntime::normalize_fast_native_fingerprint(fingerprint);
+      // fast path: the handler has already been generated for this fingerprint
+      address cached = lookup(fingerprint);
+      if (cached != NULL) {
+        method->set_signature_handler(cached);
+        return;
+      }
+      // use customized signature handler
+      MutexLocker mu(SignatureHandlerLibrary_lock);
+      // make sure data structure is initialized
+      initialize();
       handler_index = _fingerprints->find(fingerprint);
       // create handler if necessary
       if (handler_index < 0) {
@@ -1415,6 +1471,7 @@ void SignatureHandlerLibrary::add(const methodHandle& method) {
           // add handler to library
           _fingerprints->append(fingerprint);
           _handlers->append(handler);
+          insert(fingerprint, handler);
           // set handler index
           assert(_fingerprints->length() == _handlers->length(), "sanity check");
           handler_index = _fingerprints->length() - 1;
@@ -1474,6 +1531,7 @@ void SignatureHandlerLibrary::add(uint64_t fingerprint, address handler) {
     }
     _fingerprints->append(fingerprint);
     _handlers->append(handler);
+    insert(fingerprint, handler);
   } else {
     if (PrintSignatureHandlers) {
       tty->cr();
@@ -1492,6 +1550,8 @@ address                  SignatureHandlerLibrary::_handler      = NULL;
 GrowableArray<uint64_t>* SignatureHandlerLibrary::_fingerprints = NULL;
 GrowableArray<address>*  SignatureHandlerLibrary::_handlers     = NULL;
 address                  SignatureHandlerLibrary::_buffer       = NULL;
+SignatureHandlerLibrary::TableEntry* volatile SignatureHandlerLibrary::_table = NULL;
+int                      SignatureHandlerLibrary::_table_used   = 0;
 
 
 IRT_ENTRY(void, InterpreterRuntime::prepare_native_call(JavaThread* thread, Method* method))
@@ -178,18 +178,32 @@ class SignatureHandlerLibrary: public AllStatic {
  public:
   enum { buffer_size =  1*K }; // the size of the temporary code buffer
   enum { blob_size   = 32*K }; // the size of a handler code blob.
+  enum { table_size  =  1*K }; // the number of slots in the lock-free lookup table
 
  private:
+  // An entry of the lookup table. An entry is in use once its handler is
+  // non-NULL; it is filled in under SignatureHandlerLibrary_lock and never
+  // changes afterwards, so lookups need no lock.
+  struct TableEntry {
+    uint64_t         _fingerprint;
+    volatile address _handler;
+  };
+
   static BufferBlob*              _handler_blob; // the current buffer blob containing the generated handlers
   static address                  _handler;      // next available address within _handler_blob;
   static GrowableArray<uint64_t>* _fingerprints; // the fingerprint collection
   static GrowableArray<address>*  _handlers;     // the corresponding handlers
   static address                  _buffer;       // the temporary code buffer
+  static TableEntry* volatile     _table;        // open addressed fingerprint -> handler table
+  static int                      _table_used;   // the number of entries in use in _table
 
   static address set_handler_blob();
   static void initialize();
   static address set_handler(CodeBuffer* buffer);
   static void pd_set_handler(address handler);
+  static uint table_index(uint64_t fingerprint);
+  static address lookup(uint64_t fingerprint);
+  static void insert(uint64_t fingerprint, address handler);
 
  public:
   static void add(const methodHandle& method);
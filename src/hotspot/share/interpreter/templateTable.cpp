@@ -504,6 +504,14 @@ void TemplateTable::initialize() {
   def(Bytecodes::_fast_iload          , ubcp|____|____|____, vtos, itos, fast_iload          ,  _       );
   def(Bytecodes::_fast_iload2         , ubcp|____|____|____, vtos, itos, fast_iload2         ,  _       );
   def(Bytecodes::_fast_icaload        , ubcp|____|____|____, vtos, itos, fast_icaload        ,  _       );
+#if defined(X86) || defined(AARCH64)
+  def(Bytecodes::_fast_iiaload        , ubcp|____|____|____, vtos, itos, fast_ixaload        ,  T_INT   );
+  def(Bytecodes::_fast_ibaload        , ubcp|____|____|____, vtos, itos, fast_ixaload        ,  T_BYTE  );
+#else
+  // iload is not rewritten to these pairs on this platform
+  def(Bytecodes::_fast_iiaload        , ____|____|____|____, vtos, vtos, shouldnotreachhere  ,  _       );
+  def(Bytecodes::_fast_ibaload        , ____|____|____|____, vtos, vtos, shouldnotreachhere  ,  _       );
+#endif
 
   def(Bytecodes::_fast_invokevfinal   , ubcp|disp|clvm|____, vtos, vtos, fast_invokevfinal   , f2_byte      );
 
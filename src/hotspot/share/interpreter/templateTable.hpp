@@ -140,6 +140,7 @@ class TemplateTable: AllStatic {
   static void fast_iload();
   static void fast_iload2();
   static void fast_icaload();
+  static void fast_ixaload(int type);  // iload followed by iaload or baload
   static void lload();
   static void fload();
   static void dload();
@@ -118,7 +118,7 @@ void BFSClosure::closure_impl(const oop* reference, const oop pointee) {
   assert(reference != NULL, "invariant");
   assert(UnifiedOop::dereference(reference) == pointee, "invariant");
 
-  if (GranularTimer::is_finished()) {
+  if (GranularTimer::is_finished() || _edge_store->all_chains_found()) {
      return;
   }
 
@@ -171,7 +171,7 @@ void BFSClosure::process_queue() {
   assert(_prev_frontier_idx == 0, "invariant");
 
   _next_frontier_idx = _edge_queue->top();
-  while (!is_complete()) {
+  while (!_edge_store->all_chains_found() && !is_complete()) {
     iterate(_edge_queue->remove()); // edge_queue.remove() increments bottom
   }
 }
@@ -103,7 +103,7 @@ void DFSClosure::closure_impl(const oop* reference, const oop pointee) {
   assert(pointee != NULL, "invariant");
   assert(reference != NULL, "invariant");
 
-  if (GranularTimer::is_finished()) {
+  if (GranularTimer::is_finished() || _edge_store->all_chains_found()) {
      return;
   }
   if (_depth == 0 && _ignore_root_set) {
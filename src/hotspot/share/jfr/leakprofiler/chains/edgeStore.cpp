@@ -42,7 +42,7 @@ void StoredEdge::operator=(const StoredEdge& edge) {
 
 traceid EdgeStore::_edge_id_counter = 0;
 
-EdgeStore::EdgeStore() : _edges(NULL) {
+EdgeStore::EdgeStore() : _edges(NULL), _leak_candidates(0), _chains_found(0) {
   _edges = new EdgeHashTable(this);
 }
 
@@ -257,6 +257,7 @@ void EdgeStore::put_chain(const Edge* chain, size_t length) {
   StoredEdge* const leak_context_edge = associate_leak_context_with_candidate(chain);
   assert(leak_context_edge != NULL, "invariant");
   assert(leak_context_edge->parent() == NULL, "invariant");
+  ++_chains_found;
 
   if (1 == length) {
     return;
@@ -72,6 +72,8 @@ class EdgeStore : public CHeapObj<mtTracing> {
  private:
   static traceid _edge_id_counter;
   EdgeHashTable* _edges;
+  size_t _leak_candidates;
+  size_t _chains_found;
 
   // Hash table callbacks
   void on_link(EdgeEntry* entry);
@@ -103,6 +105,11 @@ class EdgeStore : public CHeapObj<mtTracing> {
   bool is_empty() const;
   traceid get_id(const Edge* edge) const;
   void put_chain(const Edge* chain, size_t length);
+
+  // Once a chain is stored for every marked sample object, the rest of
+  // the heap traversal cannot contribute anything and can stop.
+  void set_leak_candidates(size_t count) { _leak_candidates = count; }
+  bool all_chains_found() const { return _leak_candidates > 0 && _chains_found >= _leak_candidates; }
 };
 
 #endif // SHARE_VM_LEAKPROFILER_CHAINS_EDGESTORE_HPP
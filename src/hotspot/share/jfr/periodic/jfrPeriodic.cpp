@@ -29,6 +29,7 @@
 #include "code/codeCache.hpp"
 #include "compiler/compileBroker.hpp"
 #include "gc/shared/gcConfiguration.hpp"
+#include "gc/shared/gcThreadCPUTime.hpp"
 #include "gc/shared/gcTrace.hpp"
 #include "gc/shared/objectCountEventSender.hpp"
 #include "gc/shared/vmGCOperations.hpp"
@@ -49,14 +50,17 @@
 #include "runtime/arguments.hpp"
 #include "runtime/flags/jvmFlag.hpp"
 #include "runtime/globals.hpp"
+#include "runtime/objectMonitor.hpp"
 #include "runtime/os.hpp"
 #include "runtime/os_perf.hpp"
+#include "runtime/perfData.hpp"
 #include "runtime/thread.inline.hpp"
 #include "runtime/threadSMR.hpp"
 #include "runtime/sweeper.hpp"
 #include "runtime/vmThread.hpp"
 #include "services/classLoadingService.hpp"
 #include "services/management.hpp"
+#include "services/memTracker.hpp"
 #include "services/threadService.hpp"
 #include "utilities/exceptions.hpp"
 #include "utilities/globalDefinitions.hpp"
@@ -426,6 +430,26 @@ TRACE_REQUEST_FUNC(ThreadAllocationStatistics) {
   }
 }
 
+class GCThreadCPUTimeEventClosure : public ThreadClosure {
+  JfrTicks _time_stamp;
+public:
+  GCThreadCPUTimeEventClosure() : _time_stamp(JfrTicks::now()) {}
+
+  virtual void do_thread(Thread* thread) {
+    EventGCThreadCPUTime event(UNTIMED);
+    event.set_name(thread->name());
+    event.set_concurrent(thread->is_ConcurrentGC_thread());
+    event.set_cpuTime(os::thread_cpu_time(thread));
+    event.set_endtime(_time_stamp);
+    event.commit();
+  }
+};
+
+TRACE_REQUEST_FUNC(GCThreadCPUTime) {
+  GCThreadCPUTimeEventClosure cl;
+  GCThreadCPUTime::gc_threads_do(&cl);
+}
+
 /**
  *  PhysicalMemory event represents:
  *
@@ -446,6 +470,77 @@ TRACE_REQUEST_FUNC(PhysicalMemory) {
   event.commit();
 }
 
+#if INCLUDE_NMT
+// Per-type totals as in the NMT summary report: malloc and arena memory
+// count as both reserved and committed, plus the type's virtual memory.
+class NativeMemoryUsageSnapshot : public StackObj {
+ private:
+  MallocMemorySnapshot  _malloc;
+  VirtualMemorySnapshot _virtual;
+ public:
+  NativeMemoryUsageSnapshot() {
+    MallocMemorySummary::snapshot(&_malloc);
+    VirtualMemorySummary::snapshot(&_virtual);
+  }
+  size_t reserved(MEMFLAGS flag) {
+    MallocMemory* m = _malloc.by_type(flag);
+    return m->malloc_size() + m->arena_size() + _virtual.by_type(flag)->reserved();
+  }
+  size_t committed(MEMFLAGS flag) {
+    MallocMemory* m = _malloc.by_type(flag);
+    return m->malloc_size() + m->arena_size() + _virtual.by_type(flag)->committed();
+  }
+};
+
+static bool native_memory_tracking_enabled() {
+  return MemTracker::tracking_level() >= NMT_summary;
+}
+#endif
+
+TRACE_REQUEST_FUNC(NativeMemoryUsage) {
+#if INCLUDE_NMT
+  if (!native_memory_tracking_enabled()) {
+    return;
+  }
+  NativeMemoryUsageSnapshot snapshot;
+  const JfrTicks timestamp = JfrTicks::now();
+  for (int index = 0; index < mt_number_of_types; index++) {
+    const MEMFLAGS flag = NMTUtil::index_to_flag(index);
+    const size_t reserved = snapshot.reserved(flag);
+    if (reserved == 0) {
+      continue;
+    }
+    EventNativeMemoryUsage event(UNTIMED);
+    event.set_starttime(timestamp);
+    event.set_endtime(timestamp);
+    event.set_type(NMTUtil::flag_to_name(flag));
+    event.set_reserved(reserved);
+    event.set_committed(snapshot.committed(flag));
+    event.commit();
+  }
+#endif
+}
+
+TRACE_REQUEST_FUNC(NativeMemoryUsageTotal) {
+#if INCLUDE_NMT
+  if (!native_memory_tracking_enabled()) {
+    return;
+  }
+  NativeMemoryUsageSnapshot snapshot;
+  size_t reserved = 0;
+  size_t committed = 0;
+  for (int index = 0; index < mt_number_of_types; index++) {
+    const MEMFLAGS flag = NMTUtil::index_to_flag(index);
+    reserved += snapshot.reserved(flag);
+    committed += snapshot.committed(flag);
+  }
+  EventNativeMemoryUsageTotal event;
+  event.set_reserved(reserved);
+  event.set_committed(committed);
+  event.commit();
+#endif
+}
+
 TRACE_REQUEST_FUNC(JavaThreadStatistics) {
   EventJavaThreadStatistics event;
   event.set_activeCount(ThreadService::get_live_thread_count());
@@ -455,6 +550,18 @@ TRACE_REQUEST_FUNC(JavaThreadStatistics) {
   event.commit();
 }
 
+static jlong monitor_counter_value(PerfStripedCounter* counter) {
+  return (counter != NULL && PerfDataManager::has_PerfData()) ? counter->get_value() : 0;
+}
+
+// Requires UsePerfData; the counters stay at zero otherwise.
+TRACE_REQUEST_FUNC(JavaMonitorSpinStatistics) {
+  EventJavaMonitorSpinStatistics event;
+  event.set_spinAcquires(monitor_counter_value(ObjectMonitor::_sync_SpinAcquires));
+  event.set_spinFailures(monitor_counter_value(ObjectMonitor::_sync_SpinFailures));
+  event.commit();
+}
+
 TRACE_REQUEST_FUNC(ClassLoadingStatistics) {
   EventClassLoadingStatistics event;
   event.set_loadedClassCount(ClassLoadingService::loaded_class_count());
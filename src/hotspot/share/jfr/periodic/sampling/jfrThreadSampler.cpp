@@ -282,7 +282,8 @@ bool JfrThreadSampleClosure::sample_thread_in_native(JavaThread* thread, JfrStac
   return true;
 }
 
-static const uint MAX_NR_OF_JAVA_SAMPLES = 5;
+// Upper bound of JfrMaxJavaSamplesPerPeriod
+static const uint MAX_NR_OF_JAVA_SAMPLES = 64;
 static const uint MAX_NR_OF_NATIVE_SAMPLES = 1;
 
 void JfrThreadSampleClosure::commit_events(JfrSampleType type) {
@@ -509,7 +510,7 @@ void JfrThreadSampler::task_stacktrace(JfrSampleType type, JavaThread** last_thr
   EventNativeMethodSample samples_native[MAX_NR_OF_NATIVE_SAMPLES];
   JfrThreadSampleClosure sample_task(samples, samples_native);
 
-  const uint sample_limit = JAVA_SAMPLE == type ? MAX_NR_OF_JAVA_SAMPLES : MAX_NR_OF_NATIVE_SAMPLES;
+  const uint sample_limit = JAVA_SAMPLE == type ? (uint)JfrMaxJavaSamplesPerPeriod : MAX_NR_OF_NATIVE_SAMPLES;
   uint num_samples = 0;
   JavaThread* start = NULL;
 
@@ -248,7 +248,8 @@ traceid JfrSymbolId::mark(const Klass* k, bool leakp) {
 
 JfrArtifactSet::JfrArtifactSet(bool class_unload) : _symbol_id(new JfrSymbolId()),
                                                     _klass_list(NULL),
-                                                    _total_count(0) {
+                                                    _total_count(0),
+                                                    _klass_list_size_hint(0) {
   initialize(class_unload);
   assert(_klass_list != NULL, "invariant");
 }
@@ -262,8 +263,10 @@ void JfrArtifactSet::initialize(bool class_unload, bool clear /* false */) {
   }
   _symbol_id->set_class_unload(class_unload);
   _total_count = 0;
-  // resource allocation
-  _klass_list = new GrowableArray<const Klass*>(initial_class_list_size, false, mtTracing);
+  // resource allocation, sized by the largest previous type set
+  // to avoid repeatedly growing the list on every chunk rotation
+  const int size = MAX2((int)initial_class_list_size, _klass_list_size_hint);
+  _klass_list = new GrowableArray<const Klass*>(size, false, mtTracing);
 }
 
 JfrArtifactSet::~JfrArtifactSet() {
@@ -310,6 +313,9 @@ void JfrArtifactSet::register_klass(const Klass* k) {
   assert(_klass_list != NULL, "invariant");
   assert(_klass_list->find(k) == -1, "invariant");
   _klass_list->append(k);
+  if (_klass_list->length() > _klass_list_size_hint) {
+    _klass_list_size_hint = _klass_list->length();
+  }
 }
 
 size_t JfrArtifactSet::total_count() const {
@@ -290,6 +290,7 @@ class JfrArtifactSet : public JfrCHeapObj {
   JfrSymbolId* _symbol_id;
   GrowableArray<const Klass*>* _klass_list;
   size_t _total_count;
+  int _klass_list_size_hint;
 
  public:
   JfrArtifactSet(bool class_unload);
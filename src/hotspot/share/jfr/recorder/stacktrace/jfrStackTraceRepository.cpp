@@ -183,25 +183,49 @@ void JfrStackTraceRepository::record_and_cache(JavaThread* thread, int skip /* 0
   }
 }
 
-traceid JfrStackTraceRepository::add_trace(const JfrStackTrace& stacktrace) {
-  MutexLockerEx lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
-  const size_t index = stacktrace._hash % TABLE_SIZE;
-  const JfrStackTrace* table_entry = _table[index];
-
+const JfrStackTrace* JfrStackTraceRepository::find_in_chain(const JfrStackTrace* table_entry, const JfrStackTrace& stacktrace) {
   while (table_entry != NULL) {
     if (table_entry->equals(stacktrace)) {
-      return table_entry->id();
+      return table_entry;
     }
     table_entry = table_entry->next();
   }
+  return NULL;
+}
+
+traceid JfrStackTraceRepository::add_trace(const JfrStackTrace& stacktrace) {
+  const size_t index = stacktrace._hash % TABLE_SIZE;
+  {
+    MutexLockerEx lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
+    const JfrStackTrace* const table_entry = find_in_chain(_table[index], stacktrace);
+    if (table_entry != NULL) {
+      return table_entry->id();
+    }
+  }
 
   if (!stacktrace.have_lineno()) {
     return 0;
   }
 
-  traceid id = ++_next_id;
-  _table[index] = new JfrStackTrace(id, stacktrace, _table[index]);
-  ++_entries;
+  // Copy the frames without holding JfrStacktrace_lock, which is hot during
+  // allocation sampling bursts. Another thread may insert the same trace in
+  // the meantime, in which case the copy is discarded.
+  JfrStackTrace* const new_trace = new JfrStackTrace(0, stacktrace, NULL);
+  traceid id;
+  {
+    MutexLockerEx lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
+    const JfrStackTrace* const table_entry = find_in_chain(_table[index], stacktrace);
+    if (table_entry == NULL) {
+      id = ++_next_id;
+      new_trace->set_id(id);
+      new_trace->_next = _table[index];
+      _table[index] = new_trace;
+      ++_entries;
+      return id;
+    }
+    id = table_entry->id();
+  }
+  delete new_trace;
   return id;
 }
 
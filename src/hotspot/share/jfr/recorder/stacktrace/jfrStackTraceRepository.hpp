@@ -60,6 +60,7 @@ class JfrStackTraceRepository : public JfrCHeapObj {
   size_t write(JfrChunkWriter& cw, bool clear);
   size_t clear();
 
+  static const JfrStackTrace* find_in_chain(const JfrStackTrace* table_entry, const JfrStackTrace& stacktrace);
   traceid add_trace(const JfrStackTrace& stacktrace);
   static traceid add(const JfrStackTrace& stacktrace);
   traceid record_for(JavaThread* thread, int skip, JfrStackFrame* frames, u4 max_frames);
@@ -262,6 +262,7 @@ bool JfrStorage::flush_regular_buffer(BufferPtr buffer, Thread* thread) {
   assert(promotion_buffer->free_size() >= unflushed_size, "invariant");
   buffer->concurrent_move_and_reinitialize(promotion_buffer, unflushed_size);
   assert(buffer->empty(), "invariant");
+  thread->jfr_thread_local()->add_promotion(unflushed_size);
   return true;
 }
 
@@ -33,6 +33,7 @@
 #include "jfr/recorder/service/jfrOptionSet.hpp"
 #include "jfr/recorder/storage/jfrStorage.hpp"
 #include "jfr/support/jfrThreadLocal.hpp"
+#include "logging/log.hpp"
 #include "memory/allocation.inline.hpp"
 #include "runtime/os.hpp"
 #include "runtime/thread.inline.hpp"
@@ -48,6 +49,8 @@ JfrThreadLocal::JfrThreadLocal() :
   _trace_id(JfrTraceId::assign_thread_id()),
   _thread(),
   _data_lost(0),
+  _promotions(0),
+  _promoted_bytes(0),
   _stack_trace_id(max_julong),
   _user_time(0),
   _cpu_time(0),
@@ -134,6 +137,11 @@ void JfrThreadLocal::on_exit(Thread* t) {
     ObjectSampleCheckpoint::on_thread_exit(jt);
     send_java_thread_end_events(tl->thread_id(), jt);
   }
+  if (tl->promotions() > 0 || tl->data_lost() > 0) {
+    log_trace(jfr, system)("Thread " UINT64_FORMAT " promoted " UINT64_FORMAT " buffer(s) of " UINT64_FORMAT
+                           " bytes in total, lost " UINT64_FORMAT " bytes.",
+                           tl->thread_id(), tl->promotions(), tl->promoted_bytes(), tl->data_lost());
+  }
   release(tl, Thread::current()); // because it could be that Thread::current() != t
 }
 
@@ -43,6 +43,8 @@ class JfrThreadLocal {
   mutable traceid _trace_id;
   JfrBlobHandle _thread;
   u8 _data_lost;
+  u8 _promotions;
+  u8 _promoted_bytes;
   traceid _stack_trace_id;
   jlong _user_time;
   jlong _cpu_time;
@@ -167,6 +169,20 @@ class JfrThreadLocal {
 
   u8 add_data_lost(u8 value);
 
+  // Promotions of this thread's full buffers into global buffers.
+  u8 promotions() const {
+    return _promotions;
+  }
+
+  u8 promoted_bytes() const {
+    return _promoted_bytes;
+  }
+
+  void add_promotion(size_t size) {
+    ++_promotions;
+    _promoted_bytes += size;
+  }
+
   jlong get_user_time() const {
     return _user_time;
   }
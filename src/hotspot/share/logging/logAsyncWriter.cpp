@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "jvm.h"
+#include "logging/log.hpp"
+#include "logging/logAsyncWriter.hpp"
+#include "logging/logConfiguration.hpp"
+#include "logging/logFileOutput.hpp"
+#include "memory/allocation.inline.hpp"
+#include "runtime/globals.hpp"
+#include "runtime/os.hpp"
+
+AsyncLogWriter* volatile AsyncLogWriter::_instance = NULL;
+
+AsyncLogWriter::Message::~Message() {
+  os::free(_text);
+}
+
+size_t AsyncLogWriter::Message::size() const {
+  return sizeof(Message) + strlen(_text) + 1;
+}
+
+AsyncLogWriter::AsyncLogWriter() : NonJavaThread(),
+  _lock(1), _io_lock(1), _data_available(0),
+  _head(NULL), _tail(NULL), _buffer_size(0) {
+}
+
+void AsyncLogWriter::initialize() {
+  if (!LogConfiguration::is_async_mode()) {
+    return;
+  }
+  assert(_instance == NULL, "initialize() should only be called once");
+
+  AsyncLogWriter* writer = new AsyncLogWriter();
+  if (os::create_thread(writer, os::os_thread)) {
+    OrderAccess::release_store(&_instance, writer);
+    os::start_thread(writer);
+    log_debug(logging)("Asynchronous log writer started, buffer size " SIZE_FORMAT "B", AsyncLogBufferSize);
+  } else {
+    // Nothing has been enqueued, keep logging synchronously.
+    log_warning(logging)("Failed to start the asynchronous log writer, logging synchronously");
+  }
+}
+
+void AsyncLogWriter::enqueue(LogFileOutput& output, const LogDecorations& decorations, const char* msg) {
+  // Allocate outside of the lock, the copy is dropped if it doesn't fit.
+  char* text = os::strdup(msg, mtLogging);
+  Message* m = NULL;
+  if (text != NULL) {
+    m = new (std::nothrow) Message(&output, decorations, text);
+    if (m == NULL) {
+      os::free(text);
+    }
+  }
+  const size_t size = (m != NULL) ? m->size() : 0;
+
+  _lock.wait();
+  if (m == NULL || _buffer_size + size > AsyncLogBufferSize) {
+    output._async_dropped++;
+    _lock.signal();
+    delete m;
+    return;
+  }
+  m->_dropped_before = output._async_dropped;
+  output._async_dropped = 0;
+  const bool was_empty = (_head == NULL);
+  if (was_empty) {
+    _head = m;
+  } else {
+    _tail->_next = m;
+  }
+  _tail = m;
+  _buffer_size += size;
+  _lock.signal();
+
+  if (was_empty) {
+    _data_available.signal();
+  }
+}
+
+void AsyncLogWriter::write() {
+  _io_lock.wait();
+
+  _lock.wait();
+  Message* m = _head;
+  _head = NULL;
+  _tail = NULL;
+  _buffer_size = 0;
+  _lock.signal();
+
+  while (m != NULL) {
+    Message* next = m->_next;
+    LogFileOutput* output = m->_output;
+    if (m->_dropped_before > 0) {
+      char buf[64];
+      jio_snprintf(buf, sizeof(buf), SIZE_FORMAT " messages dropped due to async logging", m->_dropped_before);
+      output->write_blocking(m->_decorations, buf, false);
+    }
+    // Consecutive messages for the same output share a single flush.
+    output->write_blocking(m->_decorations, m->_text, next == NULL || next->_output != output);
+    delete m;
+    m = next;
+  }
+
+  _io_lock.signal();
+}
+
+void AsyncLogWriter::run() {
+  this->set_native_thread_name(this->name());
+  while (true) {
+    _data_available.wait();
+    write();
+  }
+}
+
+void AsyncLogWriter::flush() {
+  AsyncLogWriter* writer = instance();
+  if (writer != NULL) {
+    assert(Thread::current_or_null() != writer, "the writer thread must not flush itself");
+    writer->write();
+  }
+}
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_VM_LOGGING_LOGASYNCWRITER_HPP
+#define SHARE_VM_LOGGING_LOGASYNCWRITER_HPP
+
+#include "logging/logDecorations.hpp"
+#include "memory/allocation.hpp"
+#include "runtime/orderAccess.hpp"
+#include "runtime/semaphore.hpp"
+#include "runtime/thread.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+class LogFileOutput;
+
+// Asynchronous logging (-Xlog:async).
+//
+// In async mode, messages for file outputs are not written by the thread
+// that logs them. They are copied together with their decorations into a
+// FIFO buffer, and a dedicated thread writes them out in batches. Threads
+// that log, e.g. GC workers in a safepoint, never wait for file I/O.
+//
+// The buffer is bounded by AsyncLogBufferSize. Messages that don't fit are
+// dropped. The number of dropped messages is written to the output ahead
+// of its next message.
+//
+// Pending messages refer to their output, so the buffer must be flushed
+// before a LogFileOutput is deleted. It is also flushed at VM exit.
+class AsyncLogWriter : public NonJavaThread {
+ private:
+  class Message : public CHeapObj<mtLogging> {
+   public:
+    LogFileOutput* const _output;
+    const LogDecorations _decorations;
+    char* const          _text;
+    size_t               _dropped_before;
+    Message*             _next;
+
+    Message(LogFileOutput* output, const LogDecorations& decorations, char* text) :
+      _output(output), _decorations(decorations), _text(text), _dropped_before(0), _next(NULL) { }
+    ~Message();
+
+    size_t size() const;
+  };
+
+  static AsyncLogWriter* volatile _instance;
+
+  // Protects the message list.
+  Semaphore _lock;
+  // Serializes writing between the writer thread and flush().
+  Semaphore _io_lock;
+  // Signalled when the message list becomes non-empty.
+  Semaphore _data_available;
+
+  Message* _head;
+  Message* _tail;
+  size_t   _buffer_size;
+
+  AsyncLogWriter();
+
+  void write();
+
+ public:
+  // Starts the writer thread if async logging is enabled.
+  static void initialize();
+
+  // Returns the writer, or NULL if logging is synchronous.
+  static AsyncLogWriter* instance() { return OrderAccess::load_acquire(&_instance); }
+
+  // Writes all pending messages before returning. Must not be called by
+  // the writer thread itself.
+  static void flush();
+
+  // Copies the message into the buffer, or drops it if the buffer is full.
+  void enqueue(LogFileOutput& output, const LogDecorations& decorations, const char* msg);
+
+  virtual void run();
+  char* name() const { return (char*)"AsyncLog Thread"; }
+};
+
+#endif // SHARE_VM_LOGGING_LOGASYNCWRITER_HPP
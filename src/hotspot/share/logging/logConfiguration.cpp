@@ -24,6 +24,7 @@
 #include "precompiled.hpp"
 #include "jvm.h"
 #include "logging/log.hpp"
+#include "logging/logAsyncWriter.hpp"
 #include "logging/logConfiguration.hpp"
 #include "logging/logDecorations.hpp"
 #include "logging/logDecorators.hpp"
@@ -45,6 +46,8 @@ size_t      LogConfiguration::_n_outputs = 0;
 LogConfiguration::UpdateListenerFunction* LogConfiguration::_listener_callbacks = NULL;
 size_t      LogConfiguration::_n_listener_callbacks = 0;
 
+bool        LogConfiguration::_async_mode = false;
+
 // LogFileOutput is the default type of output, its type prefix should be used if no type was specified
 static const char* implicit_output_prefix = LogFileOutput::Prefix;
 
@@ -210,6 +213,8 @@ void LogConfiguration::delete_output(size_t idx) {
   // Swap places with the last output and shrink the array
   _outputs[idx] = _outputs[--_n_outputs];
   _outputs = REALLOC_C_HEAP_ARRAY(LogOutput*, _outputs, _n_outputs, mtLogging);
+  // Pending asynchronous messages may still refer to the output.
+  AsyncLogWriter::flush();
   delete output;
 }
 
@@ -579,6 +584,11 @@ void LogConfiguration::print_command_line_help(outputStream* out) {
   out->print_cr(" -Xlog:disable -Xlog:safepoint=trace:safepointtrace.txt");
   out->print_cr("\t Turn off all logging, including warnings and errors,");
   out->print_cr("\t and then enable messages tagged with 'safepoint' up to 'trace' level to file 'safepointtrace.txt'.");
+  out->cr();
+
+  out->print_cr(" -Xlog:async -Xlog:gc=debug:file=gc.txt");
+  out->print_cr("\t Write messages to file outputs from a dedicated thread, so that logging threads never block on file I/O.");
+  out->print_cr("\t Messages that don't fit into the buffer (see -XX:AsyncLogBufferSize) are dropped and reported as dropped.");
 }
 
 void LogConfiguration::rotate_all_outputs() {
@@ -51,6 +51,8 @@ class LogDecorations {
   static void initialize(jlong vm_start_time);
 
   LogDecorations(LogLevelType level, const LogTagSet& tagset, const LogDecorators& decorators);
+  // The decoration offsets point into the buffer, so a copy must rebase them.
+  LogDecorations(const LogDecorations& other);
 
   void set_level(LogLevelType level) {
     _level = level;
@@ -24,6 +24,7 @@
 #include "precompiled.hpp"
 #include "jvm.h"
 #include "logging/log.hpp"
+#include "logging/logAsyncWriter.hpp"
 #include "logging/logConfiguration.hpp"
 #include "logging/logFileOutput.hpp"
 #include "memory/allocation.inline.hpp"
@@ -46,7 +47,7 @@ LogFileOutput::LogFileOutput(const char* name)
     : LogFileStreamOutput(NULL), _name(os::strdup_check_oom(name, mtLogging)),
       _file_name(NULL), _archive_name(NULL), _archive_name_len(0),
       _rotate_size(DefaultFileSize), _file_count(DefaultFileCount), _is_default_file_count(true),
-      _current_size(0), _current_file(0), _rotation_semaphore(1) {
+      _current_size(0), _current_file(0), _rotation_semaphore(1), _async_dropped(0) {
   assert(strstr(name, Prefix) == name, "invalid output name '%s': missing prefix: %s", name, Prefix);
   _file_name = make_file_name(name + strlen(Prefix), _pid_str, _vm_start_time_str);
 }
@@ -281,8 +282,28 @@ int LogFileOutput::write(const LogDecorations& decorations, const char* msg) {
     return 0;
   }
 
+  AsyncLogWriter* writer = AsyncLogWriter::instance();
+  if (writer != NULL) {
+    writer->enqueue(*this, decorations, msg);
+    return 0;
+  }
+
+  return write_blocking(decorations, msg);
+}
+
+int LogFileOutput::write_blocking(const LogDecorations& decorations, const char* msg, bool do_flush) {
+  if (_stream == NULL) {
+    // An error has occurred with this output, avoid writing to it.
+    return 0;
+  }
+
   _rotation_semaphore.wait();
-  int written = LogFileStreamOutput::write(decorations, msg);
+  os::flockfile(_stream);
+  int written = write_internal(decorations, msg);
+  if (do_flush) {
+    fflush(_stream);
+  }
+  os::funlockfile(_stream);
   _current_size += written;
 
   if (should_rotate()) {
@@ -299,6 +320,14 @@ int LogFileOutput::write(LogMessageBuffer::Iterator msg_iterator) {
     return 0;
   }
 
+  AsyncLogWriter* writer = AsyncLogWriter::instance();
+  if (writer != NULL) {
+    for (; !msg_iterator.is_at_end(); msg_iterator++) {
+      writer->enqueue(*this, msg_iterator.decorations(), msg_iterator.message());
+    }
+    return 0;
+  }
+
   _rotation_semaphore.wait();
   int written = LogFileStreamOutput::write(msg_iterator);
   _current_size += written;
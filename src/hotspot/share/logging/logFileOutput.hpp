@@ -32,6 +32,7 @@ class LogDecorations;
 
 // The log file output, with support for file rotation based on a target size.
 class LogFileOutput : public LogFileStreamOutput {
+  friend class AsyncLogWriter;
  private:
   static const char* const FileOpenMode;
   static const char* const FileCountOptionKey;
@@ -63,6 +64,10 @@ class LogFileOutput : public LogFileStreamOutput {
   // Semaphore used for synchronizing file rotations and writes
   Semaphore _rotation_semaphore;
 
+  // Messages dropped because the async log buffer was full,
+  // protected by the AsyncLogWriter's lock
+  size_t _async_dropped;
+
   void archive();
   void rotate();
   bool parse_options(const char* options, outputStream* errstream);
@@ -85,6 +90,9 @@ class LogFileOutput : public LogFileStreamOutput {
   virtual bool initialize(const char* options, outputStream* errstream);
   virtual int write(const LogDecorations& decorations, const char* msg);
   virtual int write(LogMessageBuffer::Iterator msg_iterator);
+  // Writes the message to the file. The stream is only flushed if
+  // do_flush is set, so that a batch of messages needs a single flush.
+  int write_blocking(const LogDecorations& decorations, const char* msg, bool do_flush = true);
   virtual void force_rotate();
   virtual void describe(outputStream* out);
 
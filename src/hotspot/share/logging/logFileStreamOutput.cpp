@@ -72,16 +72,19 @@ int LogFileStreamOutput::write_decorations(const LogDecorations& decorations) {
   return total_written;
 }
 
-int LogFileStreamOutput::write(const LogDecorations& decorations, const char* msg) {
-  const bool use_decorations = !_decorators.is_empty();
-
+int LogFileStreamOutput::write_internal(const LogDecorations& decorations, const char* msg) {
   int written = 0;
-  os::flockfile(_stream);
-  if (use_decorations) {
+  if (!_decorators.is_empty()) {
     written += write_decorations(decorations);
     written += jio_fprintf(_stream, " ");
   }
   written += jio_fprintf(_stream, "%s\n", msg);
+  return written;
+}
+
+int LogFileStreamOutput::write(const LogDecorations& decorations, const char* msg) {
+  os::flockfile(_stream);
+  int written = write_internal(decorations, msg);
   fflush(_stream);
   os::funlockfile(_stream);
 
@@ -89,16 +92,10 @@ int LogFileStreamOutput::write(const LogDecorations& decorations, const char* ms
 }
 
 int LogFileStreamOutput::write(LogMessageBuffer::Iterator msg_iterator) {
-  const bool use_decorations = !_decorators.is_empty();
-
   int written = 0;
   os::flockfile(_stream);
   for (; !msg_iterator.is_at_end(); msg_iterator++) {
-    if (use_decorations) {
-      written += write_decorations(msg_iterator.decorations());
-      written += jio_fprintf(_stream, " ");
-    }
-    written += jio_fprintf(_stream, "%s\n", msg_iterator.message());
+    written += write_internal(msg_iterator.decorations(), msg_iterator.message());
   }
   fflush(_stream);
   os::funlockfile(_stream);
@@ -51,6 +51,8 @@ class LogFileStreamOutput : public LogOutput {
   }
 
   int write_decorations(const LogDecorations& decorations);
+  // Writes a single message, without locking or flushing the stream.
+  int write_internal(const LogDecorations& decorations, const char* msg);
 
  public:
   virtual int write(const LogDecorations& decorations, const char* msg);
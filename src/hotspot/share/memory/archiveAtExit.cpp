@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "jvm.h"
+#include "classfile/classLoader.hpp"
+#include "classfile/classLoaderData.hpp"
+#include "classfile/systemDictionaryShared.hpp"
+#include "logging/log.hpp"
+#include "memory/archiveAtExit.hpp"
+#include "memory/iterator.hpp"
+#include "memory/resourceArea.hpp"
+#include "oops/instanceKlass.hpp"
+#include "runtime/arguments.hpp"
+#include "runtime/handles.inline.hpp"
+#include "runtime/os.hpp"
+#include "utilities/ostream.hpp"
+
+class ArchiveClassListClosure : public KlassClosure {
+ private:
+  outputStream* _out;
+  int           _count;
+
+ public:
+  ArchiveClassListClosure(outputStream* out) : _out(out), _count(0) {}
+
+  void do_klass(Klass* k) {
+    if (!k->is_instance_klass()) {
+      return;
+    }
+    InstanceKlass* ik = InstanceKlass::cast(k);
+    // Same selection as DumpLoadedClassList: only classes of the builtin
+    // loaders can be archived, and anonymous classes (lambda forms and
+    // lambda proxies) are regenerated at run time.
+    if (ik->is_anonymous() ||
+        !SystemDictionaryShared::is_sharing_possible(ik->class_loader_data())) {
+      return;
+    }
+    ResourceMark rm;
+    _out->print_cr("%s", ik->name()->as_C_string());
+    _count++;
+  }
+
+  int count() const { return _count; }
+};
+
+void ArchiveAtExit::dump(const char* archive) {
+  if (DumpSharedSpaces) {
+    return;
+  }
+  if (!ClassLoader::has_jrt_entry()) {
+    warning("ArchiveClassesAtExit is not supported in exploded build");
+    return;
+  }
+  if (UseSharedSpaces && SharedArchiveFile != NULL && strcmp(SharedArchiveFile, archive) == 0) {
+    // The archive is mapped by this VM; do not rewrite it underneath us.
+    log_info(cds)("ArchiveClassesAtExit: %s is in use, not regenerating it", archive);
+    return;
+  }
+
+  char classlist[JVM_MAXPATHLEN];
+  if (jio_snprintf(classlist, sizeof(classlist), "%s.classlist", archive) == -1) {
+    warning("ArchiveClassesAtExit: archive path too long: %s", archive);
+    return;
+  }
+
+  int count;
+  {
+    fileStream fs(classlist, "w");
+    if (!fs.is_open()) {
+      warning("ArchiveClassesAtExit: cannot open %s", classlist);
+      return;
+    }
+    HandleMark hm;
+    ArchiveClassListClosure cl(&fs);
+    ClassLoaderDataGraph::loaded_classes_do(&cl);
+    count = cl.count();
+  }
+  log_info(cds)("ArchiveClassesAtExit: wrote %d classes to %s", count, classlist);
+
+  // Run the dump in a separate VM with the same class path; its output
+  // goes to <archive>.log.
+  ResourceMark rm;
+  const char* cp = Arguments::get_appclasspath();
+  if (cp == NULL) {
+    cp = "";
+  }
+  const char* sep = os::file_separator();
+  size_t java_len = strlen(Arguments::get_java_home()) + 2 * strlen(sep) + strlen("binjava") + 1;
+  char* java = NEW_RESOURCE_ARRAY(char, java_len);
+  jio_snprintf(java, java_len, "%s%sbin%sjava", Arguments::get_java_home(), sep, sep);
+  size_t list_len = strlen("-XX:SharedClassListFile=") + strlen(classlist) + 1;
+  char* list_option = NEW_RESOURCE_ARRAY(char, list_len);
+  jio_snprintf(list_option, list_len, "-XX:SharedClassListFile=%s", classlist);
+  size_t archive_len = strlen("-XX:SharedArchiveFile=") + strlen(archive) + 1;
+  char* archive_option = NEW_RESOURCE_ARRAY(char, archive_len);
+  jio_snprintf(archive_option, archive_len, "-XX:SharedArchiveFile=%s", archive);
+  size_t log_len = strlen(archive) + strlen(".log") + 1;
+  char* log = NEW_RESOURCE_ARRAY(char, log_len);
+  jio_snprintf(log, log_len, "%s.log", archive);
+
+  log_info(cds)("ArchiveClassesAtExit: running %s -Xshare:dump %s %s -cp %s",
+                java, list_option, archive_option, cp);
+#ifndef _WINDOWS
+  // Exec the launcher directly, so that no path is ever seen by a shell.
+  char* argv[] = { java, (char*)"-Xshare:dump", list_option, archive_option,
+                   (char*)"-cp", (char*)cp, NULL };
+  int status = os::Posix::exec_and_wait(java, argv, log);
+#else
+  // os::fork_and_exec runs the command through cmd.exe, which would
+  // interpret these characters even inside quotes.
+  const char* unsafe = "\"%^&|<>!";
+  if (strpbrk(java, unsafe) != NULL || strpbrk(classlist, unsafe) != NULL ||
+      strpbrk(archive, unsafe) != NULL || strpbrk(cp, unsafe) != NULL) {
+    warning("ArchiveClassesAtExit: not creating %s, a path contains one of %s", archive, unsafe);
+    return;
+  }
+  const char* fmt = "\"%s\" -Xshare:dump \"%s\" \"%s\" -cp \"%s\" > \"%s\" 2>&1";
+  size_t len = strlen(fmt) + strlen(java) + strlen(list_option) + strlen(archive_option) +
+               strlen(cp) + strlen(log) + 1;
+  char* cmd = NEW_RESOURCE_ARRAY(char, len);
+  jio_snprintf(cmd, len, fmt, java, list_option, archive_option, cp, log);
+  int status = os::fork_and_exec(cmd, true);
+#endif
+  if (status != 0) {
+    warning("ArchiveClassesAtExit: creating %s failed (exit status %d), see %s",
+            archive, status, log);
+  }
+}
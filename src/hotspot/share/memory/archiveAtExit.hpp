@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_VM_MEMORY_ARCHIVEATEXIT_HPP
+#define SHARE_VM_MEMORY_ARCHIVEATEXIT_HPP
+
+#include "memory/allocation.hpp"
+
+// Support for -XX:ArchiveClassesAtExit=<archive>: when the VM exits,
+// write the classes loaded by the builtin class loaders to
+// <archive>.classlist and run "java -Xshare:dump" with that class list
+// and the current class path to create <archive>. A later run with
+// -XX:SharedArchiveFile=<archive> then maps these classes from the
+// archive, without a separate -XX:DumpLoadedClassList training run.
+class ArchiveAtExit : AllStatic {
+ public:
+  static void dump(const char* archive);
+};
+
+#endif // SHARE_VM_MEMORY_ARCHIVEATEXIT_HPP
@@ -31,6 +31,7 @@
 #include "runtime/atomic.hpp"
 #include "runtime/os.hpp"
 #include "runtime/task.hpp"
+#include "runtime/thread.hpp"
 #include "runtime/threadCritical.hpp"
 #include "services/memTracker.hpp"
 #include "utilities/ostream.hpp"
@@ -176,6 +177,84 @@ class ChunkPoolCleaner : public PeriodicTask {
    }
 };
 
+//--------------------------------------------------------------------------------------
+// ChunkCache implementation
+
+ChunkCache* ChunkCache::current() {
+  if (CompilerThreadChunkCacheSize == 0 && !CITime) {
+    return NULL;
+  }
+  Thread* thread = Thread::current_or_null();
+  if (thread == NULL || !thread->is_Compiler_thread()) {
+    return NULL;
+  }
+  ChunkCache* cache = ((CompilerThread*)thread)->chunk_cache();
+  return cache->_enabled ? cache : NULL;
+}
+
+volatile size_t ChunkCache::_max_compilation_bytes = 0;
+
+void* ChunkCache::allocate(size_t length) {
+  _bytes_in_use += length;
+  _peak_bytes = MAX2(_peak_bytes, _bytes_in_use);
+  if (length != Chunk::size) {
+    return NULL;
+  }
+  _in_use++;
+  _peak = MAX2(_peak, _in_use);
+  Chunk* c = _first;
+  if (c != NULL) {
+    _first = c->next();
+    _count--;
+  }
+  return c;
+}
+
+bool ChunkCache::free(Chunk* c) {
+  size_t length = c->length();
+  _bytes_in_use -= MIN2(_bytes_in_use, length);
+  if (length != Chunk::size) {
+    return false;
+  }
+  _in_use -= MIN2(_in_use, (size_t)1);
+  if (_count >= _target) {
+    return false;
+  }
+  c->set_next(_first);
+  _first = c;
+  _count++;
+  return true;
+}
+
+void ChunkCache::end_compilation() {
+  // Follow the peak of the last compilation, but decay slowly so that a
+  // run of small compilations does not immediately drop the chunks a
+  // large one will need again.
+  _target = MIN2(MAX2(_peak, _target / 2), (size_t)CompilerThreadChunkCacheSize);
+  _peak = _in_use;
+  size_t max_bytes = _max_compilation_bytes;
+  while (_peak_bytes > max_bytes) {
+    size_t prev = Atomic::cmpxchg(_peak_bytes, &_max_compilation_bytes, max_bytes);
+    if (prev == max_bytes) {
+      break;
+    }
+    max_bytes = prev;
+  }
+  _peak_bytes = _bytes_in_use;
+  while (_count > _target) {
+    Chunk* c = _first;
+    _first = c->next();
+    _count--;
+    ChunkPool::large_pool()->free(c);
+  }
+}
+
+void ChunkCache::release() {
+  _enabled = false;
+  _target = 0;
+  end_compilation();
+}
+
 //--------------------------------------------------------------------------------------
 // Chunk implementation
 
@@ -186,6 +265,13 @@ void* Chunk::operator new (size_t requested_size, AllocFailType alloc_failmode,
   // expect requested_size but if sizeof(Chunk) doesn't match isn't proper size we must align it.
   assert(ARENA_ALIGN(requested_size) == aligned_overhead_size(), "Bad alignment");
   size_t bytes = ARENA_ALIGN(requested_size) + length;
+  ChunkCache* cache = ChunkCache::current();
+  if (cache != NULL) {
+    void* p = cache->allocate(length);
+    if (p != NULL) {
+      return p;
+    }
+  }
   switch (length) {
    case Chunk::size:        return ChunkPool::large_pool()->allocate(bytes, alloc_failmode);
    case Chunk::medium_size: return ChunkPool::medium_pool()->allocate(bytes, alloc_failmode);
@@ -203,6 +289,10 @@ void* Chunk::operator new (size_t requested_size, AllocFailType alloc_failmode,
 
 void Chunk::operator delete(void* p) {
   Chunk* c = (Chunk*)p;
+  ChunkCache* cache = ChunkCache::current();
+  if (cache != NULL && cache->free(c)) {
+    return;
+  }
   switch (c->length()) {
    case Chunk::size:        ChunkPool::large_pool()->free(c); break;
    case Chunk::medium_size: ChunkPool::medium_pool()->free(c); break;
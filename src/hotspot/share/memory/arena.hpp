@@ -88,6 +88,45 @@ class Chunk: CHeapObj<mtChunk> {
   static void clean_chunk_pool();
 };
 
+// Cache of default sized chunks private to one compiler thread. A large
+// compilation checks out many chunks and returns them all at once when its
+// arenas die; the periodic ChunkPool cleaner then frees most of them and the
+// next compilation mallocs them again. The cache keeps as many chunks as
+// recent compilations of this thread needed, up to CompilerThreadChunkCacheSize.
+class ChunkCache {
+ private:
+  Chunk* _first;         // cached chunks, linked through Chunk::next()
+  size_t _count;         // number of cached chunks
+  size_t _target;        // number of chunks to keep, from recent peaks
+  size_t _in_use;        // default sized chunks checked out by the thread
+  size_t _peak;          // max _in_use since the last end_compilation()
+  size_t _bytes_in_use;  // bytes of all chunks checked out by the thread
+  size_t _peak_bytes;    // max _bytes_in_use since the last end_compilation()
+  bool   _enabled;
+
+  // High watermark of chunk bytes held by any one compilation
+  static volatile size_t _max_compilation_bytes;
+
+ public:
+  ChunkCache() : _first(NULL), _count(0), _target(0), _in_use(0), _peak(0),
+                 _bytes_in_use(0), _peak_bytes(0), _enabled(false) {}
+
+  // Cache of the current thread, or NULL if it does not have one
+  static ChunkCache* current();
+
+  void enable()                 { _enabled = true; }
+  size_t bytes_in_use() const   { return _bytes_in_use; }
+
+  static size_t max_compilation_bytes() { return _max_compilation_bytes; }
+
+  void* allocate(size_t length);
+  bool  free(Chunk* c);
+  // Resize the cache from the peak usage of the compilation that just ended.
+  void  end_compilation();
+  // Disable the cache and give all chunks back to ChunkPool.
+  void  release();
+};
+
 //------------------------------Arena------------------------------------------
 // Fast allocation of memory
 class Arena : public CHeapObj<mtNone> {
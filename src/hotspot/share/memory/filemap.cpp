@@ -31,6 +31,7 @@
 #include "classfile/symbolTable.hpp"
 #include "classfile/systemDictionaryShared.hpp"
 #include "classfile/altHashing.hpp"
+#include "gc/shared/gcConfig.hpp"
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
 #include "logging/logMessage.hpp"
@@ -968,6 +969,14 @@ void FileMapInfo::map_heap_regions_impl() {
   if (!MetaspaceShared::is_heap_object_archiving_allowed()) {
     log_info(cds)("CDS heap data is being ignored. UseG1GC, "
                   "UseCompressedOops and UseCompressedClassPointers are required.");
+    if (has_heap_regions()) {
+      // The archive does contain heap objects, so interned strings and
+      // mirrors of archived classes are re-created at startup instead.
+      log_info(cds)("Current settings: GC=%s, UseCompressedOops=%s, UseCompressedClassPointers=%s. "
+                    "Archived strings and mirrors will be re-created.",
+                    GCConfig::hs_err_name(), BOOL_TO_STR(UseCompressedOops),
+                    BOOL_TO_STR(UseCompressedClassPointers));
+    }
     return;
   }
 
@@ -523,6 +523,17 @@ FreeBlock* CodeHeap::search_freelist(size_t length) {
   return found_block;
 }
 
+bool CodeHeap::has_free_block_below(const void* p, size_t size) const {
+  size_t length = size_to_segments(size + header_size());
+  // The free list is sorted by address
+  for (FreeBlock* b = _freelist; b != NULL && (const void*)b < p; b = b->link()) {
+    if (b->length() >= length) {
+      return true;
+    }
+  }
+  return false;
+}
+
 //----------------------------------------------------------------------------
 // Non-product code
 
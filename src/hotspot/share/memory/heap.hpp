@@ -185,6 +185,7 @@ class CodeHeap : public CHeapObj<mtCode> {
 
   size_t allocated_in_freelist() const           { return _freelist_segments * CodeCacheSegmentSize; }
   int    freelist_length()       const           { return _freelist_length; } // number of elements in the freelist
+  bool   has_free_block_below(const void* p, size_t size) const; // is there a free block below p that can hold size bytes
 
   // returns the first block or NULL
   virtual void* first() const                    { return next_used(first_block()); }
@@ -27,10 +27,13 @@
 #include "classfile/moduleEntry.hpp"
 #include "classfile/systemDictionary.hpp"
 #include "gc/shared/collectedHeap.hpp"
+#include "gc/shared/workgroup.hpp"
 #include "memory/heapInspection.hpp"
 #include "memory/resourceArea.hpp"
 #include "oops/oop.inline.hpp"
 #include "oops/reflectionAccessorImplKlassHelper.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/mutexLocker.hpp"
 #include "runtime/os.hpp"
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/macros.hpp"
@@ -225,6 +228,21 @@ bool KlassInfoTable::record_instance(const oop obj) {
   }
 }
 
+// Return false if the entry could not be merged on account
+// of running out of space required to create a new entry.
+bool KlassInfoTable::merge_entry(const KlassInfoEntry* cie) {
+  Klass*          k = cie->klass();
+  KlassInfoEntry* elt = lookup(k);
+  if (elt != NULL) {
+    elt->set_count(elt->count() + cie->count());
+    elt->set_words(elt->words() + cie->words());
+    _size_of_instances_in_words += cie->words();
+    return true;
+  } else {
+    return false;
+  }
+}
+
 void KlassInfoTable::iterate(KlassInfoClosure* cic) {
   assert(_size == 0 || _buckets != NULL, "Allocation failure should have been caught");
   for (int index = 0; index < _size; index++) {
@@ -695,7 +713,8 @@ class RecordInstanceClosure : public ObjectClosure {
 
   void do_object(oop obj) {
     if (should_visit(obj)) {
-      if (!_cit->record_instance(obj)) {
+      // A NULL table means no table could be allocated
+      if (_cit == NULL || !_cit->record_instance(obj)) {
         _missed_count++;
       }
     }
@@ -709,15 +728,90 @@ class RecordInstanceClosure : public ObjectClosure {
   }
 };
 
-size_t HeapInspection::populate_table(KlassInfoTable* cit, BoolObjectClosure *filter) {
+class MergeKlassInfoClosure : public KlassInfoClosure {
+ private:
+  KlassInfoTable* _dest;
+  size_t _missed_count;
+ public:
+  MergeKlassInfoClosure(KlassInfoTable* dest) : _dest(dest), _missed_count(0) {}
+
+  void do_cinfo(KlassInfoEntry* cie) {
+    if (!_dest->merge_entry(cie)) {
+      _missed_count += cie->count();
+    }
+  }
+
+  size_t missed_count() { return _missed_count; }
+};
+
+// Each worker records instances in a table of its own, which is
+// merged into the shared table once the worker is done.
+class ParHeapInspectTask : public AbstractGangTask {
+ private:
+  ParallelObjectIterator* _poi;
+  KlassInfoTable* _shared_cit;
+  BoolObjectClosure* _filter;
+  volatile size_t _missed_count;
+  Mutex _mutex;
+
+ public:
+  ParHeapInspectTask(ParallelObjectIterator* poi, KlassInfoTable* shared_cit, BoolObjectClosure* filter) :
+    AbstractGangTask("Iterating heap"),
+    _poi(poi),
+    _shared_cit(shared_cit),
+    _filter(filter),
+    _missed_count(0),
+    _mutex(Mutex::leaf, "Parallel heap inspection merge lock", false, Mutex::_safepoint_check_never) {}
+
+  size_t missed_count() const { return _missed_count; }
+
+  virtual void work(uint worker_id) {
+    ResourceMark rm;
+
+    // Every worker must take part in the iteration, even if its
+    // table could not be allocated, so that the iteration can
+    // terminate. Instances it cannot record count as missed.
+    KlassInfoTable cit(false /* add_all_classes */);
+    RecordInstanceClosure ric(cit.allocation_failed() ? NULL : &cit, _filter);
+    _poi->object_iterate(&ric, worker_id);
+
+    size_t missed_count = ric.missed_count();
+    if (!cit.allocation_failed()) {
+      MutexLockerEx ml(&_mutex, Mutex::_no_safepoint_check_flag);
+      MergeKlassInfoClosure mkic(_shared_cit);
+      cit.iterate(&mkic);
+      missed_count += mkic.missed_count();
+    }
+
+    Atomic::add(missed_count, &_missed_count);
+  }
+};
+
+size_t HeapInspection::populate_table(KlassInfoTable* cit, BoolObjectClosure *filter, uint parallel_thread_num) {
   ResourceMark rm;
 
+  // Try parallel iteration first, if requested and the heap supports it
+  CollectedHeap* const heap = Universe::heap();
+  WorkGang* const workers = heap->get_safepoint_workers();
+  if (parallel_thread_num != 1 && workers != NULL) {
+    // Can't run with more threads than provided by the work gang
+    const uint nworkers = (parallel_thread_num == 0) ? workers->active_workers()
+                                                     : MIN2(parallel_thread_num, workers->total_workers());
+    ParallelObjectIterator* const poi = heap->parallel_object_iterator(nworkers);
+    if (poi != NULL) {
+      ParHeapInspectTask task(poi, cit, filter);
+      workers->run_task(&task, nworkers);
+      delete poi;
+      return task.missed_count();
+    }
+  }
+
   RecordInstanceClosure ric(cit, filter);
-  Universe::heap()->safe_object_iterate(&ric);
+  heap->safe_object_iterate(&ric);
   return ric.missed_count();
 }
 
-void HeapInspection::heap_inspection(outputStream* st) {
+void HeapInspection::heap_inspection(outputStream* st, uint parallel_thread_num) {
   ResourceMark rm;
 
   if (_print_help) {
@@ -741,7 +835,7 @@ void HeapInspection::heap_inspection(outputStream* st) {
   KlassInfoTable cit(_print_class_stats);
   if (!cit.allocation_failed()) {
     // populate table with object allocation info
-    size_t missed_count = populate_table(&cit);
+    size_t missed_count = populate_table(&cit, NULL /* filter */, parallel_thread_num);
     if (missed_count != 0) {
       st->print_cr("WARNING: Ran out of C-heap; undercounted " SIZE_FORMAT
                    " total instances in data below",
@@ -34,6 +34,8 @@
 #include "memory/metaspace/occupancyMap.hpp"
 #include "memory/metaspace/virtualSpaceNode.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "runtime/os.hpp"
+#include "utilities/align.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/ostream.hpp"
@@ -583,6 +585,10 @@ void ChunkManager::return_single_chunk(Metachunk* chunk) {
   // keeps tree node pointers in the chunk payload area which mangle will overwrite.
   DEBUG_ONLY(chunk->mangle(badMetaWordVal);)
 
+  if (MetaspaceReclaimFreeChunks && (index == MediumIndex || index == HumongousIndex)) {
+    release_chunk_memory(chunk);
+  }
+
   if (index != HumongousIndex) {
     // Return non-humongous chunk to freelist.
     ChunkList* list = free_chunks(index);
@@ -620,6 +626,23 @@ void ChunkManager::return_single_chunk(Metachunk* chunk) {
 
 }
 
+// Give the pages of a free chunk back to the OS. The chunk stays committed
+// and accessible; the pages are zero-filled on next touch. The chunk header,
+// and the tree node the humongous dictionary keeps behind it, must survive.
+void ChunkManager::release_chunk_memory(Metachunk* chunk) {
+  if (UseLargePagesInMetaspace) {
+    return;
+  }
+  const size_t page_size = os::vm_page_size();
+  char* start = align_up((char*)chunk + sizeof(TreeChunk<Metachunk, FreeList<Metachunk> >), page_size);
+  char* end = align_down((char*)chunk->end(), page_size);
+  if (start < end) {
+    os::free_memory(start, end - start, page_size);
+    log_trace(gc, metaspace, freelist)("released " SIZE_FORMAT " bytes of %s chunk at " PTR_FORMAT ".",
+        (size_t)(end - start), chunk_size_name(chunk->get_chunk_type()), p2i(chunk));
+  }
+}
+
 void ChunkManager::return_chunk_list(Metachunk* chunks) {
   if (chunks == NULL) {
     return;
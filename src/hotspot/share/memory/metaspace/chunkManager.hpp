@@ -96,6 +96,9 @@ class ChunkManager : public CHeapObj<mtInternal> {
   // free chunks to form a bigger chunk. Returns true if successful.
   bool attempt_to_coalesce_around_chunk(Metachunk* chunk, ChunkIndex target_chunk_type);
 
+  // Returns the payload pages of a free chunk to the OS (MetaspaceReclaimFreeChunks).
+  void release_chunk_memory(Metachunk* chunk);
+
   // Helper for chunk merging:
   //  Given an address range with 1-n chunks which are all supposed to be
   //  free and hence currently managed by this ChunkManager, remove them
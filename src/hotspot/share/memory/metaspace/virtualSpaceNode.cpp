@@ -475,9 +475,21 @@ bool VirtualSpaceNode::expand_by(size_t min_words, size_t preferred_words) {
   }
 
   size_t commit = MIN2(preferred_bytes, uncommitted);
+  char* const old_high = virtual_space()->high();
   bool result = virtual_space()->expand_by(commit, false);
 
   if (result) {
+    if (is_class() && UseLargePages && !UseLargePagesInMetaspace) {
+      // Ask the OS to back the committed, large page aligned part of the
+      // class space with large pages where it can do so transparently
+      // (madvise with THP on Linux). The commit granularity is not affected.
+      const size_t lps = os::large_page_size();
+      char* const start = MAX2(align_up(virtual_space()->low_boundary(), lps), align_down(old_high, lps));
+      char* const end = align_down(virtual_space()->high(), lps);
+      if (start < end) {
+        os::realign_memory(start, end - start, lps);
+      }
+    }
     log_trace(gc, metaspace, freelist)("Expanded %s virtual space list node by " SIZE_FORMAT " words.",
         (is_class() ? "class" : "non-class"), commit);
     DEBUG_ONLY(Atomic::inc(&g_internal_statistics.num_committed_space_expanded));
@@ -685,14 +685,19 @@ jint universe_init() {
 
   JavaClasses::compute_hard_coded_offsets();
 
-  jint status = Universe::initialize_heap();
+  jint status;
+  { TraceTime heap_timer("Initialize heap", TRACETIME_LOG(Info, startuptime));
+    status = Universe::initialize_heap();
+  }
   if (status != JNI_OK) {
     return status;
   }
 
   SystemDictionary::initialize_oop_storage();
 
-  Metaspace::global_initialize();
+  { TraceTime metaspace_timer("Initialize metaspace", TRACETIME_LOG(Info, startuptime));
+    Metaspace::global_initialize();
+  }
 
   // Initialize performance counters for metaspaces
   MetaspaceCounters::initialize_performance_counters();
@@ -725,7 +730,9 @@ jint universe_init() {
     // the file (other than the mapped regions) is no longer needed, and
     // the file is closed. Closing the file does not affect the
     // currently mapped regions.
-    MetaspaceShared::initialize_shared_spaces();
+    { TraceTime shared_timer("Initialize shared spaces", TRACETIME_LOG(Info, startuptime));
+      MetaspaceShared::initialize_shared_spaces();
+    }
     StringTable::create_table();
   } else
 #endif
@@ -385,6 +385,7 @@ class Universe: AllStatic {
   static Klass** singleArrayKlassObj_addr()         { return &_singleArrayKlassObj; }
   static Klass** doubleArrayKlassObj_addr()         { return &_doubleArrayKlassObj; }
   static Klass** objectArrayKlassObj_addr()         { return &_objectArrayKlassObj; }
+  static Klass** typeArrayKlassObjs_addr()          { return &_typeArrayKlassObjs[0]; }
 
   // The particular choice of collected heap.
   static CollectedHeap* heap() { return _collectedHeap; }
@@ -392,6 +392,10 @@ void ConstantPool::remove_unshareable_info() {
       // at runtime.
       CPKlassSlot kslot = klass_slot_at(index);
       int resolved_klass_index = kslot.resolved_klass_index();
+      if (ArchiveResolvedClassEntries &&
+          can_archive_resolved_klass(resolved_klasses()->at(resolved_klass_index))) {
+        continue;
+      }
       int name_index = kslot.name_index();
       assert(tag_at(name_index).is_symbol(), "sanity");
       resolved_klasses()->at_put(resolved_klass_index, NULL);
@@ -404,6 +408,24 @@ void ConstantPool::remove_unshareable_info() {
   }
 }
 
+// A resolved class entry can stay resolved in the archive only if the
+// runtime resolution is guaranteed to produce the same Klass without
+// loading or initializing anything: the pool holder itself and its
+// supertypes. SystemDictionary::load_shared_class() only accepts an
+// archived class if its super class and interfaces resolve to the archived
+// ones, so these entries are valid whenever the pool holder is loaded
+// from the archive.
+bool ConstantPool::can_archive_resolved_klass(Klass* k) const {
+  InstanceKlass* holder = pool_holder();
+  if (k == NULL || holder == NULL) {
+    return false;
+  }
+  if (k == holder) {
+    return true;
+  }
+  return k->is_instance_klass() && holder->is_subtype_of(k);
+}
+
 int ConstantPool::cp_to_object_index(int cp_index) {
   // this is harder don't do this so much.
   int i = reference_map()->find(cp_index);
@@ -1001,6 +1001,7 @@ public:
   static ByteSize init_state_offset()  { return in_ByteSize(offset_of(InstanceKlass, _init_state)); }
   JFR_ONLY(DEFINE_KLASS_TRACE_ID_OFFSET;)
   static ByteSize init_thread_offset() { return in_ByteSize(offset_of(InstanceKlass, _init_thread)); }
+  static ByteSize array_klasses_offset() { return in_ByteSize(offset_of(InstanceKlass, _array_klasses)); }
 
   // subclass/subinterface checks
   bool implements_interface(Klass* k) const;
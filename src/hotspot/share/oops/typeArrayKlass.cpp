@@ -238,6 +238,10 @@ int TypeArrayKlass::oop_size(oop obj) const {
   return t->object_size();
 }
 
+int TypeArrayKlass::array_size(int length) const {
+  return typeArrayOopDesc::object_size(layout_helper(), length);
+}
+
 void TypeArrayKlass::initialize(TRAPS) {
   // Nothing to do. Having this function is handy since objArrayKlasses can be
   // initialized by calling initialize on their bottom_klass, see ObjArrayKlass::initialize
@@ -63,6 +63,8 @@ class TypeArrayKlass : public ArrayKlass {
   }
 
   int oop_size(oop obj) const;
+  // Size in words of an array of this type with the given length
+  int array_size(int length) const;
 
   bool compute_is_subtype_of(Klass* k);
 
@@ -26,6 +26,7 @@
 #include "libadt/vectset.hpp"
 #include "memory/allocation.inline.hpp"
 #include "memory/resourceArea.hpp"
+#include "compiler/compileLog.hpp"
 #include "compiler/compilerDirectives.hpp"
 #include "opto/block.hpp"
 #include "opto/cfgnode.hpp"
@@ -713,6 +714,30 @@ void PhaseCFG::remove_empty_blocks() {
   } // End of for all blocks
 }
 
+// Frequency based layout may append cold traces to hot ones.  Move the
+// uncommon blocks (uncommon traps, exception and slow paths) behind all
+// other code so that the hot part of the method is one contiguous range
+// and the cold tail shares i-cache lines and pages with the stubs.
+void PhaseCFG::move_uncommon_blocks_to_end() {
+  uint last = number_of_blocks();
+  uint moved = 0;
+  for (uint i = 1; i < last; i++) {
+    Block* block = get_block(i);
+    if (block->is_connector() || !is_uncommon(block) || no_flip_branch(block)) {
+      continue;
+    }
+    move_to_end(block, i);
+    last--;                     // No longer check for being uncommon!
+    i--;                        // backup block counter post-increment
+    moved++;
+  }
+
+  CompileLog* log = C->log();
+  if (log != NULL && moved > 0) {
+    log->elem("cold_blocks count='%d'", moved);
+  }
+}
+
 Block *PhaseCFG::fixup_trap_based_check(Node *branch, Block *block, int block_pos, Block *bnext) {
   // Trap based checks must fall through to the successor with
   // PROB_ALWAYS.
@@ -601,6 +601,8 @@ class PhaseCFG : public Phase {
 
   // Remove empty basic blocks
   void remove_empty_blocks();
+  // Move uncommon blocks behind the hot code after frequency based layout
+  void move_uncommon_blocks_to_end();
   Block *fixup_trap_based_check(Node *branch, Block *block, int block_pos, Block *bnext);
   void fixup_flow();
 
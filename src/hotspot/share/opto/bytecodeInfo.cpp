@@ -104,9 +104,51 @@ static bool is_unboxing_method(ciMethod* callee_method, Compile* C) {
   return C->eliminate_boxing() && callee_method->is_unboxing_method();
 }
 
+// Rough number of ideal nodes parsing one bytecode of the callee adds
+const int inline_nodes_per_bytecode = 4;
+
+// Inlining size limit of the benefit model: the default limit grows with
+// the call site's share of the compiled method's profile (up to twice the
+// limit for a site that accounts for all of it) and with the number of
+// constant arguments, which usually fold much of the callee. It shrinks
+// once half of InlineNodeBudget is used, and is 0 when the callee
+// doesn't fit in what is left of the budget.
+int InlineTree::benefit_inline_size(ciMethod* callee_method, JVMState* jvms,
+                                    int max_inline_size) const {
+  int caller_bci = jvms->bci();
+  float site_ratio = _site_invoke_ratio * compute_callee_frequency(caller_bci);
+  site_ratio = MIN2(MAX2(site_ratio, 0.0f), 1.0f);
+
+  int const_args = 0;
+  if (jvms->map() != NULL) {
+    for (int i = 0; i < callee_method->arg_size(); i++) {
+      Node* arg = jvms->map()->argument(jvms, i);
+      if (arg != NULL && !arg->is_top() && C->initial_gvn()->type(arg)->singleton()) {
+        const_args++;
+      }
+    }
+  }
+
+  int limit = (int)(max_inline_size * (1.0f + site_ratio)) + const_args * (int)InlineConstantArgBonus;
+
+  int budget_left = C->inline_node_budget_left();
+  int size = callee_method->code_size_for_inlining();
+  if (budget_left < size * inline_nodes_per_bytecode) {
+    limit = 0;
+  } else if (budget_left < InlineNodeBudget / 2) {
+    limit = (int)((jlong)limit * budget_left / (InlineNodeBudget / 2));
+  }
+
+  if (C->log() != NULL) {
+    C->log()->elem("inline_score size='%d' limit='%d' default_limit='%d' site_ratio='%.3f' const_args='%d' budget_left='%d'",
+                   size, limit, max_inline_size, site_ratio, const_args, budget_left);
+  }
+  return limit;
+}
+
 // positive filter: should callee be inlined?
 bool InlineTree::should_inline(ciMethod* callee_method, ciMethod* caller_method,
-                               int caller_bci, ciCallProfile& profile,
+                               JVMState* jvms, ciCallProfile& profile,
                                WarmCallInfo* wci_result) {
   // Allows targeted inlining
   if (C->directive()->should_inline(callee_method)) {
@@ -127,6 +169,7 @@ bool InlineTree::should_inline(ciMethod* callee_method, ciMethod* caller_method,
   }
 
 #ifndef PRODUCT
+  int caller_bci = jvms->bci();
   int inline_depth = inline_level()+1;
   if (ciReplay::should_inline(C->replay_inline_data(), callee_method, caller_bci, inline_depth)) {
     set_msg("force inline by ciReplay");
@@ -181,6 +224,14 @@ bool InlineTree::should_inline(ciMethod* callee_method, ciMethod* caller_method,
       return false;
     }
   }
+  if (UseInlineBenefitModel) {
+    int limit = benefit_inline_size(callee_method, jvms, max_inline_size);
+    if (size > limit) {
+      set_msg(limit == 0 ? "inline node budget exhausted" : "too big for benefit");
+      return false;
+    }
+    return true;
+  }
   if (size > max_inline_size) {
     if (max_inline_size > default_max_inline_size) {
       set_msg("hot method too big");
@@ -338,7 +389,7 @@ bool InlineTree::try_to_inline(ciMethod* callee_method, ciMethod* caller_method,
   }
 
   _forced_inline = false; // Reset
-  if (!should_inline(callee_method, caller_method, caller_bci, profile,
+  if (!should_inline(callee_method, caller_method, jvms, profile,
                      wci_result)) {
     return false;
   }
@@ -648,6 +699,8 @@ InlineTree *InlineTree::build_inline_tree_for_callee( ciMethod* callee_method, J
     } else if (callee_method->is_method_handle_intrinsic() ||
                callee_method->is_compiled_lambda_form()) {
       max_inline_level_adjust += 1;  // don't count method handle calls from java.lang.invoke implementation
+    } else if (caller_jvms->method()->holder()->name() == ciSymbol::java_lang_StringConcatHelper()) {
+      max_inline_level_adjust += 1;  // don't count the copy helpers of indy string concat
     }
     if (max_inline_level_adjust != 0 && C->print_inlining() && (Verbose || WizardMode)) {
       CompileTask::print_inline_indent(inline_level());
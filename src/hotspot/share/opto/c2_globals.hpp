@@ -201,6 +201,10 @@
   product(bool, UseVectorCmov, false,                                       \
           "Use Vectorized Cmov")                                            \
                                                                             \
+  product(bool, EnableVectorSupport, true,                                  \
+          "Intrinsify the explicit vector operations of "                   \
+          "jdk.internal.vm.vector.VectorSupport")                           \
+                                                                            \
   develop(intx, UnrollLimitForProfileCheck, 1,                              \
           "Don't use profile_trip_cnt() to restrict unrolling until "       \
           "unrolling would push the number of unrolled iterations above "   \
@@ -263,6 +267,14 @@
   product(bool, ReduceBulkZeroing, true,                                    \
           "When bulk-initializing, try to avoid needless zeroing")          \
                                                                             \
+  product(bool, ReduceFilledArrayZeroing, true,                             \
+          "Do not zero primitive arrays that a following counted loop "     \
+          "stores to in full before they are otherwise used")               \
+                                                                            \
+  notproduct(bool, CountFilledArrayZeroing, false,                          \
+          "Count the bytes of array zeroing avoided by "                    \
+          "ReduceFilledArrayZeroing (see PrintOptoStatistics)")             \
+                                                                            \
   product(bool, UseFPUForSpilling, false,                                   \
           "Spill integer registers to FPU instead of stack when possible")  \
                                                                             \
@@ -305,6 +317,12 @@
   product_pd(bool, OptoRegScheduling,                                       \
           "Instruction Scheduling before register allocation for pressure") \
                                                                             \
+  product(intx, OptoLoadUseLatency, 0,                                      \
+          "Extra cycles assumed between a load and its uses when "          \
+          "computing scheduling latencies, on top of the pipeline "         \
+          "description")                                                    \
+          range(0, 16)                                                      \
+                                                                            \
   product(bool, PartialPeelLoop, true,                                      \
           "Partial peel (rotate) loops")                                    \
                                                                             \
@@ -327,6 +345,21 @@
   notproduct(bool, TraceLoopUnswitching, false,                             \
           "Trace loop unswitching")                                         \
                                                                             \
+  product(intx, LoopUnswitchingMaxConditions, 3,                            \
+          "Maximum number of strongly biased invariant tests that a "       \
+          "single loop unswitching step hoists together")                   \
+          range(1, 8)                                                       \
+                                                                            \
+  product(bool, LoopVersioningForAliasing, true,                            \
+          "Version counted loops that store through one array and access "  \
+          "another array of the same type with a runtime check that the "   \
+          "arrays are distinct, so that the fast version can be vectorized")\
+                                                                            \
+  product(intx, LoopVersioningMaxAliasChecks, 4,                            \
+          "Maximum number of array base pairs checked by loop versioning "  \
+          "for aliasing")                                                   \
+          range(1, 16)                                                      \
+                                                                            \
   product(bool, AllowVectorizeOnDemand, true,                               \
           "Globally supress vectorization set in VectorizeMethod")          \
                                                                             \
@@ -339,6 +372,10 @@
   product(bool, SuperWordReductions, true,                                  \
           "Enable reductions support in superword.")                        \
                                                                             \
+  product(bool, SuperWordReductionsOutOfLoop, true,                         \
+          "Keep a vector accumulator in vectorized loops with integral "    \
+          "add and mul reductions, and reduce it once after the loop.")     \
+                                                                            \
   product(bool, UseCMoveUnconditionally, false,                             \
           "Use CMove (scalar and vector) ignoring profitability test.")     \
                                                                             \
@@ -358,6 +395,12 @@
           "Limit of ops to make speculative when using CMOVE")              \
           range(0, max_jint)                                                \
                                                                             \
+  product(intx, UnpredictableBranchPercent, 10,                             \
+          "A profiled branch taken between 50-N and 50+N percent of the "   \
+          "time is treated as unpredictable, and twice the CMOVE "          \
+          "speculation limit is allowed to remove it")                      \
+          range(0, 50)                                                      \
+                                                                            \
   /* Set BranchOnRegister == false. See 4965987. */                         \
   product(bool, BranchOnRegister, false,                                    \
           "Use Sparc V9 branch-on-register opcodes")                        \
@@ -396,6 +439,21 @@
   product(bool, UseOnlyInlinedBimorphic, true,                              \
           "Don't use BimorphicInlining if can't inline a second method")    \
                                                                             \
+  product(bool, UsePolymorphicInlining, false,                              \
+          "Profiling based inlining for up to PolymorphicInliningLimit "    \
+          "receivers behind a chain of type guards, with a virtual call "   \
+          "for the remaining receivers")                                    \
+                                                                            \
+  product(intx, PolymorphicInliningLimit, 4,                                \
+          "Maximum number of receivers inlined at a call site by "          \
+          "UsePolymorphicInlining")                                         \
+          range(3, 8)                                                       \
+                                                                            \
+  product(intx, PolymorphicInliningMinCoverage, 90,                         \
+          "Percentage of a call site's profile that the inlined receivers " \
+          "must cover for UsePolymorphicInlining")                          \
+          range(0, 100)                                                     \
+                                                                            \
   product(bool, InsertMemBarAfterArraycopy, true,                           \
           "Insert memory barrier after arraycopy call")                     \
                                                                             \
@@ -422,6 +480,21 @@
           "If parser node generation exceeds limit stop inlining")          \
           range(0, max_jint)                                                \
                                                                             \
+  experimental(bool, UseInlineBenefitModel, false,                          \
+          "Scale the inlining size limit of a call site by its share of "   \
+          "the compiled method's profile and its constant arguments, "      \
+          "and stop inlining when InlineNodeBudget is used up")             \
+                                                                            \
+  experimental(intx, InlineNodeBudget, 30000,                               \
+          "Live node budget of one compilation for inlining decisions "     \
+          "made by UseInlineBenefitModel")                                  \
+          range(1000, max_jint)                                             \
+                                                                            \
+  experimental(intx, InlineConstantArgBonus, 8,                             \
+          "Bytecodes added to the inlining size limit for each constant "   \
+          "argument at a call site with UseInlineBenefitModel")             \
+          range(0, 1000)                                                    \
+                                                                            \
   develop(intx, NodeCountInliningStep, 1000,                                \
           "Target size of warm calls inlined between optimization passes")  \
           range(0, max_jint)                                                \
@@ -494,6 +567,12 @@
   product(bool, EliminateNestedLocks, true,                                 \
           "Eliminate nested locks of the same object when possible")        \
                                                                             \
+  product(intx, LoopLockCoarseningLimit, 8,                                 \
+          "Maximum number of loop iterations executed under one monitor "   \
+          "region when unrolling coarsens a lock on a loop invariant "      \
+          "object. 0 leaves such loops to the default unroll policy")       \
+          range(0, max_jint)                                                \
+                                                                            \
   notproduct(bool, PrintLockStatistics, false,                              \
           "Print precise statistics on the dynamic lock usage")             \
                                                                             \
@@ -541,10 +620,27 @@
   notproduct(bool, PrintEliminateAllocations, false,                        \
           "Print out when allocations are eliminated")                      \
                                                                             \
+  product(bool, ReduceAllocationMerges, true,                               \
+          "Split field loads through Phis that merge fresh allocations so " \
+          "that the allocations can still be scalar replaced")              \
+                                                                            \
+  notproduct(bool, TraceReduceAllocationMerges, false,                      \
+          "Trace splitting of field loads through allocation merges")       \
+                                                                            \
   product(intx, EliminateAllocationArraySizeLimit, 64,                      \
           "Array size (number of elements) limit for scalar replacement")   \
           range(0, max_jint)                                                \
                                                                             \
+  product(bool, SpeculateColdCallEscapes, true,                             \
+          "Replace a rarely executed call that is not inlined and takes "   \
+          "a freshly allocated object with an uncommon trap, so that the "  \
+          "object can still be scalar replaced on the other paths")         \
+                                                                            \
+  product(double, ColdCallEscapeRatio, 0.01,                                \
+          "A call site is cold if it is executed less often than this "     \
+          "fraction of the invocations of its method")                      \
+          range(0.0, 1.0)                                                   \
+                                                                            \
   product(bool, OptimizePtrCompare, true,                                   \
           "Use escape analysis to optimize pointers compare")               \
                                                                             \
@@ -586,6 +682,10 @@
   product(bool, BlockLayoutRotateLoops, true,                               \
           "Allow back branches to be fall throughs in the block layout")    \
                                                                             \
+  product(bool, BlockLayoutColdAtEnd, true,                                 \
+          "Place uncommon blocks behind all other code after frequency "    \
+          "based block layout")                                             \
+                                                                            \
   diagnostic(bool, InlineReflectionGetCallerClass, true,                    \
           "inline sun.reflect.Reflection.getCallerClass(), known to be "    \
           "part of base library DLL")                                       \
@@ -602,6 +702,9 @@
   diagnostic(bool, SpecialStringEquals, true,                               \
           "special version of string equals")                               \
                                                                             \
+  diagnostic(bool, SpecialStringHashCode, true,                             \
+          "special version of Latin1 string hashCode")                      \
+                                                                            \
   diagnostic(bool, SpecialArraysEquals, true,                               \
           "special version of Arrays.equals(char[],char[])")                \
                                                                             \
@@ -758,6 +861,18 @@
           "Loop with fewer iterations are not strip mined")                 \
           range(0, max_juint)                                               \
                                                                             \
+  product(uintx, LoopStripMiningBodyCost, 16,                               \
+          "Estimated cost, in nodes, of a loop body for which "             \
+          "LoopStripMiningIter iterations run between safepoint polls. "    \
+          "Cheaper loops run more iterations per poll, costlier loops "     \
+          "fewer. 0 uses LoopStripMiningIter for every loop")               \
+          range(0, max_juint)                                               \
+                                                                            \
+  product(bool, UseLongLoopNests, true,                                     \
+          "Turn innermost loops with a long induction variable into a "     \
+          "nest whose inner loop has an int trip counter, so that the "     \
+          "inner loop can be optimized as a counted loop")                  \
+                                                                            \
   product(bool, UseProfiledLoopPredicate, true,                             \
           "move predicates out of loops based on profiling data")           \
 
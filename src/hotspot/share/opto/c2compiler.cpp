@@ -203,6 +203,9 @@ bool C2Compiler::is_intrinsic_supported(const methodHandle& method, bool is_virt
   case vmIntrinsics::_equalsU:
     if (!Matcher::match_rule_supported(Op_StrEquals)) return false;
     break;
+  case vmIntrinsics::_hashCodeL:
+    if (!Matcher::match_rule_supported(Op_StrHashCode)) return false;
+    break;
   case vmIntrinsics::_equalsB:
   case vmIntrinsics::_equalsC:
     if (!Matcher::match_rule_supported(Op_AryEq)) return false;
@@ -423,6 +426,9 @@ bool C2Compiler::is_intrinsic_supported(const methodHandle& method, bool is_virt
   case vmIntrinsics::_onSpinWait:
     if (!Matcher::match_rule_supported(Op_OnSpinWait)) return false;
     break;
+  case vmIntrinsics::_VectorBinaryOp:
+    if (!EnableVectorSupport || MaxVectorSize < 8) return false;
+    break;
   case vmIntrinsics::_fmaD:
     if (!UseFMA || !Matcher::match_rule_supported(Op_FmaD)) return false;
     break;
@@ -668,12 +668,76 @@ void PhaseChaitin::Register_Allocate() {
     }
   }
 
+  record_spill_statistics();
+
   // Done!
   _live = NULL;
   _ifg = NULL;
   C->set_indexSet_arena(NULL);  // ResourceArea is at end of scope
 }
 
+//------------------------------record_spill_statistics------------------------
+// Classify the surviving spill copies by source and destination location and
+// weight them by block frequency.  Spills around calls in hot loops show up
+// as a large load/store cost relative to the number of spill copies.
+void PhaseChaitin::record_spill_statistics() {
+  CompileLog* log = C->log();
+#ifdef PRODUCT
+  if (log == NULL) {
+    return;
+  }
+#endif
+  int loads = 0, stores = 0, memoves = 0, copies = 0;
+  double load_cost = 0, store_cost = 0, memove_cost = 0, copy_cost = 0;
+  for (uint i = 0; i < _cfg.number_of_blocks(); i++) {
+    Block* block = _cfg.get_block(i);
+    for (uint j = 1; j < block->number_of_nodes(); j++) {
+      Node* n = block->get_node(j);
+      if (!n->is_MachSpillCopy()) {
+        continue;
+      }
+      OptoReg::Name src = get_reg_first(n->in(1));
+      OptoReg::Name dst = get_reg_first(n);
+      if (!OptoReg::is_valid(src) || !OptoReg::is_valid(dst)) {
+        continue;
+      }
+      if (OptoReg::is_stack(src)) {
+        if (OptoReg::is_stack(dst)) {
+          memoves++;
+          memove_cost += block->_freq;
+        } else {
+          loads++;
+          load_cost += block->_freq;
+        }
+      } else if (OptoReg::is_stack(dst)) {
+        stores++;
+        store_cost += block->_freq;
+      } else {
+        copies++;
+        copy_cost += block->_freq;
+      }
+    }
+  }
+
+  if (log != NULL) {
+    log->elem("regalloc_spills loads='%d' stores='%d' memoves='%d' copies='%d'"
+              " load_cost='%.0f' store_cost='%.0f' memove_cost='%.0f' copy_cost='%.0f'",
+              loads, stores, memoves, copies,
+              load_cost, store_cost, memove_cost, copy_cost);
+  }
+
+#ifndef PRODUCT
+  _final_loads   += loads;
+  _final_stores  += stores;
+  _final_memoves += memoves;
+  _final_copies  += copies;
+  _final_load_cost   += load_cost;
+  _final_store_cost  += store_cost;
+  _final_memove_cost += memove_cost;
+  _final_copy_cost   += copy_cost;
+#endif
+}
+
 void PhaseChaitin::de_ssa() {
   // Set initial Names for all Nodes.  Most Nodes get the virtual register
   // number.  A few get the ZERO live range number.  These do not
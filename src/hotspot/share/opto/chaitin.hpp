@@ -701,6 +701,10 @@ private:
   // Set C->failing when fixup spills could not complete, node limit exceeded.
   void fixup_spills();
 
+  // Count the spill code left after allocation and report it in the
+  // compile log.
+  void record_spill_statistics();
+
   // Post-Allocation peephole copy removal
   void post_allocate_copy_removal();
   Node *skip_copies( Node *c );
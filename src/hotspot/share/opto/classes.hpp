@@ -296,6 +296,7 @@ macro(StoreNKlass)
 macro(StrComp)
 macro(StrCompressedCopy)
 macro(StrEquals)
+macro(StrHashCode)
 macro(StrIndexOf)
 macro(StrIndexOfChar)
 macro(StrInflatedCopy)
@@ -312,6 +313,8 @@ macro(URShiftL)
 macro(XorI)
 macro(XorL)
 macro(Vector)
+macro(VectorMaskCmp)
+macro(VectorBlend)
 macro(AddVB)
 macro(AddVS)
 macro(AddVI)
@@ -262,6 +262,7 @@ void Compile::print_statistics() {
     Scheduling::print_statistics();
     PhasePeephole::print_statistics();
     PhaseIdealLoop::print_statistics();
+    PhaseMacroExpand::print_statistics();
     if (xtty != NULL)  xtty->tail("statistics");
   }
   if (_intrinsic_hist_flags[vmIntrinsics::_none] != 0) {
@@ -2531,6 +2532,9 @@ void Compile::Code_Gen() {
     cfg.remove_empty_blocks();
     if (do_freq_based_layout()) {
       PhaseBlockLayout layout(cfg);
+      if (BlockLayoutColdAtEnd) {
+        cfg.move_uncommon_blocks_to_end();
+      }
     } else {
       cfg.set_loop_alignment();
     }
@@ -4007,8 +4011,16 @@ void Compile::record_failure(const char* reason) {
 
 Compile::TracePhase::TracePhase(const char* name, elapsedTimer* accumulator)
   : TraceTime(name, accumulator, CITime, CITimeVerbose),
-    _phase_name(name), _dolog(CITimeVerbose)
+    _phase_name(name), _dolog(CITimeVerbose), _phase_id(-1), _start_bytes(0)
 {
+  if (CITime) {
+    ChunkCache* cache = ChunkCache::current();
+    if (cache != NULL && accumulator >= &Phase::timers[0] &&
+        accumulator < &Phase::timers[Phase::max_phase_timers]) {
+      _phase_id = (int)(accumulator - &Phase::timers[0]);
+      _start_bytes = cache->bytes_in_use();
+    }
+  }
   if (_dolog) {
     C = Compile::current();
     _log = C->log();
@@ -4046,6 +4058,12 @@ Compile::TracePhase::~TracePhase() {
   if (_log != NULL) {
     _log->done("phase name='%s' nodes='%d' live='%d'", _phase_name, C->unique(), C->live_nodes());
   }
+
+  if (_phase_id >= 0) {
+    ChunkCache* cache = ChunkCache::current();
+    size_t end_bytes = (cache != NULL) ? cache->bytes_in_use() : 0;
+    Phase::record_arena_growth(_phase_id, end_bytes > _start_bytes ? end_bytes - _start_bytes : 0);
+  }
 }
 
 //=============================================================================
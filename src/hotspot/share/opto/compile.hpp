@@ -185,6 +185,8 @@ class Compile : public Phase {
     CompileLog* _log;
     const char* _phase_name;
     bool _dolog;
+    int _phase_id;              // index into Phase::timers, or -1
+    size_t _start_bytes;        // arena chunk bytes in use at phase start
    public:
     TracePhase(const char* name, elapsedTimer* accumulator);
     ~TracePhase();
@@ -1001,6 +1003,8 @@ class Compile : public Phase {
   CallGenerator*    call_generator(ciMethod* call_method, int vtable_index, bool call_does_dispatch,
                                    JVMState* jvms, bool allow_inline, float profile_factor, ciKlass* speculative_receiver_type = NULL,
                                    bool allow_intrinsics = true, bool delayed_forbidden = false);
+  CallGenerator*    polymorphic_call_generator(ciMethod* callee, int vtable_index, JVMState* jvms,
+                                               float profile_factor, ciCallProfile& profile);
   bool should_delay_inlining(ciMethod* call_method, JVMState* jvms) {
     return should_delay_string_inlining(call_method, jvms) ||
            should_delay_boxing_inlining(call_method, jvms);
@@ -1091,6 +1095,11 @@ class Compile : public Phase {
     }
   }
 
+  // Live nodes the benefit driven inliner may still spend
+  int inline_node_budget_left() const {
+    return (int)InlineNodeBudget - (int)live_nodes();
+  }
+
   void inc_number_of_mh_late_inlines() { _number_of_mh_late_inlines++; }
   void dec_number_of_mh_late_inlines() { assert(_number_of_mh_late_inlines > 0, "_number_of_mh_late_inlines < 0 !"); _number_of_mh_late_inlines--; }
   bool has_mh_late_inlines() const     { return _number_of_mh_late_inlines > 0; }
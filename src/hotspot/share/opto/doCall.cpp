@@ -290,6 +290,12 @@ CallGenerator* Compile::call_generator(ciMethod* callee, int vtable_index, bool
           }
         }
       }
+      if (receiver_method == NULL && UsePolymorphicInlining && speculative_receiver_type == NULL &&
+          morphism != 1 && !(morphism == 2 && UseBimorphicInlining) && profile.has_receiver(1)) {
+        // No receiver dominates: guard and inline several of them.
+        CallGenerator* cg = polymorphic_call_generator(callee, vtable_index, jvms, prof_factor, profile);
+        if (cg != NULL)  return cg;
+      }
     }
   }
 
@@ -314,6 +320,58 @@ CallGenerator* Compile::call_generator(ciMethod* callee, int vtable_index, bool
   }
 }
 
+// Inline the most frequent receivers of a polymorphic call site behind a
+// chain of type guards, tested in profile order. Receivers that are not
+// inlined and the receivers not in the profile take a virtual call.
+CallGenerator* Compile::polymorphic_call_generator(ciMethod* callee, int vtable_index, JVMState* jvms,
+                                                   float prof_factor, ciCallProfile& profile) {
+  int limit = MIN2((int)PolymorphicInliningLimit, profile.morphism_limit());
+  int receivers[ciCallProfile::MaxMorphismLimit];
+  ciMethod* receiver_methods[ciCallProfile::MaxMorphismLimit];
+  CallGenerator* hit_cgs[ciCallProfile::MaxMorphismLimit];
+  int hits = 0;
+  float coverage = 0.0f;
+  for (int i = 0; i < limit && profile.has_receiver(i); i++) {
+    ciMethod* receiver_method = callee->resolve_invoke(jvms->method()->holder(), profile.receiver(i));
+    if (receiver_method == NULL) {
+      continue;
+    }
+    CallGenerator* hit_cg = call_generator(receiver_method, vtable_index, false, jvms, true, prof_factor);
+    if (hit_cg == NULL || !hit_cg->is_inline()) {
+      // A guarded direct call is not worth the guards in front of it.
+      continue;
+    }
+    receivers[hits] = i;
+    receiver_methods[hits] = receiver_method;
+    hit_cgs[hits] = hit_cg;
+    hits++;
+    coverage += profile.receiver_prob(i);
+  }
+  if (hits < 2 || 100.0f * coverage < (float)PolymorphicInliningMinCoverage) {
+    return NULL;
+  }
+
+  CallGenerator* cg = CallGenerator::for_virtual_call(callee, vtable_index);
+  // Guard k is reached by the receivers that missed guards 0..k-1.
+  float reached = 1.0f;
+  float reached_at[ciCallProfile::MaxMorphismLimit];
+  for (int k = 0; k < hits; k++) {
+    reached_at[k] = reached;
+    reached -= profile.receiver_prob(receivers[k]);
+  }
+  for (int k = hits - 1; k >= 0 && cg != NULL; k--) {
+    int i = receivers[k];
+    trace_type_profile(C, jvms->method(), jvms->depth() - 1, jvms->bci(), receiver_methods[k],
+                       profile.receiver(i), profile.count(), profile.receiver_count(i));
+    float hit_prob = MIN2(profile.receiver_prob(i) / MAX2(reached_at[k], profile.receiver_prob(i)), PROB_MAX);
+    cg = CallGenerator::for_predicted_call(profile.receiver(i), cg, hit_cgs[k], hit_prob);
+  }
+  if (cg != NULL && log() != NULL) {
+    log()->elem("polymorphic_inline receivers='%d' coverage='%.3f'", hits, coverage);
+  }
+  return cg;
+}
+
 // Return true for methods that shouldn't be inlined early so that
 // they are easier to analyze and optimize as intrinsics.
 bool Compile::should_delay_string_inlining(ciMethod* call_method, JVMState* jvms) {
@@ -416,6 +474,35 @@ static bool check_call_consistency(JVMState* jvms, CallGenerator* cg) {
 }
 #endif // ASSERT
 
+//------------------------------should_trap_cold_escape------------------------
+bool Parse::should_trap_cold_escape(int nargs) {
+  if (!SpeculateColdCallEscapes || !C->do_escape_analysis() || !EliminateAllocations) {
+    return false;
+  }
+  ciMethodData* md = method()->method_data_or_null();
+  if (md == NULL || !md->is_mature()) {
+    return false;
+  }
+  // Give up on this call site once the speculation has failed.
+  if (C->too_many_traps(method(), bci(), Deoptimization::Reason_unstable_if)) {
+    return false;
+  }
+  ciCallProfile profile = method()->call_profile_at_bci(bci());
+  int invocations = method()->interpreter_invocation_count();
+  if (profile.count() < 0 || invocations <= 0 ||
+      profile.count() >= invocations * ColdCallEscapeRatio) {
+    return false;
+  }
+  for (int i = 0; i < nargs; i++) {
+    Node* arg = argument(i);
+    if (_gvn.type(arg)->isa_oopptr() != NULL &&
+        AllocateNode::Ideal_allocation(arg, &_gvn) != NULL) {
+      return true;
+    }
+  }
+  return false;
+}
+
 //------------------------------do_call----------------------------------------
 // Handle your basic call.  Inline if we can & want to, else just setup call.
 void Parse::do_call() {
@@ -555,6 +642,17 @@ void Parse::do_call() {
   // NOTE:  Don't use orig_callee and callee after this point!  Use cg->method() instead.
   orig_callee = callee = NULL;
 
+  // A cold call that is not inlined would make a fresh allocation escape
+  // on all paths. Trap instead, and let deoptimization materialize the
+  // object if the call is ever reached.
+  if (!cg->is_inline() && !cg->is_late_inline() && should_trap_cold_escape(nargs)) {
+    inc_sp(nargs);  // restore the arguments for re-execution of the invoke
+    uncommon_trap(Deoptimization::Reason_unstable_if,
+                  Deoptimization::Action_reinterpret,
+                  NULL, "cold escape");
+    return;
+  }
+
   // ---------------------
   // Round double arguments before call
   round_double_arguments(cg->method());
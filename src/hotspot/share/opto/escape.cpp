@@ -100,6 +100,12 @@ void ConnectionGraph::do_analysis(Compile *C, PhaseIterGVN *igvn) {
   Compile::TracePhase tp("escapeAnalysis", &Phase::timers[Phase::_t_escapeAnalysis]);
   ResourceMark rm;
 
+  // Split field loads through allocation merges before the graph is
+  // built so that the merged allocations stay scalar replaceable.
+  if (ReduceAllocationMerges && EliminateAllocations) {
+    reduce_allocation_merges(C, igvn);
+  }
+
   // Add ConP#NULL and ConN#NULL nodes before ConnectionGraph construction
   // to create space for them in ConnectionGraph::_nodes[].
   Node* oop_null = igvn->zerocon(T_OBJECT);
@@ -117,6 +123,123 @@ void ConnectionGraph::do_analysis(Compile *C, PhaseIterGVN *igvn) {
     igvn->hash_delete(noop_null);
 }
 
+// A Phi which merges fresh instance allocations, such as the result of
+// 'cond ? new A(x) : new A(y)', marks every merged object as not scalar
+// replaceable (see adjust_scalar_replaceable_state()). When the only uses of
+// the Phi are field loads, each load can instead be done on every incoming
+// path and the loaded values merged:
+//
+//   Load(AddP(Phi(R, a1, a2), off), MemPhi(R, m1, m2))
+//     ==> Phi(R, Load(AddP(a1, off), m1), Load(AddP(a2, off), m2))
+//
+// The allocation Phi then dies and a1, a2 are no longer merged.
+bool ConnectionGraph::is_reducible_allocation_merge(PhiNode* phi, PhaseIterGVN* igvn) {
+  Node* region = phi->in(0);
+  if (region == NULL || !region->is_Region() || region->is_Loop() ||
+      phi->type()->isa_instptr() == NULL || phi->outcnt() == 0) {
+    return false;
+  }
+  for (uint i = 1; i < phi->req(); i++) {
+    Node* in = phi->in(i);
+    if (in == NULL || !in->is_CheckCastPP() ||
+        region->in(i) == NULL || region->in(i)->is_top()) {
+      return false;
+    }
+    AllocateNode* alloc = AllocateNode::Ideal_allocation(in, igvn);
+    if (alloc == NULL || alloc->is_AllocateArray() || alloc->result_cast() != in) {
+      return false;
+    }
+  }
+  for (DUIterator_Fast imax, i = phi->fast_outs(imax); i < imax; i++) {
+    Node* addp = phi->fast_out(i);
+    if (!addp->is_AddP() || addp->in(AddPNode::Base) != phi ||
+        addp->in(AddPNode::Address) != phi ||
+        addp->in(AddPNode::Offset)->find_intptr_t_con(-1) < 0) {
+      return false;
+    }
+    for (DUIterator_Fast jmax, j = addp->fast_outs(jmax); j < jmax; j++) {
+      Node* use = addp->fast_out(j);
+      if (!use->is_Load() || use->in(MemNode::Address) != addp) {
+        return false;
+      }
+      Node* mem = use->in(MemNode::Memory);
+      if (!mem->is_Phi() || mem->in(0) != region) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+void ConnectionGraph::reduce_allocation_merge(PhiNode* phi, PhaseIterGVN* igvn) {
+  Node* region = phi->in(0);
+  Unique_Node_List addps;
+  Unique_Node_List loads;
+  for (DUIterator_Fast imax, i = phi->fast_outs(imax); i < imax; i++) {
+    Node* addp = phi->fast_out(i);
+    addps.push(addp);
+    for (DUIterator_Fast jmax, j = addp->fast_outs(jmax); j < jmax; j++) {
+      loads.push(addp->fast_out(j));
+    }
+  }
+#ifndef PRODUCT
+  if (TraceReduceAllocationMerges) {
+    tty->print_cr("--- Reduce allocation merge Phi %d (%d loads)", phi->_idx, loads.size());
+  }
+#endif
+  for (uint k = 0; k < loads.size(); k++) {
+    Node* load = loads.at(k);
+    Node* addp = load->in(MemNode::Address);
+    Node* mem  = load->in(MemNode::Memory);
+    PhiNode* value_phi = new PhiNode(region, load->bottom_type());
+    for (uint i = 1; i < phi->req(); i++) {
+      Node* base = phi->in(i);
+      Node* adr = igvn->transform(new AddPNode(base, base, addp->in(AddPNode::Offset)));
+      Node* ld = load->clone();
+      ld->set_req(MemNode::Control, region->in(i));
+      ld->set_req(MemNode::Memory, mem->in(i));
+      ld->set_req(MemNode::Address, adr);
+      value_phi->init_req(i, igvn->transform(ld));
+    }
+    igvn->replace_node(load, igvn->transform(value_phi));
+  }
+  // Remove the address computations, and with them the Phi, right away:
+  // the connection graph is built next and would still see the merge.
+  for (uint k = 0; k < addps.size(); k++) {
+    Node* addp = addps.at(k);
+    if (addp->outcnt() == 0) {
+      igvn->remove_dead_node(addp);
+    }
+  }
+}
+
+void ConnectionGraph::reduce_allocation_merges(Compile* C, PhaseIterGVN* igvn) {
+  Unique_Node_List merges;
+  for (int i = 0; i < C->macro_count(); i++) {
+    Node* n = C->macro_node(i);
+    if (!n->is_Allocate() || n->is_AllocateArray()) {
+      continue;
+    }
+    Node* res = n->as_Allocate()->result_cast();
+    if (res == NULL) {
+      continue;
+    }
+    for (DUIterator_Fast jmax, j = res->fast_outs(jmax); j < jmax; j++) {
+      Node* use = res->fast_out(j);
+      if (use->is_Phi() && is_reducible_allocation_merge(use->as_Phi(), igvn)) {
+        merges.push(use);
+      }
+    }
+  }
+  for (uint i = 0; i < merges.size(); i++) {
+    PhiNode* phi = merges.at(i)->as_Phi();
+    // An earlier reduction may have changed the shape of this merge.
+    if (is_reducible_allocation_merge(phi, igvn)) {
+      reduce_allocation_merge(phi, igvn);
+    }
+  }
+}
+
 bool ConnectionGraph::compute_escape() {
   Compile* C = _compile;
   PhaseGVN* igvn = _igvn;
@@ -608,6 +731,7 @@ void ConnectionGraph::add_node_to_connection_graph(Node *n, Unique_Node_List *de
     }
     case Op_AryEq:
     case Op_HasNegatives:
+    case Op_StrHashCode:
     case Op_StrComp:
     case Op_StrEquals:
     case Op_StrIndexOf:
@@ -830,6 +954,7 @@ void ConnectionGraph::add_final_edges(Node *n) {
     }
     case Op_AryEq:
     case Op_HasNegatives:
+    case Op_StrHashCode:
     case Op_StrComp:
     case Op_StrEquals:
     case Op_StrIndexOf:
@@ -3273,7 +3398,7 @@ void ConnectionGraph::split_unique_types(GrowableArray<Node *>  &alloc_worklist,
           memnode_worklist.append_if_missing(use);
         } else if (!(op == Op_CmpP || op == Op_Conv2B ||
               op == Op_CastP2X || op == Op_StoreCM ||
-              op == Op_FastLock || op == Op_AryEq || op == Op_StrComp || op == Op_HasNegatives ||
+              op == Op_FastLock || op == Op_AryEq || op == Op_StrComp || op == Op_HasNegatives || op == Op_StrHashCode ||
               op == Op_StrCompressedCopy || op == Op_StrInflatedCopy ||
               op == Op_StrEquals || op == Op_StrIndexOf || op == Op_StrIndexOfChar ||
               BarrierSet::barrier_set()->barrier_set_c2()->is_gc_barrier_node(use))) {
@@ -3399,7 +3524,7 @@ void ConnectionGraph::split_unique_types(GrowableArray<Node *>  &alloc_worklist,
           // They overwrite memory edge corresponding to destination array,
           memnode_worklist.append_if_missing(use);
         } else if (!(BarrierSet::barrier_set()->barrier_set_c2()->is_gc_barrier_node(use) ||
-              op == Op_AryEq || op == Op_StrComp || op == Op_HasNegatives ||
+              op == Op_AryEq || op == Op_StrComp || op == Op_HasNegatives || op == Op_StrHashCode ||
               op == Op_StrCompressedCopy || op == Op_StrInflatedCopy ||
               op == Op_StrEquals || op == Op_StrIndexOf || op == Op_StrIndexOfChar)) {
           n->dump();
@@ -582,6 +582,11 @@ private:
   // Compute the escape information
   bool compute_escape();
 
+  // Split field loads through Phis that merge fresh allocations
+  static bool is_reducible_allocation_merge(PhiNode* phi, PhaseIterGVN* igvn);
+  static void reduce_allocation_merge(PhiNode* phi, PhaseIterGVN* igvn);
+  static void reduce_allocation_merges(Compile* C, PhaseIterGVN* igvn);
+
 public:
   ConnectionGraph(Compile *C, PhaseIterGVN *igvn);
 
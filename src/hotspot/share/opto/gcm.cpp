@@ -589,6 +589,8 @@ Block* PhaseCFG::insert_anti_dependences(Block* LCA, Node* load, bool verify) {
          "Arrays equals is a 'load' that does not conflict with any stores");
   assert(load_alias_idx || (load->is_Mach() && load->as_Mach()->ideal_Opcode() == Op_HasNegatives),
          "HasNegatives is a 'load' that does not conflict with any stores");
+  assert(load_alias_idx || (load->is_Mach() && load->as_Mach()->ideal_Opcode() == Op_StrHashCode),
+         "String hashCode is a 'load' that does not conflict with any stores");
 
   if (!C->alias_type(load_alias_idx)->is_rewritable()) {
     // It is impossible to spoil this load by putting stores before it,
@@ -1008,6 +1010,37 @@ void PhaseCFG::compute_latencies_backwards(VectorSet &visited, Node_Stack &stack
   }
 } // end ComputeLatenciesBackwards
 
+//------------------------------load_use_latency-------------------------------
+// Extra latency between a load and its uses.  The pipeline description
+// of some ports is generic; the platform picks a value that matches the
+// L1 load-to-use latency of the CPU at startup.
+static uint load_use_latency(const Node* def) {
+  if (OptoLoadUseLatency == 0 || !def->is_Mach()) {
+    return 0;
+  }
+  switch (def->as_Mach()->ideal_Opcode()) {
+  case Op_LoadB:
+  case Op_LoadUB:
+  case Op_LoadS:
+  case Op_LoadUS:
+  case Op_LoadI:
+  case Op_LoadL:
+  case Op_LoadL_unaligned:
+  case Op_LoadF:
+  case Op_LoadD:
+  case Op_LoadD_unaligned:
+  case Op_LoadP:
+  case Op_LoadN:
+  case Op_LoadKlass:
+  case Op_LoadNKlass:
+  case Op_LoadRange:
+  case Op_LoadVector:
+    return (uint)OptoLoadUseLatency;
+  default:
+    return 0;
+  }
+}
+
 //------------------------------partial_latency_of_defs------------------------
 // Compute the latency impact of this node on all defs.  This computes
 // a number that increases as we approach the beginning of the routine.
@@ -1059,7 +1092,7 @@ void PhaseCFG::partial_latency_of_defs(Node *n) {
       continue;
     }
 
-    uint delta_latency = n->latency(j);
+    uint delta_latency = n->latency(j) + load_use_latency(def);
     uint current_latency = delta_latency + use_latency;
 
     if (get_latency_for_node(def) < current_latency) {
@@ -1108,7 +1141,7 @@ int PhaseCFG::latency_from_use(Node *n, const Node *def, Node *use) {
     for ( uint j=0; j<nlen; j++ ) {
       if (use->in(j) == n) {
         // Change this if we want local latencies
-        uint ul = use->latency(j);
+        uint ul = use->latency(j) + load_use_latency(n);
         uint  l = ul + nl;
         if (latency < l) latency = l;
 #ifndef PRODUCT
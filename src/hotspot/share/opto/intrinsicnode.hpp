@@ -164,6 +164,16 @@ class HasNegativesNode: public StrIntrinsicNode {
   virtual const Type* bottom_type() const { return TypeInt::BOOL; }
 };
 
+//------------------------------StrHashCode----------------------------------
+// Polynomial hash (h = 31 * h + b) of a Latin1 byte[]
+class StrHashCodeNode: public StrIntrinsicNode {
+ public:
+  StrHashCodeNode(Node* control, Node* char_array_mem, Node* s1, Node* c1):
+  StrIntrinsicNode(control, char_array_mem, s1, c1, LL) {};
+  virtual int Opcode() const;
+  virtual const Type* bottom_type() const { return TypeInt::INT; }
+};
+
 
 //------------------------------EncodeISOArray--------------------------------
 // encode char[] to byte[] in ISO_8859_1
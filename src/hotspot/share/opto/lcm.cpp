@@ -205,6 +205,7 @@ void PhaseCFG::implicit_null_check(Block* block, Node *proj, Node *val, int allo
     case Op_StrCompressedCopy:
     case Op_EncodeISOArray:
     case Op_HasNegatives:
+    case Op_StrHashCode:
       // Not a legit memory op for implicit null check regardless of
       // embedded loads
       continue;
@@ -52,6 +52,7 @@
 #include "opto/runtime.hpp"
 #include "opto/rootnode.hpp"
 #include "opto/subnode.hpp"
+#include "opto/vectornode.hpp"
 #include "prims/nativeLookup.hpp"
 #include "prims/unsafe.hpp"
 #include "runtime/objectMonitor.hpp"
@@ -219,6 +220,7 @@ class LibraryCallKit : public GraphKit {
                           RegionNode* region, Node* phi, StrIntrinsicNode::ArgEnc ae);
   bool inline_string_indexOfChar();
   bool inline_string_equals(StrIntrinsicNode::ArgEnc ae);
+  bool inline_string_hashCode();
   bool inline_string_toBytesU();
   bool inline_string_getCharsU();
   bool inline_string_copy(bool compress);
@@ -326,6 +328,7 @@ class LibraryCallKit : public GraphKit {
   bool inline_montgomeryMultiply();
   bool inline_montgomerySquare();
   bool inline_vectorizedMismatch();
+  bool inline_vector_binary_op();
   bool inline_fma(vmIntrinsics::ID id);
   bool inline_character_compare(vmIntrinsics::ID id);
 
@@ -586,6 +589,7 @@ bool LibraryCallKit::try_to_inline(int predicate) {
 
   case vmIntrinsics::_equalsL:                  return inline_string_equals(StrIntrinsicNode::LL);
   case vmIntrinsics::_equalsU:                  return inline_string_equals(StrIntrinsicNode::UU);
+  case vmIntrinsics::_hashCodeL:                return inline_string_hashCode();
 
   case vmIntrinsics::_toBytesStringU:           return inline_string_toBytesU();
   case vmIntrinsics::_getCharsStringU:          return inline_string_getCharsU();
@@ -843,6 +847,9 @@ bool LibraryCallKit::try_to_inline(int predicate) {
   case vmIntrinsics::_vectorizedMismatch:
     return inline_vectorizedMismatch();
 
+  case vmIntrinsics::_VectorBinaryOp:
+    return inline_vector_binary_op();
+
   case vmIntrinsics::_ghash_processBlocks:
     return inline_ghash_processBlocks();
   case vmIntrinsics::_base64_encodeBlock:
@@ -1185,6 +1192,26 @@ bool LibraryCallKit::inline_string_equals(StrIntrinsicNode::ArgEnc ae) {
   return true;
 }
 
+//------------------------------inline_string_hashCode----------------------------
+// int StringLatin1.hashCode(byte[] value)
+bool LibraryCallKit::inline_string_hashCode() {
+  Node* value = argument(0);
+
+  value = must_be_not_null(value, true);
+  if (stopped()) {
+    return true;
+  }
+
+  // The empty array is handled by the assembler code for StrHashCode.
+  Node* value_start = array_element_address(value, intcon(0), T_BYTE);
+  Node* value_cnt   = load_array_length(value);
+
+  Node* result = new StrHashCodeNode(control(), memory(TypeAryPtr::BYTES), value_start, value_cnt);
+  set_result(_gvn.transform(result));
+  clear_upper_avx();
+  return true;
+}
+
 //------------------------------inline_array_equals----------------------------
 bool LibraryCallKit::inline_array_equals(StrIntrinsicNode::ArgEnc ae) {
   assert(ae == StrIntrinsicNode::UU || ae == StrIntrinsicNode::LL, "unsupported array types");
@@ -5343,6 +5370,120 @@ bool LibraryCallKit::inline_vectorizedMismatch() {
   return true;
 }
 
+//-------------inline_vector_binary_op------------------------------
+// void jdk.internal.vm.vector.VectorSupport.binaryOp(int opr, Class<?> etype, int length,
+//                                                     Object a, long aOffset,
+//                                                     Object b, long bOffset,
+//                                                     Object r, long rOffset)
+//
+// Loads two vectors of 'length' elements of type 'etype' from the
+// Unsafe-style addresses (a, aOffset) and (b, bOffset), applies 'opr'
+// and stores the result at (r, rOffset).  The operation, element type
+// and length must be compile-time constants, and the platform must
+// support the resulting vector shape; otherwise we leave the call to
+// the scalar Java fallback.  The caller is responsible for bounds.
+bool LibraryCallKit::inline_vector_binary_op() {
+  assert(callee()->signature()->size() == 12, "binaryOp has 9 parameters");
+
+  const TypeInt*     opr    = gvn().type(argument(0))->isa_int();
+  const TypeInstPtr* etype  = gvn().type(argument(1))->isa_instptr();
+  const TypeInt*     vlen   = gvn().type(argument(2))->isa_int();
+
+  if (opr == NULL || !opr->is_con() ||
+      vlen == NULL || !vlen->is_con() ||
+      etype == NULL || etype->const_oop() == NULL) {
+    return false; // not enough info for intrinsification
+  }
+  ciType* elem_type = etype->java_mirror_type();
+  if (elem_type == NULL || !elem_type->is_primitive_type()) {
+    return false;
+  }
+  BasicType elem_bt = elem_type->basic_type();
+  int num_elem = vlen->get_con();
+
+  int sopc = 0;
+  switch (opr->get_con()) {
+  case 0: // VECTOR_OP_ADD
+    switch (elem_bt) {
+    case T_BYTE: case T_SHORT: case T_INT: sopc = Op_AddI; break;
+    case T_LONG:   sopc = Op_AddL; break;
+    case T_FLOAT:  sopc = Op_AddF; break;
+    case T_DOUBLE: sopc = Op_AddD; break;
+    default: break;
+    }
+    break;
+  case 1: // VECTOR_OP_SUB
+    switch (elem_bt) {
+    case T_BYTE: case T_SHORT: case T_INT: sopc = Op_SubI; break;
+    case T_LONG:   sopc = Op_SubL; break;
+    case T_FLOAT:  sopc = Op_SubF; break;
+    case T_DOUBLE: sopc = Op_SubD; break;
+    default: break;
+    }
+    break;
+  case 2: // VECTOR_OP_MUL
+    switch (elem_bt) {
+    case T_BYTE: case T_SHORT: case T_INT: sopc = Op_MulI; break;
+    case T_LONG:   sopc = Op_MulL; break;
+    case T_FLOAT:  sopc = Op_MulF; break;
+    case T_DOUBLE: sopc = Op_MulD; break;
+    default: break;
+    }
+    break;
+  case 3: // VECTOR_OP_AND
+  case 4: // VECTOR_OP_OR
+  case 5: // VECTOR_OP_XOR
+    if (is_subword_type(elem_bt) || elem_bt == T_INT) {
+      sopc = opr->get_con() == 3 ? Op_AndI : (opr->get_con() == 4 ? Op_OrI : Op_XorI);
+    } else if (elem_bt == T_LONG) {
+      sopc = opr->get_con() == 3 ? Op_AndL : (opr->get_con() == 4 ? Op_OrL : Op_XorL);
+    }
+    break;
+  default:
+    break;
+  }
+  if (sopc == 0 || elem_bt == T_BOOLEAN || elem_bt == T_CHAR) {
+    return false; // unsupported operation or element type
+  }
+  if (!VectorNode::implemented(sopc, num_elem, elem_bt) ||
+      !Matcher::match_rule_supported_vector(Op_LoadVector, num_elem) ||
+      !Matcher::match_rule_supported_vector(Op_StoreVector, num_elem)) {
+    return false; // shape not supported on this platform
+  }
+
+  Node* a_base = argument(3);
+  Node* b_base = argument(6);
+  Node* r_base = argument(9);
+  Node* a_adr = make_unsafe_address(a_base, ConvL2X(argument(4)), elem_bt);
+  Node* b_adr = make_unsafe_address(b_base, ConvL2X(argument(7)), elem_bt);
+  Node* r_adr = make_unsafe_address(r_base, ConvL2X(argument(10)), elem_bt);
+  if (stopped()) {
+    return true;
+  }
+
+  const TypePtr* a_type = _gvn.type(a_adr)->isa_ptr();
+  const TypePtr* b_type = _gvn.type(b_adr)->isa_ptr();
+  const TypePtr* r_type = _gvn.type(r_adr)->isa_ptr();
+  if (a_type == TypePtr::NULL_PTR || b_type == TypePtr::NULL_PTR || r_type == TypePtr::NULL_PTR) {
+    return false; // off-heap access with zero address
+  }
+
+  C->set_has_unsafe_access(true);  // Mark eventual nmethod as "unsafe".
+
+  // The vector accesses may overlap with any other memory slice, so
+  // fence them off in the same way as mismatched Unsafe accesses.
+  insert_mem_bar(Op_MemBarCPUOrder);
+
+  Node* va = _gvn.transform(LoadVectorNode::make(0, control(), memory(a_type), a_adr, a_type, num_elem, elem_bt));
+  Node* vb = _gvn.transform(LoadVectorNode::make(0, control(), memory(b_type), b_adr, b_type, num_elem, elem_bt));
+  Node* vr = _gvn.transform(VectorNode::make(sopc, va, vb, num_elem, elem_bt));
+  Node* st = _gvn.transform(StoreVectorNode::make(0, control(), memory(r_type), r_adr, r_type, vr, num_elem));
+  set_memory(st, r_type);
+
+  insert_mem_bar(Op_MemBarCPUOrder);
+  return true;
+}
+
 /**
  * Calculate CRC32 for byte.
  * int java.util.zip.CRC32.update(int crc, int b)
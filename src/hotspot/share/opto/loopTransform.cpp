@@ -699,7 +699,8 @@ bool IdealLoopTree::policy_maximally_unroll( PhaseIdealLoop *phase ) const {
       case Op_StrIndexOfChar:
       case Op_EncodeISOArray:
       case Op_AryEq:
-      case Op_HasNegatives: {
+      case Op_HasNegatives:
+      case Op_StrHashCode: {
         return false;
       }
 #if INCLUDE_RTM_OPT
@@ -808,11 +809,23 @@ bool IdealLoopTree::policy_unroll(PhaseIdealLoop *phase) {
   uint body_size = _body.size();
   // Key test to unroll loop in CRC32 java code
   int xors_in_loop = 0;
+  // Monitor regions on a loop invariant object. Once the loop is
+  // unrolled, the unlock of one copy of the body directly precedes the
+  // lock of the next copy and lock coarsening merges the two regions.
+  int invariant_locks = 0;
   // Also count ModL, DivL and MulL which expand mightly
   for (uint k = 0; k < _body.size(); k++) {
     Node* n = _body.at(k);
     switch (n->Opcode()) {
       case Op_XorI: xors_in_loop++; break; // CRC32 java code
+      case Op_Lock: {
+        AbstractLockNode* lock = n->as_AbstractLock();
+        if (EliminateLocks && !lock->is_eliminated() &&
+            !is_member(phase->get_loop(phase->get_ctrl(lock->obj_node())))) {
+          invariant_locks++;
+        }
+        break;
+      }
       case Op_ModL: body_size += 30; break;
       case Op_DivL: body_size += 30; break;
       case Op_MulL: body_size += 10; break;
@@ -822,7 +835,8 @@ bool IdealLoopTree::policy_unroll(PhaseIdealLoop *phase) {
       case Op_StrIndexOfChar:
       case Op_EncodeISOArray:
       case Op_AryEq:
-      case Op_HasNegatives: {
+      case Op_HasNegatives:
+      case Op_StrHashCode: {
         // Do not unroll a loop with String intrinsics code.
         // String intrinsics are large and have loops.
         return false;
@@ -839,6 +853,20 @@ bool IdealLoopTree::policy_unroll(PhaseIdealLoop *phase) {
     } // switch
   }
 
+  // Unrolling a loop with a monitor region on an invariant object
+  // coarsens the region over the unrolled iterations. Bound the number
+  // of iterations that execute under one lock so that other threads
+  // contending for the monitor are not starved, and only allow the
+  // larger body for loops the profile says are hot.
+  bool coarsen_locks = false;
+  if (invariant_locks > 0 && LoopLockCoarseningLimit > 0) {
+    if (future_unroll_ct > LoopLockCoarseningLimit) {
+      return false;
+    }
+    coarsen_locks = cl->profile_trip_cnt() != COUNT_UNKNOWN &&
+                    cl->profile_trip_cnt() >= (float)future_unroll_ct;
+  }
+
   if (UseSuperWord) {
     if (!cl->is_reduction_loop()) {
       phase->mark_reductions(this);
@@ -866,7 +894,8 @@ bool IdealLoopTree::policy_unroll(PhaseIdealLoop *phase) {
 
   // Check for being too big
   if (body_size > (uint)_local_loop_unroll_limit) {
-    if ((cl->is_subword_loop() || xors_in_loop >= 4) && body_size < (uint)LoopUnrollLimit * 4) {
+    if ((cl->is_subword_loop() || xors_in_loop >= 4 || coarsen_locks) &&
+        body_size < (uint)LoopUnrollLimit * 4) {
       return true;
     }
     // Normal case: loop too big
@@ -2828,6 +2857,146 @@ void PhaseIdealLoop::poison_rce_post_loop(IdealLoopTree *rce_loop) {
   }
 }
 
+//------------------------------move_reductions_out_of_loop--------------------
+// SuperWord turns "sum += a[i]" into a chain of reductions, each folding a
+// vector into the scalar loop-carried sum. For associative operations the
+// loop can instead carry a vector of partial sums, starting from the
+// identity, and do a single reduction on exit:
+//
+//   phi = Phi(init, r2)                 vphi = Phi(identity, v2)
+//   r1  = AddReductionVI(phi, vec1)     v1   = AddVI(vphi, vec1)
+//   r2  = AddReductionVI(r1, vec2)      v2   = AddVI(v1, vec2)
+//                                       (after loop) AddReductionVI(init, v2)
+//
+// Floating point reductions have to keep their strict order and stay.
+static int reduction_scalar_opcode(int opc) {
+  switch (opc) {
+  case Op_AddReductionVI: return Op_AddI;
+  case Op_AddReductionVL: return Op_AddL;
+  case Op_MulReductionVI: return Op_MulI;
+  case Op_MulReductionVL: return Op_MulL;
+  default:                return 0;
+  }
+}
+
+void PhaseIdealLoop::move_reductions_out_of_loop(IdealLoopTree *loop) {
+  assert(loop->is_counted() && loop->_child == NULL, "only innermost counted loops");
+  CountedLoopNode *cl = loop->_head->as_CountedLoop();
+  if (!cl->is_main_loop() || !cl->is_vectorized_loop() || !cl->is_reduction_loop()) {
+    return;
+  }
+
+  for (DUIterator_Fast jmax, j = cl->fast_outs(jmax); j < jmax; j++) {
+    Node* phi = cl->fast_out(j);
+    // A scalar phi with a single use, and a vector reduction on the backedge
+    if (!phi->is_Phi() || phi->outcnt() != 1 || phi->in(LoopNode::LoopBackControl) == NULL) {
+      continue;
+    }
+    Node* last = phi->in(LoopNode::LoopBackControl);
+    int sopc = reduction_scalar_opcode(last->Opcode());
+    if (sopc == 0) {
+      continue;
+    }
+    const TypeVect* vt = last->in(2)->bottom_type()->is_vect();
+    BasicType bt = vt->element_basic_type();
+    uint vlen = vt->length();
+    if (!VectorNode::implemented(sopc, vlen, bt) || TypeVect::make(bt, vlen) != vt) {
+      continue;
+    }
+
+    // Walk the chain up to the phi. Every reduction in the chain folds in a
+    // vector computed in the loop; all but the last have a single use, and
+    // the last is only used by the phi inside the loop.
+    Node* first = NULL;
+    Node* cur = last;
+    while (true) {
+      if (cur->in(0) != NULL || get_ctrl(cur->in(2)) != cl ||
+          cur->in(2)->bottom_type() != vt) {
+        break;
+      }
+      if (cur == last) {
+        bool in_loop_use = false;
+        for (DUIterator_Fast kmax, k = cur->fast_outs(kmax); k < kmax; k++) {
+          Node* use = cur->fast_out(k);
+          if (use != phi && loop->is_member(get_loop(ctrl_or_self(use)))) {
+            in_loop_use = true;
+            break;
+          }
+        }
+        if (in_loop_use) {
+          break;
+        }
+      } else if (cur->outcnt() != 1) {
+        break;
+      }
+      Node* scalar = cur->in(1);
+      if (scalar == phi) {
+        first = cur;
+        break;
+      }
+      if (scalar->Opcode() != last->Opcode()) {
+        break;
+      }
+      cur = scalar;
+    }
+    if (first == NULL) {
+      continue;
+    }
+
+    // Turn the scalar phi into a vector phi, starting from the identity.
+    Node* identity = NULL;
+    if (bt == T_INT) {
+      identity = _igvn.intcon(sopc == Op_MulI ? 1 : 0);
+    } else {
+      identity = _igvn.longcon(sopc == Op_MulL ? 1 : 0);
+    }
+    set_ctrl(identity, C->root());
+    Node* identity_vec = VectorNode::scalar2vector(identity, vlen, Type::get_const_basic_type(bt));
+    register_new_node(identity_vec, C->root());
+
+    Node* init = phi->in(LoopNode::EntryControl);
+    _igvn.rehash_node_delayed(phi);
+    phi->set_req_X(LoopNode::EntryControl, identity_vec, &_igvn);
+    phi->as_Type()->set_type(vt);
+    _igvn.set_type(phi, vt);
+
+    // Replace the reductions with vector operations, top down.
+    cur = first;
+    while (true) {
+      Node* acc = VectorNode::make(sopc, cur->in(1), cur->in(2), vlen, bt);
+      register_new_node(acc, cl);
+      bool done = (cur == last);
+      Node* next = done ? NULL : cur->unique_out();
+      _igvn.replace_node(cur, acc);
+      if (done) {
+        break;
+      }
+      cur = next;
+    }
+
+    // Reduce once after the loop, and take over the uses outside the loop.
+    Node* acc = phi->in(LoopNode::LoopBackControl);
+    Node* red = ReductionNode::make(sopc, NULL, init, acc, bt);
+    for (DUIterator i = acc->outs(); acc->has_out(i); i++) {
+      Node* use = acc->out(i);
+      if (use != phi && use != red) {
+        _igvn.rehash_node_delayed(use);
+        use->replace_edge(acc, red);
+        --i;
+      }
+    }
+    register_new_node(red, get_late_ctrl(red, cl));
+    assert(phi->outcnt() == 1, "vector accumulator is the only use of phi");
+
+#ifndef PRODUCT
+    if (TraceLoopOpts) {
+      tty->print("ReductionOutOfLoop ");
+      loop->dump_head();
+    }
+#endif
+  }
+}
+
 //------------------------------DCE_loop_body----------------------------------
 // Remove simplistic dead code from loop body
 void IdealLoopTree::DCE_loop_body() {
@@ -3162,6 +3331,10 @@ bool IdealLoopTree::iteration_split_impl( PhaseIdealLoop *phase, Node_List &old_
       phase->do_maximally_unroll(this,old_new);
       return true;
     }
+    if (policy_alias_versioning(phase)) {
+      phase->do_alias_versioning(this, old_new);
+      return true;
+    }
   }
 
   // Skip next optimizations if running low on nodes. Note that
@@ -3654,32 +3827,9 @@ bool PhaseIdealLoop::intrinsify_fill(IdealLoopTree* lpt) {
   result_mem = new ProjNode(call,TypeFunc::Memory);
   _igvn.register_new_node_with_optimizer(result_mem);
 
-/* Disable following optimization until proper fix (add missing checks).
-
-  // If this fill is tightly coupled to an allocation and overwrites
-  // the whole body, allow it to take over the zeroing.
-  AllocateNode* alloc = AllocateNode::Ideal_allocation(base, this);
-  if (alloc != NULL && alloc->is_AllocateArray()) {
-    Node* length = alloc->as_AllocateArray()->Ideal_length();
-    if (head->limit() == length &&
-        head->init_trip() == _igvn.intcon(0)) {
-      if (TraceOptimizeFill) {
-        tty->print_cr("Eliminated zeroing in allocation");
-      }
-      alloc->maybe_set_complete(&_igvn);
-    } else {
-#ifdef ASSERT
-      if (TraceOptimizeFill) {
-        tty->print_cr("filling array but bounds don't match");
-        alloc->dump();
-        head->init_trip()->dump();
-        head->limit()->dump();
-        length->dump();
-      }
-#endif
-    }
-  }
-*/
+  // If this fill is tightly coupled to an allocation and overwrites the
+  // whole body, do_eliminate_fill_zeroing() has already taken over the
+  // zeroing.
 
   if (head->is_strip_mined()) {
     // Inner strip mined loop goes away so get rid of outer strip
@@ -3709,3 +3859,194 @@ bool PhaseIdealLoop::intrinsify_fill(IdealLoopTree* lpt) {
 
   return true;
 }
+
+//=============================================================================
+// Process all the loops in the loop tree and find primitive arrays that are
+// filled completely by a counted loop right after their allocation.
+void PhaseIdealLoop::do_eliminate_fill_zeroing() {
+  for (LoopTreeIterator iter(_ltree_root); !iter.done(); iter.next()) {
+    IdealLoopTree* lpt = iter.current();
+    if (!lpt->is_counted() || !lpt->is_inner()) {
+      continue;
+    }
+    for (uint i = 0; i < lpt->_body.size(); i++) {
+      Node* n = lpt->_body.at(i);
+      if (n->is_Store() && n->outcnt() > 0) {
+        eliminate_fill_zeroing(lpt, n);
+      }
+    }
+  }
+}
+
+// Return true if 'store' writes element 'phi' of the array it is based on,
+// for an array whose elements are 'elem_bt'.
+static bool is_store_to_indexed_element(Node* store, Node* phi, BasicType elem_bt) {
+  Node* elements[4];
+  int count = store->in(MemNode::Address)->as_AddP()->unpack_offsets(elements, ARRAY_SIZE(elements));
+  if (count < 1) {
+    return false;
+  }
+  int elem_size = type2aelembytes(elem_bt);
+  bool found_con = false;
+  bool found_index = false;
+  for (int e = 0; e < count; e++) {
+    Node* n = elements[e];
+    if (n->is_Con() && !found_con) {
+      const TypeX* t = n->find_intptr_t_type();
+      if (t == NULL || !t->is_con() || t->get_con() != arrayOopDesc::base_offset_in_bytes(elem_bt)) {
+        return false;
+      }
+      found_con = true;
+      continue;
+    }
+    if (found_index) {
+      return false;
+    }
+    if (n->Opcode() == Op_LShiftX) {
+      if (!n->in(2)->is_Con() || (1 << n->in(2)->get_int()) != elem_size) {
+        return false;
+      }
+      n = n->in(1);
+    } else if (elem_size != 1) {
+      return false;
+    }
+#ifdef _LP64
+    if (n->Opcode() == Op_ConvI2L) {
+      n = n->in(1);
+    }
+#endif
+    if (n->Opcode() == Op_CastII && n->as_CastII()->has_range_check()) {
+      n = n->in(1);
+    }
+    if (n != phi) {
+      return false;
+    }
+    found_index = true;
+  }
+  return found_con && found_index;
+}
+
+// Check that a store in counted loop 'lpt' writes every element of a newly
+// allocated primitive array, and that nothing can observe the array contents
+// before the loop is done.  If so, the allocation does not need to zero the
+// array body.  Deoptimization inside or before the loop resumes the loop in
+// the interpreter which then stores the remaining elements; only an
+// exception handler could see the unfilled elements, so frames with
+// handlers are not allowed to hold the array.
+bool PhaseIdealLoop::eliminate_fill_zeroing(IdealLoopTree* lpt, Node* store) {
+  CountedLoopNode* head = lpt->_head->as_CountedLoop();
+  if (!head->is_valid_counted_loop() || !head->is_normal_loop() ||
+      head->stride_con() != 1 || head->init_trip()->find_int_con(-1) != 0 ||
+      head->loopexit()->test_trip() != BoolTest::lt) {
+    return false;
+  }
+  Node* exit = head->loopexit()->proj_out_or_null(0);
+  if (exit == NULL) {
+    return false;
+  }
+
+  MemNode* mem = store->as_Mem();
+  if (mem->is_mismatched_access() || mem->is_unaligned_access() ||
+      !mem->in(MemNode::Address)->is_AddP()) {
+    return false;
+  }
+  Node* base = mem->in(MemNode::Address)->in(AddPNode::Base);
+  AllocateArrayNode* alloc = AllocateArrayNode::Ideal_array_allocation(base, &_igvn);
+  if (alloc == NULL) {
+    return false;
+  }
+  InitializeNode* init = alloc->initialization();
+  Node* ary = alloc->result_cast();
+  if (init == NULL || init->is_complete() || ary == NULL) {
+    return false;
+  }
+  const TypeAryPtr* ary_type = _igvn.type(ary)->isa_aryptr();
+  if (ary_type == NULL) {
+    return false;
+  }
+  BasicType elem_bt = ary_type->elem()->array_element_basic_type();
+  if (!is_java_primitive(elem_bt) ||
+      mem->memory_size() != type2aelembytes(elem_bt)) {
+    return false;
+  }
+
+  // The loop runs from 0 to the array length
+  Node* limit = head->limit();
+  Node* length = alloc->Ideal_length();
+  bool is_length = (limit == length) ||
+    (limit->Opcode() == Op_CastII && limit->in(1) == length) ||
+    (limit->Opcode() == Op_LoadRange &&
+     AllocateNode::Ideal_allocation(limit->in(MemNode::Address)->in(AddPNode::Base), &_igvn) == alloc);
+  if (!is_length) {
+    return false;
+  }
+
+  // The store happens on every iteration, at index phi
+  if (!is_dominator(get_ctrl(store), head->loopexit()) ||
+      !is_store_to_indexed_element(store, head->phi(), elem_bt)) {
+    return false;
+  }
+
+  // Nothing else may touch the array before the loop exits
+  Unique_Node_List wq;
+  wq.push(ary);
+  for (uint next = 0; next < wq.size(); next++) {
+    Node* n = wq.at(next);
+    for (DUIterator_Fast imax, i = n->fast_outs(imax); i < imax; i++) {
+      Node* use = n->fast_out(i);
+      if (use == store && n == store->in(MemNode::Address)) {
+        continue;
+      }
+      if (use->is_AddP() || use->is_ConstraintCast() || use->Opcode() == Op_EncodeP) {
+        wq.push(use);
+        continue;
+      }
+      int op = use->Opcode();
+      if (op == Op_LoadRange || op == Op_LoadKlass || op == Op_LoadNKlass) {
+        continue;               // header only
+      }
+      if (use->is_SafePoint() && use->as_SafePoint()->jvms() != NULL) {
+        // If this frame deoptimizes here, the interpreter reads the array
+        // from the debug info. Before the loop that would expose elements
+        // that were never zeroed, so only safepoints in the loop body or
+        // after the exit qualify. In the body, compiled paths that read the
+        // array are rejected below, but an uncommon trap resumes in code C2
+        // never saw, which may read elements the loop has not reached yet.
+        bool in_body = lpt->is_member(get_loop(use));
+        bool is_trap = use->is_CallStaticJava() &&
+                       use->as_CallStaticJava()->uncommon_trap_request() != 0;
+        bool debug_only = (in_body && !is_trap) || is_dominator(exit, use);
+        JVMState* jvms = use->as_SafePoint()->jvms();
+        for (uint j = 0; j < jvms->debug_start() && debug_only; j++) {
+          debug_only = (use->in(j) != n);
+        }
+        for (; debug_only && jvms != NULL; jvms = jvms->caller()) {
+          debug_only = !jvms->has_method() || !jvms->method()->has_exception_handlers();
+        }
+        if (debug_only) {
+          continue;
+        }
+      }
+      Node* ctrl = use->is_CFG() ? use : (has_ctrl(use) ? get_ctrl(use) : use->in(0));
+      if (ctrl == NULL || !is_dominator(exit, ctrl)) {
+        return false;
+      }
+    }
+  }
+
+  if (!alloc->maybe_set_complete(&_igvn)) {
+    return false;
+  }
+  init->set_complete_with_fill();
+
+#ifndef PRODUCT
+  if (TraceLoopOpts) {
+    tty->print("FillZeroing  ");
+    lpt->dump_head();
+  }
+#endif
+  if (C->log() != NULL) {
+    C->log()->elem("fill_zeroing_eliminated alloc='%d' loop='%d'", alloc->_idx, head->_idx);
+  }
+  return true;
+}
@@ -24,11 +24,16 @@
 
 #include "precompiled.hpp"
 #include "memory/allocation.inline.hpp"
+#include "opto/addnode.hpp"
 #include "opto/connode.hpp"
 #include "opto/convertnode.hpp"
 #include "opto/loopnode.hpp"
+#include "opto/memnode.hpp"
+#include "opto/movenode.hpp"
+#include "opto/mulnode.hpp"
 #include "opto/opaquenode.hpp"
 #include "opto/rootnode.hpp"
+#include "opto/subnode.hpp"
 
 //================= Loop Unswitching =====================
 //
@@ -50,6 +55,25 @@
 //                               endif
 //
 // Note: the "else" clause may be empty
+//
+// When the candidate test and other invariant tests in the loop are
+// strongly biased, they are hoisted together: the fast loop has every
+// test hardwired to its likely direction and the slow loop keeps all of
+// them. This clones the loop once instead of once per test.
+//
+// orig:                       transformed:
+//                               if (test1 && !test2) then
+//  loop                           loop
+//    if (test1) [likely]            stmt1
+//      stmt1                        stmt4
+//    if (test2) [unlikely]        endloop
+//      stmt3                    else
+//    stmt4                        loop [clone]
+//  endloop                          if (test1) stmt1
+//                                   if (test2) stmt3
+//                                   stmt4
+//                                 endloop
+//                               endif
 
 //------------------------------policy_unswitching-----------------------------
 // Return TRUE or FALSE if the loop should be unswitched
@@ -108,6 +132,46 @@ IfNode* PhaseIdealLoop::find_unswitching_candidate(const IdealLoopTree *loop) co
   return unswitch_iff;
 }
 
+//------------------------------is_biased_unswitching_test---------------------
+// Return TRUE if the invariant test is taken in the same direction often
+// enough that hardwiring it in the fast loop pays for the slow loop.
+static bool is_biased_unswitching_test(IfNode* iff) {
+  if (iff->Opcode() != Op_If) {
+    return false;
+  }
+  if (iff->_prob > PROB_UNLIKELY_MAG(2) && iff->_prob < PROB_LIKELY_MAG(2)) {
+    return false;
+  }
+  // The hoisted test materializes each condition with a CMoveI, so
+  // only use compares all platforms can match a CMoveI with.
+  int cmp_op = iff->in(1)->in(1)->Opcode();
+  return cmp_op == Op_CmpI || cmp_op == Op_CmpU || cmp_op == Op_CmpP || cmp_op == Op_CmpN;
+}
+
+//------------------------------find_unswitching_companions--------------------
+// Find other strongly biased invariant tests that can be hoisted
+// together with the unswitching candidate.
+void PhaseIdealLoop::find_unswitching_companions(const IdealLoopTree *loop, IfNode* unswitch_iff,
+                                                  Node_List &companions) const {
+  if (LoopUnswitchingMaxConditions <= 1 || !is_biased_unswitching_test(unswitch_iff)) {
+    return;
+  }
+  LoopNode *head = loop->_head->as_Loop();
+  Node* n = head->in(LoopNode::LoopBackControl);
+  while (n != head && companions.size() + 1 < (uint)LoopUnswitchingMaxConditions) {
+    Node* n_dom = idom(n);
+    if (n->is_Region() && n_dom->is_If() && n_dom != unswitch_iff) {
+      IfNode* iff = n_dom->as_If();
+      if (iff->in(1)->is_Bool() && iff->in(1)->in(1)->is_Cmp() &&
+          loop->is_invariant(iff->in(1)) && !loop->is_loop_exit(iff) &&
+          is_biased_unswitching_test(iff)) {
+        companions.push(iff);
+      }
+    }
+    n = n_dom;
+  }
+}
+
 //------------------------------do_unswitching-----------------------------
 // Clone loop with an invariant test (that does not exit) and
 // insert a clone of the test that selects which version to
@@ -131,13 +195,25 @@ void PhaseIdealLoop::do_unswitching (IdealLoopTree *loop, Node_List &old_new) {
   IfNode* unswitch_iff = find_unswitching_candidate((const IdealLoopTree *)loop);
   assert(unswitch_iff != NULL, "should be at least one");
 
+  Node_List companions;
+  find_unswitching_companions(loop, unswitch_iff, companions);
+
 #ifndef PRODUCT
   if (TraceLoopOpts) {
     tty->print("Unswitch   %d ", head->unswitch_count()+1);
+    if (companions.size() > 0) {
+      tty->print("on %d tests ", companions.size() + 1);
+    }
     loop->dump_head();
   }
 #endif
 
+  if (companions.size() > 0) {
+    companions.push(unswitch_iff);
+    do_multi_unswitching(loop, old_new, companions);
+    return;
+  }
+
   // Need to revert back to normal loop
   if (head->is_CountedLoop() && !head->as_CountedLoop()->is_normal_loop()) {
     head->as_CountedLoop()->set_normal_loop();
@@ -242,6 +318,289 @@ void PhaseIdealLoop::do_unswitching (IdealLoopTree *loop, Node_List &old_new) {
   C->set_major_progress();
 }
 
+//------------------------------do_multi_unswitching--------------------------
+// Clone loop and select the fast version, in which all tests in
+// unswitch_iffs take their likely direction, with a single hoisted
+// test. The slow version keeps the tests.
+void PhaseIdealLoop::do_multi_unswitching(IdealLoopTree *loop, Node_List &old_new, Node_List &unswitch_iffs) {
+  LoopNode *head = loop->_head->as_Loop();
+
+  // Need to revert back to normal loop
+  if (head->is_CountedLoop() && !head->as_CountedLoop()->is_normal_loop()) {
+    head->as_CountedLoop()->set_normal_loop();
+  }
+
+  ProjNode* proj_true = create_slow_version_of_loop(loop, old_new, Op_If, CloneIncludesStripMined);
+  assert(proj_true->is_IfTrue(), "must be true projection");
+
+  // The slow loop runs rarely; don't unswitch it any further.
+  LoopNode* head_clone = old_new[head->_idx]->as_Loop();
+  head->set_unswitch_count(head->unswitch_count() + 1);
+  head_clone->set_unswitch_count(head_clone->unswitch_max());
+
+  // Combine the likely directions of all tests into the new "if"
+  // outside of the loop
+  IfNode* invar_iff = proj_true->in(0)->as_If();
+  Node* invar_iff_c = invar_iff->in(0);
+  Node_List bols;
+  float prob = 1.0f;
+  for (uint i = 0; i < unswitch_iffs.size(); i++) {
+    IfNode* iff = unswitch_iffs.at(i)->as_If();
+    BoolNode* bol = iff->in(1)->as_Bool();
+    if (iff->_prob < PROB_FAIR) {
+      bol = new BoolNode(bol->in(1), bol->_test.negate());
+      register_new_node(bol, invar_iff_c);
+      prob *= 1.0f - iff->_prob;
+    } else {
+      prob *= iff->_prob;
+    }
+    bols.push(bol);
+  }
+  invar_iff->set_req(1, and_invariant_tests(bols, invar_iff_c));
+  invar_iff->_prob = MAX2(prob, PROB_MIN);
+
+  for (uint i = 0; i < unswitch_iffs.size(); i++) {
+    IfNode* iff = unswitch_iffs.at(i)->as_If();
+    bool likely = iff->_prob >= PROB_FAIR;
+
+    // Hoist invariant casts on the likely path out of the fast loop
+    ProjNode* proj = iff->proj_out(likely);
+    Node_List worklist;
+    for (DUIterator_Fast jmax, j = proj->fast_outs(jmax); j < jmax; j++) {
+      Node* use = proj->fast_out(j);
+      if (use->Opcode() == Op_CheckCastPP && loop->is_invariant(use->in(1))) {
+        worklist.push(use);
+      }
+    }
+    while (worklist.size() > 0) {
+      Node* use = worklist.pop();
+      Node* nuse = use->clone();
+      nuse->set_req(0, proj_true);
+      _igvn.replace_input_of(use, 1, nuse);
+      register_new_node(nuse, proj_true);
+    }
+
+    // Hardwire the test in the fast loop to its likely direction
+    _igvn.rehash_node_delayed(iff);
+    dominated_by(proj_true, iff, !likely, false);
+  }
+
+  // Reoptimize loops
+  loop->record_for_igvn();
+  for(int i = loop->_body.size() - 1; i >= 0 ; i--) {
+    Node *n = loop->_body[i];
+    Node *n_clone = old_new[n->_idx];
+    _igvn._worklist.push(n_clone);
+  }
+
+#ifndef PRODUCT
+  if (TraceLoopUnswitching) {
+    tty->print_cr("Loop unswitching orig: %d on %d tests  new: %d",
+                  head->_idx, unswitch_iffs.size(), head_clone->_idx);
+  }
+#endif
+
+  C->set_major_progress();
+}
+
+//------------------------------and_invariant_tests---------------------------
+// Return a test that holds when all tests in bols hold. The tests are
+// loop invariant and are evaluated at ctrl.
+BoolNode* PhaseIdealLoop::and_invariant_tests(Node_List &bols, Node* ctrl) {
+  assert(bols.size() > 0, "no tests");
+  if (bols.size() == 1) {
+    return bols.at(0)->as_Bool();
+  }
+  Node* zero = _igvn.intcon(0);
+  set_ctrl(zero, C->root());
+  Node* one = _igvn.intcon(1);
+  set_ctrl(one, C->root());
+  Node* all = NULL;
+  for (uint i = 0; i < bols.size(); i++) {
+    Node* val = CMoveNode::make(NULL, bols.at(i), zero, one, TypeInt::BOOL);
+    register_new_node(val, ctrl);
+    if (all == NULL) {
+      all = val;
+    } else {
+      all = new AndINode(all, val);
+      register_new_node(all, ctrl);
+    }
+  }
+  Node* cmp = new CmpINode(all, zero);
+  register_new_node(cmp, ctrl);
+  BoolNode* bol = new BoolNode(cmp, BoolTest::ne);
+  register_new_node(bol, ctrl);
+  return bol;
+}
+
+//=============== Loop Versioning for Aliasing ==================
+//
+// A loop that stores through one array and accesses another array of
+// the same type cannot be vectorized, because SuperWord has to assume
+// that the two arrays are the same object. Java arrays never partially
+// overlap, so comparing the invariant bases is a complete runtime
+// overlap check:
+//
+// orig:                       transformed:
+//  loop                         if (a != b) then
+//    b[i] = a[i] + 1              loop [a, b disjoint]
+//  endloop                          b[i] = a[i] + 1
+//                                 endloop
+//                               else
+//                                 loop [clone]
+//                                   b[i] = a[i] + 1
+//                                 endloop
+//                               endif
+//
+// SuperWord then drops the dependences between the disjoint bases in
+// the fast loop.
+
+//------------------------------alias_versioning_base-------------------------
+// Return the invariant array base of memory access n, or NULL.
+static Node* alias_versioning_base(const IdealLoopTree *loop, Node* n) {
+  if (!n->is_Load() && !n->is_Store()) {
+    return NULL;
+  }
+  MemNode* mem = n->as_Mem();
+  if (mem->adr_type() == NULL || mem->adr_type()->isa_aryptr() == NULL || mem->is_mismatched_access()) {
+    return NULL;
+  }
+  Node* adr = mem->in(MemNode::Address);
+  if (!adr->is_AddP()) {
+    return NULL;
+  }
+  Node* base = adr->in(AddPNode::Base);
+  if (base->is_top() || !loop->is_invariant(base)) {
+    return NULL;
+  }
+  return base;
+}
+
+//------------------------------collect_alias_check_pairs---------------------
+// Collect pairs of distinct invariant array bases in the loop body that
+// may refer to the same array and of which at least one is stored to.
+// Return FALSE if there are none or too many.
+bool PhaseIdealLoop::collect_alias_check_pairs(const IdealLoopTree *loop, Node_List &pairs) const {
+  Node_List accesses;
+  for (uint i = 0; i < loop->_body.size(); i++) {
+    Node* n = loop->_body.at(i);
+    if (alias_versioning_base(loop, n) != NULL) {
+      accesses.push(n);
+    }
+  }
+  for (uint i = 0; i < accesses.size(); i++) {
+    Node* st = accesses.at(i);
+    if (!st->is_Store()) {
+      continue;
+    }
+    Node* st_base = alias_versioning_base(loop, st);
+    int alias_idx = C->get_alias_index(st->as_Mem()->adr_type());
+    for (uint j = 0; j < accesses.size(); j++) {
+      Node* acc = accesses.at(j);
+      Node* acc_base = alias_versioning_base(loop, acc);
+      if (acc_base == st_base || C->get_alias_index(acc->as_Mem()->adr_type()) != alias_idx) {
+        continue;
+      }
+      Node* b1 = st_base->_idx < acc_base->_idx ? st_base : acc_base;
+      Node* b2 = st_base->_idx < acc_base->_idx ? acc_base : st_base;
+      bool found = false;
+      for (uint k = 0; k < pairs.size(); k += 2) {
+        if (pairs.at(k) == b1 && pairs.at(k + 1) == b2) {
+          found = true;
+          break;
+        }
+      }
+      if (!found) {
+        if (pairs.size() / 2 >= (uint)LoopVersioningMaxAliasChecks) {
+          return false;
+        }
+        pairs.push(b1);
+        pairs.push(b2);
+      }
+    }
+  }
+  return pairs.size() > 0;
+}
+
+//------------------------------policy_alias_versioning-----------------------
+// Return TRUE if the loop should be versioned with a runtime check that
+// the arrays it accesses do not alias.
+bool IdealLoopTree::policy_alias_versioning(PhaseIdealLoop *phase) const {
+  if (!LoopVersioningForAliasing || !UseSuperWord) {
+    return false;
+  }
+  if (!_head->is_CountedLoop()) {
+    return false;
+  }
+  CountedLoopNode* cl = _head->as_CountedLoop();
+  if (!cl->is_normal_loop() || cl->is_alias_versioned() || !cl->stride_is_con()) {
+    return false;
+  }
+  int nodes_left = phase->C->max_node_limit() - phase->C->live_nodes();
+  if ((int)(2 * _body.size()) > nodes_left) {
+    return false; // Too speculative if running low on nodes.
+  }
+  Node_List pairs;
+  return phase->collect_alias_check_pairs(this, pairs);
+}
+
+//------------------------------do_alias_versioning---------------------------
+// Clone the loop and select the clone unless all the array bases it
+// accesses are distinct.
+void PhaseIdealLoop::do_alias_versioning(IdealLoopTree *loop, Node_List &old_new) {
+  CountedLoopNode* cl = loop->_head->as_CountedLoop();
+  Node* entry = cl->skip_strip_mined()->in(LoopNode::EntryControl);
+  if (entry->is_IfProj() && entry->outcnt() > 1 && find_predicate(entry) != NULL) {
+    // Same restriction as do_unswitching() for partially peeled
+    // statements control dependent on the predicates.
+    cl->mark_alias_versioned();
+    return;
+  }
+
+  Node_List* pairs = new (C->comp_arena()) Node_List(C->comp_arena());
+  if (!collect_alias_check_pairs(loop, *pairs)) {
+    cl->mark_alias_versioned();
+    return;
+  }
+
+#ifndef PRODUCT
+  if (TraceLoopOpts) {
+    tty->print("AliasVersion %d checks ", pairs->size() / 2);
+    loop->dump_head();
+  }
+#endif
+
+  ProjNode* proj_true = create_slow_version_of_loop(loop, old_new, Op_If, CloneIncludesStripMined);
+  IfNode* invar_iff = proj_true->in(0)->as_If();
+  Node* invar_iff_c = invar_iff->in(0);
+
+  Node_List bols;
+  for (uint i = 0; i < pairs->size(); i += 2) {
+    Node* cmp = new CmpPNode(pairs->at(i), pairs->at(i + 1));
+    register_new_node(cmp, invar_iff_c);
+    Node* bol = new BoolNode(cmp, BoolTest::ne);
+    register_new_node(bol, invar_iff_c);
+    bols.push(bol);
+  }
+  invar_iff->set_req(1, and_invariant_tests(bols, invar_iff_c));
+  invar_iff->_prob = PROB_LIKELY_MAG(3);
+
+  CountedLoopNode* slow_cl = old_new[cl->_idx]->as_CountedLoop();
+  cl->mark_alias_versioned();
+  cl->set_disjoint_bases(pairs);
+  slow_cl->mark_alias_versioned();
+  slow_cl->set_disjoint_bases(NULL);
+
+  loop->record_for_igvn();
+  for (int i = loop->_body.size() - 1; i >= 0 ; i--) {
+    Node *n = loop->_body[i];
+    Node *n_clone = old_new[n->_idx];
+    _igvn._worklist.push(n_clone);
+  }
+
+  C->set_major_progress();
+}
+
 //-------------------------create_slow_version_of_loop------------------------
 // Create a slow version of the loop by cloning the loop
 // and inserting an if to select fast-slow versions.
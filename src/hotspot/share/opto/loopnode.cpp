@@ -32,11 +32,13 @@
 #include "memory/resourceArea.hpp"
 #include "opto/addnode.hpp"
 #include "opto/callnode.hpp"
+#include "opto/castnode.hpp"
 #include "opto/connode.hpp"
 #include "opto/convertnode.hpp"
 #include "opto/divnode.hpp"
 #include "opto/idealGraphPrinter.hpp"
 #include "opto/loopnode.hpp"
+#include "opto/movenode.hpp"
 #include "opto/mulnode.hpp"
 #include "opto/rootnode.hpp"
 #include "opto/superword.hpp"
@@ -1058,6 +1060,7 @@ void CountedLoopNode::dump_spec(outputStream *st) const {
   if (is_main_loop()) st->print("main of N%d", _idx);
   if (is_post_loop()) st->print("post of N%d", _main_idx);
   if (is_strip_mined()) st->print(" strip mined");
+  if (_disjoint_bases != NULL) st->print(" alias versioned");
 }
 #endif
 
@@ -1359,6 +1362,38 @@ Node* CountedLoopNode::skip_predicates() {
   return in(LoopNode::EntryControl);
 }
 
+// Return TRUE if loop versioning for aliasing checked that the arrays
+// b1 and b2 are distinct before entering this loop.
+bool CountedLoopNode::has_disjoint_bases(Node* b1, Node* b2) const {
+  if (_disjoint_bases == NULL || b1 == NULL || b2 == NULL) {
+    return false;
+  }
+  for (uint i = 0; i < _disjoint_bases->size(); i += 2) {
+    if ((_disjoint_bases->at(i) == b1 && _disjoint_bases->at(i + 1) == b2) ||
+        (_disjoint_bases->at(i) == b2 && _disjoint_bases->at(i + 1) == b1)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Number of iterations of the (possibly unrolled) inner loop to run
+// between two safepoint polls. Loops that are cheaper than
+// LoopStripMiningBodyCost per iteration run proportionally more
+// iterations, up to 4x LoopStripMiningIter, so tight loops pay less for
+// the outer loop. Costlier loops run fewer, so that they do not delay
+// time to safepoint.
+uint OuterStripMinedLoopNode::strip_mining_iters(CountedLoopNode* inner_cl) const {
+  if (LoopStripMiningBodyCost == 0 || _iter_cost == 0) {
+    return LoopStripMiningIter;
+  }
+  julong cost = (julong)_iter_cost * inner_cl->unrolled_count();
+  julong iters = ((julong)LoopStripMiningIter * LoopStripMiningBodyCost) / cost;
+  iters = MIN2(iters, (julong)LoopStripMiningIter * 4);
+  iters = MIN2(iters, (julong)max_juint);
+  return MAX2((uint)iters, 1u);
+}
+
 void OuterStripMinedLoopNode::adjust_strip_mined_loop(PhaseIterGVN* igvn) {
   // Look for the outer & inner strip mined loop, reduce number of
   // iterations of the inner loop, set exit condition of outer loop,
@@ -1376,7 +1411,7 @@ void OuterStripMinedLoopNode::adjust_strip_mined_loop(PhaseIterGVN* igvn) {
   CountedLoopEndNode* inner_cle = inner_cl->loopexit();
 
   int stride = inner_cl->stride_con();
-  jlong scaled_iters_long = ((jlong)LoopStripMiningIter) * ABS(stride);
+  jlong scaled_iters_long = ((jlong)strip_mining_iters(inner_cl)) * ABS(stride);
   int scaled_iters = (int)scaled_iters_long;
   int short_scaled_iters = LoopStripMiningIterShortLoop* ABS(stride);
   const TypeInt* inner_iv_t = igvn->type(inner_iv_phi)->is_int();
@@ -2459,6 +2494,203 @@ void IdealLoopTree::counted_loop( PhaseIdealLoop *phase ) {
   if (loop->_next)  loop->_next ->counted_loop(phase);
 }
 
+//------------------------------is_long_counted_loop---------------------------
+// Does this innermost loop have the shape of a counted loop with a long
+// trip counter?
+//
+//   do {
+//     ...
+//     SafePoint
+//     i = i + stride;          // AddL, constant stride
+//   } while (i < limit);       // CmpL, invariant limit (i > limit for stride < 0)
+bool PhaseIdealLoop::is_long_counted_loop(IdealLoopTree* loop) {
+  Node* x = loop->_head;
+  if (x->Opcode() != Op_Loop || x->req() != 3 || loop->_irreducible || loop->_child != NULL) {
+    return false;
+  }
+  Node* init_control = x->in(LoopNode::EntryControl);
+  Node* back_control = x->in(LoopNode::LoopBackControl);
+  if (init_control == NULL || back_control == NULL ||
+      init_control->is_top() || back_control->is_top()) {
+    return false;
+  }
+  if (back_control->Opcode() != Op_IfTrue && back_control->Opcode() != Op_IfFalse) {
+    return false;
+  }
+  Node* iff = back_control->in(0);
+  if (iff->Opcode() != Op_If || get_loop(iff) != loop || !iff->in(1)->is_Bool()) {
+    return false;
+  }
+  // The poll right above the exit test provides the JVM state for the
+  // safepoint of the outer loop.
+  if (iff->in(0)->Opcode() != Op_SafePoint) {
+    return false;
+  }
+  BoolNode* test = iff->in(1)->as_Bool();
+  BoolTest::mask bt = test->_test._test;
+  if (back_control->Opcode() == Op_IfFalse) {
+    bt = BoolTest(bt).negate();
+  }
+  Node* cmp = test->in(1);
+  if (cmp->Opcode() != Op_CmpL) {
+    return false;
+  }
+  Node* incr  = cmp->in(1);
+  Node* limit = cmp->in(2);
+  if (!is_member(loop, get_ctrl(incr))) {
+    Node* tmp = incr;
+    incr = limit;
+    limit = tmp;
+    bt = BoolTest(bt).commute();
+  }
+  if (is_member(loop, get_ctrl(limit)) || incr->Opcode() != Op_AddL) {
+    return false;
+  }
+  Node* phi = incr->in(1);
+  Node* stride = incr->in(2);
+  if (!stride->is_Con()) {
+    Node* tmp = phi;
+    phi = stride;
+    stride = tmp;
+  }
+  if (!stride->is_Con() || !phi->is_Phi() || phi->in(0) != x || phi->req() != 3 ||
+      phi->in(LoopNode::LoopBackControl) != incr) {
+    return false;
+  }
+  jlong stride_con = stride->get_long();
+  // Keep the inner loop long enough to be worth it
+  if (stride_con == 0 || stride_con > max_jint / 4 || stride_con < -(max_jint / 4)) {
+    return false;
+  }
+  return (bt == BoolTest::lt && stride_con > 0) || (bt == BoolTest::gt && stride_con < 0);
+}
+
+//------------------------------create_long_loop_nests-------------------------
+// Rewrite innermost long counted loops as
+//
+//   outer: for (long o = init; ; ) {
+//     int lim = clamp(limit - o, 0, max_jint - stride);   // stride > 0
+//     int j = 0;
+//     do {
+//       ... body with i == o + j ...
+//       j += stride;
+//     } while (j < lim);
+//     if (!(o + j < limit)) break;
+//     SafePoint
+//     o += j;
+//   }
+//
+// The inner loop has an int trip counter and becomes a CountedLoop in the
+// next round of loop opts, where it gets range check elimination, unrolling
+// and vectorization. Array indices '(int)i' fold to 'ConvL2I(o) + j'.
+// The outer test re-checks the real condition, so clamping the inner limit
+// (or an overflowing 'limit - o') only ends the inner loop early.
+bool PhaseIdealLoop::create_long_loop_nests(IdealLoopTree* loop) {
+  bool progress = false;
+  if (loop->_child != NULL) {
+    progress = create_long_loop_nests(loop->_child);
+  } else if (loop != _ltree_root && is_long_counted_loop(loop)) {
+    LoopNode* head = loop->_head->as_Loop();
+    Node* entry = head->in(LoopNode::EntryControl);
+    ProjNode* back_control = head->in(LoopNode::LoopBackControl)->as_Proj();
+    IfNode* iff = back_control->in(0)->as_If();
+    SafePointNode* sfpt = iff->in(0)->as_SafePoint();
+    BoolNode* test = iff->in(1)->as_Bool();
+    Node* cmp = test->in(1);
+    bool swapped = !is_member(loop, get_ctrl(cmp->in(1)));
+    Node* incr = cmp->in(swapped ? 2 : 1);
+    Node* limit = cmp->in(swapped ? 1 : 2);
+    bool stride_first = incr->in(1)->is_Con();
+    PhiNode* phi = incr->in(stride_first ? 2 : 1)->as_Phi();
+    jlong stride_con = incr->in(stride_first ? 1 : 2)->get_long();
+    ProjNode* exit = iff->proj_out(1 - back_control->_con);
+
+    // Outer loop head, with a Phi for every value carried around the loop
+    LoopNode* outer_head = new LoopNode(entry, entry);
+    _igvn.register_new_node_with_optimizer(outer_head);
+    PhiNode* outer_phi = PhiNode::make(outer_head, phi->in(LoopNode::EntryControl), TypeLong::LONG);
+    _igvn.register_new_node_with_optimizer(outer_phi);
+    for (DUIterator_Fast imax, i = head->fast_outs(imax); i < imax; i++) {
+      Node* p = head->fast_out(i);
+      if (p->is_Phi() && p != phi) {
+        PhiNode* op = PhiNode::make(outer_head, p->in(LoopNode::EntryControl), p->bottom_type(), p->adr_type());
+        op->set_req(LoopNode::LoopBackControl, p->in(LoopNode::LoopBackControl));
+        _igvn.register_new_node_with_optimizer(op);
+        _igvn.replace_input_of(p, LoopNode::EntryControl, op);
+      }
+    }
+    _igvn.replace_input_of(head, LoopNode::EntryControl, outer_head);
+
+    // Inner loop limit, clamped to the int range the inner trip counter can
+    // reach without overflow
+    Node* diff = _igvn.transform(new SubLNode(limit, outer_phi));
+    Node* bound = _igvn.longcon(stride_con > 0 ? (jlong)max_jint - stride_con : (jlong)min_jint - stride_con);
+    Node* zero = _igvn.longcon(0);
+    BoolTest::mask past = stride_con > 0 ? BoolTest::gt : BoolTest::lt;
+    Node* bol = _igvn.transform(new BoolNode(_igvn.transform(new CmpLNode(diff, bound)), past));
+    Node* lim = _igvn.transform(CMoveNode::make(NULL, bol, diff, bound, TypeLong::LONG));
+    bol = _igvn.transform(new BoolNode(_igvn.transform(new CmpLNode(lim, zero)), BoolTest(past).commute()));
+    lim = _igvn.transform(CMoveNode::make(NULL, bol, lim, zero, TypeLong::LONG));
+    const TypeInt* lim_t = stride_con > 0 ? TypeInt::make(0, max_jint - (jint)stride_con, Type::WidenMin)
+                                          : TypeInt::make(min_jint - (jint)stride_con, 0, Type::WidenMin);
+    Node* inner_limit = new CastIINode(_igvn.transform(new ConvL2INode(lim)), lim_t);
+    inner_limit->set_req(0, outer_head);
+    inner_limit = _igvn.transform(inner_limit);
+
+    // Int trip counter of the inner loop
+    PhiNode* inner_phi = PhiNode::make(head, _igvn.intcon(0), TypeInt::INT);
+    _igvn.register_new_node_with_optimizer(inner_phi);
+    Node* inner_incr = new AddINode(inner_phi, _igvn.intcon((jint)stride_con));
+    _igvn.register_new_node_with_optimizer(inner_incr);
+    _igvn.replace_input_of(inner_phi, LoopNode::LoopBackControl, inner_incr);
+    Node* inner_cmp = _igvn.transform(swapped ? new CmpINode(inner_limit, inner_incr)
+                                              : new CmpINode(inner_incr, inner_limit));
+    _igvn.replace_input_of(iff, 1, _igvn.transform(new BoolNode(inner_cmp, test->_test._test)));
+
+    // The long induction variable is now the sum of both counters
+    Node* iv = _igvn.transform(new AddLNode(outer_phi, _igvn.transform(new ConvI2LNode(inner_phi))));
+    Node* iv_next = _igvn.transform(new AddLNode(outer_phi, _igvn.transform(new ConvI2LNode(inner_incr))));
+    _igvn.replace_node(phi, iv);
+    _igvn.replace_node(incr, iv_next);
+    _igvn.replace_input_of(outer_phi, LoopNode::LoopBackControl, iv_next);
+
+    // Leaving the inner loop goes through the original exit test, which
+    // either leaves the nest or takes the outer backedge.
+    Node* inner_exit = exit->clone();
+    _igvn.register_new_node_with_optimizer(inner_exit);
+    Node* outer_cmp = _igvn.transform(swapped ? new CmpLNode(limit, iv_next) : new CmpLNode(iv_next, limit));
+    Node* outer_bol = _igvn.transform(new BoolNode(outer_cmp, test->_test._test));
+    IfNode* outer_iff = new IfNode(inner_exit, outer_bol, PROB_FAIR, COUNT_UNKNOWN);
+    _igvn.register_new_node_with_optimizer(outer_iff);
+    Node* outer_back = back_control->clone();
+    outer_back->set_req(0, outer_iff);
+    _igvn.register_new_node_with_optimizer(outer_back);
+    Node* outer_exit = exit->clone();
+    outer_exit->set_req(0, outer_iff);
+    _igvn.register_new_node_with_optimizer(outer_exit);
+    _igvn.replace_node(exit, outer_exit);
+
+    // The poll of the outer loop is the one of the long loop: both sit right
+    // before the same exit test, so its JVM state is valid here too.
+    SafePointNode* outer_sfpt = sfpt->clone()->as_SafePoint();
+    outer_sfpt->set_req(TypeFunc::Control, outer_back);
+    _igvn.register_new_node_with_optimizer(outer_sfpt);
+    _igvn.replace_input_of(outer_head, LoopNode::LoopBackControl, outer_sfpt);
+
+#ifndef PRODUCT
+    if (TraceLoopOpts) {
+      tty->print("LongLoopNest   ");
+      loop->dump_head();
+    }
+#endif
+    progress = true;
+  }
+  if (loop->_next != NULL && create_long_loop_nests(loop->_next)) {
+    progress = true;
+  }
+  return progress;
+}
+
 #ifndef PRODUCT
 //------------------------------dump_head--------------------------------------
 // Dump 1 liner for loop header info
@@ -2882,6 +3114,16 @@ void PhaseIdealLoop::build_and_optimize(LoopOptsMode mode) {
   if( !_verify_me && !_verify_only SHENANDOAHGC_ONLY(&& !shenandoah_opts))
     _ltree_root->counted_loop( this );
 
+  // Loops over a long induction variable are rewritten into a nest whose
+  // inner loop counts with an int. The loop tree no longer describes the
+  // graph afterwards, so stop here and let the next round pick them up.
+  if (UseLongLoopNests && mode == LoopOptsDefault && !_verify_me && !_verify_only &&
+      create_long_loop_nests(_ltree_root)) {
+    C->set_major_progress();
+    _igvn.optimize();
+    return;
+  }
+
   // Find latest loop placement.  Find ideal loop placement.
   visited.Clear();
   init_dom_lca_tags();
@@ -2923,6 +3165,19 @@ void PhaseIdealLoop::build_and_optimize(LoopOptsMode mode) {
   // For example, peeling. Eliminate them before next loop optimizations.
   eliminate_useless_predicates();
 
+  if (LoopStripMiningIter > 1 && LoopStripMiningBodyCost > 0) {
+    // Record the body cost of strip mined loops for
+    // OuterStripMinedLoopNode::adjust_strip_mined_loop().
+    for (LoopTreeIterator iter(_ltree_root); !iter.done(); iter.next()) {
+      IdealLoopTree* lpt = iter.current();
+      if (!lpt->is_counted() || !lpt->is_inner()) continue;
+      CountedLoopNode* cl = lpt->_head->as_CountedLoop();
+      if (!cl->is_strip_mined() || cl->outer_loop() == NULL) continue;
+      uint cost = lpt->_body.size() / cl->unrolled_count();
+      cl->outer_loop()->set_iter_cost(MAX2(cost, 1u));
+    }
+  }
+
 #ifndef PRODUCT
   C->verify_graph_edges();
   if (_verify_me) {             // Nested verify pass?
@@ -3004,6 +3259,10 @@ void PhaseIdealLoop::build_and_optimize(LoopOptsMode mode) {
     _ltree_root->_child->loop_predication(this);
   }
 
+  if (ReduceFilledArrayZeroing && ReduceBulkZeroing && C->has_loops() && !C->major_progress()) {
+    do_eliminate_fill_zeroing();
+  }
+
   if (OptimizeFill && UseLoopPredicate && C->has_loops() && !C->major_progress()) {
     if (do_intrinsify_fill()) {
       C->set_major_progress();
@@ -3091,6 +3350,17 @@ void PhaseIdealLoop::build_and_optimize(LoopOptsMode mode) {
     }
   }
 
+  // Move the reductions of vectorized loops out of the loop body.
+  if (UseSuperWord && SuperWordReductions && SuperWordReductionsOutOfLoop &&
+      C->has_loops() && !C->major_progress()) {
+    for (LoopTreeIterator iter(_ltree_root); !iter.done(); iter.next()) {
+      IdealLoopTree* lpt = iter.current();
+      if (lpt->is_counted() && lpt->_child == NULL) {
+        move_reductions_out_of_loop(lpt);
+      }
+    }
+  }
+
   // Cleanup any modified bits
   _igvn.optimize();
 
@@ -4267,6 +4537,7 @@ void PhaseIdealLoop::build_loop_late_post( Node *n ) {
     case Op_StrIndexOfChar:
     case Op_AryEq:
     case Op_HasNegatives:
+    case Op_StrHashCode:
       pinned = false;
     }
 #if INCLUDE_SHENANDOAHGC
@@ -76,7 +76,8 @@ protected:
          IsMultiversioned=16384,
          StripMined=32768,
          SubwordLoop=65536,
-         ProfileTripFailed=131072};
+         ProfileTripFailed=131072,
+         AliasVersioned=262144};
   char _unswitch_count;
   enum { _unswitch_max=3 };
   char _postloop_flags;
@@ -101,6 +102,7 @@ public:
   bool is_strip_mined() const { return _loop_flags & StripMined; }
   bool is_profile_trip_failed() const { return _loop_flags & ProfileTripFailed; }
   bool is_subword_loop() const { return _loop_flags & SubwordLoop; }
+  bool is_alias_versioned() const { return _loop_flags & AliasVersioned; }
 
   void mark_partial_peel_failed() { _loop_flags |= PartialPeelFailed; }
   void mark_has_reductions() { _loop_flags |= HasReductions; }
@@ -115,6 +117,7 @@ public:
   void clear_strip_mined() { _loop_flags &= ~StripMined; }
   void mark_profile_trip_failed() { _loop_flags |= ProfileTripFailed; }
   void mark_subword_loop() { _loop_flags |= SubwordLoop; }
+  void mark_alias_versioned() { _loop_flags |= AliasVersioned; }
 
   int unswitch_max() { return _unswitch_max; }
   int unswitch_count() { return _unswitch_count; }
@@ -212,11 +215,15 @@ class CountedLoopNode : public LoopNode {
   // vector mapped unroll factor here
   int _slp_maximum_unroll_factor;
 
+  // Pairs of array bases that a dominating loop versioning test
+  // proved to be distinct objects (see do_alias_versioning)
+  Node_List* _disjoint_bases;
+
 public:
   CountedLoopNode( Node *entry, Node *backedge )
     : LoopNode(entry, backedge), _main_idx(0), _trip_count(max_juint),
       _unrolled_count_log2(0), _node_count_before_unroll(0),
-      _slp_maximum_unroll_factor(0) {
+      _slp_maximum_unroll_factor(0), _disjoint_bases(NULL) {
     init_class_id(Class_CountedLoop);
     // Initialize _trip_count to the largest possible value.
     // Will be reset (lower) if the loop's trip count is known.
@@ -300,6 +307,9 @@ public:
   void set_slp_max_unroll(int unroll_factor) { _slp_maximum_unroll_factor = unroll_factor; }
   int  slp_max_unroll() const                { return _slp_maximum_unroll_factor; }
 
+  void set_disjoint_bases(Node_List* bases)  { _disjoint_bases = bases; }
+  bool has_disjoint_bases(Node* b1, Node* b2) const;
+
   virtual LoopNode* skip_strip_mined(int expect_skeleton = 1);
   OuterStripMinedLoopNode* outer_loop() const;
   virtual IfTrueNode* outer_loop_tail() const;
@@ -417,10 +427,15 @@ class LoopLimitNode : public Node {
 // Support for strip mining
 class OuterStripMinedLoopNode : public LoopNode {
 private:
+  // Estimated cost in nodes of one iteration of the inner loop before
+  // unrolling, as seen by the last round of loop opts. 0 if unknown.
+  uint _iter_cost;
+  virtual uint size_of() const { return sizeof(*this); }
   CountedLoopNode* inner_loop() const;
+  uint strip_mining_iters(CountedLoopNode* inner_cl) const;
 public:
   OuterStripMinedLoopNode(Compile* C, Node *entry, Node *backedge)
-    : LoopNode(entry, backedge) {
+    : LoopNode(entry, backedge), _iter_cost(0) {
     init_class_id(Class_OuterStripMinedLoop);
     init_flags(Flag_is_macro);
     C->add_macro_node(this);
@@ -428,6 +443,9 @@ public:
 
   virtual int Opcode() const;
 
+  uint iter_cost() const             { return _iter_cost; }
+  void set_iter_cost(uint iter_cost) { _iter_cost = iter_cost; }
+
   virtual IfTrueNode* outer_loop_tail() const;
   virtual OuterStripMinedLoopEndNode* outer_loop_end() const;
   virtual IfFalseNode* outer_loop_exit() const;
@@ -558,6 +576,10 @@ public:
   // loop with an invariant test
   bool policy_unswitching( PhaseIdealLoop *phase ) const;
 
+  // Return TRUE or FALSE if the loop should be versioned with a runtime
+  // check that the arrays it accesses are distinct.
+  bool policy_alias_versioning( PhaseIdealLoop *phase ) const;
+
   // Micro-benchmark spamming.  Remove empty loops.
   bool policy_do_remove_empty_loop( PhaseIdealLoop *phase );
 
@@ -980,6 +1002,8 @@ public:
   virtual Node *transform( Node *a_node ) { return 0; }
 
   bool is_counted_loop(Node* x, IdealLoopTree*& loop);
+  bool is_long_counted_loop(IdealLoopTree* loop);
+  bool create_long_loop_nests(IdealLoopTree* loop);
   IdealLoopTree* create_outer_strip_mined_loop(BoolNode *test, Node *cmp, Node *init_control,
                                                IdealLoopTree* loop, float cl_prob, float le_fcnt,
                                                Node*& entry_control, Node*& iffalse);
@@ -1145,6 +1169,10 @@ public:
   // Cause the rce'd post loop to optimized away, this happens if we cannot complete multiverioning
   void poison_rce_post_loop(IdealLoopTree *rce_loop);
 
+  // Replace the chain of vector reductions in a vectorized loop with a
+  // vector accumulator, and reduce it to a scalar once after the loop
+  void move_reductions_out_of_loop(IdealLoopTree *loop);
+
   // Create a slow version of the loop by cloning the loop
   // and inserting an if to select fast-slow versions.
   ProjNode* create_slow_version_of_loop(IdealLoopTree *loop,
@@ -1169,6 +1197,20 @@ public:
 
   // Find candidate "if" for unswitching
   IfNode* find_unswitching_candidate(const IdealLoopTree *loop) const;
+  // Find other strongly biased invariant tests to unswitch on together
+  // with the candidate
+  void find_unswitching_companions(const IdealLoopTree *loop, IfNode* unswitch_iff, Node_List &companions) const;
+  // Unswitch on several invariant tests with one hoisted test
+  void do_multi_unswitching(IdealLoopTree *loop, Node_List &old_new, Node_List &unswitch_iffs);
+  // Combine invariant tests into one test that holds if all of them hold
+  BoolNode* and_invariant_tests(Node_List &bols, Node* ctrl);
+
+  // Collect the array base pairs a loop versioning check for aliasing
+  // needs to compare
+  bool collect_alias_check_pairs(const IdealLoopTree *loop, Node_List &pairs) const;
+  // Clone loop and select the version without aliasing arrays
+  // at runtime
+  void do_alias_versioning(IdealLoopTree *loop, Node_List &old_new);
 
   // Range Check Elimination uses this function!
   // Constrain the main loop iterations so the affine function:
@@ -1270,6 +1312,10 @@ public:
   bool match_fill_loop(IdealLoopTree* lpt, Node*& store, Node*& store_value,
                        Node*& shift, Node*& offset);
 
+  // Skip zeroing of arrays that a counted loop fills right after allocation
+  void do_eliminate_fill_zeroing();
+  bool eliminate_fill_zeroing(IdealLoopTree* lpt, Node* store);
+
 private:
   // Return a type based on condition control flow
   const TypeInt* filtered_type( Node *n, Node* n_ctrl);
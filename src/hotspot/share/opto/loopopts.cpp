@@ -493,6 +493,36 @@ Node *PhaseIdealLoop::remix_address_expressions( Node *n ) {
   return NULL;
 }
 
+//------------------------------make_min_max-----------------------------------
+// An int select of the two compared values is a MinI or MaxI, which
+// every platform matches directly and which AddI/MinI idealization
+// already knows how to fold.
+// 'f' and 't' are the values selected when 'bol' is false and true.
+static Node* make_min_max(Node* bol, Node* f, Node* t) {
+  Node* cmp = bol->in(1);
+  if (cmp->Opcode() != Op_CmpI) return NULL;
+  Node* a = cmp->in(1);
+  Node* b = cmp->in(2);
+  bool a_if_true;
+  if (t == a && f == b) {
+    a_if_true = true;
+  } else if (t == b && f == a) {
+    a_if_true = false;
+  } else {
+    return NULL;
+  }
+  switch (bol->as_Bool()->_test._test) {
+  case BoolTest::lt:
+  case BoolTest::le:
+    return a_if_true ? (Node*)new MinINode(a, b) : (Node*)new MaxINode(a, b);
+  case BoolTest::gt:
+  case BoolTest::ge:
+    return a_if_true ? (Node*)new MaxINode(a, b) : (Node*)new MinINode(a, b);
+  default:
+    return NULL;
+  }
+}
+
 //------------------------------conditional_move-------------------------------
 // Attempt to replace a Phi with a conditional move.  We have some pretty
 // strict profitability requirements.  All Phis at the merge point must
@@ -524,6 +554,13 @@ Node *PhaseIdealLoop::conditional_move( Node *region ) {
   // Always convert to CMOVE if all results are used only outside this loop.
   bool used_inside_loop = (r_loop == _ltree_root);
 
+  // A well profiled branch that goes either way about equally often
+  // mispredicts a lot; it pays to speculate more to get rid of it.
+  bool unpredictable = UnpredictableBranchPercent > 0 &&
+    iff->_fcnt != COUNT_UNKNOWN && iff->_fcnt >= 100 &&
+    fabs(iff->_prob - PROB_FAIR) * 100.0f <= (float)UnpredictableBranchPercent;
+  int cost_limit = unpredictable ? 2 * ConditionalMoveLimit : ConditionalMoveLimit;
+
   // Check profitability
   int cost = 0;
   int phis = 0;
@@ -576,10 +613,11 @@ Node *PhaseIdealLoop::conditional_move( Node *region ) {
       if (get_ctrl(inp) == proj) { // Found local op
         cost++;
         // Check for a chain of dependent ops; these will all become
-        // speculative in a CMOV.
+        // speculative in a CMOV.  Unpredictable branches may afford a
+        // short chain.
         for (uint k = 1; k < inp->req(); k++)
           if (get_ctrl(inp->in(k)) == proj)
-            cost += ConditionalMoveLimit; // Too much speculative goo
+            cost += unpredictable ? 2 : ConditionalMoveLimit; // Too much speculative goo
       }
     }
     // See if the Phi is used by a Cmp or Narrow oop Decode/Encode.
@@ -587,7 +625,7 @@ Node *PhaseIdealLoop::conditional_move( Node *region ) {
     for (DUIterator_Fast kmax, k = phi->fast_outs(kmax); k < kmax; k++) {
       Node* use = phi->fast_out(k);
       if (use->is_Cmp() || use->is_DecodeNarrowPtr() || use->is_EncodeNarrowPtr())
-        cost += ConditionalMoveLimit;
+        cost += cost_limit;
       // Is there a use inside the loop?
       // Note: check only basic types since CMoveP is pinned.
       if (!used_inside_loop && is_java_primitive(bt)) {
@@ -608,10 +646,20 @@ Node *PhaseIdealLoop::conditional_move( Node *region ) {
   // Avoid duplicated float compare.
   if (phis > 1 && (cmp_op == Op_CmpF || cmp_op == Op_CmpD)) return NULL;
 
+  // A single int select in an innermost counted loop can be vectorized by
+  // SuperWord into a compare and blend, which wins however predictable the
+  // branch is.
+  bool vector_select = false;
+  if (UseVectorCmov && UseSuperWord && phis == 1 && cmp_op == Op_CmpI &&
+      used_inside_loop && r_loop->_child == NULL && r_loop->_head->is_CountedLoop()) {
+    Node* phi = region->find_out_with(Op_Phi);
+    vector_select = (phi != NULL && phi->bottom_type()->basic_type() == T_INT);
+  }
+
   float infrequent_prob = PROB_UNLIKELY_MAG(3);
   // Ignore cost and blocks frequency if CMOVE can be moved outside the loop.
   if (used_inside_loop) {
-    if (cost >= ConditionalMoveLimit) return NULL; // Too much goo
+    if (cost >= cost_limit) return NULL; // Too much goo
 
     // BlockLayoutByFrequency optimization moves infrequent branch
     // from hot path. No point in CMOV'ing in such case (110 is used
@@ -624,6 +672,8 @@ Node *PhaseIdealLoop::conditional_move( Node *region ) {
   // we are going to predict accurately all the time.
   if (C->use_cmove() && (cmp_op == Op_CmpF || cmp_op == Op_CmpD)) {
     //keep going
+  } else if (vector_select) {
+    //keep going
   } else if (iff->_prob < infrequent_prob ||
       iff->_prob > (1.0f - infrequent_prob))
     return NULL;
@@ -662,7 +712,10 @@ Node *PhaseIdealLoop::conditional_move( Node *region ) {
         }
       }
     }
-    Node *cmov = CMoveNode::make(cmov_ctrl, iff->in(1), phi->in(1+flip), phi->in(2-flip), _igvn.type(phi));
+    Node *cmov = vector_select ? NULL : make_min_max(bol, phi->in(1+flip), phi->in(2-flip));
+    if (cmov == NULL) {
+      cmov = CMoveNode::make(cmov_ctrl, iff->in(1), phi->in(1+flip), phi->in(2-flip), _igvn.type(phi));
+    }
     register_new_node( cmov, cmov_ctrl );
     _igvn.replace_node( phi, cmov );
 #ifndef PRODUCT
@@ -24,6 +24,7 @@
 
 #include "precompiled.hpp"
 #include "gc/shared/collectedHeap.hpp"
+#include "opto/addnode.hpp"
 #include "opto/machnode.hpp"
 #include "opto/regalloc.hpp"
 #include "utilities/vmError.hpp"
@@ -456,9 +457,14 @@ bool MachNode::rematerialize() const {
     return true;
   }
 
-  // Stretching lots of inputs - don't do it.
+  // Stretching lots of inputs - don't do it.  Machine AddP nodes carry
+  // an extra base edge; when base and address are the same node only
+  // one live range is stretched.
   if (req() > 2) {
-    return false;
+    if (!(req() == 3 && ideal_Opcode() == Op_AddP &&
+          in(AddPNode::Base) == in(AddPNode::Address))) {
+      return false;
+    }
   }
 
   if (req() == 2 && in(1) && in(1)->ideal_reg() == Op_RegFlags) {
@@ -1801,6 +1801,11 @@ PhaseMacroExpand::initialize_object(AllocateNode* alloc,
                                             &_igvn);
     }
   } else {
+#ifndef PRODUCT
+    if (CountFilledArrayZeroing && init->is_complete_with_fill()) {
+      rawmem = count_filled_array_zeroing(control, rawmem, header_size, size_in_bytes);
+    }
+#endif
     if (!init->is_complete()) {
       // Try to win by zeroing only what the init does not store.
       // We can also try to do some peephole optimizations,
@@ -1817,6 +1822,31 @@ PhaseMacroExpand::initialize_object(AllocateNode* alloc,
   return rawmem;
 }
 
+#ifndef PRODUCT
+jlong PhaseMacroExpand::_filled_array_zeroing_bytes = 0;
+
+// Add the size of the array body to a global counter.  The update is racy,
+// which is good enough for a diagnostic.
+Node* PhaseMacroExpand::count_filled_array_zeroing(Node* control, Node* rawmem,
+                                                   intptr_t header_size, Node* size_in_bytes) {
+  Node* adr = makecon(TypeRawPtr::make((address)&_filled_array_zeroing_bytes));
+  Node* cnt = make_load(control, rawmem, adr, 0, TypeLong::LONG, T_LONG);
+  Node* body_size = transform_later(new SubXNode(size_in_bytes, MakeConX(header_size)));
+#ifndef _LP64
+  body_size = transform_later(new ConvI2LNode(body_size));
+#endif
+  Node* new_cnt = transform_later(new AddLNode(cnt, body_size));
+  return make_store(control, rawmem, adr, 0, new_cnt, T_LONG);
+}
+
+void PhaseMacroExpand::print_statistics() {
+  if (CountFilledArrayZeroing) {
+    tty->print_cr("Array zeroing avoided for filled arrays: " JLONG_FORMAT " bytes",
+                  _filled_array_zeroing_bytes);
+  }
+}
+#endif
+
 // Generate prefetch instructions for next allocations.
 Node* PhaseMacroExpand::prefetch_allocation(Node* i_o, Node*& needgc_false,
                                         Node*& contended_phi_rawmem,
@@ -202,6 +202,12 @@ private:
 
   Node* make_arraycopy_load(ArrayCopyNode* ac, intptr_t offset, Node* ctl, Node* mem, BasicType ft, const Type *ftype, AllocateNode *alloc);
 
+#ifndef PRODUCT
+  static jlong _filled_array_zeroing_bytes; // Zeroing skipped for filled arrays
+  Node* count_filled_array_zeroing(Node* control, Node* rawmem,
+                                   intptr_t header_size, Node* size_in_bytes);
+#endif
+
 public:
   PhaseMacroExpand(PhaseIterGVN &igvn) : Phase(Macro_Expand), _igvn(igvn), _has_locks(false) {
     _igvn.set_delay_transform(true);
@@ -217,6 +223,10 @@ public:
   Node* longcon(jlong con)      const { return _igvn.longcon(con); }
   Node* makecon(const Type *t)  const { return _igvn.makecon(t); }
   Node* top()                   const { return C->top(); }
+
+#ifndef PRODUCT
+  static void print_statistics();
+#endif
 };
 
 #endif // SHARE_VM_OPTO_MACRO_HPP
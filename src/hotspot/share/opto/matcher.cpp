@@ -950,6 +950,7 @@ static void match_alias_type(Compile* C, Node* n, Node* m) {
     case Op_StrIndexOfChar:
     case Op_AryEq:
     case Op_HasNegatives:
+    case Op_StrHashCode:
     case Op_MemBarVolatile:
     case Op_MemBarCPUOrder: // %%% these ideals should have narrower adr_type?
     case Op_StrInflatedCopy:
@@ -2139,6 +2140,7 @@ void Matcher::find_shared( Node *n ) {
       case Op_StrIndexOfChar:
       case Op_AryEq:
       case Op_HasNegatives:
+      case Op_StrHashCode:
       case Op_StrInflatedCopy:
       case Op_StrCompressedCopy:
       case Op_EncodeISOArray:
@@ -2313,7 +2315,9 @@ void Matcher::find_shared( Node *n ) {
         n->del_req(3);
         break;
       }
-      case Op_LoopLimit: {
+      case Op_LoopLimit:
+      case Op_VectorMaskCmp:
+      case Op_VectorBlend: {
         Node *pair1 = new BinaryNode(n->in(1),n->in(2));
         n->set_req(1,pair1);
         n->set_req(2,n->in(3));
@@ -1317,7 +1317,8 @@ class InitializeNode: public MemBarNode {
   enum {
     Incomplete    = 0,
     Complete      = 1,
-    WithArraycopy = 2
+    WithArraycopy = 2,
+    WithFill      = 4
   };
   int _is_complete;
 
@@ -1357,10 +1358,12 @@ public:
   // initialization of the new memory to zero, then to any initializers.
   bool is_complete() { return _is_complete != Incomplete; }
   bool is_complete_with_arraycopy() { return (_is_complete & WithArraycopy) != 0; }
+  bool is_complete_with_fill() { return (_is_complete & WithFill) != 0; }
 
   // Mark complete.  (Must not yet be complete.)
   void set_complete(PhaseGVN* phase);
   void set_complete_with_arraycopy() { _is_complete = Complete | WithArraycopy; }
+  void set_complete_with_fill() { _is_complete = Complete | WithFill; }
 
   bool does_not_escape() { return _does_not_escape; }
   void set_does_not_escape() { _does_not_escape = true; }
@@ -81,9 +81,12 @@ protected:
                             bool& should_delay);
   bool        should_inline(ciMethod* callee_method,
                             ciMethod* caller_method,
-                            int caller_bci,
+                            JVMState* jvms,
                             ciCallProfile& profile,
                             WarmCallInfo* wci_result);
+  int         benefit_inline_size(ciMethod* callee_method,
+                                  JVMState* jvms,
+                                  int max_inline_size) const;
   bool        should_not_inline(ciMethod* callee_method,
                                 ciMethod* caller_method,
                                 JVMState* jvms,
@@ -504,6 +507,10 @@ class Parse : public GraphKit {
   // Helper function to uncommon-trap or bailout for non-compilable call-sites
   bool can_not_compile_call_site(ciMethod *dest_method, ciInstanceKlass *klass);
 
+  // Helper function to decide if a cold call site should trap instead of
+  // letting a freshly allocated argument escape
+  bool should_trap_cold_escape(int nargs);
+
   // Helper function to setup for type-profile based inlining
   bool prepare_type_profile_inline(ciInstanceKlass* prof_klass, ciMethod* prof_method);
 
@@ -29,6 +29,7 @@
 #include "opto/matcher.hpp"
 #include "opto/node.hpp"
 #include "opto/phase.hpp"
+#include "runtime/atomic.hpp"
 
 int Phase::_total_bytes_compiled = 0;
 
@@ -39,6 +40,58 @@ elapsedTimer Phase::_t_stubCompilation;
 // The counters to use for LogCompilation
 elapsedTimer Phase::timers[max_phase_timers];
 
+const char* Phase::_timer_names[max_phase_timers] = {
+  "Parse",
+  "Optimize",
+  "Escape Analysis",
+  "Conn Graph",
+  "Macro Eliminate",
+  "GVN 1",
+  "Incremental Inline",
+  "IncrInline IdealLoop",
+  "IncrInline IGVN",
+  "IncrInline Prune",
+  "IncrInline Inline",
+  "Renumber Live",
+  "IdealLoop",
+  "IdealLoop Verify",
+  "Cond Const Prop",
+  "GVN 2",
+  "Macro Expand",
+  "Graph Reshape",
+  "Matcher",
+  "Scheduler",
+  "Regalloc",
+  "Ctor Chaitin",
+  "Build IFG (virt)",
+  "Build IFG (phys)",
+  "Compute Liveness",
+  "Regalloc Split",
+  "Postalloc Copy Rem",
+  "Merge multidefs",
+  "Fixup Spills",
+  "Compact",
+  "Coalesce 1",
+  "Coalesce 2",
+  "Coalesce 3",
+  "Cache LRG",
+  "Simplify",
+  "Select",
+  "Block Ordering",
+  "Peephole",
+  "Postalloc Expand",
+  "Code Emission",
+  "Insn Scheduling",
+  "Build OOP maps",
+  "Code Installation",
+  "Temp Timer 1",
+  "Temp Timer 2"
+};
+
+volatile size_t Phase::_arena_growth[max_phase_timers];
+volatile size_t Phase::_arena_growth_max[max_phase_timers];
+volatile size_t Phase::_arena_growth_count[max_phase_timers];
+
 //------------------------------Phase------------------------------------------
 Phase::Phase( PhaseNumber pnum ) : _pnum(pnum), C( pnum == Compiler ? NULL : Compile::current()) {
   // Poll for requests from shutdown mechanism to quiesce compiler (4448539, 4448544).
@@ -47,6 +100,35 @@ Phase::Phase( PhaseNumber pnum ) : _pnum(pnum), C( pnum == Compiler ? NULL : Com
   CompileBroker::maybe_block();
 }
 
+void Phase::record_arena_growth(int phase_id, size_t bytes) {
+  assert(phase_id >= 0 && phase_id < max_phase_timers, "bad phase id");
+  Atomic::add(bytes, &_arena_growth[phase_id]);
+  Atomic::inc(&_arena_growth_count[phase_id]);
+  size_t old_max = _arena_growth_max[phase_id];
+  while (bytes > old_max) {
+    size_t cur = Atomic::cmpxchg(bytes, &_arena_growth_max[phase_id], old_max);
+    if (cur == old_max) {
+      break;
+    }
+    old_max = cur;
+  }
+}
+
+void Phase::print_arena_growth() {
+  tty->cr();
+  tty->print_cr ("    C2 Arena Growth:           total       avg       max     count");
+  for (int i = 0; i < max_phase_timers; i++) {
+    size_t count = _arena_growth_count[i];
+    if (count == 0) {
+      continue;
+    }
+    size_t total = _arena_growth[i];
+    tty->print_cr ("       %-20s %8.1fM %8.1fK %8.1fK " SIZE_FORMAT_W(9),
+                   _timer_names[i], (double)total / M, (double)total / count / K,
+                   (double)_arena_growth_max[i] / K, count);
+  }
+}
+
 void Phase::print_timers() {
   tty->print_cr ("    C2 Compile Time:      %7.3f s", Phase::_t_totalCompilation.seconds());
   tty->print_cr ("       Parse:               %7.3f s", timers[_t_parser].seconds());
@@ -179,4 +261,5 @@ void Phase::print_timers() {
       tty->print_cr("       Other:               %7.3f s", other);
     }
 
+  print_arena_growth();
 }
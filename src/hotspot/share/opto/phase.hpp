@@ -113,6 +113,9 @@ public:
 
   static elapsedTimer timers[max_phase_timers];
 
+  // Arena growth per phase, collected with CITime
+  static void record_arena_growth(int phase_id, size_t bytes);
+
 protected:
   enum PhaseNumber _pnum;       // Phase number (for stat gathering)
 
@@ -123,6 +126,12 @@ protected:
   static elapsedTimer _t_methodCompilation;
   static elapsedTimer _t_stubCompilation;
 
+  static const char* _timer_names[max_phase_timers];
+  static volatile size_t _arena_growth[max_phase_timers];       // total bytes
+  static volatile size_t _arena_growth_max[max_phase_timers];   // max in one phase
+  static volatile size_t _arena_growth_count[max_phase_timers];
+  static void print_arena_growth();
+
   // Generate a subtyping check.  Takes as input the subtype and supertype.
   // Returns 2 values: sets the default control() to the true path and
   // returns the false path.  Only reads from constant memory taken from the
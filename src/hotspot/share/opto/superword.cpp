@@ -1030,7 +1030,8 @@ void SuperWord::dependence_graph() {
           // Create a runtime check to disambiguate
           OrderedPair pp(p1.base(), p2.base());
           _disjoint_ptrs.append_if_missing(pp);
-        } else if (!SWPointer::not_equal(cmp)) {
+        } else if (!SWPointer::not_equal(cmp) &&
+                   !(p1.valid() && p2.valid() && cl->has_disjoint_bases(p1.base(), p2.base()))) {
           // Possibly same address
           _dg.make_edge(s1, s2);
           sink_dependent = false;
@@ -1739,7 +1740,8 @@ Node_List* CMoveKit::make_cmovevd_pack(Node_List* cmovd_pk) {
   if (!cmovd->is_CMove()) {
     return NULL;
   }
-  if (cmovd->Opcode() != Op_CMoveF && cmovd->Opcode() != Op_CMoveD) {
+  bool is_fp = cmovd->Opcode() == Op_CMoveF || cmovd->Opcode() == Op_CMoveD;
+  if (!is_fp && (cmovd->Opcode() != Op_CMoveI || _sw->velt_basic_type(cmovd) != T_INT)) {
     return NULL;
   }
   if (pack(cmovd) != NULL) { // already in the cmov pack
@@ -1778,7 +1780,7 @@ Node_List* CMoveKit::make_cmovevd_pack(Node_List* cmovd_pk) {
     return NULL;
   }
 
-  if (!test_cmpd_pack(cmpd_pk, cmovd_pk)) {
+  if (is_fp ? !test_cmpd_pack(cmpd_pk, cmovd_pk) : !test_cmpi_pack(cmpd_pk, cmovd_pk)) {
     NOT_PRODUCT(if(_sw->is_trace_cmov()) {tty->print("CMoveKit::make_cmovevd_pack: cmpd pack for CmpD %d failed vectorization test", cmpd->_idx); cmpd->dump();})
     return NULL;
   }
@@ -1862,6 +1864,43 @@ bool CMoveKit::test_cmpd_pack(Node_List* cmpd_pk, Node_List* cmovd_pk) {
   return true;
 }
 
+// An int select is emitted as a lane-wise VectorMaskCmp feeding a VectorBlend,
+// so unlike the FP case the compare operands need not be the CMove inputs:
+// they only have to be vectorizable int operands themselves.
+bool CMoveKit::test_cmpi_pack(Node_List* cmpi_pk, Node_List* cmovi_pk) {
+  Node* cmpi0 = cmpi_pk->at(0);
+  assert(cmovi_pk->at(0)->Opcode() == Op_CMoveI, "CMoveKit::test_cmpi_pack: should be CMoveI");
+  assert(cmpi_pk->size() == cmovi_pk->size(), "CMoveKit::test_cmpi_pack: should be same size");
+  if (cmpi0->Opcode() != Op_CmpI) {
+    return false;
+  }
+  BoolTest::mask test = cmovi_pk->at(0)->in(CMoveNode::Condition)->as_Bool()->_test._test;
+  if (test == BoolTest::overflow || test == BoolTest::no_overflow) {
+    return false;
+  }
+  for (uint j = 1; j < cmovi_pk->size(); j++) {
+    if (cmovi_pk->at(j)->in(CMoveNode::Condition)->as_Bool()->_test._test != test) {
+      return false;
+    }
+  }
+  int vlen = cmovi_pk->size();
+  if (!Matcher::match_rule_supported_vector(Op_VectorMaskCmp, vlen) ||
+      !Matcher::match_rule_supported_vector(Op_VectorBlend, vlen)) {
+    return false;
+  }
+  for (uint k = 1; k <= 2; k++) {
+    Node* in = cmpi0->in(k);
+    if (_sw->my_pack(in) != NULL && _sw->velt_basic_type(in) != T_INT) {
+      return false;
+    }
+    if (!_sw->is_vector_use(cmpi0, k)) {
+      return false;
+    }
+  }
+  NOT_PRODUCT(if(_sw->is_trace_cmov()) { tty->print("CMoveKit::test_cmpi_pack: cmpi pack for 1st CmpI %d is OK for vectorization: ", cmpi0->_idx); cmpi0->dump(); })
+  return true;
+}
+
 //------------------------------implemented---------------------------
 // Can code be generated for pack p?
 bool SuperWord::implemented(Node_List* p) {
@@ -2439,11 +2478,8 @@ void SuperWord::output() {
         }
 
         int cond = (int)bol->as_Bool()->_test._test;
-        Node* in_cc  = _igvn.intcon(cond);
+        ConINode* in_cc = _igvn.intcon(cond);
         NOT_PRODUCT(if(is_trace_cmov()) {tty->print("SWPointer::output: created intcon in_cc node %d", in_cc->_idx); in_cc->dump();})
-        Node* cc = bol->clone();
-        cc->set_req(1, in_cc);
-        NOT_PRODUCT(if(is_trace_cmov()) {tty->print("SWPointer::output: created bool cc node %d", cc->_idx); cc->dump();})
 
         Node* src1 = vector_opd(p, 2); //2=CMoveNode::IfFalse
         if (src1 == NULL) {
@@ -2463,12 +2499,34 @@ void SuperWord::output() {
         }
         BasicType bt = velt_basic_type(n);
         const TypeVect* vt = TypeVect::make(bt, vlen);
-        assert(bt == T_FLOAT || bt == T_DOUBLE, "Only vectorization for FP cmovs is supported");
-        if (bt == T_FLOAT) {
-          vn = new CMoveVFNode(cc, src1, src2, vt);
+        assert(bt == T_INT || bt == T_FLOAT || bt == T_DOUBLE, "Only vectorization for int and FP cmovs is supported");
+        if (bt == T_INT) {
+          // The compare was not subsumed by the select: vectorize it into a
+          // lane mask and blend the two value vectors with it.
+          Node_List* cmp_pk = my_pack(bol->in(1));
+          Node* cmp_in1 = (cmp_pk != NULL) ? vector_opd(cmp_pk, 1) : NULL;
+          Node* cmp_in2 = (cmp_pk != NULL) ? vector_opd(cmp_pk, 2) : NULL;
+          if (cmp_in1 == NULL || cmp_in2 == NULL) {
+            if (do_reserve_copy()) {
+              NOT_PRODUCT(if(is_trace_loop_reverse() || TraceLoopOpts) {tty->print_cr("SWPointer::output: CmpI operands could not be vectorized, exiting SuperWord");})
+              return; //and reverse to backup IG
+            }
+            ShouldNotReachHere();
+          }
+          Node* mask = new VectorMaskCmpNode(cmp_in1, cmp_in2, in_cc, vt);
+          _igvn.register_new_node_with_optimizer(mask);
+          _phase->set_ctrl(mask, _phase->get_ctrl(p->at(0)));
+          vn = new VectorBlendNode(src1, src2, mask, vt);
         } else {
-          assert(bt == T_DOUBLE, "Expected double");
-          vn = new CMoveVDNode(cc, src1, src2, vt);
+          Node* cc = bol->clone();
+          cc->set_req(1, in_cc);
+          NOT_PRODUCT(if(is_trace_cmov()) {tty->print("SWPointer::output: created bool cc node %d", cc->_idx); cc->dump();})
+          if (bt == T_FLOAT) {
+            vn = new CMoveVFNode(cc, src1, src2, vt);
+          } else {
+            assert(bt == T_DOUBLE, "Expected double");
+            vn = new CMoveVDNode(cc, src1, src2, vt);
+          }
         }
         NOT_PRODUCT(if(is_trace_cmov()) {tty->print("SWPointer::output: created new CMove node %d: ", vn->_idx); vn->dump();})
       } else if (opc == Op_FmaD || opc == Op_FmaF) {
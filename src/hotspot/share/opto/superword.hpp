@@ -217,6 +217,7 @@ class CMoveKit {
   Node* is_CmpD_candidate(Node* nd) const; // otherwise return NULL
   Node_List* make_cmovevd_pack(Node_List* cmovd_pk);
   bool test_cmpd_pack(Node_List* cmpd_pk, Node_List* cmovd_pk);
+  bool test_cmpi_pack(Node_List* cmpi_pk, Node_List* cmovi_pk);
 };//class CMoveKit
 
 // JVMCI: OrderedPair is moved up to deal with compilation issues on Windows
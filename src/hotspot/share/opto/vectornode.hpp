@@ -28,6 +28,7 @@
 #include "opto/memnode.hpp"
 #include "opto/node.hpp"
 #include "opto/opcodes.hpp"
+#include "opto/subnode.hpp"
 
 //------------------------------VectorNode-------------------------------------
 // Vector Operation
@@ -301,6 +302,24 @@ public:
   virtual int Opcode() const;
 };
 
+//------------------------------VectorMaskCmpNode--------------------------------
+// Vector lane-wise compare producing an all-ones/all-zeros mask per lane.
+// The third input is a ConI holding the BoolTest::mask of the comparison.
+class VectorMaskCmpNode : public VectorNode {
+public:
+  VectorMaskCmpNode(Node* in1, Node* in2, ConINode* cond, const TypeVect* vt) : VectorNode(in1, in2, (Node*)cond, vt) {}
+  BoolTest::mask get_predicate() const { return (BoolTest::mask)in(3)->get_int(); }
+  virtual int Opcode() const;
+};
+
+//------------------------------VectorBlendNode----------------------------------
+// Vector lane-wise select: lanes whose mask is set take vec2, others vec1.
+class VectorBlendNode : public VectorNode {
+public:
+  VectorBlendNode(Node* vec1, Node* vec2, Node* mask, const TypeVect* vt) : VectorNode(vec1, vec2, mask, vt) {}
+  virtual int Opcode() const;
+};
+
 //------------------------------MulReductionVINode--------------------------------------
 // Vector multiply int as a reduction
 class MulReductionVINode : public ReductionNode {
@@ -70,6 +70,7 @@
 #include "runtime/timerTrace.hpp"
 #include "runtime/vframe.inline.hpp"
 #include "runtime/vmThread.hpp"
+#include "services/allocationProfiler.hpp"
 #include "services/threadService.hpp"
 #include "utilities/exceptions.hpp"
 #include "utilities/preserveException.hpp"
@@ -543,7 +544,7 @@ JvmtiEnv::SetEventNotificationMode(jvmtiEventMode mode, jvmtiEvent event_type, j
     if (event_type == JVMTI_EVENT_SAMPLED_OBJECT_ALLOC) {
       if (enabled) {
         ThreadHeapSampler::enable();
-      } else {
+      } else if (!AllocationProfiler::is_enabled()) {
         ThreadHeapSampler::disable();
       }
     }
@@ -34,6 +34,7 @@
 #include "runtime/basicLock.hpp"
 #include "runtime/biasedLocking.hpp"
 #include "runtime/handles.inline.hpp"
+#include "runtime/handshake.hpp"
 #include "runtime/task.hpp"
 #include "runtime/threadSMR.hpp"
 #include "runtime/vframe.hpp"
@@ -584,6 +585,77 @@ public:
   }
 };
 
+// Revokes the bias of a single object by stopping only the thread the
+// object is biased toward. The closure runs either in the biased thread
+// itself or in the VM thread while the biased thread is blocked, so the
+// biased thread's stack can be walked without a global safepoint.
+class RevokeOneBias : public ThreadClosure {
+ private:
+  Handle _obj;
+  JavaThread* _requesting_thread;
+  JavaThread* _biased_locker;
+  bool _revoked;
+  BiasedLocking::Condition _status_code;
+  traceid _biased_locker_id;
+
+ public:
+  RevokeOneBias(Handle obj, JavaThread* requesting_thread, JavaThread* biased_locker)
+    : _obj(obj)
+    , _requesting_thread(requesting_thread)
+    , _biased_locker(biased_locker)
+    , _revoked(false)
+    , _status_code(BiasedLocking::NOT_BIASED)
+    , _biased_locker_id(0) {}
+
+  void do_thread(Thread* target) {
+    assert(target == _biased_locker, "wrong thread");
+    oop o = _obj();
+    markOop mark = o->mark();
+    if (!mark->has_bias_pattern()) {
+      // Somebody else revoked the bias in the meantime
+      _revoked = true;
+      return;
+    }
+    markOop prototype_header = o->klass()->prototype_header();
+    if (!prototype_header->has_bias_pattern()) {
+      // Stale bias from a bulk revocation that happened before the
+      // handshake was processed; other threads may race us with a CAS.
+      markOop biased_value = mark;
+      markOop res_mark = o->cas_set_mark(prototype_header, mark);
+      assert(!o->mark()->has_bias_pattern(), "even if we raced, should still be revoked");
+      _status_code = (res_mark == biased_value) ? BiasedLocking::BIAS_REVOKED : BiasedLocking::NOT_BIASED;
+      _revoked = true;
+      return;
+    }
+    if (mark->biased_locker() == _biased_locker &&
+        mark->bias_epoch() == prototype_header->bias_epoch()) {
+      // The bias is still valid, so only the stopped biased thread could
+      // touch the header and no other thread can CAS it.
+      ResourceMark rm;
+      log_info(biasedlocking)("Revoking bias with handshake:");
+      _status_code = revoke_bias(o, false, false, _requesting_thread, NULL);
+      _biased_locker->set_cached_monitor_info(NULL);
+      assert(!o->mark()->has_bias_pattern(), "invariant");
+      _biased_locker_id = JFR_THREAD_ID(_biased_locker);
+      _revoked = true;
+    }
+    // Otherwise the object was rebiased or became anonymously biased;
+    // leave it to the safepoint based revocation.
+  }
+
+  bool revoked() const {
+    return _revoked;
+  }
+
+  BiasedLocking::Condition status_code() const {
+    return _status_code;
+  }
+
+  traceid biased_locker() const {
+    return _biased_locker_id;
+  }
+};
+
 template <typename E>
 static void set_safepoint_id(E* event) {
   assert(event != NULL, "invariant");
@@ -610,6 +682,43 @@ static void post_revocation_event(EventBiasedLockRevocation* event, Klass* k, VM
   event->commit();
 }
 
+static void post_revocation_event(EventBiasedLockRevocation* event, Klass* k, RevokeOneBias* revoke) {
+  assert(event != NULL, "invariant");
+  assert(k != NULL, "invariant");
+  assert(revoke != NULL, "invariant");
+  assert(event->should_commit(), "invariant");
+  event->set_lockClass(k);
+  event->set_safepointId(0);
+  event->set_previousOwner(revoke->biased_locker());
+  event->commit();
+}
+
+// Try to revoke the bias of obj by handshaking only with the thread it is
+// biased toward. Returns false if the bias could not be revoked that way.
+static bool single_revoke_with_handshake(Handle obj, JavaThread* requester, BiasedLocking::Condition* status_code) {
+  if (!BiasedLockingRevokeWithHandshake || !ThreadLocalHandshakes) {
+    return false;
+  }
+  markOop mark = obj->mark();
+  JavaThread* biaser = mark->has_bias_pattern() ? mark->biased_locker() : NULL;
+  if (biaser == NULL || biaser == requester) {
+    return false;
+  }
+
+  EventBiasedLockRevocation event;
+  RevokeOneBias revoke(obj, requester, biaser);
+  bool executed = Handshake::execute(&revoke, biaser);
+  if (!executed || !revoke.revoked()) {
+    // The biased thread exited or the bias changed under us
+    return false;
+  }
+  if (event.should_commit() && revoke.status_code() != BiasedLocking::NOT_BIASED) {
+    post_revocation_event(&event, obj->klass(), &revoke);
+  }
+  *status_code = revoke.status_code();
+  return true;
+}
+
 static void post_class_revocation_event(EventBiasedLockClassRevocation* event, Klass* k, bool disabled_bias) {
   assert(event != NULL, "invariant");
   assert(k != NULL, "invariant");
@@ -710,6 +819,10 @@ BiasedLocking::Condition BiasedLocking::revoke_and_rebias(Handle obj, bool attem
       }
       return cond;
     } else {
+      BiasedLocking::Condition cond;
+      if (single_revoke_with_handshake(obj, (JavaThread*) THREAD, &cond)) {
+        return cond;
+      }
       EventBiasedLockRevocation event;
       VM_RevokeBias revoke(&obj, (JavaThread*) THREAD);
       VMThread::execute(&revoke);
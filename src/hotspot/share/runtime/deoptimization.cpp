@@ -30,6 +30,7 @@
 #include "code/nmethod.hpp"
 #include "code/pcDesc.hpp"
 #include "code/scopeDesc.hpp"
+#include "gc/shared/memAllocator.hpp"
 #include "interpreter/bytecode.hpp"
 #include "interpreter/interpreter.hpp"
 #include "interpreter/oopMapCache.hpp"
@@ -786,12 +787,80 @@ Deoptimization::DeoptAction Deoptimization::_unloaded_action
   = Deoptimization::Action_reinterpret;
 
 #if COMPILER2_OR_JVMCI
+// Returns the size in words of the reallocated object for sv, or 0 if it
+// has to be allocated through its klass, e.g. to register a finalizer.
+static size_t realloc_object_size(Klass* k, ObjectValue* sv) {
+  if (k->is_instance_klass()) {
+    InstanceKlass* ik = InstanceKlass::cast(k);
+    if (ik->has_finalizer() || ik->is_mirror_instance_klass() ||
+        Klass::layout_helper_needs_slow_path(ik->layout_helper())) {
+      return 0;
+    }
+    return (size_t)ik->size_helper();
+  } else if (k->is_typeArray_klass()) {
+    TypeArrayKlass* ak = TypeArrayKlass::cast(k);
+    int len = sv->field_size() / type2size[ak->element_type()];
+    return (size_t)ak->array_size(len);
+  } else if (k->is_objArray_klass()) {
+    return (size_t)objArrayOopDesc::object_size(sv->field_size());
+  }
+  return 0;
+}
+
+// Reallocates all objects from a single TLAB span, initializing them one
+// after the other without further allocation checks. Returns false, without
+// allocating anything, if that is not possible.
+bool Deoptimization::realloc_objects_in_tlab_span(JavaThread* thread, GrowableArray<ScopeValue*>* objects) {
+  size_t total_size = 0;
+  for (int i = 0; i < objects->length(); i++) {
+    assert(objects->at(i)->is_object(), "invalid debug information");
+    ObjectValue* sv = (ObjectValue*) objects->at(i);
+    Klass* k = java_lang_Class::as_Klass(sv->klass()->as_ConstantOopReadValue()->value()());
+    size_t size = realloc_object_size(k, sv);
+    if (size == 0) {
+      return false;
+    }
+    total_size += size;
+  }
+
+  HeapWord* mem = MemAllocator::allocate_span_in_tlab(thread, total_size);
+  if (mem == NULL) {
+    return false;
+  }
+
+  for (int i = 0; i < objects->length(); i++) {
+    ObjectValue* sv = (ObjectValue*) objects->at(i);
+    Klass* k = java_lang_Class::as_Klass(sv->klass()->as_ConstantOopReadValue()->value()());
+    size_t size = realloc_object_size(k, sv);
+    oop obj;
+    if (k->is_instance_klass()) {
+      obj = ObjAllocator(k, size, thread).initialize(mem);
+    } else if (k->is_typeArray_klass()) {
+      int len = sv->field_size() / type2size[TypeArrayKlass::cast(k)->element_type()];
+      obj = ObjArrayAllocator(k, size, len, /* do_zero */ true, thread).initialize(mem);
+    } else {
+      obj = ObjArrayAllocator(k, size, sv->field_size(), /* do_zero */ true, thread).initialize(mem);
+    }
+    assert(sv->value().is_null(), "redundant reallocation");
+    sv->set_value(obj);
+    mem += size;
+  }
+  return true;
+}
+
 bool Deoptimization::realloc_objects(JavaThread* thread, frame* fr, GrowableArray<ScopeValue*>* objects, TRAPS) {
   Handle pending_exception(THREAD, thread->pending_exception());
   const char* exception_file = thread->exception_file();
   int exception_line = thread->exception_line();
   thread->clear_pending_exception();
 
+  if (realloc_objects_in_tlab_span(thread, objects)) {
+    if (pending_exception.not_null()) {
+      thread->set_pending_exception(pending_exception(), exception_file, exception_line);
+    }
+    return false;
+  }
+
   bool failures = false;
 
   for (int i = 0; i < objects->length(); i++) {
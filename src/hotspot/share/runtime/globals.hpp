@@ -656,6 +656,12 @@ define_pd_global(uint64_t,MaxRAM,                    1ULL*G);
           "directory) of the dump file (defaults to java_pid<pid>.hprof "   \
           "in the working directory)")                                      \
                                                                             \
+  manageable(intx, HeapDumpGzipLevel, 0,                                    \
+          "When set to a value between 1 and 9 heap dumps are written in "  \
+          "gzipped format using the given compression level (1 is the "     \
+          "fastest, 9 the strongest compression)")                          \
+          range(0, 9)                                                       \
+                                                                            \
   develop(bool, BreakAtWarning, false,                                      \
           "Execute breakpoint upon encountering VM warning")                \
                                                                             \
@@ -858,6 +864,13 @@ define_pd_global(uint64_t,MaxRAM,                    1ULL*G);
                 "The check is performed on GuaranteedSafepointInterval.")   \
                 range(0, 100)                                               \
                                                                             \
+  experimental(intx, MonitorDeflationInterval, 0,                           \
+                "Minimum time in ms between safepoints that deflate idle "  \
+                "monitors (0 deflates at every safepoint). Monitors are "   \
+                "still deflated when MonitorUsedDeflationThreshold is "     \
+                "exceeded")                                                 \
+                range(0, max_jint)                                          \
+                                                                            \
   experimental(intx, SyncFlags, 0, "(Unsafe, Unstable) "                    \
                "Experimental Sync flags")                                   \
                                                                             \
@@ -984,6 +997,11 @@ define_pd_global(uint64_t,MaxRAM,                    1ULL*G);
           range(500, max_intx)                                              \
           constraint(BiasedLockingDecayTimeFunc,AfterErgo)                  \
                                                                             \
+  product(bool, BiasedLockingRevokeWithHandshake, true,                     \
+          "Revoke the bias of a single object by handshaking with the "     \
+          "thread it is biased toward instead of with a safepoint. "        \
+          "Requires ThreadLocalHandshakes")                                 \
+                                                                            \
   product(bool, ExitOnOutOfMemoryError, false,                              \
           "JVM exits on the first occurrence of an out-of-memory error")    \
                                                                             \
@@ -1045,6 +1063,12 @@ define_pd_global(uint64_t,MaxRAM,                    1ULL*G);
   develop(bool, TraceICBuffer, false,                                       \
           "Trace usage of IC buffer")                                       \
                                                                             \
+  product(uintx, InlineCacheBufferSize, 10*K,                               \
+          "Size of the buffer holding inline cache transition stubs. "      \
+          "A full buffer forces a safepoint to patch the pending stubs "    \
+          "back into their call sites")                                     \
+          range(1*K, 1*M)                                                   \
+                                                                            \
   develop(bool, TraceCompiledIC, false,                                     \
           "Trace changes of compiled IC")                                   \
                                                                             \
@@ -1108,6 +1132,12 @@ define_pd_global(uint64_t,MaxRAM,                    1ULL*G);
   product(bool, CITime, false,                                              \
           "collect timing information for compilation")                     \
                                                                             \
+  product(uintx, CompilerThreadChunkCacheSize, 64,                          \
+          "Maximum number of arena chunks a compiler thread keeps for its " \
+          "next compilations instead of returning them to the global "      \
+          "chunk pool (0 disables the cache)")                              \
+          range(0, 4096)                                                    \
+                                                                            \
   develop(bool, CITimeVerbose, false,                                       \
           "be more verbose in compilation timings")                         \
                                                                             \
@@ -1207,6 +1237,17 @@ define_pd_global(uint64_t,MaxRAM,                    1ULL*G);
   diagnostic(bool, EnableThreadSMRStatistics, trueInDebug,                  \
              "Enable Thread SMR Statistics")                                \
                                                                             \
+  product(bool, LockContentionProfiling, false,                             \
+          "Record how often and how long threads block on the named VM "    \
+          "locks; see the VM.lock_stats diagnostic command")                \
+                                                                            \
+  experimental(uintx, ThreadSMRFreeListBatchSize, 1,                        \
+          "Number of retired ThreadsLists to accumulate before "            \
+          "scanning hazard pointers to free them. Larger values reduce "    \
+          "Threads_lock hold time in Threads::add/remove with very "        \
+          "many threads at the cost of retaining more memory")              \
+          range(1, 1024)                                                    \
+                                                                            \
   product(bool, Inline, true,                                               \
           "Enable inlining")                                                \
                                                                             \
@@ -1301,6 +1342,11 @@ define_pd_global(uint64_t,MaxRAM,                    1ULL*G);
           "If LogVMOutput or LogCompilation is on, save VM output to "      \
           "this file [default: ./hotspot_pid%p.log] (%p replaced with pid)")\
                                                                             \
+  product(size_t, AsyncLogBufferSize, 2*M,                                  \
+          "Memory budget (in bytes) for the buffer of asynchronous "        \
+          "logging (-Xlog:async)")                                          \
+          range(100*K, 50*M)                                                \
+                                                                            \
   product(ccstr, ErrorFile, NULL,                                           \
           "If an error occurs, save the error data to this file "           \
           "[default: ./hs_err_pid%p.log] (%p replaced with pid)")           \
@@ -1518,6 +1564,14 @@ define_pd_global(uint64_t,MaxRAM,                    1ULL*G);
   product_pd(bool, ProfileInterpreter,                                      \
           "Profile at the bytecode level during interpretation")            \
                                                                             \
+  product(intx, InterpreterProfileSampleRate, 1,                            \
+          "Update the counters of MDOs from the interpreter only every "    \
+          "n-th time a profiled bytecode is executed by a thread; the "     \
+          "counters are then advanced by n. Reduces cache line "            \
+          "contention on the MDOs of hot methods. Only supported on "       \
+          "x86_64 and aarch64")                                             \
+          range(1, 1024)                                                    \
+                                                                            \
   develop(bool, TraceProfileInterpreter, false,                             \
           "Trace profiling at the bytecode level during interpretation. "   \
           "This outputs the profiling information collected to improve "    \
@@ -1866,6 +1920,10 @@ define_pd_global(uint64_t,MaxRAM,                    1ULL*G);
           "The maximum expansion of Metaspace without full GC (in bytes)")  \
           range(0, max_uintx)                                               \
                                                                             \
+  product(bool, MetaspaceReclaimFreeChunks, false,                          \
+          "Return the physical memory of free medium and humongous "        \
+          "Metaspace chunks to the operating system")                       \
+                                                                            \
   /* stack parameters */                                                    \
   product_pd(intx, StackYellowPages,                                        \
           "Number of yellow zone (recoverable overflows) pages of size "    \
@@ -1964,6 +2022,17 @@ define_pd_global(uint64_t,MaxRAM,                    1ULL*G);
   product(bool, UseCodeCacheFlushing, true,                                 \
           "Remove cold/old nmethods from the code cache")                   \
                                                                             \
+  product(bool, CodeCacheRelocateHotMethods, false,                         \
+          "Make hot C2-compiled nmethods that lie above a free block of "   \
+          "their code heap large enough to hold them not entrant, so "      \
+          "that their recompilation moves them to lower addresses and "     \
+          "the hot code stays clustered")                                   \
+                                                                            \
+  product(intx, CodeCacheRelocateHotMethodsLimit, 4,                        \
+          "Maximum number of nmethods made not entrant for relocation "     \
+          "per sweep")                                                      \
+          range(1, max_intx)                                                \
+                                                                            \
   product(uintx, StartAggressiveSweepingAt, 10,                             \
           "Start aggressive sweeping if X[%] of the code cache is free."    \
           "Segmented code cache: X[%] of the non-profiled heap."            \
@@ -1980,6 +2049,11 @@ define_pd_global(uint64_t,MaxRAM,                    1ULL*G);
   experimental(bool, PrintAOT, false,                                       \
           "Print used AOT klasses and methods")                             \
                                                                             \
+  experimental(bool, AOTLazyMethodLinking, false,                           \
+          "Publish the AOT code of a method when the interpreter first "    \
+          "reports an invocation of it instead of when its class is "       \
+          "loaded")                                                         \
+                                                                            \
   notproduct(bool, PrintAOTStatistics, false,                               \
           "Print AOT statistics")                                           \
                                                                             \
@@ -2027,6 +2101,23 @@ define_pd_global(uint64_t,MaxRAM,                    1ULL*G);
   product(ccstr, CompileCommandFile, NULL,                                  \
           "Read compiler commands from this file [.hotspot_compiler]")      \
                                                                             \
+  product(ccstr, CompileWarmupFile, NULL,                                   \
+          "Read the methods that were compiled at tier 3 or above in an "   \
+          "earlier run from this file and compile them as soon as they "    \
+          "are executed")                                                   \
+                                                                            \
+  product(ccstr, DumpCompileWarmupFile, NULL,                               \
+          "At exit, write the methods compiled at tier 3 or above to this " \
+          "file for use with CompileWarmupFile")                            \
+                                                                            \
+  product(ccstr, ClassPreloadList, NULL,                                    \
+          "Load and link the classes named in this class list on "          \
+          "background threads during startup")                              \
+                                                                            \
+  product(uintx, ClassPreloadThreads, 2,                                    \
+          "Number of threads used to preload ClassPreloadList")             \
+          range(1, 64)                                                      \
+                                                                            \
   diagnostic(ccstr, CompilerDirectivesFile, NULL,                           \
           "Read compiler directives from this file")                        \
                                                                             \
@@ -2327,6 +2418,13 @@ define_pd_global(uint64_t,MaxRAM,                    1ULL*G);
           "given timeout in milliseconds")                                  \
           range(0, max_intx)                                                \
                                                                             \
+  product(intx, TieredCompileTaskAgingTime, 0,                              \
+          "Raise the priority of a queued compile task by its own weight "  \
+          "for every given number of milliseconds it has been waiting, "    \
+          "so that lukewarm methods are not starved by hotter ones. "       \
+          "0 disables aging")                                               \
+          range(0, max_intx)                                                \
+                                                                            \
   product(intx, TieredStopAtLevel, 4,                                       \
           "Stop at given compilation level")                                \
           range(0, 4)                                                       \
@@ -2608,6 +2706,15 @@ define_pd_global(uint64_t,MaxRAM,                    1ULL*G);
   product(ccstr, ExtraSharedClassListFile, NULL,                            \
           "Extra classlist for building the CDS archive file")              \
                                                                             \
+  product(bool, ArchiveResolvedClassEntries, false,                         \
+          "When dumping the CDS archive, keep constant pool class entries " \
+          "that refer to the class itself or its supertypes resolved")      \
+                                                                            \
+  product(ccstr, ArchiveClassesAtExit, NULL,                                \
+          "At exit, create a CDS archive with the classes loaded by the "   \
+          "builtin class loaders in this file, for later use with "         \
+          "SharedArchiveFile")                                              \
+                                                                            \
   experimental(size_t, ArrayAllocatorMallocLimit,                           \
           SOLARIS_ONLY(64*K) NOT_SOLARIS((size_t)-1),                       \
           "Allocation less than this value will be allocated "              \
@@ -2664,6 +2771,17 @@ define_pd_global(uint64_t,MaxRAM,                    1ULL*G);
   diagnostic(bool, UseSwitchProfiling, true,                                \
           "leverage profiling for table/lookup switch")                     \
                                                                             \
+  product(bool, AllocationProfiling, false,                                 \
+          "Aggregate sampled allocations by allocation site in the VM. "    \
+          "The sites are printed with the VM.alloc_profile diagnostic "     \
+          "command")                                                        \
+                                                                            \
+  product(intx, AllocationProfilingInterval, 512*K,                         \
+          "Average number of bytes allocated between two samples of the "   \
+          "allocation profiler. Shared with the JVMTI heap sampling "       \
+          "interval")                                                       \
+          range(1, max_jint)                                                \
+                                                                            \
   JFR_ONLY(product(bool, FlightRecorder, false,                             \
           "Enable Flight Recorder"))                                        \
                                                                             \
@@ -2673,6 +2791,11 @@ define_pd_global(uint64_t,MaxRAM,                    1ULL*G);
   JFR_ONLY(product(ccstr, StartFlightRecording, NULL,                       \
           "Start flight recording with options"))                           \
                                                                             \
+  JFR_ONLY(experimental(uintx, JfrMaxJavaSamplesPerPeriod, 5,               \
+          "Maximum number of Java threads the execution sampler samples "   \
+          "per sampling period")                                            \
+          range(1, 64))                                                     \
+                                                                            \
   experimental(bool, UseFastUnorderedTimeStamps, false,                     \
           "Use platform unstable time where supported for timestamps only")
 
@@ -68,6 +68,7 @@ void InterfaceSupport_init();
 void universe2_init();  // dependent on codeCache_init and stubRoutines_init, loads primordial classes
 void referenceProcessor_init();
 void jni_handles_init();
+void allocationProfiler_init();
 void vmStructs_init();
 
 void vtableStubs_init();
@@ -125,6 +126,7 @@ jint init_globals() {
   javaClasses_init();// must happen after vtable initialization, before referenceProcessor_init
   referenceProcessor_init();
   jni_handles_init();
+  allocationProfiler_init();
 #if INCLUDE_VM_STRUCTS
   vmStructs_init();
 #endif // INCLUDE_VM_STRUCTS
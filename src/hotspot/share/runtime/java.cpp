@@ -30,6 +30,7 @@
 #include "classfile/systemDictionary.hpp"
 #include "code/codeCache.hpp"
 #include "compiler/compileBroker.hpp"
+#include "compiler/compileWarmup.hpp"
 #include "compiler/compilerOracle.hpp"
 #include "interpreter/bytecodeHistogram.hpp"
 #include "jfr/jfrEvents.hpp"
@@ -40,6 +41,7 @@
 #endif
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
+#include "memory/archiveAtExit.hpp"
 #include "memory/oopFactory.hpp"
 #include "memory/resourceArea.hpp"
 #include "memory/universe.hpp"
@@ -502,6 +504,16 @@ void before_exit(JavaThread* thread) {
     BytecodeHistogram::print();
   }
 
+  if (DumpCompileWarmupFile != NULL) {
+    CompileWarmup::dump(DumpCompileWarmupFile, NULL);
+  }
+
+#if INCLUDE_CDS
+  if (ArchiveClassesAtExit != NULL) {
+    ArchiveAtExit::dump(ArchiveClassesAtExit);
+  }
+#endif
+
   if (JvmtiExport::should_post_thread_life()) {
     JvmtiExport::post_thread_end(thread);
   }
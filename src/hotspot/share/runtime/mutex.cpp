@@ -908,6 +908,7 @@ void Monitor::lock(Thread * Self) {
   // Try a brief spin to avoid passing thru thread state transition ...
   if (TrySpin(Self)) goto Exeunt;
 
+  const jlong contended_start = LockContentionProfiling ? os::elapsed_counter() : 0;
   check_block_state(Self);
   if (Self->is_Java_thread()) {
     // Horrible dictu - we suffer through a state transition
@@ -918,6 +919,9 @@ void Monitor::lock(Thread * Self) {
     // Mirabile dictu
     ILock(Self);
   }
+  if (contended_start != 0) {
+    record_contention(contended_start);
+  }
   goto Exeunt;
 }
 
@@ -935,11 +939,24 @@ void Monitor::lock_without_safepoint_check(Thread * Self) {
   assert(_safepoint_check_required != Monitor::_safepoint_check_always,
          "This lock should always have a safepoint check: %s", name());
   assert(_owner != Self, "invariant");
-  ILock(Self);
+  if (!LockContentionProfiling) {
+    ILock(Self);
+  } else if (!TryFast()) {
+    const jlong contended_start = os::elapsed_counter();
+    ILock(Self);
+    record_contention(contended_start);
+  }
   assert(_owner == NULL, "invariant");
   set_owner(Self);
 }
 
+// Called with the lock held after a blocking acquisition.
+void Monitor::record_contention(jlong start_ticks) {
+  assert(ILocked(), "invariant");
+  Atomic::inc(&_contended_count);
+  Atomic::add(os::elapsed_counter() - start_ticks, &_contended_ticks);
+}
+
 void Monitor::lock_without_safepoint_check() {
   lock_without_safepoint_check(Thread::current());
 }
@@ -1163,6 +1180,8 @@ void Monitor::ClearMonitor(Monitor * m, const char *name) {
   m->_OnDeck            = NULL;
   m->_WaitSet           = NULL;
   m->_WaitLock[0]       = 0;
+  m->_contended_count   = 0;
+  m->_contended_ticks   = 0;
 }
 
 Monitor::Monitor() { ClearMonitor(this); }
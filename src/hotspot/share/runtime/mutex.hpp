@@ -135,6 +135,10 @@ class Monitor : public CHeapObj<mtSynchronizer> {
   volatile bool     _snuck;              // Used for sneaky locking (evil).
   char _name[MONITOR_NAME_LEN];          // Name of mutex
 
+  // Contention statistics, only maintained with LockContentionProfiling
+  volatile jlong _contended_count;       // Number of blocking acquisitions
+  volatile jlong _contended_ticks;       // Elapsed counter ticks spent blocked
+
   // Debugging fields for naming, deadlock detection, etc. (some only used in debug mode)
 #ifndef PRODUCT
   bool      _allow_vm_block;
@@ -191,6 +195,7 @@ class Monitor : public CHeapObj<mtSynchronizer> {
    void ILock (Thread * Self) ;
    int  IWait (Thread * Self, jlong timo);
    int  ILocked () ;
+   void record_contention (jlong start_ticks) ;
 
  protected:
    static void ClearMonitor (Monitor * m, const char* name = NULL) ;
@@ -235,6 +240,11 @@ class Monitor : public CHeapObj<mtSynchronizer> {
   void jvm_raw_unlock();
   const char *name() const                  { return _name; }
 
+  // Contention statistics (see LockContentionProfiling)
+  jlong contended_count() const             { return _contended_count; }
+  jlong contended_ticks() const             { return _contended_ticks; }
+  void  reset_contention_stats()            { _contended_count = 0; _contended_ticks = 0; }
+
   void print_on_error(outputStream* st) const;
 
   #ifndef PRODUCT
@@ -27,6 +27,7 @@
 #include "runtime/os.inline.hpp"
 #include "runtime/safepoint.hpp"
 #include "runtime/thread.inline.hpp"
+#include "runtime/timer.hpp"
 #include "runtime/vmThread.hpp"
 
 // Mutexes used in the VM (see comment in mutexLocker.hpp):
@@ -133,6 +134,7 @@ Monitor* PeriodicTask_lock            = NULL;
 Monitor* RedefineClasses_lock         = NULL;
 
 Mutex*   ThreadHeapSampler_lock       = NULL;
+Mutex*   AllocationProfiler_lock      = NULL;
 
 #if INCLUDE_JFR
 Mutex*   JfrStacktrace_lock           = NULL;
@@ -313,6 +315,7 @@ void mutex_init() {
   def(RedefineClasses_lock         , PaddedMonitor, nonleaf+5,   true,  Monitor::_safepoint_check_always);
 
   def(ThreadHeapSampler_lock       , PaddedMutex,   nonleaf,     false, Monitor::_safepoint_check_never);
+  def(AllocationProfiler_lock      , PaddedMutex,   leaf,        true,  Monitor::_safepoint_check_never);
 
   if (WhiteBoxAPI) {
     def(Compilation_lock           , PaddedMonitor, leaf,        false, Monitor::_safepoint_check_never);
@@ -362,3 +365,42 @@ void print_owned_locks_on_error(outputStream* st) {
   }
   if (none) st->print_cr("None");
 }
+
+// Print the contention statistics of the named VM locks, most contended
+// first; called by the VM.lock_stats diagnostic command.
+void print_lock_contention_stats_on(outputStream* st, bool reset) {
+  Monitor* sorted[MAX_NUM_MUTEX];
+  int count = 0;
+  for (int i = 0; i < _num_mutex; i++) {
+    Monitor* m = _mutex_array[i];
+    if (m->contended_count() == 0) {
+      continue;
+    }
+    // Insertion sort by time spent blocked, descending.
+    int j = count++;
+    while (j > 0 && sorted[j - 1]->contended_ticks() < m->contended_ticks()) {
+      sorted[j] = sorted[j - 1];
+      j--;
+    }
+    sorted[j] = m;
+  }
+
+  st->print_cr("%-32s %12s %14s %12s", "Lock", "Contended", "Blocked (ms)", "Avg (us)");
+  for (int i = 0; i < count; i++) {
+    const Monitor* m = sorted[i];
+    const jlong ticks = m->contended_ticks();
+    const jlong n = m->contended_count();
+    st->print_cr("%-32s " INT64_FORMAT_W(12) " %14.3f %12.3f", m->name(), (int64_t)n,
+                 TimeHelper::counter_to_millis(ticks),
+                 TimeHelper::counter_to_millis(ticks) * 1000.0 / n);
+  }
+  if (count == 0) {
+    st->print_cr("No contended VM locks recorded");
+  }
+
+  if (reset) {
+    for (int i = 0; i < _num_mutex; i++) {
+      _mutex_array[i]->reset_contention_stats();
+    }
+  }
+}
@@ -133,6 +133,7 @@ extern Monitor* PeriodicTask_lock;               // protects the periodic task s
 extern Mutex*   ThreadIdTableCreate_lock;        // Used by ThreadIdTable to lazily create the thread id table
 extern Monitor* RedefineClasses_lock;            // locks classes from parallel redefinition
 extern Mutex*   ThreadHeapSampler_lock;          // protects the static data for initialization.
+extern Mutex*   AllocationProfiler_lock;         // protects the allocation site table of the AllocationProfiler
 
 #if INCLUDE_JFR
 extern Mutex*   JfrStacktrace_lock;              // used to guard access to the JFR stacktrace table
@@ -168,6 +169,7 @@ extern Monitor* CodeHeapStateAnalytics_lock;     // lock print functions against
 // Print all mutexes/monitors that are currently owned by a thread; called
 // by fatal error handler.
 void print_owned_locks_on_error(outputStream* st);
+void print_lock_contention_stats_on(outputStream* st, bool reset);
 
 char *lock_name(Mutex *mutex);
 
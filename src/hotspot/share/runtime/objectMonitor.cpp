@@ -129,7 +129,9 @@ static int Knob_UsePause            = 1;
 static int Knob_ExitPolicy          = 0;
 static int Knob_PreSpin             = 10;      // 20-100 likely better
 static int Knob_ResetEvent          = 0;
+static int Knob_RemoteSpinBackOff   = 4;       // backoff when owner is on another NUMA node
 static int BackOffMask              = 0;
+static int RemoteBackOffMask        = 0;
 
 static int Knob_FastHSSEC           = 0;
 static int Knob_MoveNotifyee        = 2;       // notify() - disposition of notifyee
@@ -416,6 +418,7 @@ void ObjectMonitor::enter(TRAPS) {
     event.commit();
   }
   OM_PERFDATA_OP(ContendedLockAttempts, inc());
+  _owner_lgrp = Self->lgrp_id();
 }
 
 // Caveat: TryLock() is not necessarily serializing if it returns failure.
@@ -1887,6 +1890,7 @@ int ObjectMonitor::TrySpin(Thread * Self) {
         if (x < Knob_Poverty) x = Knob_Poverty;
         _SpinDuration = x + Knob_BonusB;
       }
+      OM_PERFDATA_OP(SpinAcquires, inc());
       return 1;
     }
     SpinPause();
@@ -1938,6 +1942,10 @@ int ObjectMonitor::TrySpin(Thread * Self) {
   if (sss && _succ == NULL) _succ = Self;
   Thread * prv = NULL;
 
+  // Probe _owner less often if the lock was last taken on another NUMA
+  // node: the cache line has to cross the interconnect on every probe.
+  int rmsk = (_owner_lgrp != Self->lgrp_id()) ? RemoteBackOffMask : 0;
+
   // There are three ways to exit the following loop:
   // 1.  A successful spin where this thread has acquired the lock.
   // 2.  Spin failure with prejudice
@@ -1979,7 +1987,7 @@ int ObjectMonitor::TrySpin(Thread * Self) {
     // coherency bandwidth.  Relatedly, if we _oversample _owner we
     // can inadvertently interfere with the the ST m->owner=null.
     // executed by the lock owner.
-    if (ctr & msk) continue;
+    if (ctr & (msk | rmsk)) continue;
     ++hits;
     if ((hits & 0xF) == 0) {
       // The 0xF, above, corresponds to the exponent.
@@ -2020,6 +2028,8 @@ int ObjectMonitor::TrySpin(Thread * Self) {
           if (x < Knob_Poverty) x = Knob_Poverty;
           _SpinDuration = x + Knob_Bonus;
         }
+        _owner_lgrp = Self->lgrp_id();
+        OM_PERFDATA_OP(SpinAcquires, inc());
         return 1;
       }
 
@@ -2080,8 +2090,12 @@ int ObjectMonitor::TrySpin(Thread * Self) {
     // in the normal usage of TrySpin(), but it's safest
     // to make TrySpin() as foolproof as possible.
     OrderAccess::fence();
-    if (TryLock(Self) > 0) return 1;
+    if (TryLock(Self) > 0) {
+      OM_PERFDATA_OP(SpinAcquires, inc());
+      return 1;
+    }
   }
+  OM_PERFDATA_OP(SpinFailures, inc());
   return 0;
 }
 
@@ -2230,13 +2244,15 @@ inline void ObjectMonitor::DequeueSpecificWaiter(ObjectWaiter* node) {
 
 // -----------------------------------------------------------------------------
 // PerfData support
-PerfCounter * ObjectMonitor::_sync_ContendedLockAttempts       = NULL;
-PerfCounter * ObjectMonitor::_sync_FutileWakeups               = NULL;
-PerfCounter * ObjectMonitor::_sync_Parks                       = NULL;
-PerfCounter * ObjectMonitor::_sync_Notifications               = NULL;
-PerfCounter * ObjectMonitor::_sync_Inflations                  = NULL;
-PerfCounter * ObjectMonitor::_sync_Deflations                  = NULL;
-PerfLongVariable * ObjectMonitor::_sync_MonExtant              = NULL;
+PerfStripedCounter * ObjectMonitor::_sync_ContendedLockAttempts      = NULL;
+PerfStripedCounter * ObjectMonitor::_sync_FutileWakeups              = NULL;
+PerfStripedCounter * ObjectMonitor::_sync_Parks                      = NULL;
+PerfStripedCounter * ObjectMonitor::_sync_Notifications              = NULL;
+PerfStripedCounter * ObjectMonitor::_sync_Inflations                 = NULL;
+PerfCounter * ObjectMonitor::_sync_Deflations                        = NULL;
+PerfStripedCounter * ObjectMonitor::_sync_SpinAcquires               = NULL;
+PerfStripedCounter * ObjectMonitor::_sync_SpinFailures               = NULL;
+PerfLongVariable * ObjectMonitor::_sync_MonExtant                    = NULL;
 
 // One-shot global initialization for the sync subsystem.
 // We could also defer initialization and initialize on-demand
@@ -2254,19 +2270,27 @@ void ObjectMonitor::Initialize() {
     n = PerfDataManager::create_counter(SUN_RT, #n, PerfData::U_Events,  \
                                         CHECK);                          \
   }
+#define NEWPERFSTRIPEDCOUNTER(n)                                               \
+  {                                                                            \
+    n = PerfDataManager::create_striped_counter(SUN_RT, #n,                    \
+                                                PerfData::U_Events, CHECK);    \
+  }
 #define NEWPERFVARIABLE(n)                                                \
   {                                                                       \
     n = PerfDataManager::create_variable(SUN_RT, #n, PerfData::U_Events,  \
                                          CHECK);                          \
   }
-    NEWPERFCOUNTER(_sync_Inflations);
+    NEWPERFSTRIPEDCOUNTER(_sync_Inflations);
     NEWPERFCOUNTER(_sync_Deflations);
-    NEWPERFCOUNTER(_sync_ContendedLockAttempts);
-    NEWPERFCOUNTER(_sync_FutileWakeups);
-    NEWPERFCOUNTER(_sync_Parks);
-    NEWPERFCOUNTER(_sync_Notifications);
+    NEWPERFSTRIPEDCOUNTER(_sync_ContendedLockAttempts);
+    NEWPERFSTRIPEDCOUNTER(_sync_FutileWakeups);
+    NEWPERFSTRIPEDCOUNTER(_sync_Parks);
+    NEWPERFSTRIPEDCOUNTER(_sync_Notifications);
+    NEWPERFSTRIPEDCOUNTER(_sync_SpinAcquires);
+    NEWPERFSTRIPEDCOUNTER(_sync_SpinFailures);
     NEWPERFVARIABLE(_sync_MonExtant);
 #undef NEWPERFCOUNTER
+#undef NEWPERFSTRIPEDCOUNTER
 #undef NEWPERFVARIABLE
   }
 }
@@ -2332,6 +2356,7 @@ void ObjectMonitor::DeferredInitialize() {
   SETKNOB(SpinLimit);
   SETKNOB(SpinBase);
   SETKNOB(SpinBackOff);
+  SETKNOB(RemoteSpinBackOff);
   SETKNOB(CASPenalty);
   SETKNOB(OXPenalty);
   SETKNOB(SpinSetSucc);
@@ -2360,8 +2385,11 @@ void ObjectMonitor::DeferredInitialize() {
 
   if (os::is_MP()) {
     BackOffMask = (1 << Knob_SpinBackOff) - 1;
+    if (UseNUMA) {
+      RemoteBackOffMask = (1 << Knob_RemoteSpinBackOff) - 1;
+    }
     if (Knob_ReportSettings) {
-      tty->print_cr("INFO: BackOffMask=0x%X", BackOffMask);
+      tty->print_cr("INFO: BackOffMask=0x%X RemoteBackOffMask=0x%X", BackOffMask, RemoteBackOffMask);
     }
     // CONSIDER: BackOffMask = ROUNDUP_NEXT_POWER2 (ncpus-1)
   } else {
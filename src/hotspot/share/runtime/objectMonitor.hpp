@@ -162,6 +162,7 @@ class ObjectMonitor {
 
   volatile int _Spinner;            // for exit->spinner handoff optimization
   volatile int _SpinDuration;
+  volatile int _owner_lgrp;         // NUMA group of the last contended acquirer
 
   volatile jint  _count;            // reference count to prevent reclamation/deflation
                                     // at stop-the-world time.  See deflate_idle_monitors().
@@ -187,12 +188,14 @@ class ObjectMonitor {
       }                                          \
     } while (0)
 
-  static PerfCounter * _sync_ContendedLockAttempts;
-  static PerfCounter * _sync_FutileWakeups;
-  static PerfCounter * _sync_Parks;
-  static PerfCounter * _sync_Notifications;
-  static PerfCounter * _sync_Inflations;
+  static PerfStripedCounter * _sync_ContendedLockAttempts;
+  static PerfStripedCounter * _sync_FutileWakeups;
+  static PerfStripedCounter * _sync_Parks;
+  static PerfStripedCounter * _sync_Notifications;
+  static PerfStripedCounter * _sync_Inflations;
   static PerfCounter * _sync_Deflations;
+  static PerfStripedCounter * _sync_SpinAcquires;
+  static PerfStripedCounter * _sync_SpinFailures;
   static PerfLongVariable * _sync_MonExtant;
 
   static int Knob_ExitRelease;
@@ -1823,8 +1823,14 @@ bool os::release_memory(char* addr, size_t bytes) {
 }
 
 void os::pretouch_memory(void* start, void* end, size_t page_size) {
-  for (volatile char *p = (char*)start; p < (char*)end; p += page_size) {
-    *p = 0;
+  assert(is_power_of_2(page_size), "page size must be a power of 2: " SIZE_FORMAT, page_size);
+  if (start < end) {
+    // Touch the first byte and then one byte per page boundary, so that every
+    // page overlapping the range is touched even if start is not page aligned.
+    *(volatile char*)start = 0;
+    for (volatile char *p = align_down((char*)start, page_size) + page_size; p < (char*)end; p += page_size) {
+      *p = 0;
+    }
   }
 }
 
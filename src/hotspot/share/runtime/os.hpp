@@ -41,6 +41,7 @@
 #endif
 
 class AgentLibrary;
+class BitMap;
 class frame;
 
 // os defines the interface to operating system; this includes traditional
@@ -265,6 +266,10 @@ class os: AllStatic {
   // Binds the current process to a processor.
   //    Returns true if it worked, false if it didn't.
   static bool bind_to_processor(uint processor_id);
+  // Binds the current thread to the set of processors whose ids are set
+  // in the given bitmap.
+  //    Returns true if it worked, false if it didn't.
+  static bool bind_to_processors(const BitMap& processors);
 
   // Give a name to the current thread.
   static void set_native_thread_name(const char *name);
@@ -389,6 +394,9 @@ class os: AllStatic {
   static size_t numa_get_leaf_groups(int *ids, size_t size);
   static bool   numa_topology_changed();
   static int    numa_get_group_id();
+  // Sets the bits of the processors that belong to the given NUMA group.
+  //    Returns false if the processors of the group are not known.
+  static bool   numa_get_group_processors(int lgrp_id, BitMap& processors);
 
   // Page manipulation
   struct page_info {
@@ -28,12 +28,15 @@
 #include "logging/log.hpp"
 #include "memory/allocation.inline.hpp"
 #include "oops/oop.inline.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/handles.inline.hpp"
 #include "runtime/java.hpp"
 #include "runtime/mutex.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "runtime/os.hpp"
 #include "runtime/perfData.inline.hpp"
+#include "runtime/thread.hpp"
+#include "utilities/align.hpp"
 #include "utilities/exceptions.hpp"
 #include "utilities/globalDefinitions.hpp"
 
@@ -219,6 +222,43 @@ void PerfLongVariant::sample() {
   }
 }
 
+PerfStripedCounter::PerfStripedCounter(CounterNS ns, const char* namep, Units u)
+                                      : PerfLongCounter(ns, namep, u, (jlong)0) {
+  size_t size = (stripe_count + 1) * DEFAULT_CACHE_LINE_SIZE;
+  _stripes_base = NEW_C_HEAP_ARRAY(char, size, mtInternal);
+  memset(_stripes_base, 0, size);
+  _stripes = align_up(_stripes_base, DEFAULT_CACHE_LINE_SIZE);
+}
+
+PerfStripedCounter::~PerfStripedCounter() {
+  FREE_C_HEAP_ARRAY(char, _stripes_base);
+}
+
+volatile jlong* PerfStripedCounter::stripe_addr(uint index) const {
+  assert(index < stripe_count, "invalid stripe");
+  return (volatile jlong*)(_stripes + index * DEFAULT_CACHE_LINE_SIZE);
+}
+
+void PerfStripedCounter::add(jlong val) {
+  // Thread objects are aligned and allocated far apart, so mix in some
+  // higher address bits to spread threads over the stripes.
+  uintptr_t key = (uintptr_t)Thread::current_or_null();
+  uint index = (uint)((key >> 6) ^ (key >> 12)) & (stripe_count - 1);
+  Atomic::add(val, stripe_addr(index));
+}
+
+jlong PerfStripedCounter::get_value() {
+  jlong sum = 0;
+  for (uint i = 0; i < stripe_count; i++) {
+    sum += *stripe_addr(i);
+  }
+  return sum;
+}
+
+void PerfStripedCounter::sample() {
+  *(jlong*)_valuep = get_value();
+}
+
 PerfByteArray::PerfByteArray(CounterNS ns, const char* namep, Units u,
                              Variability v, jint length)
                             : PerfData(ns, namep, u, v), _length(length) {
@@ -521,6 +561,27 @@ PerfLongCounter* PerfDataManager::create_long_counter(CounterNS ns,
   return p;
 }
 
+PerfStripedCounter* PerfDataManager::create_striped_counter(CounterNS ns,
+                                                            const char* name,
+                                                            PerfData::Units u,
+                                                            TRAPS) {
+
+  // Sampled counters not supported if UsePerfData is false
+  if (!UsePerfData) return NULL;
+
+  PerfStripedCounter* p = new PerfStripedCounter(ns, name, u);
+
+  if (!p->is_valid()) {
+    // allocation of native resources failed.
+    delete p;
+    THROW_0(vmSymbols::java_lang_OutOfMemoryError());
+  }
+
+  add_item(p, true);
+
+  return p;
+}
+
 PerfLongCounter* PerfDataManager::create_long_counter(CounterNS ns,
                                                       const char* name,
                                                       PerfData::Units u,
@@ -462,6 +462,42 @@ class PerfLongCounter : public PerfLongVariant {
 
 typedef PerfLongCounter PerfCounter;
 
+/*
+ * The PerfStripedCounter class implements a PerfLongCounter for values
+ * that are updated concurrently by many threads. Updates go to one of
+ * several cache line sized stripes, chosen by the updating thread, and
+ * are applied atomically so that none are lost. The StatSampler folds
+ * the stripes into the shared memory value every PerfDataSamplingInterval
+ * milliseconds, so external readers of the hsperfdata file see a value
+ * that is at most one sampling interval old. get_value() always returns
+ * the current sum.
+ */
+class PerfStripedCounter : public PerfLongCounter {
+
+  friend class PerfDataManager; // for access to protected constructor
+
+  private:
+    static const uint stripe_count = 16;
+
+    char* _stripes_base;          // unaligned allocation
+    char* _stripes;               // stripe_count cache lines
+
+    volatile jlong* stripe_addr(uint index) const;
+
+  protected:
+    PerfStripedCounter(CounterNS ns, const char* namep, Units u);
+
+    void sample();
+
+  public:
+    ~PerfStripedCounter();
+
+    void add(jlong val);
+    inline void inc() { add(1); }
+    inline void inc(jlong val) { add(val); }
+    jlong get_value();
+};
+
 /*
  * The PerfLongVariable class, and its alias PerfVariable, implement
  * a PerfData subtype that holds a jlong data value that can
@@ -872,6 +908,11 @@ class PerfDataManager : AllStatic {
       return create_long_counter(ns, name, u, sh, THREAD);
     }
 
+    // Counters that are updated concurrently by many threads; see
+    // PerfStripedCounter. Not supported if UsePerfData is false.
+    static PerfStripedCounter* create_striped_counter(CounterNS ns, const char* name,
+                                                      PerfData::Units u, TRAPS);
+
     static void destroy();
     static bool has_PerfData() { return _has_PerfData; }
 };
@@ -38,6 +38,7 @@
 #include "gc/shared/workgroup.hpp"
 #include "interpreter/interpreter.hpp"
 #include "jfr/jfrEvents.hpp"
+#include "jfr/support/jfrThreadId.hpp"
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
 #include "memory/resourceArea.hpp"
@@ -62,6 +63,7 @@
 #include "runtime/thread.inline.hpp"
 #include "runtime/threadSMR.hpp"
 #include "runtime/timerTrace.hpp"
+#include "runtime/vframe.hpp"
 #include "services/runtimeService.hpp"
 #include "utilities/events.hpp"
 #include "utilities/macros.hpp"
@@ -127,6 +129,52 @@ static void post_safepoint_cleanup_task_event(EventSafepointCleanupTask* event,
   }
 }
 
+static void post_safepoint_poll_latency_event(CompiledMethod* nm) {
+  EventSafepointPollLatency event(UNTIMED);
+  if (event.should_commit()) {
+    // Group this event together with the ones committed after the counter is increased
+    set_current_safepoint_id(&event, 1);
+    event.set_starttime(SafepointSynchronize::sync_begin_ticks());
+    event.set_endtime(Ticks::now());
+    event.set_method(nm->method());
+    event.set_compileId(nm->compile_id());
+    event.commit();
+  }
+}
+
+// Name the thread that was the last to stop during the spin phase of the
+// synchronization, together with the Java method it ended up in.
+static void post_safepoint_last_thread_event(JavaThread* thread, const Ticks& stop_ticks) {
+  EventSafepointLastThread event(UNTIMED);
+  LogTarget(Debug, safepoint) lt;
+  if (!event.should_commit() && !lt.is_enabled()) {
+    return;
+  }
+  ResourceMark rm;
+  Method* method = NULL;
+  if (thread->has_last_Java_frame()) {
+    vframeStream vfst(thread);
+    if (!vfst.at_end()) {
+      method = vfst.method();
+    }
+  }
+  if (lt.is_enabled()) {
+    LogStream ls(lt);
+    ls.print_cr("Last thread to reach safepoint: %s after " UINT64_FORMAT " us in %s",
+                thread->get_thread_name(),
+                (stop_ticks - SafepointSynchronize::sync_begin_ticks()).microseconds(),
+                method != NULL ? method->external_name() : "<no Java frame>");
+  }
+  if (event.should_commit()) {
+    set_current_safepoint_id(&event);
+    event.set_starttime(SafepointSynchronize::sync_begin_ticks());
+    event.set_endtime(stop_ticks);
+    event.set_thread(JFR_THREAD_ID(thread));
+    event.set_method(method);
+    event.commit();
+  }
+}
+
 static void post_safepoint_end_event(EventSafepointEnd* event) {
   assert(event != NULL, "invariant");
   if (event->should_commit()) {
@@ -156,6 +204,8 @@ void SafepointSynchronize::begin() {
   Thread* myThread = Thread::current();
   assert(myThread->is_VM_thread(), "Only VM thread may execute a safepoint");
 
+  _sync_begin_ticks = Ticks::now();
+
   if (PrintSafepointStatistics || PrintSafepointStatisticsTimeout > 0) {
     _safepoint_begin_time = os::javaTimeNanos();
     _ts_of_current_safepoint = tty->time_stamp().seconds();
@@ -184,6 +234,8 @@ void SafepointSynchronize::begin() {
   _waiting_to_block = nof_threads;
   TryingToBlock     = 0 ;
   int still_running = nof_threads;
+  JavaThread* last_running = NULL;  // last thread seen to stop after the first pass
+  Ticks last_running_ticks;
 
   // Save the starting time, so that it can be compared to see if this has taken
   // too long to complete.
@@ -294,6 +346,9 @@ void SafepointSynchronize::begin() {
             cur_state->examine_state_of_thread();
             if (!cur_state->is_running()) {
               still_running--;
+              if (iterations > 0) {
+                last_running = cur;
+              }
               // consider adjusting steps downward:
               //   steps = 0
               //   steps -= NNN
@@ -400,6 +455,9 @@ void SafepointSynchronize::begin() {
         }
         assert(iterations < (uint)max_jint, "We have been iterating in the safepoint loop too long");
       }
+      if (last_running != NULL) {
+        last_running_ticks = Ticks::now();
+      }
     } // ThreadsListHandle destroyed here.
     assert(still_running == 0, "sanity check");
 
@@ -469,6 +527,12 @@ void SafepointSynchronize::begin() {
 
   log_info(safepoint)("Entering safepoint region: %s", VMThread::vm_safepoint_description());
 
+  // All threads are stopped and their stacks are walkable. Threads_lock
+  // is held, so last_running cannot have exited in the meantime.
+  if (last_running != NULL) {
+    post_safepoint_last_thread_event(last_running, last_running_ticks);
+  }
+
   RuntimeService::record_safepoint_synchronized();
   if (PrintSafepointStatistics) {
     update_statistics_on_sync_end(os::javaTimeNanos());
@@ -617,7 +681,8 @@ private:
 public:
   ParallelSPCleanupThreadClosure(DeflateMonitorCounters* counters) :
     _counters(counters),
-    _nmethod_cl(NMethodSweeper::prepare_mark_active_nmethods()) {}
+    _nmethod_cl(ThreadLocalHandshakes ? NMethodSweeper::prepare_reset_hotness_counters() :
+                                        NMethodSweeper::prepare_mark_active_nmethods()) {}
 
   void do_thread(Thread* thread) {
     ObjectSynchronizer::deflate_thread_local_monitors(thread, _counters);
@@ -1184,6 +1249,12 @@ void ThreadSafepointState::handle_polling_page_exception() {
   // Should only be poll_return or poll
   assert( nm->is_at_poll_or_poll_return(real_return_addr), "should not be at call" );
 
+  // Record how long it took this compiled method to reach a poll, to
+  // find the code that delays time to safepoint.
+  if (SafepointSynchronize::is_synchronizing()) {
+    post_safepoint_poll_latency_event(nm);
+  }
+
   // This is a poll immediately before a return. The exception handling code
   // has already had the effect of causing the return to occur, so the execution
   // will continue immediately after the call. In addition, the oopmap at the
@@ -1255,6 +1326,7 @@ void ThreadSafepointState::handle_polling_page_exception() {
 //                     Statistics & Instrumentations
 //
 SafepointSynchronize::SafepointStats*  SafepointSynchronize::_safepoint_stats = NULL;
+Ticks  SafepointSynchronize::_sync_begin_ticks;
 jlong  SafepointSynchronize::_safepoint_begin_time = 0;
 int    SafepointSynchronize::_cur_stat_index = 0;
 julong SafepointSynchronize::_safepoint_reasons[VM_Operation::VMOp_Terminating];
@@ -33,6 +33,7 @@
 #include "runtime/mutexLocker.hpp"
 #include "runtime/os.hpp"
 #include "utilities/ostream.hpp"
+#include "utilities/ticks.hpp"
 
 //
 // Safepoint synchronization
@@ -120,6 +121,8 @@ public:
 private:
   static long       _end_of_last_safepoint;     // Time of last safepoint in milliseconds
 
+  static Ticks      _sync_begin_ticks;          // Time when the current synchronization started
+
   // Statistics
   static jlong            _safepoint_begin_time;     // time when safepoint begins
   static SafepointStats*  _safepoint_stats;          // array of SafepointStats struct
@@ -159,6 +162,7 @@ public:
   // Query
   inline static bool is_at_safepoint()   { return _state == _synchronized;  }
   inline static bool is_synchronizing()  { return _state == _synchronizing;  }
+  static const Ticks& sync_begin_ticks() { return _sync_begin_ticks; }
   inline static int safepoint_counter()  { return _safepoint_counter; }
 
   inline static void increment_jni_active_count() {
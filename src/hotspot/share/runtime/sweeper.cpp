@@ -36,6 +36,7 @@
 #include "oops/method.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/compilationPolicy.hpp"
+#include "runtime/handshake.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "runtime/orderAccess.hpp"
@@ -151,6 +152,7 @@ volatile int  NMethodSweeper::_bytes_changed           = 0;    // Counts the tot
                                                                //   1) alive       -> not_entrant
                                                                //   2) not_entrant -> zombie
 int    NMethodSweeper::_hotness_counter_reset_val       = 0;
+int    NMethodSweeper::_relocated_in_sweep              = 0;
 
 long   NMethodSweeper::_total_nof_methods_reclaimed     = 0;   // Accumulated nof methods flushed
 long   NMethodSweeper::_total_nof_c2_methods_reclaimed  = 0;   // Accumulated nof methods flushed
@@ -159,6 +161,7 @@ Tickspan NMethodSweeper::_total_time_sweeping;                 // Accumulated ti
 Tickspan NMethodSweeper::_total_time_this_sweep;               // Total time this sweep
 Tickspan NMethodSweeper::_peak_sweep_time;                     // Peak time for a full sweep
 Tickspan NMethodSweeper::_peak_sweep_fraction_time;            // Peak time sweeping one fraction
+Tickspan NMethodSweeper::_time_marking;                        // Time of the last stack scan not yet reported
 
 Monitor* NMethodSweeper::_stat_lock = new Monitor(Mutex::special, "Sweeper::Statistics", true, Monitor::_safepoint_check_sometimes);
 
@@ -210,7 +213,14 @@ void NMethodSweeper::mark_active_nmethods() {
 }
 
 CodeBlobClosure* NMethodSweeper::prepare_mark_active_nmethods() {
-  assert(SafepointSynchronize::is_at_safepoint(), "must be executed at a safepoint");
+#ifdef ASSERT
+  if (ThreadLocalHandshakes) {
+    assert(Thread::current()->is_Code_cache_sweeper_thread(), "must be executed in the sweeper thread");
+    assert_lock_strong(CodeCache_lock);
+  } else {
+    assert(SafepointSynchronize::is_at_safepoint(), "must be executed at a safepoint");
+  }
+#endif
   // If we do not want to reclaim not-entrant or zombie methods there is no need
   // to scan stacks
   if (!MethodFlushing) {
@@ -218,7 +228,9 @@ CodeBlobClosure* NMethodSweeper::prepare_mark_active_nmethods() {
   }
 
   // Increase time so that we can estimate when to invoke the sweeper again.
-  _time_counter++;
+  if (!ThreadLocalHandshakes) {
+    _time_counter++;
+  }
 
   // Check for restart
   if (_current.method() != NULL) {
@@ -252,14 +264,62 @@ CodeBlobClosure* NMethodSweeper::prepare_mark_active_nmethods() {
 }
 
 /**
-  * This function triggers a VM operation that does stack scanning of active
-  * methods. Stack scanning is mandatory for the sweeper to make progress.
+  * With thread-local handshakes the stacks are only scanned by the sweeper
+  * itself, when it starts a new traversal. Safepoints then just advance the
+  * sweeper's notion of time and, for code aging, keep the hotness counters
+  * of active nmethods up to date.
+  */
+CodeBlobClosure* NMethodSweeper::prepare_reset_hotness_counters() {
+  assert(SafepointSynchronize::is_at_safepoint(), "must be executed at a safepoint");
+  assert(ThreadLocalHandshakes, "only used with handshakes");
+  if (!MethodFlushing) {
+    return NULL;
+  }
+
+  // Increase time so that we can estimate when to invoke the sweeper again.
+  _time_counter++;
+
+  return UseCodeAging ? &set_hotness_closure : NULL;
+}
+
+class NMethodMarkActivationThreadClosure : public ThreadClosure {
+ private:
+  CodeBlobClosure* _cl;
+
+ public:
+  NMethodMarkActivationThreadClosure(CodeBlobClosure* cl) : _cl(cl) {}
+
+  void do_thread(Thread* thread) {
+    if (thread->is_Java_thread() && !thread->is_Code_cache_sweeper_thread()) {
+      ((JavaThread*)thread)->nmethods_do(_cl);
+    }
+  }
+};
+
+/**
+  * This function scans the stacks of all Java threads for active methods,
+  * either with a handshake or with a VM operation. Stack scanning is
+  * mandatory for the sweeper to make progress.
   */
 void NMethodSweeper::do_stack_scanning() {
   assert(!CodeCache_lock->owned_by_self(), "just checking");
   if (wait_for_stack_scanning()) {
-    VM_MarkActiveNMethods op;
-    VMThread::execute(&op);
+    Ticks marking_start = Ticks::now();
+    if (ThreadLocalHandshakes) {
+      CodeBlobClosure* code_cl;
+      {
+        MutexLockerEx ccl(CodeCache_lock, Mutex::_no_safepoint_check_flag);
+        code_cl = prepare_mark_active_nmethods();
+      }
+      if (code_cl != NULL) {
+        NMethodMarkActivationThreadClosure tcl(code_cl);
+        Handshake::execute(&tcl);
+      }
+    } else {
+      VM_MarkActiveNMethods op;
+      VMThread::execute(&op);
+    }
+    _time_marking = Ticks::now() - marking_start;
     _should_sweep = true;
   }
 }
@@ -382,6 +442,10 @@ void NMethodSweeper::possibly_sweep() {
   }
 
   if (_should_sweep || forced) {
+    if (ThreadLocalHandshakes) {
+      // No safepoint starts a new traversal for us
+      do_stack_scanning();
+    }
     init_sweeper_log();
     sweep_code_cache();
   }
@@ -415,7 +479,8 @@ static void post_sweep_event(EventSweepCodeCache* event,
                              s4 traversals,
                              int swept,
                              int flushed,
-                             int zombified) {
+                             int zombified,
+                             const Tickspan& marking) {
   assert(event != NULL, "invariant");
   assert(event->should_commit(), "invariant");
   event->set_starttime(start);
@@ -424,6 +489,7 @@ static void post_sweep_event(EventSweepCodeCache* event,
   event->set_sweptCount(swept);
   event->set_flushedCount(flushed);
   event->set_zombifiedCount(zombified);
+  event->set_markingTime(marking);
   event->commit();
 }
 
@@ -441,6 +507,8 @@ void NMethodSweeper::sweep_code_cache() {
     tty->print_cr("### Sweep at %d out of %d", _seen, CodeCache::nmethod_count());
   }
 
+  _relocated_in_sweep = 0;
+
   int swept_count = 0;
   assert(!SafepointSynchronize::is_at_safepoint(), "should not be in safepoint when we get here");
   assert(!CodeCache_lock->owned_by_self(), "just checking");
@@ -516,8 +584,10 @@ void NMethodSweeper::sweep_code_cache() {
 
   EventSweepCodeCache event(UNTIMED);
   if (event.should_commit()) {
-    post_sweep_event(&event, sweep_start_counter, sweep_end_counter, (s4)_traversals, swept_count, flushed_count, zombified_count);
+    post_sweep_event(&event, sweep_start_counter, sweep_end_counter, (s4)_traversals, swept_count, flushed_count, zombified_count, _time_marking);
   }
+  // Only report the marking with the first sweep of a traversal
+  _time_marking = Tickspan();
 
 #ifdef ASSERT
   if(PrintMethodFlushing) {
@@ -675,6 +745,7 @@ NMethodSweeper::MethodStateChange NMethodSweeper::process_compiled_method(Compil
   } else {
     if (cm->is_nmethod()) {
       possibly_flush((nmethod*)cm);
+      possibly_relocate((nmethod*)cm);
     }
     // Clean inline caches that point to zombie/non-entrant/unloaded nmethods
     MutexLocker cl(CompiledIC_lock);
@@ -767,6 +838,36 @@ void NMethodSweeper::possibly_flush(nmethod* nm) {
   }
 }
 
+// Hot C2 code that lies above a free block large enough to hold it is made
+// not entrant, so that its recompilation is allocated in that block. Over
+// time this moves the hot code towards the low end of its code heap and
+// fills the holes left by flushed methods.
+void NMethodSweeper::possibly_relocate(nmethod* nm) {
+  if (!CodeCacheRelocateHotMethods || _relocated_in_sweep >= CodeCacheRelocateHotMethodsLimit) {
+    return;
+  }
+  if (!nm->is_in_use() || !nm->is_compiled_by_c2() || nm->is_osr_method() ||
+      nm->is_locked_by_vm() || nm->is_not_installed()) {
+    return;
+  }
+  // Only relocate methods that were seen on a stack during the last scan
+  if (nm->hotness_counter() < hotness_counter_reset_val() - 1) {
+    return;
+  }
+  bool has_room_below;
+  {
+    MutexLockerEx mu(CodeCache_lock, Mutex::_no_safepoint_check_flag);
+    has_room_below = CodeCache::has_free_block_below(nm);
+  }
+  if (has_room_below) {
+    _relocated_in_sweep++;
+    nm->make_not_entrant();
+    if (PrintMethodFlushing && Verbose) {
+      tty->print_cr("### Nmethod %d/" PTR_FORMAT " made not-entrant for relocation", nm->compile_id(), p2i(nm));
+    }
+  }
+}
+
 // Print out some state information about the current sweep and the
 // state of the code cache if it's requested.
 void NMethodSweeper::log_sweep(const char* msg, const char* format, ...) {
@@ -39,6 +39,8 @@ class CodeBlobClosure;
 //  1) mark active nmethods
 //     Is done in 'mark_active_nmethods()'. This function is called at a
 //     safepoint and marks all nmethods that are active on a thread's stack.
+//     With ThreadLocalHandshakes the sweeper instead scans the stacks with a
+//     handshake when it starts a new traversal (do_stack_scanning()).
 //  2) sweep nmethods
 //     Is done in sweep_code_cache(). This function is the only place in the
 //     sweeper where memory is reclaimed. Note that sweep_code_cache() is not
@@ -82,11 +84,13 @@ class NMethodSweeper : public AllStatic {
   static long      _total_nof_c2_methods_reclaimed; // Accumulated nof C2-compiled methods flushed
   static size_t    _total_flushed_size;             // Total size of flushed methods
   static int       _hotness_counter_reset_val;
+  static int       _relocated_in_sweep;           // Nof. hot nmethods made not entrant for relocation in this sweep
 
   static Tickspan  _total_time_sweeping;          // Accumulated time sweeping
   static Tickspan  _total_time_this_sweep;        // Total time this sweep
   static Tickspan  _peak_sweep_time;              // Peak time for a full sweep
   static Tickspan  _peak_sweep_fraction_time;     // Peak time sweeping one fraction
+  static Tickspan  _time_marking;                 // Time of the last stack scan not yet reported
 
   static Monitor*  _stat_lock;
 
@@ -116,6 +120,7 @@ class NMethodSweeper : public AllStatic {
 
   static void mark_active_nmethods();      // Invoked at the end of each safepoint
   static CodeBlobClosure* prepare_mark_active_nmethods();
+  static CodeBlobClosure* prepare_reset_hotness_counters();
   static void sweeper_loop();
   static void notify(int code_blob_type);  // Possibly start the sweeper thread.
   static void force_sweep();
@@ -124,6 +129,7 @@ class NMethodSweeper : public AllStatic {
   static void report_state_change(nmethod* nm);
   static void possibly_enable_sweeper();
   static void possibly_flush(nmethod* nm);
+  static void possibly_relocate(nmethod* nm);
   static void print(outputStream* out);   // Printing/debugging
   static void print() { print(tty); }
 };
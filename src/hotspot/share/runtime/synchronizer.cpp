@@ -126,6 +126,7 @@ int ObjectSynchronizer::gOmInUseCount = 0;
 static volatile intptr_t gListLock = 0;      // protects global monitor lists
 static volatile int gMonitorFreeCount  = 0;  // # on gFreeList
 static volatile int gMonitorPopulation = 0;  // # Extant -- in circulation
+static jlong gLastDeflationTime = 0;         // javaTimeNanos of last deflation
 
 #define CHAINMARKER (cast_to_oop<intptr_t>(-1))
 
@@ -1706,14 +1707,29 @@ int ObjectSynchronizer::deflate_monitor_list(ObjectMonitor** listHeadp,
   return deflated_count;
 }
 
+// With MonitorDeflationInterval the in-use lists are only scanned at
+// safepoints that are at least that far apart, unless monitors are
+// running short. Idle monitors left inflated are harmless, so this bounds
+// how often the cleanup phase pays for walking a large monitor population.
+static bool should_deflate_idle_monitors() {
+  if (MonitorDeflationInterval == 0 || ForceMonitorScavenge != 0 ||
+      ObjectSynchronizer::is_cleanup_needed()) {
+    return true;
+  }
+  jlong elapsed = os::javaTimeNanos() - gLastDeflationTime;
+  return elapsed >= MonitorDeflationInterval * NANOSECS_PER_MILLISEC;
+}
+
 void ObjectSynchronizer::prepare_deflate_idle_monitors(DeflateMonitorCounters* counters) {
   counters->nInuse = 0;          // currently associated with objects
   counters->nInCirculation = 0;  // extant
   counters->nScavenged = 0;      // reclaimed
+  counters->perform = should_deflate_idle_monitors();
 }
 
 void ObjectSynchronizer::deflate_idle_monitors(DeflateMonitorCounters* counters) {
   assert(SafepointSynchronize::is_at_safepoint(), "must be at safepoint");
+  if (!counters->perform) return;
   bool deflated = false;
 
   ObjectMonitor * freeHeadp = NULL;  // Local SLL of scavenged monitors
@@ -1781,6 +1797,11 @@ void ObjectSynchronizer::deflate_idle_monitors(DeflateMonitorCounters* counters)
 }
 
 void ObjectSynchronizer::finish_deflate_idle_monitors(DeflateMonitorCounters* counters) {
+  if (!counters->perform) {
+    log_trace(monitorinflation)("Deferred deflation of idle monitors");
+    return;
+  }
+  gLastDeflationTime = os::javaTimeNanos();
   gMonitorFreeCount += counters->nScavenged;
 
   // Consider: audit gFreeList to ensure that gMonitorFreeCount and list agree.
@@ -1806,7 +1827,7 @@ void ObjectSynchronizer::finish_deflate_idle_monitors(DeflateMonitorCounters* co
 
 void ObjectSynchronizer::deflate_thread_local_monitors(Thread* thread, DeflateMonitorCounters* counters) {
   assert(SafepointSynchronize::is_at_safepoint(), "must be at safepoint");
-  if (!MonitorInUseLists) return;
+  if (!MonitorInUseLists || !counters->perform) return;
 
   ObjectMonitor * freeHeadp = NULL;  // Local SLL of scavenged monitors
   ObjectMonitor * freeTailp = NULL;
@@ -38,6 +38,7 @@ struct DeflateMonitorCounters {
   int nInuse;          // currently associated with objects
   int nInCirculation;  // extant
   int nScavenged;      // reclaimed
+  bool perform;        // deflate at this safepoint
 };
 
 class ObjectSynchronizer : AllStatic {
@@ -25,6 +25,7 @@
 #include "precompiled.hpp"
 #include "jvm.h"
 #include "classfile/classLoader.hpp"
+#include "classfile/classPreloader.hpp"
 #include "classfile/javaClasses.hpp"
 #include "classfile/moduleEntry.hpp"
 #include "classfile/systemDictionary.hpp"
@@ -43,6 +44,7 @@
 #include "jfr/jfrEvents.hpp"
 #include "jvmtifiles/jvmtiEnv.hpp"
 #include "logging/log.hpp"
+#include "logging/logAsyncWriter.hpp"
 #include "logging/logConfiguration.hpp"
 #include "logging/logStream.hpp"
 #include "memory/allocation.inline.hpp"
@@ -1627,6 +1629,8 @@ void JavaThread::initialize() {
     _jvmci_counters = NULL;
   }
 #endif // INCLUDE_JVMCI
+  COMPILER1_PRESENT(_c1_profile_countdown = 0;)
+  _interp_profile_countdown = 0;
   _reserved_stack_activation = NULL;  // stack base not known yet
   (void)const_cast<oop&>(_exception_oop = oop(NULL));
   _exception_pc  = 0;
@@ -3394,11 +3398,13 @@ CompilerThread::CompilerThread(CompileQueue* queue,
 #ifndef PRODUCT
   _ideal_graph_printer = NULL;
 #endif
+  _chunk_cache.enable();
 }
 
 CompilerThread::~CompilerThread() {
   // Delete objects which were allocated on heap.
   delete _counters;
+  _chunk_cache.release();
 }
 
 bool CompilerThread::can_call_java() const {
@@ -3792,6 +3798,10 @@ jint Threads::create_vm(JavaVMInitArgs* args, bool* canTryAgain) {
     return status;
   }
 
+  // Start the asynchronous log writer, if requested. This needs the
+  // barrier set, which is created during heap initialization.
+  AsyncLogWriter::initialize();
+
   JFR_ONLY(Jfr::on_create_vm_1();)
 
   // Should be done after the heap is fully created
@@ -3947,6 +3957,10 @@ jint Threads::create_vm(JavaVMInitArgs* args, bool* canTryAgain) {
   // cache the system and platform class loaders
   SystemDictionary::compute_java_loaders(CHECK_JNI_ERR);
 
+  if (ClassPreloadList != NULL && !DumpSharedSpaces) {
+    ClassPreloader::start(ClassPreloadList, CHECK_JNI_ERR);
+  }
+
 #if INCLUDE_CDS
   if (DumpSharedSpaces) {
     // capture the module path info from the ModuleEntryTable
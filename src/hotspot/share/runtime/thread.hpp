@@ -29,6 +29,7 @@
 #include "gc/shared/gcThreadLocalData.hpp"
 #include "gc/shared/threadLocalAllocBuffer.hpp"
 #include "memory/allocation.hpp"
+#include "memory/arena.hpp"
 #include "oops/oop.hpp"
 #include "prims/jvmtiExport.hpp"
 #include "runtime/frame.hpp"
@@ -1088,6 +1089,13 @@ class JavaThread: public Thread {
  private:
 #endif // INCLUDE_JVMCI
 
+#ifdef COMPILER1
+  // Countdown for sampled branch profiling in C1 code (C1ProfileBranchSampleRate)
+  int       _c1_profile_countdown;
+#endif
+  // Countdown for sampled MDO updates in the interpreter (InterpreterProfileSampleRate)
+  int       _interp_profile_countdown;
+
   StackGuardState  _stack_guard_state;
 
   // Precompute the limit of the stack as used in stack overflow checks.
@@ -1716,6 +1724,10 @@ class JavaThread: public Thread {
   static ByteSize jvmci_implicit_exception_pc_offset() { return byte_offset_of(JavaThread, _jvmci._implicit_exception_pc); }
   static ByteSize jvmci_counters_offset()        { return byte_offset_of(JavaThread, _jvmci_counters); }
 #endif // INCLUDE_JVMCI
+#ifdef COMPILER1
+  static ByteSize c1_profile_countdown_offset()  { return byte_offset_of(JavaThread, _c1_profile_countdown); }
+#endif
+  static ByteSize interp_profile_countdown_offset() { return byte_offset_of(JavaThread, _interp_profile_countdown); }
   static ByteSize exception_oop_offset()         { return byte_offset_of(JavaThread, _exception_oop); }
   static ByteSize exception_pc_offset()          { return byte_offset_of(JavaThread, _exception_pc); }
   static ByteSize exception_handler_pc_offset()  { return byte_offset_of(JavaThread, _exception_handler_pc); }
@@ -2082,6 +2094,7 @@ class CompilerThread : public JavaThread {
 
   AbstractCompiler*     _compiler;
   TimeStamp             _idle_time;
+  ChunkCache            _chunk_cache;
 
  public:
 
@@ -2118,6 +2131,8 @@ class CompilerThread : public JavaThread {
     _log = log;
   }
 
+  ChunkCache*   chunk_cache()                    { return &_chunk_cache; }
+
   void start_idle_timer()                        { _idle_time.update(); }
   jlong idle_time_millis() {
     return TimeHelper::counter_to_millis(_idle_time.ticks_since_update());
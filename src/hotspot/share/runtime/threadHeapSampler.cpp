@@ -23,10 +23,13 @@
  */
 
 #include "precompiled.hpp"
+#include "prims/jvmtiExport.hpp"
 #include "runtime/handles.inline.hpp"
 #include "runtime/orderAccess.hpp"
 #include "runtime/sharedRuntime.hpp"
+#include "runtime/thread.hpp"
 #include "runtime/threadHeapSampler.hpp"
+#include "services/allocationProfiler.hpp"
 
 // Cheap random number generator
 uint64_t ThreadHeapSampler::_rnd;
@@ -126,6 +129,10 @@ void ThreadHeapSampler::check_for_sampling(oop obj, size_t allocation_size, size
   }
 
   JvmtiExport::sampled_object_alloc_event_collector(obj);
+  if (AllocationProfiler::is_enabled() &&
+      JvmtiSampledObjectAllocEventCollector::object_alloc_is_safe_to_sample()) {
+    AllocationProfiler::record_sample(JavaThread::current(), obj, allocation_size);
+  }
 
   size_t overflow_bytes = total_allocated_bytes - _bytes_until_sample;
   pick_next_sample(overflow_bytes);
@@ -117,6 +117,10 @@ volatile uint         ThreadsSMRSupport::_tlh_times = 0;
 
 ThreadsList*          ThreadsSMRSupport::_to_delete_list = NULL;
 
+// Number of ThreadsLists added to _to_delete_list since the last
+// hazard ptr scan in free_list(). Protected by the Threads_lock.
+uint                  ThreadsSMRSupport::_to_delete_list_pending = 0;
+
 // # of parallel ThreadsLists on the to-delete list.
 // Impl note: Hard to imagine > 64K ThreadsLists needing to be deleted so
 // this could be 16-bit, but there is no nice 16-bit _FORMAT support.
@@ -792,6 +796,16 @@ void ThreadsSMRSupport::free_list(ThreadsList* threads) {
     }
   }
 
+  // Gathering the hazard ptrs walks every JavaThread, which dominates
+  // the Threads_lock hold time of Threads::add() and Threads::remove()
+  // when there are very many threads. Retired ThreadsLists are only
+  // memory, so let a few accumulate and free them in one scan.
+  if (++_to_delete_list_pending < ThreadSMRFreeListBatchSize) {
+    log_debug(thread, smr)("tid=" UINTX_FORMAT ": ThreadsSMRSupport::free_list: threads=" INTPTR_FORMAT " is deferred.", os::current_thread_id(), p2i(threads));
+    return;
+  }
+  _to_delete_list_pending = 0;
+
   // Hash table size should be first power of two higher than twice the length of the ThreadsList
   int hash_table_size = MIN2((int)get_java_thread_list()->length(), 32) << 1;
   hash_table_size--;
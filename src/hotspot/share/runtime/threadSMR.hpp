@@ -113,6 +113,7 @@ class ThreadsSMRSupport : AllStatic {
   static volatile uint         _tlh_time_max;
   static volatile uint         _tlh_times;
   static ThreadsList*          _to_delete_list;
+  static uint                  _to_delete_list_pending;
   static uint                  _to_delete_list_cnt;
   static uint                  _to_delete_list_max;
 
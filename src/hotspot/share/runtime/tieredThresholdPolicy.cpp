@@ -23,13 +23,16 @@
  */
 
 #include "precompiled.hpp"
+#include "aot/aotLoader.hpp"
 #include "compiler/compileBroker.hpp"
+#include "compiler/compileWarmup.hpp"
 #include "compiler/compilerOracle.hpp"
 #include "memory/resourceArea.hpp"
 #include "runtime/arguments.hpp"
 #include "runtime/handles.inline.hpp"
 #include "runtime/safepointVerifiers.hpp"
 #include "runtime/tieredThresholdPolicy.hpp"
+#include "runtime/timer.hpp"
 #include "code/scopeDesc.hpp"
 #include "oops/method.inline.hpp"
 #if INCLUDE_JVMCI
@@ -290,6 +293,7 @@ CompileTask* TieredThresholdPolicy::select_task(CompileQueue* compile_queue) {
   CompileTask *max_task = NULL;
   Method* max_method = NULL;
   jlong t = os::javaTimeMillis();
+  jlong now = os::elapsed_counter();
   // Iterate through the queue and find a method with a maximum rate.
   for (CompileTask* task = compile_queue->first(); task != NULL;) {
     CompileTask* next_task = task->next();
@@ -308,14 +312,14 @@ CompileTask* TieredThresholdPolicy::select_task(CompileQueue* compile_queue) {
       continue;
     }
     update_rate(t, method);
-    if (max_task == NULL || compare_methods(method, max_method)) {
+    if (max_task == NULL || compare_tasks(task, max_task, now)) {
       // Select a method with the highest rate
       max_task = task;
       max_method = method;
     }
 
     if (task->is_blocking()) {
-      if (max_blocking_task == NULL || compare_methods(method, max_blocking_task->method())) {
+      if (max_blocking_task == NULL || compare_tasks(task, max_blocking_task, now)) {
         max_blocking_task = task;
       }
     }
@@ -391,6 +395,10 @@ nmethod* TieredThresholdPolicy::event(const methodHandle& method, const methodHa
   }
 
   if (bci == InvocationEntryBci) {
+    if (comp_level == CompLevel_none) {
+      // Publish the AOT code of the method now that it is used (AOTLazyMethodLinking)
+      AOTLoader::link_method(method, thread);
+    }
     method_invocation_event(method, inlinee, comp_level, nm, thread);
   } else {
     // method == inlinee if the event originated in the main method
@@ -531,14 +539,25 @@ double TieredThresholdPolicy::weight(Method* method) {
     (method->invocation_count() + 1) * (method->backedge_count() + 1);
 }
 
-// Apply heuristics and return true if x should be compiled before y
-bool TieredThresholdPolicy::compare_methods(Method* x, Method* y) {
-  if (x->highest_comp_level() > y->highest_comp_level()) {
+double TieredThresholdPolicy::weight(CompileTask* task, jlong now) {
+  double w = weight(task->method());
+  if (TieredCompileTaskAgingTime > 0) {
+    double waited = TimeHelper::counter_to_millis(now - task->time_queued());
+    w *= 1.0 + waited / TieredCompileTaskAgingTime;
+  }
+  return w;
+}
+
+// Apply heuristics and return true if task x should be compiled before task y
+bool TieredThresholdPolicy::compare_tasks(CompileTask* x, CompileTask* y, jlong now) {
+  Method* mx = x->method();
+  Method* my = y->method();
+  if (mx->highest_comp_level() > my->highest_comp_level()) {
     // recompilation after deopt
     return true;
   } else
-    if (x->highest_comp_level() == y->highest_comp_level()) {
-      if (weight(x) > weight(y)) {
+    if (mx->highest_comp_level() == my->highest_comp_level()) {
+      if (weight(x, now) > weight(y, now)) {
         return true;
       }
     }
@@ -738,6 +757,10 @@ CompLevel TieredThresholdPolicy::common(Predicate p, Method* method, CompLevel c
       // If we were at full profile level, would we switch to full opt?
       if (common(p, method, CompLevel_full_profile, disable_feedback) == CompLevel_full_optimization) {
         next_level = CompLevel_full_optimization;
+      } else if (CompileWarmup::is_hot(method)) {
+        // The method was hot in the recorded run (CompileWarmupFile), so
+        // start collecting the full profile for C2 right away.
+        next_level = CompLevel_full_profile;
       } else if ((this->*p)(i, b, cur_level, method)) {
 #if INCLUDE_JVMCI
         if (EnableJVMCI && UseJVMCICompiler) {
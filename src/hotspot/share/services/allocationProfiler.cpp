@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+
+#include "precompiled.hpp"
+#include "memory/allocation.inline.hpp"
+#include "memory/resourceArea.hpp"
+#include "oops/method.hpp"
+#include "oops/oop.inline.hpp"
+#include "runtime/mutexLocker.hpp"
+#include "runtime/os.hpp"
+#include "runtime/thread.inline.hpp"
+#include "runtime/threadHeapSampler.hpp"
+#include "runtime/vframe.inline.hpp"
+#include "services/allocationProfiler.hpp"
+#include "utilities/growableArray.hpp"
+#include "utilities/ostream.hpp"
+
+// An allocation site is the allocated class plus the innermost Java
+// frames of the allocating thread. Klass* and Method* are only compared
+// after the site has been recorded, never dereferenced, since they may
+// be unloaded; the text needed for printing is copied up front.
+class AllocProfilerSite : public CHeapObj<mtInternal> {
+ public:
+  enum { max_frames = 8 };
+
+  unsigned           _hash;
+  const Klass*       _klass;
+  int                _depth;
+  const Method*      _methods[max_frames];
+  int                _bcis[max_frames];
+  char*              _description;
+  size_t             _samples;
+  size_t             _bytes;
+  AllocProfilerSite* _next;
+
+  bool matches(unsigned hash, const Klass* klass, int depth,
+               const Method* const* methods, const int* bcis) const {
+    if (_hash != hash || _klass != klass || _depth != depth) {
+      return false;
+    }
+    for (int i = 0; i < depth; i++) {
+      if (_methods[i] != methods[i] || _bcis[i] != bcis[i]) {
+        return false;
+      }
+    }
+    return true;
+  }
+};
+
+static const int table_size = 1024;
+static const int max_sites  = 16 * K;
+
+static AllocProfilerSite* _table[table_size];
+static int             _site_count      = 0;
+static size_t          _dropped_samples = 0;
+
+bool AllocationProfiler::_enabled = false;
+
+void allocationProfiler_init() {
+  AllocationProfiler::initialize();
+}
+
+void AllocationProfiler::initialize() {
+  if (!AllocationProfiling) {
+    return;
+  }
+  ThreadHeapSampler::set_sampling_interval((int)AllocationProfilingInterval);
+  ThreadHeapSampler::enable();
+  _enabled = true;
+}
+
+static char* describe_site(const Klass* klass, int depth,
+                           const Method* const* methods, const int* bcis) {
+  ResourceMark rm;
+  stringStream ss;
+  ss.print_cr("%s", klass->external_name());
+  for (int i = 0; i < depth; i++) {
+    const Method* m = methods[i];
+    ss.print_cr("\tat %s.%s (line %d)", m->method_holder()->external_name(),
+                m->name()->as_C_string(), m->line_number_from_bci(bcis[i]));
+  }
+  return os::strdup(ss.as_string(), mtInternal);
+}
+
+void AllocationProfiler::record_sample(JavaThread* thread, oop obj, size_t size_in_bytes) {
+  if (!thread->has_last_Java_frame()) {
+    return;
+  }
+  const Klass* klass = obj->klass();
+  const Method* methods[AllocProfilerSite::max_frames];
+  int bcis[AllocProfilerSite::max_frames];
+  int depth = 0;
+  unsigned hash = (unsigned)((uintptr_t)klass >> LogHeapWordSize);
+  for (vframeStream vfst(thread); !vfst.at_end() && depth < AllocProfilerSite::max_frames; vfst.next()) {
+    methods[depth] = vfst.method();
+    bcis[depth] = vfst.bci();
+    hash = 31 * hash + (unsigned)((uintptr_t)methods[depth] >> LogHeapWordSize) + bcis[depth];
+    depth++;
+  }
+
+  MutexLockerEx ml(AllocationProfiler_lock, Mutex::_no_safepoint_check_flag);
+  AllocProfilerSite** bucket = &_table[hash % table_size];
+  for (AllocProfilerSite* site = *bucket; site != NULL; site = site->_next) {
+    if (site->matches(hash, klass, depth, methods, bcis)) {
+      site->_samples++;
+      site->_bytes += size_in_bytes;
+      return;
+    }
+  }
+  if (_site_count >= max_sites) {
+    _dropped_samples++;
+    return;
+  }
+  AllocProfilerSite* site = new AllocProfilerSite();
+  site->_hash = hash;
+  site->_klass = klass;
+  site->_depth = depth;
+  for (int i = 0; i < depth; i++) {
+    site->_methods[i] = methods[i];
+    site->_bcis[i] = bcis[i];
+  }
+  site->_description = describe_site(klass, depth, methods, bcis);
+  site->_samples = 1;
+  site->_bytes = size_in_bytes;
+  site->_next = *bucket;
+  *bucket = site;
+  _site_count++;
+}
+
+static int compare_sites(AllocProfilerSite** a, AllocProfilerSite** b) {
+  if ((*a)->_bytes > (*b)->_bytes) return -1;
+  if ((*a)->_bytes < (*b)->_bytes) return 1;
+  return 0;
+}
+
+void AllocationProfiler::print_on(outputStream* st, int max_sites_to_print) {
+  if (!is_enabled()) {
+    st->print_cr("Allocation profiling is not enabled, use -XX:+AllocationProfiling");
+    return;
+  }
+  ResourceMark rm;
+  MutexLockerEx ml(AllocationProfiler_lock, Mutex::_no_safepoint_check_flag);
+  GrowableArray<AllocProfilerSite*> sites(_site_count);
+  size_t total_samples = 0;
+  size_t total_bytes = 0;
+  for (int i = 0; i < table_size; i++) {
+    for (AllocProfilerSite* site = _table[i]; site != NULL; site = site->_next) {
+      sites.append(site);
+      total_samples += site->_samples;
+      total_bytes += site->_bytes;
+    }
+  }
+  sites.sort(compare_sites);
+
+  st->print_cr("Allocation profile: %d sites, " SIZE_FORMAT " samples (" SIZE_FORMAT " dropped), "
+               "sampling interval %d bytes", _site_count, total_samples, _dropped_samples,
+               ThreadHeapSampler::get_sampling_interval());
+  int n = MIN2(max_sites_to_print, sites.length());
+  for (int i = 0; i < n; i++) {
+    AllocProfilerSite* site = sites.at(i);
+    st->cr();
+    st->print_cr("%5.1f%% " SIZE_FORMAT " samples, " SIZE_FORMAT " sampled bytes",
+                 total_bytes > 0 ? 100.0 * site->_bytes / total_bytes : 0.0,
+                 site->_samples, site->_bytes);
+    st->print("%s", site->_description);
+  }
+}
+
+void AllocationProfiler::reset() {
+  MutexLockerEx ml(AllocationProfiler_lock, Mutex::_no_safepoint_check_flag);
+  for (int i = 0; i < table_size; i++) {
+    AllocProfilerSite* site = _table[i];
+    while (site != NULL) {
+      AllocProfilerSite* next = site->_next;
+      os::free(site->_description);
+      delete site;
+      site = next;
+    }
+    _table[i] = NULL;
+  }
+  _site_count = 0;
+  _dropped_samples = 0;
+}
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+
+#ifndef SHARE_VM_SERVICES_ALLOCATIONPROFILER_HPP
+#define SHARE_VM_SERVICES_ALLOCATIONPROFILER_HPP
+
+#include "memory/allocation.hpp"
+#include "oops/oopsHierarchy.hpp"
+
+class JavaThread;
+class outputStream;
+
+// Built-in allocation site profiler (-XX:+AllocationProfiling).
+//
+// Piggybacks on the ThreadHeapSampler that also drives the JVMTI
+// SampledObjectAlloc event: every sampled allocation is attributed to
+// the allocated class and the innermost Java frames of the allocating
+// thread, and aggregated in a fixed size table in the VM. The table is
+// printed with the VM.alloc_profile diagnostic command.
+class AllocationProfiler : AllStatic {
+ private:
+  static bool _enabled;
+
+ public:
+  static void initialize();
+  static bool is_enabled() { return _enabled; }
+
+  // Attribute one sampled allocation to its site
+  static void record_sample(JavaThread* thread, oop obj, size_t size_in_bytes);
+
+  // Print the max_sites sites with the most sampled bytes
+  static void print_on(outputStream* st, int max_sites);
+
+  // Forget all sites recorded so far
+  static void reset();
+};
+
+#endif // SHARE_VM_SERVICES_ALLOCATIONPROFILER_HPP
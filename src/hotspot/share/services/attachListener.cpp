@@ -258,6 +258,7 @@ jint dump_heap(AttachOperation* op, outputStream* out) {
 //
 // Input arguments :-
 //   arg0: "-live" or "-all"
+//   arg1: Number of parallel threads, 0 (the default) lets the VM decide
 static jint heap_inspection(AttachOperation* op, outputStream* out) {
   bool live_objects_only = true;   // default is true to retain the behavior before this change is made
   const char* arg0 = op->arg(0);
@@ -268,7 +269,20 @@ static jint heap_inspection(AttachOperation* op, outputStream* out) {
     }
     live_objects_only = strcmp(arg0, "-live") == 0;
   }
+
+  uint parallel_thread_num = 0;
+  const char* arg1 = op->arg(1);
+  if (arg1 != NULL && (strlen(arg1) > 0)) {
+    uintx num;
+    if (!Arguments::parse_uintx(arg1, &num, 0)) {
+      out->print_cr("Invalid parallel thread number: [%s]", arg1);
+      return JNI_ERR;
+    }
+    parallel_thread_num = (uint)MIN2(num, (uintx)max_juint);
+  }
+
   VM_GC_HeapInspection heapop(out, live_objects_only /* request full gc */);
+  heapop.set_parallel_thread_num(parallel_thread_num);
   VMThread::execute(&heapop);
   return JNI_OK;
 }
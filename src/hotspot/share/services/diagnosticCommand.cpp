@@ -28,7 +28,9 @@
 #include "classfile/classLoaderStats.hpp"
 #include "classfile/compactHashtable.hpp"
 #include "compiler/compileBroker.hpp"
+#include "compiler/compileWarmup.hpp"
 #include "compiler/directivesParser.hpp"
+#include "gc/shared/gcThreadCPUTime.hpp"
 #include "gc/shared/vmGCOperations.hpp"
 #include "memory/metaspace/metaspaceDCmd.hpp"
 #include "memory/resourceArea.hpp"
@@ -40,7 +42,9 @@
 #include "runtime/handles.inline.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
 #include "runtime/javaCalls.hpp"
+#include "runtime/mutexLocker.hpp"
 #include "runtime/os.hpp"
+#include "services/allocationProfiler.hpp"
 #include "services/diagnosticArgument.hpp"
 #include "services/diagnosticCommand.hpp"
 #include "services/diagnosticFramework.hpp"
@@ -85,6 +89,7 @@ void DCmdRegistrant::register_dcmds(){
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<SystemGCDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<RunFinalizationDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<HeapInfoDCmd>(full_export, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<GCCPUStatsDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<FinalizerInfoDCmd>(full_export, true, false));
 #if INCLUDE_SERVICES
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<HeapDumpDCmd>(DCmd_Source_Internal | DCmd_Source_AttachAPI, true, false));
@@ -103,6 +108,8 @@ void DCmdRegistrant::register_dcmds(){
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<JVMTIDataDumpDCmd>(full_export, true, false));
 #endif // INCLUDE_JVMTI
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<ThreadDumpDCmd>(full_export, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<AllocationProfileDCmd>(full_export, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<LockStatsDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<ClassLoaderStatsDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<ClassLoaderHierarchyDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<CompileQueueDCmd>(full_export, true, false));
@@ -115,6 +122,7 @@ void DCmdRegistrant::register_dcmds(){
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<CompilerDirectivesAddDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<CompilerDirectivesRemoveDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<CompilerDirectivesClearDCmd>(full_export, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<CompilerWarmupDumpDCmd>(full_export, true, false));
 
   // Enhanced JMX Agent Support
   // These commands won't be exported via the DiagnosticCommandMBean until an
@@ -452,6 +460,10 @@ void HeapInfoDCmd::execute(DCmdSource source, TRAPS) {
   Universe::heap()->print_on(output());
 }
 
+void GCCPUStatsDCmd::execute(DCmdSource source, TRAPS) {
+  GCThreadCPUTime::print_on(output());
+}
+
 void FinalizerInfoDCmd::execute(DCmdSource source, TRAPS) {
   ResourceMark rm;
 
@@ -504,17 +516,31 @@ HeapDumpDCmd::HeapDumpDCmd(outputStream* output, bool heap) :
                            DCmdWithParser(output, heap),
   _filename("filename","Name of the dump file", "STRING",true),
   _all("-all", "Dump all objects, including unreachable objects",
-       "BOOLEAN", false, "false") {
+       "BOOLEAN", false, "false"),
+  _gzip("-gz", "If specified, the heap dump is written in gzipped format "
+               "using the given compression level. 1 (recommended) is the fastest, "
+               "9 the strongest compression.", "INT", false, "1") {
   _dcmdparser.add_dcmd_option(&_all);
+  _dcmdparser.add_dcmd_option(&_gzip);
   _dcmdparser.add_dcmd_argument(&_filename);
 }
 
 void HeapDumpDCmd::execute(DCmdSource source, TRAPS) {
+  jlong level = 0; // no compression
+
+  if (_gzip.is_set()) {
+    level = _gzip.value();
+    if (level < 1 || level > 9) {
+      output()->print_cr("Compression level out of range (1-9): " JLONG_FORMAT, level);
+      return;
+    }
+  }
+
   // Request a full GC before heap dump if _all is false
   // This helps reduces the amount of unreachable objects in the dump
   // and makes it easier to browse.
   HeapDumper dumper(!_all.value() /* request GC if _all is false*/);
-  int res = dumper.dump(_filename.value());
+  int res = dumper.dump(_filename.value(), (int)level);
   if (res == 0) {
     output()->print_cr("Heap dump file created");
   } else {
@@ -543,13 +569,27 @@ int HeapDumpDCmd::num_arguments() {
 ClassHistogramDCmd::ClassHistogramDCmd(outputStream* output, bool heap) :
                                        DCmdWithParser(output, heap),
   _all("-all", "Inspect all objects, including unreachable objects",
-       "BOOLEAN", false, "false") {
+       "BOOLEAN", false, "false"),
+  _parallel_thread_num("-parallel",
+       "Number of parallel threads to use for heap inspection. "
+       "0 (the default) means let the VM determine the number of threads to use. "
+       "1 means use one thread (disable parallelism). "
+       "For any other value the VM will try to use the specified number of "
+       "threads, but might use fewer.",
+       "INT", false, "0") {
   _dcmdparser.add_dcmd_option(&_all);
+  _dcmdparser.add_dcmd_option(&_parallel_thread_num);
 }
 
 void ClassHistogramDCmd::execute(DCmdSource source, TRAPS) {
+  jlong num = _parallel_thread_num.value();
+  if (num < 0) {
+    output()->print_cr("Parallel thread number out of range (>=0): " JLONG_FORMAT, num);
+    return;
+  }
   VM_GC_HeapInspection heapop(output(),
                               !_all.value() /* request full gc if false */);
+  heapop.set_parallel_thread_num((uint)MIN2(num, (jlong)max_juint));
   VMThread::execute(&heapop);
 }
 
@@ -617,6 +657,64 @@ int ClassStatsDCmd::num_arguments() {
 }
 #endif // INCLUDE_SERVICES
 
+AllocationProfileDCmd::AllocationProfileDCmd(outputStream* output, bool heap) :
+                                             DCmdWithParser(output, heap),
+  _top("-top", "Number of allocation sites to print", "INT", false, "20"),
+  _reset("-reset", "Clear the recorded sites after printing them",
+         "BOOLEAN", false, "false") {
+  _dcmdparser.add_dcmd_option(&_top);
+  _dcmdparser.add_dcmd_option(&_reset);
+}
+
+void AllocationProfileDCmd::execute(DCmdSource source, TRAPS) {
+  jlong top = _top.value();
+  if (top < 0) {
+    output()->print_cr("Number of sites out of range (>=0): " JLONG_FORMAT, top);
+    return;
+  }
+  AllocationProfiler::print_on(output(), (int)MIN2(top, (jlong)max_jint));
+  if (_reset.value()) {
+    AllocationProfiler::reset();
+  }
+}
+
+int AllocationProfileDCmd::num_arguments() {
+  ResourceMark rm;
+  AllocationProfileDCmd* dcmd = new AllocationProfileDCmd(NULL, false);
+  if (dcmd != NULL) {
+    DCmdMark mark(dcmd);
+    return dcmd->_dcmdparser.num_arguments();
+  } else {
+    return 0;
+  }
+}
+
+LockStatsDCmd::LockStatsDCmd(outputStream* output, bool heap) :
+                             DCmdWithParser(output, heap),
+  _reset("-reset", "Clear the statistics after printing them",
+         "BOOLEAN", false, "false") {
+  _dcmdparser.add_dcmd_option(&_reset);
+}
+
+void LockStatsDCmd::execute(DCmdSource source, TRAPS) {
+  if (!LockContentionProfiling) {
+    output()->print_cr("Lock contention profiling is disabled; use -XX:+LockContentionProfiling");
+    return;
+  }
+  print_lock_contention_stats_on(output(), _reset.value());
+}
+
+int LockStatsDCmd::num_arguments() {
+  ResourceMark rm;
+  LockStatsDCmd* dcmd = new LockStatsDCmd(NULL, false);
+  if (dcmd != NULL) {
+    DCmdMark mark(dcmd);
+    return dcmd->_dcmdparser.num_arguments();
+  } else {
+    return 0;
+  }
+}
+
 ThreadDumpDCmd::ThreadDumpDCmd(outputStream* output, bool heap) :
                                DCmdWithParser(output, heap),
   _locks("-l", "print java.util.concurrent locks", "BOOLEAN", false, "false"),
@@ -997,6 +1095,27 @@ int CompilerDirectivesAddDCmd::num_arguments() {
   }
 }
 
+CompilerWarmupDumpDCmd::CompilerWarmupDumpDCmd(outputStream* output, bool heap) :
+                       DCmdWithParser(output, heap),
+  _filename("filename", "Name of the file to write", "STRING", true) {
+  _dcmdparser.add_dcmd_argument(&_filename);
+}
+
+void CompilerWarmupDumpDCmd::execute(DCmdSource source, TRAPS) {
+  CompileWarmup::dump(_filename.value(), output());
+}
+
+int CompilerWarmupDumpDCmd::num_arguments() {
+  ResourceMark rm;
+  CompilerWarmupDumpDCmd* dcmd = new CompilerWarmupDumpDCmd(NULL, false);
+  if (dcmd != NULL) {
+    DCmdMark mark(dcmd);
+    return dcmd->_dcmdparser.num_arguments();
+  } else {
+    return 0;
+  }
+}
+
 void CompilerDirectivesRemoveDCmd::execute(DCmdSource source, TRAPS) {
   DirectivesStack::pop(1);
 }
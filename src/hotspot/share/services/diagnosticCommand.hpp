@@ -305,6 +305,26 @@ public:
   virtual void execute(DCmdSource source, TRAPS);
 };
 
+class GCCPUStatsDCmd : public DCmd {
+public:
+  GCCPUStatsDCmd(outputStream* output, bool heap) : DCmd(output, heap) { }
+  static const char* name() { return "GC.cpu_stats"; }
+  static const char* description() {
+    return "Print CPU time used by GC threads and by concurrent GC phases.";
+  }
+  static const char* impact() {
+    return "Low";
+  }
+  static int num_arguments() { return 0; }
+  static const JavaPermission permission() {
+    JavaPermission p = {"java.lang.management.ManagementPermission",
+      "monitor", NULL};
+      return p;
+  }
+
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
 class FinalizerInfoDCmd : public DCmd {
 public:
   FinalizerInfoDCmd(outputStream* output, bool heap) : DCmd(output, heap) { }
@@ -331,6 +351,7 @@ class HeapDumpDCmd : public DCmdWithParser {
 protected:
   DCmdArgument<char*> _filename;
   DCmdArgument<bool>  _all;
+  DCmdArgument<jlong> _gzip;
 public:
   HeapDumpDCmd(outputStream* output, bool heap);
   static const char* name() {
@@ -357,6 +378,7 @@ public:
 class ClassHistogramDCmd : public DCmdWithParser {
 protected:
   DCmdArgument<bool> _all;
+  DCmdArgument<jlong> _parallel_thread_num;
 public:
   ClassHistogramDCmd(outputStream* output, bool heap);
   static const char* name() {
@@ -442,6 +464,55 @@ public:
   virtual void execute(DCmdSource source, TRAPS);
 };
 
+class AllocationProfileDCmd : public DCmdWithParser {
+protected:
+  DCmdArgument<jlong> _top;
+  DCmdArgument<bool>  _reset;
+public:
+  AllocationProfileDCmd(outputStream* output, bool heap);
+  static const char* name() {
+    return "VM.alloc_profile";
+  }
+  static const char* description() {
+    return "Print the allocation sites with the most sampled bytes. "
+           "Requires -XX:+AllocationProfiling.";
+  }
+  static const char* impact() {
+    return "Low: Depends on the number of recorded allocation sites.";
+  }
+  static const JavaPermission permission() {
+    JavaPermission p = {"java.lang.management.ManagementPermission",
+                        "monitor", NULL};
+    return p;
+  }
+  static int num_arguments();
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
+class LockStatsDCmd : public DCmdWithParser {
+protected:
+  DCmdArgument<bool> _reset;
+public:
+  LockStatsDCmd(outputStream* output, bool heap);
+  static const char* name() {
+    return "VM.lock_stats";
+  }
+  static const char* description() {
+    return "Print contention statistics of the named VM-internal locks. "
+           "Requires -XX:+LockContentionProfiling.";
+  }
+  static const char* impact() {
+    return "Low";
+  }
+  static const JavaPermission permission() {
+    JavaPermission p = {"java.lang.management.ManagementPermission",
+                        "monitor", NULL};
+    return p;
+  }
+  static int num_arguments();
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
 // See also: thread_dump in attachListener.cpp
 class ThreadDumpDCmd : public DCmdWithParser {
 protected:
@@ -734,6 +805,29 @@ public:
   virtual void execute(DCmdSource source, TRAPS);
 };
 
+class CompilerWarmupDumpDCmd : public DCmdWithParser {
+protected:
+  DCmdArgument<char*> _filename;
+public:
+  CompilerWarmupDumpDCmd(outputStream* output, bool heap);
+  static const char* name() {
+    return "Compiler.warmup_dump";
+  }
+  static const char* description() {
+    return "Write the methods compiled at tier 3 or above to a file for use with -XX:CompileWarmupFile.";
+  }
+  static const char* impact() {
+    return "Medium: Depends on the number of loaded classes.";
+  }
+  static const JavaPermission permission() {
+    JavaPermission p = {"java.lang.management.ManagementPermission",
+                        "monitor", NULL};
+    return p;
+  }
+  static int num_arguments();
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
 class CompilerDirectivesClearDCmd : public DCmd {
 public:
   CompilerDirectivesClearDCmd(outputStream* output, bool heap) : DCmd(output, heap) {}
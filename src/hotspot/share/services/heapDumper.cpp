@@ -24,11 +24,13 @@
 
 #include "precompiled.hpp"
 #include "jvm.h"
+#include "classfile/classLoader.hpp"
 #include "classfile/symbolTable.hpp"
 #include "classfile/systemDictionary.hpp"
 #include "classfile/vmSymbols.hpp"
 #include "gc/shared/gcLocker.hpp"
 #include "gc/shared/vmGCOperations.hpp"
+#include "gc/shared/workgroup.hpp"
 #include "memory/allocation.inline.hpp"
 #include "memory/resourceArea.hpp"
 #include "memory/universe.hpp"
@@ -40,6 +42,7 @@
 #include "runtime/handles.inline.hpp"
 #include "runtime/javaCalls.hpp"
 #include "runtime/jniHandles.hpp"
+#include "runtime/mutexLocker.hpp"
 #include "runtime/os.inline.hpp"
 #include "runtime/reflectionUtils.hpp"
 #include "runtime/thread.inline.hpp"
@@ -373,64 +376,172 @@ enum {
   INITIAL_CLASS_COUNT = 200
 };
 
-// Supports I/O operations on a dump file
+// Supports I/O operations on a dump file. The file is shared by all
+// writers of a dump and serializes the writes of their buffers.
+
+class DumpFile : public StackObj {
+ private:
+  int    _fd;             // file descriptor (-1 if dump file not open)
+  julong _bytes_written;  // number of byte written to dump file
+  int    _compression;    // gzip compression level (0 if not compressed)
+  char*  _error;          // error message when I/O fails
+  Mutex  _lock;           // serializes writes of parallel writers
+
+  void set_error_locked(const char* error);
+
+ public:
+  DumpFile(const char* path, int compression);
+  ~DumpFile();
+
+  void close();
+  bool is_open() const                  { return _fd >= 0; }
+
+  // gzip compression level, 0 if the dump is not compressed
+  int compression() const               { return _compression; }
+
+  // total number of bytes written to the disk
+  julong bytes_written() const          { return _bytes_written; }
+
+  char* error() const                   { return _error; }
+  void set_error(const char* error);
+
+  // held by a writer that writes a sub-record which spans several
+  // buffers, so that no other writer can interleave its output
+  Mutex* lock()                         { return &_lock; }
+
+  // write directly to the file, the caller must hold the lock
+  void write_locked(const char* s, size_t len);
+  void write(const char* s, size_t len);
+};
+
+DumpFile::DumpFile(const char* path, int compression) :
+    _fd(-1),
+    _bytes_written(0),
+    _compression(compression),
+    _error(NULL),
+    _lock(Mutex::leaf, "Heap dump file lock", false, Mutex::_safepoint_check_never) {
+  if (_compression > 0 && !ClassLoader::has_gzip()) {
+    _error = os::strdup("gzip compression is not supported by the zip library");
+    return;
+  }
+
+  _fd = os::create_binary_file(path, false);    // don't replace existing file
+
+  // if the open failed we record the error
+  if (_fd < 0) {
+    _error = os::strdup(os::strerror(errno));
+  }
+}
+
+DumpFile::~DumpFile() {
+  close();
+  if (_error != NULL) os::free(_error);
+}
+
+// closes dump file (if open)
+void DumpFile::close() {
+  if (is_open()) {
+    os::close(_fd);
+    _fd = -1;
+  }
+}
+
+// records the first error and closes the file, so that all
+// writers stop writing
+void DumpFile::set_error_locked(const char* error) {
+  if (_error == NULL) {
+    _error = os::strdup(error);
+  }
+  close();
+}
+
+void DumpFile::set_error(const char* error) {
+  if (_lock.owned_by_self()) {
+    set_error_locked(error);
+  } else {
+    MutexLockerEx ml(&_lock, Mutex::_no_safepoint_check_flag);
+    set_error_locked(error);
+  }
+}
+
+void DumpFile::write_locked(const char* s, size_t len) {
+  assert(_lock.owned_by_self(), "Should be locked");
+  while (is_open() && len > 0) {
+    uint tmp = (uint)MIN2(len, (size_t)UINT_MAX);
+    ssize_t n = os::write(_fd, s, tmp);
+
+    if (n < 0) {
+      // EINTR cannot happen here, os::write will take care of that
+      set_error_locked(os::strerror(errno));
+      return;
+    }
+
+    _bytes_written += n;
+    s += n;
+    len -= n;
+  }
+}
+
+void DumpFile::write(const char* s, size_t len) {
+  MutexLockerEx ml(&_lock, Mutex::_no_safepoint_check_flag);
+  write_locked(s, len);
+}
+
+// Buffers the records written by one thread. Heap dump sub-records are
+// grouped into HPROF_HEAP_DUMP_SEGMENT records which are kept in the
+// buffer until they are complete, so that the segment length can be
+// fixed up without seeking and the buffer can be compressed on its own.
+// Each flushed buffer holds complete segments only, which allows several
+// writers to share the same dump file. If compression is enabled, each
+// flushed buffer is written as a separate gzip member.
 
 class DumpWriter : public StackObj {
  private:
   enum {
-    io_buffer_size  = 8*M
+    io_buffer_size           = 8*M,
+    dump_segment_header_size = 9    // tag, ticks and length
   };
 
-  int _fd;              // file descriptor (-1 if dump file not open)
-  julong _bytes_written; // number of byte written to dump file
+  DumpFile* _file;
 
   char* _buffer;    // internal buffer
   size_t _size;
   size_t _pos;
 
-  jlong _dump_start;
+  char* _compressed; // buffer for the compressed output
+  size_t _compressed_size;
 
-  char* _error;   // error message when I/O fails
-
-  void set_file_descriptor(int fd)              { _fd = fd; }
-  int file_descriptor() const                   { return _fd; }
+  size_t _segment_start;      // buffer position of the current segment header
+  bool _in_dump_segment;      // a segment has been started
+  bool _is_huge_sub_record;   // the current sub-record does not fit in the buffer
 
   char* buffer() const                          { return _buffer; }
   size_t buffer_size() const                    { return _size; }
   size_t position() const                       { return _pos; }
   void set_position(size_t pos)                 { _pos = pos; }
 
-  void set_error(const char* error)             { _error = (char*)os::strdup(error); }
-
-  // all I/O go through this function
-  void write_internal(void* s, size_t len);
+  bool grow_buffer();
+  void write_buffer(const char* s, size_t len);
 
  public:
-  DumpWriter(const char* path);
+  DumpWriter(DumpFile* file);
   ~DumpWriter();
 
-  void close();
-  bool is_open() const                  { return file_descriptor() >= 0; }
+  DumpFile* file() const                { return _file; }
+  bool is_open() const                  { return _file->is_open(); }
   void flush();
 
-  jlong dump_start() const                      { return _dump_start; }
-  void set_dump_start(jlong pos);
-  julong current_record_length();
-
-  // total number of bytes written to the disk
-  julong bytes_written() const          { return _bytes_written; }
-
-  // adjust the number of bytes written to disk (used to keep the count
-  // of the number of bytes written in case of rewrites)
-  void adjust_bytes_written(jlong n)    { _bytes_written += n; }
+  // starts a new HPROF_HEAP_DUMP_SEGMENT record
+  void start_dump_segment();
+  // fixes up the length of the current HPROF_HEAP_DUMP_SEGMENT record
+  void finish_dump_segment();
 
-  // number of (buffered) bytes as yet unwritten to the dump file
-  size_t bytes_unwritten() const        { return position(); }
-
-  char* error() const                   { return _error; }
-
-  jlong current_offset();
-  void seek_to_offset(jlong pos);
+  // called before a sub-record of the given length is written, only
+  // needed for sub-records which might not fit in the buffer
+  void start_sub_record(size_t len);
+  // called on a sub-record boundary, starts a new segment when the
+  // buffer is almost full
+  void end_sub_record();
 
   // writer functions
   void write_raw(void* s, size_t len);
@@ -444,7 +555,13 @@ class DumpWriter : public StackObj {
   void write_id(u4 x);
 };
 
-DumpWriter::DumpWriter(const char* path) {
+DumpWriter::DumpWriter(DumpFile* file) :
+    _file(file),
+    _compressed(NULL),
+    _compressed_size(0),
+    _segment_start(0),
+    _in_dump_segment(false),
+    _is_huge_sub_record(false) {
   // try to allocate an I/O buffer of io_buffer_size. If there isn't
   // sufficient memory then reduce size until we can allocate something.
   _size = io_buffer_size;
@@ -453,127 +570,199 @@ DumpWriter::DumpWriter(const char* path) {
     if (_buffer == NULL) {
       _size = _size >> 1;
     }
-  } while (_buffer == NULL && _size > 0);
-  assert((_size > 0 && _buffer != NULL) || (_size == 0 && _buffer == NULL), "sanity check");
+  } while (_buffer == NULL && _size > dump_segment_header_size);
   _pos = 0;
-  _error = NULL;
-  _bytes_written = 0L;
-  _dump_start = (jlong)-1;
-  _fd = os::create_binary_file(path, false);    // don't replace existing file
 
-  // if the open failed we record the error
-  if (_fd < 0) {
-    _error = (char*)os::strdup(os::strerror(errno));
+  if (_buffer == NULL) {
+    _size = 0;
+    _file->set_error("Unable to allocate heap dump buffer");
   }
 }
 
 DumpWriter::~DumpWriter() {
-  // flush and close dump file
-  if (is_open()) {
-    close();
-  }
+  assert(!_is_huge_sub_record, "Sub-record not ended");
+  finish_dump_segment();
+  flush();
   if (_buffer != NULL) os::free(_buffer);
-  if (_error != NULL) os::free(_error);
+  if (_compressed != NULL) os::free(_compressed);
 }
 
-// closes dump file (if open)
-void DumpWriter::close() {
-  // flush and close dump file
-  if (is_open()) {
-    flush();
-    os::close(file_descriptor());
-    set_file_descriptor(-1);
+// the segment header of an unfinished segment has to stay in the
+// buffer, so the buffer grows instead of being flushed
+bool DumpWriter::grow_buffer() {
+  const size_t size = buffer_size() * 2;
+  char* const buffer = (char*)os::realloc(_buffer, size, mtInternal);
+  if (buffer == NULL) {
+    _file->set_error("Unable to grow heap dump buffer");
+    return false;
   }
-}
 
-// sets the dump starting position
-void DumpWriter::set_dump_start(jlong pos) {
-  _dump_start = pos;
+  _buffer = buffer;
+  _size = size;
+  return true;
 }
 
-julong DumpWriter::current_record_length() {
-  if (is_open()) {
-    // calculate the size of the dump record
-    julong dump_end = bytes_written() + bytes_unwritten();
-    assert(dump_end == (size_t)current_offset(), "checking");
-    julong dump_len = dump_end - dump_start() - 4;
-    return dump_len;
+// hands the bytes to the file, holding the lock only if it is not
+// already held for a huge sub-record
+void DumpWriter::write_buffer(const char* s, size_t len) {
+  if (_is_huge_sub_record) {
+    _file->write_locked(s, len);
+  } else {
+    _file->write(s, len);
   }
-  return 0;
 }
 
-// write directly to the file
-void DumpWriter::write_internal(void* s, size_t len) {
-  if (is_open()) {
-    const char* pos = (char*)s;
-    ssize_t n = 0;
-    while (len > 0) {
-      uint tmp = (uint)MIN2(len, (size_t)UINT_MAX);
-      n = os::write(file_descriptor(), pos, tmp);
-
-      if (n < 0) {
-        // EINTR cannot happen here, os::write will take care of that
-        set_error(os::strerror(errno));
-        os::close(file_descriptor());
-        set_file_descriptor(-1);
-        return;
+// write raw bytes
+void DumpWriter::write_raw(void* s, size_t len) {
+  const char* pos = (const char*)s;
+  while (is_open() && len > 0) {
+    if (position() == buffer_size()) {
+      // make room
+      if (_in_dump_segment && !_is_huge_sub_record) {
+        if (!grow_buffer()) {
+          return;
+        }
+      } else {
+        flush();
       }
-
-      _bytes_written += n;
-      pos += n;
-      len -= n;
     }
+
+    const size_t n = MIN2(len, buffer_size() - position());
+    memcpy(buffer() + position(), pos, n);
+    set_position(position() + n);
+    pos += n;
+    len -= n;
   }
 }
 
-// write raw bytes
-void DumpWriter::write_raw(void* s, size_t len) {
-  if (is_open()) {
-    // flush buffer to make room
-    if ((position() + len) >= buffer_size()) {
-      flush();
-    }
+// flush any buffered bytes to the file, compressing them if requested
+void DumpWriter::flush() {
+  if (!is_open() || position() == 0) {
+    return;
+  }
 
-    // buffer not available or too big to buffer it
-    if ((buffer() == NULL) || (len >= buffer_size())) {
-      write_internal(s, len);
-    } else {
-      // Should optimize this for u1/u2/u4/u8 sizes.
-      memcpy(buffer() + position(), s, len);
-      set_position(position() + len);
+  assert(!_in_dump_segment || _is_huge_sub_record, "Unfinished segment");
+
+  if (_file->compression() == 0) {
+    write_buffer(buffer(), position());
+    set_position(0);
+    return;
+  }
+
+  // zlib bound for the deflated data, plus the gzip header and trailer
+  const size_t len = position();
+  const size_t bound = len + (len >> 12) + (len >> 14) + (len >> 25) + 13 + 18;
+  if (_compressed_size < bound) {
+    char* const compressed = (char*)os::realloc(_compressed, bound, mtInternal);
+    if (compressed == NULL) {
+      _file->set_error("Unable to allocate heap dump compression buffer");
+      return;
     }
+    _compressed = compressed;
+    _compressed_size = bound;
+  }
+
+  char* msg = NULL;
+  const u8 compressed_len = ClassLoader::gzip(buffer(), len, _compressed, _compressed_size,
+                                              _file->compression(), &msg);
+  if (compressed_len == 0) {
+    _file->set_error((msg != NULL) ? msg : "gzip compression failed");
+    return;
   }
+
+  write_buffer(_compressed, (size_t)compressed_len);
+  set_position(0);
 }
 
-// flush any buffered bytes to the file
-void DumpWriter::flush() {
-  if (is_open() && position() > 0) {
-    write_internal(buffer(), position());
-    set_position(0);
+void DumpWriter::start_dump_segment() {
+  assert(!_in_dump_segment, "Segment already started");
+  if (!is_open()) {
+    return;
   }
+
+  // the header must not be split by a flush
+  if (buffer_size() - position() < dump_segment_header_size) {
+    flush();
+  }
+
+  _segment_start = position();
+  _in_dump_segment = true;
+
+  write_u1(HPROF_HEAP_DUMP_SEGMENT);
+  write_u4(0); // current ticks
+  write_u4(0); // length, fixed up when the segment is finished
 }
 
-jlong DumpWriter::current_offset() {
-  if (is_open()) {
-    // the offset is the file offset plus whatever we have buffered
-    jlong offset = os::current_file_offset(file_descriptor());
-    assert(offset >= 0, "lseek failed");
-    return offset + position();
-  } else {
-    return (jlong)-1;
+void DumpWriter::finish_dump_segment() {
+  if (!_in_dump_segment) {
+    return;
   }
+
+  _in_dump_segment = false;
+
+  if (!is_open() || _is_huge_sub_record) {
+    // the length of a huge sub-record segment is written up front
+    return;
+  }
+
+  const size_t len = position() - _segment_start - dump_segment_header_size;
+  if (len == 0) {
+    // drop empty segment
+    set_position(_segment_start);
+    return;
+  }
+
+  // record length must fit in a u4
+  if (len > max_juint) {
+    warning("record is too large");
+  }
+
+  Bytes::put_Java_u4((address)(buffer() + _segment_start + 5), (u4)len);
 }
 
-void DumpWriter::seek_to_offset(jlong off) {
-  assert(off >= 0, "bad offset");
+void DumpWriter::start_sub_record(size_t len) {
+  if (!is_open()) {
+    return;
+  }
+
+  assert(_in_dump_segment && !_is_huge_sub_record, "Should be in a segment");
+  if (position() + len <= buffer_size()) {
+    // fits in the current segment
+    return;
+  }
 
-  // need to flush before seeking
+  finish_dump_segment();
   flush();
 
-  // may be closed due to I/O error
-  if (is_open()) {
-    jlong n = os::seek_to_file_offset(file_descriptor(), off);
-    assert(n >= 0, "lseek failed");
+  if (dump_segment_header_size + len <= buffer_size()) {
+    // fits in a new segment
+    start_dump_segment();
+    return;
+  }
+
+  // Too large for the buffer. The sub-record gets a segment of its own,
+  // with the length known up front, and the file stays locked until the
+  // sub-record has been written.
+  _file->lock()->lock_without_safepoint_check();
+  _is_huge_sub_record = true;
+  _in_dump_segment = true;
+
+  write_u1(HPROF_HEAP_DUMP_SEGMENT);
+  write_u4(0);        // current ticks
+  write_u4((u4)len);  // length
+}
+
+void DumpWriter::end_sub_record() {
+  if (_is_huge_sub_record) {
+    flush();
+    _in_dump_segment = false;
+    _is_huge_sub_record = false;
+    _file->lock()->unlock();
+    start_dump_segment();
+  } else if (_in_dump_segment && position() > buffer_size() - buffer_size() / 8) {
+    finish_dump_segment();
+    flush();
+    start_dump_segment();
   }
 }
 
@@ -675,12 +864,6 @@ class DumperSupport : AllStatic {
   // check if we need to truncate an array
   static int calculate_array_max_length(DumpWriter* writer, arrayOop array, short header_size);
 
-  // writes a HPROF_HEAP_DUMP_SEGMENT record
-  static void write_dump_header(DumpWriter* writer);
-
-  // fixes up the length of the current dump record
-  static void write_current_dump_record_length(DumpWriter* writer);
-
   // fixes up the current dump record and writes HPROF_HEAP_DUMP_END record
   static void end_of_dump(DumpWriter* writer);
 };
@@ -1101,19 +1284,8 @@ int DumperSupport::calculate_array_max_length(DumpWriter* writer, arrayOop array
 
   size_t length_in_bytes = (size_t)length * type_size;
 
-  // Create a new record if the current record is non-empty and the array can't fit.
-  julong current_record_length = writer->current_record_length();
-  if (current_record_length > 0 &&
-      (current_record_length + header_size + length_in_bytes) > max_juint) {
-    write_current_dump_record_length(writer);
-    write_dump_header(writer);
-
-    // We now have an empty record.
-    current_record_length = 0;
-  }
-
   // Calculate max bytes we can use.
-  uint max_bytes = max_juint - (header_size + current_record_length);
+  uint max_bytes = max_juint - header_size;
 
   // Array too long for the record?
   // Calculate max length and return it.
@@ -1124,6 +1296,10 @@ int DumperSupport::calculate_array_max_length(DumpWriter* writer, arrayOop array
     warning("cannot dump array of type %s[] with length %d; truncating to length %d",
             type2name_tab[type], array->length(), length);
   }
+
+  // Large arrays might need a segment of their own
+  writer->start_sub_record(header_size + length_in_bytes);
+
   return length;
 }
 
@@ -1319,6 +1495,7 @@ void JNILocalsDumper::do_oop(oop* obj_p) {
     writer()->write_objectID(o);
     writer()->write_u4(_thread_serial_num);
     writer()->write_u4((u4)_frame_num);
+    writer()->end_sub_record();
   }
 }
 
@@ -1349,6 +1526,7 @@ void JNIGlobalsDumper::do_oop(oop* obj_p) {
     writer()->write_u1(HPROF_GC_ROOT_JNI_GLOBAL);
     writer()->write_objectID(o);
     writer()->write_objectID((oopDesc*)obj_p);      // global ref ID
+    writer()->end_sub_record();
   }
 };
 
@@ -1366,6 +1544,7 @@ class MonitorUsedDumper : public OopClosure {
   void do_oop(oop* obj_p) {
     writer()->write_u1(HPROF_GC_ROOT_MONITOR_USED);
     writer()->write_objectID(*obj_p);
+    writer()->end_sub_record();
   }
   void do_oop(narrowOop* obj_p) { ShouldNotReachHere(); }
 };
@@ -1386,6 +1565,7 @@ class StickyClassDumper : public KlassClosure {
       InstanceKlass* ik = InstanceKlass::cast(k);
         writer()->write_u1(HPROF_GC_ROOT_STICKY_CLASS);
         writer()->write_classID(ik);
+        writer()->end_sub_record();
       }
     }
 };
@@ -1397,18 +1577,15 @@ class VM_HeapDumper;
 
 class HeapObjectDumper : public ObjectClosure {
  private:
-  VM_HeapDumper* _dumper;
   DumpWriter* _writer;
 
-  VM_HeapDumper* dumper()               { return _dumper; }
   DumpWriter* writer()                  { return _writer; }
 
   // used to indicate that a record has been writen
   void mark_end_of_record();
 
  public:
-  HeapObjectDumper(VM_HeapDumper* dumper, DumpWriter* writer) {
-    _dumper = dumper;
+  HeapObjectDumper(DumpWriter* writer) {
     _writer = writer;
   }
 
@@ -1439,6 +1616,32 @@ void HeapObjectDumper::do_object(oop o) {
   }
 }
 
+// Support class used when iterating over the heap in parallel. Each
+// worker dumps the objects it visits through a writer of its own, and
+// the writers hand complete heap dump segments to the shared dump file.
+
+class ParHeapObjectDumpTask : public AbstractGangTask {
+ private:
+  ParallelObjectIterator* _poi;
+  DumpFile*               _file;
+
+ public:
+  ParHeapObjectDumpTask(ParallelObjectIterator* poi, DumpFile* file) :
+    AbstractGangTask("Dumping heap"),
+    _poi(poi),
+    _file(file) {}
+
+  virtual void work(uint worker_id) {
+    ResourceMark rm;
+    DumpWriter writer(_file);
+    writer.start_dump_segment();
+    HeapObjectDumper obj_dumper(&writer);
+    _poi->object_iterate(&obj_dumper, worker_id);
+    writer.finish_dump_segment();
+    writer.flush();
+  }
+};
+
 // The VM operation that performs the heap dump
 class VM_HeapDumper : public VM_GC_Operation {
  private:
@@ -1525,8 +1728,6 @@ class VM_HeapDumper : public VM_GC_Operation {
   }
 
   VMOp_Type type() const { return VMOp_HeapDumper; }
-  // used to mark sub-record boundary
-  void check_segment_length();
   void doit();
 };
 
@@ -1537,62 +1738,10 @@ bool VM_HeapDumper::skip_operation() const {
   return false;
 }
 
- // writes a HPROF_HEAP_DUMP_SEGMENT record
-void DumperSupport::write_dump_header(DumpWriter* writer) {
-  if (writer->is_open()) {
-    writer->write_u1(HPROF_HEAP_DUMP_SEGMENT);
-    writer->write_u4(0); // current ticks
-
-    // record the starting position for the dump (its length will be fixed up later)
-    writer->set_dump_start(writer->current_offset());
-    writer->write_u4(0);
-  }
-}
-
-// fixes up the length of the current dump record
-void DumperSupport::write_current_dump_record_length(DumpWriter* writer) {
-  if (writer->is_open()) {
-    julong dump_end = writer->bytes_written() + writer->bytes_unwritten();
-    julong dump_len = writer->current_record_length();
-
-    // record length must fit in a u4
-    if (dump_len > max_juint) {
-      warning("record is too large");
-    }
-
-    // seek to the dump start and fix-up the length
-    assert(writer->dump_start() >= 0, "no dump start recorded");
-    writer->seek_to_offset(writer->dump_start());
-    writer->write_u4((u4)dump_len);
-
-    // adjust the total size written to keep the bytes written correct.
-    writer->adjust_bytes_written(-((jlong) sizeof(u4)));
-
-    // seek to dump end so we can continue
-    writer->seek_to_offset(dump_end);
-
-    // no current dump record
-    writer->set_dump_start((jlong)-1);
-  }
-}
-
-// used on a sub-record boundary to check if we need to start a
-// new segment.
-void VM_HeapDumper::check_segment_length() {
-  if (writer()->is_open()) {
-    julong dump_len = writer()->current_record_length();
-
-    if (dump_len > 2UL*G) {
-      DumperSupport::write_current_dump_record_length(writer());
-      DumperSupport::write_dump_header(writer());
-    }
-  }
-}
-
 // fixes up the current dump record and writes HPROF_HEAP_DUMP_END record
 void DumperSupport::end_of_dump(DumpWriter* writer) {
   if (writer->is_open()) {
-    write_current_dump_record_length(writer);
+    writer->finish_dump_segment();
 
     writer->write_u1(HPROF_HEAP_DUMP_END);
     writer->write_u4(0);
@@ -1602,7 +1751,7 @@ void DumperSupport::end_of_dump(DumpWriter* writer) {
 
 // marks sub-record boundary
 void HeapObjectDumper::mark_end_of_record() {
-  dumper()->check_segment_length();
+  writer()->end_sub_record();
 }
 
 // writes a HPROF_LOAD_CLASS record for the class (and each of its
@@ -1642,6 +1791,7 @@ void VM_HeapDumper::do_load_class(Klass* k) {
 void VM_HeapDumper::do_class_dump(Klass* k) {
   if (k->is_instance_klass()) {
     DumperSupport::dump_class_and_array_classes(writer(), k);
+    writer()->end_sub_record();
   }
 }
 
@@ -1649,6 +1799,7 @@ void VM_HeapDumper::do_class_dump(Klass* k) {
 // array (and each multi-dimensional array too)
 void VM_HeapDumper::do_basic_type_array_class_dump(Klass* k) {
   DumperSupport::dump_basic_type_array_class(writer(), k);
+  writer()->end_sub_record();
 }
 
 // Walk the stack of the given thread.
@@ -1762,6 +1913,7 @@ void VM_HeapDumper::do_threads() {
     int num_frames = do_thread(thread, thread_serial_num);
     assert(num_frames == _stack_traces[i]->get_stack_depth(),
            "total number of Java frames not matched");
+    writer()->end_sub_record();
   }
 }
 
@@ -1783,8 +1935,12 @@ void VM_HeapDumper::do_threads() {
 // unknown object alloc site.
 //
 // Each HPROF_HEAP_DUMP_SEGMENT record has a length followed by sub-records.
-// To allow the heap dump be generated in a single pass we remember the position
-// of the dump length and fix it up after all sub-records have been written.
+// To allow the heap dump be generated in a single pass, and without seeking,
+// each segment is kept in the buffer of its writer until it is complete and
+// its length has been fixed up. Sub-records too large for the buffer get a
+// segment of their own with the length written up front. When the heap can
+// be iterated in parallel, the workers write segments of their own, in any
+// order, between the class dumps and the GC roots.
 // To generate the sub-records we iterate over the heap, writing
 // HPROF_GC_INSTANCE_DUMP, HPROF_GC_OBJ_ARRAY_DUMP, and HPROF_GC_PRIM_ARRAY_DUMP
 // records as we go. Once that is done we write records for some of the GC
@@ -1834,37 +1990,48 @@ void VM_HeapDumper::doit() {
   dump_stack_traces();
 
   // write HPROF_HEAP_DUMP_SEGMENT
-  DumperSupport::write_dump_header(writer());
+  writer()->start_dump_segment();
 
   // Writes HPROF_GC_CLASS_DUMP records
   ClassLoaderDataGraph::classes_do(&do_class_dump);
   Universe::basic_type_classes_do(&do_basic_type_array_class_dump);
-  check_segment_length();
 
   // writes HPROF_GC_INSTANCE_DUMP records.
-  // After each sub-record is written check_segment_length will be invoked
+  // After each sub-record is written end_sub_record will be invoked
   // to check if the current segment exceeds a threshold. If so, a new
   // segment is started.
   // The HPROF_GC_CLASS_DUMP and HPROF_GC_INSTANCE_DUMP are the vast bulk
   // of the heap dump.
-  HeapObjectDumper obj_dumper(this, writer());
-  Universe::heap()->safe_object_iterate(&obj_dumper);
+  CollectedHeap* const heap = Universe::heap();
+  WorkGang* const workers = heap->get_safepoint_workers();
+  ParallelObjectIterator* const poi = (workers != NULL) ? heap->parallel_object_iterator(workers->active_workers()) : NULL;
+  if (poi != NULL) {
+    // Dump the heap in parallel, if the heap supports it. The records
+    // written so far are flushed first, since the segments written by
+    // the workers must follow them in the file.
+    writer()->finish_dump_segment();
+    writer()->flush();
+    ParHeapObjectDumpTask task(poi, writer()->file());
+    workers->run_task(&task);
+    delete poi;
+    writer()->start_dump_segment();
+  } else {
+    HeapObjectDumper obj_dumper(writer());
+    heap->safe_object_iterate(&obj_dumper);
+  }
 
   // HPROF_GC_ROOT_THREAD_OBJ + frames + jni locals
   do_threads();
-  check_segment_length();
 
   // HPROF_GC_ROOT_MONITOR_USED
   MonitorUsedDumper mon_dumper(writer());
   ObjectSynchronizer::oops_do(&mon_dumper);
-  check_segment_length();
 
   // HPROF_GC_ROOT_JNI_GLOBAL
   JNIGlobalsDumper jni_dumper(writer());
   JNIHandles::oops_do(&jni_dumper);
   Universe::oops_do(&jni_dumper);  // technically not jni roots, but global roots
                                    // for things like preallocated throwable backtraces
-  check_segment_length();
 
   // HPROF_GC_ROOT_STICKY_CLASS
   // These should be classes in the NULL class loader data, and not all classes
@@ -1935,8 +2102,9 @@ void VM_HeapDumper::dump_stack_traces() {
 }
 
 // dump the heap to given path.
-int HeapDumper::dump(const char* path) {
+int HeapDumper::dump(const char* path, int compression) {
   assert(path != NULL && strlen(path) > 0, "path missing");
+  assert(compression >= 0 && compression <= 9, "invalid compression level");
 
   // print message in interactive case
   if (print_to_tty()) {
@@ -1944,10 +2112,11 @@ int HeapDumper::dump(const char* path) {
     timer()->start();
   }
 
-  // create the dump writer. If the file can be opened then bail
-  DumpWriter writer(path);
-  if (!writer.is_open()) {
-    set_error(writer.error());
+  // create the dump file and writer. If the file can be opened then bail
+  DumpFile file(path, compression);
+  DumpWriter writer(&file);
+  if (!file.is_open()) {
+    set_error(file.error());
     if (print_to_tty()) {
       tty->print_cr("Unable to create %s: %s", path,
         (error() != NULL) ? error() : "reason unknown");
@@ -1964,22 +2133,23 @@ int HeapDumper::dump(const char* path) {
     VMThread::execute(&dumper);
   }
 
-  // close dump file and record any error that the writer may have encountered
-  writer.close();
-  set_error(writer.error());
+  // close dump file and record any error that the writers may have encountered
+  writer.flush();
+  file.close();
+  set_error(file.error());
 
   // print message in interactive case
   if (print_to_tty()) {
     timer()->stop();
     if (error() == NULL) {
       tty->print_cr("Heap dump file created [" JULONG_FORMAT " bytes in %3.3f secs]",
-                    writer.bytes_written(), timer()->seconds());
+                    file.bytes_written(), timer()->seconds());
     } else {
-      tty->print_cr("Dump file is incomplete: %s", writer.error());
+      tty->print_cr("Dump file is incomplete: %s", file.error());
     }
   }
 
-  return (writer.error() == NULL) ? 0 : -1;
+  return (file.error() == NULL) ? 0 : -1;
 }
 
 // stop timer (if still active), and free any error string we might be holding
@@ -2037,7 +2207,7 @@ void HeapDumper::dump_heap(bool oome) {
   const int max_digit_chars = 20;
 
   const char* dump_file_name = "java_pid";
-  const char* dump_file_ext  = ".hprof";
+  const char* dump_file_ext  = (HeapDumpGzipLevel > 0) ? ".hprof.gz" : ".hprof";
 
   // The dump file defaults to java_pid<pid>.hprof in the current working
   // directory. HeapDumpPath=<file> can be used to specify an alternative
@@ -2105,6 +2275,6 @@ void HeapDumper::dump_heap(bool oome) {
   HeapDumper dumper(false /* no GC before heap dump */,
                     true  /* send to tty */,
                     oome  /* pass along out-of-memory-error flag */);
-  dumper.dump(my_path);
+  dumper.dump(my_path, (int)HeapDumpGzipLevel);
   os::free(my_path);
 }
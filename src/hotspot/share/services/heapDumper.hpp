@@ -71,7 +71,8 @@ class HeapDumper : public StackObj {
   ~HeapDumper();
 
   // dumps the heap to the specified file, returns 0 if success.
-  int dump(const char* path);
+  // A compression level between 1 and 9 writes the file in gzipped format.
+  int dump(const char* path, int compression = 0);
 
   // returns error message (resource allocated), or NULL if no error
   char* error_as_C_string() const;
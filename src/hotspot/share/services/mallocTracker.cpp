@@ -37,10 +37,18 @@ size_t MallocMemorySnapshot::total() const {
   for (int index = 0; index < mt_number_of_types; index ++) {
     amount += _malloc[index].malloc_size();
   }
-  amount += _tracking_header.size() + total_arena();
+  amount += malloc_overhead() + total_arena();
   return amount;
 }
 
+size_t MallocMemorySnapshot::malloc_overhead() const {
+  size_t count = 0;
+  for (int index = 0; index < mt_number_of_types; index ++) {
+    count += _malloc[index].malloc_count();
+  }
+  return count * sizeof(MallocHeader);
+}
+
 // Total malloc'd memory used by arenas
 size_t MallocMemorySnapshot::total_arena() const {
   size_t amount = 0;
@@ -70,7 +78,6 @@ void MallocHeader::release() const {
   if (MemTracker::tracking_level() <= NMT_minimal) return;
 
   MallocMemorySummary::record_free(size(), flags());
-  MallocMemorySummary::record_free_malloc_header(sizeof(MallocHeader));
   if (MemTracker::tracking_level() == NMT_detail) {
     MallocSiteTable::deallocation_at(size(), _bucket_idx, _pos_idx);
   }
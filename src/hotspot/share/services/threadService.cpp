@@ -33,6 +33,7 @@
 #include "oops/oop.inline.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/handles.inline.hpp"
+#include "runtime/handshake.hpp"
 #include "runtime/init.hpp"
 #include "runtime/objectMonitor.inline.hpp"
 #include "runtime/thread.inline.hpp"
@@ -298,19 +299,64 @@ void ThreadService::remove_thread_dump(ThreadDumpResult* dump) {
 // Dump stack trace of threads specified in the given threads array.
 // Returns StackTraceElement[][] each element is the stack trace of a thread in
 // the corresponding entry in the given threads array
+// Takes the stack snapshot of a single thread in a handshake with that
+// thread. The VM thread is busy with the handshake for the whole time, so
+// no safepoint can move the oops recorded in the snapshot under us.
+class ThreadSnapshotClosure : public ThreadClosure {
+ private:
+  ThreadDumpResult* _result;
+  int               _max_depth;
+  ThreadSnapshot*   _snapshot;
+
+ public:
+  ThreadSnapshotClosure(ThreadDumpResult* result, int max_depth)
+    : _result(result), _max_depth(max_depth), _snapshot(NULL) {}
+
+  void do_thread(Thread* thread) {
+    JavaThread* jt = (JavaThread*) thread;
+    if (jt->is_exiting() || jt->is_hidden_from_external_view()) {
+      return;
+    }
+    ResourceMark rm;
+    _snapshot = new ThreadSnapshot(_result->t_list(), jt);
+    _snapshot->dump_stack_at_safepoint(_max_depth, false /* with locked monitors */);
+  }
+
+  ThreadSnapshot* snapshot() const { return _snapshot; }
+};
+
+static void dump_stack_trace_with_handshake(ThreadDumpResult* dump_result, instanceHandle th) {
+  // Protect the target thread with the dump result's ThreadsList
+  dump_result->set_t_list();
+  ThreadSnapshot* ts = NULL;
+  JavaThread* jt = th() != NULL ? java_lang_Thread::thread(th()) : NULL;
+  if (jt != NULL && dump_result->t_list()->includes(jt)) {
+    ThreadSnapshotClosure cl(dump_result, -1 /* entire stack */);
+    Handshake::execute(&cl, jt);
+    ts = cl.snapshot();
+  }
+  // A dummy snapshot stands for a thread that is not alive
+  dump_result->add_thread_snapshot(ts != NULL ? ts : new ThreadSnapshot());
+}
+
 Handle ThreadService::dump_stack_traces(GrowableArray<instanceHandle>* threads,
                                         int num_threads,
                                         TRAPS) {
   assert(num_threads > 0, "just checking");
 
   ThreadDumpResult dump_result;
-  VM_ThreadDump op(&dump_result,
-                   threads,
-                   num_threads,
-                   -1,    /* entire stack */
-                   false, /* with locked monitors */
-                   false  /* with locked synchronizers */);
-  VMThread::execute(&op);
+  if (num_threads == 1 && ThreadLocalHandshakes) {
+    // Thread.getStackTrace() on another thread only needs that thread stopped
+    dump_stack_trace_with_handshake(&dump_result, threads->at(0));
+  } else {
+    VM_ThreadDump op(&dump_result,
+                     threads,
+                     num_threads,
+                     -1,    /* entire stack */
+                     false, /* with locked monitors */
+                     false  /* with locked synchronizers */);
+    VMThread::execute(&op);
+  }
 
   // Allocate the resulting StackTraceElement[][] object
 
@@ -620,7 +666,10 @@ ThreadStackTrace::~ThreadStackTrace() {
 }
 
 void ThreadStackTrace::dump_stack_at_safepoint(int maxDepth) {
-  assert(SafepointSynchronize::is_at_safepoint(), "all threads are stopped");
+  assert(SafepointSynchronize::is_at_safepoint() || Thread::current()->is_VM_thread() ||
+         Thread::current() == _thread, "thread must be stopped");
+  assert(!_with_locked_monitors || SafepointSynchronize::is_at_safepoint(),
+         "scanning inflated monitors needs a safepoint");
 
   if (_thread->has_last_Java_frame()) {
     RegisterMap reg_map(_thread);
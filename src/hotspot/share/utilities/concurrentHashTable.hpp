@@ -327,6 +327,12 @@ class ConcurrentHashTable : public CHeapObj<F> {
   template <typename FUNC>
   void do_scan_locked(Thread* thread, FUNC& scan_f);
 
+  // Same as do_scan_locked but only for buckets start_idx -> (stop_idx-1).
+  // Returns false if FUNC asked to stop the scan.
+  template <typename FUNC>
+  bool do_scan_locked_for(Thread* thread, size_t start_idx, size_t stop_idx,
+                          FUNC& scan_f);
+
   // Check for dead items in a bucket.
   template <typename EVALUATE_FUNC>
   size_t delete_check_nodes(Bucket* bucket, EVALUATE_FUNC& eval_f,
@@ -529,6 +535,7 @@ class ConcurrentHashTable : public CHeapObj<F> {
  public:
   class BulkDeleteTask;
   class GrowTask;
+  class ScanTask;
 };
 
 #endif // include guard
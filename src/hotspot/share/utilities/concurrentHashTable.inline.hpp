@@ -962,15 +962,28 @@ inline void ConcurrentHashTable<VALUE, CONFIG, F>::
   do_scan_locked(Thread* thread, FUNC& scan_f)
 {
   assert(_resize_lock_owner == thread, "Re-size lock not held");
+  do_scan_locked_for(thread, 0, get_table()->_size, scan_f);
+}
+
+template <typename VALUE, typename CONFIG, MEMFLAGS F>
+template <typename FUNC>
+inline bool ConcurrentHashTable<VALUE, CONFIG, F>::
+  do_scan_locked_for(Thread* thread, size_t start_idx, size_t stop_idx,
+                     FUNC& scan_f)
+{
+  assert(_resize_lock_owner != NULL, "Re-size lock not held");
   // We can do a critical section over the entire loop but that would block
   // updates for a long time. Instead we choose to block resizes.
   InternalTable* table = get_table();
-  for (size_t bucket_it = 0; bucket_it < table->_size; bucket_it++) {
+  assert(start_idx < stop_idx, "Must be");
+  assert(stop_idx <= table->_size, "Must be");
+  for (size_t bucket_it = start_idx; bucket_it < stop_idx; bucket_it++) {
     ScopedCS cs(thread, this);
     if (!visit_nodes(table->get_bucket(bucket_it), scan_f)) {
-      break; /* ends critical section */
+      return false; /* ends critical section */
     }
   } /* ends critical section */
+  return true;
 }
 
 template <typename VALUE, typename CONFIG, MEMFLAGS F>
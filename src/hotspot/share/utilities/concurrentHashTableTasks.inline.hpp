@@ -28,8 +28,8 @@
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/concurrentHashTable.inline.hpp"
 
-// This inline file contains BulkDeleteTask and GrowTasks which are both bucket
-// operations, which they are serialized with each other.
+// This inline file contains BulkDeleteTask, GrowTask and ScanTask which are all
+// bucket operations, which they are serialized with each other.
 
 // Base class for pause and/or parallel bulk operations.
 template <typename VALUE, typename CONFIG, MEMFLAGS F>
@@ -199,4 +199,48 @@ class ConcurrentHashTable<VALUE, CONFIG, F>::GrowTask :
   }
 };
 
+// For doing pausable/parallel scanning. Unlike do_scan, several threads
+// can share one ScanTask and each visits the ranges it claims. A SCAN_FUNC
+// returning false only stops the scan of the current range.
+template <typename VALUE, typename CONFIG, MEMFLAGS F>
+class ConcurrentHashTable<VALUE, CONFIG, F>::ScanTask :
+  public BucketsOperation
+{
+ public:
+  ScanTask(ConcurrentHashTable<VALUE, CONFIG, F>* cht) : BucketsOperation(cht, true) {
+  }
+  // Before start prepare must be called.
+  bool prepare(Thread* thread) {
+    bool lock = BucketsOperation::_cht->try_resize_lock(thread);
+    if (!lock) {
+      return false;
+    }
+    this->setup(thread);
+    return true;
+  }
+
+  // Visits all items in one range with SCAN_FUNC. Returns true if there is
+  // more work.
+  template <typename SCAN_FUNC>
+  bool do_task(Thread* thread, SCAN_FUNC& scan_f) {
+    size_t start, stop;
+    assert(BucketsOperation::_cht->_resize_lock_owner != NULL,
+           "Should be locked");
+    if (!this->claim(&start, &stop)) {
+      return false;
+    }
+    BucketsOperation::_cht->do_scan_locked_for(thread, start, stop, scan_f);
+    assert(BucketsOperation::_cht->_resize_lock_owner != NULL,
+           "Should be locked");
+    return true;
+  }
+
+  // Must be called after ranges are done.
+  void done(Thread* thread) {
+    this->thread_owns_resize_lock(thread);
+    BucketsOperation::_cht->unlock_resize_lock(thread);
+    this->thread_do_not_own_resize_lock(thread);
+  }
+};
+
 #endif // include guard
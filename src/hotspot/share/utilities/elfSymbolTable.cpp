@@ -29,9 +29,12 @@
 #include "memory/allocation.inline.hpp"
 #include "utilities/elfFuncDescTable.hpp"
 #include "utilities/elfSymbolTable.hpp"
+#include "utilities/quickSort.hpp"
 
 ElfSymbolTable::ElfSymbolTable(FILE* const file, Elf_Shdr& shdr) :
-  _section(file, shdr), _fd(file), _next(NULL) {
+  _section(file, shdr), _fd(file), _next(NULL),
+  _sorted_funcs(NULL), _sorted_funcs_count(0), _max_func_size(0),
+  _sorted_funcs_built(false) {
   assert(file != NULL, "null file handle");
   _status = _section.status();
 
@@ -44,6 +47,9 @@ ElfSymbolTable::~ElfSymbolTable() {
   if (_next != NULL) {
     delete _next;
   }
+  if (_sorted_funcs != NULL) {
+    FREE_C_HEAP_ARRAY(Elf_Word, _sorted_funcs);
+  }
 }
 
 bool ElfSymbolTable::compare(const Elf_Sym* sym, address addr, int* stringtableIndex, int* posIndex, int* offset, ElfFuncDescTable* funcDescTable) {
@@ -67,6 +73,84 @@ bool ElfSymbolTable::compare(const Elf_Sym* sym, address addr, int* stringtableI
   return false;
 }
 
+// Orders symbol indices by address, and aliases at the same address by
+// index, so that the sort is deterministic.
+class ElfSymbolAddressComparator {
+  const Elf_Sym* const _symbols;
+ public:
+  ElfSymbolAddressComparator(const Elf_Sym* symbols) : _symbols(symbols) {}
+  int operator()(Elf_Word a, Elf_Word b) const {
+    if (_symbols[a].st_value != _symbols[b].st_value) {
+      return _symbols[a].st_value < _symbols[b].st_value ? -1 : 1;
+    }
+    return a == b ? 0 : (a < b ? -1 : 1);
+  }
+};
+
+void ElfSymbolTable::build_sorted_funcs(const Elf_Sym* symbols, int count) {
+  _sorted_funcs_built = true;
+
+  int funcs = 0;
+  for (int index = 0; index < count; index ++) {
+    if (STT_FUNC == ELF_ST_TYPE(symbols[index].st_info) && symbols[index].st_size != 0) {
+      funcs ++;
+    }
+  }
+  if (funcs == 0) {
+    return;
+  }
+
+  // Fall back to the linear scan if there is no memory for the index.
+  Elf_Word* sorted = NEW_C_HEAP_ARRAY_RETURN_NULL(Elf_Word, funcs, mtInternal);
+  if (sorted == NULL) {
+    return;
+  }
+  int pos = 0;
+  size_t max_size = 0;
+  for (int index = 0; index < count; index ++) {
+    if (STT_FUNC == ELF_ST_TYPE(symbols[index].st_info) && symbols[index].st_size != 0) {
+      sorted[pos ++] = (Elf_Word)index;
+      max_size = MAX2(max_size, (size_t)symbols[index].st_size);
+    }
+  }
+  ElfSymbolAddressComparator comparator(symbols);
+  QuickSort::sort(sorted, funcs, comparator, false);
+
+  _sorted_funcs = sorted;
+  _sorted_funcs_count = funcs;
+  _max_func_size = max_size;
+}
+
+bool ElfSymbolTable::lookup_sorted_funcs(const Elf_Sym* symbols, address addr, int* stringtableIndex, int* posIndex, int* offset) {
+  // Find the number of symbols starting at or below addr.
+  int low = 0;
+  int high = _sorted_funcs_count;
+  while (low < high) {
+    int mid = low + (high - low) / 2;
+    if ((address)symbols[_sorted_funcs[mid]].st_value <= addr) {
+      low = mid + 1;
+    } else {
+      high = mid;
+    }
+  }
+  // Symbols may nest, overlap or alias, so walk down over every symbol that
+  // starts close enough to reach addr, and pick the covering one with the
+  // lowest index: that is the one the linear scan would have returned.
+  int found = -1;
+  for (int index = low - 1; index >= 0; index --) {
+    const Elf_Sym* sym = &symbols[_sorted_funcs[index]];
+    size_t distance = (size_t)(addr - (address)sym->st_value);
+    if (distance >= _max_func_size) {
+      break;
+    }
+    if (distance < (size_t)sym->st_size &&
+        (found < 0 || (int)_sorted_funcs[index] < found)) {
+      found = (int)_sorted_funcs[index];
+    }
+  }
+  return found >= 0 && compare(&symbols[found], addr, stringtableIndex, posIndex, offset, NULL);
+}
+
 bool ElfSymbolTable::lookup(address addr, int* stringtableIndex, int* posIndex, int* offset, ElfFuncDescTable* funcDescTable) {
   assert(stringtableIndex, "null string table index pointer");
   assert(posIndex, "null string table offset pointer");
@@ -81,6 +165,16 @@ bool ElfSymbolTable::lookup(address addr, int* stringtableIndex, int* posIndex,
   Elf_Sym* symbols = (Elf_Sym*)_section.section_data();
 
   if (symbols != NULL) {
+    // Function descriptors (PPC64) make the symbol value an indirection, so
+    // only plain tables get the address index.
+    if (funcDescTable == NULL) {
+      if (!_sorted_funcs_built) {
+        build_sorted_funcs(symbols, count);
+      }
+      if (_sorted_funcs != NULL) {
+        return lookup_sorted_funcs(symbols, addr, stringtableIndex, posIndex, offset);
+      }
+    }
     for (int index = 0; index < count; index ++) {
       if (compare(&symbols[index], addr, stringtableIndex, posIndex, offset, funcDescTable)) {
         return true;
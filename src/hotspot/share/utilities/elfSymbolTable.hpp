@@ -35,8 +35,9 @@
 /*
  * symbol table object represents a symbol section in an elf file.
  * Whenever possible, it will load all symbols from the corresponding section
- * of the elf file into memory. Otherwise, it will walk the section in file
- * to look up the symbol that nearest the given address.
+ * of the elf file into memory, and on the first lookup build an index of the
+ * function symbols sorted by address for binary search. Otherwise, it will
+ * walk the section in file to look up the symbol that nearest the given address.
  */
 class ElfSymbolTable: public CHeapObj<mtInternal> {
   friend class ElfFile;
@@ -49,6 +50,12 @@ private:
   // corresponding section
   ElfSection      _section;
 
+  // indices of the function symbols in the cached section, sorted by address
+  Elf_Word*       _sorted_funcs;
+  int             _sorted_funcs_count;
+  size_t          _max_func_size;
+  bool            _sorted_funcs_built;
+
   NullDecoder::decoder_status _status;
 public:
   ElfSymbolTable(FILE* const file, Elf_Shdr& shdr);
@@ -63,6 +70,9 @@ private:
   void set_next(ElfSymbolTable* next) { _next = next; }
 
   bool compare(const Elf_Sym* sym, address addr, int* stringtableIndex, int* posIndex, int* offset, ElfFuncDescTable* funcDescTable);
+
+  void build_sorted_funcs(const Elf_Sym* symbols, int count);
+  bool lookup_sorted_funcs(const Elf_Sym* symbols, address addr, int* stringtableIndex, int* posIndex, int* offset);
 };
 
 #endif // !_WINDOWS and !__APPLE__
@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+
+#ifndef SHARE_VM_UTILITIES_POPULATIONCOUNT_HPP
+#define SHARE_VM_UTILITIES_POPULATIONCOUNT_HPP
+
+#include "utilities/globalDefinitions.hpp"
+
+// unsigned population_count(uintx x)
+// Return the number of bits set in x.
+//
+// Adapted from Hacker's Delight, 2nd Edition, Figure 5-2: bits are summed
+// in parallel in 2-, 4- and then 8-bit fields, and the byte sums are added
+// together with a single multiply.
+//
+// This is deliberately not dispatched to __builtin_popcountl and friends.
+// The builds still target processors without a popcount instruction, and
+// without one the builtin becomes a libgcc call that is slower than this.
+inline unsigned population_count(uintx x) {
+  const uintx m1 = (uintx)UCONST64(0x5555555555555555);
+  const uintx m2 = (uintx)UCONST64(0x3333333333333333);
+  const uintx m4 = (uintx)UCONST64(0x0F0F0F0F0F0F0F0F);
+  const uintx h1 = (uintx)UCONST64(0x0101010101010101);
+  x -= (x >> 1) & m1;
+  x = (x & m2) + ((x >> 2) & m2);
+  x = (x + (x >> 4)) & m4;
+  return (unsigned)((x * h1) >> (BitsPerWord - BitsPerByte));
+}
+
+#endif // include guard
@@ -336,7 +336,17 @@ jint UTF8::get_supplementary_character(const unsigned char* str) {
 bool UTF8::is_legal_utf8(const unsigned char* buffer, int length,
                          bool version_leq_47) {
   int i = 0;
-  int count = length >> 2;
+  // Skip ASCII eight bytes at a time: a word is all legal ASCII if no
+  // byte has the high bit set and no byte is zero.
+  const uint64_t high_bits = CONST64(0x8080808080808080);
+  const uint64_t low_bits  = CONST64(0x0101010101010101);
+  while (i + 8 <= length) {
+    uint64_t v;
+    memcpy(&v, buffer + i, sizeof(v));
+    if (((v | ((v - low_bits) & ~v)) & high_bits) != 0) break;
+    i += 8;
+  }
+  int count = (length - i) >> 2;
   for (int k=0; k<count; k++) {
     unsigned char b0 = buffer[i];
     unsigned char b1 = buffer[i+1];
@@ -273,16 +273,13 @@ void SharedStringDecompressor::decompress_resource(u1* data,
                             // the case where we have a package.
                             // reconstruct the type full name
                             if (str_length > 0) {
-                                int len = str_length + 1;
-                                char* fullpkg = new char[len];
-                                char* pkg_base = fullpkg;
-                                memcpy(fullpkg, pkg, str_length);
-                                fullpkg += str_length;
-                                *fullpkg = '/';
-                                memcpy(uncompressed_resource, pkg_base, len);
-                                uncompressed_resource += len;
-                                delete[] pkg_base;
-                                desc_length += len;
+                                // Copy the package and its separator straight
+                                // into the output.
+                                memcpy(uncompressed_resource, pkg, str_length);
+                                uncompressed_resource += str_length;
+                                *uncompressed_resource = '/';
+                                uncompressed_resource += 1;
+                                desc_length += str_length + 1;
                             } else { // Empty package
                                 // Nothing to do.
                             }
@@ -657,6 +657,12 @@ readCEN(jzfile *zip, jint knownTotal)
                 jio_fprintf(stderr, "mmap failed for CEN and END part of zip file\n");
                 goto Catch;
             }
+#ifdef MADV_WILLNEED
+            /* The whole CEN is scanned right below to build the hash table;
+             * let the kernel read it ahead instead of faulting it in one
+             * page at a time. Failure is harmless. */
+            madvise((char *)zip->maddr, zip->mlen, MADV_WILLNEED);
+#endif
         }
         cenbuf = zip->maddr + cenpos - offset;
     } else
@@ -1589,3 +1595,51 @@ ZIP_InflateFully(void *inBuf, jlong inLen, void *outBuf, jlong outLen, char **pm
     inflateEnd(&strm);
     return JNI_TRUE;
 }
+
+/*
+ * Compresses the input buffer into the output buffer as a single
+ * gzip member, so that several members can be concatenated into one
+ * gzip file. Returns the compressed size, or 0 if the compression
+ * failed, in which case pmsg points to an error message.
+ * Note: this is called from the separately delivered VM (hotspot/classic)
+ * so we have to be careful to maintain the expected behaviour.
+ */
+JNIEXPORT jlong
+ZIP_GZip_Fully(void *inBuf, jlong inLen, void *outBuf, jlong outLen, jint level, char **pmsg)
+{
+    z_stream strm;
+    jlong result;
+    memset(&strm, 0, sizeof(z_stream));
+
+    *pmsg = 0; /* Reset error message */
+
+    /* Adding 16 to the window bits selects the gzip header and trailer */
+    if (deflateInit2(&strm, level, Z_DEFLATED, MAX_WBITS + 16, 8,
+                     Z_DEFAULT_STRATEGY) != Z_OK) {
+        *pmsg = (strm.msg != NULL) ? strm.msg : "ZIP_GZip_Fully: initialization failed";
+        return 0;
+    }
+
+    strm.next_out = (Bytef *) outBuf;
+    strm.avail_out = (uInt)outLen;
+    strm.next_in = (Bytef *) inBuf;
+    strm.avail_in = (uInt)inLen;
+
+    switch (deflate(&strm, Z_FINISH)) {
+        case Z_STREAM_END:
+            result = (jlong)strm.total_out;
+            break;
+        case Z_OK:
+        case Z_BUF_ERROR:
+            *pmsg = "ZIP_GZip_Fully: output buffer too small";
+            result = 0;
+            break;
+        default:
+            *pmsg = "ZIP_GZip_Fully: internal error";
+            result = 0;
+            break;
+    }
+
+    deflateEnd(&strm);
+    return result;
+}
@@ -284,4 +284,7 @@ jzentry * ZIP_GetEntry2(jzfile *zip, char *name, jint ulen, jboolean addSlash);
 JNIEXPORT jboolean
 ZIP_InflateFully(void *inBuf, jlong inLen, void *outBuf, jlong outLen, char **pmsg);
 
+JNIEXPORT jlong
+ZIP_GZip_Fully(void *inBuf, jlong inLen, void *outBuf, jlong outLen, jint level, char **pmsg);
+
 #endif /* !_ZIP_H_ */
@@ -124,6 +124,8 @@ Java_java_net_Inet4AddressImpl_lookupAllHostAddr(JNIEnv *env, jobject this,
     memset(&hints, 0, sizeof(hints));
     hints.ai_flags = AI_CANONNAME;
     hints.ai_family = AF_INET;
+    // one entry per address rather than one per socket type
+    hints.ai_socktype = SOCK_STREAM;
 
     error = getaddrinfo(hostname, NULL, &hints, &res);
 
@@ -29,7 +29,10 @@
 #include <sys/types.h>
 #include <unistd.h>
 
-#if defined(__linux__) || defined(__solaris__)
+#if defined(__linux__)
+#include <sys/sendfile.h>
+#include <dlfcn.h>
+#elif defined(__solaris__)
 #include <sys/sendfile.h>
 #elif defined(_AIX)
 #include <sys/socket.h>
@@ -50,11 +53,22 @@
 
 static jfieldID chan_fd;        /* jobject 'fd' in sun.nio.ch.FileChannelImpl */
 
+#if defined(__linux__)
+typedef ssize_t copy_file_range_func(int, loff_t*, int, loff_t*, size_t,
+                                     unsigned int);
+/* copy_file_range(2) if the C library provides it (glibc 2.27+) */
+static copy_file_range_func* my_copy_file_range_func = NULL;
+#endif
+
 JNIEXPORT jlong JNICALL
 Java_sun_nio_ch_FileChannelImpl_initIDs(JNIEnv *env, jclass clazz)
 {
     jlong pageSize = sysconf(_SC_PAGESIZE);
     chan_fd = (*env)->GetFieldID(env, clazz, "fd", "Ljava/io/FileDescriptor;");
+#if defined(__linux__)
+    my_copy_file_range_func =
+        (copy_file_range_func*) dlsym(RTLD_DEFAULT, "copy_file_range");
+#endif
     return pageSize;
 }
 
@@ -132,7 +146,26 @@ Java_sun_nio_ch_FileChannelImpl_transferTo0(JNIEnv *env, jobject this,
 
 #if defined(__linux__)
     off64_t offset = (off64_t)position;
-    jlong n = sendfile64(dstFD, srcFD, &offset, (size_t)count);
+    jlong n;
+
+    /* For file to file transfers let the file system do the copy, which
+     * may share extents or copy on the server side. Any failure, or a
+     * zero return from pseudo files that report no size, falls back to
+     * sendfile, which writes at the current position of dstFD just the
+     * same.
+     */
+    if (my_copy_file_range_func != NULL) {
+        struct stat64 st;
+        if (fstat64(dstFD, &st) == 0 && S_ISREG(st.st_mode)) {
+            loff_t srcOffset = (loff_t)position;
+            n = my_copy_file_range_func(srcFD, &srcOffset, dstFD, NULL,
+                                        (size_t)count, 0);
+            if (n > 0)
+                return n;
+        }
+    }
+
+    n = sendfile64(dstFD, srcFD, &offset, (size_t)count);
     if (n < 0) {
         if (errno == EAGAIN)
             return IOS_UNAVAILABLE;
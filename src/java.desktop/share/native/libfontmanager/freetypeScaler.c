@@ -73,6 +73,16 @@ typedef struct {
     unsigned fontDataOffset;
     unsigned fontDataLength;
     unsigned fileSize;
+
+    /* Size and transform last applied to the face by setupFTContext.
+       Strikes of the same font usually alternate between a handful of
+       sizes, and every glyph request funnels through setupFTContext, so
+       we skip FT_Set_Char_Size (which recomputes the scaled metrics and,
+       for hinted TrueType fonts, re-runs the prep program) when the face
+       is already set up for the requested size. */
+    FT_Matrix lastMatrix;
+    int lastPtsz;
+    jboolean sizeValid;
 } FTScalerInfo;
 
 typedef struct FTScalerContext {
@@ -506,6 +516,17 @@ static int setupFTContext(JNIEnv *env,
 
     if (context != NULL) {
         setupTransform(&matrix, context);
+
+        if (scalerInfo->sizeValid &&
+            scalerInfo->lastPtsz == context->ptsz &&
+            scalerInfo->lastMatrix.xx == matrix.xx &&
+            scalerInfo->lastMatrix.xy == matrix.xy &&
+            scalerInfo->lastMatrix.yx == matrix.yx &&
+            scalerInfo->lastMatrix.yy == matrix.yy) {
+            return 0;
+        }
+
+        scalerInfo->sizeValid = JNI_FALSE;
         FT_Set_Transform(scalerInfo->face, &matrix, NULL);
 
         errCode = FT_Set_Char_Size(scalerInfo->face, 0, context->ptsz, 72, 72);
@@ -514,6 +535,12 @@ static int setupFTContext(JNIEnv *env,
             errCode = FT_Activate_Size(scalerInfo->face->size);
         }
 
+        if (errCode == 0) {
+            scalerInfo->lastMatrix = matrix;
+            scalerInfo->lastPtsz = context->ptsz;
+            scalerInfo->sizeValid = JNI_TRUE;
+        }
+
         FT_Library_SetLcdFilter(scalerInfo->library, FT_LCD_FILTER_DEFAULT);
     }
 
@@ -51,6 +51,7 @@
 inline bool jar::deflate_bytes(bytes& head, bytes& tail) {
   return false;
 }
+void jar::free_deflater() { }
 inline uint jar::get_crc32(uint c, uchar *ptr, uint len) { return 0; }
 #define Z_NULL NULL
 
@@ -456,14 +457,28 @@ uLong jar::get_dostime(int modtime) {
 bool jar::deflate_bytes(bytes& head, bytes& tail) {
   int len = (int)(head.len + tail.len);
 
-  z_stream zs;
-  BYTES_OF(zs).clear();
-
-  // NOTE: the window size should always be -MAX_WBITS normally -15.
-  // unzip/zipup.c and java/Deflater.c
-
-  int error = deflateInit2(&zs, Z_DEFAULT_COMPRESSION, Z_DEFLATED,
-                           -MAX_WBITS, 8, Z_DEFAULT_STRATEGY);
+  // The deflater state (a few hundred KB of window and hash tables) is
+  // set up once and reset for each entry, rather than being allocated
+  // and freed again for every file in the archive.
+  int error = Z_OK;
+  if (zdeflater == null) {
+    zdeflater = NEW(z_stream, 1);
+    if (zdeflater == null) {
+      PRINTCR((2, "Error: deflate error : Out of memory \n"));
+      return false;
+    }
+    // NOTE: the window size should always be -MAX_WBITS normally -15.
+    // unzip/zipup.c and java/Deflater.c
+    error = deflateInit2((z_stream*) zdeflater, Z_DEFAULT_COMPRESSION, Z_DEFLATED,
+                         -MAX_WBITS, 8, Z_DEFAULT_STRATEGY);
+    if (error != Z_OK) {
+      mtrace('f', zdeflater, 0);
+      ::free(zdeflater);
+      zdeflater = null;
+    }
+  } else {
+    error = deflateReset((z_stream*) zdeflater);
+  }
   if (error != Z_OK) {
     switch (error) {
     case Z_MEM_ERROR:
@@ -481,6 +496,7 @@ bool jar::deflate_bytes(bytes& head, bytes& tail) {
     return false;
   }
 
+  z_stream& zs = *(z_stream*) zdeflater;
   deflated.empty();
   zs.next_out  = (uchar*) deflated.grow(add_size(len, (len/2)));
   zs.avail_out = (int)deflated.size();
@@ -512,19 +528,25 @@ bool jar::deflate_bytes(bytes& head, bytes& tail) {
       // Even if compressed size is bigger than uncompressed, write it
       PRINTCR((2, "deflate compressed data %d -> %d\n", len, zs.total_out));
       deflated.b.len = zs.total_out;
-      deflateEnd(&zs);
       return true;
     }
     PRINTCR((2, "deflate expanded data %d -> %d\n", len, zs.total_out));
-    deflateEnd(&zs);
     return false;
   }
 
-  deflateEnd(&zs);
   PRINTCR((2, "Error: deflate error deflate did not finish error=%d\n",error));
   return false;
 }
 
+void jar::free_deflater() {
+  if (zdeflater != null) {
+    deflateEnd((z_stream*) zdeflater);
+    mtrace('f', zdeflater, 0);
+    ::free(zdeflater);
+    zdeflater = null;
+  }
+}
+
 // Callback for fetching data from a GZIP input stream
 static jlong read_input_via_gzip(unpacker* u,
                                   void* buf, jlong minlen, jlong maxlen) {
@@ -414,6 +414,65 @@ TEST_VM_F(OopStorageTest, allocate_many) {
   }
 }
 
+TEST_VM_F(OopStorageTest, bulk_allocation) {
+  static const size_t max_entries = 1000;
+  static const size_t zero = 0;
+  oop* entries[max_entries] = {};
+
+  AllocationList& allocation_list = TestAccess::allocation_list(_storage);
+
+  EXPECT_EQ(0u, empty_block_count(_storage));
+  size_t allocated = _storage.allocate(entries, max_entries);
+  ASSERT_NE(allocated, zero);
+  // A bulk allocation never spans blocks.
+  ASSERT_LE(allocated, (size_t)BitsPerWord);
+  EXPECT_EQ(allocated, _storage.allocation_count());
+  EXPECT_EQ(1u, _storage.block_count());
+  for (size_t i = 0; i < allocated; ++i) {
+    ASSERT_TRUE(entries[i] != NULL);
+    EXPECT_TRUE(*entries[i] == NULL);
+    EXPECT_EQ(OopStorage::ALLOCATED_ENTRY, _storage.allocation_status(entries[i]));
+  }
+  for (size_t i = allocated; i < max_entries; ++i) {
+    EXPECT_TRUE(entries[i] == NULL);
+  }
+  EXPECT_TRUE(is_list_empty(allocation_list));
+
+  _storage.release(entries, allocated);
+  EXPECT_EQ(0u, _storage.allocation_count());
+  process_deferred_updates(_storage);
+  EXPECT_EQ(1u, list_length(allocation_list));
+  EXPECT_EQ(1u, empty_block_count(_storage));
+}
+
+TEST_VM_F(OopStorageTest, bulk_allocation_partial) {
+  static const size_t requested = 10;
+  oop* entries[requested] = {};
+
+  AllocationList& allocation_list = TestAccess::allocation_list(_storage);
+
+  // A small request takes the whole block and releases the remainder.
+  size_t allocated = _storage.allocate(entries, requested);
+  ASSERT_EQ(requested, allocated);
+  EXPECT_EQ(requested, _storage.allocation_count());
+  EXPECT_EQ(1u, _storage.block_count());
+  const OopBlock* block = TestAccess::active_array(_storage).at(0);
+  EXPECT_EQ(requested, (size_t)TestAccess::block_allocation_count(*block));
+
+  // The released remainder makes the block available again.
+  process_deferred_updates(_storage);
+  EXPECT_EQ(1u, list_length(allocation_list));
+  EXPECT_EQ(block, allocation_list.chead());
+
+  oop* entry = _storage.allocate();
+  ASSERT_TRUE(entry != NULL);
+  EXPECT_TRUE(block->contains(entry));
+  release_entry(_storage, entry);
+
+  _storage.release(entries, allocated);
+  EXPECT_EQ(0u, _storage.allocation_count());
+}
+
 TEST_VM_F(OopStorageTestWithAllocation, random_release) {
   static const size_t step = 11;
   ASSERT_NE(0u, _max_entries % step); // max_entries and step are mutually prime
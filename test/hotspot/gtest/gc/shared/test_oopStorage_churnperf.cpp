@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "gc/shared/oopStorage.inline.hpp"
+#include "gc/shared/workgroup.hpp"
+#include "memory/allocation.inline.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/interfaceSupport.inline.hpp"
+#include "runtime/mutex.hpp"
+#include "runtime/os.hpp"
+#include "runtime/thread.hpp"
+#include "runtime/vmOperations.hpp"
+#include "runtime/vmThread.hpp"
+#include "utilities/debug.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+#include "unittest.hpp"
+
+// Exercises OopStorage allocation and release under contention,
+// modelled on JNI handle churn.  Each worker repeatedly allocates a
+// batch of entries and releases them again, either one entry at a
+// time or in bulk, and no allocation may fail or be leaked.
+
+const uint _max_churn_workers = 64;
+static uint _num_churn_workers = 0;
+const size_t _churn_batch = 32;
+const size_t _churn_iterations = 2000;
+
+class OopStorageChurnPerf : public ::testing::Test {
+public:
+  OopStorageChurnPerf();
+
+  WorkGang* workers() const;
+
+  class VM_ChurnTime;
+  class Task;
+
+  void run_task(Task* task, uint nthreads);
+  void run_test(uint nthreads, bool bulk);
+
+  static WorkGang* _workers;
+
+  static const int _active_rank = Mutex::leaf - 1;
+  static const int _allocate_rank = Mutex::leaf;
+
+  Mutex _allocate_mutex;
+  Mutex _active_mutex;
+  OopStorage _storage;
+};
+
+WorkGang* OopStorageChurnPerf::_workers = NULL;
+
+WorkGang* OopStorageChurnPerf::workers() const {
+  if (_workers == NULL) {
+    WorkGang* wg = new WorkGang("OopStorageChurnPerf workers",
+                                _num_churn_workers,
+                                false,
+                                false);
+    wg->initialize_workers();
+    wg->update_active_workers(_num_churn_workers);
+    _workers = wg;
+  }
+  return _workers;
+}
+
+OopStorageChurnPerf::OopStorageChurnPerf() :
+  _allocate_mutex(_allocate_rank,
+                  "test_OopStorage_churnperf_allocate",
+                  false,
+                  Mutex::_safepoint_check_never),
+  _active_mutex(_active_rank,
+                "test_OopStorage_churnperf_active",
+                false,
+                Mutex::_safepoint_check_never),
+  _storage("Test Storage", &_allocate_mutex, &_active_mutex)
+{
+  _num_churn_workers = MIN2(_max_churn_workers, (uint)os::processor_count());
+}
+
+class OopStorageChurnPerf::VM_ChurnTime : public VM_GTestExecuteAtSafepoint {
+public:
+  VM_ChurnTime(WorkGang* workers, AbstractGangTask* task, uint nthreads) :
+    _workers(workers), _task(task), _nthreads(nthreads)
+  {}
+
+  void doit() {
+    _workers->run_task(_task, _nthreads);
+  }
+
+private:
+  WorkGang* _workers;
+  AbstractGangTask* _task;
+  uint _nthreads;
+};
+
+class OopStorageChurnPerf::Task : public AbstractGangTask {
+  OopStorage* _storage;
+  bool _bulk;
+  volatile size_t _failures;
+
+  size_t allocate_batch(oop** entries) {
+    size_t count = 0;
+    if (_bulk) {
+      while (count < _churn_batch) {
+        size_t allocated = _storage->allocate(entries + count, _churn_batch - count);
+        if (allocated == 0) break;
+        count += allocated;
+      }
+    } else {
+      for ( ; count < _churn_batch; ++count) {
+        entries[count] = _storage->allocate();
+        if (entries[count] == NULL) break;
+      }
+    }
+    return count;
+  }
+
+public:
+  Task(OopStorage* storage, bool bulk) :
+    AbstractGangTask("OopStorageChurnPerf::Task"),
+    _storage(storage),
+    _bulk(bulk),
+    _failures(0)
+  {}
+
+  virtual void work(uint worker_id) {
+    oop* entries[_churn_batch];
+    for (size_t i = 0; i < _churn_iterations; ++i) {
+      size_t count = allocate_batch(entries);
+      if (count < _churn_batch) {
+        Atomic::inc(&_failures);
+      }
+      _storage->release(entries, count);
+    }
+  }
+
+  size_t failures() const { return _failures; }
+};
+
+void OopStorageChurnPerf::run_task(Task* task, uint nthreads) {
+  VM_ChurnTime op(workers(), task, nthreads);
+  ThreadInVMfromNative invm(JavaThread::current());
+  VMThread::execute(&op);
+}
+
+void OopStorageChurnPerf::run_test(uint nthreads, bool bulk) {
+  SCOPED_TRACE(err_msg("Running test with %u threads, bulk %s",
+                       nthreads, BOOL_TO_STR(bulk)).buffer());
+  Task task(&_storage, bulk);
+  run_task(&task, nthreads);
+  EXPECT_EQ(0u, task.failures());
+  EXPECT_EQ(0u, _storage.allocation_count());
+}
+
+TEST_VM_F(OopStorageChurnPerf, test) {
+  run_test(1, false);
+  run_test(1, true);
+  run_test(MIN2(8u, _num_churn_workers), false);
+  run_test(MIN2(8u, _num_churn_workers), true);
+  run_test(_num_churn_workers, false);
+  run_test(_num_churn_workers, true);
+}
@@ -24,6 +24,7 @@
 #include "precompiled.hpp"
 #include "memory/resourceArea.hpp"
 #include "utilities/bitMap.inline.hpp"
+#include "utilities/population_count.hpp"
 #include "unittest.hpp"
 
 class BitMapTest {
@@ -95,6 +96,45 @@ class BitMapTest {
     EXPECT_TRUE(map.is_same(map2)) << "With init_size " << init_size;
   }
 
+  static BitMap::idx_t countOneBitsSlow(const BitMap& map, BitMap::idx_t beg, BitMap::idx_t end) {
+    BitMap::idx_t count = 0;
+    for (BitMap::idx_t i = beg; i < end; i++) {
+      if (map.at(i)) {
+        count++;
+      }
+    }
+    return count;
+  }
+
+  static void testCountOneBits(BitMap::idx_t size) {
+    ResourceMark rm;
+
+    ResourceBitMap map(size);
+    for (BitMap::idx_t i = 0; i < size; i++) {
+      // Irregular pattern so that every word holds a different value.
+      if ((i * 7) % 11 < 5 || i % 64 == 63) {
+        map.set_bit(i);
+      }
+    }
+
+    EXPECT_EQ(countOneBitsSlow(map, 0, size), map.count_one_bits()) << "With size " << size;
+
+    const BitMap::idx_t bpw = BitsPerWord;
+    const BitMap::idx_t offsets[] = { 0, 1, bpw - 1, bpw, bpw + 1, 3 * bpw + 5, size / 2, size - bpw - 1, size - 1, size };
+    const size_t n = sizeof(offsets) / sizeof(offsets[0]);
+    for (size_t i = 0; i < n; i++) {
+      for (size_t j = 0; j < n; j++) {
+        BitMap::idx_t beg = offsets[i];
+        BitMap::idx_t end = offsets[j];
+        if (beg > end || end > size) {
+          continue;
+        }
+        EXPECT_EQ(countOneBitsSlow(map, beg, end), map.count_one_bits(beg, end))
+          << "With size " << size << " range [" << beg << ", " << end << ")";
+      }
+    }
+  }
+
 };
 
 TEST_VM(BitMap, resize_grow) {
@@ -130,3 +170,37 @@ TEST_VM(BitMap, reinitialize) {
   BitMapTest::testReinitialize(BitMapTest::BITMAP_SIZE >> 3);
   BitMapTest::testReinitialize(BitMapTest::BITMAP_SIZE);
 }
+
+TEST_VM(BitMap, count_one_bits) {
+  ResourceMark rm;
+  const BitMap::idx_t size = BitMapTest::BITMAP_SIZE;
+
+  ResourceBitMap map(size);
+  EXPECT_EQ(0u, map.count_one_bits());
+  EXPECT_EQ(0u, map.count_one_bits(0, 0));
+  EXPECT_EQ(0u, map.count_one_bits(17, 17));
+
+  map.set_range(0, size);
+  EXPECT_EQ(size, map.count_one_bits());
+  // Within a single word.
+  EXPECT_EQ(10u, map.count_one_bits(3, 13));
+  // Unaligned start and end, spanning full words.
+  EXPECT_EQ(size - 8, map.count_one_bits(5, size - 3));
+
+  BitMapTest::testCountOneBits(size);
+  // The last word is only partially used.
+  BitMapTest::testCountOneBits(size + 37);
+}
+
+TEST(BitMap, population_count) {
+  EXPECT_EQ(0u, population_count(0));
+  EXPECT_EQ(1u, population_count(1));
+  EXPECT_EQ(1u, population_count((uintx)1 << (BitsPerWord - 1)));
+  EXPECT_EQ((unsigned)BitsPerWord, population_count(~(uintx)0));
+  EXPECT_EQ((unsigned)BitsPerWord / 2, population_count((uintx)UCONST64(0x5555555555555555)));
+  for (uint i = 0; i < (uint)BitsPerWord; i++) {
+    uintx low = right_n_bits(i);
+    EXPECT_EQ(i, population_count(low)) << "Low " << i << " bits";
+    EXPECT_EQ((unsigned)BitsPerWord - i, population_count(~low)) << "High " << (BitsPerWord - i) << " bits";
+  }
+}
@@ -22,6 +22,7 @@
  */
 
 #include "precompiled.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/mutex.hpp"
 #include "runtime/semaphore.hpp"
 #include "runtime/thread.hpp"
@@ -1023,3 +1024,71 @@ public:
 TEST_VM(ConcurrentHashTable, concurrent_mt_bulk_delete) {
   mt_test_doer<Driver_BD_Thread>();
 }
+
+//#############################################################################################
+
+#define SCAN_ITEMS 99999
+
+class MT_Scan_Thread : public JavaTestThread {
+  TestTable::ScanTask* _st;
+  jint* _visits;
+  public:
+  MT_Scan_Thread(Semaphore* post, TestTable::ScanTask* st, jint* visits)
+    : JavaTestThread(post), _st(st), _visits(visits) {}
+  virtual ~MT_Scan_Thread() {}
+  void main_run() {
+    while(_st->do_task(this, *this));
+  }
+
+  bool operator()(uintptr_t* val) {
+    EXPECT_TRUE(*val > 0 && *val < SCAN_ITEMS) << "Unexpected value";
+    Atomic::inc(&_visits[*val]);
+    return true;
+  }
+};
+
+class Driver_Scan_Thread : public JavaTestThread {
+public:
+  Driver_Scan_Thread(Semaphore* post) : JavaTestThread(post) {
+  };
+  virtual ~Driver_Scan_Thread(){}
+
+  void main_run() {
+    Semaphore done(0);
+    TestTable* cht = new TestTable(16, 16, 2);
+    for (uintptr_t v = 1; v < SCAN_ITEMS; v++ ) {
+      TestLookup tl(v);
+      EXPECT_TRUE(cht->insert(this, tl, v)) << "Inserting an unique value should work.";
+    }
+    jint* visits = NEW_C_HEAP_ARRAY(jint, SCAN_ITEMS, mtInternal);
+    for (uintptr_t v = 0; v < SCAN_ITEMS; v++ ) {
+      visits[v] = 0;
+    }
+
+    TestTable::ScanTask st(cht);
+    EXPECT_TRUE(st.prepare(this)) << "Uncontended prepare must work.";
+
+    MT_Scan_Thread* tt[4];
+    for (int i = 0; i < 4; i++) {
+      tt[i] = new MT_Scan_Thread(&done, &st, visits);
+      tt[i]->doit();
+    }
+
+    for (int i = 0; i < 4; i++) {
+      done.wait();
+    }
+
+    st.done(this);
+
+    EXPECT_EQ(0, visits[0]) << "Value 0 was never inserted";
+    for (uintptr_t v = 1; v < SCAN_ITEMS; v++ ) {
+      EXPECT_EQ(1, visits[v]) << "Value " << v << " must be visited exactly once";
+    }
+    FREE_C_HEAP_ARRAY(jint, visits);
+    delete cht;
+  }
+};
+
+TEST_VM(ConcurrentHashTable, concurrent_mt_scan_task) {
+  mt_test_doer<Driver_Scan_Thread>();
+}
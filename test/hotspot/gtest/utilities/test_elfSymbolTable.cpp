@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+
+#if !defined(_WINDOWS) && !defined(__APPLE__)
+
+#include "utilities/elfSymbolTable.hpp"
+#include "unittest.hpp"
+
+static Elf_Sym make_symbol(Elf_Word name, unsigned char type, Elf_Addr value, Elf_Word size) {
+  Elf_Sym sym;
+  memset(&sym, 0, sizeof(sym));
+  sym.st_name = name;
+  sym.st_info = (unsigned char)((STB_GLOBAL << 4) | type);
+  sym.st_value = value;
+  sym.st_size = size;
+  return sym;
+}
+
+// The first function symbol in table order that covers addr, as found by the
+// linear scan the sorted index replaces.
+static bool linear_lookup(const Elf_Sym* symbols, int count, address addr, int* posIndex, int* offset) {
+  for (int index = 0; index < count; index++) {
+    const Elf_Sym* sym = &symbols[index];
+    address sym_addr = (address)sym->st_value;
+    if (STT_FUNC == ELF_ST_TYPE(sym->st_info) &&
+        sym_addr <= addr && (Elf_Word)(addr - sym_addr) < sym->st_size) {
+      *posIndex = sym->st_name;
+      *offset = (int)(addr - sym_addr);
+      return true;
+    }
+  }
+  return false;
+}
+
+TEST_VM(ElfSymbolTable, sorted_lookup_matches_linear_scan) {
+  const Elf_Sym symbols[] = {
+    make_symbol(0,   STT_NOTYPE, 0,      0),
+    make_symbol(10,  STT_FUNC,   0x1000, 0x100),  // lowest address
+    make_symbol(20,  STT_OBJECT, 0x1050, 0x10),   // not a function
+    make_symbol(30,  STT_FUNC,   0x1200, 0x40),   // aliases of different size
+    make_symbol(40,  STT_FUNC,   0x1200, 0x80),
+    make_symbol(50,  STT_FUNC,   0x2000, 0x1000), // the largest, encloses the next
+    make_symbol(60,  STT_FUNC,   0x2100, 0x10),
+    make_symbol(70,  STT_FUNC,   0x1800, 0),      // no size, never matches
+    make_symbol(80,  STT_FUNC,   0x3100, 0x20),   // nested in the one below
+    make_symbol(90,  STT_FUNC,   0x3080, 0x100),
+    make_symbol(100, STT_FUNC,   0x4000, 0x8)     // highest address, last symbol
+  };
+  const int count = (int)(sizeof(symbols) / sizeof(symbols[0]));
+  const Elf_Word string_table = 7;
+
+  FILE* file = tmpfile();
+  ASSERT_TRUE(file != NULL);
+  ASSERT_EQ(1u, fwrite(symbols, sizeof(symbols), 1, file));
+
+  Elf_Shdr shdr;
+  memset(&shdr, 0, sizeof(shdr));
+  shdr.sh_type = SHT_SYMTAB;
+  shdr.sh_offset = 0;
+  shdr.sh_size = sizeof(symbols);
+  shdr.sh_entsize = sizeof(Elf_Sym);
+  shdr.sh_link = string_table;
+
+  {
+    ElfSymbolTable table(file, shdr);
+    ASSERT_FALSE(NullDecoder::is_error(table.get_status()));
+
+    // Before the first symbol, inside every symbol and across the gaps
+    // between them, up to past the last symbol.
+    for (uintptr_t a = 0xF00; a < 0x4100; a++) {
+      address addr = (address)a;
+      int expected_pos = -1;
+      int expected_offset = -1;
+      bool expected = linear_lookup(symbols, count, addr, &expected_pos, &expected_offset);
+
+      int string_index = -1;
+      int pos = -1;
+      int offset = -1;
+      bool found = table.lookup(addr, &string_index, &pos, &offset, NULL);
+      ASSERT_EQ(expected, found) << "At " << a;
+      if (found) {
+        EXPECT_EQ((int)string_table, string_index) << "At " << a;
+        EXPECT_EQ(expected_pos, pos) << "At " << a;
+        EXPECT_EQ(expected_offset, offset) << "At " << a;
+      }
+    }
+
+    int string_index, pos, offset;
+    EXPECT_TRUE(table.lookup((address)0x1000, &string_index, &pos, &offset, NULL));
+    EXPECT_EQ(10, pos);
+    EXPECT_EQ(0, offset);
+    EXPECT_TRUE(table.lookup((address)0x4007, &string_index, &pos, &offset, NULL));
+    EXPECT_EQ(100, pos);
+    EXPECT_EQ(7, offset);
+    EXPECT_FALSE(table.lookup((address)0x1150, &string_index, &pos, &offset, NULL));
+    EXPECT_FALSE(table.lookup((address)0x4008, &string_index, &pos, &offset, NULL));
+  }
+
+  fclose(file);
+}
+
+#endif // !_WINDOWS && !__APPLE__
@@ -48,3 +48,45 @@ TEST(utf8, length) {
   UNICODE::as_utf8(str, 19, res, INT_MAX);
   ASSERT_EQ(strlen(res), (size_t) 3 * 19) << "string should end here";
 }
+
+static bool is_legal_utf8_at(unsigned char* buf, int length, int pos,
+                             unsigned char b0, unsigned char b1 = 'a') {
+  memset(buf, 'a', length);
+  buf[pos] = b0;
+  if (pos + 1 < length) {
+    buf[pos + 1] = b1;
+  }
+  return UTF8::is_legal_utf8(buf, length, false);
+}
+
+TEST(utf8, is_legal_utf8_word_boundaries) {
+  unsigned char buf[40];
+
+  // The extremes of ASCII are legal in every position of a word.
+  for (int len = 1; len < 40; len++) {
+    memset(buf, 0x01, len);
+    EXPECT_TRUE(UTF8::is_legal_utf8(buf, len, false)) << "0x01 run of length " << len;
+    memset(buf, 0x7F, len);
+    EXPECT_TRUE(UTF8::is_legal_utf8(buf, len, false)) << "0x7F run of length " << len;
+  }
+
+  for (int len = 1; len < 40; len++) {
+    for (int pos = 0; pos < len; pos++) {
+      EXPECT_FALSE(is_legal_utf8_at(buf, len, pos, 0x00)) << "Zero at " << pos << " of " << len;
+      EXPECT_FALSE(is_legal_utf8_at(buf, len, pos, 0xFF)) << "0xFF at " << pos << " of " << len;
+      EXPECT_FALSE(is_legal_utf8_at(buf, len, pos, 0x80)) << "Stray continuation at " << pos << " of " << len;
+      if (pos + 1 < len) {
+        // U+00E9, possibly straddling two words.
+        EXPECT_TRUE(is_legal_utf8_at(buf, len, pos, 0xC3, 0xA9)) << "Two-byte char at " << pos << " of " << len;
+        EXPECT_FALSE(is_legal_utf8_at(buf, len, pos, 0xC3, 'a')) << "Bad continuation at " << pos << " of " << len;
+      } else {
+        EXPECT_FALSE(is_legal_utf8_at(buf, len, pos, 0xC3)) << "Truncated char at end of " << len;
+      }
+    }
+  }
+
+  // A zero byte next to 0x01 bytes must still be found.
+  memset(buf, 0x01, 16);
+  buf[9] = 0x00;
+  EXPECT_FALSE(UTF8::is_legal_utf8(buf, 16, false));
+}